@@ -72,6 +72,7 @@ private:
 	bool abort_on_gpu_errors = false;
 	bool use_validation_layers = false;
 	bool generate_spirv_debug_info = false;
+	bool dedicated_server_mode = false;
 	int32_t gpu_idx = -1;
 
 	uint64_t _process_frames = 0;
@@ -176,6 +177,7 @@ public:
 	bool is_abort_on_gpu_errors_enabled() const;
 	bool is_validation_layers_enabled() const;
 	bool is_generate_spirv_debug_info_enabled() const;
+	bool is_dedicated_server_mode_enabled() const;
 	int32_t get_gpu_index() const;
 
 	Engine();
@@ -38,6 +38,7 @@
 #include "core/io/marshalls.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/geometry_3d.h"
+#include "core/math/math_batch.h"
 #include "core/os/keyboard.h"
 #include "core/os/thread_safe.h"
 #include "core/variant/typed_array.h"
@@ -122,6 +123,24 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 	return ::ResourceLoader::get_resource_uid(p_path);
 }
 
+uint64_t ResourceLoader::get_keepalive_memory_usage() {
+	return ::ResourceLoader::get_keepalive_memory_usage();
+}
+
+Dictionary ResourceLoader::get_keepalive_memory_usage_by_type() {
+	HashMap<StringName, uint64_t> usage;
+	::ResourceLoader::get_keepalive_memory_usage_by_type(&usage);
+	Dictionary ret;
+	for (const KeyValue<StringName, uint64_t> &E : usage) {
+		ret[E.key] = E.value;
+	}
+	return ret;
+}
+
+void ResourceLoader::clear_keepalive_cache() {
+	::ResourceLoader::clear_keepalive_cache();
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -136,6 +155,9 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
+	ClassDB::bind_method(D_METHOD("get_keepalive_memory_usage"), &ResourceLoader::get_keepalive_memory_usage);
+	ClassDB::bind_method(D_METHOD("get_keepalive_memory_usage_by_type"), &ResourceLoader::get_keepalive_memory_usage_by_type);
+	ClassDB::bind_method(D_METHOD("clear_keepalive_cache"), &ResourceLoader::clear_keepalive_cache);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
@@ -145,6 +167,7 @@ void ResourceLoader::_bind_methods() {
 	BIND_ENUM_CONSTANT(CACHE_MODE_IGNORE);
 	BIND_ENUM_CONSTANT(CACHE_MODE_REUSE);
 	BIND_ENUM_CONSTANT(CACHE_MODE_REPLACE);
+	BIND_ENUM_CONSTANT(CACHE_MODE_KEEPALIVE);
 }
 
 ////// ResourceSaver //////
@@ -1044,6 +1067,17 @@ Vector<int32_t> Geometry3D::tetrahedralize_delaunay(const Vector<Vector3> &p_poi
 	return ::Geometry3D::tetrahedralize_delaunay(p_points);
 }
 
+AABB Geometry3D::get_points_aabb(const Vector<Vector3> &p_points) {
+	return MathBatch::compute_aabb(p_points.ptr(), p_points.size());
+}
+
+Vector<Vector3> Geometry3D::transform_vectors(const Basis &p_basis, const Vector<Vector3> &p_vectors) {
+	Vector<Vector3> ret;
+	ret.resize(p_vectors.size());
+	MathBatch::transform_vectors(p_basis, p_vectors.ptr(), ret.ptrw(), p_vectors.size());
+	return ret;
+}
+
 void Geometry3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compute_convex_mesh_points", "planes"), &Geometry3D::compute_convex_mesh_points);
 	ClassDB::bind_method(D_METHOD("build_box_planes", "extents"), &Geometry3D::build_box_planes);
@@ -1066,6 +1100,9 @@ void Geometry3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("clip_polygon", "points", "plane"), &Geometry3D::clip_polygon);
 	ClassDB::bind_method(D_METHOD("tetrahedralize_delaunay", "points"), &Geometry3D::tetrahedralize_delaunay);
+
+	ClassDB::bind_method(D_METHOD("get_points_aabb", "points"), &Geometry3D::get_points_aabb);
+	ClassDB::bind_method(D_METHOD("transform_vectors", "basis", "vectors"), &Geometry3D::transform_vectors);
 }
 
 ////// Marshalls //////
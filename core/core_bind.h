@@ -66,6 +66,7 @@ public:
 		CACHE_MODE_IGNORE, // Resource and subresources do not use path cache, no path is set into resource.
 		CACHE_MODE_REUSE, // Resource and subresources use patch cache, reuse existing loaded resources instead of loading from disk when available.
 		CACHE_MODE_REPLACE, // Resource and subresource use path cache, but replace existing loaded resources when available with information from disk.
+		CACHE_MODE_KEEPALIVE, // Like CACHE_MODE_REUSE, but the resource is kept in the budgeted keepalive cache when no longer referenced.
 	};
 
 	static ResourceLoader *get_singleton() { return singleton; }
@@ -84,6 +85,10 @@ public:
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
 
+	uint64_t get_keepalive_memory_usage();
+	Dictionary get_keepalive_memory_usage_by_type();
+	void clear_keepalive_cache();
+
 	ResourceLoader() { singleton = this; }
 };
 
@@ -339,6 +344,9 @@ public:
 	Vector<Vector3> clip_polygon(const Vector<Vector3> &p_points, const Plane &p_plane);
 	Vector<int32_t> tetrahedralize_delaunay(const Vector<Vector3> &p_points);
 
+	AABB get_points_aabb(const Vector<Vector3> &p_points);
+	Vector<Vector3> transform_vectors(const Basis &p_basis, const Vector<Vector3> &p_vectors);
+
 	Geometry3D() { singleton = this; }
 };
 
@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*  scope_profiler.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scope_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+namespace {
+
+struct TraceEvent {
+	const char *name = nullptr;
+	String gpu_name; // Only set for GPU events.
+	uint64_t begin = 0;
+	uint64_t end = 0;
+	Thread::ID thread = 0;
+	bool gpu = false;
+};
+
+// Enough for a few minutes of a heavily instrumented frame loop.
+const uint32_t MAX_TRACE_EVENTS = 1 << 21;
+
+BinaryMutex trace_mutex;
+LocalVector<TraceEvent> trace_events;
+String trace_path;
+bool trace_full = false;
+
+void _push_event(TraceEvent &&p_event) {
+	MutexLock lock(trace_mutex);
+	if (unlikely(trace_events.size() >= MAX_TRACE_EVENTS)) {
+		if (!trace_full) {
+			trace_full = true;
+			WARN_PRINT(vformat("Trace buffer is full (%d events), further scopes are not recorded.", MAX_TRACE_EVENTS));
+		}
+		return;
+	}
+	trace_events.push_back(std::move(p_event));
+}
+
+} // namespace
+
+SafeFlag ScopeProfiler::capturing;
+
+uint64_t ScopeProfiler::get_time_usec() {
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void ScopeProfiler::add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+	TraceEvent event;
+	event.name = p_name;
+	event.begin = p_begin_usec;
+	event.end = p_end_usec;
+	event.thread = Thread::get_caller_id();
+	_push_event(std::move(event));
+}
+
+void ScopeProfiler::add_gpu_event(const String &p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+	TraceEvent event;
+	event.gpu_name = p_name;
+	event.begin = p_begin_usec;
+	event.end = p_end_usec;
+	event.gpu = true;
+	_push_event(std::move(event));
+}
+
+void ScopeProfiler::begin_capture(const String &p_path) {
+	MutexLock lock(trace_mutex);
+	trace_path = p_path;
+	trace_events.clear();
+	trace_full = false;
+	capturing.set();
+}
+
+void ScopeProfiler::end_capture() {
+	if (!capturing.is_set()) {
+		return;
+	}
+	capturing.clear();
+
+	MutexLock lock(trace_mutex);
+
+	Ref<FileAccess> f = FileAccess::open(trace_path, FileAccess::WRITE);
+	if (f.is_null()) {
+		trace_events.clear();
+		ERR_FAIL_MSG(vformat("Can't open trace file for writing: \"%s\".", trace_path));
+	}
+
+	// Thread IDs are large and opaque, number them in order of appearance instead.
+	// The main thread is always 1, and GPU events go to their own track, 0.
+	HashMap<Thread::ID, int> thread_tracks;
+	thread_tracks.insert(Thread::get_main_id(), 1);
+
+	f->store_string("{\"traceEvents\":[\n");
+	f->store_string("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"GPU\"}},\n");
+	f->store_string("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"Main Thread\"}}");
+
+	for (const TraceEvent &event : trace_events) {
+		int track = 0;
+		if (!event.gpu) {
+			const int *existing = thread_tracks.getptr(event.thread);
+			if (existing) {
+				track = *existing;
+			} else {
+				track = thread_tracks.size() + 1;
+				thread_tracks.insert(event.thread, track);
+				f->store_string(vformat(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}", track, track - 1));
+			}
+		}
+
+		const String name = event.gpu ? event.gpu_name.json_escape() : String(event.name).json_escape();
+		f->store_string(vformat(",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d}", name, track, event.begin, event.end - event.begin));
+	}
+
+	f->store_string("\n]}\n");
+
+	print_line(vformat("Trace with %d events saved to \"%s\".", trace_events.size(), trace_path));
+	trace_events.clear();
+}
@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*  scope_profiler.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCOPE_PROFILER_H
+#define SCOPE_PROFILER_H
+
+#include "core/string/ustring.h"
+#include "core/templates/safe_refcount.h"
+
+// Records timed scopes from every thread on a single timeline, saved in the
+// Chrome trace event format (which Perfetto can open too). Run with
+// `--trace-file <path>` to capture from startup to exit.
+//
+// Use `PROFILE_SCOPE("Name")` for the enclosing block. The name must be a
+// string literal, as only the pointer is stored. Scopes are a single flag
+// check while not capturing, and compile to nothing in release builds.
+class ScopeProfiler {
+	static SafeFlag capturing;
+
+public:
+	struct Scope {
+		const char *name = nullptr;
+		uint64_t begin = 0;
+
+		_FORCE_INLINE_ Scope(const char *p_name) {
+			if (unlikely(capturing.is_set())) {
+				name = p_name;
+				begin = get_time_usec();
+			}
+		}
+
+		_FORCE_INLINE_ ~Scope() {
+			if (unlikely(name)) {
+				add_event(name, begin, get_time_usec());
+			}
+		}
+	};
+
+	_FORCE_INLINE_ static bool is_capturing() { return capturing.is_set(); }
+
+	static uint64_t get_time_usec();
+	static void add_event(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+	// For GPU timestamps, which are reported after the fact with dynamic names.
+	static void add_gpu_event(const String &p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+
+	static void begin_capture(const String &p_path);
+	static void end_capture();
+};
+
+#ifdef DEBUG_ENABLED
+#define _PROFILE_SCOPE_NAME_INNER(m_line) _profile_scope_##m_line
+#define _PROFILE_SCOPE_NAME(m_line) _PROFILE_SCOPE_NAME_INNER(m_line)
+#define PROFILE_SCOPE(m_name) ScopeProfiler::Scope _PROFILE_SCOPE_NAME(__LINE__)(m_name)
+#else
+#define PROFILE_SCOPE(m_name)
+#endif
+
+#endif // SCOPE_PROFILER_H
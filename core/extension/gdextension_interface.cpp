@@ -923,6 +923,18 @@ static int64_t gdextension_worker_thread_pool_add_native_task(GDExtensionObjectP
 	return (int64_t)p->add_native_task(p_func, p_userdata, static_cast<bool>(p_high_priority), *description);
 }
 
+static int64_t gdextension_worker_thread_pool_add_native_group_task_with_dependencies(GDExtensionObjectPtr p_instance, void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const int64_t *p_dependencies, uint32_t p_dependency_count, int p_tasks, GDExtensionBool p_high_priority, GDExtensionConstStringPtr p_description) {
+	WorkerThreadPool *p = (WorkerThreadPool *)p_instance;
+	const String *description = (const String *)p_description;
+	return (int64_t)p->add_native_group_task_with_dependencies(p_func, p_userdata, p_elements, p_dependencies, p_dependency_count, p_tasks, static_cast<bool>(p_high_priority), *description);
+}
+
+static int64_t gdextension_worker_thread_pool_add_native_task_with_dependencies(GDExtensionObjectPtr p_instance, void (*p_func)(void *), void *p_userdata, const int64_t *p_dependencies, uint32_t p_dependency_count, GDExtensionBool p_high_priority, GDExtensionConstStringPtr p_description) {
+	WorkerThreadPool *p = (WorkerThreadPool *)p_instance;
+	const String *description = (const String *)p_description;
+	return (int64_t)p->add_native_task_with_dependencies(p_func, p_userdata, p_dependencies, p_dependency_count, static_cast<bool>(p_high_priority), *description);
+}
+
 /* Packed array functions */
 
 static uint8_t *gdextension_packed_byte_array_operator_index(GDExtensionTypePtr p_self, GDExtensionInt p_index) {
@@ -1133,6 +1145,14 @@ static void gdextension_object_method_bind_ptrcall(GDExtensionMethodBindPtr p_me
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdextension_object_method_bind_ptrcall_batch(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *const *p_args, GDExtensionTypePtr *r_rets, GDExtensionInt p_count) {
+	const MethodBind *mb = reinterpret_cast<const MethodBind *>(p_method_bind);
+	ERR_FAIL_COND_MSG(!r_rets && mb->has_return(), "Return values must be provided when batching calls to a method that returns a value.");
+	for (GDExtensionInt i = 0; i < p_count; i++) {
+		mb->ptrcall((Object *)p_instances[i], (const void **)p_args[i], r_rets ? r_rets[i] : nullptr);
+	}
+}
+
 static void gdextension_object_destroy(GDExtensionObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1506,6 +1526,8 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(file_access_get_buffer);
 	REGISTER_INTERFACE_FUNC(worker_thread_pool_add_native_group_task);
 	REGISTER_INTERFACE_FUNC(worker_thread_pool_add_native_task);
+	REGISTER_INTERFACE_FUNC(worker_thread_pool_add_native_group_task_with_dependencies);
+	REGISTER_INTERFACE_FUNC(worker_thread_pool_add_native_task_with_dependencies);
 	REGISTER_INTERFACE_FUNC(packed_byte_array_operator_index);
 	REGISTER_INTERFACE_FUNC(packed_byte_array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(packed_color_array_operator_index);
@@ -1532,6 +1554,7 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(dictionary_operator_index_const);
 	REGISTER_INTERFACE_FUNC(object_method_bind_call);
 	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall);
+	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall_batch);
 	REGISTER_INTERFACE_FUNC(object_destroy);
 	REGISTER_INTERFACE_FUNC(global_get_singleton);
 	REGISTER_INTERFACE_FUNC(object_get_instance_binding);
@@ -1852,6 +1852,48 @@ typedef int64_t (*GDExtensionInterfaceWorkerThreadPoolAddNativeGroupTask)(GDExte
  */
 typedef int64_t (*GDExtensionInterfaceWorkerThreadPoolAddNativeTask)(GDExtensionObjectPtr p_instance, void (*p_func)(void *), void *p_userdata, GDExtensionBool p_high_priority, GDExtensionConstStringPtr p_description);
 
+/**
+ * @name worker_thread_pool_add_native_group_task_with_dependencies
+ * @since 4.3
+ *
+ * Adds a group task to an instance of WorkerThreadPool, which will only start once the given tasks or groups have completed.
+ *
+ * @param p_instance A pointer to a WorkerThreadPool object.
+ * @param p_func A pointer to a function to run in the thread pool.
+ * @param p_userdata A pointer to arbitrary data which will be passed to p_func.
+ * @param p_elements The number of elements to process.
+ * @param p_dependencies A pointer to an array of task or group IDs this group depends on.
+ * @param p_dependency_count The number of IDs in p_dependencies.
+ * @param p_tasks The number of tasks needed in the group.
+ * @param p_high_priority Whether or not this is a high priority task.
+ * @param p_description A pointer to a String with the task description.
+ *
+ * @return The task group ID.
+ *
+ * @see WorkerThreadPool::add_group_task_with_dependencies()
+ */
+typedef int64_t (*GDExtensionInterfaceWorkerThreadPoolAddNativeGroupTaskWithDependencies)(GDExtensionObjectPtr p_instance, void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const int64_t *p_dependencies, uint32_t p_dependency_count, int p_tasks, GDExtensionBool p_high_priority, GDExtensionConstStringPtr p_description);
+
+/**
+ * @name worker_thread_pool_add_native_task_with_dependencies
+ * @since 4.3
+ *
+ * Adds a task to an instance of WorkerThreadPool, which will only start once the given tasks or groups have completed.
+ *
+ * @param p_instance A pointer to a WorkerThreadPool object.
+ * @param p_func A pointer to a function to run in the thread pool.
+ * @param p_userdata A pointer to arbitrary data which will be passed to p_func.
+ * @param p_dependencies A pointer to an array of task or group IDs this task depends on.
+ * @param p_dependency_count The number of IDs in p_dependencies.
+ * @param p_high_priority Whether or not this is a high priority task.
+ * @param p_description A pointer to a String with the task description.
+ *
+ * @return The task ID.
+ *
+ * @see WorkerThreadPool::add_task_with_dependencies()
+ */
+typedef int64_t (*GDExtensionInterfaceWorkerThreadPoolAddNativeTaskWithDependencies)(GDExtensionObjectPtr p_instance, void (*p_func)(void *), void *p_userdata, const int64_t *p_dependencies, uint32_t p_dependency_count, GDExtensionBool p_high_priority, GDExtensionConstStringPtr p_description);
+
 /* INTERFACE: Packed Array */
 
 /**
@@ -2196,6 +2238,20 @@ typedef void (*GDExtensionInterfaceObjectMethodBindCall)(GDExtensionMethodBindPt
  */
 typedef void (*GDExtensionInterfaceObjectMethodBindPtrcall)(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_ret);
 
+/**
+ * @name object_method_bind_ptrcall_batch
+ * @since 4.3
+ *
+ * Calls the same method on several Objects (using a "ptrcall"), paying the cross-library call cost only once.
+ *
+ * @param p_method_bind A pointer to the MethodBind representing the method on the Objects' class.
+ * @param p_instances A pointer to a C array of Objects.
+ * @param p_args A pointer to a C array with one array of arguments per Object.
+ * @param r_rets A pointer to a C array with one pointer per Object that will receive the return value, or NULL if the method doesn't return a value.
+ * @param p_count The number of Objects.
+ */
+typedef void (*GDExtensionInterfaceObjectMethodBindPtrcallBatch)(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *const *p_args, GDExtensionTypePtr *r_rets, GDExtensionInt p_count);
+
 /**
  * @name object_destroy
  * @since 4.1
@@ -40,10 +40,16 @@ GDExtensionManager::LoadStatus GDExtensionManager::_load_extension_internal(cons
 		if (minimum_level < MIN(level, GDExtension::INITIALIZATION_LEVEL_SCENE)) {
 			return LOAD_STATUS_NEEDS_RESTART;
 		}
+		// Classes get registered while initializing, so lookups go through the locked registry meanwhile.
+		bool was_frozen = ClassDB::is_registry_frozen();
+		ClassDB::unfreeze_registry();
 		// Initialize up to current level.
 		for (int32_t i = minimum_level; i <= level; i++) {
 			p_extension->initialize_library(GDExtension::InitializationLevel(i));
 		}
+		if (was_frozen) {
+			ClassDB::freeze_registry();
+		}
 	}
 
 	for (const KeyValue<String, String> &kv : p_extension->class_icon_paths) {
@@ -55,10 +61,15 @@ GDExtensionManager::LoadStatus GDExtensionManager::_load_extension_internal(cons
 
 GDExtensionManager::LoadStatus GDExtensionManager::_unload_extension_internal(const Ref<GDExtension> &p_extension) {
 	if (level >= 0) { // Already initialized up to some level.
+		bool was_frozen = ClassDB::is_registry_frozen();
+		ClassDB::unfreeze_registry();
 		// Deinitialize down from current level.
 		for (int32_t i = level; i >= GDExtension::INITIALIZATION_LEVEL_CORE; i--) {
 			p_extension->deinitialize_library(GDExtension::InitializationLevel(i));
 		}
+		if (was_frozen) {
+			ClassDB::freeze_registry();
+		}
 	}
 
 	for (const KeyValue<String, String> &kv : p_extension->class_icon_paths) {
@@ -90,9 +90,16 @@ int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size,
 				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
 				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
 			}
+			if (zstd_workers > 0 && p_src_size >= (1 << 20)) {
+				// Smaller inputs fit in a single zstd job, not worth spinning up its thread pool.
+				// Silently ignored when zstd is built without ZSTD_MULTITHREAD.
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, zstd_workers);
+			}
 			int max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
-			int ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
+			// ZSTD_compress2 (unlike ZSTD_compressCCtx) honors the parameters set above.
+			size_t ret = ZSTD_compress2(cctx, p_dst, max_dst_size, p_src, p_src_size);
 			ZSTD_freeCCtx(cctx);
+			ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), -1, ZSTD_getErrorName(ret));
 			return ret;
 		} break;
 	}
@@ -201,7 +208,7 @@ int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p
 }
 
 /**
-	This will handle both Gzip and Deflate streams. It will automatically allocate the output buffer into the provided p_dst_vect Vector.
+	This will handle Gzip, Deflate, Zstd and Brotli streams. It will automatically allocate the output buffer into the provided p_dst_vect Vector.
 	This is required for compressed data whose final uncompressed size is unknown, as is the case for HTTP response bodies.
 	This is much slower however than using Compression::decompress because it may result in multiple full copies of the output buffer.
 */
@@ -269,6 +276,35 @@ int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_s
 #else
 		ERR_FAIL_V_MSG(Z_ERRNO, "Godot was compiled without brotli support.");
 #endif
+	} else if (p_mode == MODE_ZSTD) {
+		// Zstd frames don't always store their decompressed size, so go through the streaming decoder.
+		CompressionStream stream;
+		ERR_FAIL_COND_V(stream.start_decompression(MODE_ZSTD) != OK, Z_ERRNO);
+
+		LocalVector<uint8_t> out;
+		int ofs = 0;
+		while (ofs < p_src_size) {
+			int step = MIN(gzip_chunk, p_src_size - ofs);
+			if (stream.process(p_src + ofs, step, out) != OK) {
+				p_dst_vect->clear();
+				return Z_DATA_ERROR;
+			}
+			ofs += step;
+
+			// Enforce max output size.
+			if (p_max_dst_size > -1 && out.size() > (uint32_t)p_max_dst_size) {
+				p_dst_vect->clear();
+				return Z_BUF_ERROR;
+			}
+		}
+		if (stream.finish(out) != OK) {
+			p_dst_vect->clear();
+			return Z_DATA_ERROR;
+		}
+
+		p_dst_vect->resize(out.size());
+		memcpy(p_dst_vect->ptrw(), out.ptr(), out.size());
+		return Z_OK;
 	} else {
 		// This function only supports GZip and Deflate.
 		ERR_FAIL_COND_V(p_mode != MODE_DEFLATE && p_mode != MODE_GZIP, Z_ERRNO);
@@ -354,4 +390,258 @@ int Compression::gzip_level = Z_DEFAULT_COMPRESSION;
 int Compression::zstd_level = 3;
 bool Compression::zstd_long_distance_matching = false;
 int Compression::zstd_window_log_size = 27; // ZSTD_WINDOWLOG_LIMIT_DEFAULT
+int Compression::zstd_workers = 0;
 int Compression::gzip_chunk = 16384;
+
+Error CompressionStream::start_compression(Compression::Mode p_mode, int p_workers) {
+	clear();
+
+	switch (p_mode) {
+		case Compression::MODE_BROTLI: {
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Only brotli decompression is supported.");
+		} break;
+		case Compression::MODE_FASTLZ: {
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "FastLZ can't be used as a stream, only on complete buffers.");
+		} break;
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			int window_bits = p_mode == Compression::MODE_DEFLATE ? 15 : 15 + 16;
+			int level = p_mode == Compression::MODE_DEFLATE ? Compression::zlib_level : Compression::gzip_level;
+
+			z_stream *strm = memnew(z_stream);
+			strm->zalloc = zipio_alloc;
+			strm->zfree = zipio_free;
+			strm->opaque = Z_NULL;
+			int err = deflateInit2(strm, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+			if (err != Z_OK) {
+				memdelete(strm);
+				ERR_FAIL_V(ERR_CANT_CREATE);
+			}
+			ctx = strm;
+		} break;
+		case Compression::MODE_ZSTD: {
+			ZSTD_CCtx *cctx = ZSTD_createCCtx();
+			ERR_FAIL_NULL_V(cctx, ERR_CANT_CREATE);
+			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, Compression::zstd_level);
+			if (Compression::zstd_long_distance_matching) {
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, Compression::zstd_window_log_size);
+			}
+			int workers = p_workers < 0 ? Compression::zstd_workers : p_workers;
+			if (workers > 0) {
+				// Silently ignored when zstd is built without ZSTD_MULTITHREAD.
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, workers);
+			}
+			ctx = cctx;
+		} break;
+	}
+
+	mode = p_mode;
+	compressing = true;
+	return OK;
+}
+
+Error CompressionStream::start_decompression(Compression::Mode p_mode) {
+	clear();
+
+	switch (p_mode) {
+		case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+			BrotliDecoderState *state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+			ERR_FAIL_NULL_V(state, ERR_CANT_CREATE);
+			ctx = state;
+#else
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Godot was compiled without brotli support.");
+#endif
+		} break;
+		case Compression::MODE_FASTLZ: {
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "FastLZ can't be used as a stream, only on complete buffers.");
+		} break;
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			int window_bits = p_mode == Compression::MODE_DEFLATE ? 15 : 15 + 16;
+
+			z_stream *strm = memnew(z_stream);
+			strm->zalloc = zipio_alloc;
+			strm->zfree = zipio_free;
+			strm->opaque = Z_NULL;
+			strm->avail_in = 0;
+			strm->next_in = Z_NULL;
+			int err = inflateInit2(strm, window_bits);
+			if (err != Z_OK) {
+				memdelete(strm);
+				ERR_FAIL_V(ERR_CANT_CREATE);
+			}
+			ctx = strm;
+		} break;
+		case Compression::MODE_ZSTD: {
+			ZSTD_DCtx *dctx = ZSTD_createDCtx();
+			ERR_FAIL_NULL_V(dctx, ERR_CANT_CREATE);
+			if (Compression::zstd_long_distance_matching) {
+				ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, Compression::zstd_window_log_size);
+			}
+			ctx = dctx;
+		} break;
+	}
+
+	mode = p_mode;
+	compressing = false;
+	return OK;
+}
+
+Error CompressionStream::_process(const uint8_t *p_src, int p_src_size, LocalVector<uint8_t> &r_out, bool p_finish) {
+	const uint32_t chunk = Compression::gzip_chunk;
+
+	switch (mode) {
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			z_stream *strm = (z_stream *)ctx;
+			strm->next_in = (Bytef *)p_src;
+			strm->avail_in = p_src_size;
+
+			while (true) {
+				uint32_t base = r_out.size();
+				r_out.resize(base + chunk);
+				strm->next_out = r_out.ptr() + base;
+				strm->avail_out = chunk;
+
+				int err = compressing ? deflate(strm, p_finish ? Z_FINISH : Z_NO_FLUSH) : inflate(strm, Z_NO_FLUSH);
+				bool out_full = strm->avail_out == 0;
+				r_out.resize(base + chunk - strm->avail_out);
+
+				if (err == Z_STREAM_END) {
+					stream_end = true;
+					break;
+				}
+				if (err == Z_BUF_ERROR) {
+					// No progress possible, (de)compressor needs more input.
+					break;
+				}
+				if (err != Z_OK) {
+					ERR_FAIL_V_MSG(ERR_INVALID_DATA, strm->msg ? String(strm->msg) : String("zlib stream error."));
+				}
+				if (!out_full && strm->avail_in == 0 && !(compressing && p_finish)) {
+					break;
+				}
+			}
+		} break;
+		case Compression::MODE_ZSTD: {
+			ZSTD_inBuffer in = { p_src, (size_t)p_src_size, 0 };
+
+			while (true) {
+				uint32_t base = r_out.size();
+				r_out.resize(base + chunk);
+				ZSTD_outBuffer out = { r_out.ptr() + base, chunk, 0 };
+
+				size_t ret;
+				if (compressing) {
+					ret = ZSTD_compressStream2((ZSTD_CCtx *)ctx, &out, &in, p_finish ? ZSTD_e_end : ZSTD_e_continue);
+				} else {
+					ret = ZSTD_decompressStream((ZSTD_DCtx *)ctx, &out, &in);
+				}
+				bool out_full = out.pos == out.size;
+				r_out.resize(base + out.pos);
+				ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), ERR_INVALID_DATA, ZSTD_getErrorName(ret));
+
+				if (compressing && p_finish) {
+					// Returns the amount of data still to be flushed.
+					if (ret == 0) {
+						stream_end = true;
+						break;
+					}
+					continue;
+				}
+				if (!compressing) {
+					// Zero means a whole frame was decoded, another one may follow.
+					stream_end = ret == 0;
+				}
+				if (!out_full && in.pos == in.size) {
+					break;
+				}
+			}
+		} break;
+		case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+			BrotliDecoderState *state = (BrotliDecoderState *)ctx;
+			const uint8_t *next_in = p_src;
+			size_t avail_in = p_src_size;
+
+			while (true) {
+				uint32_t base = r_out.size();
+				r_out.resize(base + chunk);
+				uint8_t *next_out = r_out.ptr() + base;
+				size_t avail_out = chunk;
+
+				BrotliDecoderResult res = BrotliDecoderDecompressStream(state, &avail_in, &next_in, &avail_out, &next_out, nullptr);
+				r_out.resize(base + chunk - avail_out);
+
+				ERR_FAIL_COND_V_MSG(res == BROTLI_DECODER_RESULT_ERROR, ERR_INVALID_DATA, BrotliDecoderErrorString(BrotliDecoderGetErrorCode(state)));
+				if (res == BROTLI_DECODER_RESULT_SUCCESS) {
+					stream_end = true;
+					break;
+				}
+				if (res == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) {
+					break;
+				}
+			}
+#endif
+		} break;
+		case Compression::MODE_FASTLZ: {
+			ERR_FAIL_V(ERR_BUG);
+		} break;
+	}
+
+	return OK;
+}
+
+Error CompressionStream::process(const uint8_t *p_src, int p_src_size, LocalVector<uint8_t> &r_out) {
+	ERR_FAIL_NULL_V_MSG(ctx, ERR_UNCONFIGURED, "Compression stream was not started.");
+	ERR_FAIL_COND_V(p_src_size < 0, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(compressing && stream_end, ERR_ALREADY_IN_USE, "Compression stream was already finished.");
+	return _process(p_src, p_src_size, r_out, false);
+}
+
+Error CompressionStream::finish(LocalVector<uint8_t> &r_out) {
+	ERR_FAIL_NULL_V_MSG(ctx, ERR_UNCONFIGURED, "Compression stream was not started.");
+	if (!compressing) {
+		ERR_FAIL_COND_V_MSG(!stream_end, ERR_FILE_CORRUPT, "Compressed stream ended before its end marker.");
+		return OK;
+	}
+	if (stream_end) {
+		return OK;
+	}
+	return _process(nullptr, 0, r_out, true);
+}
+
+void CompressionStream::clear() {
+	if (ctx) {
+		switch (mode) {
+			case Compression::MODE_DEFLATE:
+			case Compression::MODE_GZIP: {
+				z_stream *strm = (z_stream *)ctx;
+				if (compressing) {
+					deflateEnd(strm);
+				} else {
+					inflateEnd(strm);
+				}
+				memdelete(strm);
+			} break;
+			case Compression::MODE_ZSTD: {
+				if (compressing) {
+					ZSTD_freeCCtx((ZSTD_CCtx *)ctx);
+				} else {
+					ZSTD_freeDCtx((ZSTD_DCtx *)ctx);
+				}
+			} break;
+			case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+				BrotliDecoderDestroyInstance((BrotliDecoderState *)ctx);
+#endif
+			} break;
+			case Compression::MODE_FASTLZ: {
+			} break;
+		}
+		ctx = nullptr;
+	}
+	stream_end = false;
+}
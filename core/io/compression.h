@@ -31,6 +31,8 @@
 #ifndef COMPRESSION_H
 #define COMPRESSION_H
 
+#include "core/error/error_list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 #include "core/typedefs.h"
 
@@ -41,6 +43,7 @@ public:
 	static int zstd_level;
 	static bool zstd_long_distance_matching;
 	static int zstd_window_log_size;
+	static int zstd_workers;
 	static int gzip_chunk;
 
 	enum Mode {
@@ -57,4 +60,31 @@ public:
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int p_max_dst_size, const uint8_t *p_src, int p_src_size, Mode p_mode);
 };
 
+// Incremental (de)compressor, for data that doesn't fit in memory or arrives in pieces.
+// Output is appended to the vector passed to process() and finish().
+class CompressionStream {
+	Compression::Mode mode = Compression::MODE_ZSTD;
+	bool compressing = true;
+	bool stream_end = false;
+	void *ctx = nullptr;
+
+	Error _process(const uint8_t *p_src, int p_src_size, LocalVector<uint8_t> &r_out, bool p_finish);
+
+public:
+	// Brotli can only be decompressed, and FastLZ has no stream format.
+	// p_workers only affects zstd, -1 uses Compression::zstd_workers.
+	Error start_compression(Compression::Mode p_mode, int p_workers = -1);
+	Error start_decompression(Compression::Mode p_mode);
+
+	Error process(const uint8_t *p_src, int p_src_size, LocalVector<uint8_t> &r_out);
+	Error finish(LocalVector<uint8_t> &r_out);
+
+	bool is_started() const { return ctx != nullptr; }
+	bool is_stream_end() const { return stream_end; }
+	void clear();
+
+	CompressionStream() {}
+	~CompressionStream() { clear(); }
+};
+
 #endif // COMPRESSION_H
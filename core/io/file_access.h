@@ -88,6 +88,7 @@ public:
 	typedef Ref<FileAccess> (*CreateFunc)();
 	bool big_endian = false;
 	bool real_is_double = false;
+	bool compact_var_encoding = false;
 
 	virtual BitField<UnixPermissionFlags> _get_unix_permissions(const String &p_file) = 0;
 	virtual Error _set_unix_permissions(const String &p_file, BitField<UnixPermissionFlags> p_permissions) = 0;
@@ -136,6 +137,8 @@ public:
 
 	virtual bool eof_reached() const = 0; ///< reading passed EOF
 
+	virtual const uint8_t *get_mapped_buffer() const { return nullptr; } ///< whole file mapped in memory (get_length() bytes, valid while open), or nullptr if unavailable
+
 	virtual uint8_t get_8() const = 0; ///< get a byte
 	virtual uint16_t get_16() const; ///< get 16 bits uint
 	virtual uint32_t get_32() const; ///< get 32 bits uint
@@ -163,6 +166,10 @@ public:
 	virtual void set_big_endian(bool p_big_endian) { big_endian = p_big_endian; }
 	inline bool is_big_endian() const { return big_endian; }
 
+	// Makes store_var() use the compact Variant encoding. get_var() reads both encodings.
+	void set_compact_var_encoding(bool p_enabled) { compact_var_encoding = p_enabled; }
+	bool is_compact_var_encoding() const { return compact_var_encoding; }
+
 	virtual Error get_error() const = 0; ///< get last error
 
 	virtual void flush() = 0;
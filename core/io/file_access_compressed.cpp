@@ -30,7 +30,10 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
+#include "core/templates/safe_refcount.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
@@ -52,6 +55,69 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 		}                                                   \
 	}
 
+Vector<uint8_t> FileAccessCompressed::compress_blocks(const uint8_t *p_data, uint64_t p_size, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(p_size > UINT32_MAX, Vector<uint8_t>(), "Can't compress more than 4 GiB into a single block container.");
+
+	CharString mgc = (p_magic + "    ").substr(0, 4).ascii();
+	uint32_t bc = (p_size / p_block_size) + 1;
+	uint64_t header_size = 16 + bc * 4;
+
+	Vector<uint8_t> ret;
+	ret.resize(header_size);
+	uint8_t *w = ret.ptrw();
+	memcpy(w, mgc.get_data(), 4); //write header 4
+	encode_uint32(p_mode, &w[4]); //write compression mode 4
+	encode_uint32(p_block_size, &w[8]); //write block size 4
+	encode_uint32(p_size, &w[12]); //amount of data 4
+
+	// Blocks are independent, so they are compressed in parallel and appended in order afterwards.
+	LocalVector<Vector<uint8_t>> cblocks;
+	cblocks.resize(bc);
+	SafeFlag failed;
+	const int max_csize = Compression::get_max_compressed_buffer_size(p_block_size, p_mode);
+	auto compress_range = [&](uint32_t p_begin, uint32_t p_end) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			uint32_t bl = i == (bc - 1) ? p_size % p_block_size : p_block_size;
+			Vector<uint8_t> &cblock = cblocks[i];
+			cblock.resize(max_csize);
+			int s = Compression::compress(cblock.ptrw(), &p_data[(uint64_t)i * p_block_size], bl, p_mode);
+			if (s < 0) {
+				failed.set();
+				cblock.clear();
+			} else {
+				cblock.resize(s);
+			}
+		}
+	};
+
+	const uint32_t parallel_min_blocks = 16;
+	if (bc >= parallel_min_blocks && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::get_singleton()->parallel_for_range(0, bc, parallel_min_blocks / 4, compress_range, SNAME("FileAccessCompressedCompress"));
+	} else {
+		compress_range(0, bc);
+	}
+	ERR_FAIL_COND_V(failed.is_set(), Vector<uint8_t>());
+
+	uint64_t total = header_size;
+	for (uint32_t i = 0; i < bc; i++) {
+		encode_uint32(cblocks[i].size(), w + 16 + i * 4); //block size table
+		total += cblocks[i].size();
+	}
+	ret.resize(total);
+	uint64_t block_ofs = header_size;
+	for (uint32_t i = 0; i < bc; i++) {
+		memcpy(ret.ptrw() + block_ofs, cblocks[i].ptr(), cblocks[i].size());
+		block_ofs += cblocks[i].size();
+	}
+
+	uint64_t ofs = ret.size();
+	ret.resize(ofs + 4);
+	memcpy(ret.ptrw() + ofs, mgc.get_data(), 4); //magic at the end too
+
+	return ret;
+}
+
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
 	cmode = (Compression::Mode)f->get_32();
@@ -132,37 +198,8 @@ void FileAccessCompressed::_close() {
 
 	if (writing) {
 		//save block table and all compressed blocks
-
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(write_max); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
-
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+		Vector<uint8_t> data = compress_blocks(write_ptr, write_max, magic, cmode, block_size);
+		f->store_buffer(data.ptr(), data.size());
 
 		buffer.clear();
 
@@ -302,32 +339,76 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
+	uint64_t dst_pos = 0;
+	while (true) {
+		uint64_t to_copy = MIN((uint64_t)read_block_size - read_pos, p_length - dst_pos);
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, to_copy);
+		read_pos += to_copy;
+		dst_pos += to_copy;
+		if (read_pos < read_block_size) {
+			return p_length;
+		}
 
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
+		if (read_block + 1 >= read_block_count) {
+			at_end = true;
+			if (dst_pos < p_length) {
+				read_eof = true;
+			}
+			return dst_pos;
+		}
 
-			} else {
-				read_block--;
-				at_end = true;
-				if (i + 1 < p_length) {
-					read_eof = true;
-				}
-				return i + 1;
+		// Whole blocks covered by the rest of the request skip the block buffer and are decompressed straight into the destination.
+		// The last block is always loaded into the buffer, since it is the only one with a different size.
+		uint32_t next_block = read_block + 1;
+		uint32_t direct_blocks = MIN((p_length - dst_pos) / block_size, (uint64_t)(read_block_count - 1 - next_block));
+		if (direct_blocks > 0) {
+			ERR_FAIL_COND_V_MSG(!_decompress_blocks(next_block, direct_blocks, p_dst + dst_pos), -1, "Compressed file is corrupt.");
+			dst_pos += (uint64_t)direct_blocks * block_size;
+			next_block += direct_blocks;
+		}
+
+		//read another block of compressed data
+		read_block = next_block;
+		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
+		int ret = Compression::decompress(buffer.ptrw(), block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
+		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
+		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		read_pos = 0;
+	}
+}
+
+bool FileAccessCompressed::_decompress_blocks(uint32_t p_from, uint32_t p_count, uint8_t *p_dst) const {
+	// Blocks are stored back to back, so the whole run can be read in one go.
+	const ReadBlock &last = read_blocks[p_from + p_count - 1];
+	uint64_t csize = last.offset + last.csize - read_blocks[p_from].offset;
+	Vector<uint8_t> cdata;
+	cdata.resize(csize);
+	if (f->get_buffer(cdata.ptrw(), csize) != csize) {
+		return false;
+	}
+
+	const uint8_t *src = cdata.ptr();
+	const uint64_t base_ofs = read_blocks[p_from].offset;
+	SafeFlag corrupt;
+	auto decompress_range = [&](uint32_t p_begin, uint32_t p_end) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			const ReadBlock &rb = read_blocks[p_from + i];
+			int ret = Compression::decompress(p_dst + (uint64_t)i * block_size, block_size, src + (rb.offset - base_ofs), rb.csize, cmode);
+			if (ret < 0) {
+				corrupt.set();
 			}
 		}
+	};
+
+	// Large runs are spread over the worker threads; small ones are not worth the dispatch.
+	const uint32_t parallel_min_blocks = 16;
+	if (p_count >= parallel_min_blocks && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::get_singleton()->parallel_for_range(0, p_count, parallel_min_blocks / 4, decompress_range, SNAME("FileAccessCompressedDecompress"));
+	} else {
+		decompress_range(0, p_count);
 	}
 
-	return p_length;
+	return !corrupt.is_set();
 }
 
 Error FileAccessCompressed::get_error() const {
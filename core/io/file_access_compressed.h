@@ -64,8 +64,12 @@ class FileAccessCompressed : public FileAccess {
 	Ref<FileAccess> f;
 
 	void _close();
+	bool _decompress_blocks(uint32_t p_from, uint32_t p_count, uint8_t *p_dst) const;
 
 public:
+	// Builds the same block-indexed container as writing through this class, for data that is already in memory.
+	static Vector<uint8_t> compress_blocks(const uint8_t *p_data, uint64_t p_size, const String &p_magic = "GCMP", Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
@@ -30,6 +30,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -47,7 +48,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +56,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -248,7 +250,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
@@ -282,7 +284,10 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!data) {
+		// Compressed entries can't seek past their end, but reads stop at pf.size anyway.
+		f->seek(off + (pf.compressed ? MIN(p_position, pf.size) : p_position));
+	}
 	pos = p_position;
 }
 
@@ -302,6 +307,10 @@ bool FileAccessPack::eof_reached() const {
 	return eof;
 }
 
+const uint8_t *FileAccessPack::get_mapped_buffer() const {
+	return data;
+}
+
 uint8_t FileAccessPack::get_8() const {
 	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
 	if (pos >= pf.size) {
@@ -309,6 +318,9 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (data) {
+		return data[pos++];
+	}
 	pos++;
 	return f->get_8();
 }
@@ -332,6 +344,10 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	if (to_read <= 0) {
 		return 0;
 	}
+	if (data) {
+		memcpy(p_dst, data + pos - to_read, to_read);
+		return to_read;
+	}
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
@@ -395,6 +411,29 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		// Blocks are decompressed on demand, so seeking only costs the block it lands in.
+		char cmagic[5] = {};
+		f->get_buffer((uint8_t *)cmagic, 4);
+		ERR_FAIL_COND_MSG(String(cmagic) != PACK_FILE_COMPRESSED_MAGIC, "Can't open compressed pack-referenced file '" + String(pf.pack) + "', the block container is corrupt.");
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(f);
+		ERR_FAIL_COND_MSG(err, "Can't open compressed pack-referenced file '" + String(pf.pack) + "'.");
+		ERR_FAIL_COND_MSG(fac->get_length() != pf.size, "Can't open compressed pack-referenced file '" + String(pf.pack) + "', its size doesn't match the pack directory.");
+		f = fac;
+		off = 0;
+	}
+
+	if (!pf.encrypted && !pf.compressed) {
+		// Read straight from memory when the pack can be mapped, instead of seeking and reading through the file.
+		const uint8_t *mapped_pack = f->get_mapped_buffer();
+		if (mapped_pack && pf.offset + pf.size <= f->get_length()) {
+			data = mapped_pack + pf.offset;
+		}
+	}
 	pos = 0;
 	eof = false;
 }
@@ -0,0 +1,248 @@
+/**************************************************************************/
+/*  file_read_queue.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_read_queue.h"
+
+#include "core/io/file_access.h"
+#include "core/templates/sort_array.h"
+
+FileReadQueue *FileReadQueue::singleton = nullptr;
+
+FileReadQueue::RequestID FileReadQueue::_queue(const String &p_path, uint64_t p_offset, int64_t p_length, bool p_prefetch, PathResolver p_resolver) {
+	Request *request = memnew(Request);
+	request->path = p_path;
+	request->offset = p_offset;
+	request->length = p_length;
+	request->prefetch = p_prefetch;
+	request->resolver = p_resolver;
+
+	RequestID id;
+	bool read_now = true;
+	{
+		MutexLock lock(mutex);
+		id = ++last_id;
+		request->id = id;
+		if (!p_prefetch) {
+			requests.insert(id, request);
+		}
+#ifdef THREADS_ENABLED
+		// Read right away once the threads are gone.
+		read_now = exit_threads;
+		if (!read_now) {
+			pending.push_back(request);
+
+			// Threads are only started once something is read through the queue.
+			if (threads.is_empty()) {
+				threads.resize(THREAD_COUNT);
+				for (Thread &thread : threads) {
+					thread.start(&FileReadQueue::_thread_function, this);
+				}
+			}
+		}
+#endif
+	}
+
+	if (read_now) {
+		LocalVector<Request *> batch;
+		batch.push_back(request);
+		_process_batch(batch);
+	} else {
+		pending_semaphore.post();
+	}
+	return id;
+}
+
+void FileReadQueue::_take_batch(LocalVector<Request *> &r_batch) {
+	// Take every pending request for the same file as the oldest one.
+	// Requests with a resolver may read another file, so they go alone.
+	MutexLock lock(mutex);
+	if (pending.is_empty()) {
+		return;
+	}
+	const String path = pending[0]->path;
+	const bool resolved = pending[0]->resolver != nullptr;
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < pending.size(); i++) {
+		bool take = resolved ? i == 0 : (pending[i]->resolver == nullptr && pending[i]->path == path);
+		if (take) {
+			r_batch.push_back(pending[i]);
+		} else {
+			pending[kept++] = pending[i];
+		}
+	}
+	pending.resize(kept);
+}
+
+void FileReadQueue::_process_batch(LocalVector<Request *> &p_batch) {
+	struct RequestOffsetSort {
+		_FORCE_INLINE_ bool operator()(const Request *p_a, const Request *p_b) const { return p_a->offset < p_b->offset; }
+	};
+	SortArray<Request *, RequestOffsetSort> sorter;
+	sorter.sort(p_batch.ptr(), p_batch.size());
+
+	String path = p_batch[0]->resolver ? p_batch[0]->resolver(p_batch[0]->path) : p_batch[0]->path;
+	Error open_error = OK;
+	Ref<FileAccess> f = path.is_empty() ? Ref<FileAccess>() : FileAccess::open(path, FileAccess::READ, &open_error);
+	uint64_t file_length = f.is_valid() ? f->get_length() : 0;
+
+	Vector<uint8_t> chunk;
+	for (Request *request : p_batch) {
+		if (f.is_null()) {
+			request->error = open_error != OK ? open_error : ERR_FILE_CANT_OPEN;
+		} else if (request->offset > file_length) {
+			request->error = ERR_FILE_EOF;
+		} else {
+			uint64_t available = file_length - request->offset;
+			uint64_t length = request->length < 0 ? available : MIN((uint64_t)request->length, available);
+			f->seek(request->offset);
+			if (request->prefetch) {
+				chunk.resize(MIN(length, PREFETCH_CHUNK_SIZE));
+				while (length > 0) {
+					uint64_t read = f->get_buffer(chunk.ptrw(), MIN(length, PREFETCH_CHUNK_SIZE));
+					if (read == 0) {
+						break;
+					}
+					length -= read;
+				}
+			} else {
+				request->data.resize(length);
+				uint64_t read = f->get_buffer(request->data.ptrw(), length);
+				if (read < length) {
+					request->data.resize(read);
+					request->error = ERR_FILE_EOF;
+				}
+			}
+		}
+	}
+
+	MutexLock lock(mutex);
+	for (Request *request : p_batch) {
+		if (request->prefetch) {
+			memdelete(request);
+		} else {
+			request->completed = true;
+		}
+	}
+	completed_condition.notify_all();
+}
+
+void FileReadQueue::_thread_function(void *p_user) {
+	FileReadQueue *queue = (FileReadQueue *)p_user;
+	LocalVector<Request *> batch;
+	while (true) {
+		queue->pending_semaphore.wait();
+		{
+			MutexLock lock(queue->mutex);
+			if (queue->exit_threads) {
+				return;
+			}
+		}
+		batch.clear();
+		queue->_take_batch(batch);
+		if (!batch.is_empty()) {
+			queue->_process_batch(batch);
+		}
+	}
+}
+
+FileReadQueue::RequestID FileReadQueue::request_read(const String &p_path, uint64_t p_offset, int64_t p_length) {
+	return _queue(p_path, p_offset, p_length, false);
+}
+
+void FileReadQueue::prefetch(const String &p_path, PathResolver p_resolver) {
+	_queue(p_path, 0, -1, true, p_resolver);
+}
+
+bool FileReadQueue::is_completed(RequestID p_id) const {
+	MutexLock lock(mutex);
+	HashMap<RequestID, Request *>::ConstIterator E = requests.find(p_id);
+	ERR_FAIL_COND_V_MSG(!E, false, "Invalid file read request ID.");
+	return E->value->completed;
+}
+
+Error FileReadQueue::wait_for_completion(RequestID p_id, Vector<uint8_t> *r_data) {
+	Request *request = nullptr;
+	{
+		MutexLock lock(mutex);
+		HashMap<RequestID, Request *>::Iterator E = requests.find(p_id);
+		ERR_FAIL_COND_V_MSG(!E, ERR_INVALID_PARAMETER, "Invalid file read request ID.");
+		request = E->value;
+		while (!request->completed) {
+			completed_condition.wait(lock);
+		}
+		requests.remove(E);
+	}
+
+	Error error = request->error;
+	if (r_data) {
+		*r_data = request->data;
+	}
+	memdelete(request);
+	return error;
+}
+
+void FileReadQueue::finish() {
+	{
+		MutexLock lock(mutex);
+		if (exit_threads) {
+			return;
+		}
+		exit_threads = true;
+	}
+	pending_semaphore.post(threads.size());
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+	threads.clear();
+
+	// Complete what's left, so nobody waits forever.
+	LocalVector<Request *> batch;
+	while (true) {
+		batch.clear();
+		_take_batch(batch);
+		if (batch.is_empty()) {
+			break;
+		}
+		_process_batch(batch);
+	}
+}
+
+FileReadQueue::FileReadQueue() {
+	singleton = this;
+}
+
+FileReadQueue::~FileReadQueue() {
+	finish();
+
+	for (KeyValue<RequestID, Request *> &E : requests) {
+		memdelete(E.value);
+	}
+	singleton = nullptr;
+}
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  file_read_queue.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_READ_QUEUE_H
+#define FILE_READ_QUEUE_H
+
+#include "core/os/condition_variable.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+
+// Reads files on dedicated I/O threads, so many reads can be in flight without
+// parking WorkerThreadPool threads on blocking I/O. Queued reads of the same file
+// are batched to share a single open, in offset order.
+class FileReadQueue {
+public:
+	typedef int64_t RequestID;
+	static constexpr RequestID INVALID_REQUEST_ID = -1;
+	typedef String (*PathResolver)(const String &p_path);
+
+private:
+	static constexpr int THREAD_COUNT = 2;
+	static constexpr uint64_t PREFETCH_CHUNK_SIZE = 256 * 1024;
+
+	struct Request {
+		RequestID id = INVALID_REQUEST_ID;
+		String path;
+		uint64_t offset = 0;
+		int64_t length = -1; // Up to the end of the file.
+		bool prefetch = false; // Data is read only to warm the OS cache, nobody waits for it.
+		PathResolver resolver = nullptr; // Called on the I/O thread to find the file to read.
+		Vector<uint8_t> data;
+		Error error = OK;
+		bool completed = false;
+	};
+
+	static FileReadQueue *singleton;
+
+	BinaryMutex mutex;
+	ConditionVariable completed_condition;
+	Semaphore pending_semaphore;
+
+	HashMap<RequestID, Request *> requests;
+	LocalVector<Request *> pending;
+	RequestID last_id = INVALID_REQUEST_ID;
+
+	LocalVector<Thread> threads;
+	bool exit_threads = false;
+
+	RequestID _queue(const String &p_path, uint64_t p_offset, int64_t p_length, bool p_prefetch, PathResolver p_resolver = nullptr);
+	void _take_batch(LocalVector<Request *> &r_batch);
+	void _process_batch(LocalVector<Request *> &p_batch);
+	static void _thread_function(void *p_user);
+
+public:
+	// Queues reading `p_length` bytes from `p_offset`, or up to the end of the file when `p_length` is negative.
+	RequestID request_read(const String &p_path, uint64_t p_offset = 0, int64_t p_length = -1);
+	// Queues reading a whole file so a later load finds it in the OS cache.
+	// `p_resolver` can map the path to the actual file, off the calling thread.
+	void prefetch(const String &p_path, PathResolver p_resolver = nullptr);
+
+	bool is_completed(RequestID p_id) const;
+	// Blocks until the request is done and releases it. `r_data` may be null to discard the data.
+	Error wait_for_completion(RequestID p_id, Vector<uint8_t> *r_data);
+
+	// Stops the I/O threads. Later requests are read on the calling thread.
+	void finish();
+
+	static FileReadQueue *get_singleton() { return singleton; }
+
+	FileReadQueue();
+	~FileReadQueue();
+};
+
+#endif // FILE_READ_QUEUE_H
@@ -32,6 +32,7 @@
 
 #include "core/config/engine.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -46,38 +47,50 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_make_indent(StringBuilder &r_builder, const String &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_builder.append(p_indent);
+	}
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
-
-	String colon = ":";
-	String end_statement = "";
+void JSON::_flush(StringBuilder &r_builder, FileAccess *p_file) {
+	// Keeps the memory used while streaming to a file bounded.
+	if (p_file && r_builder.get_string_length() >= 64 * 1024) {
+		p_file->store_string(r_builder.as_string());
+		r_builder.clear();
+	}
+}
 
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+void JSON::_stringify(StringBuilder &r_builder, FileAccess *p_file, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		r_builder.append("...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
+	const char *colon = p_indent.is_empty() ? ":" : ": ";
+	const char *end_statement = p_indent.is_empty() ? "" : "\n";
+
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_builder.append("null");
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_builder.append(p_var.operator bool() ? "true" : "false");
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_builder.append(itos(p_var));
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				r_builder.append(String::num(num, 17 - (int)floor(log10(num))));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				r_builder.append(String::num(num, 14 - (int)floor(log10(num))));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -87,33 +100,45 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.size() == 0) {
-				return "[]";
+				r_builder.append("[]");
+				return;
 			}
-			String s = "[";
-			s += end_statement;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (p_markers.has(a.id())) {
+				r_builder.append("\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(a.id());
 
+			r_builder.append("[");
+			r_builder.append(end_statement);
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_builder.append(",");
+					r_builder.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_make_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, p_file, a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_flush(r_builder, p_file);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_builder.append(end_statement);
+			_make_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append("]");
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				r_builder.append("\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
+			r_builder.append("{");
+			r_builder.append(end_statement);
+
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
@@ -126,24 +151,133 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_builder.append(",");
+					r_builder.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_make_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, p_file, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_builder.append(colon);
+				_stringify(r_builder, p_file, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_flush(r_builder, p_file);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_builder.append(end_statement);
+			_make_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append("}");
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_builder.append("\"");
+			r_builder.append(String(p_var).json_escape());
+			r_builder.append("\"");
+			return;
+	}
+}
+
+// String tokens are collected in the encoding of the source text and only
+// converted to a String once the closing quote is found.
+template <typename C>
+struct JSONStringAccumulator;
+
+template <>
+struct JSONStringAccumulator<char32_t> {
+	StringBuilder builder;
+
+	void append_run(const char32_t *p_run, int p_length) {
+		builder.append(p_run, p_length);
+	}
+
+	void append_char(char32_t p_char) {
+		builder.append(p_char);
+	}
+
+	bool finish(String &r_string) {
+		r_string = builder.as_string();
+		return true;
+	}
+};
+
+template <>
+struct JSONStringAccumulator<uint8_t> {
+	LocalVector<char> bytes;
+
+	void append_run(const uint8_t *p_run, int p_length) {
+		uint32_t from = bytes.size();
+		bytes.resize(from + p_length);
+		memcpy(bytes.ptr() + from, p_run, p_length);
+	}
+
+	void append_char(char32_t p_char) {
+		if (p_char < 0x80) {
+			bytes.push_back(p_char);
+		} else if (p_char < 0x800) {
+			bytes.push_back(0xC0 | (p_char >> 6));
+			bytes.push_back(0x80 | (p_char & 0x3F));
+		} else if (p_char < 0x10000) {
+			bytes.push_back(0xE0 | (p_char >> 12));
+			bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+			bytes.push_back(0x80 | (p_char & 0x3F));
+		} else {
+			bytes.push_back(0xF0 | (p_char >> 18));
+			bytes.push_back(0x80 | ((p_char >> 12) & 0x3F));
+			bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+			bytes.push_back(0x80 | (p_char & 0x3F));
+		}
 	}
+
+	bool finish(String &r_string) {
+		if (bytes.is_empty()) {
+			r_string = String();
+			return true;
+		}
+		return r_string.parse_utf8(bytes.ptr(), bytes.size()) == OK;
+	}
+};
+
+// Returns how many characters from p_str on can be copied into a string token
+// as they are, that is up to the next quote, backslash, newline or terminator.
+static int _get_string_run(const char32_t *p_str, int p_len) {
+	int i = 0;
+	while (i < p_len && p_str[i] != '"' && p_str[i] != '\\' && p_str[i] != '\n' && p_str[i] != 0) {
+		i++;
+	}
+	return i;
+}
+
+static int _get_string_run(const uint8_t *p_str, int p_len) {
+	// Check eight bytes at a time, most strings have long runs of plain characters.
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t highs = 0x8080808080808080ULL;
+	int i = 0;
+	while (i + 8 <= p_len) {
+		uint64_t word;
+		memcpy(&word, p_str + i, sizeof(word));
+		const uint64_t quote = word ^ (ones * '"');
+		const uint64_t backslash = word ^ (ones * '\\');
+		const uint64_t newline = word ^ (ones * '\n');
+		const uint64_t special = ((word - ones) & ~word) | ((quote - ones) & ~quote) | ((backslash - ones) & ~backslash) | ((newline - ones) & ~newline);
+		if (special & highs) {
+			break;
+		}
+		i += 8;
+	}
+	while (i < p_len && p_str[i] != '"' && p_str[i] != '\\' && p_str[i] != '\n' && p_str[i] != 0) {
+		i++;
+	}
+	return i;
+}
+
+static double _to_float(const char32_t *p_str, const char32_t **r_end) {
+	return String::to_float(p_str, r_end);
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+static double _to_float(const uint8_t *p_str, const uint8_t **r_end) {
+	return String::to_float((const char *)p_str, (const char **)r_end);
+}
+
+template <typename C>
+Error JSON::_get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -187,8 +321,14 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			}
 			case '"': {
 				index++;
-				String str;
+				JSONStringAccumulator<C> str;
 				while (true) {
+					int run = _get_string_run(p_str + index, p_len - index);
+					if (run > 0) {
+						str.append_run(p_str + index, run);
+						index += run;
+					}
+
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
 						return ERR_PARSE_ERROR;
@@ -310,19 +450,25 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							}
 						}
 
-						str += res;
+						str.append_char(res);
 
 					} else {
 						if (p_str[index] == '\n') {
 							line++;
 						}
-						str += p_str[index];
+						str.append_char(p_str[index]);
 					}
 					index++;
 				}
 
+				String value;
+				if (!str.finish(value)) {
+					r_err_str = "Invalid UTF-8 in string";
+					return ERR_PARSE_ERROR;
+				}
+
 				r_token.type = TK_STRING;
-				r_token.value = str;
+				r_token.value = value;
 				return OK;
 
 			} break;
@@ -334,8 +480,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
+					const C *rptr;
+					double number = _to_float(&p_str[index], &rptr);
 					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
 					r_token.value = number;
@@ -363,7 +509,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep. Bailing.";
 		return ERR_OUT_OF_MEMORY;
@@ -407,7 +554,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_array(Array &array, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -445,7 +593,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -513,10 +662,9 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+template <typename C>
+Error JSON::_parse_text(const C *str, int len, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
 	String aux_key;
@@ -544,6 +692,34 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	return _parse_text(p_json.ptr(), p_json.length(), r_ret, r_err_str, r_err_line);
+}
+
+Error JSON::_parse_utf8(const Vector<uint8_t> &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	const uint8_t *ptr = p_json.ptr();
+	int len = p_json.size();
+
+	// Skip the byte order mark, if any.
+	if (len >= 3 && ptr[0] == 0xEF && ptr[1] == 0xBB && ptr[2] == 0xBF) {
+		ptr += 3;
+		len -= 3;
+	}
+
+	// The tokenizer relies on a terminating zero, which byte arrays usually lack.
+	if (len > 0 && ptr[len - 1] == 0) {
+		return _parse_text(ptr, len - 1, r_ret, r_err_str, r_err_line);
+	}
+
+	LocalVector<uint8_t> terminated;
+	terminated.resize(len + 1);
+	if (len > 0) {
+		memcpy(terminated.ptr(), ptr, len);
+	}
+	terminated[len] = 0;
+	return _parse_text(terminated.ptr(), len, r_ret, r_err_str, r_err_line);
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -555,15 +731,38 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const Vector<uint8_t> &p_json_utf8, bool p_keep_text) {
+	Error err = _parse_utf8(p_json_utf8, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text.parse_utf8((const char *)p_json_utf8.ptr(), p_json_utf8.size());
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	Ref<JSON> jason;
-	jason.instantiate();
+	StringBuilder builder;
 	HashSet<const void *> markers;
-	return jason->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(builder, nullptr, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return builder.as_string();
+}
+
+Error JSON::stringify_to_file(const Ref<FileAccess> &p_file, const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	StringBuilder builder;
+	HashSet<const void *> markers;
+	_stringify(builder, p_file.ptr(), p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	p_file->store_string(builder.as_string());
+
+	Error err = p_file->get_error();
+	return err == ERR_FILE_EOF ? OK : err;
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -576,8 +775,10 @@ Variant JSON::parse_string(const String &p_json_string) {
 
 void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("stringify_to_file", "file", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify_to_file, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_utf8", "keep_text"), &JSON::parse_utf8, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -605,7 +806,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
@@ -648,15 +849,18 @@ Error ResourceFormatSaverJSON::save(const Ref<Resource> &p_resource, const Strin
 	Ref<JSON> json = p_resource;
 	ERR_FAIL_COND_V(json.is_null(), ERR_INVALID_PARAMETER);
 
-	String source = json->get_parsed_text().is_empty() ? JSON::stringify(json->get_data(), "\t", false, true) : json->get_parsed_text();
-
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 
 	ERR_FAIL_COND_V_MSG(err, err, "Cannot save json '" + p_path + "'.");
 
-	file->store_string(source);
-	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
+	if (json->get_parsed_text().is_empty()) {
+		err = JSON::stringify_to_file(file, json->get_data(), "\t", false, true);
+	} else {
+		file->store_string(json->get_parsed_text());
+		err = file->get_error() == ERR_FILE_EOF ? OK : file->get_error();
+	}
+	if (err != OK) {
 		return ERR_CANT_CREATE;
 	}
 
@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/string/string_builder.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
@@ -72,22 +73,34 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	static void _make_indent(StringBuilder &r_builder, const String &p_indent, int p_size);
+	static void _flush(StringBuilder &r_builder, FileAccess *p_file);
+	static void _stringify(StringBuilder &r_builder, FileAccess *p_file, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+
+	// The parser works on either a String (char32_t) or on UTF-8 bytes (uint8_t).
+	template <typename C>
+	static Error _get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C>
+	static Error _parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_array(Array &array, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_text(const C *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error _parse_utf8(const Vector<uint8_t> &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 protected:
 	static void _bind_methods();
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const Vector<uint8_t> &p_json_utf8, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	static Error stringify_to_file(const Ref<FileAccess> &p_file, const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
 	inline Variant get_data() const { return data; }
@@ -33,6 +33,8 @@
 #include "core/object/ref_counted.h"
 #include "core/os/keyboard.h"
 #include "core/string/print_string.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #include <limits.h>
 #include <stdio.h>
@@ -59,6 +61,42 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ENCODE_FLAG_64 1 << 16
 #define ENCODE_FLAG_OBJECT_AS_ID 1 << 16
 
+#define COMPACT_MAGIC 0xFF
+#define COMPACT_VERSION 1
+#define COMPACT_FLAG_64 0x80
+
+// Packed arrays of numbers are stored in little-endian, which is also the memory layout
+// on little-endian hosts, so they are copied in one go and only swapped on big-endian ones.
+static void _copy_packed_32(uint8_t *r_dst, const uint8_t *p_src, int p_count) {
+	if (p_count <= 0) {
+		return;
+	}
+	memcpy(r_dst, p_src, p_count * sizeof(uint32_t));
+#ifdef BIG_ENDIAN_ENABLED
+	for (int i = 0; i < p_count; i++) {
+		uint32_t v;
+		memcpy(&v, r_dst + i * sizeof(uint32_t), sizeof(uint32_t));
+		v = BSWAP32(v);
+		memcpy(r_dst + i * sizeof(uint32_t), &v, sizeof(uint32_t));
+	}
+#endif
+}
+
+static void _copy_packed_64(uint8_t *r_dst, const uint8_t *p_src, int p_count) {
+	if (p_count <= 0) {
+		return;
+	}
+	memcpy(r_dst, p_src, p_count * sizeof(uint64_t));
+#ifdef BIG_ENDIAN_ENABLED
+	for (int i = 0; i < p_count; i++) {
+		uint64_t v;
+		memcpy(&v, r_dst + i * sizeof(uint64_t), sizeof(uint64_t));
+		v = BSWAP64(v);
+		memcpy(r_dst + i * sizeof(uint64_t), &v, sizeof(uint64_t));
+	}
+#endif
+}
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -94,11 +132,17 @@ static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r
 	return OK;
 }
 
+static Error _decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth);
+
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
 	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
 	const uint8_t *buf = p_buffer;
 	int len = p_len;
 
+	if (len > 0 && p_buffer[0] == COMPACT_MAGIC) {
+		return _decode_variant_compact(r_variant, p_buffer, len, r_len, p_allow_objects, p_depth);
+	}
+
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
 	uint32_t type = decode_uint32(buf);
@@ -790,10 +834,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -819,10 +860,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const int*rbuf=(const int*)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				_copy_packed_32((uint8_t *)data.ptrw(), buf, count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -843,10 +881,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const int*rbuf=(const int*)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				_copy_packed_64((uint8_t *)data.ptrw(), buf, count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -867,10 +902,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const float*rbuf=(const float*)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				_copy_packed_32((uint8_t *)data.ptrw(), buf, count);
 			}
 			r_variant = data;
 
@@ -891,10 +923,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				_copy_packed_64((uint8_t *)data.ptrw(), buf, count);
 			}
 			r_variant = data;
 
@@ -948,10 +977,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					_copy_packed_64((uint8_t *)w, buf, count * 2);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
 					}
+#endif
 
 					int adv = sizeof(double) * 2 * count;
 
@@ -973,10 +1006,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
 					}
+#else
+					_copy_packed_32((uint8_t *)w, buf, count * 2);
+#endif
 
 					int adv = sizeof(float) * 2 * count;
 
@@ -1008,11 +1045,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					_copy_packed_64((uint8_t *)w, buf, count * 3);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
 					}
+#endif
 
 					int adv = sizeof(double) * 3 * count;
 
@@ -1034,11 +1075,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
 					}
+#else
+					_copy_packed_32((uint8_t *)w, buf, count * 3);
+#endif
 
 					int adv = sizeof(float) * 3 * count;
 
@@ -1069,15 +1114,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				carray.resize(count);
-				Color *w = carray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					// Colors should always be in single-precision.
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+				// Colors should always be in single-precision.
+				_copy_packed_32((uint8_t *)carray.ptrw(), buf, count * 4);
 
 				int adv = 4 * 4 * count;
 
@@ -1648,10 +1686,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				_copy_packed_32(buf, (const uint8_t *)data.ptr(), datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1665,10 +1700,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				_copy_packed_64(buf, (const uint8_t *)data.ptr(), datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1682,10 +1714,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				_copy_packed_32(buf, (const uint8_t *)data.ptr(), datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1699,10 +1728,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				_copy_packed_64(buf, (const uint8_t *)data.ptr(), datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1751,13 +1777,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector2 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					buf += sizeof(real_t) * 2;
-				}
+#ifdef REAL_T_IS_DOUBLE
+				_copy_packed_64(buf, (const uint8_t *)data.ptr(), len * 2);
+#else
+				_copy_packed_32(buf, (const uint8_t *)data.ptr(), len * 2);
+#endif
+				buf += sizeof(real_t) * 2 * len;
 			}
 
 			r_len += sizeof(real_t) * 2 * len;
@@ -1775,14 +1800,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector3 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					encode_real(v.z, &buf[sizeof(real_t) * 2]);
-					buf += sizeof(real_t) * 3;
-				}
+#ifdef REAL_T_IS_DOUBLE
+				_copy_packed_64(buf, (const uint8_t *)data.ptr(), len * 3);
+#else
+				_copy_packed_32(buf, (const uint8_t *)data.ptr(), len * 3);
+#endif
+				buf += sizeof(real_t) * 3 * len;
 			}
 
 			r_len += sizeof(real_t) * 3 * len;
@@ -1800,15 +1823,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Color c = data.get(i);
-
-					encode_float(c.r, &buf[0]);
-					encode_float(c.g, &buf[4]);
-					encode_float(c.b, &buf[8]);
-					encode_float(c.a, &buf[12]);
-					buf += 4 * 4; // Colors should always be in single-precision.
-				}
+				_copy_packed_32(buf, (const uint8_t *)data.ptr(), len * 4); // Colors should always be in single-precision.
+				buf += 4 * 4 * len;
 			}
 
 			r_len += 4 * 4 * len;
@@ -1822,6 +1838,634 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+// Compact encoding.
+//
+// A compact stream starts with COMPACT_MAGIC, which can never be the type byte of a regular
+// header, followed by a format version. Values are tagged with a single byte, lengths and
+// integers are varints, and StringNames and String dictionary keys are written once per
+// stream and referenced by index afterwards. Types without a compact form are embedded
+// using the regular encoding.
+
+enum CompactTag {
+	COMPACT_TAG_NIL,
+	COMPACT_TAG_FALSE,
+	COMPACT_TAG_TRUE,
+	COMPACT_TAG_INT,
+	COMPACT_TAG_FLOAT32,
+	COMPACT_TAG_FLOAT64,
+	COMPACT_TAG_STRING,
+	COMPACT_TAG_NAME,
+	COMPACT_TAG_NAME_REF,
+	COMPACT_TAG_KEY,
+	COMPACT_TAG_KEY_REF,
+	COMPACT_TAG_ARRAY,
+	COMPACT_TAG_TYPED_ARRAY,
+	COMPACT_TAG_DICTIONARY,
+	COMPACT_TAG_PACKED_ARRAY,
+	COMPACT_TAG_LEGACY,
+	COMPACT_TAG_MAX
+};
+
+static bool _is_compact_typed_array(const Array &p_array) {
+	return p_array.is_typed() && p_array.get_typed_builtin() != Variant::OBJECT;
+}
+
+class CompactVariantEncoder {
+	LocalVector<uint8_t> data;
+	HashMap<StringName, uint32_t> names;
+	HashMap<String, uint32_t> keys;
+	bool full_objects = false;
+
+	uint8_t *_reserve(uint32_t p_size) {
+		uint32_t ofs = data.size();
+		data.resize(ofs + p_size);
+		return data.ptr() + ofs;
+	}
+
+	void _put_u8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void _put_varint(uint64_t p_value) {
+		while (p_value >= 0x80) {
+			data.push_back(uint8_t(p_value) | 0x80);
+			p_value >>= 7;
+		}
+		data.push_back(uint8_t(p_value));
+	}
+
+	void _put_int(int64_t p_value) {
+		// Zigzag, so small negative numbers stay short.
+		_put_varint((uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63));
+	}
+
+	void _put_utf8(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		_put_varint(utf8.length());
+		if (utf8.length()) {
+			memcpy(_reserve(utf8.length()), utf8.get_data(), utf8.length());
+		}
+	}
+
+	void _put_name(const StringName &p_name) {
+		const uint32_t *index = names.getptr(p_name);
+		if (index) {
+			_put_u8(COMPACT_TAG_NAME_REF);
+			_put_varint(*index);
+			return;
+		}
+		names.insert(p_name, names.size());
+		_put_u8(COMPACT_TAG_NAME);
+		_put_utf8(p_name);
+	}
+
+	void _put_key(const String &p_key) {
+		const uint32_t *index = keys.getptr(p_key);
+		if (index) {
+			_put_u8(COMPACT_TAG_KEY_REF);
+			_put_varint(*index);
+			return;
+		}
+		keys.insert(p_key, keys.size());
+		_put_u8(COMPACT_TAG_KEY);
+		_put_utf8(p_key);
+	}
+
+	template <typename T>
+	void _put_packed(Variant::Type p_type, const Vector<T> &p_array, int p_words, int p_word_size, bool p_64) {
+		_put_u8(p_type | (p_64 ? COMPACT_FLAG_64 : 0));
+		_put_varint(p_array.size());
+		int words = p_array.size() * p_words;
+		if (words == 0) {
+			return;
+		}
+		uint8_t *w = _reserve(words * p_word_size);
+		if (p_word_size == 8) {
+			_copy_packed_64(w, (const uint8_t *)p_array.ptr(), words);
+		} else if (p_word_size == 4) {
+			_copy_packed_32(w, (const uint8_t *)p_array.ptr(), words);
+		} else {
+			memcpy(w, p_array.ptr(), words);
+		}
+	}
+
+	Error _put_legacy(const Variant &p_variant, int p_depth) {
+		int len;
+		Error err = encode_variant(p_variant, nullptr, len, full_objects, p_depth);
+		ERR_FAIL_COND_V(err, err);
+		_put_u8(COMPACT_TAG_LEGACY);
+		_put_varint(len);
+		return encode_variant(p_variant, _reserve(len), len, full_objects, p_depth);
+	}
+
+	Error _put_typed_element(Variant::Type p_type, const Variant &p_value, int p_depth) {
+		switch (p_type) {
+			case Variant::BOOL: {
+				_put_u8(bool(p_value));
+			} break;
+			case Variant::INT: {
+				_put_int(p_value);
+			} break;
+			case Variant::FLOAT: {
+				encode_double(p_value, _reserve(8));
+			} break;
+			case Variant::STRING: {
+				_put_utf8(p_value);
+			} break;
+			default: {
+				return put_value(p_value, p_depth + 1);
+			}
+		}
+		return OK;
+	}
+
+public:
+	Error put_value(const Variant &p_variant, int p_depth);
+
+	void get_data(Vector<uint8_t> &r_buffer) const {
+		r_buffer.resize(data.size());
+		if (data.size()) {
+			memcpy(r_buffer.ptrw(), data.ptr(), data.size());
+		}
+	}
+
+	CompactVariantEncoder(bool p_full_objects) {
+		full_objects = p_full_objects;
+		_put_u8(COMPACT_MAGIC);
+		_put_u8(COMPACT_VERSION);
+	}
+};
+
+Error CompactVariantEncoder::put_value(const Variant &p_variant, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	switch (p_variant.get_type()) {
+		case Variant::NIL: {
+			_put_u8(COMPACT_TAG_NIL);
+		} break;
+		case Variant::BOOL: {
+			_put_u8(bool(p_variant) ? COMPACT_TAG_TRUE : COMPACT_TAG_FALSE);
+		} break;
+		case Variant::INT: {
+			_put_u8(COMPACT_TAG_INT);
+			_put_int(p_variant);
+		} break;
+		case Variant::FLOAT: {
+			double d = p_variant;
+			float f = d;
+			if (double(f) == d) {
+				_put_u8(COMPACT_TAG_FLOAT32);
+				encode_float(f, _reserve(4));
+			} else {
+				_put_u8(COMPACT_TAG_FLOAT64);
+				encode_double(d, _reserve(8));
+			}
+		} break;
+		case Variant::STRING: {
+			_put_u8(COMPACT_TAG_STRING);
+			_put_utf8(p_variant);
+		} break;
+		case Variant::STRING_NAME: {
+			_put_name(p_variant);
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_variant;
+			if (_is_compact_typed_array(array)) {
+				Variant::Type type = Variant::Type(array.get_typed_builtin());
+				_put_u8(COMPACT_TAG_TYPED_ARRAY);
+				_put_u8(type);
+				_put_varint(array.size());
+				for (int i = 0; i < array.size(); i++) {
+					Error err = _put_typed_element(type, array[i], p_depth);
+					ERR_FAIL_COND_V(err, err);
+				}
+			} else {
+				_put_u8(COMPACT_TAG_ARRAY);
+				_put_varint(array.size());
+				for (int i = 0; i < array.size(); i++) {
+					Error err = put_value(array[i], p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary d = p_variant;
+			_put_u8(COMPACT_TAG_DICTIONARY);
+			_put_varint(d.size());
+			for (const Variant *key = d.next(); key; key = d.next(key)) {
+				if (key->get_type() == Variant::STRING) {
+					_put_key(*key);
+				} else {
+					Error err = put_value(*key, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+				Error err = put_value(*d.getptr(*key), p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_BYTE_ARRAY, Vector<uint8_t>(p_variant), 1, 1, false);
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_INT32_ARRAY, Vector<int32_t>(p_variant), 1, 4, false);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_INT64_ARRAY, Vector<int64_t>(p_variant), 1, 8, false);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_FLOAT32_ARRAY, Vector<float>(p_variant), 1, 4, false);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_FLOAT64_ARRAY, Vector<double>(p_variant), 1, 8, false);
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_VECTOR2_ARRAY, Vector<Vector2>(p_variant), 2, sizeof(real_t), sizeof(real_t) == 8);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_VECTOR3_ARRAY, Vector<Vector3>(p_variant), 3, sizeof(real_t), sizeof(real_t) == 8);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_packed(Variant::PACKED_COLOR_ARRAY, Vector<Color>(p_variant), 4, 4, false);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			const Vector<String> strings = p_variant;
+			_put_u8(COMPACT_TAG_PACKED_ARRAY);
+			_put_u8(Variant::PACKED_STRING_ARRAY);
+			_put_varint(strings.size());
+			for (const String &s : strings) {
+				_put_utf8(s);
+			}
+		} break;
+		default: {
+			return _put_legacy(p_variant, p_depth);
+		}
+	}
+
+	return OK;
+}
+
+class CompactVariantDecoder {
+	const uint8_t *buf = nullptr;
+	int len = 0;
+	int pos = 0;
+	LocalVector<StringName> names;
+	LocalVector<String> keys;
+	bool allow_objects = false;
+
+	Error _get_u8(uint8_t &r_value) {
+		ERR_FAIL_COND_V(pos >= len, ERR_INVALID_DATA);
+		r_value = buf[pos++];
+		return OK;
+	}
+
+	Error _get_varint(uint64_t &r_value) {
+		r_value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			ERR_FAIL_COND_V(pos >= len, ERR_INVALID_DATA);
+			uint8_t b = buf[pos++];
+			r_value |= uint64_t(b & 0x7F) << shift;
+			if (!(b & 0x80)) {
+				return OK;
+			}
+		}
+		ERR_FAIL_V(ERR_INVALID_DATA);
+	}
+
+	// Reads a count of items that take at least p_item_size bytes each, so corrupt
+	// data cannot request more memory than the buffer could possibly describe.
+	Error _get_count(int &r_count, int p_item_size) {
+		uint64_t count;
+		Error err = _get_varint(count);
+		ERR_FAIL_COND_V(err, err);
+		ERR_FAIL_COND_V(count > uint64_t(len - pos) / MAX(p_item_size, 1), ERR_INVALID_DATA);
+		r_count = int(count);
+		return OK;
+	}
+
+	Error _get_int(int64_t &r_value) {
+		uint64_t z;
+		Error err = _get_varint(z);
+		ERR_FAIL_COND_V(err, err);
+		r_value = int64_t(z >> 1) ^ -int64_t(z & 1);
+		return OK;
+	}
+
+	Error _get_utf8(String &r_string) {
+		int length;
+		Error err = _get_count(length, 1);
+		ERR_FAIL_COND_V(err, err);
+		String str;
+		if (length) {
+			ERR_FAIL_COND_V(str.parse_utf8((const char *)buf + pos, length) != OK, ERR_INVALID_DATA);
+		}
+		pos += length;
+		r_string = str;
+		return OK;
+	}
+
+	Error _get_index(uint32_t p_size, uint32_t &r_index) {
+		uint64_t index;
+		Error err = _get_varint(index);
+		ERR_FAIL_COND_V(err, err);
+		ERR_FAIL_COND_V(index >= p_size, ERR_INVALID_DATA);
+		r_index = uint32_t(index);
+		return OK;
+	}
+
+	template <typename T>
+	Error _get_packed(Variant &r_variant, int p_words, int p_word_size) {
+		int count;
+		Error err = _get_count(count, p_words * p_word_size);
+		ERR_FAIL_COND_V(err, err);
+		Vector<T> array;
+		array.resize(count);
+		int words = count * p_words;
+		if (p_word_size == 8) {
+			_copy_packed_64((uint8_t *)array.ptrw(), buf + pos, words);
+		} else if (p_word_size == 4) {
+			_copy_packed_32((uint8_t *)array.ptrw(), buf + pos, words);
+		} else if (words) {
+			memcpy(array.ptrw(), buf + pos, words);
+		}
+		pos += words * p_word_size;
+		r_variant = array;
+		return OK;
+	}
+
+	// Vector arrays written with a different real_t width are converted component by component.
+	template <typename T>
+	Error _get_packed_real(Variant &r_variant, int p_components, bool p_64) {
+		if (p_64 == (sizeof(real_t) == 8)) {
+			return _get_packed<T>(r_variant, p_components, sizeof(real_t));
+		}
+		int word_size = p_64 ? 8 : 4;
+		int count;
+		Error err = _get_count(count, p_components * word_size);
+		ERR_FAIL_COND_V(err, err);
+		Vector<T> array;
+		array.resize(count);
+		real_t *w = (real_t *)array.ptrw();
+		for (int i = 0; i < count * p_components; i++) {
+			w[i] = p_64 ? decode_double(buf + pos) : decode_float(buf + pos);
+			pos += word_size;
+		}
+		r_variant = array;
+		return OK;
+	}
+
+	Error _get_packed_array(Variant &r_variant) {
+		uint8_t type;
+		Error err = _get_u8(type);
+		ERR_FAIL_COND_V(err, err);
+		bool is_64 = type & COMPACT_FLAG_64;
+		switch (type & ~COMPACT_FLAG_64) {
+			case Variant::PACKED_BYTE_ARRAY:
+				return _get_packed<uint8_t>(r_variant, 1, 1);
+			case Variant::PACKED_INT32_ARRAY:
+				return _get_packed<int32_t>(r_variant, 1, 4);
+			case Variant::PACKED_INT64_ARRAY:
+				return _get_packed<int64_t>(r_variant, 1, 8);
+			case Variant::PACKED_FLOAT32_ARRAY:
+				return _get_packed<float>(r_variant, 1, 4);
+			case Variant::PACKED_FLOAT64_ARRAY:
+				return _get_packed<double>(r_variant, 1, 8);
+			case Variant::PACKED_VECTOR2_ARRAY:
+				return _get_packed_real<Vector2>(r_variant, 2, is_64);
+			case Variant::PACKED_VECTOR3_ARRAY:
+				return _get_packed_real<Vector3>(r_variant, 3, is_64);
+			case Variant::PACKED_COLOR_ARRAY:
+				return _get_packed<Color>(r_variant, 4, 4);
+			case Variant::PACKED_STRING_ARRAY: {
+				int count;
+				err = _get_count(count, 1);
+				ERR_FAIL_COND_V(err, err);
+				Vector<String> strings;
+				strings.resize(count);
+				String *w = strings.ptrw();
+				for (int i = 0; i < count; i++) {
+					err = _get_utf8(w[i]);
+					ERR_FAIL_COND_V(err, err);
+				}
+				r_variant = strings;
+				return OK;
+			}
+			default: {
+				ERR_FAIL_V(ERR_INVALID_DATA);
+			}
+		}
+	}
+
+	Error _get_typed_element(Variant::Type p_type, Variant &r_value, int p_depth) {
+		switch (p_type) {
+			case Variant::BOOL: {
+				uint8_t b;
+				Error err = _get_u8(b);
+				ERR_FAIL_COND_V(err, err);
+				r_value = b != 0;
+			} break;
+			case Variant::INT: {
+				int64_t i;
+				Error err = _get_int(i);
+				ERR_FAIL_COND_V(err, err);
+				r_value = i;
+			} break;
+			case Variant::FLOAT: {
+				ERR_FAIL_COND_V(len - pos < 8, ERR_INVALID_DATA);
+				r_value = decode_double(buf + pos);
+				pos += 8;
+			} break;
+			case Variant::STRING: {
+				String s;
+				Error err = _get_utf8(s);
+				ERR_FAIL_COND_V(err, err);
+				r_value = s;
+			} break;
+			default: {
+				Error err = get_value(r_value, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				ERR_FAIL_COND_V(r_value.get_type() != p_type, ERR_INVALID_DATA);
+			}
+		}
+		return OK;
+	}
+
+public:
+	Error get_value(Variant &r_variant, int p_depth);
+
+	int get_position() const {
+		return pos;
+	}
+
+	CompactVariantDecoder(const uint8_t *p_buffer, int p_len, bool p_allow_objects) {
+		buf = p_buffer;
+		len = p_len;
+		allow_objects = p_allow_objects;
+	}
+};
+
+Error CompactVariantDecoder::get_value(Variant &r_variant, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+	uint8_t tag;
+	Error err = _get_u8(tag);
+	ERR_FAIL_COND_V(err, err);
+
+	switch (tag) {
+		case COMPACT_TAG_NIL: {
+			r_variant = Variant();
+		} break;
+		case COMPACT_TAG_FALSE: {
+			r_variant = false;
+		} break;
+		case COMPACT_TAG_TRUE: {
+			r_variant = true;
+		} break;
+		case COMPACT_TAG_INT: {
+			int64_t i;
+			err = _get_int(i);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = i;
+		} break;
+		case COMPACT_TAG_FLOAT32: {
+			ERR_FAIL_COND_V(len - pos < 4, ERR_INVALID_DATA);
+			r_variant = double(decode_float(buf + pos));
+			pos += 4;
+		} break;
+		case COMPACT_TAG_FLOAT64: {
+			ERR_FAIL_COND_V(len - pos < 8, ERR_INVALID_DATA);
+			r_variant = decode_double(buf + pos);
+			pos += 8;
+		} break;
+		case COMPACT_TAG_STRING: {
+			String s;
+			err = _get_utf8(s);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = s;
+		} break;
+		case COMPACT_TAG_NAME: {
+			String s;
+			err = _get_utf8(s);
+			ERR_FAIL_COND_V(err, err);
+			names.push_back(StringName(s));
+			r_variant = names[names.size() - 1];
+		} break;
+		case COMPACT_TAG_NAME_REF: {
+			uint32_t index;
+			err = _get_index(names.size(), index);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = names[index];
+		} break;
+		case COMPACT_TAG_KEY: {
+			String s;
+			err = _get_utf8(s);
+			ERR_FAIL_COND_V(err, err);
+			keys.push_back(s);
+			r_variant = s;
+		} break;
+		case COMPACT_TAG_KEY_REF: {
+			uint32_t index;
+			err = _get_index(keys.size(), index);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = keys[index];
+		} break;
+		case COMPACT_TAG_ARRAY: {
+			int count;
+			err = _get_count(count, 1);
+			ERR_FAIL_COND_V(err, err);
+			Array array;
+			array.resize(count);
+			for (int i = 0; i < count; i++) {
+				Variant v;
+				err = get_value(v, p_depth + 1);
+				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+				array[i] = v;
+			}
+			r_variant = array;
+		} break;
+		case COMPACT_TAG_TYPED_ARRAY: {
+			uint8_t type;
+			err = _get_u8(type);
+			ERR_FAIL_COND_V(err, err);
+			ERR_FAIL_COND_V(type == Variant::NIL || type == Variant::OBJECT || type >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+			int count;
+			err = _get_count(count, 1);
+			ERR_FAIL_COND_V(err, err);
+			Array array;
+			array.set_typed(type, StringName(), Variant());
+			for (int i = 0; i < count; i++) {
+				Variant v;
+				err = _get_typed_element(Variant::Type(type), v, p_depth);
+				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+				array.push_back(v);
+			}
+			r_variant = array;
+		} break;
+		case COMPACT_TAG_DICTIONARY: {
+			int count;
+			err = _get_count(count, 2);
+			ERR_FAIL_COND_V(err, err);
+			Dictionary d;
+			for (int i = 0; i < count; i++) {
+				Variant key, value;
+				err = get_value(key, p_depth + 1);
+				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+				err = get_value(value, p_depth + 1);
+				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+				d[key] = value;
+			}
+			r_variant = d;
+		} break;
+		case COMPACT_TAG_PACKED_ARRAY: {
+			err = _get_packed_array(r_variant);
+			ERR_FAIL_COND_V(err, err);
+		} break;
+		case COMPACT_TAG_LEGACY: {
+			int size;
+			err = _get_count(size, 1);
+			ERR_FAIL_COND_V(err, err);
+			int used = 0;
+			err = decode_variant(r_variant, buf + pos, size, &used, allow_objects, p_depth);
+			ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+			ERR_FAIL_COND_V(used != size, ERR_INVALID_DATA);
+			pos += size;
+		} break;
+		default: {
+			ERR_FAIL_V(ERR_INVALID_DATA);
+		}
+	}
+
+	return OK;
+}
+
+static Error _decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
+	ERR_FAIL_COND_V(p_len < 3, ERR_INVALID_DATA);
+	ERR_FAIL_COND_V_MSG(p_buffer[1] != COMPACT_VERSION, ERR_INVALID_DATA, vformat("Unsupported compact Variant encoding version: %d.", p_buffer[1]));
+
+	CompactVariantDecoder decoder(p_buffer + 2, p_len - 2, p_allow_objects);
+	Error err = decoder.get_value(r_variant, p_depth);
+	ERR_FAIL_COND_V(err, err);
+	if (r_len) {
+		*r_len = 2 + decoder.get_position();
+	}
+	return OK;
+}
+
+Error encode_variant_compact(const Variant &p_variant, Vector<uint8_t> &r_buffer, bool p_full_objects) {
+	CompactVariantEncoder encoder(p_full_objects);
+	Error err = encoder.put_value(p_variant, 0);
+	ERR_FAIL_COND_V(err, err);
+	encoder.get_data(r_buffer);
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
@@ -46,6 +46,14 @@ int PacketPeer::get_encode_buffer_max_size() const {
 	return encode_buffer_max_size;
 }
 
+void PacketPeer::set_compact_var_encoding(bool p_enabled) {
+	compact_var_encoding = p_enabled;
+}
+
+bool PacketPeer::is_compact_var_encoding() const {
+	return compact_var_encoding;
+}
+
 Error PacketPeer::get_packet_buffer(Vector<uint8_t> &r_buffer) {
 	const uint8_t *buffer;
 	int buffer_size;
@@ -89,6 +97,14 @@ Error PacketPeer::get_var(Variant &r_variant, bool p_allow_objects) {
 }
 
 Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
+	if (compact_var_encoding) {
+		Error err = encode_variant_compact(p_packet, encode_buffer, p_full_objects);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to encode Variant.");
+		ERR_FAIL_COND_V_MSG(encode_buffer.size() > encode_buffer_max_size, ERR_OUT_OF_MEMORY, "Failed to encode variant, encode size is bigger then encode_buffer_max_size. Consider raising it via 'set_encode_buffer_max_size'.");
+
+		return put_packet(encode_buffer.ptr(), encode_buffer.size());
+	}
+
 	int len;
 	Error err = encode_variant(p_packet, nullptr, len, p_full_objects); // compute len first
 	if (err) {
@@ -146,8 +162,11 @@ void PacketPeer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_encode_buffer_max_size"), &PacketPeer::get_encode_buffer_max_size);
 	ClassDB::bind_method(D_METHOD("set_encode_buffer_max_size", "max_size"), &PacketPeer::set_encode_buffer_max_size);
+	ClassDB::bind_method(D_METHOD("is_compact_var_encoding"), &PacketPeer::is_compact_var_encoding);
+	ClassDB::bind_method(D_METHOD("set_compact_var_encoding", "enabled"), &PacketPeer::set_compact_var_encoding);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "encode_buffer_max_size"), "set_encode_buffer_max_size", "get_encode_buffer_max_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compact_var_encoding"), "set_compact_var_encoding", "is_compact_var_encoding");
 }
 
 /***************/
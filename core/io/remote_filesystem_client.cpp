@@ -30,13 +30,16 @@
 
 #include "remote_filesystem_client.h"
 
+#include "core/crypto/crypto_core.h"
+#include "core/io/compression.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/string/string_builder.h"
 
 #define FILESYSTEM_CACHE_VERSION 1
-#define FILESYSTEM_PROTOCOL_VERSION 1
+#define FILESYSTEM_PROTOCOL_VERSION 2
 #define PASSWORD_LENGTH 32
 
 #define FILES_SUBFOLDER "remote_filesystem_files"
@@ -111,6 +114,149 @@ Error RemoteFilesystemClient::_store_file(const String &p_path, const LocalVecto
 Error RemoteFilesystemClient::_remove_file(const String &p_path) {
 	return DirAccess::remove_absolute(cache_path.path_join(FILES_SUBFOLDER).path_join(p_path));
 }
+
+Error RemoteFilesystemClient::_load_file(const String &p_path, LocalVector<uint8_t> &r_file) {
+	Ref<FileAccess> f = FileAccess::open(cache_path.path_join(FILES_SUBFOLDER).path_join(p_path), FileAccess::READ);
+	if (f.is_null()) {
+		return ERR_FILE_NOT_FOUND;
+	}
+	r_file.resize(f->get_length());
+	uint64_t read = f->get_buffer(r_file.ptr(), r_file.size());
+	return read == r_file.size() ? OK : ERR_FILE_CORRUPT;
+}
+
+uint32_t RemoteFilesystemClient::delta_weak_checksum(const uint8_t *p_data, uint32_t p_size) {
+	// Two 16-bit sums, as in rsync, so the window can be rolled one byte at a time.
+	uint32_t a = 0;
+	uint32_t b = 0;
+	for (uint32_t i = 0; i < p_size; i++) {
+		a += p_data[i];
+		b += (p_size - i) * p_data[i];
+	}
+	return (a & 0xFFFF) | ((b & 0xFFFF) << 16);
+}
+
+void RemoteFilesystemClient::delta_make_signatures(const uint8_t *p_data, uint64_t p_size, LocalVector<BlockSignature> &r_signatures) {
+	// Only full blocks are signed, a trailing partial block is always sent as literal data.
+	uint64_t block_count = p_size / DELTA_BLOCK_SIZE;
+	r_signatures.resize(block_count);
+	for (uint64_t i = 0; i < block_count; i++) {
+		const uint8_t *block = p_data + i * DELTA_BLOCK_SIZE;
+		r_signatures[i].weak = delta_weak_checksum(block, DELTA_BLOCK_SIZE);
+		CryptoCore::md5(block, DELTA_BLOCK_SIZE, r_signatures[i].strong);
+	}
+}
+
+static void _delta_put_literal(const uint8_t *p_data, uint64_t p_size, LocalVector<uint8_t> &r_delta) {
+	while (p_size > 0) {
+		uint32_t len = MIN(p_size, (uint64_t)UINT32_MAX);
+		uint32_t ofs = r_delta.size();
+		r_delta.resize(ofs + 5 + len);
+		r_delta[ofs] = RemoteFilesystemClient::DELTA_OP_LITERAL;
+		encode_uint32(len, &r_delta[ofs + 1]);
+		memcpy(&r_delta[ofs + 5], p_data, len);
+		p_data += len;
+		p_size -= len;
+	}
+}
+
+void RemoteFilesystemClient::delta_encode(const uint8_t *p_data, uint64_t p_size, const LocalVector<BlockSignature> &p_signatures, LocalVector<uint8_t> &r_delta) {
+	r_delta.clear();
+
+	if (p_signatures.is_empty() || p_size < DELTA_BLOCK_SIZE) {
+		_delta_put_literal(p_data, p_size, r_delta);
+		return;
+	}
+
+	HashMap<uint32_t, LocalVector<uint32_t>> blocks_by_weak;
+	for (uint32_t i = 0; i < p_signatures.size(); i++) {
+		blocks_by_weak[p_signatures[i].weak].push_back(i);
+	}
+
+	const uint32_t block_size = DELTA_BLOCK_SIZE;
+	uint64_t pos = 0;
+	uint64_t literal_start = 0;
+	uint32_t weak = delta_weak_checksum(p_data, block_size);
+	uint32_t a = weak & 0xFFFF;
+	uint32_t b = weak >> 16;
+
+	while (pos + block_size <= p_size) {
+		int64_t match = -1;
+		const LocalVector<uint32_t> *candidates = blocks_by_weak.getptr(a | (b << 16));
+		if (candidates) {
+			uint8_t strong[16];
+			CryptoCore::md5(p_data + pos, block_size, strong);
+			for (uint32_t index : *candidates) {
+				if (memcmp(strong, p_signatures[index].strong, 16) == 0) {
+					match = index;
+					break;
+				}
+			}
+		}
+
+		if (match >= 0) {
+			_delta_put_literal(p_data + literal_start, pos - literal_start, r_delta);
+			uint32_t ofs = r_delta.size();
+			r_delta.resize(ofs + 5);
+			r_delta[ofs] = DELTA_OP_COPY;
+			encode_uint32(match, &r_delta[ofs + 1]);
+
+			pos += block_size;
+			literal_start = pos;
+			if (pos + block_size <= p_size) {
+				weak = delta_weak_checksum(p_data + pos, block_size);
+				a = weak & 0xFFFF;
+				b = weak >> 16;
+			}
+			continue;
+		}
+
+		// Roll the window forward by one byte.
+		if (pos + block_size < p_size) {
+			uint32_t out = p_data[pos];
+			uint32_t in = p_data[pos + block_size];
+			a = (a - out + in) & 0xFFFF;
+			b = (b - block_size * out + a) & 0xFFFF;
+		}
+		pos++;
+	}
+
+	_delta_put_literal(p_data + literal_start, p_size - literal_start, r_delta);
+}
+
+Error RemoteFilesystemClient::delta_apply(const LocalVector<uint8_t> &p_base, const uint8_t *p_delta, uint64_t p_delta_size, uint64_t p_size, LocalVector<uint8_t> &r_file) {
+	r_file.resize(p_size);
+	uint64_t written = 0;
+	uint64_t ofs = 0;
+	while (ofs < p_delta_size) {
+		ERR_FAIL_COND_V(ofs + 5 > p_delta_size, ERR_FILE_CORRUPT);
+		uint8_t op = p_delta[ofs];
+		uint32_t arg = decode_uint32(&p_delta[ofs + 1]);
+		ofs += 5;
+
+		const uint8_t *src = nullptr;
+		uint64_t len = 0;
+		if (op == DELTA_OP_COPY) {
+			ERR_FAIL_COND_V((uint64_t)arg * DELTA_BLOCK_SIZE + DELTA_BLOCK_SIZE > p_base.size(), ERR_FILE_CORRUPT);
+			src = p_base.ptr() + (uint64_t)arg * DELTA_BLOCK_SIZE;
+			len = DELTA_BLOCK_SIZE;
+		} else if (op == DELTA_OP_LITERAL) {
+			ERR_FAIL_COND_V(ofs + arg > p_delta_size, ERR_FILE_CORRUPT);
+			src = p_delta + ofs;
+			len = arg;
+			ofs += arg;
+		} else {
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		ERR_FAIL_COND_V(written + len > p_size, ERR_FILE_CORRUPT);
+		memcpy(r_file.ptr() + written, src, len);
+		written += len;
+	}
+	ERR_FAIL_COND_V(written != p_size, ERR_FILE_CORRUPT);
+	return OK;
+}
+
 Error RemoteFilesystemClient::_store_cache_file(const Vector<FileCache> &p_cache) {
 	String full_path = cache_path.path_join(FILES_CACHE_FILE);
 	String base_file_dir = full_path.get_base_dir();
@@ -260,11 +406,40 @@ Error RemoteFilesystemClient::_synchronize_with_server(const String &p_host, int
 		files_processed.insert(file);
 	}
 
+	// Send signatures of the copies already cached here, so the server only has to send what differs.
+	print_verbose("Remote Filesystem: Sending block signatures.");
+	LocalVector<BlockSignature> signatures;
+	LocalVector<uint8_t> signature_buffer;
+	for (uint32_t i = 0; i < file_count; i++) {
+		if (temp_file_cache[i].server_modified_time == 0) {
+			continue; // Removed, nothing will be sent.
+		}
+
+		signatures.clear();
+		if (_load_file(temp_file_cache[i].path, file_buffer) == OK) {
+			delta_make_signatures(file_buffer.ptr(), file_buffer.size(), signatures);
+		}
+
+		signature_buffer.resize(4 + signatures.size() * 20);
+		encode_uint32(signatures.size(), signature_buffer.ptr());
+		for (uint32_t j = 0; j < signatures.size(); j++) {
+			uint8_t *ptr = signature_buffer.ptr() + 4 + j * 20;
+			encode_uint32(signatures[j].weak, ptr);
+			memcpy(ptr + 4, signatures[j].strong, 16);
+		}
+		err = tcp_client->put_data(signature_buffer.ptr(), signature_buffer.size());
+		ERR_FAIL_COND_V_MSG(err != OK, ERR_CONNECTION_ERROR, "Remote filesystem server disconnected while sending block signatures.");
+	}
+
 	Vector<FileCache> new_file_cache;
 
 	// Get the actual files. As a robustness measure, if the connection is interrupted here, any file not yet received will be considered removed.
 	// Since the file changed anyway, this makes it the easiest way to keep robustness.
 
+	LocalVector<uint8_t> delta_buffer;
+	LocalVector<uint8_t> compressed_buffer;
+	LocalVector<uint8_t> base_buffer;
+
 	bool server_disconnected = false;
 	for (uint32_t i = 0; i < file_count; i++) {
 		String file = temp_file_cache[i].path;
@@ -275,10 +450,25 @@ Error RemoteFilesystemClient::_synchronize_with_server(const String &p_host, int
 			continue;
 		}
 
+		// Each file arrives as its final size, the delta size, and the compressed delta size (zero if sent uncompressed).
 		uint64_t file_size = tcp_client->get_u64();
-		file_buffer.resize(file_size);
-
-		err = tcp_client->get_data(file_buffer.ptr(), file_size);
+		uint64_t delta_size = tcp_client->get_u64();
+		uint64_t compressed_size = tcp_client->get_u64();
+
+		if (compressed_size > 0) {
+			compressed_buffer.resize(compressed_size);
+			err = tcp_client->get_data(compressed_buffer.ptr(), compressed_size);
+			if (err == OK) {
+				delta_buffer.resize(delta_size);
+				int ret = Compression::decompress(delta_buffer.ptr(), delta_size, compressed_buffer.ptr(), compressed_size, Compression::MODE_ZSTD);
+				if (ret < 0 || (uint64_t)ret != delta_size) {
+					err = ERR_FILE_CORRUPT;
+				}
+			}
+		} else {
+			delta_buffer.resize(delta_size);
+			err = tcp_client->get_data(delta_buffer.ptr(), delta_size);
+		}
 		if (err != OK) {
 			ERR_PRINT("Error retrieving file from remote filesystem: " + file);
 			server_disconnected = true;
@@ -295,6 +485,16 @@ Error RemoteFilesystemClient::_synchronize_with_server(const String &p_host, int
 			continue;
 		}
 
+		base_buffer.clear();
+		_load_file(file, base_buffer); // May be missing, then the delta holds no block references.
+		err = delta_apply(base_buffer, delta_buffer.ptr(), delta_buffer.size(), file_size, file_buffer);
+		if (err != OK) {
+			// The stream is still in sync, only this file is lost.
+			ERR_PRINT("Error rebuilding file from remote filesystem delta: " + file);
+			_remove_file(file);
+			continue;
+		}
+
 		uint64_t modified_time = 0;
 		err = _store_file(file, file_buffer, modified_time);
 		if (err != OK) {
@@ -50,6 +50,7 @@ protected:
 	virtual bool _is_configured() { return !cache_path.is_empty(); }
 	// Can be re-implemented per platform. If so, feel free to ignore get_cache_path()
 	virtual Vector<FileCache> _load_cache_file();
+	virtual Error _load_file(const String &p_path, LocalVector<uint8_t> &r_file);
 	virtual Error _store_file(const String &p_path, const LocalVector<uint8_t> &p_file, uint64_t &modified_time);
 	virtual Error _remove_file(const String &p_path);
 	virtual Error _store_cache_file(const Vector<FileCache> &p_cache);
@@ -58,6 +59,28 @@ protected:
 	virtual void _update_cache_path(String &r_cache_path);
 
 public:
+	// Changed files are sent as a delta against the copy the client already has.
+	// The client sends signatures of its copy's blocks, the server answers with
+	// block references and literal data (rsync style), compressed on the wire.
+	enum {
+		DELTA_BLOCK_SIZE = 4096,
+	};
+
+	enum DeltaOp {
+		DELTA_OP_COPY, // Block index follows.
+		DELTA_OP_LITERAL, // Length and data follow.
+	};
+
+	struct BlockSignature {
+		uint32_t weak = 0;
+		uint8_t strong[16] = {};
+	};
+
+	static uint32_t delta_weak_checksum(const uint8_t *p_data, uint32_t p_size);
+	static void delta_make_signatures(const uint8_t *p_data, uint64_t p_size, LocalVector<BlockSignature> &r_signatures);
+	static void delta_encode(const uint8_t *p_data, uint64_t p_size, const LocalVector<BlockSignature> &p_signatures, LocalVector<uint8_t> &r_delta);
+	static Error delta_apply(const LocalVector<uint8_t> &p_base, const uint8_t *p_delta, uint64_t p_delta_size, uint64_t p_size, LocalVector<uint8_t> &r_file);
+
 	Error synchronize_with_server(const String &p_host, int p_port, const String &p_password, String &r_cache_path);
 	virtual ~RemoteFilesystemClient() {}
 };
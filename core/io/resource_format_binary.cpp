@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_read_queue.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
@@ -93,11 +94,36 @@ enum {
 	// Version 3: changed nodepath encoding.
 	// Version 4: new string ID for ext/subresources, breaks forward compat.
 	// Version 5: Ability to store script class in the header.
-	FORMAT_VERSION = 5,
+	// Version 6: Numeric packed array payloads are aligned to 16 bytes, breaks forward compat.
+	FORMAT_VERSION = 6,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	FORMAT_VERSION_ALIGNED_ARRAYS = 6,
 };
 
+// Packed array payloads are stored little-endian, matching memory on little-endian hosts.
+static bool can_store_raw(const Ref<FileAccess> &f) {
+#ifdef BIG_ENDIAN_ENABLED
+	return false;
+#else
+	return !f->is_big_endian();
+#endif
+}
+
+// Reads a packed array payload, copying straight from the file mapping when there is one.
+static void get_array_payload(Ref<FileAccess> &f, uint8_t *p_dst, uint64_t p_size) {
+	const uint8_t *mapped = f->get_mapped_buffer();
+	if (mapped) {
+		uint64_t pos = f->get_position();
+		if (pos + p_size <= f->get_length()) {
+			memcpy(p_dst, mapped + pos, p_size);
+			f->seek(pos + p_size);
+			return;
+		}
+	}
+	f->get_buffer(p_dst, p_size);
+}
+
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
@@ -107,11 +133,20 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+void ResourceLoaderBinary::_skip_array_alignment() {
+	if (ver_format < FORMAT_VERSION_ALIGNED_ARRAYS) {
+		return;
+	}
+	uint32_t extra = f->get_32();
+	ERR_FAIL_COND(extra >= 16);
+	f->seek(f->get_position() + extra);
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
+			get_array_payload(f, (uint8_t *)dst, count * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *dst = (uint64_t *)dst;
@@ -131,7 +166,7 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	} else {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
+			get_array_payload(f, (uint8_t *)dst, count * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *dst = (uint32_t *)dst;
@@ -512,7 +547,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<uint8_t> array;
 			array.resize(len);
 			uint8_t *w = array.ptrw();
-			f->get_buffer(w, len);
+			_skip_array_alignment();
+			get_array_payload(f, w, len);
 			_advance_padding(len);
 
 			r_v = array;
@@ -524,7 +560,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
+			_skip_array_alignment();
+			get_array_payload(f, (uint8_t *)w, len * sizeof(int32_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -543,7 +580,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
+			_skip_array_alignment();
+			get_array_payload(f, (uint8_t *)w, len * sizeof(int64_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -562,7 +600,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
+			_skip_array_alignment();
+			get_array_payload(f, (uint8_t *)w, len * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -581,7 +620,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
+			_skip_array_alignment();
+			get_array_payload(f, (uint8_t *)w, len * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -613,6 +653,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			array.resize(len);
 			Vector2 *w = array.ptrw();
 			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+			_skip_array_alignment();
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 2);
 			ERR_FAIL_COND_V(err != OK, err);
 
@@ -626,6 +667,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			array.resize(len);
 			Vector3 *w = array.ptrw();
 			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+			_skip_array_alignment();
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 3);
 			ERR_FAIL_COND_V(err != OK, err);
 
@@ -640,7 +682,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
+			_skip_array_alignment();
+			get_array_payload(f, (uint8_t *)w, len * sizeof(float) * 4);
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -683,6 +726,20 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	}
+
+	if (!use_sub_threads) {
+		// Dependencies are loaded one after another on this thread, so at least have all their files read ahead at once.
+		// Threaded loads prefetch each dependency when they queue it.
+		for (int i = 0; i < external_resources.size(); i++) {
+			if (!ResourceCache::has(external_resources[i].path)) {
+				FileReadQueue::get_singleton()->prefetch(external_resources[i].path, &ResourceLoader::import_remap);
+			}
+		}
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
 		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, ResourceFormatLoader::CACHE_MODE_REUSE);
 		if (!external_resources[i].load_token.is_valid()) {
 			if (!ResourceLoader::get_abort_on_missing_resources()) {
@@ -1530,6 +1587,16 @@ void ResourceFormatSaverBinaryInstance::_pad_buffer(Ref<FileAccess> f, int p_byt
 	}
 }
 
+void ResourceFormatSaverBinaryInstance::_align_array_payload(Ref<FileAccess> f) {
+	// The padding length is stored rather than implied by the position, so the data stays
+	// readable when the file is rewritten at a different offset (see rename_dependencies()).
+	uint32_t extra = (16 - ((f->get_position() + 4) % 16)) % 16;
+	f->store_32(extra);
+	for (uint32_t i = 0; i < extra; i++) {
+		f->store_8(0);
+	}
+}
+
 void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint) {
 	switch (p_property.get_type()) {
 		case Variant::NIL: {
@@ -1837,6 +1904,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<uint8_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const uint8_t *r = arr.ptr();
 			f->store_buffer(r, len);
 			_pad_buffer(f, len);
@@ -1847,9 +1915,14 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int32_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const int32_t *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_32(r[i]);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(int32_t));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_32(r[i]);
+				}
 			}
 
 		} break;
@@ -1858,9 +1931,14 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int64_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const int64_t *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_64(r[i]);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(int64_t));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_64(r[i]);
+				}
 			}
 
 		} break;
@@ -1869,9 +1947,14 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<float> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const float *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_float(r[i]);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(float));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_float(r[i]);
+				}
 			}
 
 		} break;
@@ -1880,9 +1963,14 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<double> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const double *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_double(r[i]);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(double));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_double(r[i]);
+				}
 			}
 
 		} break;
@@ -1902,11 +1990,16 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector3> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const Vector3 *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_real(r[i].x);
-				f->store_real(r[i].y);
-				f->store_real(r[i].z);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(Vector3));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_real(r[i].x);
+					f->store_real(r[i].y);
+					f->store_real(r[i].z);
+				}
 			}
 
 		} break;
@@ -1915,10 +2008,15 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector2> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const Vector2 *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_real(r[i].x);
-				f->store_real(r[i].y);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(Vector2));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_real(r[i].x);
+					f->store_real(r[i].y);
+				}
 			}
 
 		} break;
@@ -1927,12 +2025,17 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Color> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
+			_align_array_payload(f);
 			const Color *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_float(r[i].r);
-				f->store_float(r[i].g);
-				f->store_float(r[i].b);
-				f->store_float(r[i].a);
+			if (can_store_raw(f)) {
+				f->store_buffer((const uint8_t *)r, len * sizeof(Color));
+			} else {
+				for (int i = 0; i < len; i++) {
+					f->store_float(r[i].r);
+					f->store_float(r[i].g);
+					f->store_float(r[i].b);
+					f->store_float(r[i].a);
+				}
 			}
 
 		} break;
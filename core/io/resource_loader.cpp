@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/file_access.h"
+#include "core/io/file_read_queue.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
@@ -188,6 +189,7 @@ void ResourceFormatLoader::_bind_methods() {
 	BIND_ENUM_CONSTANT(CACHE_MODE_IGNORE);
 	BIND_ENUM_CONSTANT(CACHE_MODE_REUSE);
 	BIND_ENUM_CONSTANT(CACHE_MODE_REPLACE);
+	BIND_ENUM_CONSTANT(CACHE_MODE_KEEPALIVE);
 
 	GDVIRTUAL_BIND(_get_recognized_extensions);
 	GDVIRTUAL_BIND(_recognize_path, "path", "type");
@@ -240,6 +242,7 @@ ResourceLoader::LoadToken::~LoadToken() {
 }
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag(Memory::TAG_RESOURCES);
 	load_nesting++;
 	if (load_paths_stack->size()) {
 		thread_load_mutex.lock();
@@ -419,6 +422,7 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	if (token.is_valid()) {
 		thread_load_mutex.lock();
 		token->user_path = p_path;
+		token->keepalive = token->keepalive || p_cache_mode == ResourceFormatLoader::CACHE_MODE_KEEPALIVE;
 		token->reference(); // First request.
 		user_load_tokens[p_path] = token.ptr();
 		print_lt("REQUEST: user load tokens: " + itos(user_load_tokens.size()));
@@ -443,11 +447,18 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	}
 
 	Ref<Resource> res = _load_complete(*load_token.ptr(), r_error);
+	if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_KEEPALIVE && res.is_valid()) {
+		_keep_alive(res);
+	}
 	return res;
 }
 
 Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode) {
 	String local_path = _validate_local_path(p_path);
+	if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_KEEPALIVE) {
+		// Loads the same as CACHE_MODE_REUSE, the caller keeps the result alive once it's complete.
+		p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
+	}
 
 	Ref<LoadToken> load_token;
 	bool must_not_register = false;
@@ -512,6 +523,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
+			// Start reading the file on an I/O thread, so by the time a worker runs the load it's likely cached.
+			FileReadQueue::get_singleton()->prefetch(load_task_ptr->remapped_path, &ResourceLoader::import_remap);
 			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
 		}
 	}
@@ -526,6 +539,101 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	return load_token;
 }
 
+void ResourceLoader::_keep_alive(const Ref<Resource> &p_resource) {
+	const String &path = p_resource->get_path();
+	if (path.is_empty() || path.contains("::")) {
+		return; // Only whole files can be found in the cache again.
+	}
+
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock lock(keepalive_mutex);
+
+		KeepAliveEntry *entry = keepalive_cache.getptr(path);
+		if (entry && entry->resource != p_resource) {
+			// Replaced by a different instance (e.g. loaded again after the path was freed).
+			keepalive_usage -= entry->size;
+			keepalive_usage_by_type[entry->type] -= entry->size;
+			evicted.push_back(entry->resource);
+			keepalive_cache.erase(path);
+			entry = nullptr;
+		}
+		if (!entry) {
+			KeepAliveEntry new_entry;
+			new_entry.resource = p_resource;
+			new_entry.type = p_resource->get_class_name();
+			new_entry.size = MAX(p_resource->get_memory_usage(), (uint64_t)KEEPALIVE_MIN_ENTRY_SIZE);
+			keepalive_usage += new_entry.size;
+			keepalive_usage_by_type[new_entry.type] += new_entry.size;
+			entry = &keepalive_cache.insert(path, new_entry)->value;
+		}
+		entry->last_used = ++keepalive_tick;
+
+		_trim_keepalive_cache(evicted);
+	}
+	// Evicted resources are freed here, outside the lock.
+}
+
+void ResourceLoader::_trim_keepalive_cache(LocalVector<Ref<Resource>> &r_evicted) {
+	if (keepalive_usage <= keepalive_budget) {
+		return;
+	}
+
+	// Only entries the cache holds the last reference to free anything when evicted.
+	LocalVector<Pair<uint64_t, String>> candidates;
+	for (const KeyValue<String, KeepAliveEntry> &E : keepalive_cache) {
+		if (E.value.resource->get_reference_count() == 1) {
+			candidates.push_back(Pair<uint64_t, String>(E.value.last_used, E.key));
+		}
+	}
+	candidates.sort_custom<PairSort<uint64_t, String>>();
+
+	for (uint32_t i = 0; i < candidates.size() && keepalive_usage > keepalive_budget; i++) {
+		KeepAliveEntry &entry = keepalive_cache[candidates[i].second];
+		keepalive_usage -= entry.size;
+		keepalive_usage_by_type[entry.type] -= entry.size;
+		r_evicted.push_back(entry.resource);
+		keepalive_cache.erase(candidates[i].second);
+	}
+}
+
+void ResourceLoader::set_keepalive_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted;
+	MutexLock lock(keepalive_mutex);
+	keepalive_budget = p_bytes;
+	_trim_keepalive_cache(evicted);
+}
+
+uint64_t ResourceLoader::get_keepalive_budget() {
+	MutexLock lock(keepalive_mutex);
+	return keepalive_budget;
+}
+
+uint64_t ResourceLoader::get_keepalive_memory_usage() {
+	MutexLock lock(keepalive_mutex);
+	return keepalive_usage;
+}
+
+void ResourceLoader::get_keepalive_memory_usage_by_type(HashMap<StringName, uint64_t> *r_usage) {
+	MutexLock lock(keepalive_mutex);
+	for (const KeyValue<StringName, uint64_t> &E : keepalive_usage_by_type) {
+		if (E.value) {
+			r_usage->insert(E.key, E.value);
+		}
+	}
+}
+
+void ResourceLoader::clear_keepalive_cache() {
+	HashMap<String, KeepAliveEntry> entries;
+	{
+		MutexLock lock(keepalive_mutex);
+		entries = keepalive_cache;
+		keepalive_cache.clear();
+		keepalive_usage_by_type.clear();
+		keepalive_usage = 0;
+	}
+}
+
 float ResourceLoader::_dependency_get_progress(const String &p_path) {
 	if (thread_load_tasks.has(p_path)) {
 		ThreadLoadTask &load_task = thread_load_tasks[p_path];
@@ -581,6 +689,7 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	}
 
 	Ref<Resource> res;
+	bool keepalive = false;
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
@@ -601,11 +710,16 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 			return Ref<Resource>();
 		}
 		res = _load_complete_inner(*load_token, r_error, thread_load_lock);
+		keepalive = load_token->keepalive;
 		if (load_token->unreference()) {
 			memdelete(load_token);
 		}
 	}
 
+	if (keepalive && res.is_valid()) {
+		_keep_alive(res);
+	}
+
 	print_lt("GET: user load tokens: " + itos(user_load_tokens.size()));
 
 	return res;
@@ -1207,6 +1321,13 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+Mutex ResourceLoader::keepalive_mutex;
+HashMap<String, ResourceLoader::KeepAliveEntry> ResourceLoader::keepalive_cache;
+HashMap<StringName, uint64_t> ResourceLoader::keepalive_usage_by_type;
+uint64_t ResourceLoader::keepalive_budget = 256 * 1024 * 1024;
+uint64_t ResourceLoader::keepalive_usage = 0;
+uint64_t ResourceLoader::keepalive_tick = 0;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 HashMap<String, String> ResourceLoader::path_remaps;
@@ -36,6 +36,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 
 class ConditionVariable;
 
@@ -50,6 +51,7 @@ public:
 		CACHE_MODE_IGNORE, // Resource and subresources do not use path cache, no path is set into resource.
 		CACHE_MODE_REUSE, // Resource and subresources use patch cache, reuse existing loaded resources instead of loading from disk when available.
 		CACHE_MODE_REPLACE, // Resource and subresource use path cache, but replace existing loaded resources when available with information from disk.
+		CACHE_MODE_KEEPALIVE, // Like CACHE_MODE_REUSE, but the resource is also kept in the budgeted keepalive cache after it's no longer referenced. Loaders get CACHE_MODE_REUSE.
 	};
 
 protected:
@@ -120,6 +122,7 @@ public:
 		String local_path;
 		String user_path;
 		Ref<Resource> res_if_unregistered;
+		bool keepalive = false; // Requested with CACHE_MODE_KEEPALIVE.
 
 		void clear();
 
@@ -194,6 +197,30 @@ private:
 
 	static float _dependency_get_progress(const String &p_path);
 
+	// Resources loaded with CACHE_MODE_KEEPALIVE stay referenced here after their last user goes away,
+	// so they can be reused instead of reloaded. Once the estimated size goes over the budget, the least
+	// recently used entries nothing else references are released first.
+	struct KeepAliveEntry {
+		Ref<Resource> resource;
+		StringName type;
+		uint64_t size = 0;
+		uint64_t last_used = 0;
+	};
+
+	enum {
+		KEEPALIVE_MIN_ENTRY_SIZE = 1024, // Charged for resources that don't report their memory usage.
+	};
+
+	static Mutex keepalive_mutex;
+	static HashMap<String, KeepAliveEntry> keepalive_cache;
+	static HashMap<StringName, uint64_t> keepalive_usage_by_type;
+	static uint64_t keepalive_budget;
+	static uint64_t keepalive_usage;
+	static uint64_t keepalive_tick;
+
+	static void _keep_alive(const Ref<Resource> &p_resource);
+	static void _trim_keepalive_cache(LocalVector<Ref<Resource>> &r_evicted);
+
 public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
@@ -204,6 +231,12 @@ public:
 	static Ref<Resource> load(const String &p_path, const String &p_type_hint = "", ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, Error *r_error = nullptr);
 	static bool exists(const String &p_path, const String &p_type_hint = "");
 
+	static void set_keepalive_budget(uint64_t p_bytes);
+	static uint64_t get_keepalive_budget();
+	static uint64_t get_keepalive_memory_usage();
+	static void get_keepalive_memory_usage_by_type(HashMap<StringName, uint64_t> *r_usage);
+	static void clear_keepalive_cache();
+
 	static void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions);
 	static void add_resource_format_loader(Ref<ResourceFormatLoader> p_format_loader, bool p_at_front = false);
 	static void remove_resource_format_loader(Ref<ResourceFormatLoader> p_format_loader);
@@ -110,16 +110,39 @@ private:
 	LocalVector<LocalVector<Point>> points;
 	Point *end = nullptr;
 
+	// One bit per point, set when the point is solid. The jump search tests walkability far more
+	// often than it reads the rest of the point data, so a packed copy stays in cache.
+	LocalVector<uint64_t> solid_mask;
+	uint32_t solid_mask_stride = 0; // In words per row.
+
+	// Kept between searches so repeated queries don't reallocate them.
+	LocalVector<Point *> open_list;
+	LocalVector<Point *> nbors;
+
 	uint64_t pass = 1;
 
 private: // Internal routines.
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return !points[p_y - region.position.y][p_x - region.position.x].solid;
+			const uint32_t x = p_x - region.position.x;
+			const uint32_t y = p_y - region.position.y;
+			return !(solid_mask[y * solid_mask_stride + (x >> 6)] & (uint64_t(1) << (x & 63)));
 		}
 		return false;
 	}
 
+	_FORCE_INLINE_ void _set_solid_unchecked(int32_t p_x, int32_t p_y, bool p_solid) {
+		const uint32_t x = p_x - region.position.x;
+		const uint32_t y = p_y - region.position.y;
+		points[y][x].solid = p_solid;
+		uint64_t &word = solid_mask[y * solid_mask_stride + (x >> 6)];
+		if (p_solid) {
+			word |= uint64_t(1) << (x & 63);
+		} else {
+			word &= ~(uint64_t(1) << (x & 63));
+		}
+	}
+
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
 		if (region.has_point(Vector2i(p_x, p_y))) {
 			return &points[p_y - region.position.y][p_x - region.position.x];
@@ -200,6 +223,7 @@ public:
 	Vector2 get_point_position(const Vector2i &p_id) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to);
+	Array get_id_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids);
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
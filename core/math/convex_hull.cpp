@@ -60,6 +60,7 @@ subject to the following restrictions:
 
 #include "core/error/error_macros.h"
 #include "core/math/aabb.h"
+#include "core/math/math_batch.h"
 #include "core/math/math_defs.h"
 #include "core/os/memory.h"
 #include "core/templates/oa_hash_map.h"
@@ -1575,15 +1576,7 @@ struct PointComparator {
 };
 
 void ConvexHullInternal::compute(const Vector3 *p_coords, int32_t p_count) {
-	AABB aabb;
-	for (int32_t i = 0; i < p_count; i++) {
-		Vector3 p = p_coords[i];
-		if (i == 0) {
-			aabb.position = p;
-		} else {
-			aabb.expand_to(p);
-		}
-	}
+	AABB aabb = MathBatch::compute_aabb(p_coords, p_count);
 
 	Vector3 s = aabb.size;
 	max_axis = s.max_axis_index();
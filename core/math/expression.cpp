@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -672,6 +673,7 @@ Expression::ENode *Expression::_parse_expression() {
 					//function call
 					CallNode *func_call = alloc_node<CallNode>();
 					func_call->method = identifier;
+					func_call->member_cache.set_member(identifier);
 					SelfNode *self_node = alloc_node<SelfNode>();
 					func_call->base = self_node;
 
@@ -723,6 +725,7 @@ Expression::ENode *Expression::_parse_expression() {
 						SelfNode *self_node = alloc_node<SelfNode>();
 						index->base = self_node;
 						index->name = identifier;
+						index->member_cache.set_member(identifier);
 						expr = index;
 					}
 				}
@@ -903,6 +906,7 @@ Expression::ENode *Expression::_parse_expression() {
 						//function call
 						CallNode *func_call = alloc_node<CallNode>();
 						func_call->method = identifier;
+						func_call->member_cache.set_member(identifier);
 						func_call->base = expr;
 
 						while (true) {
@@ -939,6 +943,7 @@ Expression::ENode *Expression::_parse_expression() {
 						NamedIndexNode *index = alloc_node<NamedIndexNode>();
 						index->base = expr;
 						index->name = identifier;
+						index->member_cache.set_member(identifier);
 						expr = index;
 					}
 
@@ -1239,232 +1244,256 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+uint32_t Expression::_compile_node(const ENode *p_node) {
+	Instruction instruction;
+	instruction.node = p_node;
+
 	switch (p_node->type) {
-		case Expression::ENode::TYPE_INPUT: {
-			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
-				return true;
-			}
-			r_ret = p_inputs[in->index];
-		} break;
 		case Expression::ENode::TYPE_CONSTANT: {
-			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
-
-		} break;
+			// Constants are loaded into their register before running, no instruction needed.
+			register_constants.push_back(static_cast<const Expression::ConstantNode *>(p_node)->value);
+			return register_constants.size() - 1;
+		}
+		case Expression::ENode::TYPE_INPUT:
 		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
-			}
-			r_ret = p_instance;
 		} break;
 		case Expression::ENode::TYPE_OPERATOR: {
 			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
-
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant b;
-
+			instruction.operands[0] = _compile_node(op->nodes[0]);
 			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-			}
-
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
+				instruction.operands[1] = _compile_node(op->nodes[1]);
 			}
-
 		} break;
 		case Expression::ENode::TYPE_INDEX: {
 			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant idx;
-
-			ret = _execute(p_inputs, p_instance, index->index, idx, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
-			}
-
+			instruction.operands[0] = _compile_node(index->base);
+			instruction.operands[1] = _compile_node(index->index);
 		} break;
 		case Expression::ENode::TYPE_NAMED_INDEX: {
-			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+			instruction.operands[0] = _compile_node(static_cast<const Expression::NamedIndexNode *>(p_node)->base);
+		} break;
+		case Expression::ENode::TYPE_ARRAY:
+		case Expression::ENode::TYPE_DICTIONARY:
+		case Expression::ENode::TYPE_CONSTRUCTOR:
+		case Expression::ENode::TYPE_BUILTIN_FUNC:
+		case Expression::ENode::TYPE_CALL: {
+			const Vector<ENode *> *arguments = nullptr;
+			switch (p_node->type) {
+				case Expression::ENode::TYPE_ARRAY:
+					arguments = &static_cast<const Expression::ArrayNode *>(p_node)->array;
+					break;
+				case Expression::ENode::TYPE_DICTIONARY:
+					arguments = &static_cast<const Expression::DictionaryNode *>(p_node)->dict;
+					break;
+				case Expression::ENode::TYPE_CONSTRUCTOR:
+					arguments = &static_cast<const Expression::ConstructorNode *>(p_node)->arguments;
+					break;
+				case Expression::ENode::TYPE_BUILTIN_FUNC:
+					arguments = &static_cast<const Expression::BuiltinFuncNode *>(p_node)->arguments;
+					break;
+				default: {
+					const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+					instruction.operands[0] = _compile_node(call->base);
+					arguments = &call->arguments;
+				} break;
 			}
 
-			bool valid;
-			r_ret = base.get_named(index->name, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
+			// Arguments may contain calls with arguments of their own, so compile them before reserving the range.
+			LocalVector<uint32_t> argument_list;
+			argument_list.resize(arguments->size());
+			for (int i = 0; i < arguments->size(); i++) {
+				argument_list[i] = _compile_node((*arguments)[i]);
 			}
-
-		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
-
-			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr[i] = value;
+			instruction.argument_offset = argument_registers.size();
+			instruction.argument_count = argument_list.size();
+			for (uint32_t argument : argument_list) {
+				argument_registers.push_back(argument);
 			}
-
-			r_ret = arr;
-
 		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
+	}
 
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, p_const_calls_only, r_error_str);
+	register_constants.push_back(Variant());
+	instruction.dst = register_constants.size() - 1;
+	instructions.push_back(instruction);
+	return instruction.dst;
+}
 
-				if (ret) {
-					return true;
-				}
+void Expression::_compile() {
+	instructions.clear();
+	argument_registers.clear();
+	register_constants.clear();
+	register_constants.push_back(Variant()); // The null register.
+	result_register = 0;
 
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-
-				d[key] = value;
-			}
+	if (root) {
+		result_register = _compile_node(root);
+	}
+}
 
-			r_ret = d;
-		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
+bool Expression::_execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+	// Registers live on the stack, so the same expression can be executed recursively (e.g. from a call it makes).
+	const uint32_t register_count = register_constants.size();
+	Variant *registers = (Variant *)alloca(sizeof(Variant) * register_count);
+	for (uint32_t i = 0; i < register_count; i++) {
+		memnew_placement(&registers[i], Variant(register_constants[i]));
+	}
+	const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * MAX(argument_registers.size(), 1u));
+	for (uint32_t i = 0; i < argument_registers.size(); i++) {
+		argptrs[i] = &registers[argument_registers[i]];
+	}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
+	bool failed = false;
 
-			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, p_const_calls_only, r_error_str);
+	for (Instruction &instruction : instructions) {
+		Variant &dst = registers[instruction.dst];
+		const Variant **args = argptrs + instruction.argument_offset;
+		const int argcount = instruction.argument_count;
 
-				if (ret) {
-					return true;
+		switch (instruction.node->type) {
+			case Expression::ENode::TYPE_INPUT: {
+				const Expression::InputNode *in = static_cast<const Expression::InputNode *>(instruction.node);
+				if (in->index < 0 || in->index >= p_inputs.size()) {
+					r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
+					failed = true;
+					break;
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
-
-			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
-			}
-
-		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
-
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
-
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
+				dst = p_inputs[in->index];
+			} break;
+			case Expression::ENode::TYPE_CONSTANT: {
+				// Preloaded.
+			} break;
+			case Expression::ENode::TYPE_SELF: {
+				if (!p_instance) {
+					r_error_str = RTR("self can't be used because instance is null (not passed)");
+					failed = true;
+					break;
+				}
+				dst = p_instance;
+			} break;
+			case Expression::ENode::TYPE_OPERATOR: {
+				const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(instruction.node);
+				const Variant &a = registers[instruction.operands[0]];
+				const Variant &b = registers[instruction.operands[1]];
+
+				if (a.get_type() != instruction.evaluator_types[0] || b.get_type() != instruction.evaluator_types[1]) {
+					instruction.evaluator_types[0] = a.get_type();
+					instruction.evaluator_types[1] = b.get_type();
+					instruction.evaluator = Variant::get_validated_operator_evaluator(op->op, a.get_type(), b.get_type());
+					instruction.evaluator_return_type = Variant::get_operator_return_type(op->op, a.get_type(), b.get_type());
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
-
-			r_ret = Variant(); //may not return anything
-			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
-				return true;
-			}
-
-		} break;
-		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
 
-			if (ret) {
-				return true;
-			}
+				if (instruction.evaluator) {
+					if (dst.get_type() != instruction.evaluator_return_type) {
+						VariantInternal::initialize(&dst, instruction.evaluator_return_type);
+					}
+					instruction.evaluator(&a, &b, &dst);
+				} else {
+					bool valid = true;
+					Variant::evaluate(op->op, a, b, dst, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
+						failed = true;
+					}
+				}
+			} break;
+			case Expression::ENode::TYPE_INDEX: {
+				const Variant &base = registers[instruction.operands[0]];
+				const Variant &idx = registers[instruction.operands[1]];
+
+				bool valid;
+				dst = base.get(idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
+					failed = true;
+				}
+			} break;
+			case Expression::ENode::TYPE_NAMED_INDEX: {
+				const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(instruction.node);
+				const Variant &base = registers[instruction.operands[0]];
+
+				bool valid;
+				Object *base_obj = base.get_validated_object();
+				if (base_obj) {
+					dst = index->member_cache.get(base_obj, &valid);
+				} else {
+					dst = base.get_named(index->name, valid);
+				}
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
+					failed = true;
+				}
+			} break;
+			case Expression::ENode::TYPE_ARRAY: {
+				Array arr;
+				arr.resize(argcount);
+				for (int i = 0; i < argcount; i++) {
+					arr[i] = *args[i];
+				}
+				dst = arr;
+			} break;
+			case Expression::ENode::TYPE_DICTIONARY: {
+				Dictionary d;
+				for (int i = 0; i < argcount; i += 2) {
+					d[*args[i + 0]] = *args[i + 1];
+				}
+				dst = d;
+			} break;
+			case Expression::ENode::TYPE_CONSTRUCTOR: {
+				const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(instruction.node);
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+				Callable::CallError ce;
+				Variant::construct(constructor->data_type, dst, args, argcount, ce);
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, p_const_calls_only, r_error_str);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
+					failed = true;
+				}
+			} break;
+			case Expression::ENode::TYPE_BUILTIN_FUNC: {
+				const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(instruction.node);
+
+				Callable::CallError ce;
+				Variant::call_utility_function(bifunc->func, &dst, args, argcount, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, args, argcount, ce);
+					failed = true;
+				}
+			} break;
+			case Expression::ENode::TYPE_CALL: {
+				const Expression::CallNode *call = static_cast<const Expression::CallNode *>(instruction.node);
+				Variant &base = registers[instruction.operands[0]];
 
-				if (ret) {
-					return true;
+				Callable::CallError ce;
+				if (p_const_calls_only) {
+					base.call_const(call->method, args, argcount, dst, ce);
+				} else {
+					Object *base_obj = base.get_validated_object();
+					if (base_obj) {
+						dst = call->member_cache.call(base_obj, args, argcount, ce);
+					} else {
+						base.callp(call->method, args, argcount, dst, ce);
+					}
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
 
-			Callable::CallError ce;
-			if (p_const_calls_only) {
-				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			} else {
-				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			}
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
+					failed = true;
+				}
+			} break;
+		}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+		if (failed) {
+			break;
+		}
+	}
 
-		} break;
+	if (!failed) {
+		r_ret = registers[result_register];
 	}
-	return false;
+	for (uint32_t i = 0; i < register_count; i++) {
+		registers[i].~Variant();
+	}
+	return failed;
 }
 
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
@@ -1488,9 +1517,11 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 			memdelete(nodes);
 		}
 		nodes = nullptr;
+		_compile();
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile();
 	return OK;
 }
 
@@ -1500,7 +1531,7 @@ Variant Expression::execute(const Array &p_inputs, Object *p_base, bool p_show_e
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	bool err = _execute(p_inputs, p_base, output, p_const_calls_only, error_txt);
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
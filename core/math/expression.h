@@ -31,6 +31,7 @@
 #ifndef EXPRESSION_H
 #define EXPRESSION_H
 
+#include "core/object/object_member_cache.h"
 #include "core/object/ref_counted.h"
 
 class Expression : public RefCounted {
@@ -196,6 +197,7 @@ private:
 	struct NamedIndexNode : public ENode {
 		ENode *base = nullptr;
 		StringName name;
+		mutable ObjectMemberCache member_cache;
 
 		NamedIndexNode() {
 			type = TYPE_NAMED_INDEX;
@@ -215,6 +217,7 @@ private:
 		ENode *base = nullptr;
 		StringName method;
 		Vector<ENode *> arguments;
+		mutable ObjectMemberCache member_cache;
 
 		CallNode() {
 			type = TYPE_CALL;
@@ -254,10 +257,34 @@ private:
 	ENode *root = nullptr;
 	ENode *nodes = nullptr;
 
+	// The node tree is flattened after parsing into instructions that read and write
+	// registers, so execution doesn't recurse or allocate argument arrays. Every node
+	// gets its own register, register 0 is always null.
+	struct Instruction {
+		const ENode *node = nullptr;
+		uint32_t dst = 0;
+		uint32_t operands[2] = { 0, 0 };
+		uint32_t argument_offset = 0; // Into argument_registers.
+		uint32_t argument_count = 0;
+
+		// Operators resolve a validated evaluator for the operand types of the previous run.
+		Variant::Type evaluator_types[2] = { Variant::VARIANT_MAX, Variant::VARIANT_MAX };
+		Variant::Type evaluator_return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator evaluator = nullptr;
+	};
+
+	LocalVector<Instruction> instructions;
+	LocalVector<uint32_t> argument_registers;
+	LocalVector<Variant> register_constants; // Initial register values, only constants aren't null.
+	uint32_t result_register = 0;
+
+	uint32_t _compile_node(const ENode *p_node);
+	void _compile();
+
 	Vector<String> input_names;
 
 	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+	bool _execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -0,0 +1,169 @@
+/**************************************************************************/
+/*  math_batch.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "math_batch.h"
+
+#include "core/math/aabb.h"
+#include "core/math/rect2.h"
+#include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
+
+void MathBatch::transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, int p_count) {
+	const Basis &b = p_transform.basis;
+	const real_t xx = b.rows[0][0], xy = b.rows[0][1], xz = b.rows[0][2];
+	const real_t yx = b.rows[1][0], yy = b.rows[1][1], yz = b.rows[1][2];
+	const real_t zx = b.rows[2][0], zy = b.rows[2][1], zz = b.rows[2][2];
+	const real_t ox = p_transform.origin.x, oy = p_transform.origin.y, oz = p_transform.origin.z;
+
+	for (int i = 0; i < p_count; i++) {
+		const real_t x = p_src[i].x, y = p_src[i].y, z = p_src[i].z;
+		r_dst[i].x = xx * x + xy * y + xz * z + ox;
+		r_dst[i].y = yx * x + yy * y + yz * z + oy;
+		r_dst[i].z = zx * x + zy * y + zz * z + oz;
+	}
+}
+
+void MathBatch::transform_points_inv(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, int p_count) {
+	const Basis &b = p_transform.basis;
+	const real_t xx = b.rows[0][0], xy = b.rows[0][1], xz = b.rows[0][2];
+	const real_t yx = b.rows[1][0], yy = b.rows[1][1], yz = b.rows[1][2];
+	const real_t zx = b.rows[2][0], zy = b.rows[2][1], zz = b.rows[2][2];
+	const real_t ox = p_transform.origin.x, oy = p_transform.origin.y, oz = p_transform.origin.z;
+
+	for (int i = 0; i < p_count; i++) {
+		const real_t x = p_src[i].x - ox, y = p_src[i].y - oy, z = p_src[i].z - oz;
+		r_dst[i].x = xx * x + yx * y + zx * z;
+		r_dst[i].y = xy * x + yy * y + zy * z;
+		r_dst[i].z = xz * x + yz * y + zz * z;
+	}
+}
+
+void MathBatch::transform_vectors(const Basis &p_basis, const Vector3 *p_src, Vector3 *r_dst, int p_count) {
+	const real_t xx = p_basis.rows[0][0], xy = p_basis.rows[0][1], xz = p_basis.rows[0][2];
+	const real_t yx = p_basis.rows[1][0], yy = p_basis.rows[1][1], yz = p_basis.rows[1][2];
+	const real_t zx = p_basis.rows[2][0], zy = p_basis.rows[2][1], zz = p_basis.rows[2][2];
+
+	for (int i = 0; i < p_count; i++) {
+		const real_t x = p_src[i].x, y = p_src[i].y, z = p_src[i].z;
+		r_dst[i].x = xx * x + xy * y + xz * z;
+		r_dst[i].y = yx * x + yy * y + yz * z;
+		r_dst[i].z = zx * x + zy * y + zz * z;
+	}
+}
+
+void MathBatch::transform_points_2d(const Transform2D &p_transform, const Vector2 *p_src, Vector2 *r_dst, int p_count) {
+	const real_t xx = p_transform.columns[0].x, xy = p_transform.columns[0].y;
+	const real_t yx = p_transform.columns[1].x, yy = p_transform.columns[1].y;
+	const real_t ox = p_transform.columns[2].x, oy = p_transform.columns[2].y;
+
+	for (int i = 0; i < p_count; i++) {
+		const real_t x = p_src[i].x, y = p_src[i].y;
+		r_dst[i].x = xx * x + yx * y + ox;
+		r_dst[i].y = xy * x + yy * y + oy;
+	}
+}
+
+void MathBatch::transform_points_2d_inv(const Transform2D &p_transform, const Vector2 *p_src, Vector2 *r_dst, int p_count) {
+	const real_t xx = p_transform.columns[0].x, xy = p_transform.columns[0].y;
+	const real_t yx = p_transform.columns[1].x, yy = p_transform.columns[1].y;
+	const real_t ox = p_transform.columns[2].x, oy = p_transform.columns[2].y;
+
+	for (int i = 0; i < p_count; i++) {
+		const real_t x = p_src[i].x - ox, y = p_src[i].y - oy;
+		r_dst[i].x = xx * x + xy * y;
+		r_dst[i].y = yx * x + yy * y;
+	}
+}
+
+void MathBatch::basis_multiply(const Basis &p_basis, const Basis *p_src, Basis *r_dst, int p_count) {
+	const Basis b = p_basis; // In case it is part of the destination.
+	for (int i = 0; i < p_count; i++) {
+		const Basis m = p_src[i];
+		for (int r = 0; r < 3; r++) {
+			r_dst[i].rows[r][0] = b.rows[r][0] * m.rows[0][0] + b.rows[r][1] * m.rows[1][0] + b.rows[r][2] * m.rows[2][0];
+			r_dst[i].rows[r][1] = b.rows[r][0] * m.rows[0][1] + b.rows[r][1] * m.rows[1][1] + b.rows[r][2] * m.rows[2][1];
+			r_dst[i].rows[r][2] = b.rows[r][0] * m.rows[0][2] + b.rows[r][1] * m.rows[1][2] + b.rows[r][2] * m.rows[2][2];
+		}
+	}
+}
+
+void MathBatch::dot(const Vector3 *p_a, const Vector3 *p_b, real_t *r_dst, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		r_dst[i] = p_a[i].x * p_b[i].x + p_a[i].y * p_b[i].y + p_a[i].z * p_b[i].z;
+	}
+}
+
+void MathBatch::cross(const Vector3 *p_a, const Vector3 *p_b, Vector3 *r_dst, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		const Vector3 a = p_a[i];
+		const Vector3 b = p_b[i];
+		r_dst[i].x = a.y * b.z - a.z * b.y;
+		r_dst[i].y = a.z * b.x - a.x * b.z;
+		r_dst[i].z = a.x * b.y - a.y * b.x;
+	}
+}
+
+AABB MathBatch::compute_aabb(const Vector3 *p_points, int p_count) {
+	if (p_count <= 0) {
+		return AABB();
+	}
+
+	real_t min_x = p_points[0].x, min_y = p_points[0].y, min_z = p_points[0].z;
+	real_t max_x = min_x, max_y = min_y, max_z = min_z;
+	for (int i = 1; i < p_count; i++) {
+		const Vector3 &p = p_points[i];
+		min_x = p.x < min_x ? p.x : min_x;
+		min_y = p.y < min_y ? p.y : min_y;
+		min_z = p.z < min_z ? p.z : min_z;
+		max_x = p.x > max_x ? p.x : max_x;
+		max_y = p.y > max_y ? p.y : max_y;
+		max_z = p.z > max_z ? p.z : max_z;
+	}
+
+	return AABB(Vector3(min_x, min_y, min_z), Vector3(max_x - min_x, max_y - min_y, max_z - min_z));
+}
+
+Rect2 MathBatch::compute_rect(const Vector2 *p_points, int p_count) {
+	if (p_count <= 0) {
+		return Rect2();
+	}
+
+	real_t min_x = p_points[0].x, min_y = p_points[0].y;
+	real_t max_x = min_x, max_y = min_y;
+	for (int i = 1; i < p_count; i++) {
+		const Vector2 &p = p_points[i];
+		min_x = p.x < min_x ? p.x : min_x;
+		min_y = p.y < min_y ? p.y : min_y;
+		max_x = p.x > max_x ? p.x : max_x;
+		max_y = p.y > max_y ? p.y : max_y;
+	}
+
+	return Rect2(min_x, min_y, max_x - min_x, max_y - min_y);
+}
@@ -0,0 +1,67 @@
+/**************************************************************************/
+/*  math_batch.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef MATH_BATCH_H
+#define MATH_BATCH_H
+
+#include "core/math/math_defs.h"
+
+struct AABB;
+struct Basis;
+struct Rect2;
+struct Transform2D;
+struct Transform3D;
+struct Vector2;
+struct Vector3;
+
+// Kernels that process whole arrays of math types at once.
+// The loops only read each element once, keep the matrix in locals and have no
+// branches, so the compiler can vectorize them for the target's instruction set.
+// Unless stated otherwise, source and destination may be the same array.
+class MathBatch {
+public:
+	static void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, int p_count);
+	// Same as Transform3D::xform_inv(), which assumes an orthonormal basis.
+	static void transform_points_inv(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, int p_count);
+	static void transform_vectors(const Basis &p_basis, const Vector3 *p_src, Vector3 *r_dst, int p_count);
+	static void transform_points_2d(const Transform2D &p_transform, const Vector2 *p_src, Vector2 *r_dst, int p_count);
+	static void transform_points_2d_inv(const Transform2D &p_transform, const Vector2 *p_src, Vector2 *r_dst, int p_count);
+
+	static void basis_multiply(const Basis &p_basis, const Basis *p_src, Basis *r_dst, int p_count);
+
+	static void dot(const Vector3 *p_a, const Vector3 *p_b, real_t *r_dst, int p_count);
+	static void cross(const Vector3 *p_a, const Vector3 *p_b, Vector3 *r_dst, int p_count);
+
+	// Smallest box containing all points, or an empty one if there are none.
+	static AABB compute_aabb(const Vector3 *p_points, int p_count);
+	static Rect2 compute_rect(const Vector2 *p_points, int p_count);
+};
+
+#endif // MATH_BATCH_H
@@ -179,3 +179,158 @@ float Math::random(float from, float to) {
 int Math::random(int from, int to) {
 	return default_rand.random(from, to);
 }
+
+// The deterministic functions below use the polynomial approximations of FreeBSD's msun (fdlibm),
+// evaluated in double precision with basic operations only.
+
+// Reduces p_x to [-pi/4, pi/4] and returns which quarter turn it was in.
+static double _deterministic_reduce_half_pi(double p_x, int &r_quadrant) {
+	if (p_x > 1.0e5 || p_x < -1.0e5) {
+		// Keep the multiple of pi/2 small. fmod() is exact, so it gives the same result everywhere.
+		p_x = ::fmod(p_x, Math_TAU);
+	}
+
+	// pi/2 split in three parts, so the products with small multiples are exact.
+	double n = Math::floor(p_x * 6.36619772367581382433e-01 + 0.5);
+	double r = p_x - n * 1.57079632673412561417e+00;
+	r -= n * 6.07710050630396597660e-11;
+	r -= n * 2.02226624871116645580e-21;
+
+	r_quadrant = ((int)n) & 3;
+	return r;
+}
+
+static _FORCE_INLINE_ double _deterministic_kernel_sin(double p_x) {
+	double z = p_x * p_x;
+	return p_x + p_x * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+}
+
+static _FORCE_INLINE_ double _deterministic_kernel_cos(double p_x) {
+	double z = p_x * p_x;
+	return 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+}
+
+double Math::deterministic_sin(double p_x) {
+	if (is_nan(p_x) || is_inf(p_x)) {
+		return p_x - p_x;
+	}
+
+	int quadrant;
+	double r = _deterministic_reduce_half_pi(p_x, quadrant);
+	switch (quadrant) {
+		case 0:
+			return _deterministic_kernel_sin(r);
+		case 1:
+			return _deterministic_kernel_cos(r);
+		case 2:
+			return -_deterministic_kernel_sin(r);
+		default:
+			return -_deterministic_kernel_cos(r);
+	}
+}
+
+double Math::deterministic_cos(double p_x) {
+	if (is_nan(p_x) || is_inf(p_x)) {
+		return p_x - p_x;
+	}
+
+	int quadrant;
+	double r = _deterministic_reduce_half_pi(p_x, quadrant);
+	switch (quadrant) {
+		case 0:
+			return _deterministic_kernel_cos(r);
+		case 1:
+			return -_deterministic_kernel_sin(r);
+		case 2:
+			return -_deterministic_kernel_cos(r);
+		default:
+			return _deterministic_kernel_sin(r);
+	}
+}
+
+double Math::deterministic_tan(double p_x) {
+	if (is_nan(p_x) || is_inf(p_x)) {
+		return p_x - p_x;
+	}
+
+	int quadrant;
+	double r = _deterministic_reduce_half_pi(p_x, quadrant);
+	if (quadrant & 1) {
+		return -_deterministic_kernel_cos(r) / _deterministic_kernel_sin(r);
+	}
+	return _deterministic_kernel_sin(r) / _deterministic_kernel_cos(r);
+}
+
+double Math::deterministic_asin(double p_x) {
+	return deterministic_atan2(p_x, ::sqrt((1.0 - p_x) * (1.0 + p_x)));
+}
+
+double Math::deterministic_acos(double p_x) {
+	return deterministic_atan2(::sqrt((1.0 - p_x) * (1.0 + p_x)), p_x);
+}
+
+double Math::deterministic_atan(double p_x) {
+	static const double atan_hi[] = { 4.63647609000806093515e-01, 7.85398163397448278999e-01, 9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+	static const double atan_lo[] = { 2.26987774529616870924e-17, 3.06161699786838301793e-17, 1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+
+	if (is_nan(p_x)) {
+		return p_x;
+	}
+
+	double x = ::fabs(p_x);
+	int id;
+	if (x < 0.4375) {
+		id = -1;
+	} else if (x < 0.6875) {
+		id = 0;
+		x = (2.0 * x - 1.0) / (2.0 + x);
+	} else if (x < 1.1875) {
+		id = 1;
+		x = (x - 1.0) / (x + 1.0);
+	} else if (x < 2.4375) {
+		id = 2;
+		x = (x - 1.5) / (1.0 + 1.5 * x);
+	} else {
+		id = 3;
+		x = -1.0 / x;
+	}
+
+	double z = x * x;
+	double w = z * z;
+	double s1 = z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02 + w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))));
+	double s2 = w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01 + w * (-7.69187620504482999495e-02 + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))));
+
+	if (id < 0) {
+		return p_x - p_x * (s1 + s2);
+	}
+
+	double result = atan_hi[id] - ((x * (s1 + s2) - atan_lo[id]) - x);
+	return p_x < 0.0 ? -result : result;
+}
+
+double Math::deterministic_atan2(double p_y, double p_x) {
+	if (is_nan(p_x) || is_nan(p_y)) {
+		return p_x + p_y;
+	}
+
+	bool y_negative = signbit(p_y);
+	if (p_y == 0.0) {
+		if (signbit(p_x)) {
+			return y_negative ? -Math_PI : Math_PI;
+		}
+		return p_y;
+	}
+	if (p_x == 0.0) {
+		return y_negative ? -Math_PI * 0.5 : Math_PI * 0.5;
+	}
+	if (is_inf(p_x) && is_inf(p_y)) {
+		double result = p_x > 0.0 ? Math_PI * 0.25 : Math_PI * 0.75;
+		return y_negative ? -result : result;
+	}
+
+	double result = deterministic_atan(p_y / p_x);
+	if (p_x > 0.0) {
+		return result;
+	}
+	return y_negative ? result - Math_PI : result + Math_PI;
+}
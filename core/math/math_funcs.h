@@ -50,6 +50,28 @@ public:
 	// Not using 'RANDOM_MAX' to avoid conflict with system headers on some OSes (at least NetBSD).
 	static const uint64_t RANDOM_32BIT_MAX = 0xFFFFFFFF;
 
+	// Portable trigonometric functions built only from basic IEEE 754 operations. Unlike the C library
+	// ones, they give bit-identical results on every CPU and platform, as long as the compiler doesn't
+	// contract operations into FMA (see the `deterministic_math` build option, which also makes the
+	// functions below use them).
+	static double deterministic_sin(double p_x);
+	static double deterministic_cos(double p_x);
+	static double deterministic_tan(double p_x);
+	static double deterministic_asin(double p_x);
+	static double deterministic_acos(double p_x);
+	static double deterministic_atan(double p_x);
+	static double deterministic_atan2(double p_y, double p_x);
+
+#ifdef DETERMINISTIC_MATH_ENABLED
+	static _ALWAYS_INLINE_ double sin(double p_x) { return deterministic_sin(p_x); }
+	static _ALWAYS_INLINE_ float sin(float p_x) { return (float)deterministic_sin(p_x); }
+
+	static _ALWAYS_INLINE_ double cos(double p_x) { return deterministic_cos(p_x); }
+	static _ALWAYS_INLINE_ float cos(float p_x) { return (float)deterministic_cos(p_x); }
+
+	static _ALWAYS_INLINE_ double tan(double p_x) { return deterministic_tan(p_x); }
+	static _ALWAYS_INLINE_ float tan(float p_x) { return (float)deterministic_tan(p_x); }
+#else
 	static _ALWAYS_INLINE_ double sin(double p_x) { return ::sin(p_x); }
 	static _ALWAYS_INLINE_ float sin(float p_x) { return ::sinf(p_x); }
 
@@ -58,6 +80,7 @@ public:
 
 	static _ALWAYS_INLINE_ double tan(double p_x) { return ::tan(p_x); }
 	static _ALWAYS_INLINE_ float tan(float p_x) { return ::tanf(p_x); }
+#endif
 
 	static _ALWAYS_INLINE_ double sinh(double p_x) { return ::sinh(p_x); }
 	static _ALWAYS_INLINE_ float sinh(float p_x) { return ::sinhf(p_x); }
@@ -74,6 +97,21 @@ public:
 	static _ALWAYS_INLINE_ double tanh(double p_x) { return ::tanh(p_x); }
 	static _ALWAYS_INLINE_ float tanh(float p_x) { return ::tanhf(p_x); }
 
+#ifdef DETERMINISTIC_MATH_ENABLED
+	// Always does clamping so always safe to use.
+	static _ALWAYS_INLINE_ double asin(double p_x) { return p_x < -1 ? (-Math_PI / 2) : (p_x > 1 ? (Math_PI / 2) : deterministic_asin(p_x)); }
+	static _ALWAYS_INLINE_ float asin(float p_x) { return p_x < -1 ? (-Math_PI / 2) : (p_x > 1 ? (Math_PI / 2) : (float)deterministic_asin(p_x)); }
+
+	// Always does clamping so always safe to use.
+	static _ALWAYS_INLINE_ double acos(double p_x) { return p_x < -1 ? Math_PI : (p_x > 1 ? 0 : deterministic_acos(p_x)); }
+	static _ALWAYS_INLINE_ float acos(float p_x) { return p_x < -1 ? Math_PI : (p_x > 1 ? 0 : (float)deterministic_acos(p_x)); }
+
+	static _ALWAYS_INLINE_ double atan(double p_x) { return deterministic_atan(p_x); }
+	static _ALWAYS_INLINE_ float atan(float p_x) { return (float)deterministic_atan(p_x); }
+
+	static _ALWAYS_INLINE_ double atan2(double p_y, double p_x) { return deterministic_atan2(p_y, p_x); }
+	static _ALWAYS_INLINE_ float atan2(float p_y, float p_x) { return (float)deterministic_atan2(p_y, p_x); }
+#else
 	// Always does clamping so always safe to use.
 	static _ALWAYS_INLINE_ double asin(double p_x) { return p_x < -1 ? (-Math_PI / 2) : (p_x > 1 ? (Math_PI / 2) : ::asin(p_x)); }
 	static _ALWAYS_INLINE_ float asin(float p_x) { return p_x < -1 ? (-Math_PI / 2) : (p_x > 1 ? (Math_PI / 2) : ::asinf(p_x)); }
@@ -87,6 +125,7 @@ public:
 
 	static _ALWAYS_INLINE_ double atan2(double p_y, double p_x) { return ::atan2(p_y, p_x); }
 	static _ALWAYS_INLINE_ float atan2(float p_y, float p_x) { return ::atan2f(p_y, p_x); }
+#endif
 
 	static _ALWAYS_INLINE_ double asinh(double p_x) { return ::asinh(p_x); }
 	static _ALWAYS_INLINE_ float asinh(float p_x) { return ::asinhf(p_x); }
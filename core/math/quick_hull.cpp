@@ -30,6 +30,7 @@
 
 #include "quick_hull.h"
 
+#include "core/math/math_batch.h"
 #include "core/templates/rb_map.h"
 
 uint32_t QuickHull::debug_stop_after = 0xFFFFFFFF;
@@ -37,14 +38,7 @@ uint32_t QuickHull::debug_stop_after = 0xFFFFFFFF;
 Error QuickHull::build(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_mesh) {
 	/* CREATE AABB VOLUME */
 
-	AABB aabb;
-	for (int i = 0; i < p_points.size(); i++) {
-		if (i == 0) {
-			aabb.position = p_points[i];
-		} else {
-			aabb.expand_to(p_points[i]);
-		}
-	}
+	AABB aabb = MathBatch::compute_aabb(p_points.ptr(), p_points.size());
 
 	if (aabb.size == Vector3()) {
 		return ERR_CANT_CREATE;
@@ -38,7 +38,10 @@
 #include "core/version.h"
 
 #define OBJTYPE_RLOCK RWLockRead _rw_lockr_(lock);
-#define OBJTYPE_WLOCK RWLockWrite _rw_lockw_(lock);
+// Writers unpublish the frozen registry, as they may modify the classes it points to.
+#define OBJTYPE_WLOCK             \
+	RWLockWrite _rw_lockw_(lock); \
+	_unfreeze_registry();
 
 #ifdef DEBUG_METHODS_ENABLED
 
@@ -69,6 +72,9 @@ ClassDB::APIType ClassDB::get_current_api() {
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
+SafeNumeric<uint32_t> ClassDB::member_version;
+SafeNumeric<ClassDB::FrozenRegistry *> ClassDB::frozen_registry;
+LocalVector<ClassDB::FrozenRegistry *> ClassDB::retired_registries;
 
 #ifdef TOOLS_ENABLED
 HashMap<StringName, ObjectGDExtension> ClassDB::placeholder_extensions;
@@ -220,6 +226,18 @@ bool ClassDB::_is_parent_class(const StringName &p_class, const StringName &p_in
 }
 
 bool ClassDB::is_parent_class(const StringName &p_class, const StringName &p_inherits) {
+	const FrozenRegistry *frozen = frozen_registry.get();
+	if (likely(frozen)) {
+		const ClassInfo *check = frozen->get_class_info(p_class);
+		while (check) {
+			if (check->name == p_inherits) {
+				return true;
+			}
+			check = check->inherits_ptr;
+		}
+		return false;
+	}
+
 	OBJTYPE_RLOCK;
 
 	return _is_parent_class(p_class, p_inherits);
@@ -299,6 +317,13 @@ StringName ClassDB::_get_parent_class(const StringName &p_class) {
 }
 
 StringName ClassDB::get_parent_class(const StringName &p_class) {
+	const FrozenRegistry *frozen = frozen_registry.get();
+	if (likely(frozen)) {
+		const ClassInfo *ti = frozen->get_class_info(p_class);
+		ERR_FAIL_NULL_V_MSG(ti, StringName(), "Cannot get class '" + String(p_class) + "'.");
+		return ti->inherits;
+	}
+
 	OBJTYPE_RLOCK;
 
 	return _get_parent_class(p_class);
@@ -463,6 +488,11 @@ uint32_t ClassDB::get_api_hash(APIType p_api) {
 }
 
 bool ClassDB::class_exists(const StringName &p_class) {
+	const FrozenRegistry *frozen = frozen_registry.get();
+	if (likely(frozen)) {
+		return frozen->get_class_info(p_class) != nullptr;
+	}
+
 	OBJTYPE_RLOCK;
 	return classes.has(p_class);
 }
@@ -878,6 +908,19 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	const FrozenRegistry *frozen = frozen_registry.get();
+	if (likely(frozen)) {
+		const ClassInfo *type = frozen->get_class_info(p_class);
+		while (type) {
+			MethodBind *const *method = type->method_map.getptr(p_name);
+			if (method && *method) {
+				return *method;
+			}
+			type = type->inherits_ptr;
+		}
+		return nullptr;
+	}
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -1298,6 +1341,8 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	ClassInfo *type = classes.getptr(p_class);
 	lock.read_unlock();
 
+	_unfreeze_registry();
+
 	ERR_FAIL_NULL(type);
 
 	MethodBind *mb_set = nullptr;
@@ -1445,7 +1490,8 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	const FrozenRegistry *frozen = frozen_registry.get();
+	ClassInfo *type = frozen ? frozen->get_class_info(p_object->get_class_name()) : classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1494,7 +1540,8 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	const FrozenRegistry *frozen = frozen_registry.get();
+	ClassInfo *type = frozen ? frozen->get_class_info(p_object->get_class_name()) : classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1548,6 +1595,39 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 	return false;
 }
 
+bool ClassDB::_get_property_accessors(const ClassInfo *p_class_info, const StringName &p_property, MethodBind **r_setter, MethodBind **r_getter, int *r_index) {
+	// Same lookup order as set_property() and get_property(), but only reports accessors bound to a MethodBind.
+	const ClassInfo *check = p_class_info;
+	bool getter_shadowed = false;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			*r_setter = psg->setter ? psg->_setptr : nullptr;
+			*r_getter = psg->getter && !getter_shadowed ? psg->_getptr : nullptr;
+			*r_index = psg->index;
+			return true;
+		}
+
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			getter_shadowed = true;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return false;
+}
+
+bool ClassDB::get_property_accessors(const StringName &p_class, const StringName &p_property, MethodBind **r_setter, MethodBind **r_getter, int *r_index) {
+	const FrozenRegistry *frozen = frozen_registry.get();
+	if (likely(frozen)) {
+		return _get_property_accessors(frozen->get_class_info(p_class), p_property, r_setter, r_getter, r_index);
+	}
+
+	OBJTYPE_RLOCK;
+	return _get_property_accessors(classes.getptr(p_class), p_property, r_setter, r_getter, r_index);
+}
+
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1708,6 +1788,8 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 	bind->set_name(p_name);
 	bind->set_default_arguments(p_default_args);
 
+	_unfreeze_registry();
+
 	String instance_type = bind->get_instance_class();
 
 	ClassInfo *type = classes.getptr(instance_type);
@@ -2024,6 +2106,8 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 
 	ClassInfo *parent = classes.getptr(p_extension->parent_class_name);
 
+	_unfreeze_registry();
+
 	ClassInfo c;
 	c.api = p_extension->editor_class ? API_EDITOR_EXTENSION : API_EXTENSION;
 	c.gdextension = p_extension;
@@ -2062,12 +2146,14 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
 	ClassInfo *c = classes.getptr(p_class);
 	ERR_FAIL_NULL_MSG(c, "Class '" + String(p_class) + "' does not exist.");
+	_unfreeze_registry();
 	if (p_free_method_binds) {
 		for (KeyValue<StringName, MethodBind *> &F : c->method_map) {
 			memdelete(F.value);
 		}
 	}
 	classes.erase(p_class);
+	member_version.increment();
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
 #ifdef TOOLS_ENABLED
@@ -2101,6 +2187,41 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 
 RWLock ClassDB::lock;
 
+void ClassDB::freeze_registry() {
+	RWLockWrite _rw_lockw_(lock);
+
+	if (frozen_registry.get()) {
+		return;
+	}
+
+	FrozenRegistry *frozen = memnew(FrozenRegistry);
+	frozen->classes.reserve(classes.size());
+	for (KeyValue<StringName, ClassInfo> &E : classes) {
+		frozen->classes.insert(E.key, &E.value);
+	}
+	frozen_registry.set(frozen);
+}
+
+void ClassDB::_unfreeze_registry() {
+	FrozenRegistry *frozen = frozen_registry.get();
+	if (!frozen) {
+		return;
+	}
+
+	frozen_registry.set(nullptr);
+	// Lock-free readers may still be walking it.
+	retired_registries.push_back(frozen);
+}
+
+void ClassDB::unfreeze_registry() {
+	RWLockWrite _rw_lockw_(lock);
+	_unfreeze_registry();
+}
+
+bool ClassDB::is_registry_frozen() {
+	return frozen_registry.get() != nullptr;
+}
+
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
 	default_values_cached.clear();
@@ -2109,6 +2230,12 @@ void ClassDB::cleanup_defaults() {
 void ClassDB::cleanup() {
 	//OBJTYPE_LOCK; hah not here
 
+	_unfreeze_registry();
+	for (FrozenRegistry *frozen : retired_registries) {
+		memdelete(frozen);
+	}
+	retired_registries.clear();
+
 	for (KeyValue<StringName, ClassInfo> &E : classes) {
 		ClassInfo &ti = E.value;
 
@@ -38,6 +38,7 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/hash_set.h"
 
 #include <type_traits>
@@ -104,7 +105,7 @@ public:
 
 		ObjectGDExtension *gdextension = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
+		FlatHashMap<StringName, MethodBind *> method_map;
 		HashMap<StringName, LocalVector<MethodBind *>> method_map_compatibility;
 		HashMap<StringName, int64_t> constant_map;
 		struct EnumInfo {
@@ -185,6 +186,26 @@ private:
 
 	static Object *_instantiate_internal(const StringName &p_class, bool p_require_real_class = false);
 
+	// Bumped whenever classes are unregistered, so MethodBind pointers cached outside ClassDB get resolved again.
+	static SafeNumeric<uint32_t> member_version;
+
+	// Immutable view of the registry, published once class registration is done so the hot read paths
+	// (get_method(), is_parent_class(), property access...) can skip the RWLock. Registering or unregistering
+	// classes unpublishes it first; retired views are kept alive until cleanup, as readers may still use them.
+	struct FrozenRegistry {
+		HashMap<StringName, ClassInfo *> classes;
+
+		_FORCE_INLINE_ ClassInfo *get_class_info(const StringName &p_class) const {
+			ClassInfo *const *info = classes.getptr(p_class);
+			return info ? *info : nullptr;
+		}
+	};
+	static SafeNumeric<FrozenRegistry *> frozen_registry;
+	static LocalVector<FrozenRegistry *> retired_registries;
+
+	static void _unfreeze_registry();
+	static bool _get_property_accessors(const ClassInfo *p_class_info, const StringName &p_property, MethodBind **r_setter, MethodBind **r_getter, int *r_index);
+
 public:
 	// DO NOT USE THIS!!!!!! NEEDS TO BE PUBLIC BUT DO NOT USE NO MATTER WHAT!!!
 	template <class T>
@@ -423,6 +444,7 @@ public:
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
+	static bool get_property_accessors(const StringName &p_class, const StringName &p_property, MethodBind **r_setter, MethodBind **r_getter, int *r_index);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
 	static void set_method_flags(const StringName &p_class, const StringName &p_method, int p_flags);
@@ -431,6 +453,7 @@ public:
 	static void get_method_list_with_compatibility(const StringName &p_class, List<Pair<MethodInfo, uint32_t>> *p_methods_with_hash, bool p_no_inheritance = false, bool p_exclude_from_properties = false);
 	static bool get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance = false, bool p_exclude_from_properties = false);
 	static MethodBind *get_method(const StringName &p_class, const StringName &p_name);
+	static uint32_t get_member_version() { return member_version.get(); }
 	static MethodBind *get_method_with_compatibility(const StringName &p_class, const StringName &p_name, uint64_t p_hash, bool *r_method_exists = nullptr, bool *r_is_deprecated = nullptr);
 	static Vector<uint32_t> get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name);
 
@@ -470,6 +493,10 @@ public:
 
 	static void set_current_api(APIType p_api);
 	static APIType get_current_api();
+	static void freeze_registry();
+	static void unfreeze_registry();
+	static bool is_registry_frozen();
+
 	static void cleanup_defaults();
 	static void cleanup();
 
@@ -1102,39 +1102,60 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
-		uint32_t idx = 0;
+	if (s->emit_connections_dirty) {
+		s->emit_connections.resize(s->slot_map.size());
+		Connection *w = s->emit_connections.ptrw();
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			*w++ = slot_kv.value.conn;
 		}
-		DEV_ASSERT(idx == s->slot_map.size());
+		s->emit_connections_dirty = false;
 	}
 
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. This only shares the connection array,
+	// anything changing it during emission gets its own copy.
+	const Vector<Connection> slot_conns = s->emit_connections;
+
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
 	for (const Connection &c : slot_conns) {
-		if (!c.callable.is_valid()) {
-			// Target might have been deleted during signal callback, this is expected and OK.
-			continue;
-		}
-
 		const Variant **args = p_args;
 		int argc = p_argcount;
 
 		if (c.flags & CONNECT_DEFERRED) {
+			if (!c.callable.is_valid()) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
 			MessageQueue::get_singleton()->push_callablep(c.callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
-			_emitting = true;
 			Variant ret;
-			c.callable.callp(args, argc, ret, ce);
-			_emitting = false;
+			if (!c.callable.is_custom()) {
+				// Fast path for plain object methods: call the target directly instead of looking
+				// it up and checking for the method up front, and only check when the call failed.
+				Object *target = ObjectDB::get_instance(c.callable.get_object_id());
+				if (!target) {
+					// Target might have been deleted during signal callback, this is expected and OK.
+					continue;
+				}
+				_emitting = true;
+				ret = target->callp(c.callable.get_method(), args, argc, ce);
+				_emitting = false;
+				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && !target->has_method(c.callable.get_method())) {
+					continue;
+				}
+			} else {
+				if (!c.callable.is_valid()) {
+					// Target might have been deleted during signal callback, this is expected and OK.
+					continue;
+				}
+				_emitting = true;
+				c.callable.callp(args, argc, ret, ce);
+				_emitting = false;
+			}
 
 			if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
@@ -1384,6 +1405,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->emit_connections_dirty = true;
 
 	return OK;
 }
@@ -1441,6 +1463,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->emit_connections_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2066,6 +2089,31 @@ Object::~Object() {
 	}
 }
 
+static Mutex virtual_methods_mutex;
+
+void *ObjectGDExtension::get_virtual_method(const StringName &p_name) {
+	MutexLock lock(virtual_methods_mutex);
+
+	void **cached = virtual_methods.getptr(p_name);
+	if (cached) {
+		return *cached;
+	}
+
+	void *method = nullptr;
+	if (get_virtual_call_data && call_virtual_with_data) {
+		method = get_virtual_call_data(class_userdata, &p_name);
+	} else if (get_virtual) {
+		method = (void *)get_virtual(class_userdata, &p_name);
+	}
+	virtual_methods.insert(p_name, method);
+	return method;
+}
+
+void ObjectGDExtension::clear_virtual_methods() {
+	MutexLock lock(virtual_methods_mutex);
+	virtual_methods.clear();
+}
+
 bool predelete_handler(Object *p_object) {
 	return p_object->_predelete();
 }
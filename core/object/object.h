@@ -356,6 +356,12 @@ struct ObjectGDExtension {
 	GDExtensionClassCallVirtualWithData call_virtual_with_data;
 	GDExtensionClassRecreateInstance recreate_instance;
 
+	// Virtual methods resolved through get_virtual/get_virtual_call_data, shared by all instances of the class.
+	HashMap<StringName, void *> virtual_methods;
+
+	void *get_virtual_method(const StringName &p_name);
+	void clear_virtual_methods();
+
 #ifdef TOOLS_ENABLED
 	void *tracking_userdata = nullptr;
 	void (*track_instance)(void *p_userdata, void *p_instance) = nullptr;
@@ -619,6 +625,11 @@ private:
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+
+		// Flat copy of the connections in slot_map, rebuilt on the next emission after connecting or disconnecting.
+		// Emitting only takes a reference to it, so changes made by callbacks mid-emission copy it instead.
+		Vector<Connection> emit_connections;
+		bool emit_connections_dirty = false;
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -763,6 +774,7 @@ protected:
 	void _clear_internal_resource_paths(const Variant &p_var);
 
 	friend class ClassDB;
+	friend class ObjectMemberCache;
 	friend class PlaceholderExtensionInstance;
 
 	bool _disconnect(const StringName &p_signal, const Callable &p_callable, bool p_force = false);
@@ -943,6 +955,12 @@ public:
 	MTVIRTUAL void disconnect(const StringName &p_signal, const Callable &p_callable);
 	MTVIRTUAL bool is_connected(const StringName &p_signal, const Callable &p_callable) const;
 
+	// Lets hot paths skip building arguments and emitting signals nobody listens to.
+	_FORCE_INLINE_ bool has_signal_connections(const StringName &p_signal) const {
+		const SignalData *s = signal_map.getptr(p_signal);
+		return s && !s->slot_map.is_empty();
+	}
+
 	template <typename... VarArgs>
 	void call_deferred(const StringName &p_name, VarArgs... p_args) {
 		MessageQueue::get_singleton()->push_call(this, p_name, p_args...);
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  object_member_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "object_member_cache.h"
+
+#include "core/object/class_db.h"
+#include "core/core_string_names.h"
+
+void ObjectMemberCache::set_member(const StringName &p_member) {
+	if (member == p_member) {
+		return;
+	}
+	member = p_member;
+	clear();
+}
+
+void ObjectMemberCache::clear() {
+	method_class = nullptr;
+	method = nullptr;
+	property_class = nullptr;
+	setter = nullptr;
+	getter = nullptr;
+	property_index = -1;
+}
+
+bool ObjectMemberCache::_resolve_method(const Object *p_object) {
+	const StringName &class_name = p_object->get_class_name();
+	uint32_t version = ClassDB::get_member_version();
+	if (likely(method_class == class_name.data_unique_pointer() && method_version == version)) {
+		return method != nullptr;
+	}
+
+	method_class = class_name.data_unique_pointer();
+	method_version = version;
+	method = ClassDB::get_method(class_name, member);
+	return method != nullptr;
+}
+
+bool ObjectMemberCache::_resolve_property(const Object *p_object) {
+	const StringName &class_name = p_object->get_class_name();
+	uint32_t version = ClassDB::get_member_version();
+	if (likely(property_class == class_name.data_unique_pointer() && property_version == version)) {
+		return true;
+	}
+
+	property_class = class_name.data_unique_pointer();
+	property_version = version;
+	setter = nullptr;
+	getter = nullptr;
+	property_index = -1;
+	ClassDB::get_property_accessors(class_name, member, &setter, &getter, &property_index);
+	return true;
+}
+
+Variant ObjectMemberCache::call(Object *p_object, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	if (p_object->script_instance || member == CoreStringNames::get_singleton()->_free || !_resolve_method(p_object)) {
+		return p_object->callp(member, p_args, p_argcount, r_error);
+	}
+
+#ifdef DEBUG_ENABLED
+	// Same as OBJ_DEBUG_LOCK in Object::callp(), so the object can't be freed during the call.
+	p_object->_lock_index.ref();
+	Variant ret = method->call(p_object, p_args, p_argcount, r_error);
+	p_object->_lock_index.unref();
+	return ret;
+#else
+	return method->call(p_object, p_args, p_argcount, r_error);
+#endif
+}
+
+Variant ObjectMemberCache::get(const Object *p_object, bool *r_valid) {
+	if (p_object->script_instance || (p_object->_extension && p_object->_extension->get) || !_resolve_property(p_object) || !getter) {
+		return p_object->get(member, r_valid);
+	}
+
+	Callable::CallError ce;
+	Variant ret;
+	if (property_index >= 0) {
+		Variant index = property_index;
+		const Variant *arg[1] = { &index };
+		ret = getter->call(const_cast<Object *>(p_object), arg, 1, ce);
+	} else {
+		ret = getter->call(const_cast<Object *>(p_object), nullptr, 0, ce);
+	}
+	if (r_valid) {
+		*r_valid = true;
+	}
+	return ret;
+}
+
+void ObjectMemberCache::set(Object *p_object, const Variant &p_value, bool *r_valid) {
+	if (p_object->script_instance || (p_object->_extension && p_object->_extension->set) || !_resolve_property(p_object) || !setter) {
+		p_object->set(member, p_value, r_valid);
+		return;
+	}
+
+#ifdef TOOLS_ENABLED
+	p_object->_edited = true;
+#endif
+
+	Callable::CallError ce;
+	if (property_index >= 0) {
+		Variant index = property_index;
+		const Variant *arg[2] = { &index, &p_value };
+		setter->call(p_object, arg, 2, ce);
+	} else {
+		const Variant *arg[1] = { &p_value };
+		setter->call(p_object, arg, 1, ce);
+	}
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  object_member_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef OBJECT_MEMBER_CACHE_H
+#define OBJECT_MEMBER_CACHE_H
+
+#include "core/object/object.h"
+
+class MethodBind;
+
+// Inline cache for dynamic access to one named member (method or property) of objects.
+// Callers that repeatedly access the same member by name (untyped script calls, expressions,
+// animation tracks...) keep one of these per access site. The native accessors resolved for
+// the last class seen are remembered, so accessing the same member on objects of that class
+// skips the ClassDB hash lookups.
+//
+// Objects with a script instance or a GDExtension set/get hook, and members not backed by a
+// bound method, always take the generic Object path, so results are the same as calling
+// Object::callp(), Object::get() or Object::set() directly. A cache is not thread-safe:
+// it must not be used from several threads at once.
+class ObjectMemberCache {
+	StringName member;
+
+	const void *method_class = nullptr;
+	MethodBind *method = nullptr;
+	uint32_t method_version = 0;
+
+	const void *property_class = nullptr;
+	MethodBind *setter = nullptr;
+	MethodBind *getter = nullptr;
+	int property_index = -1;
+	uint32_t property_version = 0;
+
+	bool _resolve_method(const Object *p_object);
+	bool _resolve_property(const Object *p_object);
+
+public:
+	_FORCE_INLINE_ const StringName &get_member() const { return member; }
+	void set_member(const StringName &p_member);
+	void clear();
+
+	Variant call(Object *p_object, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	Variant get(const Object *p_object, bool *r_valid = nullptr);
+	void set(Object *p_object, const Variant &p_value, bool *r_valid = nullptr);
+
+	ObjectMemberCache() {}
+	ObjectMemberCache(const StringName &p_member) :
+			member(p_member) {}
+};
+
+#endif // OBJECT_MEMBER_CACHE_H
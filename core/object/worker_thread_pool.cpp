@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/scope_profiler.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
@@ -47,6 +48,8 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 thread_local CommandQueueMT *WorkerThreadPool::flushing_cmd_queue = nullptr;
 
 void WorkerThreadPool::_process_task(Task *p_task) {
+	PROFILE_SCOPE("WorkerThreadPool Task");
+
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -76,25 +79,29 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// Handling a group
 		bool do_post = false;
 
-		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
+		if (p_task->group->range) {
+			_process_range_group_task(p_task, do_post);
+		} else {
+			while (true) {
+				uint32_t work_index = p_task->group->index.postincrement();
 
-			if (work_index >= p_task->group->max) {
-				break;
-			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
-			}
+				if (work_index >= p_task->group->max) {
+					break;
+				}
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, work_index);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(work_index);
+				} else {
+					p_task->callable.call(work_index);
+				}
 
-			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
+				// This is the only way to ensure posting is done when all tasks are really complete.
+				uint32_t completed_amount = p_task->group->completed_index.increment();
 
-			if (completed_amount == p_task->group->max) {
-				do_post = true;
+				if (completed_amount == p_task->group->max) {
+					do_post = true;
+				}
 			}
 		}
 
@@ -103,8 +110,12 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
-			p_task->group->done_semaphore.post();
+			// Dependents are added with the mutex held, so completion must be flagged under it too.
+			task_mutex.lock();
 			p_task->group->completed.set_to(true);
+			_release_dependents(p_task->group->dependents);
+			task_mutex.unlock();
+			p_task->group->done_semaphore.post();
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -143,6 +154,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 				threads[i].signaled = true;
 			}
 		}
+		// Post whatever was only waiting for this one.
+		_release_dependents(p_task->dependents);
 	}
 
 #ifdef THREADS_ENABLED
@@ -165,11 +178,45 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 }
 
+void WorkerThreadPool::_process_range_group_task(Task *p_task, bool &r_do_post) {
+	Group *group = p_task->group;
+	uint32_t grain = group->start_grain;
+
+	while (true) {
+		uint32_t from = group->index.postadd(grain);
+		if (from >= group->max) {
+			break;
+		}
+		uint32_t to = MIN(from + grain, group->max);
+
+		uint64_t chunk_begin = OS::get_singleton()->get_ticks_usec();
+		if (p_task->native_range_func) {
+			p_task->native_range_func(p_task->native_func_userdata, group->range_begin + from, group->range_begin + to);
+		} else {
+			p_task->template_userdata->callback_range(group->range_begin + from, group->range_begin + to);
+		}
+		uint64_t chunk_usec = OS::get_singleton()->get_ticks_usec() - chunk_begin;
+
+		uint32_t completed_amount = group->completed_index.add(to - from);
+		if (completed_amount == group->max) {
+			r_do_post = true;
+		}
+
+		// Cheap chunks are dominated by the claiming overhead, while expensive ones hurt load balancing.
+		if (chunk_usec < RANGE_CHUNK_TARGET_USEC / 2) {
+			grain = MIN(grain * 2, group->max_grain);
+		} else if (chunk_usec > RANGE_CHUNK_TARGET_USEC * 2) {
+			grain = MAX(grain / 2, group->min_grain);
+		}
+	}
+}
+
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Local and stolen tasks don't need the mutex.
+		Task *task_to_process = singleton->_pop_local_task(thread_data);
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 			if (singleton->exit_threads) {
 				return;
@@ -179,7 +226,8 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 			if (singleton->task_queue.first()) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
-			} else {
+			} else if (singleton->_are_local_queues_empty()) {
+				// Local queues are only pushed to with the mutex held, so no wakeup can be missed here.
 				thread_data->cond_var.wait(lock);
 				DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
 			}
@@ -204,6 +252,14 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 		return;
 	}
 
+	_post_tasks(p_tasks, p_count, p_high_priority);
+
+	task_mutex.unlock();
+}
+
+void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority) {
+	DEV_ASSERT(threads.size() > 0);
+
 	uint32_t to_process = 0;
 	uint32_t to_promote = 0;
 
@@ -211,7 +267,11 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+		if (p_high_priority && caller_pool_thread && caller_pool_thread->local_queue.push(p_tasks[i])) {
+			// Tasks spawned from pool threads stay local, so the poster can pick them up
+			// without contention and the rest of the threads can steal them.
+			to_process++;
+		} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
 			task_queue.add_last(&p_tasks[i]->task_elem);
 			if (!p_high_priority) {
 				low_priority_threads_used++;
@@ -225,8 +285,44 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 	}
 
 	_notify_threads(caller_pool_thread, to_process, to_promote);
+}
 
-	task_mutex.unlock();
+uint32_t WorkerThreadPool::_add_dependencies(Task *p_task, const TaskID *p_dependencies, uint32_t p_dependency_count) {
+	uint32_t pending = 0;
+	for (uint32_t i = 0; i < p_dependency_count; i++) {
+		TaskID dependency = p_dependencies[i];
+		Task **taskp = tasks.getptr(dependency);
+		if (taskp) {
+			if (!(*taskp)->completed) {
+				(*taskp)->dependents.push_back(p_task);
+				pending++;
+			}
+			continue;
+		}
+		Group **groupp = groups.getptr(dependency);
+		if (groupp) {
+			if (!(*groupp)->completed.is_set()) {
+				(*groupp)->dependents.push_back(p_task);
+				pending++;
+			}
+			continue;
+		}
+		// Tasks and groups already awaited are gone, but they are complete anyway.
+		ERR_CONTINUE_MSG(dependency <= 0 || dependency >= (TaskID)last_task, "Invalid Task or Group ID.");
+	}
+	p_task->pending_dependencies = pending;
+	return pending;
+}
+
+void WorkerThreadPool::_release_dependents(LocalVector<Task *> &p_dependents) {
+	for (Task *dependent : p_dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			_post_tasks(&dependent, 1, !dependent->low_priority);
+		}
+	}
+	p_dependents.clear();
 }
 
 void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count) {
@@ -305,11 +401,38 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+
+	// Nothing of our own to do, try stealing from the rest, starting from the next one to spread the load.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		if (victim.local_queue.steal(task)) {
+			return task;
+		}
+	}
+
+	return nullptr;
+}
+
+bool WorkerThreadPool::_are_local_queues_empty() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].local_queue.is_empty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const TaskID *p_dependencies, uint32_t p_dependency_count) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -320,8 +443,15 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
 
+	if (_add_dependencies(task, p_dependencies, p_dependency_count)) {
+		// Will be posted by the last dependency to complete.
+		task_mutex.unlock();
+		return id;
+	}
+
 	_post_tasks_and_unlock(&task, 1, p_high_priority);
 
 	return id;
@@ -331,6 +461,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies, p_dependency_count);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies.ptr(), p_dependencies.size());
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	task_mutex.lock();
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -400,7 +538,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 					// This thread was awaken also for some reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
 					if (!exit_threads && was_signaled) {
-						uint32_t to_process = task_queue.first() ? 1 : 0;
+						uint32_t to_process = (task_queue.first() || !_are_local_queues_empty()) ? 1 : 0;
 						uint32_t to_promote = caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 						if (to_process || to_promote) {
 							// This thread must be left alone since it won't loop again.
@@ -428,12 +566,15 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 						}
 					}
 
-					if (singleton->task_queue.first()) {
+					// Prefer local tasks, since the awaited one is likely among them.
+					task_to_process = _pop_local_task(caller_pool_thread);
+
+					if (!task_to_process && singleton->task_queue.first()) {
 						task_to_process = task_queue.first()->self();
 						task_queue.remove(task_queue.first());
 					}
 
-					if (!task_to_process) {
+					if (!task_to_process && _are_local_queues_empty()) {
 						caller_pool_thread->awaited_task = task;
 
 						if (flushing_cmd_queue) {
@@ -468,7 +609,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const TaskID *p_dependencies, uint32_t p_dependency_count) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -502,9 +643,19 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
+
+		// Dependencies can't complete while the mutex is held, so either all the tasks wait or none does.
+		bool pending = false;
+		for (int i = 0; i < p_tasks; i++) {
+			pending = _add_dependencies(tasks_posted[i], p_dependencies, p_dependency_count) > 0;
+		}
+		if (pending) {
+			p_tasks = 0;
+		}
 	}
 
 	groups[id] = group;
@@ -514,6 +665,65 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	return id;
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::_add_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, uint32_t p_begin, uint32_t p_end, uint32_t p_grain, int p_tasks, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_COND_V(p_end < p_begin, INVALID_TASK_ID);
+	uint32_t elements = p_end - p_begin;
+	// Leave headroom so claiming past the end can't overflow.
+	ERR_FAIL_COND_V(elements > (uint32_t)INT32_MAX, INVALID_TASK_ID);
+	if (p_tasks < 0) {
+		p_tasks = MAX(1u, threads.size());
+	}
+	// Too many tasks for the available chunks would only add overhead.
+	uint32_t min_grain = MAX(1u, p_grain);
+	p_tasks = MIN((uint32_t)p_tasks, MAX(1u, elements / min_grain));
+
+	task_mutex.lock();
+	Group *group = group_allocator.alloc();
+	GroupID id = last_task++;
+	group->max = elements;
+	group->self = id;
+	group->range = true;
+	group->range_begin = p_begin;
+	group->min_grain = min_grain;
+	// Keep at least a few chunks per task, so threads finishing early can still help.
+	group->max_grain = MAX(min_grain, elements / (p_tasks * 4));
+	group->start_grain = p_grain ? p_grain : MAX(1u, elements / (p_tasks * 16));
+
+	Task **tasks_posted = nullptr;
+	if (elements == 0) {
+		group->completed.set_to(true);
+		group->done_semaphore.post();
+		group->tasks_used = 0;
+		p_tasks = 0;
+		if (p_template_userdata) {
+			memdelete(p_template_userdata);
+		}
+	} else {
+		group->tasks_used = p_tasks;
+		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
+		for (int i = 0; i < p_tasks; i++) {
+			Task *task = task_allocator.alloc();
+			task->native_range_func = p_func;
+			task->native_func_userdata = p_userdata;
+			task->description = p_description;
+			task->group = group;
+			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
+			tasks_posted[i] = task;
+		}
+	}
+
+	groups[id] = group;
+
+	_post_tasks_and_unlock(tasks_posted, p_tasks, p_high_priority);
+
+	return id;
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, uint32_t p_begin, uint32_t p_end, uint32_t p_grain, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_range_group_task(p_func, p_userdata, nullptr, p_begin, p_end, p_grain, p_tasks, p_high_priority, p_description);
+}
+
 WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
 	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
@@ -522,6 +732,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const TaskID *p_dependencies, uint32_t p_dependency_count, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies, p_dependency_count);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies.ptr(), p_dependencies.size());
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	task_mutex.lock();
 	const Group *const *groupp = groups.getptr(p_group);
@@ -654,7 +872,10 @@ void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
+	ClassDB::bind_method(D_METHOD("add_task_with_dependencies", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_with_dependencies, DEFVAL(false), DEFVAL(String()));
+
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task_with_dependencies", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task_with_dependencies, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
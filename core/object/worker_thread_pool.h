@@ -40,6 +40,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
 
 class CommandQueueMT;
 
@@ -59,6 +60,7 @@ private:
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
 		virtual void callback_indexed(uint32_t p_index) {}
+		virtual void callback_range(uint32_t p_from, uint32_t p_to) {}
 		virtual ~BaseTemplateUserdata() {}
 	};
 
@@ -67,10 +69,17 @@ private:
 		SafeNumeric<uint32_t> index;
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
+		// Range groups hand out chunks of elements instead of single ones.
+		bool range = false;
+		uint32_t range_begin = 0;
+		uint32_t min_grain = 1;
+		uint32_t start_grain = 1;
+		uint32_t max_grain = 1;
 		Semaphore done_semaphore;
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		LocalVector<Task *> dependents; // Tasks waiting for this group to complete.
 	};
 
 	struct Task {
@@ -78,6 +87,7 @@ private:
 		Callable callable;
 		void (*native_func)(void *) = nullptr;
 		void (*native_group_func)(void *, uint32_t) = nullptr;
+		void (*native_range_func)(void *, uint32_t, uint32_t) = nullptr;
 		void *native_func_userdata = nullptr;
 		String description;
 		Semaphore done_semaphore; // For user threads awaiting.
@@ -89,6 +99,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0; // Not posted until this reaches zero.
+		LocalVector<Task *> dependents; // Tasks waiting for this one to complete.
 
 		void free_template_userdata();
 		Task() :
@@ -97,6 +109,7 @@ private:
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint64_t RANGE_CHUNK_TARGET_USEC = 50; // Grain size adapts towards chunks taking about this long.
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -114,6 +127,8 @@ private:
 		Task *current_task = nullptr;
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable. Special value for idle-waiting.
 		ConditionVariable cond_var;
+		// High priority tasks posted from this thread. Other threads steal from it without locking.
+		WorkStealingDeque<Task *> local_queue;
 	};
 
 	TightLocalVector<ThreadData> threads;
@@ -146,16 +161,24 @@ private:
 	void _process_task(Task *task);
 
 	void _post_tasks_and_unlock(Task **p_tasks, uint32_t p_count, bool p_high_priority);
+	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority);
+	uint32_t _add_dependencies(Task *p_task, const TaskID *p_dependencies, uint32_t p_dependency_count);
+	void _release_dependents(LocalVector<Task *> &p_dependents);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	Task *_pop_local_task(ThreadData *p_thread_data);
+	bool _are_local_queues_empty() const;
+
 	static WorkerThreadPool *singleton;
 
 	static thread_local CommandQueueMT *flushing_cmd_queue;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const TaskID *p_dependencies = nullptr, uint32_t p_dependency_count = 0);
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const TaskID *p_dependencies = nullptr, uint32_t p_dependency_count = 0);
+	GroupID _add_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, uint32_t p_begin, uint32_t p_end, uint32_t p_grain, int p_tasks, bool p_high_priority, const String &p_description);
+	void _process_range_group_task(Task *p_task, bool &r_do_post);
 
 	template <class C, class M, class U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -177,6 +200,21 @@ private:
 		}
 	};
 
+	template <class C, class M, class U>
+	struct RangeGroupUserData : public BaseTemplateUserdata {
+		C *instance;
+		M method;
+		U userdata;
+		virtual void callback_range(uint32_t p_from, uint32_t p_to) override {
+			(instance->*method)(p_from, p_to, userdata);
+		}
+	};
+
+	template <class F>
+	static void _parallel_for_range_callback(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+		(*(const F *)p_userdata)(p_from, p_to);
+	}
+
 protected:
 	static void _bind_methods();
 
@@ -193,6 +231,19 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// The task is held back until all the tasks or groups it depends on have completed.
+	template <class C, class M, class U>
+	TaskID add_template_task_with_dependencies(C *p_instance, M p_method, U p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies, p_dependency_count);
+	}
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const TaskID *p_dependencies, uint32_t p_dependency_count, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -207,6 +258,40 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <class C, class M, class U>
+	GroupID add_template_group_task_with_dependencies(C *p_instance, M p_method, U p_userdata, int p_elements, const TaskID *p_dependencies, uint32_t p_dependency_count, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies, p_dependency_count);
+	}
+	GroupID add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const TaskID *p_dependencies, uint32_t p_dependency_count, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	// Range groups call back once per contiguous chunk [from, to) of [p_begin, p_end), instead of once per element.
+	// The chunk size starts at p_grain (or an automatic value if 0) and grows or shrinks according to how long chunks take,
+	// but never goes below p_grain.
+	template <class C, class M, class U>
+	GroupID add_template_range_group_task(C *p_instance, M p_method, U p_userdata, uint32_t p_begin, uint32_t p_end, uint32_t p_grain = 0, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef RangeGroupUserData<C, M, U> RangeUD;
+		RangeUD *ud = memnew(RangeUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_range_group_task(nullptr, nullptr, ud, p_begin, p_end, p_grain, p_tasks, p_high_priority, p_description);
+	}
+	GroupID add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, uint32_t p_begin, uint32_t p_end, uint32_t p_grain = 0, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	// Blocking convenience. F is called as p_func(from, to) from the worker threads.
+	template <class F>
+	void parallel_for_range(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, const F &p_func, const String &p_description = String()) {
+		GroupID group = _add_range_group_task(&_parallel_for_range_callback<F>, (void *)&p_func, nullptr, p_begin, p_end, p_grain, -1, true, p_description);
+		wait_for_group_task_completion(group);
+	}
+
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -35,6 +35,20 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Custom builds can route every engine allocation to a different allocator (e.g., mimalloc or rpmalloc,
+// which keep per-thread caches) by defining GODOT_MEMORY_BACKEND_HEADER (for instance, through the
+// `cppdefines` build option) to a header that defines these three macros.
+#ifdef GODOT_MEMORY_BACKEND_HEADER
+#include GODOT_MEMORY_BACKEND_HEADER
+#endif
+
+#ifndef GODOT_MEMORY_MALLOC
+#define GODOT_MEMORY_MALLOC(m_size) malloc(m_size)
+#define GODOT_MEMORY_REALLOC(m_ptr, m_size) realloc(m_ptr, m_size)
+#define GODOT_MEMORY_FREE(m_ptr) free(m_ptr)
+#endif
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,10 +75,14 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_mem_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+static thread_local Memory::Tag thread_tag = Memory::TAG_DEFAULT;
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
@@ -72,7 +90,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	void *mem = GODOT_MEMORY_MALLOC(p_bytes + (prepad ? DATA_OFFSET : 0));
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
@@ -82,11 +100,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
-		*s = p_bytes;
+		*s = p_bytes | (uint64_t(thread_tag) << TAG_SHIFT);
 
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+		uint64_t new_tag_mem_usage = tag_mem_usage[thread_tag].add(p_bytes);
+		tag_max_usage[thread_tag].exchange_if_greater(new_tag_mem_usage);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -110,33 +130,39 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
+		// Memory stays attributed to the tag it was first allocated with.
+		uint64_t tag = *s >> TAG_SHIFT;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		uint64_t old_bytes = *s & SIZE_MASK;
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			uint64_t new_tag_mem_usage = tag_mem_usage[tag].add(p_bytes - old_bytes);
+			tag_max_usage[tag].exchange_if_greater(new_tag_mem_usage);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			tag_mem_usage[tag].sub(old_bytes - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			GODOT_MEMORY_FREE(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
+			*s = p_bytes | (tag << TAG_SHIFT);
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)GODOT_MEMORY_REALLOC(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = p_bytes | (tag << TAG_SHIFT);
 
 			return mem + DATA_OFFSET;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)GODOT_MEMORY_REALLOC(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
@@ -162,12 +188,13 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+		mem_usage.sub(*s & SIZE_MASK);
+		tag_mem_usage[*s >> TAG_SHIFT].sub(*s & SIZE_MASK);
 #endif
 
-		free(mem);
+		GODOT_MEMORY_FREE(mem);
 	} else {
-		free(mem);
+		GODOT_MEMORY_FREE(mem);
 	}
 }
 
@@ -191,6 +218,166 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+void Memory::set_thread_tag(Tag p_tag) {
+	thread_tag = p_tag;
+}
+
+Memory::Tag Memory::get_thread_tag() {
+	return thread_tag;
+}
+
+uint64_t Memory::get_tag_mem_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_mem_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_mem_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	static const char *names[TAG_MAX] = {
+		"default",
+		"rendering",
+		"physics",
+		"scripting",
+		"resources",
+		"audio",
+	};
+	return names[p_tag];
+}
+
+SafeNumeric<uint64_t> FrameAllocator::frame;
+
+namespace {
+
+struct FrameArena {
+	static constexpr size_t ALIGN = alignof(max_align_t);
+	static constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+
+	struct Block {
+		Block *prev = nullptr;
+		size_t size = 0;
+		size_t used = 0;
+		uint8_t *data() { return (uint8_t *)this + HEADER_SIZE; }
+	};
+	static constexpr size_t HEADER_SIZE = (sizeof(Block) + ALIGN - 1) & ~(ALIGN - 1);
+
+	Block *current = nullptr;
+	size_t total_size = 0;
+	uint64_t frame = 0;
+	void *last_alloc = nullptr;
+
+	void _push_block(size_t p_min_size) {
+		size_t size = MAX(p_min_size, MIN_BLOCK_SIZE);
+		Block *block = (Block *)Memory::alloc_static(HEADER_SIZE + size);
+		CRASH_COND_MSG(!block, "Out of memory");
+		block->prev = current;
+		block->size = size;
+		block->used = 0;
+		current = block;
+		total_size += size;
+	}
+
+	void _free_blocks() {
+		while (current) {
+			Block *prev = current->prev;
+			Memory::free_static(current);
+			current = prev;
+		}
+		total_size = 0;
+	}
+
+	void recycle() {
+		last_alloc = nullptr;
+		if (current && current->prev) {
+			// The last frame needed more than one block, so replace them with a single one big enough for all.
+			size_t size = total_size;
+			_free_blocks();
+			_push_block(size);
+		} else if (current) {
+			current->used = 0;
+		}
+	}
+
+	void *alloc(size_t p_memory) {
+		size_t size = (p_memory + ALIGN - 1) & ~(ALIGN - 1);
+		if (!current || current->size - current->used < size) {
+			_push_block(size);
+		}
+		void *mem = current->data() + current->used;
+		current->used += size;
+		last_alloc = mem;
+		return mem;
+	}
+
+	void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) {
+		if (p_ptr && p_ptr == last_alloc) {
+			// Latest allocation, so it can just grow or shrink in place if it fits.
+			size_t offset = (uint8_t *)p_ptr - current->data();
+			size_t size = (p_memory + ALIGN - 1) & ~(ALIGN - 1);
+			if (offset + size <= current->size) {
+				current->used = offset + size;
+				return p_ptr;
+			}
+		}
+		if (p_memory <= p_old_memory) {
+			return p_ptr;
+		}
+		void *mem = alloc(p_memory);
+		if (p_ptr) {
+			memcpy(mem, p_ptr, p_old_memory);
+		}
+		return mem;
+	}
+
+	~FrameArena() {
+		_free_blocks();
+	}
+};
+
+thread_local FrameArena frame_arena;
+
+} // namespace
+
+void *FrameAllocator::alloc(size_t p_memory) {
+	uint64_t current_frame = frame.get();
+	if (unlikely(frame_arena.frame != current_frame)) {
+		frame_arena.frame = current_frame;
+		frame_arena.recycle();
+	}
+	return frame_arena.alloc(p_memory);
+}
+
+void *FrameAllocator::realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) {
+	uint64_t current_frame = frame.get();
+	if (unlikely(frame_arena.frame != current_frame)) {
+		// Whatever was allocated before is gone now.
+		DEV_ASSERT(p_ptr == nullptr);
+		frame_arena.frame = current_frame;
+		frame_arena.recycle();
+	}
+	return frame_arena.realloc(p_ptr, p_old_memory, p_memory);
+}
+
+void FrameAllocator::end_frame() {
+	frame.increment();
+}
+
+uint64_t FrameAllocator::get_thread_arena_size() {
+	return frame_arena.total_size;
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
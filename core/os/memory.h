@@ -39,13 +39,33 @@
 #include <type_traits>
 
 class Memory {
+public:
+	// Allocations are attributed to the tag set for the calling thread (see MemoryTagScope),
+	// so the subsystem responsible for memory growth can be found.
+	enum Tag {
+		TAG_DEFAULT,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_SCRIPTING,
+		TAG_RESOURCES,
+		TAG_AUDIO,
+		TAG_MAX
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_mem_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
 
+	// The tag is kept in the top bits of the size stored in the allocation header.
+	static constexpr uint64_t TAG_SHIFT = 56;
+	static constexpr uint64_t SIZE_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
 	//             ┌─────────────────┬──┬────────────────┬──┬───────────...
@@ -65,14 +85,51 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static void set_thread_tag(Tag p_tag);
+	static Tag get_thread_tag();
+	static uint64_t get_tag_mem_usage(Tag p_tag);
+	static uint64_t get_tag_mem_max_usage(Tag p_tag);
+	static const char *get_tag_name(Tag p_tag);
+};
+
+class MemoryTagScope {
+	Memory::Tag prev_tag;
+
+public:
+	_FORCE_INLINE_ explicit MemoryTagScope(Memory::Tag p_tag) {
+		prev_tag = Memory::get_thread_tag();
+		Memory::set_thread_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_thread_tag(prev_tag);
+	}
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+// Thread-local bump allocator for temporaries that don't outlive the current frame.
+// Every thread gets its own arena, so allocating is lock-free and freeing is a no-op.
+// Arenas are recycled lazily on the first allocation after Main::iteration() has called end_frame(),
+// so memory from it must not be kept across frames. This also means threads whose work spans frame
+// boundaries (e.g., separate render or physics threads, long-running tasks) must not use it.
+class FrameAllocator {
+	static SafeNumeric<uint64_t> frame;
+
+public:
+	static void *alloc(size_t p_memory);
+	static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory);
+	_FORCE_INLINE_ static void free(void *p_ptr) {}
+
+	static void end_frame();
+	static uint64_t get_thread_arena_size();
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -221,4 +278,16 @@ public:
 	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete(p_allocation); }
 };
 
+template <class T>
+class FrameTypedAllocator {
+public:
+	template <class... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(FrameAllocator::alloc(sizeof(T)), T(p_args...)); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_allocation->~T();
+		}
+	}
+};
+
 #endif // MEMORY_H
@@ -633,27 +633,23 @@ String OS::get_benchmark_file() {
 }
 
 void OS::benchmark_begin_measure(const String &p_context, const String &p_what) {
-#ifdef TOOLS_ENABLED
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' already exists.", p_context, p_what));
 
 	benchmark_marks_from[mark_key] = OS::get_singleton()->get_ticks_usec();
-#endif
 }
 void OS::benchmark_end_measure(const String &p_context, const String &p_what) {
-#ifdef TOOLS_ENABLED
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(!benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' doesn't exist.", p_context, p_what));
 
 	uint64_t total = OS::get_singleton()->get_ticks_usec() - benchmark_marks_from[mark_key];
 	double total_f = double(total) / double(1000000);
 	benchmark_marks_final[mark_key] = total_f;
-#endif
 }
 
 void OS::benchmark_dump() {
-#ifdef TOOLS_ENABLED
-	if (!use_benchmark) {
+	// Verbose mode prints the startup and shutdown phase breakdown too, so it is available in export templates.
+	if (!use_benchmark && !is_stdout_verbose()) {
 		return;
 	}
 
@@ -685,7 +681,6 @@ void OS::benchmark_dump() {
 			print_line(vformat("\t[%s]\n%s", E.key, E.value));
 		}
 	}
-#endif
 }
 
 OS::OS() {
@@ -192,6 +192,7 @@ bool OptimizedTranslation::_set(const StringName &p_name, const Variant &p_value
 		return false;
 	}
 
+	TranslationServer::invalidate_translate_cache();
 	return true;
 }
 
@@ -39,7 +39,7 @@ StaticCString StaticCString::create(const char *p_ptr) {
 	return scs;
 }
 
-StringName::_Data *StringName::_table[STRING_TABLE_LEN];
+StringName::_Shard StringName::_table[STRING_TABLE_SHARDS];
 
 StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
@@ -54,23 +54,81 @@ bool StringName::debug_stringname = false;
 
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		_table[i] = nullptr;
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_Shard &shard = _table[i];
+		shard.buckets = (_Data **)memalloc(sizeof(_Data *) * STRING_TABLE_SHARD_MIN_BUCKETS);
+		memset(shard.buckets, 0, sizeof(_Data *) * STRING_TABLE_SHARD_MIN_BUCKETS);
+		shard.bucket_mask = STRING_TABLE_SHARD_MIN_BUCKETS - 1;
+		shard.count = 0;
 	}
 	configured = true;
 }
 
+template <class T>
+StringName::_Data *StringName::_find(const _Shard &p_shard, uint32_t p_hash, const T &p_name) {
+	_Data *d = p_shard.buckets[_get_bucket(p_shard, p_hash)];
+	while (d) {
+		// Compare hash first.
+		if (d->hash == p_hash && d->get_name() == p_name) {
+			return d;
+		}
+		d = d->next;
+	}
+	return nullptr;
+}
+
+void StringName::_insert(_Shard &p_shard, _Data *p_data) {
+	uint32_t bucket_count = p_shard.bucket_mask + 1;
+	if (p_shard.count >= bucket_count && bucket_count < STRING_TABLE_SHARD_MAX_BUCKETS) {
+		// Keep chains short by doubling the buckets of this shard only; other shards stay untouched.
+		uint32_t new_bucket_count = bucket_count << 1;
+		_Data **new_buckets = (_Data **)memalloc(sizeof(_Data *) * new_bucket_count);
+		memset(new_buckets, 0, sizeof(_Data *) * new_bucket_count);
+		p_shard.bucket_mask = new_bucket_count - 1;
+
+		for (uint32_t i = 0; i < bucket_count; i++) {
+			_Data *d = p_shard.buckets[i];
+			while (d) {
+				_Data *next = d->next;
+				uint32_t idx = _get_bucket(p_shard, d->hash);
+				d->prev = nullptr;
+				d->next = new_buckets[idx];
+				if (new_buckets[idx]) {
+					new_buckets[idx]->prev = d;
+				}
+				new_buckets[idx] = d;
+				d = next;
+			}
+		}
+
+		memfree(p_shard.buckets);
+		p_shard.buckets = new_buckets;
+	}
+
+	uint32_t idx = _get_bucket(p_shard, p_data->hash);
+	p_data->prev = nullptr;
+	p_data->next = p_shard.buckets[idx];
+	if (p_shard.buckets[idx]) {
+		p_shard.buckets[idx]->prev = p_data;
+	}
+	p_shard.buckets[idx] = p_data;
+	p_shard.count++;
+}
+
 void StringName::cleanup() {
 	MutexLock lock(mutex);
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
-		for (int i = 0; i < STRING_TABLE_LEN; i++) {
-			_Data *d = _table[i];
-			while (d) {
-				data.push_back(d);
-				d = d->next;
+		for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+			const _Shard &shard = _table[i];
+			for (uint32_t j = 0; j <= shard.bucket_mask; j++) {
+				_Data *d = shard.buckets[j];
+				while (d) {
+					data.push_back(d);
+					d = d->next;
+				}
 			}
 		}
 
@@ -93,22 +151,30 @@ void StringName::cleanup() {
 	}
 #endif
 	int lost_strings = 0;
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		while (_table[i]) {
-			_Data *d = _table[i];
-			if (d->static_count.get() != d->refcount.get()) {
-				lost_strings++;
-
-				if (OS::get_singleton()->is_stdout_verbose()) {
-					String dname = String(d->cname ? d->cname : d->name);
-
-					print_line(vformat("Orphan StringName: %s (static: %d, total: %d)", dname, d->static_count.get(), d->refcount.get()));
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_Shard &shard = _table[i];
+		MutexLock shard_lock(shard.mutex);
+		for (uint32_t j = 0; j <= shard.bucket_mask; j++) {
+			while (shard.buckets[j]) {
+				_Data *d = shard.buckets[j];
+				if (d->static_count.get() != d->refcount.get()) {
+					lost_strings++;
+
+					if (OS::get_singleton()->is_stdout_verbose()) {
+						String dname = String(d->cname ? d->cname : d->name);
+
+						print_line(vformat("Orphan StringName: %s (static: %d, total: %d)", dname, d->static_count.get(), d->refcount.get()));
+					}
 				}
-			}
 
-			_table[i] = _table[i]->next;
-			memdelete(d);
+				shard.buckets[j] = shard.buckets[j]->next;
+				memdelete(d);
+			}
 		}
+		memfree(shard.buckets);
+		shard.buckets = nullptr;
+		shard.bucket_mask = 0;
+		shard.count = 0;
 	}
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
@@ -120,7 +186,8 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		_Shard &shard = _get_shard(_data->hash);
+		MutexLock lock(shard.mutex);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -132,15 +199,17 @@ void StringName::unref() {
 		if (_data->prev) {
 			_data->prev->next = _data->next;
 		} else {
-			if (_table[_data->idx] != _data) {
+			uint32_t idx = _get_bucket(shard, _data->hash);
+			if (shard.buckets[idx] != _data) {
 				ERR_PRINT("BUG!");
 			}
-			_table[_data->idx] = _data->next;
+			shard.buckets[idx] = _data->next;
 		}
 
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
+		shard.count--;
 		memdelete(_data);
 	}
 
@@ -216,21 +285,12 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		// exists
@@ -250,10 +310,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -262,10 +319,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(shard, _data);
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -275,21 +329,12 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(shard, hash, p_static_string.ptr);
 
 	if (_data && _data->refcount.ref()) {
 		// exists
@@ -309,10 +354,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		// Keep in memory, force static.
@@ -320,10 +362,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(shard, _data);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -335,19 +374,12 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_data = _table[idx];
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		// exists
@@ -367,10 +399,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		// Keep in memory, force static.
@@ -378,11 +407,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(shard, _data);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -393,20 +418,12 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_Data *_data = _table[idx];
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 #ifdef DEBUG_ENABLED
@@ -429,21 +446,12 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		return StringName(_data);
@@ -455,21 +463,12 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_Shard &shard = _get_shard(hash);
+	MutexLock lock(shard.mutex);
 
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 #ifdef DEBUG_ENABLED
@@ -46,9 +46,11 @@ struct StaticCString {
 
 class StringName {
 	enum {
-		STRING_TABLE_BITS = 16,
-		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARDS = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARDS - 1,
+		STRING_TABLE_SHARD_MIN_BUCKETS = 1 << 10, // 65536 buckets in total to start with.
+		STRING_TABLE_SHARD_MAX_BUCKETS = 1 << (32 - STRING_TABLE_SHARD_BITS),
 	};
 
 	struct _Data {
@@ -60,14 +62,32 @@ class StringName {
 		uint32_t debug_references = 0;
 #endif
 		String get_name() const { return cname ? String(cname) : name; }
-		int idx = 0;
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
 		_Data *next = nullptr;
 		_Data() {}
 	};
 
-	static _Data *_table[STRING_TABLE_LEN];
+	// The intern table is split in shards, each with its own lock and a bucket array that grows
+	// with its load, so threads interning different names rarely contend with each other.
+	struct _Shard {
+		Mutex mutex;
+		_Data **buckets = nullptr;
+		uint32_t bucket_mask = 0;
+		uint32_t count = 0;
+	};
+
+	static _Shard _table[STRING_TABLE_SHARDS];
+
+	static _FORCE_INLINE_ _Shard &_get_shard(uint32_t p_hash) {
+		return _table[p_hash & STRING_TABLE_SHARD_MASK];
+	}
+	static _FORCE_INLINE_ uint32_t _get_bucket(const _Shard &p_shard, uint32_t p_hash) {
+		return (p_hash >> STRING_TABLE_SHARD_BITS) & p_shard.bucket_mask;
+	}
+	template <class T>
+	static _Data *_find(const _Shard &p_shard, uint32_t p_hash, const T &p_name);
+	static void _insert(_Shard &p_shard, _Data *p_data);
 
 	_Data *_data = nullptr;
 
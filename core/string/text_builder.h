@@ -0,0 +1,62 @@
+/**************************************************************************/
+/*  text_builder.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEXT_BUILDER_H
+#define TEXT_BUILDER_H
+
+#include "core/object/ref_counted.h"
+#include "core/string/string_builder.h"
+
+// Exposes StringBuilder to scripts, where repeated String concatenation
+// copies the whole string every time.
+class TextBuilder : public RefCounted {
+	GDCLASS(TextBuilder, RefCounted);
+
+	StringBuilder builder;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void append(const String &p_text);
+	void append_line(const String &p_text = String());
+	void reserve(int p_length);
+	void clear();
+
+	int get_length() const;
+	bool is_empty() const;
+	String get_text() const;
+
+	virtual String to_string() override;
+
+	TextBuilder() {}
+};
+
+#endif // TEXT_BUILDER_H
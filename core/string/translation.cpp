@@ -82,6 +82,7 @@ void Translation::_set_messages(const Dictionary &p_messages) {
 
 void Translation::set_locale(const String &p_locale) {
 	locale = TranslationServer::get_singleton()->standardize_locale(p_locale);
+	TranslationServer::invalidate_translate_cache();
 
 	if (Thread::is_main_thread()) {
 		_notify_translation_changed_if_applies();
@@ -99,12 +100,14 @@ void Translation::_notify_translation_changed_if_applies() {
 
 void Translation::add_message(const StringName &p_src_text, const StringName &p_xlated_text, const StringName &p_context) {
 	translation_map[p_src_text] = p_xlated_text;
+	TranslationServer::invalidate_translate_cache();
 }
 
 void Translation::add_plural_message(const StringName &p_src_text, const Vector<String> &p_plural_xlated_texts, const StringName &p_context) {
 	WARN_PRINT("Translation class doesn't handle plural messages. Calling add_plural_message() on a Translation instance is probably a mistake. \nUse a derived Translation class that handles plurals, such as TranslationPO class");
 	ERR_FAIL_COND_MSG(p_plural_xlated_texts.is_empty(), "Parameter vector p_plural_xlated_texts passed in is empty.");
 	translation_map[p_src_text] = p_plural_xlated_texts[0];
+	TranslationServer::invalidate_translate_cache();
 }
 
 StringName Translation::get_message(const StringName &p_src_text, const StringName &p_context) const {
@@ -141,6 +144,7 @@ void Translation::erase_message(const StringName &p_src_text, const StringName &
 	}
 
 	translation_map.erase(p_src_text);
+	TranslationServer::invalidate_translate_cache();
 }
 
 void Translation::get_message_list(List<StringName> *r_messages) const {
@@ -525,6 +529,7 @@ void TranslationServer::set_locale(const String &p_locale) {
 	}
 
 	locale = new_locale;
+	invalidate_translate_cache();
 	ResourceLoader::reload_translation_remaps();
 
 	if (OS::get_singleton()->get_main_loop()) {
@@ -551,10 +556,12 @@ PackedStringArray TranslationServer::get_loaded_locales() const {
 
 void TranslationServer::add_translation(const Ref<Translation> &p_translation) {
 	translations.insert(p_translation);
+	invalidate_translate_cache();
 }
 
 void TranslationServer::remove_translation(const Ref<Translation> &p_translation) {
 	translations.erase(p_translation);
+	invalidate_translate_cache();
 }
 
 Ref<Translation> TranslationServer::get_translation_object(const String &p_locale) {
@@ -580,6 +587,7 @@ Ref<Translation> TranslationServer::get_translation_object(const String &p_local
 
 void TranslationServer::clear() {
 	translations.clear();
+	invalidate_translate_cache();
 }
 
 StringName TranslationServer::translate(const StringName &p_message, const StringName &p_context) const {
@@ -589,6 +597,35 @@ StringName TranslationServer::translate(const StringName &p_message, const Strin
 		return p_message;
 	}
 
+	// Most messages come without context (e.g. auto-translated controls), those resolve through our cache.
+	const bool use_cache = p_context == StringName();
+	if (use_cache) {
+		MutexLock lock(translate_cache_mutex);
+		const uint32_t generation = translate_cache_generation.get();
+		if (translate_cache_valid_generation != generation) {
+			translate_cache.clear();
+			translate_cache_valid_generation = generation;
+
+			// Scripted translations may return different results for the same message.
+			translate_cache_enabled = true;
+			for (const Ref<Translation> &E : translations) {
+				if (E.is_valid() && E->get_script_instance()) {
+					translate_cache_enabled = false;
+					break;
+				}
+			}
+		}
+		if (translate_cache_enabled) {
+			HashMap<String, HashMap<StringName, StringName>>::ConstIterator L = translate_cache.find(locale);
+			if (L) {
+				HashMap<StringName, StringName>::ConstIterator E = L->value.find(p_message);
+				if (E) {
+					return E->value;
+				}
+			}
+		}
+	}
+
 	StringName res = _get_message_from_translations(p_message, p_context, locale, false);
 
 	if (!res && fallback.length() >= 2) {
@@ -596,10 +633,20 @@ StringName TranslationServer::translate(const StringName &p_message, const Strin
 	}
 
 	if (!res) {
-		return pseudolocalization_enabled ? pseudolocalize(p_message) : p_message;
+		res = pseudolocalization_enabled ? pseudolocalize(p_message) : p_message;
+	} else if (pseudolocalization_enabled) {
+		res = pseudolocalize(res);
 	}
 
-	return pseudolocalization_enabled ? pseudolocalize(res) : res;
+	if (use_cache) {
+		MutexLock lock(translate_cache_mutex);
+		// Skip storing if anything changed while we were resolving the message.
+		if (translate_cache_enabled && translate_cache_valid_generation == translate_cache_generation.get()) {
+			translate_cache[locale][p_message] = res;
+		}
+	}
+
+	return res;
 }
 
 StringName TranslationServer::translate_plural(const StringName &p_message, const StringName &p_message_plural, int p_n, const StringName &p_context) const {
@@ -658,6 +705,7 @@ StringName TranslationServer::_get_message_from_translations(const StringName &p
 }
 
 TranslationServer *TranslationServer::singleton = nullptr;
+SafeNumeric<uint32_t> TranslationServer::translate_cache_generation;
 
 bool TranslationServer::_load_translations(const String &p_from) {
 	if (ProjectSettings::get_singleton()->has_setting(p_from)) {
@@ -704,6 +752,8 @@ void TranslationServer::setup() {
 #ifdef TOOLS_ENABLED
 	ProjectSettings::get_singleton()->set_custom_property_info(PropertyInfo(Variant::STRING, "internationalization/locale/fallback", PROPERTY_HINT_LOCALE_ID, ""));
 #endif
+
+	invalidate_translate_cache();
 }
 
 void TranslationServer::set_tool_translation(const Ref<Translation> &p_translation) {
@@ -820,6 +870,7 @@ bool TranslationServer::is_pseudolocalization_enabled() const {
 
 void TranslationServer::set_pseudolocalization_enabled(bool p_enabled) {
 	pseudolocalization_enabled = p_enabled;
+	invalidate_translate_cache();
 
 	ResourceLoader::reload_translation_remaps();
 
@@ -841,6 +892,7 @@ void TranslationServer::reload_pseudolocalization() {
 	pseudolocalization_prefix = GLOBAL_GET("internationalization/pseudolocalization/prefix");
 	pseudolocalization_suffix = GLOBAL_GET("internationalization/pseudolocalization/suffix");
 	pseudolocalization_skip_placeholders_enabled = GLOBAL_GET("internationalization/pseudolocalization/skip_placeholders");
+	invalidate_translate_cache();
 
 	ResourceLoader::reload_translation_remaps();
 
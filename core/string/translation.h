@@ -33,6 +33,8 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/os/mutex.h"
+#include "core/templates/safe_refcount.h"
 
 class Translation : public Resource {
 	GDCLASS(Translation, Resource);
@@ -98,6 +100,14 @@ class TranslationServer : public Object {
 	String pseudolocalization_prefix;
 	String pseudolocalization_suffix;
 
+	// Resolved messages (without context) of translate(), per locale.
+	// The cache is emptied on first use after the generation changes.
+	static SafeNumeric<uint32_t> translate_cache_generation;
+	mutable Mutex translate_cache_mutex;
+	mutable HashMap<String, HashMap<StringName, StringName>> translate_cache;
+	mutable uint32_t translate_cache_valid_generation = UINT32_MAX;
+	mutable bool translate_cache_enabled = false;
+
 	StringName tool_pseudolocalize(const StringName &p_message) const;
 	String get_override_string(String &p_message) const;
 	String double_vowels(String &p_message) const;
@@ -139,7 +149,13 @@ class TranslationServer : public Object {
 public:
 	_FORCE_INLINE_ static TranslationServer *get_singleton() { return singleton; }
 
-	void set_enabled(bool p_enabled) { enabled = p_enabled; }
+	// Must be called whenever something changes the result of translating a message.
+	_FORCE_INLINE_ static void invalidate_translate_cache() { translate_cache_generation.increment(); }
+
+	void set_enabled(bool p_enabled) {
+		enabled = p_enabled;
+		invalidate_translate_cache();
+	}
 	_FORCE_INLINE_ bool is_enabled() const { return enabled; }
 
 	void set_locale(const String &p_locale);
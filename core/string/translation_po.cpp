@@ -207,6 +207,7 @@ void TranslationPO::add_message(const StringName &p_src_text, const StringName &
 	} else {
 		map_id_str[p_src_text].push_back(p_xlated_text);
 	}
+	TranslationServer::invalidate_translate_cache();
 }
 
 void TranslationPO::add_plural_message(const StringName &p_src_text, const Vector<String> &p_plural_xlated_texts, const StringName &p_context) {
@@ -222,6 +223,7 @@ void TranslationPO::add_plural_message(const StringName &p_src_text, const Vecto
 	for (int i = 0; i < p_plural_xlated_texts.size(); i++) {
 		map_id_str[p_src_text].push_back(p_plural_xlated_texts[i]);
 	}
+	TranslationServer::invalidate_translate_cache();
 }
 
 int TranslationPO::get_plural_forms() const {
@@ -273,6 +275,7 @@ void TranslationPO::erase_message(const StringName &p_src_text, const StringName
 	}
 
 	translation_map[p_context].erase(p_src_text);
+	TranslationServer::invalidate_translate_cache();
 }
 
 void TranslationPO::get_message_list(List<StringName> *r_messages) const {
@@ -70,6 +70,47 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 	return &sync_sems[idx];
 }
 
+void CommandQueueMT::_publish_batch() {
+	lock();
+	_commit_batch();
+	unlock();
+	if (sync) {
+		sync->post();
+	}
+}
+
+void CommandQueueMT::begin_batch() {
+	if (!sync) {
+		return;
+	}
+	const Thread::ID caller_id = Thread::get_caller_id();
+	if (batch_thread.get() == caller_id) {
+		batch_depth++;
+		return;
+	}
+	ERR_FAIL_COND_MSG(batch_thread.get() != 0, "Another thread already has a command batch open on this queue.");
+	batch_thread.set(caller_id);
+	batch_depth = 1;
+}
+
+void CommandQueueMT::end_batch() {
+	if (!sync) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(!_is_batching_thread(), "No command batch was opened from this thread.");
+	batch_depth--;
+	if (batch_depth == 0) {
+		_publish_batch();
+		batch_thread.set(0);
+	}
+}
+
+void CommandQueueMT::publish_batch() {
+	if (_is_batching_thread()) {
+		_publish_batch();
+	}
+}
+
 CommandQueueMT::CommandQueueMT(bool p_sync) {
 	if (p_sync) {
 		sync = memnew(Semaphore);
@@ -35,6 +35,7 @@
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
 #include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
@@ -248,16 +249,21 @@
 #define CMD_TYPE(N) Command##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
 #define CMD_ASSIGN_PARAM(N) cmd->p##N = p##N
 
-#define DECL_PUSH(N)                                                         \
-	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>       \
-	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>();                 \
-		cmd->instance = p_instance;                                          \
-		cmd->method = p_method;                                              \
-		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
-		unlock();                                                            \
-		if (sync)                                                            \
-			sync->post();                                                    \
+#define DECL_PUSH(N)                                                                                  \
+	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                                \
+	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) {                          \
+		const bool batched = _is_batching_thread();                                                   \
+		CMD_TYPE(N) *cmd = batched ? allocate<CMD_TYPE(N)>(batch_mem) : allocate_and_lock<CMD_TYPE(N)>(); \
+		cmd->instance = p_instance;                                                                   \
+		cmd->method = p_method;                                                                       \
+		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                          \
+		if (batched) {                                                                                \
+			_batch_pushed();                                                                          \
+			return;                                                                                   \
+		}                                                                                             \
+		unlock();                                                                                     \
+		if (sync)                                                                                     \
+			sync->post();                                                                             \
 	}
 
 #define CMD_RET_TYPE(N) CommandRet##N<T, M, COMMA_SEP_LIST(TYPE_ARG, N) COMMA(N) R>
@@ -334,6 +340,7 @@ class CommandQueueMT {
 
 	enum {
 		DEFAULT_COMMAND_MEM_SIZE_KB = 256,
+		BATCH_PUBLISH_SIZE_KB = 64,
 		SYNC_SEMAPHORES = 8
 	};
 
@@ -343,24 +350,59 @@ class CommandQueueMT {
 	Semaphore *sync = nullptr;
 	uint64_t flush_read_ptr = 0;
 
+	// While a thread has a batch open, its plain pushes are written to batch_mem without
+	// locking or waking up the consumer, and published all at once.
+	LocalVector<uint8_t> batch_mem;
+	SafeNumeric<Thread::ID> batch_thread;
+	uint32_t batch_depth = 0;
+
 	template <class T>
-	T *allocate() {
+	T *allocate(LocalVector<uint8_t> &p_mem) {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		uint64_t size = p_mem.size();
+		p_mem.resize(size + alloc_size + 8);
+		*(uint64_t *)&p_mem[size] = alloc_size;
+		T *cmd = memnew_placement(&p_mem[size + 8], T);
 		return cmd;
 	}
 
 	template <class T>
 	T *allocate_and_lock() {
 		lock();
-		T *ret = allocate<T>();
+		if (unlikely(_is_batching_thread())) {
+			// Keep the order of the commands batched so far.
+			_commit_batch();
+		}
+		T *ret = allocate<T>(command_mem);
 		return ret;
 	}
 
+	_FORCE_INLINE_ bool _is_batching_thread() const {
+		return unlikely(batch_thread.get() == Thread::get_caller_id());
+	}
+
+	// Must be called with the lock held.
+	void _commit_batch() {
+		if (batch_mem.is_empty()) {
+			return;
+		}
+		// Commands are relocated as plain memory, like command_mem itself does when it grows.
+		uint64_t size = command_mem.size();
+		command_mem.resize(size + batch_mem.size());
+		memcpy(&command_mem[size], batch_mem.ptr(), batch_mem.size());
+		batch_mem.clear();
+	}
+
+	void _publish_batch();
+
+	_FORCE_INLINE_ void _batch_pushed() {
+		if (unlikely(batch_mem.size() >= BATCH_PUBLISH_SIZE_KB * 1024)) {
+			// Don't let the consumer starve on very long batches.
+			_publish_batch();
+		}
+	}
+
 	void _flush() {
 		lock();
 
@@ -426,6 +468,15 @@ public:
 		_flush();
 	}
 
+	// Batches the commands pushed from the calling thread until the matching end_batch(), so they
+	// take the lock and wake up the consumer only once. Commands that sync or return a value
+	// publish the batch first, so ordering is kept. Batches can be nested, but only one thread
+	// can have a batch open at a time. Does nothing on queues without a consumer thread.
+	void begin_batch();
+	void end_batch();
+	// Publishes what the calling thread has batched so far, keeping the batch open.
+	void publish_batch();
+
 	CommandQueueMT(bool p_sync);
 	~CommandQueueMT();
 };
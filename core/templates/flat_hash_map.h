@@ -0,0 +1,545 @@
+/**************************************************************************/
+/*  flat_hash_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/math/math_funcs.h"
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * A flat HashMap implementation in the style of Swiss tables.
+ *
+ * Keys and values are stored inline in a single slot array, next to an array
+ * of one control byte per slot. A control byte is either empty, deleted, or
+ * holds 7 bits of the key hash, so a lookup compares a whole group of 16 of
+ * them at once (with SSE2 when available) and only touches the slots whose
+ * hash bits match.
+ *
+ * Compared to HashMap, there is no per-element allocation and lookups are
+ * more cache friendly, but:
+ * - Iteration order is unspecified and changes when the map grows.
+ * - Inserting can move elements, so pointers and iterators to them are only
+ *   valid until the next insertion.
+ *
+ * The assignment operator copy the pairs from one map to the other.
+ */
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+public:
+	static constexpr uint32_t GROUP_WIDTH = 16;
+	static constexpr uint32_t MIN_CAPACITY = GROUP_WIDTH;
+
+private:
+	typedef KeyValue<TKey, TValue> Element;
+
+	static constexpr int8_t CTRL_EMPTY = -128;
+	static constexpr int8_t CTRL_DELETED = -2;
+	static constexpr int8_t CTRL_SENTINEL = -1;
+
+	KeyValue<TKey, TValue> *slots = nullptr;
+	int8_t *ctrl = nullptr; // One byte per slot, plus a sentinel for iteration.
+
+	uint32_t capacity = 0; // Always a power of two multiple of GROUP_WIDTH, or zero.
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+	uint32_t group_shift = 32; // 32 - log2 of the number of groups.
+
+	// Bitmask with a bit set for each byte of the group equal to p_value.
+	static _FORCE_INLINE_ uint32_t _group_match(const int8_t *p_group, int8_t p_value) {
+#ifdef FLAT_HASH_MAP_SSE2
+		const __m128i group = _mm_loadu_si128((const __m128i *)p_group);
+		return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_value), group));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+			mask |= uint32_t(p_group[i] == p_value) << i;
+		}
+		return mask;
+#endif
+	}
+
+	// Bitmask of the bytes that are either empty or deleted (the ones with the sign bit set).
+	static _FORCE_INLINE_ uint32_t _group_match_free(const int8_t *p_group) {
+#ifdef FLAT_HASH_MAP_SSE2
+		return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p_group));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+			mask |= uint32_t(p_group[i] < 0) << i;
+		}
+		return mask;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint32_t _lowest_bit(uint32_t p_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctz(p_mask);
+#else
+		uint32_t index = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			index++;
+		}
+		return index;
+#endif
+	}
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		return Hasher::hash(p_key);
+	}
+
+	// Fibonacci hashing, so that hashes with poorly distributed high bits (like the djb2 ones of
+	// strings) still spread over all groups.
+	_FORCE_INLINE_ uint32_t _first_group(uint32_t p_hash) const {
+		return uint32_t(uint64_t(uint32_t(p_hash * 0x9E3779B1u)) >> group_shift);
+	}
+
+	_FORCE_INLINE_ static int8_t _h2(uint32_t p_hash) { return int8_t(p_hash & 0x7F); }
+
+	_FORCE_INLINE_ uint32_t _max_load() const { return capacity - capacity / 8; }
+
+	// Returns the slot holding p_key, or -1.
+	int64_t _lookup_pos(const TKey &p_key) const {
+		if (num_elements == 0) {
+			return -1;
+		}
+
+		const uint32_t hash = _hash(p_key);
+		const int8_t h2 = _h2(hash);
+		const uint32_t group_mask = capacity / GROUP_WIDTH - 1;
+		uint32_t group = _first_group(hash);
+
+		// Triangular probing over groups, which visits every group once.
+		for (uint32_t step = 1;; step++) {
+			const uint32_t base = group * GROUP_WIDTH;
+			uint32_t match = _group_match(&ctrl[base], h2);
+			while (match) {
+				const uint32_t pos = base + _lowest_bit(match);
+				if (Comparator::compare(slots[pos].key, p_key)) {
+					return pos;
+				}
+				match &= match - 1;
+			}
+			if (_group_match(&ctrl[base], CTRL_EMPTY)) {
+				return -1;
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	// Returns the first free slot in the probe sequence of p_hash.
+	uint32_t _find_free_pos(uint32_t p_hash) const {
+		const uint32_t group_mask = capacity / GROUP_WIDTH - 1;
+		uint32_t group = _first_group(p_hash);
+
+		for (uint32_t step = 1;; step++) {
+			const uint32_t base = group * GROUP_WIDTH;
+			const uint32_t free = _group_match_free(&ctrl[base]);
+			if (free) {
+				return base + _lowest_bit(free);
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		KeyValue<TKey, TValue> *old_slots = slots;
+		int8_t *old_ctrl = ctrl;
+		const uint32_t old_capacity = capacity;
+
+		capacity = p_new_capacity;
+		group_shift = 32 - get_shift_from_power_of_2(capacity / GROUP_WIDTH);
+		slots = reinterpret_cast<KeyValue<TKey, TValue> *>(Memory::alloc_static(sizeof(KeyValue<TKey, TValue>) * capacity));
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + 1));
+		memset(ctrl, (uint8_t)CTRL_EMPTY, capacity);
+		ctrl[capacity] = CTRL_SENTINEL;
+		num_deleted = 0;
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue;
+			}
+			const uint32_t hash = _hash(old_slots[i].key);
+			const uint32_t pos = _find_free_pos(hash);
+			ctrl[pos] = _h2(hash);
+			memnew_placement(&slots[pos], Element(old_slots[i]));
+			old_slots[i].~KeyValue<TKey, TValue>();
+		}
+
+		Memory::free_static(old_slots);
+		Memory::free_static(old_ctrl);
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value) {
+		int64_t existing = _lookup_pos(p_key);
+		if (existing >= 0) {
+			slots[existing].value = p_value;
+			return existing;
+		}
+
+		if (unlikely(num_elements + num_deleted + 1 > _max_load())) {
+			// Rehash in place when most of the load comes from deleted slots.
+			const bool grow = capacity == 0 || num_elements + 1 > _max_load() / 2;
+			_resize_and_rehash(grow ? MAX(MIN_CAPACITY, capacity * 2) : capacity);
+		}
+
+		const uint32_t hash = _hash(p_key);
+		const uint32_t pos = _find_free_pos(hash);
+		if (ctrl[pos] == CTRL_DELETED) {
+			num_deleted--;
+		}
+		ctrl[pos] = _h2(hash);
+		memnew_placement(&slots[pos], Element(p_key, p_value));
+		num_elements++;
+		return pos;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		slots[p_pos].~KeyValue<TKey, TValue>();
+		// A group only ever gets a new empty slot when rehashing, so if it still has one, no probe sequence
+		// continued past it and the slot can be marked empty instead of leaving a tombstone.
+		const uint32_t base = p_pos & ~(GROUP_WIDTH - 1);
+		if (_group_match(&ctrl[base], CTRL_EMPTY)) {
+			ctrl[p_pos] = CTRL_EMPTY;
+		} else {
+			ctrl[p_pos] = CTRL_DELETED;
+			num_deleted++;
+		}
+		num_elements--;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr) {
+			return;
+		}
+		if constexpr (!std::is_trivially_destructible_v<KeyValue<TKey, TValue>>) {
+			for (uint32_t i = 0; i < capacity && num_elements > 0; i++) {
+				if (ctrl[i] >= 0) {
+					slots[i].~KeyValue<TKey, TValue>();
+					num_elements--;
+				}
+			}
+		}
+		memset(ctrl, (uint8_t)CTRL_EMPTY, capacity);
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		int64_t pos = _lookup_pos(p_key);
+		CRASH_COND_MSG(pos < 0, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		int64_t pos = _lookup_pos(p_key);
+		CRASH_COND_MSG(pos < 0, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos >= 0) {
+			return &slots[pos].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos >= 0) {
+			return &slots[pos].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup_pos(p_key) >= 0;
+	}
+
+	bool erase(const TKey &p_key) {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos < 0) {
+			return false;
+		}
+		_erase_pos(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = MAX(MIN_CAPACITY, next_power_of_2(p_new_capacity + p_new_capacity / 7 + 1));
+		if (new_capacity <= capacity) {
+			return;
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return *slot;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return slot; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (slot) {
+				do {
+					state++;
+					slot++;
+				} while (*state < 0 && *state != CTRL_SENTINEL);
+				if (*state == CTRL_SENTINEL) {
+					state = nullptr;
+					slot = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return slot != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const int8_t *p_state, const KeyValue<TKey, TValue> *p_slot) {
+			state = p_state;
+			slot = p_slot;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			state = p_it.state;
+			slot = p_it.slot;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			state = p_it.state;
+			slot = p_it.slot;
+		}
+
+	private:
+		const int8_t *state = nullptr;
+		const KeyValue<TKey, TValue> *slot = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return *slot;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return slot; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (slot) {
+				do {
+					state++;
+					slot++;
+				} while (*state < 0 && *state != CTRL_SENTINEL);
+				if (*state == CTRL_SENTINEL) {
+					state = nullptr;
+					slot = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return slot != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(const int8_t *p_state, KeyValue<TKey, TValue> *p_slot) {
+			state = p_state;
+			slot = p_slot;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			state = p_it.state;
+			slot = p_it.slot;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			state = p_it.state;
+			slot = p_it.slot;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(state, slot);
+		}
+
+	private:
+		const int8_t *state = nullptr;
+		KeyValue<TKey, TValue> *slot = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		if (num_elements == 0) {
+			return Iterator();
+		}
+		uint32_t pos = 0;
+		while (ctrl[pos] < 0) {
+			pos++;
+		}
+		return Iterator(&ctrl[pos], &slots[pos]);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator();
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos < 0) {
+			return end();
+		}
+		return Iterator(&ctrl[pos], &slots[pos]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		if (num_elements == 0) {
+			return ConstIterator();
+		}
+		uint32_t pos = 0;
+		while (ctrl[pos] < 0) {
+			pos++;
+		}
+		return ConstIterator(&ctrl[pos], &slots[pos]);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator();
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos < 0) {
+			return end();
+		}
+		return ConstIterator(&ctrl[pos], &slots[pos]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		int64_t pos = _lookup_pos(p_key);
+		CRASH_COND(pos < 0);
+		return slots[pos].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		int64_t pos = _lookup_pos(p_key);
+		if (pos < 0) {
+			pos = _insert(p_key, TValue());
+		}
+		return slots[pos].value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t pos = _insert(p_key, p_value);
+		return Iterator(&ctrl[pos], &slots[pos]);
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		if (p_other.num_elements == 0) {
+			return; // Nothing to copy.
+		}
+
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+
+		if (ctrl != nullptr) {
+			Memory::free_static(slots);
+			Memory::free_static(ctrl);
+		}
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
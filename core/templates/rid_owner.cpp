@@ -31,3 +31,42 @@
 #include "rid_owner.h"
 
 SafeNumeric<uint64_t> RID_AllocBase::base_id{ 1 };
+SpinLock RID_AllocBase::alloc_list_lock;
+RID_AllocBase *RID_AllocBase::alloc_list = nullptr;
+
+void RID_AllocBase::_register_alloc() {
+	alloc_list_lock.lock();
+	alloc_next = alloc_list;
+	if (alloc_list) {
+		alloc_list->alloc_prev = this;
+	}
+	alloc_list = this;
+	alloc_list_lock.unlock();
+}
+
+void RID_AllocBase::_unregister_alloc() {
+	alloc_list_lock.lock();
+	if (alloc_prev) {
+		alloc_prev->alloc_next = alloc_next;
+	} else {
+		alloc_list = alloc_next;
+	}
+	if (alloc_next) {
+		alloc_next->alloc_prev = alloc_prev;
+	}
+	alloc_prev = nullptr;
+	alloc_next = nullptr;
+	alloc_list_lock.unlock();
+}
+
+void RID_AllocBase::get_alloc_info_list(List<AllocInfo> *r_list) {
+	alloc_list_lock.lock();
+	for (const RID_AllocBase *alloc = alloc_list; alloc; alloc = alloc->alloc_next) {
+		AllocInfo info;
+		info.description = alloc->_get_alloc_description();
+		info.count = alloc->_get_alloc_count();
+		info.element_size = alloc->_get_alloc_element_size();
+		r_list->push_back(info);
+	}
+	alloc_list_lock.unlock();
+}
@@ -43,10 +43,29 @@
 #include <stdio.h>
 #include <typeinfo>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 class RID_AllocBase {
 	static SafeNumeric<uint64_t> base_id;
 
+	// Every live allocator, for memory reporting.
+	static SpinLock alloc_list_lock;
+	static RID_AllocBase *alloc_list;
+	RID_AllocBase *alloc_prev = nullptr;
+	RID_AllocBase *alloc_next = nullptr;
+
 protected:
+	// Called by the derived allocators (not in the base constructor/destructor),
+	// so that the list never holds a partially constructed or destroyed allocator.
+	void _register_alloc();
+	void _unregister_alloc();
+
+	virtual const char *_get_alloc_description() const = 0;
+	virtual uint32_t _get_alloc_count() const = 0;
+	virtual uint64_t _get_alloc_element_size() const = 0;
+
 	static RID _make_from_id(uint64_t p_id) {
 		RID rid;
 		rid._id = p_id;
@@ -64,39 +83,86 @@ protected:
 	}
 
 public:
+	struct AllocInfo {
+		const char *description = nullptr;
+		uint32_t count = 0;
+		uint64_t element_size = 0;
+	};
+
+	static void get_alloc_info_list(List<AllocInfo> *r_list);
+
 	virtual ~RID_AllocBase() {}
 };
 
 template <class T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
+	struct Chunk {
+		T *data = nullptr;
+		SafeNumeric<uint32_t> *validators = nullptr;
+	};
+
+	// Lookups don't take the lock, so a chunk must never move once readers can see it.
+	// Chunks are kept in segments of doubling size (1, 2, 4...) which are allocated on
+	// demand and only released on destruction. A new chunk is published to readers by
+	// increasing max_alloc, after it has been fully set up.
+	static constexpr uint32_t MAX_SEGMENTS = 32;
+	Chunk *chunk_segments[MAX_SEGMENTS] = {};
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	SafeNumeric<uint32_t> max_alloc;
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
+	static _FORCE_INLINE_ uint32_t _get_segment(uint32_t p_chunk) {
+		// Segment s holds chunks [2^s - 1, 2^(s+1) - 1), so it is the position of the highest bit of p_chunk + 1.
+		const uint32_t value = p_chunk + 1;
+#if defined(__GNUC__) || defined(__clang__)
+		return 31 - __builtin_clz(value);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, value);
+		return index;
+#else
+		uint32_t index = 0;
+		while (value >> (index + 1)) {
+			index++;
+		}
+		return index;
+#endif
+	}
+
+	_FORCE_INLINE_ Chunk &_get_chunk(uint32_t p_chunk) const {
+		const uint32_t segment = _get_segment(p_chunk);
+		return chunk_segments[segment][p_chunk + 1 - (1u << segment)];
+	}
+
+	_FORCE_INLINE_ SafeNumeric<uint32_t> &_get_validator(uint32_t p_idx) const {
+		return _get_chunk(p_idx / elements_in_chunk).validators[p_idx % elements_in_chunk];
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
 
-		if (alloc_count == max_alloc) {
+		const uint32_t current_max_alloc = max_alloc.get();
+		if (alloc_count == current_max_alloc) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = current_max_alloc / elements_in_chunk;
+			uint32_t segment = _get_segment(chunk_count);
+			CRASH_COND_MSG(segment >= MAX_SEGMENTS, "Overflow in RID chunks");
+			if (chunk_segments[segment] == nullptr) {
+				chunk_segments[segment] = memnew_arr(Chunk, 1u << segment);
+			}
 
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			Chunk &chunk = _get_chunk(chunk_count);
+			chunk.data = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			chunk.validators = (SafeNumeric<uint32_t> *)memalloc(sizeof(SafeNumeric<uint32_t>) * elements_in_chunk);
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 			//grow free lists
 			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
@@ -104,27 +170,23 @@ class RID_Alloc : public RID_AllocBase {
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				memnew_placement(&chunk.validators[i], SafeNumeric<uint32_t>(0xFFFFFFFF));
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			// Publish the chunk to readers.
+			max_alloc.set(current_max_alloc + elements_in_chunk);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
-
 		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
 		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_validator(free_index).set(validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -135,6 +197,48 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	T *_initialize_rid(const RID &p_rid) {
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		if (unlikely(p_rid == RID() || idx >= max_alloc.get())) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			return nullptr;
+		}
+
+		SafeNumeric<uint32_t> &validator_slot = _get_validator(idx);
+		uint32_t validator = uint32_t(id >> 32);
+
+		if (unlikely(!(validator_slot.get() & 0x80000000))) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+
+		if (unlikely((validator_slot.get() & 0x7FFFFFFF) != validator)) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		validator_slot.set(validator); //initialized
+
+		T *ptr = &_get_chunk(idx / elements_in_chunk).data[idx % elements_in_chunk];
+
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+
+		return ptr;
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -152,62 +256,35 @@ public:
 		return _allocate_rid();
 	}
 
+	// Never locks, even when THREAD_SAFE: the validator tells whether the RID is still alive.
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
+		if (unlikely(p_initialize)) {
+			return _initialize_rid(p_rid);
+		}
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
+		const Chunk &chunk = _get_chunk(idx / elements_in_chunk);
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
+		uint32_t current_validator = chunk.validators[idx_element].get();
 
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		if (unlikely(current_validator != validator)) {
+			if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &chunk.data[idx_element];
 	}
 	void initialize_rid(RID p_rid) {
 		T *mem = get_or_null(p_rid, true);
@@ -221,31 +298,15 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_get_validator(idx).get() & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -255,31 +316,33 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.get())) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
+		Chunk &chunk = _get_chunk(idx / elements_in_chunk);
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		uint32_t current_validator = chunk.validators[idx_element].get();
+		if (unlikely(current_validator & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID.");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current_validator != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		// Invalidate first, so lookups racing with the free stop handing out the element before it's destroyed.
+		chunk.validators[idx_element].set(0xFFFFFFFF); // go invalid
+		chunk.data[idx_element].~T();
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -296,8 +359,9 @@ public:
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		const uint32_t current_max_alloc = max_alloc.get();
+		for (uint32_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = _get_validator(i).get();
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -313,8 +377,9 @@ public:
 			spin_lock.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		const uint32_t current_max_alloc = max_alloc.get();
+		for (uint32_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = _get_validator(i).get();
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -329,37 +394,56 @@ public:
 		description = p_descrption;
 	}
 
+protected:
+	virtual const char *_get_alloc_description() const override {
+		return description ? description : typeid(T).name();
+	}
+	virtual uint32_t _get_alloc_count() const override {
+		return alloc_count;
+	}
+	virtual uint64_t _get_alloc_element_size() const override {
+		return sizeof(T);
+	}
+
+public:
 	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536) {
 		elements_in_chunk = sizeof(T) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(T));
+		_register_alloc();
 	}
 
 	~RID_Alloc() {
+		_unregister_alloc();
+		const uint32_t current_max_alloc = max_alloc.get();
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			for (uint32_t i = 0; i < current_max_alloc; i++) {
+				uint32_t validator = _get_validator(i).get();
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
 				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+					_get_chunk(i / elements_in_chunk).data[i % elements_in_chunk].~T();
 				}
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = current_max_alloc / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
+			Chunk &chunk = _get_chunk(i);
+			memfree(chunk.data);
+			memfree(chunk.validators);
 			memfree(free_list_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
+		if (free_list_chunks) {
 			memfree(free_list_chunks);
-			memfree(validator_chunks);
+		}
+		for (uint32_t i = 0; i < MAX_SEGMENTS; i++) {
+			if (chunk_segments[i]) {
+				memdelete_arr(chunk_segments[i]);
+			}
 		}
 	}
 };
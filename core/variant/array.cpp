@@ -40,6 +40,7 @@
 #include "core/variant/callable.h"
 #include "core/variant/dictionary.h"
 #include "core/variant/variant.h"
+#include "core/variant/variant_internal.h"
 
 class ArrayPrivate {
 public:
@@ -49,6 +50,101 @@ public:
 	ContainerTypeValidate typed;
 };
 
+// Arrays typed with int, float or String are searched, sorted and compared on the native
+// values instead of going through the Variant evaluator. Elements are still checked for
+// the expected type, since operator[] allows storing anything.
+template <typename T>
+struct _ArrayNative;
+
+template <>
+struct _ArrayNative<int64_t> {
+	static constexpr Variant::Type TYPE = Variant::INT;
+	static _FORCE_INLINE_ const int64_t &get(const Variant &p_variant) { return *VariantInternal::get_int(&p_variant); }
+	static _FORCE_INLINE_ bool equal(int64_t p_a, int64_t p_b) { return p_a == p_b; }
+};
+
+template <>
+struct _ArrayNative<double> {
+	static constexpr Variant::Type TYPE = Variant::FLOAT;
+	static _FORCE_INLINE_ const double &get(const Variant &p_variant) { return *VariantInternal::get_float(&p_variant); }
+	// Same as Variant::hash_compare(), which treats NaN as equal to itself.
+	static _FORCE_INLINE_ bool equal(double p_a, double p_b) { return p_a == p_b || (Math::is_nan(p_a) && Math::is_nan(p_b)); }
+};
+
+template <>
+struct _ArrayNative<String> {
+	static constexpr Variant::Type TYPE = Variant::STRING;
+	static _FORCE_INLINE_ const String &get(const Variant &p_variant) { return *VariantInternal::get_string(&p_variant); }
+	static _FORCE_INLINE_ bool equal(const String &p_a, const String &p_b) { return p_a == p_b; }
+};
+
+template <typename T>
+struct _ArrayNativeSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		return _ArrayNative<T>::get(p_l) < _ArrayNative<T>::get(p_r);
+	}
+};
+
+static _FORCE_INLINE_ bool _is_native_type(Variant::Type p_type) {
+	return p_type == Variant::INT || p_type == Variant::FLOAT || p_type == Variant::STRING;
+}
+
+static bool _all_of_type(const Vector<Variant> &p_array, Variant::Type p_type) {
+	for (const Variant &E : p_array) {
+		if (E.get_type() != p_type) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename T>
+static _FORCE_INLINE_ bool _native_equal(const Variant &p_element, const T &p_native, const Variant &p_value) {
+	if (likely(p_element.get_type() == _ArrayNative<T>::TYPE)) {
+		return _ArrayNative<T>::equal(_ArrayNative<T>::get(p_element), p_native);
+	}
+	return StringLikeVariantComparator::compare(p_element, p_value);
+}
+
+template <typename T>
+static int _find_native(const Vector<Variant> &p_array, const Variant &p_value, int p_from, int p_to, int p_step) {
+	const T &native = _ArrayNative<T>::get(p_value);
+	const Variant *data = p_array.ptr();
+	for (int i = p_from; i != p_to; i += p_step) {
+		if (_native_equal<T>(data[i], native, p_value)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <typename T>
+static int _count_native(const Vector<Variant> &p_array, const Variant &p_value) {
+	const T &native = _ArrayNative<T>::get(p_value);
+	int amount = 0;
+	for (const Variant &E : p_array) {
+		if (_native_equal<T>(E, native, p_value)) {
+			amount++;
+		}
+	}
+	return amount;
+}
+
+// Returns the index of the smallest (or largest) element, all elements must be of the native type.
+template <typename T>
+static int _find_extreme_native(const Vector<Variant> &p_array, bool p_max) {
+	const Variant *data = p_array.ptr();
+	int found = 0;
+	for (int i = 1; i < p_array.size(); i++) {
+		const T &test = _ArrayNative<T>::get(data[i]);
+		const T &current = _ArrayNative<T>::get(data[found]);
+		if (p_max ? current < test : test < current) {
+			found = i;
+		}
+	}
+	return found;
+}
+
 void Array::_ref(const Array &p_from) const {
 	ArrayPrivate *_fp = p_from._p;
 
@@ -343,6 +439,17 @@ int Array::find(const Variant &p_value, int p_from) const {
 		return ret;
 	}
 
+	if (_is_native_type(_p->typed.type) && value.get_type() == _p->typed.type) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				return _find_native<int64_t>(_p->array, value, p_from, MAX(p_from, size()), 1);
+			case Variant::FLOAT:
+				return _find_native<double>(_p->array, value, p_from, MAX(p_from, size()), 1);
+			default:
+				return _find_native<String>(_p->array, value, p_from, MAX(p_from, size()), 1);
+		}
+	}
+
 	for (int i = p_from; i < size(); i++) {
 		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
 			ret = i;
@@ -369,6 +476,17 @@ int Array::rfind(const Variant &p_value, int p_from) const {
 		p_from = _p->array.size() - 1;
 	}
 
+	if (_is_native_type(_p->typed.type) && value.get_type() == _p->typed.type) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				return _find_native<int64_t>(_p->array, value, p_from, -1, -1);
+			case Variant::FLOAT:
+				return _find_native<double>(_p->array, value, p_from, -1, -1);
+			default:
+				return _find_native<String>(_p->array, value, p_from, -1, -1);
+		}
+	}
+
 	for (int i = p_from; i >= 0; i--) {
 		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
 			return i;
@@ -385,6 +503,17 @@ int Array::count(const Variant &p_value) const {
 		return 0;
 	}
 
+	if (_is_native_type(_p->typed.type) && value.get_type() == _p->typed.type) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				return _count_native<int64_t>(_p->array, value);
+			case Variant::FLOAT:
+				return _count_native<double>(_p->array, value);
+			default:
+				return _count_native<String>(_p->array, value);
+		}
+	}
+
 	int amount = 0;
 	for (int i = 0; i < _p->array.size(); i++) {
 		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
@@ -432,6 +561,12 @@ Array Array::recursive_duplicate(bool p_deep, int recursion_count) const {
 		return new_arr;
 	}
 
+	// Values of these types are not containers, so a deep copy is the same as a shallow one.
+	const Variant::Type type = _p->typed.type;
+	if (p_deep && type != Variant::NIL && type != Variant::ARRAY && type != Variant::DICTIONARY && type < Variant::PACKED_BYTE_ARRAY) {
+		p_deep = false;
+	}
+
 	if (p_deep) {
 		recursion_count++;
 		int element_count = size();
@@ -482,16 +617,20 @@ Array Array::slice(int p_begin, int p_end, int p_step, bool p_deep) const {
 }
 
 Array Array::filter(const Callable &p_callable) const {
+	const int count = size();
 	Array new_arr;
-	new_arr.resize(size());
+	new_arr.resize(count);
 	new_arr._p->typed = _p->typed;
 	int accepted_count = 0;
 
+	// The new array isn't shared until it's returned, so write to its storage directly.
+	Variant *dst = new_arr._p->array.ptrw();
+	Variant result;
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
+	for (int i = 0; i < count; i++) {
+		ERR_FAIL_COND_V_MSG(i >= size(), Array(), "Array was resized while calling method from 'filter'.");
 		argptrs[0] = &get(i);
 
-		Variant result;
 		Callable::CallError ce;
 		p_callable.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
@@ -499,7 +638,8 @@ Array Array::filter(const Callable &p_callable) const {
 		}
 
 		if (result.operator bool()) {
-			new_arr[accepted_count] = get(i);
+			ERR_FAIL_COND_V_MSG(i >= size(), Array(), "Array was resized while calling method from 'filter'.");
+			dst[accepted_count] = get(i);
 			accepted_count++;
 		}
 	}
@@ -510,21 +650,22 @@ Array Array::filter(const Callable &p_callable) const {
 }
 
 Array Array::map(const Callable &p_callable) const {
+	const int count = size();
 	Array new_arr;
-	new_arr.resize(size());
+	new_arr.resize(count);
 
+	// The new array isn't shared until it's returned, so results are written to its storage directly.
+	Variant *dst = new_arr._p->array.ptrw();
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
+	for (int i = 0; i < count; i++) {
+		ERR_FAIL_COND_V_MSG(i >= size(), Array(), "Array was resized while calling method from 'map'.");
 		argptrs[0] = &get(i);
 
-		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 1, result, ce);
+		p_callable.callp(argptrs, 1, dst[i], ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(Array(), "Error calling method from 'map': " + Variant::get_callable_error_text(p_callable, argptrs, 1, ce));
 		}
-
-		new_arr[i] = result;
 	}
 
 	return new_arr;
@@ -538,12 +679,12 @@ Variant Array::reduce(const Callable &p_callable, const Variant &p_accum) const
 		start = 1;
 	}
 
+	Variant result;
 	const Variant *argptrs[2];
 	for (int i = start; i < size(); i++) {
 		argptrs[0] = &ret;
 		argptrs[1] = &get(i);
 
-		Variant result;
 		Callable::CallError ce;
 		p_callable.callp(argptrs, 2, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
@@ -556,11 +697,11 @@ Variant Array::reduce(const Callable &p_callable, const Variant &p_accum) const
 }
 
 bool Array::any(const Callable &p_callable) const {
+	Variant result;
 	const Variant *argptrs[1];
 	for (int i = 0; i < size(); i++) {
 		argptrs[0] = &get(i);
 
-		Variant result;
 		Callable::CallError ce;
 		p_callable.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
@@ -578,11 +719,11 @@ bool Array::any(const Callable &p_callable) const {
 }
 
 bool Array::all(const Callable &p_callable) const {
+	Variant result;
 	const Variant *argptrs[1];
 	for (int i = 0; i < size(); i++) {
 		argptrs[0] = &get(i);
 
-		Variant result;
 		Callable::CallError ce;
 		p_callable.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
@@ -613,6 +754,19 @@ struct _ArrayVariantSort {
 
 void Array::sort() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_is_native_type(_p->typed.type) && _all_of_type(_p->array, _p->typed.type)) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				_p->array.sort_custom<_ArrayNativeSort<int64_t>>();
+				return;
+			case Variant::FLOAT:
+				_p->array.sort_custom<_ArrayNativeSort<double>>();
+				return;
+			default:
+				_p->array.sort_custom<_ArrayNativeSort<String>>();
+				return;
+		}
+	}
 	_p->array.sort_custom<_ArrayVariantSort>();
 }
 
@@ -710,6 +864,17 @@ Variant Array::pop_at(int p_pos) {
 }
 
 Variant Array::min() const {
+	if (!_p->array.is_empty() && _is_native_type(_p->typed.type) && _all_of_type(_p->array, _p->typed.type)) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				return _p->array[_find_extreme_native<int64_t>(_p->array, false)];
+			case Variant::FLOAT:
+				return _p->array[_find_extreme_native<double>(_p->array, false)];
+			default:
+				return _p->array[_find_extreme_native<String>(_p->array, false)];
+		}
+	}
+
 	Variant minval;
 	for (int i = 0; i < size(); i++) {
 		if (i == 0) {
@@ -732,6 +897,17 @@ Variant Array::min() const {
 }
 
 Variant Array::max() const {
+	if (!_p->array.is_empty() && _is_native_type(_p->typed.type) && _all_of_type(_p->array, _p->typed.type)) {
+		switch (_p->typed.type) {
+			case Variant::INT:
+				return _p->array[_find_extreme_native<int64_t>(_p->array, true)];
+			case Variant::FLOAT:
+				return _p->array[_find_extreme_native<double>(_p->array, true)];
+			default:
+				return _p->array[_find_extreme_native<String>(_p->array, true)];
+		}
+	}
+
 	Variant maxval;
 	for (int i = 0; i < size(); i++) {
 		if (i == 0) {
@@ -35,6 +35,8 @@
 #include "core/object/script_language.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/string/string_builder.h"
+#include "core/templates/local_vector.h"
 
 char32_t VariantParser::Stream::get_char() {
 	// is within buffer?
@@ -595,6 +597,135 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 	return OK;
 }
 
+// Packed numeric arrays can hold millions of elements in scene files (mesh data, tile maps),
+// so their elements are scanned straight from the stream into the array instead of going
+// through a token and a Variant per element like _parse_construct() does.
+template <class T>
+Error VariantParser::_parse_packed_array(Stream *p_stream, Vector<T> &r_array, int &line, String &r_err_str) {
+	Token token;
+	get_token(p_stream, token, line, r_err_str);
+	if (token.type != TK_PARENTHESIS_OPEN) {
+		r_err_str = "Expected '(' in constructor";
+		return ERR_PARSE_ERROR;
+	}
+
+	LocalVector<T> values;
+	char buf[128];
+	bool first = true;
+	bool expect_value = true;
+
+	char32_t c = p_stream->saved;
+	p_stream->saved = 0;
+	if (!c) {
+		c = p_stream->get_char();
+	}
+
+	while (true) {
+		if (c == 0) {
+			r_err_str = "Unexpected EOF in constructor";
+			return ERR_PARSE_ERROR;
+		} else if (c == '\n') {
+			line++;
+			c = p_stream->get_char();
+			continue;
+		} else if (c <= 32) {
+			c = p_stream->get_char();
+			continue;
+		} else if (c == ';') {
+			// Comment, skip until the end of the line (which is handled above).
+			while (c != '\n' && c != 0) {
+				c = p_stream->get_char();
+			}
+			continue;
+		}
+
+		if (!expect_value) {
+			if (c == ')') {
+				break;
+			} else if (c != ',') {
+				r_err_str = "Expected ',' or ')' in constructor";
+				return ERR_PARSE_ERROR;
+			}
+			expect_value = true;
+			c = p_stream->get_char();
+			continue;
+		}
+
+		if (first && c == ')') {
+			break;
+		}
+
+		int len = 0;
+		if (c == '-' || is_digit(c)) {
+			// Same grammar as the number tokens in get_token().
+			bool is_float = false;
+			bool in_exp = false;
+			bool exp_sign = false;
+			bool exp_beg = false;
+			if (c == '-') {
+				buf[len++] = '-';
+				c = p_stream->get_char();
+			}
+			while (true) {
+				if (is_digit(c)) {
+					exp_beg = in_exp;
+				} else if (c == '.' && !is_float) {
+					is_float = true;
+				} else if (c == 'e' && !in_exp) {
+					is_float = true;
+					in_exp = true;
+				} else if ((c == '-' || c == '+') && in_exp && !exp_sign && !exp_beg) {
+					exp_sign = true;
+				} else {
+					break;
+				}
+				if (len == (int)sizeof(buf) - 1) {
+					r_err_str = "Number too long in constructor";
+					return ERR_PARSE_ERROR;
+				}
+				buf[len++] = (char)c;
+				c = p_stream->get_char();
+			}
+			buf[len] = 0;
+
+			if (is_float) {
+				values.push_back(T(String::to_float(buf)));
+			} else {
+				values.push_back(T(String::to_int(buf, len)));
+			}
+		} else if (is_ascii_char(c) || is_underscore(c)) {
+			while (is_ascii_char(c) || is_underscore(c) || is_digit(c)) {
+				if (len == (int)sizeof(buf) - 1) {
+					break;
+				}
+				buf[len++] = (char)c;
+				c = p_stream->get_char();
+			}
+			buf[len] = 0;
+
+			double real = stor_fix(String(buf));
+			if (real == -1) {
+				r_err_str = "Expected float in constructor";
+				return ERR_PARSE_ERROR;
+			}
+			values.push_back(T(real));
+		} else {
+			r_err_str = "Expected float in constructor";
+			return ERR_PARSE_ERROR;
+		}
+
+		first = false;
+		expect_value = false;
+	}
+
+	r_array.resize(values.size());
+	if (values.size()) {
+		memcpy(r_array.ptrw(), values.ptr(), values.size() * sizeof(T));
+	}
+
+	return OK;
+}
+
 Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream, int &line, String &r_err_str, ResourceParser *p_res_parser) {
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
 		Dictionary d;
@@ -1147,94 +1278,44 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = array;
 		} else if (id == "PackedByteArray" || id == "PoolByteArray" || id == "ByteArray") {
-			Vector<uint8_t> args;
-			Error err = _parse_construct<uint8_t>(p_stream, args, line, r_err_str);
+			Vector<uint8_t> arr;
+			Error err = _parse_packed_array<uint8_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
-			Vector<int32_t> args;
-			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
+			Vector<int32_t> arr;
+			Error err = _parse_packed_array<int32_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedInt64Array") {
-			Vector<int64_t> args;
-			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
+			Vector<int64_t> arr;
+			Error err = _parse_packed_array<int64_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
-			Vector<float> args;
-			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
+			Vector<float> arr;
+			Error err = _parse_packed_array<float>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedFloat64Array") {
-			Vector<double> args;
-			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
+			Vector<double> arr;
+			Error err = _parse_packed_array<double>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
@@ -2177,13 +2258,14 @@ Error VariantWriter::write(const Variant &p_variant, StoreStringFunc p_store_str
 }
 
 static Error _write_to_str(void *ud, const String &p_string) {
-	String *str = (String *)ud;
-	(*str) += p_string;
+	StringBuilder *builder = (StringBuilder *)ud;
+	builder->append(p_string);
 	return OK;
 }
 
 Error VariantWriter::write_to_string(const Variant &p_variant, String &r_string, EncodeResourceFunc p_encode_res_func, void *p_encode_res_ud) {
-	r_string = String();
-
-	return write(p_variant, _write_to_str, &r_string, p_encode_res_func, p_encode_res_ud);
+	StringBuilder builder;
+	Error err = write(p_variant, _write_to_str, &builder, p_encode_res_func, p_encode_res_ud);
+	r_string = builder.as_string();
+	return err;
 }
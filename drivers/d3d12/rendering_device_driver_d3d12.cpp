@@ -5887,6 +5887,12 @@ uint64_t RenderingDeviceDriverD3D12::get_total_memory_used() {
 	return stats.Total.Stats.BlockBytes;
 }
 
+uint64_t RenderingDeviceDriverD3D12::get_memory_budget() {
+	D3D12MA::Budget local_budget = {};
+	allocator->GetBudget(&local_budget, nullptr);
+	return local_budget.BudgetBytes;
+}
+
 uint64_t RenderingDeviceDriverD3D12::limit_get(Limit p_limit) {
 	uint64_t safe_unbounded = ((uint64_t)1 << 30);
 	switch (p_limit) {
@@ -5964,6 +5970,8 @@ bool RenderingDeviceDriverD3D12::has_feature(Features p_feature) {
 			return vrs_capabilities.ss_image_supported;
 		case SUPPORTS_FRAGMENT_SHADER_WITH_ONLY_SIDE_EFFECTS:
 			return true;
+		case SUPPORTS_DRAW_INDIRECT_COUNT:
+			return true;
 		default:
 			return false;
 	}
@@ -2896,6 +2896,41 @@ void RasterizerSceneGLES3::_render_post_processing(const RenderDataGLES3 *p_rend
 	}
 }
 
+bool RasterizerSceneGLES3::_geometry_instance_can_auto_instance(const GeometryInstanceGLES3 *p_inst, bool p_uses_additive_passes) const {
+	if (p_inst->instance_count >= 0 || p_inst->mesh_instance.is_valid()) {
+		// Already instanced (MultiMesh or particles), or using skeletons or blend shapes.
+		return false;
+	}
+	if (p_inst->lightmap_instance.is_valid() || p_inst->lightmap_sh) {
+		return false;
+	}
+	if (p_uses_additive_passes && !p_inst->light_passes.is_empty()) {
+		// Additive passes are drawn per instance.
+		return false;
+	}
+	return true;
+}
+
+bool RasterizerSceneGLES3::_geometry_instances_can_share_draw(const GeometryInstanceGLES3 *p_inst, const GeometryInstanceGLES3 *p_other, bool p_uses_additive_passes) const {
+	if (!_geometry_instance_can_auto_instance(p_other, p_uses_additive_passes)) {
+		return false;
+	}
+	if (p_inst->mirror != p_other->mirror || p_inst->flags_cache != p_other->flags_cache) {
+		return false;
+	}
+	// The light indices of the base pass are set once for the whole draw.
+	if (p_inst->omni_light_gl_cache.size() != p_other->omni_light_gl_cache.size() || p_inst->spot_light_gl_cache.size() != p_other->spot_light_gl_cache.size()) {
+		return false;
+	}
+	if (memcmp(p_inst->omni_light_gl_cache.ptr(), p_other->omni_light_gl_cache.ptr(), sizeof(uint32_t) * p_inst->omni_light_gl_cache.size()) != 0) {
+		return false;
+	}
+	if (memcmp(p_inst->spot_light_gl_cache.ptr(), p_other->spot_light_gl_cache.ptr(), sizeof(uint32_t) * p_inst->spot_light_gl_cache.size()) != 0) {
+		return false;
+	}
+	return true;
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2988,6 +3023,64 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			should_request_redraw = true;
 		}
 
+		// Draw consecutive surfaces that share the same mesh surface, material and lights with a single instanced draw call.
+		uint32_t auto_instance_count = 1;
+		if constexpr (p_pass_mode != PASS_MODE_MATERIAL) {
+			bool uses_additive_passes = (p_pass_mode == PASS_MODE_COLOR || p_pass_mode == PASS_MODE_COLOR_TRANSPARENT) && !shader->unshaded;
+			if (GLES3::Config::get_singleton()->use_auto_instancing && !shader->uses_model_matrix && (!uses_additive_passes || p_render_data->directional_shadow_count == 0) && _geometry_instance_can_auto_instance(inst, uses_additive_passes)) {
+				while (i + auto_instance_count < p_to_element && auto_instance_count < SceneState::MAX_AUTO_INSTANCES) {
+					GeometryInstanceSurface *next = p_params->elements[i + auto_instance_count];
+					bool same_surface;
+					if constexpr (p_pass_mode == PASS_MODE_SHADOW) {
+						same_surface = next->surface_shadow == mesh_surface && next->shader_shadow == surf->shader_shadow && next->material_shadow == surf->material_shadow;
+					} else {
+						same_surface = next->surface == mesh_surface && next->shader == surf->shader && next->material == surf->material;
+					}
+					if (!same_surface || next->lod_index != surf->lod_index || next->primitive != surf->primitive || next->flags != surf->flags || !_geometry_instances_can_share_draw(inst, next->owner, uses_additive_passes)) {
+						break;
+					}
+					auto_instance_count++;
+				}
+			}
+		}
+
+		if (auto_instance_count > 1) {
+			if (scene_state.auto_instance_buffer == 0) {
+				glGenBuffers(1, &scene_state.auto_instance_buffer);
+				glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+				GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer, SceneState::MAX_AUTO_INSTANCES * 12 * sizeof(float), nullptr, GL_STREAM_DRAW, "Auto instancing buffer");
+				scene_state.auto_instance_data.resize(SceneState::MAX_AUTO_INSTANCES * 12);
+			}
+
+			// Same layout as a 3D MultiMesh without colors or custom data.
+			float *dataptr = scene_state.auto_instance_data.ptr();
+			for (uint32_t j = 0; j < auto_instance_count; j++) {
+				const GeometryInstanceGLES3 *batch_inst = p_params->elements[i + j]->owner;
+				Transform3D transform;
+				if (batch_inst->store_transform_cache) {
+					transform = batch_inst->transform;
+				}
+				dataptr[0] = transform.basis.rows[0][0];
+				dataptr[1] = transform.basis.rows[0][1];
+				dataptr[2] = transform.basis.rows[0][2];
+				dataptr[3] = transform.origin.x;
+				dataptr[4] = transform.basis.rows[1][0];
+				dataptr[5] = transform.basis.rows[1][1];
+				dataptr[6] = transform.basis.rows[1][2];
+				dataptr[7] = transform.origin.y;
+				dataptr[8] = transform.basis.rows[2][0];
+				dataptr[9] = transform.basis.rows[2][1];
+				dataptr[10] = transform.basis.rows[2][2];
+				dataptr[11] = transform.origin.z;
+				dataptr += 12;
+			}
+
+			glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+			// Orphan the previous contents so the driver doesn't stall on draws still using them.
+			glBufferData(GL_ARRAY_BUFFER, SceneState::MAX_AUTO_INSTANCES * 12 * sizeof(float), nullptr, GL_STREAM_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, auto_instance_count * 12 * sizeof(float), scene_state.auto_instance_data.ptr());
+		}
+
 		if constexpr (p_pass_mode == PASS_MODE_COLOR_TRANSPARENT) {
 			scene_state.enable_gl_depth_test(shader->depth_test == GLES3::SceneShaderData::DEPTH_TEST_ENABLED);
 		}
@@ -3158,7 +3251,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			}
 
 			Transform3D world_transform;
-			if (inst->store_transform_cache) {
+			if (inst->store_transform_cache && auto_instance_count == 1) {
 				world_transform = inst->transform;
 			}
 
@@ -3169,8 +3262,8 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 
 			SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
 
-			if (inst->instance_count > 0) {
-				// Will need to use instancing to draw (either MultiMesh or Particles).
+			if (inst->instance_count > 0 || auto_instance_count > 1) {
+				// Will need to use instancing to draw (either MultiMesh, Particles or automatic instancing).
 				instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(instance_variant));
 			}
 
@@ -3470,6 +3563,37 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 						glDrawArraysInstanced(primitive_gl, 0, count, inst->instance_count);
 					}
 				}
+			} else if (auto_instance_count > 1) {
+				// Using automatic instancing, the transforms were uploaded above.
+				const uint32_t stride = 12;
+				glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+
+				glEnableVertexAttribArray(12);
+				glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(0));
+				glVertexAttribDivisor(12, 1);
+				glEnableVertexAttribArray(13);
+				glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 4));
+				glVertexAttribDivisor(13, 1);
+				glEnableVertexAttribArray(14);
+				glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, stride * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 8));
+				glVertexAttribDivisor(14, 1);
+
+				// Default instance color and custom data.
+				uint16_t zero = Math::make_half_float(0.0f);
+				uint16_t one = Math::make_half_float(1.0f);
+				GLuint default_color = (uint32_t(one) << 16) | one;
+				GLuint default_custom = (uint32_t(zero) << 16) | zero;
+				glVertexAttribI4ui(15, default_color, default_color, default_custom, default_custom);
+
+				if (use_wireframe) {
+					glDrawElementsInstanced(GL_LINES, count, GL_UNSIGNED_INT, 0, auto_instance_count);
+				} else {
+					if (use_index_buffer) {
+						glDrawElementsInstanced(primitive_gl, count, mesh_storage->mesh_surface_get_index_type(mesh_surface), 0, auto_instance_count);
+					} else {
+						glDrawArraysInstanced(primitive_gl, 0, count, auto_instance_count);
+					}
+				}
 			} else {
 				// Using regular Mesh.
 				if (use_wireframe) {
@@ -3483,7 +3607,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				}
 			}
 
-			if (inst->instance_count > 0) {
+			if (inst->instance_count > 0 || auto_instance_count > 1) {
 				glDisableVertexAttribArray(12);
 				glDisableVertexAttribArray(13);
 				glDisableVertexAttribArray(14);
@@ -3496,6 +3620,9 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				scene_state.enable_gl_blend(false);
 			}
 		}
+
+		// Skip the surfaces that were drawn along with this one.
+		i += auto_instance_count - 1;
 	}
 
 	// Make the actual redraw request
@@ -4259,6 +4386,10 @@ RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.tonemap_buffer);
 	}
 
+	if (scene_state.auto_instance_buffer != 0) {
+		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.auto_instance_buffer);
+	}
+
 	singleton = nullptr;
 }
 
@@ -440,6 +440,11 @@ private:
 		GLuint multiview_buffer = 0;
 		GLuint tonemap_buffer = 0;
 
+		// Transforms of consecutive surfaces drawn with a single instanced draw call.
+		static const uint32_t MAX_AUTO_INSTANCES = 256;
+		GLuint auto_instance_buffer = 0;
+		LocalVector<float> auto_instance_data;
+
 		bool used_depth_prepass = false;
 
 		GLES3::SceneShaderData::BlendMode current_blend_mode = GLES3::SceneShaderData::BLEND_MODE_MIX;
@@ -628,6 +633,9 @@ private:
 	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
 	void _render_post_processing(const RenderDataGLES3 *p_render_data);
 
+	bool _geometry_instance_can_auto_instance(const GeometryInstanceGLES3 *p_inst, bool p_uses_additive_passes) const;
+	bool _geometry_instances_can_share_draw(const GeometryInstanceGLES3 *p_inst, const GeometryInstanceGLES3 *p_other, bool p_uses_additive_passes) const;
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -147,6 +147,7 @@ Config::Config() {
 	use_nearest_mip_filter = GLOBAL_GET("rendering/textures/default_filters/use_nearest_mipmap_filter");
 
 	use_depth_prepass = bool(GLOBAL_GET("rendering/driver/depth_prepass/enable"));
+	use_auto_instancing = bool(GLOBAL_GET("rendering/gl_compatibility/auto_instancing"));
 	if (use_depth_prepass) {
 		String vendors = GLOBAL_GET("rendering/driver/depth_prepass/disable_for_vendors");
 		Vector<String> vendor_match = vendors.split(",");
@@ -56,6 +56,7 @@ private:
 public:
 	bool use_nearest_mip_filter = false;
 	bool use_depth_prepass = true;
+	bool use_auto_instancing = true;
 
 	int64_t max_vertex_texture_image_units = 0;
 	int64_t max_texture_image_units = 0;
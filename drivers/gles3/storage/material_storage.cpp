@@ -1792,6 +1792,7 @@ void MaterialStorage::global_shader_parameter_add(const StringName &p_name, RS::
 	}
 
 	global_shader_uniforms.variables[p_name] = gv;
+	ShaderCompiler::invalidate_caches();
 }
 
 void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
@@ -1808,6 +1809,7 @@ void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
 	}
 
 	global_shader_uniforms.variables.erase(p_name);
+	ShaderCompiler::invalidate_caches();
 }
 
 Vector<StringName> MaterialStorage::global_shader_parameter_get_list() const {
@@ -2849,6 +2851,7 @@ void SceneShaderData::set_code(const String &p_code) {
 	uniforms.clear();
 
 	uses_point_size = false;
+	uses_model_matrix = false;
 	uses_alpha = false;
 	uses_alpha_clip = false;
 	uses_blend_alpha = false;
@@ -2943,6 +2946,11 @@ void SceneShaderData::set_code(const String &p_code) {
 
 	actions.usage_flag_pointers["POINT_SIZE"] = &uses_point_size;
 	actions.usage_flag_pointers["POINT_COORD"] = &uses_point_size;
+	actions.usage_flag_pointers["MODEL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["MODEL_NORMAL_MATRIX"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_WORLD"] = &uses_model_matrix;
+	actions.usage_flag_pointers["NODE_POSITION_VIEW"] = &uses_model_matrix;
+	actions.usage_flag_pointers["INSTANCE_ID"] = &uses_model_matrix;
 
 	actions.write_flag_pointers["MODELVIEW_MATRIX"] = &writes_modelview_or_projection;
 	actions.write_flag_pointers["PROJECTION_MATRIX"] = &writes_modelview_or_projection;
@@ -295,6 +295,7 @@ struct SceneShaderData : public ShaderData {
 	Cull cull_mode;
 
 	bool uses_point_size;
+	bool uses_model_matrix; // Also set by NODE_POSITION_* and INSTANCE_ID, which can't be used with auto instancing.
 	bool uses_alpha;
 	bool uses_alpha_clip;
 	bool uses_blend_alpha;
@@ -188,6 +188,7 @@ struct MultiMesh {
 	bool uses_colors = false;
 	bool uses_custom_data = false;
 	int visible_instances = -1;
+	float cull_distance = 0.0; // Not used, there is no GPU culling in this renderer.
 	AABB aabb;
 	AABB custom_aabb;
 	bool aabb_dirty = false;
@@ -520,6 +521,9 @@ public:
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override;
 
+	virtual void multimesh_set_cull_distance(RID p_multimesh, float p_distance) override;
+	virtual float multimesh_get_cull_distance(RID p_multimesh) const override;
+
 	void _update_dirty_multimeshes();
 
 	_FORCE_INLINE_ RS::MultimeshTransformFormat multimesh_get_transform_format(RID p_multimesh) const {
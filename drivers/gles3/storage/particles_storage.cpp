@@ -772,6 +772,10 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 	SWAP(p_particles->front_vertex_array, p_particles->back_vertex_array);
 }
 
+void ParticlesStorage::particles_set_view_distance(RID p_particles, float p_distance) {
+	// Distance LOD is not supported in this renderer.
+}
+
 void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) {
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL(particles);
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,13 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped) {
+		munmap(mapped, mapped_length);
+		mapped = nullptr;
+		mapped_length = 0;
+	}
+	map_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -218,6 +226,31 @@ bool FileAccessUnix::eof_reached() const {
 	return last_error == ERR_FILE_EOF;
 }
 
+const uint8_t *FileAccessUnix::get_mapped_buffer() const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	// Only read-only files can be mapped, writes wouldn't be seen through the mapping.
+	if (mapped || map_failed || flags != READ) {
+		return mapped;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	mapped = (uint8_t *)ptr;
+	mapped_length = length;
+	return mapped;
+}
+
 uint8_t FileAccessUnix::get_8() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 	uint8_t b;
@@ -49,6 +49,10 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	mutable uint8_t *mapped = nullptr;
+	mutable uint64_t mapped_length = 0;
+	mutable bool map_failed = false;
+
 	void _close();
 
 public:
@@ -67,6 +71,8 @@ public:
 
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
+	virtual const uint8_t *get_mapped_buffer() const override;
+
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint16_t get_16() const override;
 	virtual uint32_t get_32() const override;
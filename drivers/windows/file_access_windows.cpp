@@ -41,6 +41,7 @@
 #include <windows.h>
 
 #include <errno.h>
+#include <io.h> // _get_osfhandle
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <tchar.h>
@@ -172,6 +173,16 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (mapped) {
+		UnmapViewOfFile(mapped);
+		mapped = nullptr;
+	}
+	if (mapping) {
+		CloseHandle((HANDLE)mapping);
+		mapping = nullptr;
+	}
+	map_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -266,6 +277,41 @@ bool FileAccessWindows::eof_reached() const {
 	return last_error == ERR_FILE_EOF;
 }
 
+const uint8_t *FileAccessWindows::get_mapped_buffer() const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	// Only read-only files can be mapped, writes wouldn't be seen through the mapping.
+	if (mapped || map_failed || flags != READ) {
+		return mapped;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(f));
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	mapping = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	mapped = (uint8_t *)MapViewOfFile((HANDLE)mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!mapped) {
+		CloseHandle((HANDLE)mapping);
+		mapping = nullptr;
+		map_failed = true;
+	}
+	return mapped;
+}
+
 uint8_t FileAccessWindows::get_8() const {
 	ERR_FAIL_NULL_V(f, 0);
 
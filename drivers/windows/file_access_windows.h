@@ -48,6 +48,10 @@ class FileAccessWindows : public FileAccess {
 	String path_src;
 	String save_path;
 
+	mutable void *mapping = nullptr; // File mapping HANDLE.
+	mutable uint8_t *mapped = nullptr;
+	mutable bool map_failed = false;
+
 	void _close();
 
 	static HashSet<String> invalid_files;
@@ -69,6 +73,8 @@ public:
 
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
+	virtual const uint8_t *get_mapped_buffer() const override;
+
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint16_t get_16() const override;
 	virtual uint32_t get_32() const override;
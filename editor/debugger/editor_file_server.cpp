@@ -32,10 +32,12 @@
 
 #include "../editor_settings.h"
 #include "core/io/marshalls.h"
+#include "core/io/remote_filesystem_client.h"
+#include "core/object/worker_thread_pool.h"
 #include "editor/editor_node.h"
 #include "editor/export/editor_export_platform.h"
 
-#define FILESYSTEM_PROTOCOL_VERSION 1
+#define FILESYSTEM_PROTOCOL_VERSION 2
 #define PASSWORD_LENGTH 32
 #define MAX_FILE_BUFFER_SIZE 100 * 1024 * 1024 // 100mb max file buffer size (description of files to update, compressed).
 
@@ -225,21 +227,84 @@ void EditorFileServer::poll() {
 		tcp_peer->put_64(K.value);
 	}
 
-	print_verbose("EFS: Sending " + itos(files_to_send.size()) + " files.");
-
-	int idx = 0;
-	for (KeyValue<String, uint64_t> K : files_to_send) {
-		pr.step(TTR("Sending file:") + " " + K.key.get_file(), 5 + idx * 100 / files_to_send.size(), false);
-		idx++;
+	// Read signatures of the copies the client already has, in the same order as the list.
+	LocalVector<String> send_paths;
+	LocalVector<LocalVector<RemoteFilesystemClient::BlockSignature>> send_signatures;
+	for (const KeyValue<String, uint64_t> &K : files_to_send) {
+		if (K.value == 0) {
+			continue; // Removed, the client does not expect anything.
+		}
+		uint32_t block_count = tcp_peer->get_u32();
+		ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+		ERR_FAIL_COND(block_count > MAX_FILE_BUFFER_SIZE / 20);
+		LocalVector<uint8_t> signature_buffer;
+		signature_buffer.resize(block_count * 20);
+		err = tcp_peer->get_data(signature_buffer.ptr(), signature_buffer.size());
+		ERR_FAIL_COND(err != OK);
 
-		if (K.value == 0 || !FileAccess::exists("res://" + K.key)) { // File was removed
-			continue;
+		LocalVector<RemoteFilesystemClient::BlockSignature> signatures;
+		signatures.resize(block_count);
+		for (uint32_t i = 0; i < block_count; i++) {
+			const uint8_t *ptr = signature_buffer.ptr() + i * 20;
+			signatures[i].weak = decode_uint32(ptr);
+			memcpy(signatures[i].strong, ptr + 4, 16);
 		}
+		send_paths.push_back(K.key);
+		send_signatures.push_back(signatures);
+	}
 
-		Vector<uint8_t> array = FileAccess::_get_file_as_bytes("res://" + K.key);
-		tcp_peer->put_64(array.size());
-		tcp_peer->put_data(array.ptr(), array.size());
-		ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+	print_verbose("EFS: Sending " + itos(send_paths.size()) + " files.");
+
+	struct FileDelta {
+		uint64_t size = 0;
+		LocalVector<uint8_t> delta;
+		Vector<uint8_t> compressed;
+	};
+
+	// Deltas are computed and compressed in parallel, a batch at a time to bound memory, then sent in order.
+	const uint32_t batch_size = 64;
+	LocalVector<FileDelta> deltas;
+	for (uint32_t batch_start = 0; batch_start < send_paths.size(); batch_start += batch_size) {
+		uint32_t batch_end = MIN(batch_start + batch_size, send_paths.size());
+		pr.step(TTR("Sending file:") + " " + send_paths[batch_start].get_file(), 5 + batch_start * 100 / send_paths.size(), false);
+
+		deltas.clear();
+		deltas.resize(batch_end - batch_start);
+		WorkerThreadPool::get_singleton()->parallel_for_range(batch_start, batch_end, 1, [&](uint32_t p_begin, uint32_t p_end) {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				FileDelta &fd = deltas[i - batch_start];
+				String path = "res://" + send_paths[i];
+				if (!FileAccess::exists(path)) {
+					continue; // Sent as an empty file.
+				}
+				Vector<uint8_t> array = FileAccess::_get_file_as_bytes(path);
+				fd.size = array.size();
+				RemoteFilesystemClient::delta_encode(array.ptr(), array.size(), send_signatures[i], fd.delta);
+
+				if (fd.delta.size() > 0 && fd.delta.size() <= (uint32_t)INT32_MAX) {
+					fd.compressed.resize(Compression::get_max_compressed_buffer_size(fd.delta.size(), Compression::MODE_ZSTD));
+					int ret = Compression::compress(fd.compressed.ptrw(), fd.delta.ptr(), fd.delta.size(), Compression::MODE_ZSTD);
+					if (ret > 0 && (uint32_t)ret < fd.delta.size()) {
+						fd.compressed.resize(ret);
+					} else {
+						fd.compressed.clear();
+					}
+				}
+			}
+		},
+				SNAME("EditorFileServerDelta"));
+
+		for (const FileDelta &fd : deltas) {
+			tcp_peer->put_64(fd.size);
+			tcp_peer->put_64(fd.delta.size());
+			tcp_peer->put_64(fd.compressed.size());
+			if (fd.compressed.size()) {
+				tcp_peer->put_data(fd.compressed.ptr(), fd.compressed.size());
+			} else {
+				tcp_peer->put_data(fd.delta.ptr(), fd.delta.size());
+			}
+			ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+		}
 	}
 
 	tcp_peer->put_data((const uint8_t *)"GEND", 4); // End marker.
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/extension/gdextension_manager.h"
+#include "core/io/config_file.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
 #include "core/io/resource_loader.h"
@@ -459,6 +460,20 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, bool p_only_impo
 
 	// Read the md5's from a separate file (so the import parameters aren't dependent on the file version
 	String base_path = ResourceFormatImporter::get_singleton()->get_import_base_path(p_path);
+	if (p_only_imported_files) {
+		// The md5's are not compared in this mode, so only their presence matters.
+		// This runs for every up-to-date imported file on each scan, skip opening and parsing them.
+		if (!FileAccess::exists(base_path + ".md5")) { // No md5's stored for this resource
+			return true;
+		}
+		for (const String &E : to_check) {
+			if (!FileAccess::exists(E)) {
+				return true; // Imported files are gone, reimport.
+			}
+		}
+		return false;
+	}
+
 	Ref<FileAccess> md5s = FileAccess::open(base_path + ".md5", FileAccess::READ, &err);
 	if (md5s.is_null()) { // No md5's stored for this resource
 		return true;
@@ -2129,7 +2144,18 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = OK;
+
+	String cache_key;
+	bool from_cache = false;
+	if (!shared_import_cache_path.is_empty() && importer->get_resource_type() != "PackedScene") {
+		cache_key = _get_import_cache_key(p_file, importer, opts, params);
+		from_cache = _fetch_import_from_cache(cache_key, base_path, &import_variants, &meta);
+	}
+
+	if (!from_cache) {
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	}
 
 	ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_UNRECOGNIZED, "Error importing '" + p_file + "'.");
 
@@ -2238,6 +2264,11 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		}
 	}
 
+	// Results that also generated files elsewhere in the project can't be restored from the cache alone.
+	if (!cache_key.is_empty() && !from_cache && gen_files.is_empty()) {
+		_store_import_in_cache(cache_key, base_path, dest_paths, import_variants, meta);
+	}
+
 	// Update cpos, newly created files could've changed the index of the reimported p_file.
 	_find_file(p_file, &fs, cpos);
 
@@ -2302,10 +2333,81 @@ void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_im
 	_reimport_file(p_import_data->reimport_files[p_import_data->reimport_from + p_index].path);
 }
 
+String EditorFileSystem::_get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const {
+	// Everything that can change the result: the source data, the importer and its version,
+	// the options, and the project-wide settings the importer depends on (e.g. VRAM compression formats).
+	String key = FileAccess::get_md5(p_file);
+	key += ":" + p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version()) + ":" + p_importer->get_import_settings_string();
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += ":" + String(E.option.name) + "=" + value;
+	}
+	return key.md5_text();
+}
+
+bool EditorFileSystem::_fetch_import_from_cache(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata) const {
+	String entry = shared_import_cache_path.path_join(p_key.substr(0, 2)).path_join(p_key);
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(entry + ".manifest") != OK) {
+		return false;
+	}
+	Vector<String> suffixes = manifest->get_value("import", "files", Vector<String>());
+	for (const String &suffix : suffixes) {
+		// Never let a manifest write outside of the imported files of this asset.
+		if (suffix.contains("/") || suffix.contains("\\") || !FileAccess::exists(entry + suffix)) {
+			return false;
+		}
+	}
+	for (const String &suffix : suffixes) {
+		if (DirAccess::copy_absolute(entry + suffix, ProjectSettings::get_singleton()->globalize_path(p_base_path + suffix)) != OK) {
+			return false;
+		}
+	}
+	Vector<String> variants = manifest->get_value("import", "variants", Vector<String>());
+	for (const String &variant : variants) {
+		r_variants->push_back(variant);
+	}
+	*r_metadata = manifest->get_value("import", "metadata", Variant());
+	print_verbose("Fetched import of '" + p_base_path + "' from the shared import cache.");
+	return true;
+}
+
+void EditorFileSystem::_store_import_in_cache(const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_variants, const Variant &p_metadata) const {
+	if (p_metadata.get_type() == Variant::DICTIONARY && Dictionary(p_metadata).has("has_editor_variant")) {
+		return; // Editor variants depend on the editor scale and theme of this machine.
+	}
+	Vector<String> suffixes;
+	for (const String &dest : p_dest_paths) {
+		ERR_FAIL_COND(!dest.begins_with(p_base_path));
+		suffixes.push_back(dest.substr(p_base_path.length()));
+	}
+	String dir = shared_import_cache_path.path_join(p_key.substr(0, 2));
+	ERR_FAIL_COND_MSG(DirAccess::make_dir_recursive_absolute(dir) != OK, "Cannot create shared import cache directory '" + dir + "'.");
+	String entry = dir.path_join(p_key);
+	for (const String &suffix : suffixes) {
+		ERR_FAIL_COND(DirAccess::copy_absolute(ProjectSettings::get_singleton()->globalize_path(p_base_path + suffix), entry + suffix) != OK);
+	}
+	Vector<String> variants;
+	for (const String &variant : p_variants) {
+		variants.push_back(variant);
+	}
+	// The manifest is written last, so a partially stored entry is never used.
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	manifest->set_value("import", "files", suffixes);
+	manifest->set_value("import", "variants", variants);
+	manifest->set_value("import", "metadata", p_metadata);
+	manifest->save(entry + ".manifest");
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ERR_FAIL_COND_MSG(importing, "Attempted to call reimport_files() recursively, this is not allowed.");
 	importing = true;
 
+	shared_import_cache_path = EDITOR_GET("filesystem/import/shared_import_cache_path");
+
 	Vector<String> reloads;
 
 	EditorProgress pr("reimport", TTR("(Re)Importing Assets"), p_files.size());
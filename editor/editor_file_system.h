@@ -32,6 +32,7 @@
 #define EDITOR_FILE_SYSTEM_H
 
 #include "core/io/dir_access.h"
+#include "core/io/resource_importer.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
@@ -245,6 +246,12 @@ class EditorFileSystem : public Node {
 	Error _reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options = HashMap<StringName, Variant>(), const String &p_custom_importer = String(), Variant *generator_parameters = nullptr);
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
+	// Content-addressed cache of import results, shareable between machines. Empty when disabled.
+	String shared_import_cache_path;
+	String _get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const;
+	bool _fetch_import_from_cache(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata) const;
+	void _store_import_in_cache(const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_variants, const Variant &p_metadata) const;
+
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
 
 	bool reimport_on_missing_imported_files;
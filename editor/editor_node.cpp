@@ -966,7 +966,11 @@ void EditorNode::_fs_changed() {
 					if (export_path.ends_with(".zip")) {
 						err = platform->export_zip(export_preset, export_defer.debug, export_path);
 					} else if (export_path.ends_with(".pck")) {
-						err = platform->export_pack(export_preset, export_defer.debug, export_path);
+						if (export_defer.patch) {
+							err = platform->export_pack_patch(export_preset, export_defer.debug, export_path);
+						} else {
+							err = platform->export_pack(export_preset, export_defer.debug, export_path);
+						}
 					}
 				} else { // Normal project export.
 					String config_error;
@@ -4795,11 +4799,12 @@ void EditorNode::_begin_first_scan() {
 	requested_first_scan = true;
 }
 
-Error EditorNode::export_preset(const String &p_preset, const String &p_path, bool p_debug, bool p_pack_only, bool p_android_build_template) {
+Error EditorNode::export_preset(const String &p_preset, const String &p_path, bool p_debug, bool p_pack_only, bool p_patch, bool p_android_build_template) {
 	export_defer.preset = p_preset;
 	export_defer.path = p_path;
 	export_defer.debug = p_debug;
 	export_defer.pack_only = p_pack_only;
+	export_defer.patch = p_patch;
 	export_defer.android_build_template = p_android_build_template;
 	cmdline_export_mode = true;
 	return OK;
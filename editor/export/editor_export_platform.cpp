@@ -33,9 +33,11 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/io/zip_io.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
 #include "editor/editor_node.h"
@@ -60,6 +62,11 @@ static int _get_pad(int p_alignment, int p_n) {
 }
 
 #define PCK_PADDING 16
+// Larger blocks compress better, smaller ones make random access cheaper.
+#define PCK_COMPRESSED_BLOCK_SIZE 65536
+// Queued files are flushed to the pack once either limit is reached.
+#define PCK_MAX_PENDING_FILES 256
+#define PCK_MAX_PENDING_SIZE (64 * 1024 * 1024)
 
 bool EditorExportPlatform::fill_log_messages(RichTextLabel *p_log, Error p_err) {
 	bool has_messages = false;
@@ -219,68 +226,215 @@ void EditorExportPlatform::gen_debug_flags(Vector<String> &r_flags, int p_flags)
 	}
 }
 
+Error EditorExportPlatform::_load_patch_md5s(const String &p_path, const Vector<uint8_t> &p_key, HashMap<String, Vector<uint8_t>> &r_md5s) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_OPEN, "Can't open patch base pack: " + p_path + ".");
+
+	// Standalone PCK, or one appended to an executable.
+	uint32_t magic = f->get_32();
+	if (magic != PACK_HEADER_MAGIC) {
+		f->seek_end();
+		f->seek(f->get_position() - 4);
+		magic = f->get_32();
+		if (magic == PACK_HEADER_MAGIC) {
+			f->seek(f->get_position() - 12);
+			uint64_t ds = f->get_64();
+			f->seek(f->get_position() - ds - 8);
+			magic = f->get_32();
+		}
+	}
+	ERR_FAIL_COND_V_MSG(magic != PACK_HEADER_MAGIC, ERR_FILE_UNRECOGNIZED, "Patch base is not a Godot pack: " + p_path + ".");
+
+	uint32_t version = f->get_32();
+	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, ERR_FILE_UNRECOGNIZED, "Patch base pack version unsupported: " + itos(version) + ".");
+	f->get_32(); // Major, minor and patch version, not used.
+	f->get_32();
+	f->get_32();
+
+	uint32_t pack_flags = f->get_32();
+	f->get_64(); // Files base.
+
+	for (int i = 0; i < 16; i++) {
+		//reserved
+		f->get_32();
+	}
+
+	uint32_t file_count = f->get_32();
+
+	if (pack_flags & PACK_DIR_ENCRYPTED) {
+		ERR_FAIL_COND_V_MSG(p_key.size() != 32, ERR_UNAUTHORIZED, "Patch base pack has an encrypted directory, but no encryption key is set: " + p_path + ".");
+
+		Ref<FileAccessEncrypted> fae;
+		fae.instantiate();
+		Error err = fae->open_and_parse(f, p_key, FileAccessEncrypted::MODE_READ, false);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open encrypted directory of patch base pack: " + p_path + ".");
+		f = fae;
+	}
+
+	for (uint32_t i = 0; i < file_count; i++) {
+		uint32_t sl = f->get_32();
+		CharString cs;
+		cs.resize(sl + 1);
+		f->get_buffer((uint8_t *)cs.ptr(), sl);
+		cs[sl] = 0;
+
+		String path;
+		path.parse_utf8(cs.ptr());
+
+		f->get_64(); // Offset.
+		f->get_64(); // Size.
+		Vector<uint8_t> md5;
+		md5.resize(16);
+		f->get_buffer(md5.ptrw(), 16);
+		f->get_32(); // Flags.
+
+		// Later packs override earlier ones, as they do when loaded at runtime.
+		r_md5s[path] = md5;
+	}
+
+	return OK;
+}
+
+Error EditorExportPlatform::_flush_pack_files(PackData *p_pd) {
+	if (!p_pd->patches.is_empty() && !p_pd->patches_loaded) {
+		p_pd->patches_loaded = true;
+		for (const String &patch : p_pd->patches) {
+			Error err = _load_patch_md5s(patch, p_pd->key, p_pd->patch_md5s);
+			if (err != OK) {
+				return err;
+			}
+		}
+	}
+
+	// Hashing and compression only read the file's own data, so queued files are processed in parallel.
+	// Large files are left to compress_blocks(), which already splits them over the thread pool.
+	const uint64_t large_file_size = (uint64_t)PCK_COMPRESSED_BLOCK_SIZE * 16;
+	auto process_file = [p_pd](uint32_t p_index) {
+		PendingFile &pf = p_pd->pending[p_index];
+
+		unsigned char hash[16];
+		CryptoCore::md5(pf.data.ptr(), pf.data.size(), hash);
+		pf.sd.md5.resize(16);
+		for (int i = 0; i < 16; i++) {
+			pf.sd.md5.write[i] = hash[i];
+		}
+
+		if (!p_pd->patch_md5s.is_empty()) {
+			const Vector<uint8_t> *base_md5 = p_pd->patch_md5s.getptr(String::utf8(pf.sd.path_utf8.get_data()));
+			if (base_md5 && *base_md5 == pf.sd.md5) {
+				pf.unchanged = true;
+				return;
+			}
+		}
+
+		// Compress before encrypting, encrypted data doesn't compress.
+		if (p_pd->compress && pf.data.size() > 0 && (uint64_t)pf.data.size() <= UINT32_MAX) {
+			pf.compressed_data = FileAccessCompressed::compress_blocks(pf.data.ptr(), pf.data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PCK_COMPRESSED_BLOCK_SIZE);
+			// Files that barely shrink (already compressed textures, audio, ...) are kept raw, so they can still be read straight from the mapped pack.
+			pf.sd.compressed = !pf.compressed_data.is_empty() && pf.compressed_data.size() < pf.data.size() - pf.data.size() / 16;
+		}
+	};
+
+	LocalVector<uint32_t> small_files;
+	for (uint32_t i = 0; i < p_pd->pending.size(); i++) {
+		if ((uint64_t)p_pd->pending[i].data.size() >= large_file_size) {
+			process_file(i);
+		} else {
+			small_files.push_back(i);
+		}
+	}
+
+	if (small_files.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::get_singleton()->parallel_for_range(0, small_files.size(), 4, [&](uint32_t p_begin, uint32_t p_end) {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				process_file(small_files[i]);
+			}
+		},
+				SNAME("EditorExportPackFiles"));
+	} else {
+		for (uint32_t index : small_files) {
+			process_file(index);
+		}
+	}
+
+	for (PendingFile &pf : p_pd->pending) {
+		if (pf.unchanged) {
+			continue;
+		}
+
+		pf.sd.ofs = p_pd->f->get_position();
+		const Vector<uint8_t> &stored_data = pf.sd.compressed ? pf.compressed_data : pf.data;
+
+		Ref<FileAccessEncrypted> fae;
+		Ref<FileAccess> ftmp = p_pd->f;
+
+		if (pf.sd.encrypted) {
+			fae.instantiate();
+			ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
+
+			Error err = fae->open_and_parse(ftmp, p_pd->key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			ERR_FAIL_COND_V(err != OK, ERR_SKIP);
+			ftmp = fae;
+		}
+
+		// Store file content. The directory keeps the original size, the compressed container knows its own.
+		ftmp->store_buffer(stored_data.ptr(), stored_data.size());
+
+		if (fae.is_valid()) {
+			ftmp.unref();
+			fae.unref();
+		}
+
+		int pad = _get_pad(PCK_PADDING, p_pd->f->get_position());
+		for (int i = 0; i < pad; i++) {
+			p_pd->f->store_8(0);
+		}
+
+		p_pd->file_ofs.push_back(pf.sd);
+	}
+
+	p_pd->pending.clear();
+	p_pd->pending_size = 0;
+
+	return OK;
+}
+
 Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key) {
 	ERR_FAIL_COND_V_MSG(p_total < 1, ERR_PARAMETER_RANGE_ERROR, "Must select at least one file to export.");
 
 	PackData *pd = (PackData *)p_userdata;
 
-	SavedData sd;
-	sd.path_utf8 = p_path.utf8();
-	sd.ofs = pd->f->get_position();
-	sd.size = p_data.size();
-	sd.encrypted = false;
+	PendingFile pf;
+	pf.sd.path_utf8 = p_path.utf8();
+	pf.sd.size = p_data.size();
+	pf.sd.encrypted = false;
+	pf.data = p_data;
 
 	for (int i = 0; i < p_enc_in_filters.size(); ++i) {
 		if (p_path.matchn(p_enc_in_filters[i]) || p_path.replace("res://", "").matchn(p_enc_in_filters[i])) {
-			sd.encrypted = true;
+			pf.sd.encrypted = true;
 			break;
 		}
 	}
 
 	for (int i = 0; i < p_enc_ex_filters.size(); ++i) {
 		if (p_path.matchn(p_enc_ex_filters[i]) || p_path.replace("res://", "").matchn(p_enc_ex_filters[i])) {
-			sd.encrypted = false;
+			pf.sd.encrypted = false;
 			break;
 		}
 	}
 
-	Ref<FileAccessEncrypted> fae;
-	Ref<FileAccess> ftmp = pd->f;
+	pd->key = p_key;
+	pd->pending_size += p_data.size();
+	pd->pending.push_back(pf);
 
-	if (sd.encrypted) {
-		fae.instantiate();
-		ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
-
-		Error err = fae->open_and_parse(ftmp, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-		ERR_FAIL_COND_V(err != OK, ERR_SKIP);
-		ftmp = fae;
-	}
-
-	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
-
-	if (fae.is_valid()) {
-		ftmp.unref();
-		fae.unref();
-	}
-
-	int pad = _get_pad(PCK_PADDING, pd->f->get_position());
-	for (int i = 0; i < pad; i++) {
-		pd->f->store_8(0);
-	}
-
-	// Store MD5 of original file.
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
-		sd.md5.resize(16);
-		for (int i = 0; i < 16; i++) {
-			sd.md5.write[i] = hash[i];
+	if (pd->pending.size() >= PCK_MAX_PENDING_FILES || pd->pending_size >= PCK_MAX_PENDING_SIZE) {
+		Error err = _flush_pack_files(pd);
+		if (err != OK) {
+			return err;
 		}
 	}
 
-	pd->file_ofs.push_back(sd);
-
 	// TRANSLATORS: This is an editor progress label describing the storing of a file.
 	if (pd->ep->step(vformat(TTR("Storing File: %s"), p_path), 2 + p_file * 100 / p_total, false)) {
 		return ERR_SKIP;
@@ -730,6 +884,15 @@ bool EditorExportPlatform::_export_customize_scene_resources(Node *p_root, Node
 	return changed;
 }
 
+// Reimporting only rewrites the ".import" file, so it counts as a change of the source too.
+static uint64_t _get_export_source_modified_time(const String &p_path) {
+	uint64_t mod_time = FileAccess::get_modified_time(p_path);
+	if (FileAccess::exists(p_path + ".import")) {
+		mod_time = MAX(mod_time, FileAccess::get_modified_time(p_path + ".import"));
+	}
+	return mod_time;
+}
+
 String EditorExportPlatform::_export_customize(const String &p_path, LocalVector<Ref<EditorExportPlugin>> &customize_resources_plugins, LocalVector<Ref<EditorExportPlugin>> &customize_scenes_plugins, HashMap<String, FileExportCache> &export_cache, const String &export_base_path, bool p_force_save) {
 	if (!p_force_save && customize_resources_plugins.is_empty() && customize_scenes_plugins.is_empty()) {
 		return p_path; // do none
@@ -742,7 +905,7 @@ String EditorExportPlatform::_export_customize(const String &p_path, LocalVector
 		if (fec.saved_path.is_empty() || FileAccess::exists(fec.saved_path)) {
 			// Destination file exists (was not erased) or not needed
 
-			uint64_t mod_time = FileAccess::get_modified_time(p_path);
+			uint64_t mod_time = _get_export_source_modified_time(p_path);
 			if (fec.source_modified_time == mod_time) {
 				// Cached (modified time matches).
 				fec.used = true;
@@ -765,7 +928,7 @@ String EditorExportPlatform::_export_customize(const String &p_path, LocalVector
 
 	FileExportCache fec;
 	fec.used = true;
-	fec.source_modified_time = FileAccess::get_modified_time(p_path);
+	fec.source_modified_time = _get_export_source_modified_time(p_path);
 
 	String md5 = FileAccess::get_md5(p_path);
 	if (FileAccess::exists(p_path + ".import")) {
@@ -1086,11 +1249,15 @@ Error EditorExportPlatform::export_project_files(const Ref<EditorExportPreset> &
 		}
 	}
 
-	HashMap<String, FileExportCache> export_cache;
-	String export_base_path = ProjectSettings::get_singleton()->get_project_data_path().path_join("exported/") + itos(custom_resources_hash);
-
 	bool convert_text_to_binary = GLOBAL_GET("editor/export/convert_text_resources_to_binary");
 
+	// Cached files are only valid for the same plugin configuration and conversion setting.
+	uint32_t export_cache_hash = hash_murmur3_one_32(custom_scene_hash, custom_resources_hash);
+	export_cache_hash = hash_fmix32(hash_murmur3_one_32(convert_text_to_binary ? 1 : 0, export_cache_hash));
+
+	HashMap<String, FileExportCache> export_cache;
+	String export_base_path = ProjectSettings::get_singleton()->get_project_data_path().path_join("exported/") + itos(export_cache_hash);
+
 	if (convert_text_to_binary || !customize_resources_plugins.is_empty() || !customize_scenes_plugins.is_empty()) {
 		// See if we have something to open
 		Ref<FileAccess> f = FileAccess::open(export_base_path.path_join("file_cache"), FileAccess::READ);
@@ -1113,7 +1280,7 @@ Error EditorExportPlatform::export_project_files(const Ref<EditorExportPreset> &
 			// create the path
 			Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 			d->change_dir(ProjectSettings::get_singleton()->get_project_data_path());
-			d->make_dir_recursive("exported/" + itos(custom_resources_hash));
+			d->make_dir_recursive("exported/" + itos(export_cache_hash));
 		}
 	}
 
@@ -1533,7 +1700,7 @@ void EditorExportPlatform::zip_folder_recursive(zipFile &p_zip, const String &p_
 	da->list_dir_end();
 }
 
-Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files, bool p_embed, int64_t *r_embedded_start, int64_t *r_embedded_size) {
+Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files, bool p_embed, int64_t *r_embedded_start, int64_t *r_embedded_size, const Vector<String> &p_patches) {
 	EditorProgress ep("savepack", TTR("Packing"), 102, true);
 
 	// Create the temporary export directory if it doesn't exist.
@@ -1551,8 +1718,13 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress = p_preset->get_compress_pck();
+	pd.patches = p_patches;
 
 	Error err = export_project_files(p_preset, p_debug, _save_pack_file, &pd, _add_shared_object);
+	if (err == OK) {
+		err = _flush_pack_files(&pd);
+	}
 
 	// Close temp file.
 	pd.f.unref();
@@ -1689,6 +1861,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -1777,6 +1952,15 @@ Error EditorExportPlatform::export_pack(const Ref<EditorExportPreset> &p_preset,
 	return save_pack(p_preset, p_debug, p_path);
 }
 
+Error EditorExportPlatform::export_pack_patch(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, int p_flags) {
+	ExportNotifier notifier(*this, p_preset, p_debug, p_path, p_flags);
+	if (p_preset->get_patches().is_empty()) {
+		add_message(EXPORT_MESSAGE_ERROR, TTR("Save PCK"), TTR("No base packs are set for patch export."));
+		return ERR_INVALID_PARAMETER;
+	}
+	return save_pack(p_preset, p_debug, p_path, nullptr, false, nullptr, nullptr, p_preset->get_patches());
+}
+
 Error EditorExportPlatform::export_zip(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, int p_flags) {
 	ExportNotifier notifier(*this, p_preset, p_debug, p_path, p_flags);
 	return save_zip(p_preset, p_debug, p_path);
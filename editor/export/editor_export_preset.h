@@ -90,6 +90,8 @@ private:
 	String enc_ex_filters;
 	bool enc_pck = false;
 	bool enc_directory = false;
+	bool compress_pck = false;
+	Vector<String> patches;
 
 	String script_key;
 	int script_mode = MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
@@ -162,6 +164,12 @@ public:
 	void set_enc_directory(bool p_enabled);
 	bool get_enc_directory() const;
 
+	void set_compress_pck(bool p_enabled);
+	bool get_compress_pck() const;
+
+	void set_patches(const Vector<String> &p_patches);
+	Vector<String> get_patches() const;
+
 	void set_script_encryption_key(const String &p_key);
 	String get_script_encryption_key() const;
 
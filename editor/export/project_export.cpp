@@ -290,6 +290,7 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 	include_filters->set_text(current->get_include_filter());
 	include_label->set_text(_get_resource_export_header(current->get_export_filter()));
 	exclude_filters->set_text(current->get_exclude_filter());
+	patches->set_text(String(", ").join(current->get_patches()));
 	server_strip_message->set_visible(current->get_export_filter() == EditorExportPreset::EXPORT_CUSTOMIZED);
 
 	_fill_resource_tree();
@@ -361,6 +362,8 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 		enc_ex_filters->set_text(enc_ex_filters_str);
 	}
 
+	compress_pck->set_pressed(current->get_compress_pck());
+
 	bool enc_pck_mode = current->get_enc_pck();
 	enc_pck->set_pressed(enc_pck_mode);
 
@@ -567,6 +570,38 @@ void ProjectExportDialog::_enc_pck_changed(bool p_pressed) {
 	_update_current_preset();
 }
 
+void ProjectExportDialog::_compress_pck_changed(bool p_pressed) {
+	if (updating) {
+		return;
+	}
+
+	Ref<EditorExportPreset> current = get_current_preset();
+	ERR_FAIL_COND(current.is_null());
+
+	current->set_compress_pck(p_pressed);
+
+	_update_current_preset();
+}
+
+void ProjectExportDialog::_patches_changed(const String &p_text) {
+	if (updating) {
+		return;
+	}
+
+	Ref<EditorExportPreset> current = get_current_preset();
+	ERR_FAIL_COND(current.is_null());
+
+	Vector<String> patch_list;
+	Vector<String> split = p_text.split(",");
+	for (int i = 0; i < split.size(); i++) {
+		String patch = split[i].strip_edges();
+		if (!patch.is_empty()) {
+			patch_list.push_back(patch);
+		}
+	}
+	current->set_patches(patch_list);
+}
+
 void ProjectExportDialog::_enc_directory_changed(bool p_pressed) {
 	if (updating) {
 		return;
@@ -658,6 +693,8 @@ void ProjectExportDialog::_duplicate_preset() {
 	preset->set_export_filter(current->get_export_filter());
 	preset->set_include_filter(current->get_include_filter());
 	preset->set_exclude_filter(current->get_exclude_filter());
+	preset->set_compress_pck(current->get_compress_pck());
+	preset->set_patches(current->get_patches());
 	preset->set_custom_features(current->get_custom_features());
 
 	for (const KeyValue<StringName, Variant> &E : current->get_values()) {
@@ -1038,7 +1075,11 @@ void ProjectExportDialog::_export_pck_zip_selected(const String &p_path) {
 	if (p_path.ends_with(".zip")) {
 		platform->export_zip(current, export_pck_zip_debug->is_pressed(), p_path);
 	} else if (p_path.ends_with(".pck")) {
-		platform->export_pack(current, export_pck_zip_debug->is_pressed(), p_path);
+		if (export_pck_zip_patch->is_pressed()) {
+			platform->export_pack_patch(current, export_pck_zip_debug->is_pressed(), p_path);
+		} else {
+			platform->export_pack(current, export_pck_zip_debug->is_pressed(), p_path);
+		}
 	}
 }
 
@@ -1365,6 +1406,19 @@ ProjectExportDialog::ProjectExportDialog() {
 			exclude_filters);
 	exclude_filters->connect("text_changed", callable_mp(this, &ProjectExportDialog::_filter_changed));
 
+	compress_pck = memnew(CheckButton);
+	compress_pck->set_text(TTR("Compress Exported PCK"));
+	compress_pck->set_tooltip_text(TTR("Store files in the PCK compressed with Zstandard, in blocks that are decompressed as they are read.\nFiles that don't get noticeably smaller, like already compressed textures and audio, are stored as is."));
+	compress_pck->connect("toggled", callable_mp(this, &ProjectExportDialog::_compress_pck_changed));
+	resources_vb->add_child(compress_pck);
+
+	patches = memnew(LineEdit);
+	patches->set_tooltip_text(TTR("PCK files exported as patches only contain the files that differ from these packs.\nFiles removed from the project are not tracked, the base packs keep providing them."));
+	resources_vb->add_margin_child(
+			TTR("Base packs for patch exports\n(comma-separated, e.g: builds/game.pck, builds/dlc.pck)"),
+			patches);
+	patches->connect("text_changed", callable_mp(this, &ProjectExportDialog::_patches_changed));
+
 	// Feature tags.
 
 	VBoxContainer *feature_vb = memnew(VBoxContainer);
@@ -1561,6 +1615,12 @@ ProjectExportDialog::ProjectExportDialog() {
 	export_pck_zip_debug->set_h_size_flags(Control::SIZE_SHRINK_CENTER);
 	export_pck_zip->get_vbox()->add_child(export_pck_zip_debug);
 
+	export_pck_zip_patch = memnew(CheckBox);
+	export_pck_zip_patch->set_text(TTR("Export As Patch"));
+	export_pck_zip_patch->set_tooltip_text(TTR("Only store the files that changed since the base packs set in the Resources tab (PCK only)."));
+	export_pck_zip_patch->set_h_size_flags(Control::SIZE_SHRINK_CENTER);
+	export_pck_zip->get_vbox()->add_child(export_pck_zip_patch);
+
 	set_hide_on_ok(false);
 
 	default_filename = EditorSettings::get_singleton()->get_project_metadata("export_options", "default_filename", "");
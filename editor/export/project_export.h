@@ -92,6 +92,8 @@ class ProjectExportDialog : public ConfirmationDialog {
 
 	OptionButton *export_filter = nullptr;
 	LineEdit *include_filters = nullptr;
+	CheckButton *compress_pck = nullptr;
+	LineEdit *patches = nullptr;
 	LineEdit *exclude_filters = nullptr;
 	Tree *include_files = nullptr;
 	Label *server_strip_message = nullptr;
@@ -156,6 +158,7 @@ class ProjectExportDialog : public ConfirmationDialog {
 	EditorFileDialog *export_project = nullptr;
 	CheckBox *export_debug = nullptr;
 	CheckBox *export_pck_zip_debug = nullptr;
+	CheckBox *export_pck_zip_patch = nullptr;
 
 	CheckButton *enc_pck = nullptr;
 	CheckButton *enc_directory = nullptr;
@@ -182,6 +185,8 @@ class ProjectExportDialog : public ConfirmationDialog {
 	bool updating_script_key = false;
 	bool updating_enc_filters = false;
 	void _enc_pck_changed(bool p_pressed);
+	void _compress_pck_changed(bool p_pressed);
+	void _patches_changed(const String &p_text);
 	void _enc_directory_changed(bool p_pressed);
 	void _enc_filters_changed(const String &p_text);
 	void _script_encryption_key_changed(const String &p_key);
@@ -81,7 +81,14 @@ String ResourceImporterTextureAtlas::get_preset_name(int p_idx) const {
 }
 
 void ResourceImporterTextureAtlas::get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset) const {
-	r_options->push_back(ImportOption(PropertyInfo(Variant::STRING, "atlas_file", PROPERTY_HINT_SAVE_FILE, "*.png"), ""));
+	// Default to one atlas per folder, so selecting a folder of sprites and switching them all to this importer packs them together.
+	String default_atlas_file;
+	if (!p_path.is_empty()) {
+		String base_dir = p_path.get_base_dir();
+		String dir_name = base_dir.trim_suffix("/").get_file();
+		default_atlas_file = base_dir.path_join((dir_name.is_empty() || dir_name.ends_with(":") ? String("atlas") : dir_name) + "_atlas.png");
+	}
+	r_options->push_back(ImportOption(PropertyInfo(Variant::STRING, "atlas_file", PROPERTY_HINT_SAVE_FILE, "*.png"), default_atlas_file));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "import_mode", PROPERTY_HINT_ENUM, "Region,Mesh2D", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "crop_to_region"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "trim_alpha_border_from_region"), true));
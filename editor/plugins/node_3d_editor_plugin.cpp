@@ -2887,6 +2887,14 @@ void Node3DEditorViewport::_notification(int p_what) {
 				text += vformat(TTR("Objects: %d\n"), viewport->get_render_info(Viewport::RENDER_INFO_TYPE_VISIBLE, Viewport::RENDER_INFO_OBJECTS_IN_FRAME));
 				text += vformat(TTR("Primitives: %d\n"), viewport->get_render_info(Viewport::RENDER_INFO_TYPE_VISIBLE, Viewport::RENDER_INFO_PRIMITIVES_IN_FRAME));
 				text += vformat(TTR("Draw Calls: %d"), viewport->get_render_info(Viewport::RENDER_INFO_TYPE_VISIBLE, Viewport::RENDER_INFO_DRAW_CALLS_IN_FRAME));
+				if (RenderingServer::get_singleton()->get_rendering_device()) {
+					// Render graph statistics are gathered for the whole frame, not just this viewport.
+					text += "\n";
+					text += vformat(TTR("Barriers: %d\n"), RenderingServer::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_BARRIERS_IN_FRAME));
+					text += vformat(TTR("Layout Transitions: %d\n"), RenderingServer::get_singleton()->get_rendering_info(RS::RENDERING_INFO_LAYOUT_TRANSITIONS_IN_FRAME));
+					text += vformat(TTR("Render Passes: %d\n"), RenderingServer::get_singleton()->get_rendering_info(RS::RENDERING_INFO_RENDER_PASSES_IN_FRAME));
+					text += vformat(TTR("Graph Levels: %d"), RenderingServer::get_singleton()->get_rendering_info(RS::RENDERING_INFO_GRAPH_LEVELS_IN_FRAME));
+				}
 
 				info_label->set_text(text);
 			}
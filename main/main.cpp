@@ -35,6 +35,7 @@
 #include "core/core_string_names.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/scope_profiler.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -43,8 +44,10 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/file_access_zip.h"
+#include "core/io/file_read_queue.h"
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
+#include "core/io/json.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
@@ -227,6 +230,22 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+
+// Per-frame statistics collected with --benchmark-scene.
+struct BenchmarkSceneFrame {
+	double cpu_msec = 0.0;
+	double gpu_msec = 0.0;
+	uint64_t draw_calls = 0;
+	uint64_t primitives = 0;
+	uint64_t objects = 0;
+};
+static String benchmark_scene_path;
+static String benchmark_scene_output;
+static LocalVector<BenchmarkSceneFrame> benchmark_scene_frames;
+static uint64_t benchmark_scene_video_mem_peak = 0;
+static bool low_latency_mode = false;
+static uint64_t low_latency_margin_usec = 0;
+static uint64_t low_latency_frame_cost_usec = 0;
 #ifdef TOOLS_ENABLED
 static bool dump_gdextension_interface = false;
 static bool dump_extension_api = false;
@@ -506,7 +525,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_title("General options");
 	print_help_option("-h, --help", "Display this help message.\n");
 	print_help_option("--version", "Display the version string.\n");
-	print_help_option("-v, --verbose", "Use verbose stdout mode.\n");
+	print_help_option("-v, --verbose", "Use verbose stdout mode. Also prints the startup and shutdown timing breakdown.\n");
 	print_help_option("--quiet", "Quiet mode, silences stdout messages. Errors are still displayed.\n");
 	print_help_option("--no-header", "Do not print engine version and rendering method header on startup.\n");
 
@@ -564,6 +583,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--text-driver <driver>", "Text driver (used for font rendering, bidirectional support and shaping).\n");
 	print_help_option("--tablet-driver <driver>", "Pen tablet input driver.\n");
 	print_help_option("--headless", "Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script.\n");
+	print_help_option("--dedicated-server", "Enable headless mode and skip loading texture pixels, mesh render data, audio samples and shader compilation.\n");
+	print_help_option("", "Implied when running a project exported for a dedicated server. Ignored by the editor.\n");
 	print_help_option("--log-file <file>", "Write output/error log to the specified path instead of the default location defined by the project.\n");
 	print_help_option("", "<file> path should be absolute or relative to the project directory.\n");
 	print_help_option("--write-movie <file>", "Write a video to the specified path (usually with .avi or .png extension).\n");
@@ -601,6 +622,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--debug-avoidance", "Show navigation avoidance debug visuals when running the scene.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 	print_help_option("--debug-stringnames", "Print all StringName allocations to stdout when the engine quits.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 	print_help_option("--debug-canvas-item-redraw", "Display a rectangle each time a canvas item requests a redraw (useful to troubleshoot low processor mode).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+	print_help_option("--trace-file <path>", "Record a timeline of the engine's main loop, threads and GPU until exit, and save it to the given path in the Chrome trace format (can be opened with Perfetto).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
 
 #endif
 	print_help_option("--max-fps <fps>", "Set a maximum number of frames per second rendered (can be used to limit power usage). A value of 0 results in unlimited framerate.\n");
@@ -612,6 +634,11 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--benchmark", "Benchmark the run time and print it to console.\n");
+	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n");
+	print_help_option("--benchmark-scene <path>", "Run the given scene at a fixed 60 FPS for 1000 frames (see --fixed-fps and --quit-after) and print a JSON summary of\n");
+	print_help_option("", "CPU and GPU frame time percentiles, draw calls and video memory. Camera paths should be animated in the scene itself.\n");
+	print_help_option("--benchmark-scene-output <path>", "Save the --benchmark-scene summary to the given file instead of printing it.\n");
 
 	print_help_title("Standalone tools");
 	print_help_option("-s, --script <script>", "Run a script.\n");
@@ -623,6 +650,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("", "The target directory must exist.\n");
 	print_help_option("--export-debug <preset> <path>", "Export the project in debug mode using the given preset and output path. See --export-release description for other considerations.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--export-pack <preset> <path>", "Export the project data only using the given preset and output path. The <path> extension determines whether it will be in PCK or ZIP format.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--export-patch <preset> <path>", "Export a PCK that only contains the files changed since the base packs listed in the preset's \"patches\".\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--install-android-build-template", "Install the Android build template. Used in conjunction with --export-release or --export-debug.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #ifndef DISABLE_DEPRECATED
 	// Commands are long; split the description to a second line.
@@ -642,8 +670,6 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--dump-extension-api-with-docs", "Generate JSON dump of the Godot API like the previous option, but including documentation.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--validate-extension-api <path>", "Validate an extension API file dumped (with one of the two previous options) from a previous version of the engine to ensure API compatibility.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("", "If incompatibilities or errors are detected, the exit code will be non-zero.\n");
-	print_help_option("--benchmark", "Benchmark the run time and print it to console.\n", CLI_OPTION_AVAILABILITY_EDITOR);
-	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #ifdef TESTS_ENABLED
 	print_help_option("--test [--help]", "Run unit tests. Use --test --help for more information.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -1285,6 +1311,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			audio_driver = NULL_AUDIO_DRIVER;
 			display_driver = NULL_DISPLAY_DRIVER;
 
+		} else if (I->get() == "--dedicated-server") { // headless, without loading render and audio data.
+
+			audio_driver = NULL_AUDIO_DRIVER;
+			display_driver = NULL_DISPLAY_DRIVER;
+			Engine::singleton->dedicated_server_mode = true;
+
 		} else if (I->get() == "--log-file") { // write to log file
 
 			if (I->next()) {
@@ -1421,7 +1453,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 
 		} else if (I->get() == "--export-release" || I->get() == "--export-debug" ||
-				I->get() == "--export-pack") { // Export project
+				I->get() == "--export-pack" || I->get() == "--export-patch") { // Export project
 			// Actually handling is done in start().
 			editor = true;
 			cmdline_tool = true;
@@ -1665,6 +1697,39 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				goto error;
 			}
 
+#ifdef DEBUG_ENABLED
+		} else if (I->get() == "--trace-file") {
+			if (I->next()) {
+				ScopeProfiler::begin_capture(I->next()->get());
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --trace-file <path>.\n");
+				goto error;
+			}
+#endif
+		} else if (I->get() == "--benchmark-scene") {
+			if (I->next()) {
+				benchmark_scene_path = I->next()->get();
+				// Deterministic playback, unless overridden by later arguments.
+				if (fixed_fps == -1) {
+					fixed_fps = 60;
+				}
+				if (quit_after == 0) {
+					quit_after = 1000;
+				}
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --benchmark-scene <path>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-scene-output") {
+			if (I->next()) {
+				benchmark_scene_output = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --benchmark-scene-output <path>.\n");
+				goto error;
+			}
 		} else if (I->get() == "--benchmark") {
 			OS::get_singleton()->set_use_benchmark(true);
 		} else if (I->get() == "--benchmark-file") {
@@ -1776,6 +1841,11 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	if (ProjectSettings::get_singleton()->has_custom_feature("dedicated_server")) {
 		audio_driver = NULL_AUDIO_DRIVER;
 		display_driver = NULL_DISPLAY_DRIVER;
+		Engine::singleton->dedicated_server_mode = true;
+	}
+	if (editor || project_manager) {
+		// The editor has to keep the data it imports and exports.
+		Engine::singleton->dedicated_server_mode = false;
 	}
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "network/limits/debugger/max_chars_per_second", PROPERTY_HINT_RANGE, "0, 4096, 1, or_greater"), 32768);
@@ -2354,6 +2424,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	OS::get_singleton()->set_low_processor_usage_mode_sleep_usec(
 			GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/low_processor_mode_sleep_usec", PROPERTY_HINT_RANGE, "0,33200,1,or_greater"), 6900)); // Roughly 144 FPS
 
+	low_latency_mode = GLOBAL_DEF("application/run/low_latency_mode", false) && !Engine::get_singleton()->is_editor_hint();
+	low_latency_margin_usec = MAX(0, int(GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/low_latency_margin_usec", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 1000)));
+
 	GLOBAL_DEF("application/run/delta_smoothing", true);
 	if (!delta_smoothing_override) {
 		OS::get_singleton()->set_delta_smoothing(GLOBAL_GET("application/run/delta_smoothing"));
@@ -2380,6 +2453,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	// OpenXR project extensions settings.
 	GLOBAL_DEF_BASIC("xr/openxr/extensions/hand_tracking", true);
 	GLOBAL_DEF_BASIC("xr/openxr/extensions/eye_gaze_interaction", false);
+	GLOBAL_DEF_BASIC("xr/openxr/extensions/space_warp", false);
 
 #ifdef TOOLS_ENABLED
 	// Disabled for now, using XR inside of the editor we'll be working on during the coming months.
@@ -2800,6 +2874,11 @@ Error Main::setup2() {
 
 	OS::get_singleton()->benchmark_end_measure("Startup", "Servers");
 
+	if (ScopeProfiler::is_capturing()) {
+		// Needed for the GPU timestamps to be merged into the trace.
+		RenderingServer::get_singleton()->set_frame_profiling_enabled(true);
+	}
+
 	// Add a blank line for readability.
 	Engine::get_singleton()->print_header("");
 
@@ -2940,6 +3019,7 @@ Error Main::setup2() {
 		ResourceLoader::load_translation_remaps(); //load remaps for resources
 
 		ResourceLoader::load_path_remaps();
+		ResourceLoader::set_keepalive_budget(uint64_t(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_cache/keepalive_budget_mb", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 256)) * 1024 * 1024);
 
 		OS::get_singleton()->benchmark_end_measure("Startup", "Translations and Remaps");
 	}
@@ -3122,6 +3202,7 @@ Error Main::setup2() {
 	_start_success = true;
 
 	ClassDB::set_current_api(ClassDB::API_NONE); //no more APIs are registered at this point
+	ClassDB::freeze_registry();
 
 	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
 	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
@@ -3155,6 +3236,7 @@ bool Main::start() {
 	String _export_preset;
 	bool export_debug = false;
 	bool export_pack_only = false;
+	bool export_patch = false;
 	bool install_android_build_template = false;
 #ifdef MODULE_GDSCRIPT_ENABLED
 	String gdscript_docs_path;
@@ -3238,6 +3320,11 @@ bool Main::start() {
 				editor = true;
 				_export_preset = args[i + 1];
 				export_pack_only = true;
+			} else if (args[i] == "--export-patch") {
+				editor = true;
+				_export_preset = args[i + 1];
+				export_pack_only = true;
+				export_patch = true;
 #endif
 			} else {
 				// The parameter does not match anything known, don't skip the next argument
@@ -3395,6 +3482,10 @@ bool Main::start() {
 
 #endif // TOOLS_ENABLED
 
+	if (!benchmark_scene_path.is_empty()) {
+		game_path = benchmark_scene_path;
+	}
+
 	if (script.is_empty() && game_path.is_empty() && String(GLOBAL_GET("application/run/main_scene")) != "") {
 		game_path = GLOBAL_GET("application/run/main_scene");
 	}
@@ -3522,6 +3613,10 @@ bool Main::start() {
 			sml->set_disable_node_threading(true);
 		}
 
+		if (!benchmark_scene_path.is_empty() || low_latency_mode) {
+			RenderingServer::get_singleton()->viewport_set_measure_render_time(sml->get_root()->get_viewport_rid(), true);
+		}
+
 		bool embed_subwindows = GLOBAL_GET("display/window/subwindows/embed_subwindows");
 
 		if (single_window || (!project_manager && !editor && embed_subwindows) || !DisplayServer::get_singleton()->has_feature(DisplayServer::Feature::FEATURE_SUBWINDOWS)) {
@@ -3531,6 +3626,10 @@ bool Main::start() {
 		ResourceLoader::add_custom_loaders();
 		ResourceSaver::add_custom_savers();
 
+		// When running the project's main scene, it is loaded on a worker thread while the autoloads enter
+		// the tree and the root window is configured, instead of only once all of that has finished.
+		bool main_scene_preloading = false;
+
 		if (!project_manager && !editor) { // game
 			if (!game_path.is_empty() || !script.is_empty()) {
 				//autoload
@@ -3596,6 +3695,10 @@ bool Main::start() {
 					}
 				}
 
+				if (!game_path.is_empty() && game_path == String(GLOBAL_GET("application/run/main_scene"))) {
+					main_scene_preloading = ResourceLoader::load_threaded_request(game_path, "PackedScene") == OK;
+				}
+
 				for (Node *E : to_add) {
 					sml->get_root()->add_child(E);
 				}
@@ -3643,7 +3746,7 @@ bool Main::start() {
 			sml->get_root()->add_child(editor_node);
 
 			if (!_export_preset.is_empty()) {
-				editor_node->export_preset(_export_preset, positional_arg, export_debug, export_pack_only, install_android_build_template);
+				editor_node->export_preset(_export_preset, positional_arg, export_debug, export_pack_only, export_patch, install_android_build_template);
 				game_path = ""; // Do not load anything.
 			}
 
@@ -3792,7 +3895,12 @@ bool Main::start() {
 
 			if (!game_path.is_empty()) {
 				Node *scene = nullptr;
-				Ref<PackedScene> scenedata = ResourceLoader::load(local_game_path);
+				Ref<PackedScene> scenedata;
+				if (main_scene_preloading) {
+					scenedata = ResourceLoader::load_threaded_get(game_path);
+				} else {
+					scenedata = ResourceLoader::load(local_game_path);
+				}
 				if (scenedata.is_valid()) {
 					scene = scenedata->instantiate();
 				}
@@ -3900,12 +4008,131 @@ static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
 
+// Moves the time the main loop would otherwise spend blocked on the swapchain
+// to before input is polled, so the next frame uses input that is as recent as
+// possible while still finishing in time for the following refresh.
+static void _low_latency_wait(uint64_t p_draw_end_ticks, uint64_t p_simulation_ticks) {
+	if (DisplayServer::get_singleton()->window_get_vsync_mode(DisplayServer::MAIN_WINDOW_ID) == DisplayServer::VSYNC_DISABLED && Engine::get_singleton()->get_max_fps() <= 0) {
+		return; // Nothing to pace against.
+	}
+	if (OS::get_singleton()->is_in_low_processor_usage_mode()) {
+		return;
+	}
+
+	uint64_t period_usec = 0;
+	const float refresh_rate = DisplayServer::get_singleton()->screen_get_refresh_rate(DisplayServer::SCREEN_OF_MAIN_WINDOW);
+	if (refresh_rate > 0) {
+		period_usec = uint64_t(1000000.0 / refresh_rate);
+	}
+	const int max_fps = Engine::get_singleton()->get_max_fps();
+	if (max_fps > 0) {
+		period_usec = MAX(period_usec, uint64_t(1000000 / max_fps));
+	}
+	if (period_usec == 0) {
+		return;
+	}
+
+	// The cost of a frame is everything between input polling and the GPU being
+	// done with it. Rendering is measured a few frames late, which is fine as it
+	// changes slowly compared to the refresh period.
+	uint64_t frame_cost = p_simulation_ticks;
+	SceneTree *tree = SceneTree::get_singleton();
+	if (tree) {
+		const RID viewport = tree->get_root()->get_viewport_rid();
+		const double render_msec = RenderingServer::get_singleton()->viewport_get_measured_render_time_cpu(viewport) + RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(viewport);
+		frame_cost += uint64_t(render_msec * 1000.0);
+	}
+
+	// Follow spikes immediately but decay slowly, missing a refresh costs a lot more
+	// latency than waking up a bit early.
+	if (frame_cost > low_latency_frame_cost_usec) {
+		low_latency_frame_cost_usec = frame_cost;
+	} else {
+		low_latency_frame_cost_usec = (low_latency_frame_cost_usec * 31 + frame_cost) / 32;
+	}
+
+	const uint64_t busy_usec = low_latency_frame_cost_usec + low_latency_margin_usec;
+	if (busy_usec >= period_usec) {
+		return;
+	}
+
+	const uint64_t wake_ticks = p_draw_end_ticks + period_usec - busy_usec;
+	const uint64_t current_ticks = OS::get_singleton()->get_ticks_usec();
+	if (current_ticks < wake_ticks) {
+		PROFILE_SCOPE("Low Latency Wait");
+		OS::get_singleton()->delay_usec(wake_ticks - current_ticks);
+	}
+}
+
+static Dictionary _benchmark_scene_summarize(LocalVector<double> &p_values) {
+	Dictionary summary;
+	if (p_values.is_empty()) {
+		return summary;
+	}
+	p_values.sort();
+	double total = 0.0;
+	for (double value : p_values) {
+		total += value;
+	}
+	const uint32_t last = p_values.size() - 1;
+	summary["average"] = total / p_values.size();
+	summary["p50"] = p_values[last * 50 / 100];
+	summary["p90"] = p_values[last * 90 / 100];
+	summary["p99"] = p_values[last * 99 / 100];
+	summary["min"] = p_values[0];
+	summary["max"] = p_values[last];
+	return summary;
+}
+
+static void _save_benchmark_scene() {
+	if (benchmark_scene_path.is_empty() || benchmark_scene_frames.is_empty()) {
+		return;
+	}
+
+	LocalVector<double> cpu_msec, gpu_msec, draw_calls, primitives, objects;
+	for (const BenchmarkSceneFrame &frame_stats : benchmark_scene_frames) {
+		cpu_msec.push_back(frame_stats.cpu_msec);
+		gpu_msec.push_back(frame_stats.gpu_msec);
+		draw_calls.push_back(frame_stats.draw_calls);
+		primitives.push_back(frame_stats.primitives);
+		objects.push_back(frame_stats.objects);
+	}
+
+	Dictionary report;
+	report["scene"] = benchmark_scene_path;
+	report["version"] = VERSION_FULL_BUILD;
+	report["rendering_method"] = OS::get_singleton()->get_current_rendering_method();
+	report["rendering_driver"] = OS::get_singleton()->get_current_rendering_driver_name();
+	report["adapter"] = RenderingServer::get_singleton()->get_video_adapter_name();
+	report["fixed_fps"] = fixed_fps;
+	report["frames"] = benchmark_scene_frames.size();
+	report["cpu_frame_msec"] = _benchmark_scene_summarize(cpu_msec);
+	report["gpu_frame_msec"] = _benchmark_scene_summarize(gpu_msec);
+	report["draw_calls"] = _benchmark_scene_summarize(draw_calls);
+	report["primitives"] = _benchmark_scene_summarize(primitives);
+	report["objects"] = _benchmark_scene_summarize(objects);
+	report["video_mem_peak"] = benchmark_scene_video_mem_peak;
+	benchmark_scene_frames.clear();
+
+	const String json = JSON::stringify(report, "\t", false);
+	if (benchmark_scene_output.is_empty()) {
+		print_line(json);
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(benchmark_scene_output, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open scene benchmark output file: \"%s\".", benchmark_scene_output));
+	f->store_string(json);
+}
+
 bool Main::iteration() {
 	//for now do not error on this
 	//ERR_FAIL_COND_V(iterating, false);
 
 	iterating++;
 
+	PROFILE_SCOPE("Main::iteration");
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -3954,8 +4181,13 @@ bool Main::iteration() {
 
 		Engine::get_singleton()->_in_physics = true;
 
+		PROFILE_SCOPE("Physics Frame");
+
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
+		// Interpolated transforms set during this tick are drawn by interpolating from the ones set during the previous tick.
+		RenderingServer::get_singleton()->tick();
+
 #ifndef _3D_DISABLED
 		PhysicsServer3D::get_singleton()->sync();
 		PhysicsServer3D::get_singleton()->flush_queries();
@@ -3964,7 +4196,9 @@ bool Main::iteration() {
 		PhysicsServer2D::get_singleton()->sync();
 		PhysicsServer2D::get_singleton()->flush_queries();
 
+		RenderingServer::get_singleton()->begin_command_batch();
 		if (OS::get_singleton()->get_main_loop()->physics_process(physics_step * time_scale)) {
+			RenderingServer::get_singleton()->end_command_batch();
 #ifndef _3D_DISABLED
 			PhysicsServer3D::get_singleton()->end_sync();
 #endif // _3D_DISABLED
@@ -3973,23 +4207,30 @@ bool Main::iteration() {
 			exit = true;
 			break;
 		}
+		RenderingServer::get_singleton()->end_command_batch();
 
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
-		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		{
+			PROFILE_SCOPE("Navigation Process");
+			NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		}
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
 
 		message_queue->flush();
 
+		{
+			PROFILE_SCOPE("Physics Step");
 #ifndef _3D_DISABLED
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
 #endif // _3D_DISABLED
 
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -4005,13 +4246,24 @@ bool Main::iteration() {
 	}
 
 	uint64_t process_begin = OS::get_singleton()->get_ticks_usec();
+	uint64_t simulation_ticks = 0;
 
-	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
-		exit = true;
+	{
+		PROFILE_SCOPE("Process");
+		RenderingServer::get_singleton()->begin_command_batch();
+		if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
+			exit = true;
+		}
+		message_queue->flush();
+		RenderingServer::get_singleton()->end_command_batch();
 	}
-	message_queue->flush();
 
-	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	simulation_ticks = OS::get_singleton()->get_ticks_usec() - ticks;
+
+	{
+		PROFILE_SCOPE("RenderingServer Sync");
+		RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	}
 
 	if (DisplayServer::get_singleton()->can_any_window_draw() &&
 			RenderingServer::get_singleton()->is_render_loop_enabled()) {
@@ -4027,10 +4279,27 @@ bool Main::iteration() {
 		}
 	}
 
-	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
+	const uint64_t draw_end_ticks = OS::get_singleton()->get_ticks_usec();
+	process_ticks = draw_end_ticks - process_begin;
 	process_max = MAX(process_ticks, process_max);
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
+	if (!benchmark_scene_path.is_empty()) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		BenchmarkSceneFrame stats;
+		stats.cpu_msec = double(frame_time) / 1000.0;
+		SceneTree *tree = SceneTree::get_singleton();
+		if (tree) {
+			// Measured on the GPU a few frames later, so it lags behind the CPU time.
+			stats.gpu_msec = rs->viewport_get_measured_render_time_gpu(tree->get_root()->get_viewport_rid());
+		}
+		stats.draw_calls = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME);
+		stats.primitives = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME);
+		stats.objects = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
+		benchmark_scene_frames.push_back(stats);
+		benchmark_scene_video_mem_peak = MAX(benchmark_scene_video_mem_peak, rs->get_rendering_info(RenderingServer::RENDERING_INFO_VIDEO_MEM_USED));
+	}
+
 	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
 		ScriptServer::get_language(i)->frame();
 	}
@@ -4044,6 +4313,9 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	// Temporaries allocated from the frame arenas are not valid anymore past this point.
+	FrameAllocator::end_frame();
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
@@ -4089,6 +4361,10 @@ bool Main::iteration() {
 		return exit;
 	}
 
+	if (low_latency_mode) {
+		_low_latency_wait(draw_end_ticks, simulation_ticks);
+	}
+
 	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
 
 #ifdef TOOLS_ENABLED
@@ -4122,6 +4398,9 @@ void Main::force_redraw() {
  * The order matters as some of those steps are linked with each other.
  */
 void Main::cleanup(bool p_force) {
+	ScopeProfiler::end_capture();
+	_save_benchmark_scene();
+
 	OS::get_singleton()->benchmark_begin_measure("Shutdown", "Total");
 	if (!p_force) {
 		ERR_FAIL_COND(!_start_success);
@@ -4136,6 +4415,8 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceLoader::clear_keepalive_cache();
+	FileReadQueue::get_singleton()->finish();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
@@ -30,6 +30,7 @@
 
 #include "performance.h"
 
+#include "core/io/image.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -50,6 +51,8 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_custom_monitor", "id"), &Performance::get_custom_monitor);
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
+	ClassDB::bind_method(D_METHOD("get_memory_snapshot"), &Performance::get_memory_snapshot);
+	ClassDB::bind_method(D_METHOD("diff_memory_snapshots", "from", "to"), &Performance::diff_memory_snapshots);
 
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
@@ -84,6 +87,16 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPTING);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPTING_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES_MAX);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO_MAX);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -132,6 +145,16 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"navigation/edges_merged",
 		"navigation/edges_connected",
 		"navigation/edges_free",
+		"memory/rendering",
+		"memory/rendering_max",
+		"memory/physics",
+		"memory/physics_max",
+		"memory/scripting",
+		"memory/scripting_max",
+		"memory/resources",
+		"memory/resources_max",
+		"memory/audio",
+		"memory/audio_max",
 
 	};
 
@@ -216,6 +239,26 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case MEMORY_RENDERING:
+			return Memory::get_tag_mem_usage(Memory::TAG_RENDERING);
+		case MEMORY_RENDERING_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS:
+			return Memory::get_tag_mem_usage(Memory::TAG_PHYSICS);
+		case MEMORY_PHYSICS_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPTING:
+			return Memory::get_tag_mem_usage(Memory::TAG_SCRIPTING);
+		case MEMORY_SCRIPTING_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_SCRIPTING);
+		case MEMORY_RESOURCES:
+			return Memory::get_tag_mem_usage(Memory::TAG_RESOURCES);
+		case MEMORY_RESOURCES_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_RESOURCES);
+		case MEMORY_AUDIO:
+			return Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+		case MEMORY_AUDIO_MAX:
+			return Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO);
 
 		default: {
 		}
@@ -261,6 +304,16 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -322,6 +375,118 @@ uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
 
+// ObjectDB::debug_objects() takes no userdata, so the snapshot being built is kept here.
+// Snapshots are serialized by snapshot_mutex.
+static HashMap<StringName, Vector2i> *snapshot_classes = nullptr;
+static HashMap<StringName, uint64_t> *snapshot_class_bytes = nullptr;
+static BinaryMutex snapshot_mutex;
+
+static void _snapshot_object(Object *p_obj) {
+	const StringName class_name = p_obj->get_class_name();
+	Vector2i *entry = snapshot_classes->getptr(class_name);
+	if (entry) {
+		entry->x++;
+	} else {
+		snapshot_classes->insert(class_name, Vector2i(1, 0));
+	}
+
+	// Attribute the big data buffers we know about to their class.
+	const Image *image = Object::cast_to<Image>(p_obj);
+	if (image) {
+		(*snapshot_class_bytes)[class_name] += image->get_data().size();
+	}
+}
+
+Dictionary Performance::get_memory_snapshot() const {
+	HashMap<StringName, Vector2i> classes;
+	HashMap<StringName, uint64_t> class_bytes;
+	{
+		MutexLock lock(snapshot_mutex);
+		snapshot_classes = &classes;
+		snapshot_class_bytes = &class_bytes;
+		ObjectDB::debug_objects(&_snapshot_object);
+		snapshot_classes = nullptr;
+		snapshot_class_bytes = nullptr;
+	}
+
+	Dictionary classes_dict;
+	for (const KeyValue<StringName, Vector2i> &E : classes) {
+		Dictionary entry;
+		entry["count"] = E.value.x;
+		const uint64_t *bytes = class_bytes.getptr(E.key);
+		entry["bytes"] = bytes ? *bytes : 0;
+		classes_dict[E.key] = entry;
+	}
+
+	// Several owners may share a description, so they are merged.
+	Dictionary rid_owners_dict;
+	List<RID_AllocBase::AllocInfo> allocs;
+	RID_AllocBase::get_alloc_info_list(&allocs);
+	for (const RID_AllocBase::AllocInfo &info : allocs) {
+		const String name = info.description;
+		Dictionary entry = rid_owners_dict.get(name, Dictionary());
+		entry["count"] = int64_t(entry.get("count", 0)) + info.count;
+		entry["bytes"] = int64_t(entry.get("bytes", 0)) + info.count * info.element_size;
+		rid_owners_dict[name] = entry;
+	}
+
+	Dictionary tags_dict;
+	for (int i = 0; i < Memory::TAG_MAX; i++) {
+		tags_dict[Memory::get_tag_name(Memory::Tag(i))] = Memory::get_tag_mem_usage(Memory::Tag(i));
+	}
+
+	Dictionary snapshot;
+	snapshot["time_usec"] = OS::get_singleton()->get_ticks_usec();
+	snapshot["static_memory"] = Memory::get_mem_usage();
+	snapshot["memory_tags"] = tags_dict;
+	snapshot["classes"] = classes_dict;
+	snapshot["rid_owners"] = rid_owners_dict;
+	return snapshot;
+}
+
+static Dictionary _diff_memory_entries(const Dictionary &p_from, const Dictionary &p_to) {
+	Dictionary diff;
+	const Dictionary empty;
+
+	Array keys = p_to.keys();
+	keys.append_array(p_from.keys());
+	for (int i = 0; i < keys.size(); i++) {
+		const Variant &key = keys[i];
+		if (diff.has(key)) {
+			continue;
+		}
+		const Dictionary from = p_from.get(key, empty);
+		const Dictionary to = p_to.get(key, empty);
+		const int64_t count = int64_t(to.get("count", 0)) - int64_t(from.get("count", 0));
+		const int64_t bytes = int64_t(to.get("bytes", 0)) - int64_t(from.get("bytes", 0));
+		if (count != 0 || bytes != 0) {
+			Dictionary entry;
+			entry["count"] = count;
+			entry["bytes"] = bytes;
+			diff[key] = entry;
+		}
+	}
+	return diff;
+}
+
+Dictionary Performance::diff_memory_snapshots(const Dictionary &p_from, const Dictionary &p_to) const {
+	Dictionary tags;
+	const Dictionary from_tags = p_from.get("memory_tags", Dictionary());
+	const Dictionary to_tags = p_to.get("memory_tags", Dictionary());
+	const Array tag_names = to_tags.keys();
+	for (int i = 0; i < tag_names.size(); i++) {
+		tags[tag_names[i]] = int64_t(to_tags[tag_names[i]]) - int64_t(from_tags.get(tag_names[i], 0));
+	}
+
+	Dictionary diff;
+	diff["time_usec"] = int64_t(p_to.get("time_usec", 0)) - int64_t(p_from.get("time_usec", 0));
+	diff["static_memory"] = int64_t(p_to.get("static_memory", 0)) - int64_t(p_from.get("static_memory", 0));
+	diff["memory_tags"] = tags;
+	diff["classes"] = _diff_memory_entries(p_from.get("classes", Dictionary()), p_to.get("classes", Dictionary()));
+	diff["rid_owners"] = _diff_memory_entries(p_from.get("rid_owners", Dictionary()), p_to.get("rid_owners", Dictionary()));
+	return diff;
+}
+
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
@@ -100,6 +100,16 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		MEMORY_RENDERING,
+		MEMORY_RENDERING_MAX,
+		MEMORY_PHYSICS,
+		MEMORY_PHYSICS_MAX,
+		MEMORY_SCRIPTING,
+		MEMORY_SCRIPTING_MAX,
+		MEMORY_RESOURCES,
+		MEMORY_RESOURCES_MAX,
+		MEMORY_AUDIO,
+		MEMORY_AUDIO_MAX,
 		MONITOR_MAX
 	};
 
@@ -126,6 +136,9 @@ public:
 
 	uint64_t get_monitor_modification_time();
 
+	Dictionary get_memory_snapshot() const;
+	Dictionary diff_memory_snapshots(const Dictionary &p_from, const Dictionary &p_to) const;
+
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
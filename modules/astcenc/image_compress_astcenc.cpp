@@ -30,11 +30,31 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <astcenc.h>
 
+// Images at least this large are compressed with one astcenc thread per worker, since a single
+// large texture would otherwise leave the other cores idle for the whole import.
+static const int64_t ASTCENC_PARALLEL_MIN_PIXELS = 1024 * 1024;
+
+struct ASTCCompressJob {
+	astcenc_context *context = nullptr;
+	astcenc_image *image = nullptr;
+	const astcenc_swizzle *swizzle = nullptr;
+	uint8_t *dest = nullptr;
+	size_t dest_len = 0;
+	astcenc_error *status = nullptr; // One per thread index.
+};
+
+static void _compress_astc_thread(void *p_userdata, uint32_t p_index) {
+	const ASTCCompressJob *job = (const ASTCCompressJob *)p_userdata;
+	// astcenc hands out blocks dynamically, so every thread index joins the same compression pass.
+	job->status[p_index] = astcenc_compress_image(job->context, job->image, job->swizzle, job->dest, job->dest_len, p_index);
+}
+
 void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -115,7 +135,12 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	// Context allocation.
 
 	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	// Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	// Only large images are split further across the worker threads.
+	unsigned int thread_count = 1;
+	if ((int64_t)width * height >= ASTCENC_PARALLEL_MIN_PIXELS) {
+		thread_count = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
+	}
 	status = astcenc_context_alloc(&config, thread_count, &context);
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
@@ -156,7 +181,28 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
 		};
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		if (thread_count > 1) {
+			LocalVector<astcenc_error> thread_status;
+			thread_status.resize(thread_count);
+			ASTCCompressJob job;
+			job.context = context;
+			job.image = &image;
+			job.swizzle = &swizzle;
+			job.dest = dest_mip_write;
+			job.dest_len = comp_len;
+			job.status = thread_status.ptr();
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_astc_thread, &job, thread_count, thread_count, true, SNAME("ASTCCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			status = ASTCENC_SUCCESS;
+			for (const astcenc_error thread_error : thread_status) {
+				if (thread_error != ASTCENC_SUCCESS) {
+					status = thread_error;
+					break;
+				}
+			}
+		} else {
+			status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		}
 
 		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
 				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
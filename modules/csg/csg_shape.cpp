@@ -31,6 +31,7 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -163,78 +164,128 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 }
 
 CSGBrush *CSGShape3D::_get_brush() {
-	if (dirty) {
-		if (brush) {
-			memdelete(brush);
+	if (!dirty) {
+		return brush;
+	}
+
+	// Subtrees that didn't change keep their cached brush. Dirty nodes at the same depth
+	// don't depend on each other, so they are merged in parallel, deepest first.
+	LocalVector<LocalVector<CSGShape3D *>> levels;
+	_prepare_brush(0, levels);
+
+	for (int i = int(levels.size()) - 1; i >= 0; i--) {
+		LocalVector<CSGShape3D *> &level = levels[i];
+		if (level.size() == 1) {
+			level[0]->_merge_brush();
+			continue;
 		}
-		brush = nullptr;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_merge_brush_task, level.ptr(), level.size(), -1, true, SNAME("CSGMergeBrushes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
-		CSGBrush *n = _build_brush();
+	return brush;
+}
 
-		for (int i = 0; i < get_child_count(); i++) {
-			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
-			if (!child) {
-				continue;
-			}
-			if (!child->is_visible()) {
-				continue;
-			}
+void CSGShape3D::_prepare_brush(uint32_t p_depth, LocalVector<LocalVector<CSGShape3D *>> &r_levels) {
+	if (!dirty) {
+		return;
+	}
 
-			CSGBrush *n2 = child->_get_brush();
-			if (!n2) {
-				continue;
-			}
-			if (!n) {
-				n = memnew(CSGBrush);
+	if (own_brush) {
+		memdelete(own_brush);
+	}
+	own_brush = _build_brush();
 
-				n->copy_from(*n2, child->get_transform());
+	brush_children.clear();
+	for (int i = 0; i < get_child_count(); i++) {
+		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (!child) {
+			continue;
+		}
+		if (!child->is_visible()) {
+			continue;
+		}
 
-			} else {
-				CSGBrush *nn = memnew(CSGBrush);
-				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
-
-				CSGBrushOperation bop;
-
-				switch (child->get_operation()) {
-					case CSGShape3D::OPERATION_UNION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_INTERSECTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_SUBTRACTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
-						break;
-				}
-				memdelete(n);
-				memdelete(nn2);
-				n = nn;
+		child->_prepare_brush(p_depth + 1, r_levels);
+
+		BrushChild brush_child;
+		brush_child.shape = child;
+		brush_child.transform = child->get_transform();
+		brush_child.operation = child->get_operation();
+		brush_children.push_back(brush_child);
+	}
+
+	if (r_levels.size() <= p_depth) {
+		r_levels.resize(p_depth + 1);
+	}
+	r_levels[p_depth].push_back(this);
+}
+
+void CSGShape3D::_merge_brush_task(uint32_t p_index, CSGShape3D **p_shapes) {
+	p_shapes[p_index]->_merge_brush();
+}
+
+void CSGShape3D::_merge_brush() {
+	CSGBrush *n = own_brush;
+	own_brush = nullptr;
+
+	for (const BrushChild &child : brush_children) {
+		CSGBrush *n2 = child.shape->brush;
+		if (!n2) {
+			continue;
+		}
+		if (!n) {
+			n = memnew(CSGBrush);
+
+			n->copy_from(*n2, child.transform);
+
+		} else {
+			CSGBrush *nn = memnew(CSGBrush);
+			CSGBrush *nn2 = memnew(CSGBrush);
+			nn2->copy_from(*n2, child.transform);
+
+			CSGBrushOperation bop;
+
+			switch (child.operation) {
+				case CSGShape3D::OPERATION_UNION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_INTERSECTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_SUBTRACTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
+					break;
 			}
+			memdelete(n);
+			memdelete(nn2);
+			n = nn;
 		}
+	}
+	brush_children.clear();
 
-		if (n) {
-			AABB aabb;
-			for (int i = 0; i < n->faces.size(); i++) {
-				for (int j = 0; j < 3; j++) {
-					if (i == 0 && j == 0) {
-						aabb.position = n->faces[i].vertices[j];
-					} else {
-						aabb.expand_to(n->faces[i].vertices[j]);
-					}
+	if (n) {
+		AABB aabb;
+		for (int i = 0; i < n->faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				if (i == 0 && j == 0) {
+					aabb.position = n->faces[i].vertices[j];
+				} else {
+					aabb.expand_to(n->faces[i].vertices[j]);
 				}
 			}
-			node_aabb = aabb;
-		} else {
-			node_aabb = AABB();
 		}
+		node_aabb = aabb;
+	} else {
+		node_aabb = AABB();
+	}
 
-		brush = n;
-
-		dirty = false;
+	if (brush) {
+		memdelete(brush);
 	}
+	brush = n;
 
-	return brush;
+	dirty = false;
 }
 
 int CSGShape3D::mikktGetNumFaces(const SMikkTSpaceContext *pContext) {
@@ -291,6 +342,22 @@ void CSGShape3D::mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const
 	surface.tansw[i++] = d < 0 ? -1 : 1;
 }
 
+void CSGShape3D::_generate_tangents_task(uint32_t p_index, ShapeUpdateSurface *p_surfaces) {
+	SMikkTSpaceInterface mkif;
+	mkif.m_getNormal = mikktGetNormal;
+	mkif.m_getNumFaces = mikktGetNumFaces;
+	mkif.m_getNumVerticesOfFace = mikktGetNumVerticesOfFace;
+	mkif.m_getPosition = mikktGetPosition;
+	mkif.m_getTexCoord = mikktGetTexCoord;
+	mkif.m_setTSpace = mikktSetTSpaceDefault;
+	mkif.m_setTSpaceBasic = nullptr;
+
+	SMikkTSpaceContext msc;
+	msc.m_pInterface = &mkif;
+	msc.m_pUserData = &p_surfaces[p_index];
+	p_surfaces[p_index].have_tangents = genTangSpaceDefault(&msc);
+}
+
 void CSGShape3D::_update_shape() {
 	if (!is_root_shape()) {
 		return;
@@ -408,31 +475,20 @@ void CSGShape3D::_update_shape() {
 		}
 	}
 
+	// Tangent generation is the most expensive part of building the mesh, and surfaces are independent.
+	if (calculate_tangents) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_generate_tangents_task, surfaces.ptrw(), surfaces.size(), -1, true, SNAME("CSGGenerateTangents"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	root_mesh.instantiate();
 	//create surfaces
 
 	for (int i = 0; i < surfaces.size(); i++) {
-		// calculate tangents for this surface
-		bool have_tangents = calculate_tangents;
-		if (have_tangents) {
-			SMikkTSpaceInterface mkif;
-			mkif.m_getNormal = mikktGetNormal;
-			mkif.m_getNumFaces = mikktGetNumFaces;
-			mkif.m_getNumVerticesOfFace = mikktGetNumVerticesOfFace;
-			mkif.m_getPosition = mikktGetPosition;
-			mkif.m_getTexCoord = mikktGetTexCoord;
-			mkif.m_setTSpace = mikktSetTSpaceDefault;
-			mkif.m_setTSpaceBasic = nullptr;
-
-			SMikkTSpaceContext msc;
-			msc.m_pInterface = &mkif;
-			msc.m_pUserData = &surfaces.write[i];
-			have_tangents = genTangSpaceDefault(&msc);
-		}
-
 		if (surfaces[i].last_added == 0) {
 			continue;
 		}
+		bool have_tangents = surfaces[i].have_tangents;
 
 		// and convert to surface array
 		Array array;
@@ -723,6 +779,10 @@ CSGShape3D::~CSGShape3D() {
 		memdelete(brush);
 		brush = nullptr;
 	}
+	if (own_brush) {
+		memdelete(own_brush);
+		own_brush = nullptr;
+	}
 }
 
 //////////////////////////////////
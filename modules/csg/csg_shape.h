@@ -56,6 +56,17 @@ private:
 
 	CSGBrush *brush = nullptr;
 
+	struct BrushChild {
+		CSGShape3D *shape = nullptr;
+		Transform3D transform;
+		Operation operation = OPERATION_UNION;
+	};
+
+	// Filled on the main thread by _prepare_brush(), so _merge_brush() doesn't need to
+	// access the scene tree and dirty nodes can be merged on worker threads.
+	CSGBrush *own_brush = nullptr;
+	LocalVector<BrushChild> brush_children;
+
 	AABB node_aabb;
 
 	bool dirty = false;
@@ -91,6 +102,7 @@ private:
 		Vector<real_t> tans;
 		Ref<Material> material;
 		int last_added = 0;
+		bool have_tangents = false;
 
 		Vector3 *verticesw = nullptr;
 		Vector3 *normalsw = nullptr;
@@ -107,6 +119,11 @@ private:
 	static void mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const float fvTangent[], const float fvBiTangent[], const float fMagS, const float fMagT,
 			const tbool bIsOrientationPreserving, const int iFace, const int iVert);
 
+	void _prepare_brush(uint32_t p_depth, LocalVector<LocalVector<CSGShape3D *>> &r_levels);
+	void _merge_brush();
+	void _merge_brush_task(uint32_t p_index, CSGShape3D **p_shapes);
+	void _generate_tangents_task(uint32_t p_index, ShapeUpdateSurface *p_surfaces);
+
 	void _update_shape();
 	void _update_collision_faces();
 	bool _is_debug_collision_shape_visible();
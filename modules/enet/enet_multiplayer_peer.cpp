@@ -61,6 +61,12 @@ int ENetMultiplayerPeer::get_packet_channel() const {
 	return 0;
 }
 
+uint64_t ENetMultiplayerPeer::get_packet_timestamp() const {
+	ERR_FAIL_COND_V_MSG(!_is_active(), 0, "The multiplayer instance isn't currently active.");
+	ERR_FAIL_COND_V(incoming_packets.is_empty(), 0);
+	return incoming_packets.front()->get().timestamp;
+}
+
 Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_max_channels, int p_in_bandwidth, int p_out_bandwidth) {
 	ERR_FAIL_COND_V_MSG(_is_active(), ERR_ALREADY_IN_USE, "The multiplayer instance is already active.");
 	set_refuse_new_connections(false);
@@ -75,6 +81,7 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	_start_service_thread();
 	return OK;
 }
 
@@ -106,6 +113,7 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	_start_service_thread();
 
 	return OK;
 }
@@ -116,6 +124,7 @@ Error ENetMultiplayerPeer::create_mesh(int p_id) {
 	active_mode = MODE_MESH;
 	unique_id = p_id;
 	connection_status = CONNECTION_CONNECTED;
+	_start_service_thread();
 	return OK;
 }
 
@@ -125,17 +134,21 @@ Error ENetMultiplayerPeer::add_mesh_peer(int p_id, Ref<ENetConnection> p_host) {
 	List<Ref<ENetPacketPeer>> host_peers;
 	p_host->get_peers(host_peers);
 	ERR_FAIL_COND_V_MSG(host_peers.size() != 1 || host_peers[0]->get_state() != ENetPacketPeer::STATE_CONNECTED, ERR_INVALID_PARAMETER, "The provided host must have exactly one peer in the connected state.");
-	hosts[p_id] = p_host;
+	{
+		MutexLock lock(service_mutex);
+		hosts[p_id] = p_host;
+	}
 	peers[p_id] = host_peers[0];
 	emit_signal(SNAME("peer_connected"), p_id);
 	return OK;
 }
 
-void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event &p_event) {
+void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event &p_event, uint64_t p_timestamp) {
 	Packet packet;
 	packet.packet = p_event.packet;
 	packet.channel = p_event.channel_id;
 	packet.from = p_source;
+	packet.timestamp = p_timestamp;
 	if (p_event.packet->flags & ENET_PACKET_FLAG_RELIABLE) {
 		packet.transfer_mode = TRANSFER_MODE_RELIABLE;
 	} else if (p_event.packet->flags & ENET_PACKET_FLAG_UNSEQUENCED) {
@@ -149,22 +162,115 @@ void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event
 
 void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	HashSet<int> to_drop;
-	for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
-		if (E.value->is_active()) {
-			continue;
+	{
+		MutexLock lock(service_mutex);
+		for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
+			if (E.value->is_active()) {
+				continue;
+			}
+			to_drop.insert(E.key);
+		}
+		for (const int &P : to_drop) {
+			peers.erase(P);
+			if (hosts.has(P)) {
+				hosts.erase(P);
+			}
 		}
-		to_drop.insert(E.key);
 	}
 	for (const int &P : to_drop) {
-		peers.erase(P);
-		if (hosts.has(P)) {
-			hosts.erase(P);
-		}
 		ERR_CONTINUE(active_mode == MODE_CLIENT && P != TARGET_PEER_SERVER);
 		emit_signal(SNAME("peer_disconnected"), P);
 	}
 }
 
+bool ENetMultiplayerPeer::_handle_event(int p_host, ENetConnection::EventType p_type, ENetConnection::Event &p_event, uint64_t p_timestamp, HashSet<int> &r_to_drop) {
+	switch (active_mode) {
+		case MODE_CLIENT: {
+			if (p_type == ENetConnection::EVENT_CONNECT) {
+				connection_status = CONNECTION_CONNECTED;
+				emit_signal(SNAME("peer_connected"), 1);
+			} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+				if (connection_status == CONNECTION_CONNECTED) {
+					// Client just disconnected from server.
+					emit_signal(SNAME("peer_disconnected"), 1);
+				}
+				close();
+				return false;
+			} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+				MutexLock lock(service_mutex);
+				_store_packet(1, p_event, p_timestamp);
+			} else if (p_type != ENetConnection::EVENT_NONE) {
+				close(); // Error.
+				return false;
+			}
+			return true;
+		}
+		case MODE_SERVER: {
+			if (p_type == ENetConnection::EVENT_CONNECT) {
+				if (is_refusing_new_connections()) {
+					MutexLock lock(service_mutex);
+					p_event.peer->reset();
+					return true;
+				}
+				// Client joined with invalid ID, probably trying to exploit us.
+				if (p_event.data < 2 || peers.has((int)p_event.data)) {
+					MutexLock lock(service_mutex);
+					p_event.peer->reset();
+					return true;
+				}
+				int id = p_event.data;
+				p_event.peer->set_meta(SNAME("_net_id"), id);
+				peers[id] = p_event.peer;
+				emit_signal(SNAME("peer_connected"), id);
+			} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+				int id = p_event.peer->get_meta(SNAME("_net_id"));
+				if (!peers.has(id)) {
+					// Never fully connected.
+					return true;
+				}
+				emit_signal(SNAME("peer_disconnected"), id);
+				peers.erase(id);
+			} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+				int32_t source = p_event.peer->get_meta(SNAME("_net_id"));
+				MutexLock lock(service_mutex);
+				_store_packet(source, p_event, p_timestamp);
+			} else if (p_type != ENetConnection::EVENT_NONE) {
+				close(); // Error
+				return false;
+			}
+			return true;
+		}
+		case MODE_MESH: {
+			if (p_type == ENetConnection::EVENT_CONNECT) {
+				MutexLock lock(service_mutex);
+				p_event.peer->reset();
+			} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+				MutexLock lock(service_mutex);
+				_store_packet(p_host, p_event, p_timestamp);
+			} else if (p_type == ENetConnection::EVENT_NONE) {
+				return false; // Keep polling the others.
+			} else {
+				r_to_drop.insert(p_host); // Error or disconnect.
+				return false; // Keep polling the others.
+			}
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+void ENetMultiplayerPeer::_service_host(int p_host, uint64_t p_timestamp, HashSet<int> &r_to_drop) {
+	Ref<ENetConnection> host = hosts[p_host];
+	ENetConnection::Event event;
+	ENetConnection::EventType ret = host->service(0, event);
+	do {
+		if (!_handle_event(p_host, ret, event, p_timestamp, r_to_drop)) {
+			break;
+		}
+	} while (hosts.has(p_host) && host->check_events(ret, event) > 0);
+}
+
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
@@ -172,94 +278,120 @@ void ENetMultiplayerPeer::poll() {
 
 	_disconnect_inactive_peers();
 
-	switch (active_mode) {
-		case MODE_CLIENT: {
-			if (!peers.has(1)) {
-				close();
-				return;
+	if (active_mode == MODE_CLIENT && !peers.has(1)) {
+		close();
+		return;
+	}
+
+	HashSet<int> to_drop;
+	if (service_thread.is_started()) {
+		// The hosts are serviced by the thread, only dispatch what it received since the last poll.
+		LocalVector<ServiceEvent> events;
+		{
+			MutexLock lock(service_mutex);
+			events = service_events;
+			service_events.clear();
+		}
+		for (ServiceEvent &E : events) {
+			// Skip events from hosts that have been dropped (or replaced) in the meantime.
+			if (!_is_active() || to_drop.has(E.host_id) || !hosts.has(E.host_id) || hosts[E.host_id] != E.host || !_handle_event(E.host_id, E.type, E.event, E.timestamp, to_drop)) {
+				_discard_service_event(E);
 			}
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					connection_status = CONNECTION_CONNECTED;
-					emit_signal(SNAME("peer_connected"), 1);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					if (connection_status == CONNECTION_CONNECTED) {
-						// Client just disconnected from server.
-						emit_signal(SNAME("peer_disconnected"), 1);
-					}
-					close();
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error.
-				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_SERVER: {
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					if (is_refusing_new_connections()) {
-						event.peer->reset();
-						continue;
-					}
-					// Client joined with invalid ID, probably trying to exploit us.
-					if (event.data < 2 || peers.has((int)event.data)) {
-						event.peer->reset();
-						continue;
-					}
-					int id = event.data;
-					event.peer->set_meta(SNAME("_net_id"), id);
-					peers[id] = event.peer;
-					emit_signal(SNAME("peer_connected"), id);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					int id = event.peer->get_meta(SNAME("_net_id"));
-					if (!peers.has(id)) {
-						// Never fully connected.
-						continue;
-					}
-					emit_signal(SNAME("peer_disconnected"), id);
-					peers.erase(id);
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					int32_t source = event.peer->get_meta(SNAME("_net_id"));
-					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
+		}
+	} else {
+		uint64_t timestamp = OS::get_singleton()->get_ticks_usec();
+		switch (active_mode) {
+			case MODE_CLIENT:
+			case MODE_SERVER: {
+				_service_host(0, timestamp, to_drop);
+			} break;
+			case MODE_MESH: {
+				for (const KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+					_service_host(E.key, timestamp, to_drop);
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_MESH: {
-			HashSet<int> to_drop;
-			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+			} break;
+			default:
+				return;
+		}
+	}
+
+	for (const int &P : to_drop) {
+		if (peers.has(P)) {
+			emit_signal(SNAME("peer_disconnected"), P);
+			peers.erase(P);
+		}
+		MutexLock lock(service_mutex);
+		hosts.erase(P);
+	}
+}
+
+void ENetMultiplayerPeer::_discard_service_event(ServiceEvent &p_event) {
+	if (p_event.type == ENetConnection::EVENT_RECEIVE && p_event.event.packet) {
+		MutexLock lock(service_mutex);
+		_destroy_unused(p_event.event.packet);
+		p_event.event.packet = nullptr;
+	}
+}
+
+void ENetMultiplayerPeer::_service_thread_func(void *p_userdata) {
+	ENetMultiplayerPeer *self = static_cast<ENetMultiplayerPeer *>(p_userdata);
+	while (!self->service_thread_exit.is_set()) {
+		{
+			MutexLock lock(self->service_mutex);
+			uint64_t timestamp = OS::get_singleton()->get_ticks_usec();
+			for (const KeyValue<int, Ref<ENetConnection>> &E : self->hosts) {
+				// Servicing also sends pending acknowledgements and queued packets right away.
 				ENetConnection::Event event;
 				ENetConnection::EventType ret = E.value->service(0, event);
 				do {
-					if (ret == ENetConnection::EVENT_CONNECT) {
-						event.peer->reset();
-					} else if (ret == ENetConnection::EVENT_RECEIVE) {
-						_store_packet(E.key, event);
-					} else if (ret == ENetConnection::EVENT_NONE) {
-						break; // Keep polling the others.
-					} else {
-						to_drop.insert(E.key); // Error or disconnect.
-						break; // Keep polling the others.
+					if (ret == ENetConnection::EVENT_NONE) {
+						break;
+					}
+					ServiceEvent sev;
+					sev.host_id = E.key;
+					sev.host = E.value;
+					sev.type = ret;
+					sev.event = event;
+					sev.timestamp = timestamp;
+					self->service_events.push_back(sev);
+					if (ret == ENetConnection::EVENT_ERROR) {
+						break;
 					}
+					event = ENetConnection::Event();
 				} while (E.value->check_events(ret, event) > 0);
 			}
-			for (const int &P : to_drop) {
-				if (peers.has(P)) {
-					emit_signal(SNAME("peer_disconnected"), P);
-					peers.erase(P);
-				}
-				hosts.erase(P);
-			}
-		} break;
-		default:
-			return;
+		}
+		OS::get_singleton()->delay_usec(SERVICE_THREAD_INTERVAL_USEC);
+	}
+}
+
+void ENetMultiplayerPeer::_start_service_thread() {
+	if (!use_service_thread || service_thread.is_started()) {
+		return;
+	}
+	service_thread_exit.clear();
+	service_thread.start(_service_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_service_thread() {
+	if (!service_thread.is_started()) {
+		return;
 	}
+	service_thread_exit.set();
+	service_thread.wait_to_finish();
+	for (ServiceEvent &E : service_events) {
+		_discard_service_event(E);
+	}
+	service_events.clear();
+}
+
+void ENetMultiplayerPeer::set_use_service_thread(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The service thread can only be toggled while the multiplayer instance is inactive.");
+	use_service_thread = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_using_service_thread() const {
+	return use_service_thread;
 }
 
 bool ENetMultiplayerPeer::is_server() const {
@@ -272,23 +404,28 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
-	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
-		hosts[0]->flush();
-	} else {
-		ERR_FAIL_COND(!hosts.has(p_peer));
-		hosts[p_peer]->flush();
-	}
-	if (p_force) {
-		peers.erase(p_peer);
-		if (hosts.has(p_peer)) {
-			hosts.erase(p_peer);
+	{
+		MutexLock lock(service_mutex);
+		peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
+		if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+			hosts[0]->flush();
+		} else {
+			ERR_FAIL_COND(!hosts.has(p_peer));
+			hosts[p_peer]->flush();
 		}
-		if (active_mode == MODE_CLIENT) {
-			hosts.clear(); // Avoid flushing again.
-			close();
+		if (p_force) {
+			peers.erase(p_peer);
+			if (hosts.has(p_peer)) {
+				hosts.erase(p_peer);
+			}
+			if (active_mode == MODE_CLIENT) {
+				hosts.clear(); // Avoid flushing again.
+			}
 		}
 	}
+	if (p_force && active_mode == MODE_CLIENT) {
+		close();
+	}
 }
 
 void ENetMultiplayerPeer::close() {
@@ -296,6 +433,8 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	_stop_service_thread();
+
 	_pop_current_packet();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
@@ -370,6 +509,7 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	MutexLock lock(service_mutex);
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -423,6 +563,7 @@ int ENetMultiplayerPeer::get_max_packet_size() const {
 
 void ENetMultiplayerPeer::_pop_current_packet() {
 	if (current_packet.packet) {
+		MutexLock lock(service_mutex);
 		current_packet.packet->referenceCount--;
 		_destroy_unused(current_packet.packet);
 		current_packet.packet = nullptr;
@@ -443,6 +584,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(service_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -476,11 +618,15 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_mesh", "unique_id"), &ENetMultiplayerPeer::create_mesh);
 	ClassDB::bind_method(D_METHOD("add_mesh_peer", "peer_id", "host"), &ENetMultiplayerPeer::add_mesh_peer);
 	ClassDB::bind_method(D_METHOD("set_bind_ip", "ip"), &ENetMultiplayerPeer::set_bind_ip);
+	ClassDB::bind_method(D_METHOD("set_use_service_thread", "enabled"), &ENetMultiplayerPeer::set_use_service_thread);
+	ClassDB::bind_method(D_METHOD("is_using_service_thread"), &ENetMultiplayerPeer::is_using_service_thread);
+	ClassDB::bind_method(D_METHOD("get_packet_timestamp"), &ENetMultiplayerPeer::get_packet_timestamp);
 
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_service_thread"), "set_use_service_thread", "is_using_service_thread");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -34,6 +34,10 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -76,13 +80,39 @@ private:
 		int from = 0;
 		int channel = 0;
 		TransferMode transfer_mode = TRANSFER_MODE_RELIABLE;
+		uint64_t timestamp = 0;
 	};
 
 	List<Packet> incoming_packets;
 
 	Packet current_packet;
 
-	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
+	// Optional service thread, which runs the ENet hosts independently of the frame rate.
+	// Events are queued for the next poll(), every access to the hosts is guarded by service_mutex.
+	struct ServiceEvent {
+		int host_id = 0;
+		Ref<ENetConnection> host;
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+		uint64_t timestamp = 0;
+	};
+
+	static const uint64_t SERVICE_THREAD_INTERVAL_USEC = 1000;
+
+	bool use_service_thread = false;
+	Thread service_thread;
+	SafeFlag service_thread_exit;
+	Mutex service_mutex;
+	LocalVector<ServiceEvent> service_events;
+
+	static void _service_thread_func(void *p_userdata);
+	void _start_service_thread();
+	void _stop_service_thread();
+	void _discard_service_event(ServiceEvent &p_event);
+
+	bool _handle_event(int p_host, ENetConnection::EventType p_type, ENetConnection::Event &p_event, uint64_t p_timestamp, HashSet<int> &r_to_drop);
+	void _service_host(int p_host, uint64_t p_timestamp, HashSet<int> &r_to_drop);
+	void _store_packet(int32_t p_source, ENetConnection::Event &p_event, uint64_t p_timestamp);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
 	void _destroy_unused(ENetPacket *p_packet);
@@ -99,6 +129,7 @@ public:
 	virtual int get_packet_peer() const override;
 	virtual TransferMode get_packet_mode() const override;
 	virtual int get_packet_channel() const override;
+	uint64_t get_packet_timestamp() const;
 
 	virtual void poll() override;
 	virtual void close() override;
@@ -126,6 +157,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_use_service_thread(bool p_enabled);
+	bool is_using_service_thread() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
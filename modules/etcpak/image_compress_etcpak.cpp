@@ -30,6 +30,7 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
@@ -88,6 +89,75 @@ void _compress_bc(Image *r_img, Image::UsedChannels p_channels) {
 	_compress_etcpak(type, r_img);
 }
 
+static const uint32_t ETCPAK_PARALLEL_MIN_BLOCKS = 128 * 128;
+static const int ETCPAK_STRIP_BLOCK_ROWS = 16;
+
+static void _compress_etcpak_blocks(EtcpakType p_compresstype, const uint32_t *p_src, uint64_t *p_dst, uint32_t p_blocks, int p_width) {
+	switch (p_compresstype) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressDxt1Dither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressDxt5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+struct EtcpakStripJob {
+	EtcpakType type;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	int width = 0; // Padded mip width, in pixels.
+	int block_rows = 0;
+	int block_words = 1; // Size of a compressed block, in uint64_t.
+};
+
+static void _compress_etcpak_strip(void *p_userdata, uint32_t p_index) {
+	const EtcpakStripJob *job = (const EtcpakStripJob *)p_userdata;
+	// etcpak walks blocks in rows, so a strip of whole block rows is contiguous in both source and destination.
+	const int row_begin = p_index * ETCPAK_STRIP_BLOCK_ROWS;
+	const int row_end = MIN(row_begin + ETCPAK_STRIP_BLOCK_ROWS, job->block_rows);
+	const int blocks_per_row = job->width / 4;
+	const uint32_t *src = job->src + (size_t)row_begin * 4 * job->width;
+	uint64_t *dst = job->dst + (size_t)row_begin * blocks_per_row * job->block_words;
+	_compress_etcpak_blocks(job->type, src, dst, (row_end - row_begin) * blocks_per_row, job->width);
+}
+
 void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -189,6 +259,11 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
 	Vector<uint32_t> padded_src;
 
+	// Formats with alpha (or two channels) use 16 bytes per block, the others 8.
+	const bool wide_blocks = p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RG ||
+			p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG || p_compresstype == EtcpakType::ETCPAK_TYPE_RGTC_RG;
+	const int block_words = wide_blocks ? 2 : 1;
+
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
 		int orig_mip_w, orig_mip_h;
@@ -230,48 +305,21 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 			src_mip_read = padded_src.ptr();
 		}
 
-		switch (p_compresstype) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
+		// Large mips are split in strips of block rows, compressed in parallel.
+		const int block_rows = mip_h / 4;
+		if (blocks >= ETCPAK_PARALLEL_MIN_BLOCKS && block_rows > ETCPAK_STRIP_BLOCK_ROWS) {
+			EtcpakStripJob job;
+			job.type = p_compresstype;
+			job.src = src_mip_read;
+			job.dst = dest_mip_write;
+			job.width = mip_w;
+			job.block_rows = block_rows;
+			job.block_words = block_words;
+			const int strips = (block_rows + ETCPAK_STRIP_BLOCK_ROWS - 1) / ETCPAK_STRIP_BLOCK_ROWS;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_etcpak_strip, &job, strips, -1, true, SNAME("EtcpakCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_compress_etcpak_blocks(p_compresstype, src_mip_read, dest_mip_write, blocks, mip_w);
 		}
 	}
 
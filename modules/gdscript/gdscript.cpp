@@ -690,6 +690,8 @@ Error GDScript::reload(bool p_keep_state) {
 	if (reloading) {
 		return OK;
 	}
+
+	MemoryTagScope memory_tag(Memory::TAG_SCRIPTING);
 	reloading = true;
 
 	bool has_instances;
@@ -740,38 +742,52 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
-	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+
+	// Binary tokens only come from exports and can't change, so if another script already needed
+	// this one, the tree the cache parsed and analyzed for it can be compiled as is.
+	Ref<GDScriptParserRef> cached_parser;
+	if (!binary_tokens.is_empty() && !p_keep_state) {
+		cached_parser = GDScriptCache::get_cached_parser(path);
+		if (cached_parser.is_valid() && cached_parser->raise_status(GDScriptParserRef::FULLY_SOLVED) != OK) {
+			cached_parser.unref(); // Parse again below, to report the errors.
 		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
-
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+	GDScriptParser own_parser;
+	GDScriptParser &parser = cached_parser.is_valid() ? *cached_parser->get_parser() : own_parser;
+	Error err;
+	if (cached_parser.is_null()) {
+		if (!binary_tokens.is_empty()) {
+			err = parser.parse_binary(binary_tokens, path);
+		} else {
+			err = parser.parse(source, path, false);
+		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+			}
+			// TODO: Show all error messages.
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
-		while (e != nullptr) {
-			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-			e = e->next();
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+			}
+
+			const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
+			while (e != nullptr) {
+				_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+				e = e->next();
+			}
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
 	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
@@ -1097,6 +1113,68 @@ Ref<GDScript> GDScript::get_base() const {
 	return base;
 }
 
+static uint32_t _hash_data_type(const GDScriptDataType &p_type, uint32_t p_hash) {
+	uint32_t h = hash_murmur3_one_32(p_type.has_type, p_hash);
+	h = hash_murmur3_one_32(p_type.kind, h);
+	h = hash_murmur3_one_32(p_type.builtin_type, h);
+	h = hash_murmur3_one_32(p_type.native_type.hash(), h);
+	h = hash_murmur3_one_64((uint64_t)p_type.script_type, h);
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		h = _hash_data_type(element_type, h);
+	}
+	return h;
+}
+
+uint32_t GDScript::get_interface_hash() const {
+	auto hash_member_info = [](const StringName &p_name, const MemberInfo &p_info, uint32_t p_hash) {
+		uint32_t h = hash_murmur3_one_32(p_name.hash(), p_hash);
+		h = hash_murmur3_one_32(p_info.index, h);
+		h = hash_murmur3_one_32(p_info.setter.hash(), h);
+		h = hash_murmur3_one_32(p_info.getter.hash(), h);
+		h = _hash_data_type(p_info.data_type, h);
+		return hash_murmur3_one_32(Dictionary(p_info.property_info).hash(), h);
+	};
+
+	uint32_t h = hash_murmur3_one_64((uint64_t)_base);
+	h = hash_murmur3_one_64((uint64_t)native.ptr(), h);
+	h = hash_murmur3_one_32(tool, h);
+
+	for (const KeyValue<StringName, MemberInfo> &E : member_indices) {
+		h = hash_member_info(E.key, E.value, h);
+	}
+	for (const KeyValue<StringName, MemberInfo> &E : static_variables_indices) {
+		h = hash_member_info(E.key, E.value, h);
+	}
+	// Constant values are inlined into the code of inheriting classes.
+	for (const KeyValue<StringName, Variant> &E : constants) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value.hash(), h);
+	}
+	for (const KeyValue<StringName, GDScriptFunction *> &E : member_functions) {
+		const GDScriptFunction *function = E.value;
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(function->_static, h);
+		h = hash_murmur3_one_32(function->_default_arg_count, h);
+		h = hash_murmur3_one_32(Dictionary(function->method_info).hash(), h);
+		h = _hash_data_type(function->return_type, h);
+		for (const GDScriptDataType &argument_type : function->argument_types) {
+			h = _hash_data_type(argument_type, h);
+		}
+	}
+	for (const KeyValue<StringName, MethodInfo> &E : _signals) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(Dictionary(E.value).hash(), h);
+	}
+	h = hash_murmur3_one_32(rpc_config.hash(), h);
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : subclasses) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value->get_interface_hash(), h);
+	}
+
+	return hash_fmix32(h);
+}
+
 bool GDScript::inherits_script(const Ref<Script> &p_script) const {
 	Ref<GDScript> gd = p_script;
 	if (gd.is_null()) {
@@ -1554,6 +1632,14 @@ GDScript::~GDScript() {
 
 	clear();
 
+	{
+		// Lambdas shared by their functions can outlive the script, make sure they don't touch it anymore.
+		MutexLock lock(func_ptrs_to_update_mutex);
+		for (UpdatableFuncPtr *updatable : func_ptrs_to_update) {
+			updatable->list_element = nullptr;
+		}
+	}
+
 	{
 		MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 
@@ -2132,6 +2218,21 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+#ifdef DEBUG_ENABLED
+	uint64_t sampling_interval_usec = 1000;
+	List<String> cmdline_args = OS::get_singleton()->get_cmdline_args();
+	for (List<String>::Element *E = cmdline_args.front(); E; E = E->next()) {
+		if (E->get() == "--gdscript-sampling-profile" && E->next()) {
+			sampling_profile_path = E->next()->get();
+		} else if (E->get() == "--gdscript-sampling-interval" && E->next()) {
+			sampling_interval_usec = MAX(E->next()->get().to_int(), 1);
+		}
+	}
+	if (!sampling_profile_path.is_empty()) {
+		sampling_profiler.start(sampling_interval_usec);
+	}
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2146,6 +2247,15 @@ String GDScriptLanguage::get_extension() const {
 }
 
 void GDScriptLanguage::finish() {
+#ifdef DEBUG_ENABLED
+	if (sampling_profiler.is_active()) {
+		sampling_profiler.stop();
+		if (!sampling_profile_path.is_empty() && sampling_profiler.save_folded_stacks(sampling_profile_path) == OK) {
+			print_line(vformat("GDScript: Saved %d samples to \"%s\".", sampling_profiler.get_sample_count(), sampling_profile_path));
+		}
+	}
+#endif
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
@@ -2457,11 +2567,23 @@ void GDScriptLanguage::reload_scripts(const Array &p_scripts, bool p_soft_reload
 		}
 	}
 
+	// Inheriting scripts only need to be recompiled when the interface of their base changed,
+	// otherwise their instances are just recreated. `to_reload` is in inheritance order.
+	HashSet<Ref<GDScript>> interface_changed;
+
 	for (KeyValue<Ref<GDScript>, HashMap<ObjectID, List<Pair<StringName, Variant>>>> &E : to_reload) {
 		Ref<GDScript> scr = E.key;
-		print_verbose("GDScript: Reloading: " + scr->get_path());
-		scr->load_source_code(scr->get_path());
-		scr->reload(p_soft_reload);
+		if (p_scripts.has(scr) || interface_changed.has(scr->get_base())) {
+			uint32_t interface_hash = scr->get_interface_hash();
+			print_verbose("GDScript: Reloading: " + scr->get_path());
+			scr->load_source_code(scr->get_path());
+			scr->reload(p_soft_reload);
+			if (scr->get_interface_hash() != interface_hash) {
+				interface_changed.insert(scr);
+			}
+		} else {
+			print_verbose("GDScript: Base class interface unchanged, not recompiling: " + scr->get_path());
+		}
 
 		//restore state if saved
 		for (KeyValue<ObjectID, List<Pair<StringName, Variant>>> &F : E.value) {
@@ -2768,6 +2890,8 @@ GDScriptLanguage::GDScriptLanguage() {
 		String path = GDScriptWarning::get_settings_path_from_code(code);
 		GLOBAL_DEF(GDScriptWarning::get_property_info(code), default_enabled);
 	}
+
+	check_thread_affinity = GLOBAL_DEF("debug/settings/gdscript/check_thread_affinity", false);
 #endif // DEBUG_ENABLED
 }
 
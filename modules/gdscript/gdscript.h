@@ -32,6 +32,7 @@
 #define GDSCRIPT_H
 
 #include "gdscript_function.h"
+#include "gdscript_sampling_profiler.h"
 
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
@@ -268,6 +269,8 @@ public:
 
 	bool is_tool() const override { return tool; }
 	Ref<GDScript> get_base() const;
+	// Hash of everything compiled inheriting classes depend on: member layout, signatures, constants, signals and inner classes.
+	uint32_t get_interface_hash() const;
 
 	const HashMap<StringName, MemberInfo> &debug_get_member_indices() const { return member_indices; }
 	const HashMap<StringName, GDScriptFunction *> &debug_get_member_functions() const; //this is debug only
@@ -452,6 +455,12 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profile_native_calls;
 	uint64_t script_frame_time;
 
+#ifdef DEBUG_ENABLED
+	GDScriptSamplingProfiler sampling_profiler;
+	String sampling_profile_path; // Set with `--gdscript-sampling-profile <path>`, saved on exit.
+	bool check_thread_affinity = false; // Report calls into nodes from threads that can't access them.
+#endif
+
 	HashMap<String, ObjectID> orphan_subclasses;
 
 public:
@@ -216,9 +216,16 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		}
 		function->_global_names_count = function->global_names.size();
 
+		function->member_caches.resize(function->global_names.size());
+		for (int i = 0; i < function->global_names.size(); i++) {
+			function->member_caches[i].set_member(function->global_names[i]);
+		}
+		function->_member_caches_ptr = function->member_caches.ptr();
+
 	} else {
 		function->_global_names_ptr = nullptr;
 		function->_global_names_count = 0;
+		function->_member_caches_ptr = nullptr;
 	}
 
 	if (opcodes.size()) {
@@ -467,10 +474,10 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_TRANSFORM2D);
 			break;
 		case Variant::VECTOR4:
-			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3);
+			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4);
 			break;
 		case Variant::VECTOR4I:
-			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3I);
+			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4I);
 			break;
 		case Variant::PLANE:
 			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_PLANE);
@@ -581,20 +588,72 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+static GDScriptFunction::Opcode get_typed_arithmetic_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type != p_right_type) {
+		return GDScriptFunction::OPCODE_END;
+	}
+	switch (p_operator) {
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+			break;
+		case Variant::OP_DIVIDE:
+			if (p_left_type == Variant::INT) {
+				return GDScriptFunction::OPCODE_END; // Needs the division by zero check.
+			}
+			break;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+	switch (p_left_type) {
+		case Variant::INT:
+			return GDScriptFunction::OPCODE_OPERATOR_INT;
+		case Variant::FLOAT:
+			return GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+		case Variant::VECTOR2:
+			return GDScriptFunction::OPCODE_OPERATOR_VECTOR2;
+		case Variant::VECTOR3:
+			return GDScriptFunction::OPCODE_OPERATOR_VECTOR3;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
+		bool fusable = false;
 		if (p_target.mode == Address::TEMPORARY) {
 			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
 			}
+			fusable = result_type == Variant::BOOL;
+		}
+
+		// Plain arithmetic on the common math types is evaluated inline by the VM.
+		GDScriptFunction::Opcode typed_opcode = get_typed_arithmetic_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			if (p_target.mode == Address::TEMPORARY) {
+				typed_operator_pos = opcodes.size();
+				typed_operator_target = p_target.address;
+			}
+			append_opcode(typed_opcode);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(p_operator);
+			return;
 		}
 
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		if (fusable) {
+			fusable_operator_pos = opcodes.size();
+			fusable_operator_target = p_target.address;
+		}
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -660,16 +719,31 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
+bool GDScriptByteCodeGenerator::fuse_jump_if_not(const Address &p_condition) {
+	// Only when the condition is the boolean result of the validated operator just written.
+	if (fusable_operator_pos < 0 || fusable_operator_pos + 5 != opcodes.size() || p_condition.mode != Address::TEMPORARY || p_condition.address != fusable_operator_target) {
+		return false;
+	}
+	// The operands stay in place, the jump destination is appended by the caller.
+	opcodes.write[fusable_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+	fusable_operator_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	if (!fuse_jump_if_not(p_left_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_left_operand);
+	}
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	if (!fuse_jump_if_not(p_right_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_right_operand);
+	}
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -725,8 +799,10 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -945,6 +1021,26 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 	}
 }
 
+void GDScriptByteCodeGenerator::write_assign_result(const Address &p_target, const Address &p_result) {
+	// A typed operator that just computed the result into a temporary can write to a typed local directly,
+	// which saves both the assignment and a copy of the value.
+	bool retarget = typed_operator_pos >= 0 && typed_operator_pos + 5 == opcodes.size() && p_result.mode == Address::TEMPORARY && p_result.address == typed_operator_target;
+	retarget = retarget && (p_target.mode == Address::LOCAL_VARIABLE || p_target.mode == Address::FUNCTION_PARAMETER);
+	retarget = retarget && p_target.type.has_type && p_target.type.kind == GDScriptDataType::BUILTIN && p_target.type.builtin_type == temporaries[p_result.address].type;
+	// The result operand must be the last word referencing the temporary, so it can be forgotten before being replaced.
+	int result_index = typed_operator_pos + 3;
+	retarget = retarget && temporaries[p_result.address].bytecode_indices.size() > 0 && temporaries[p_result.address].bytecode_indices[temporaries[p_result.address].bytecode_indices.size() - 1] == result_index;
+	if (!retarget) {
+		write_assign(p_target, p_result);
+		return;
+	}
+
+	Vector<int> &indices = temporaries.write[p_result.address].bytecode_indices;
+	indices.resize(indices.size() - 1);
+	opcodes.write[result_index] = address_of(p_target);
+	typed_operator_pos = -1;
+}
+
 void GDScriptByteCodeGenerator::write_assign_true(const Address &p_target) {
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_TRUE);
 	append(p_target);
@@ -1408,8 +1504,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1612,12 +1710,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	fusable_operator_pos = -1; // The loop jumps back here.
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!fuse_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -157,6 +157,16 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Start of the last instruction if it is a validated operator with a boolean result,
+	// so a conditional jump on that result can be fused into it. Cleared when a jump target is placed.
+	int fusable_operator_pos = -1;
+	uint32_t fusable_operator_target = 0;
+
+	// Start of the last instruction if it is a typed arithmetic operator writing to a temporary,
+	// so an assignment of that temporary can make it write to the assigned variable instead.
+	int typed_operator_pos = -1;
+	uint32_t typed_operator_target = 0;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -445,8 +455,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		fusable_operator_pos = -1; // Something jumps here, so the previous instruction can't be extended.
 	}
 
+	bool fuse_jump_if_not(const Address &p_condition);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -496,6 +509,7 @@ public:
 	virtual void write_get_static_variable(const Address &p_target, const Address &p_class, int p_index) override;
 	virtual void write_assign(const Address &p_target, const Address &p_source) override;
 	virtual void write_assign_with_conversion(const Address &p_target, const Address &p_source) override;
+	virtual void write_assign_result(const Address &p_target, const Address &p_result) override;
 	virtual void write_assign_true(const Address &p_target) override;
 	virtual void write_assign_false(const Address &p_target) override;
 	virtual void write_assign_default_parameter(const Address &p_dst, const Address &p_src, bool p_use_conversion) override;
@@ -36,6 +36,8 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 
 bool GDScriptParserRef::is_valid() const {
@@ -64,19 +66,15 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 		return result;
 	}
 
+	raising_depth++;
 	while (p_new_status > status) {
 		switch (status) {
 			case EMPTY: {
-				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					result = parser->parse_binary(GDScriptCache::get_binary_tokens(remapped_path), path);
-				} else {
-					result = parser->parse(GDScriptCache::get_source_code(remapped_path), path, false);
-				}
+				_parse(ResourceLoader::path_remap(path));
 			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
+				_parse_referenced_scripts_ahead();
 				Error inheritance_result = get_analyzer()->resolve_inheritance();
 				if (result == OK) {
 					result = inheritance_result;
@@ -95,19 +93,68 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				if (result == OK) {
 					result = body_result;
 				}
+				parsed_ahead.clear(); // The analysis took its own references to what it used.
 			} break;
 			case FULLY_SOLVED: {
+				raising_depth--;
 				return result;
 			}
 		}
 		if (result != OK) {
+			raising_depth--;
 			return result;
 		}
 	}
+	raising_depth--;
 
 	return result;
 }
 
+void GDScriptParserRef::_parse(const String &p_remapped_path) {
+	status = PARSED;
+	if (p_remapped_path.get_extension().to_lower() == "gdc") {
+		result = parser->parse_binary(GDScriptCache::get_binary_tokens(p_remapped_path), path);
+	} else {
+		result = parser->parse(GDScriptCache::get_source_code(p_remapped_path), path, false);
+	}
+}
+
+void GDScriptParserRef::_parse_ahead_task(uint32_t p_index, ParseAheadItem *p_items) {
+	p_items[p_index].ref->_parse(p_items[p_index].remapped_path);
+}
+
+void GDScriptParserRef::_parse_referenced_scripts_ahead() {
+	// The analysis is about to request the scripts referenced by path, one at a time.
+	// Parsing only needs the source, so the ones not in the cache yet are parsed together first.
+	MutexLock lock(GDScriptCache::singleton->mutex);
+
+	LocalVector<ParseAheadItem> to_parse;
+	for (const String &E : parser->get_referenced_scripts()) {
+		if (GDScriptCache::singleton->parser_map.has(E)) {
+			continue;
+		}
+		String remapped_path = ResourceLoader::path_remap(E);
+		if (!FileAccess::exists(remapped_path)) {
+			continue;
+		}
+		Ref<GDScriptParserRef> ref;
+		ref.instantiate();
+		ref->parser = memnew(GDScriptParser);
+		ref->path = E;
+		GDScriptCache::singleton->parser_map[E] = ref.ptr();
+		parsed_ahead.push_back(ref); // Keep alive until this script is analyzed.
+		to_parse.push_back({ ref.ptr(), remapped_path });
+	}
+
+	if (to_parse.size() < 2) {
+		return; // Not worth a task, the analysis parses it when it gets there.
+	}
+
+	// The cache mutex stays locked, so no other thread raises these until they are parsed.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GDScriptParserRef::_parse_ahead_task, to_parse.ptr(), to_parse.size(), -1, true, SNAME("GDScriptParseAhead"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void GDScriptParserRef::clear() {
 	if (cleared) {
 		return;
@@ -121,6 +168,8 @@ void GDScriptParserRef::clear() {
 	if (analyzer != nullptr) {
 		memdelete(analyzer);
 	}
+
+	parsed_ahead.clear();
 }
 
 GDScriptParserRef::~GDScriptParserRef() {
@@ -209,6 +258,19 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+Ref<GDScriptParserRef> GDScriptCache::get_cached_parser(const String &p_path) {
+	MutexLock lock(singleton->mutex);
+	if (singleton->cleared || !singleton->parser_map.has(p_path)) {
+		return Ref<GDScriptParserRef>();
+	}
+	Ref<GDScriptParserRef> ref = Ref<GDScriptParserRef>(singleton->parser_map[p_path]);
+	// A tree still being analyzed further up the stack isn't complete yet.
+	if (ref.is_valid() && (ref->cleared || !ref->is_valid() || ref->raising_depth > 0)) {
+		return Ref<GDScriptParserRef>();
+	}
+	return ref;
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
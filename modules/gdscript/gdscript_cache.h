@@ -58,9 +58,20 @@ private:
 	Error result = OK;
 	String path;
 	bool cleared = false;
+	int raising_depth = 0; // Non-zero while the tree is being parsed or analyzed.
+	List<Ref<GDScriptParserRef>> parsed_ahead;
 
 	friend class GDScriptCache;
 
+	struct ParseAheadItem {
+		GDScriptParserRef *ref = nullptr;
+		String remapped_path;
+	};
+
+	void _parse(const String &p_remapped_path);
+	void _parse_ahead_task(uint32_t p_index, ParseAheadItem *p_items);
+	void _parse_referenced_scripts_ahead();
+
 public:
 	bool is_valid() const;
 	Status get_status() const;
@@ -95,6 +106,7 @@ public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static Ref<GDScriptParserRef> get_cached_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
@@ -33,6 +33,7 @@
 #include "gdscript.h"
 #include "gdscript_byte_codegen.h"
 #include "gdscript_cache.h"
+#include "gdscript_lambda_callable.h"
 #include "gdscript_utility_functions.h"
 
 #include "core/config/engine.h"
@@ -250,6 +251,55 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+static bool _can_operate_in_place(Variant::Operator p_operator, const GDScriptCodeGenerator::Address &p_target, const GDScriptCodeGenerator::Address &p_value) {
+	if (p_target.mode != GDScriptCodeGenerator::Address::LOCAL_VARIABLE && p_target.mode != GDScriptCodeGenerator::Address::FUNCTION_PARAMETER) {
+		return false;
+	}
+	if (!p_target.type.has_type || p_target.type.kind != GDScriptDataType::BUILTIN || !p_value.type.has_type || p_value.type.kind != GDScriptDataType::BUILTIN) {
+		return false;
+	}
+	// Only scalars, so the operator can't observe the target being overwritten while it reads it.
+	Variant::Type target_type = p_target.type.builtin_type;
+	if (target_type != Variant::INT && target_type != Variant::FLOAT) {
+		return false;
+	}
+	return Variant::get_operator_return_type(p_operator, target_type, p_value.type.builtin_type) == target_type;
+}
+
+// Returns the bounds type (int, Vector2i or Vector3i) a non-constant `range()` loop list can be built as, or NIL.
+// Only int arguments qualify, and a step must be a non-zero constant, so iterating the bounds matches `range()` exactly.
+static Variant::Type _get_range_bounds_type(const GDScriptParser::ExpressionNode *p_list) {
+	if (p_list->is_constant || p_list->type != GDScriptParser::Node::CALL) {
+		return Variant::NIL;
+	}
+	const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(p_list);
+	if (call->get_callee_type() != GDScriptParser::Node::IDENTIFIER || static_cast<const GDScriptParser::IdentifierNode *>(call->callee)->name != "range") {
+		return Variant::NIL;
+	}
+	if (call->arguments.size() < 1 || call->arguments.size() > 3) {
+		return Variant::NIL;
+	}
+	for (const GDScriptParser::ExpressionNode *argument : call->arguments) {
+		GDScriptParser::DataType argument_type = argument->get_datatype();
+		if (!argument_type.is_hard_type() || argument_type.kind != GDScriptParser::DataType::BUILTIN || argument_type.builtin_type != Variant::INT) {
+			return Variant::NIL;
+		}
+	}
+	switch (call->arguments.size()) {
+		case 1:
+			return Variant::INT;
+		case 2:
+			return Variant::VECTOR2I;
+		default: {
+			const GDScriptParser::ExpressionNode *step = call->arguments[2];
+			if (!step->is_constant || step->reduced_value.get_type() != Variant::INT || int64_t(step->reduced_value) == 0) {
+				return Variant::NIL;
+			}
+			return Variant::VECTOR3I;
+		}
+	}
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer, const GDScriptCodeGenerator::Address &p_index_addr) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1308,7 +1358,11 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 
 				GDScriptCodeGenerator::Address to_assign;
 				bool has_operation = assignment->operation != GDScriptParser::AssignmentNode::OP_NONE;
-				if (has_operation) {
+				bool in_place = has_operation && !has_setter && !is_static && _can_operate_in_place(assignment->variant_op, target, assigned_value);
+				if (in_place) {
+					// Typed numeric local, like a loop counter: write the result straight into it.
+					gen->write_binary_operator(target, assignment->variant_op, target, assigned_value);
+				} else if (has_operation) {
 					// Perform operation.
 					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
 					GDScriptCodeGenerator::Address og_value = _parse_expression(codegen, r_error, assignment->assignee);
@@ -1337,10 +1391,12 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					}
 					gen->write_set_static_variable(temp, static_var_class, static_var_index);
 					gen->pop_temporary();
-				} else {
+				} else if (!in_place) {
 					// Just assign.
 					if (assignment->use_conversion_assign) {
 						gen->write_assign_with_conversion(target, to_assign);
+					} else if (to_assign.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						gen->write_assign_result(target, to_assign);
 					} else {
 						gen->write_assign(target, to_assign);
 					}
@@ -1377,6 +1433,9 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 			}
 
 			codegen.script->lambda_info.insert(function, { (int)lambda->captures.size(), lambda->use_self });
+			if (lambda->captures.is_empty() && !lambda->use_self) {
+				function->shared_lambda = Callable(memnew(GDScriptLambdaCallable(function)));
+			}
 			gen->write_lambda(result, function, captures, lambda->use_self);
 
 			for (int i = 0; i < captures.size(); i++) {
@@ -1975,6 +2034,18 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+				if (if_n->condition->is_constant) {
+					// Only the branch that can run is compiled, `elif` chains being nested `if` nodes.
+					const GDScriptParser::SuiteNode *taken_block = if_n->condition->reduced_value.booleanize() ? if_n->true_block : if_n->false_block;
+					if (taken_block) {
+						err = _parse_block(codegen, taken_block);
+						if (err) {
+							return err;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
 				if (err) {
 					return err;
@@ -2008,11 +2079,50 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 				codegen.start_block();
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
+				// Typed `range()` calls iterate over their bounds directly instead of allocating an array.
+				Variant::Type range_bounds_type = _get_range_bounds_type(for_n->list);
+				GDScriptDataType list_type;
+				if (range_bounds_type != Variant::NIL) {
+					list_type.has_type = true;
+					list_type.kind = GDScriptDataType::BUILTIN;
+					list_type.builtin_type = range_bounds_type;
+				} else {
+					list_type = _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script);
+				}
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
-				if (err) {
-					return err;
+				gen->start_for(iterator.type, list_type);
+
+				GDScriptCodeGenerator::Address list;
+				if (range_bounds_type != Variant::NIL) {
+					const GDScriptParser::CallNode *range_call = static_cast<const GDScriptParser::CallNode *>(for_n->list);
+					if (range_bounds_type != Variant::INT) {
+						list = codegen.add_temporary(list_type);
+					}
+
+					Vector<GDScriptCodeGenerator::Address> bounds;
+					for (const GDScriptParser::ExpressionNode *argument : range_call->arguments) {
+						GDScriptCodeGenerator::Address bound = _parse_expression(codegen, err, argument);
+						if (err) {
+							return err;
+						}
+						bounds.push_back(bound);
+					}
+
+					if (range_bounds_type == Variant::INT) {
+						list = bounds[0];
+					} else {
+						gen->write_construct(list, range_bounds_type, bounds);
+						for (int i = bounds.size() - 1; i >= 0; i--) {
+							if (bounds[i].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+								codegen.generator->pop_temporary();
+							}
+						}
+					}
+				} else {
+					list = _parse_expression(codegen, err, for_n->list);
+					if (err) {
+						return err;
+					}
 				}
 
 				gen->write_for_assignment(list);
@@ -2034,6 +2144,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::WHILE: {
 				const GDScriptParser::WhileNode *while_n = static_cast<const GDScriptParser::WhileNode *>(s);
+				if (while_n->condition->is_constant && !while_n->condition->reduced_value.booleanize()) {
+					break; // The body can't run.
+				}
 
 				gen->start_while_condition();
 
@@ -2129,6 +2242,8 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 					}
 					if (lv->use_conversion_assign) {
 						gen->write_assign_with_conversion(local, src_address);
+					} else if (src_address.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						gen->write_assign_result(local, src_address);
 					} else {
 						gen->write_assign(local, src_address);
 					}
@@ -32,6 +32,8 @@
 
 #include "gdscript.h"
 
+#include "scene/main/node.h"
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -104,6 +106,18 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+#ifdef DEBUG_ENABLED
+void GDScriptFunction::_check_thread_affinity(const GDScriptInstance *p_instance) const {
+	const Node *node = Object::cast_to<Node>(p_instance->owner);
+	if (node == nullptr || node->is_accessible_from_caller_thread()) {
+		return;
+	}
+	String err_file = _script && !_script->path.is_empty() ? _script->path : String("<built-in>");
+	String err_text = vformat(R"*(Function "%s()" was called from a thread that can't access this node (%s). Use call_deferred() or call_thread_group() instead.)*", name, node->get_description());
+	_err_print_error(String(name).utf8().get_data(), err_file.utf8().get_data(), _initial_line, err_text, false, ERR_HANDLER_SCRIPT);
+}
+#endif
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -33,6 +33,7 @@
 
 #include "gdscript_utility_functions.h"
 
+#include "core/object/object_member_cache.h"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
 #include "core/os/thread.h"
@@ -199,6 +200,11 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_OPERATOR_INT,
+		OPCODE_OPERATOR_FLOAT,
+		OPCODE_OPERATOR_VECTOR2,
+		OPCODE_OPERATOR_VECTOR3,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -385,6 +391,8 @@ private:
 	GDScriptDataType return_type;
 	MethodInfo method_info;
 	Variant rpc_config;
+	// Non-capturing lambdas evaluate to this one callable instead of allocating a new one each time.
+	Callable shared_lambda;
 
 	GDScript *_script = nullptr;
 	int _initial_line = 0;
@@ -401,6 +409,8 @@ private:
 	Vector<int> default_arguments;
 	Vector<Variant> constants;
 	Vector<StringName> global_names;
+	// One per global name, for untyped calls on objects. Only used from the main thread, as functions are shared.
+	LocalVector<ObjectMemberCache> member_caches;
 	Vector<Variant::ValidatedOperatorEvaluator> operator_funcs;
 	Vector<Variant::ValidatedSetter> setters;
 	Vector<Variant::ValidatedGetter> getters;
@@ -437,6 +447,7 @@ private:
 	const int *_default_arg_ptr = nullptr;
 	mutable Variant *_constants_ptr = nullptr;
 	const StringName *_global_names_ptr = nullptr;
+	ObjectMemberCache *_member_caches_ptr = nullptr;
 	const Variant::ValidatedOperatorEvaluator *_operator_funcs_ptr = nullptr;
 	const Variant::ValidatedSetter *_setters_ptr = nullptr;
 	const Variant::ValidatedGetter *_getters_ptr = nullptr;
@@ -522,6 +533,7 @@ public:
 
 #ifdef DEBUG_ENABLED
 	void _profile_native_call(uint64_t p_t_taken, const String &p_function_name, const String &p_instance_class_name = String());
+	void _check_thread_affinity(const GDScriptInstance *p_instance) const;
 	void disassemble(const Vector<String> &p_code_lines) const;
 #endif
 
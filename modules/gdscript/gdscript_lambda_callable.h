@@ -44,6 +44,7 @@ class GDScriptInstance;
 class GDScriptLambdaCallable : public CallableCustom {
 	GDScript::UpdatableFuncPtr function;
 	Ref<GDScript> script;
+	ObjectID script_id;
 	uint32_t h;
 
 	Vector<Variant> captures;
@@ -64,6 +65,8 @@ public:
 	GDScriptLambdaCallable(GDScriptLambdaCallable &) = delete;
 	GDScriptLambdaCallable(const GDScriptLambdaCallable &) = delete;
 	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
+	// Shared callable for a lambda without captures. It is owned by the function, so it doesn't reference the script.
+	GDScriptLambdaCallable(GDScriptFunction *p_function);
 	virtual ~GDScriptLambdaCallable() = default;
 };
 
@@ -161,10 +161,22 @@ void GDScriptParser::clear() {
 	_is_tool = false;
 	for_completion = false;
 	errors.clear();
+	referenced_scripts.clear();
 	multiline_stack.clear();
 	nodes_in_progress.clear();
 }
 
+void GDScriptParser::add_referenced_script(const String &p_path) {
+	if (p_path.get_extension().to_lower() != "gd") {
+		return;
+	}
+	String path = p_path;
+	if (path.is_relative_path()) {
+		path = script_path.get_base_dir().path_join(path);
+	}
+	referenced_scripts.insert(path.simplify_path());
+}
+
 void GDScriptParser::push_error(const String &p_message, const Node *p_origin) {
 	// TODO: Improve error reporting by pointing at source code.
 	// TODO: Errors might point at more than one place at once (e.g. show previous declaration).
@@ -776,6 +788,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		add_referenced_script(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -3238,6 +3251,8 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL && static_cast<LiteralNode *>(preload->path)->value.get_type() == Variant::STRING) {
+		add_referenced_script(static_cast<LiteralNode *>(preload->path)->value);
 	}
 
 	pop_completion_call();
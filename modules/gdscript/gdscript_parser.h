@@ -1332,6 +1332,7 @@ private:
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
+	HashSet<String> referenced_scripts; // Constant script paths in `extends` and `preload()`.
 
 #ifdef DEBUG_ENABLED
 	bool is_ignoring_warnings = false;
@@ -1474,6 +1475,7 @@ private:
 	SuiteNode *parse_suite(const String &p_context, SuiteNode *p_suite = nullptr, bool p_for_lambda = false);
 	// Annotations
 	AnnotationNode *parse_annotation(uint32_t p_valid_targets);
+	void add_referenced_script(const String &p_path);
 	static bool register_annotation(const MethodInfo &p_info, uint32_t p_target_kinds, AnnotationAction p_apply, const Vector<Variant> &p_default_arguments = Vector<Variant>(), bool p_is_vararg = false);
 	bool validate_annotation_arguments(AnnotationNode *p_annotation);
 	void clear_unused_annotations();
@@ -1557,6 +1559,7 @@ public:
 	bool annotation_exists(const String &p_annotation_name) const;
 
 	const List<ParserError> &get_errors() const { return errors; }
+	const HashSet<String> &get_referenced_scripts() const { return referenced_scripts; }
 	const List<String> get_dependencies() const {
 		// TODO: Keep track of deps.
 		return List<String>();
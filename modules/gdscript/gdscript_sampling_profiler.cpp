@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript_function.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/string/string_builder.h"
+
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::singleton = nullptr;
+thread_local GDScriptSamplingProfiler::ThreadStack GDScriptSamplingProfiler::thread_stack;
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_userdata);
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		profiler->tick.increment();
+	}
+}
+
+void GDScriptSamplingProfiler::_sample(uint32_t p_tick) {
+	// Ticks missed while the thread was busy elsewhere (e.g. in a long native call) add weight to this sample.
+	uint32_t weight = p_tick - thread_stack.seen_tick;
+	thread_stack.seen_tick = p_tick;
+
+	StringBuilder stack;
+	for (uint32_t i = 0; i < thread_stack.frames.size(); i++) {
+		const Frame &frame = thread_stack.frames[i];
+		if (i > 0) {
+			stack.append(";");
+		}
+		stack.append(String(frame.function->get_source()));
+		stack.append("::");
+		stack.append(String(frame.function->get_name()));
+		if (i == thread_stack.frames.size() - 1) {
+			stack.append("::");
+			stack.append(itos(*frame.line));
+		}
+	}
+
+	MutexLock lock(mutex);
+	String key = stack.as_string();
+	HashMap<String, uint64_t>::Iterator E = folded_stacks.find(key);
+	if (E) {
+		E->value += weight;
+	} else {
+		folded_stacks.insert(key, weight);
+	}
+	sample_count += weight;
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	ERR_FAIL_COND_MSG(p_interval_usec == 0, "The sampling interval must be greater than zero.");
+	if (active.is_set()) {
+		return;
+	}
+	interval_usec = p_interval_usec;
+	exit_thread.clear();
+	thread.start(_thread_func, this);
+	active.set();
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!active.is_set()) {
+		return;
+	}
+	active.clear();
+	exit_thread.set();
+	thread.wait_to_finish();
+}
+
+void GDScriptSamplingProfiler::clear() {
+	MutexLock lock(mutex);
+	folded_stacks.clear();
+	sample_count = 0;
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(mutex);
+	return sample_count;
+}
+
+String GDScriptSamplingProfiler::get_folded_stacks() {
+	MutexLock lock(mutex);
+	StringBuilder text;
+	for (const KeyValue<String, uint64_t> &E : folded_stacks) {
+		text.append(E.key);
+		text.append(" ");
+		text.append(itos(E.value));
+		text.append("\n");
+	}
+	return text.as_string();
+}
+
+Error GDScriptSamplingProfiler::save_folded_stacks(const String &p_path) {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open file '" + p_path + "' to save GDScript samples.");
+	file->store_string(get_folded_stacks());
+	return OK;
+}
+
+GDScriptSamplingProfiler::GDScriptSamplingProfiler() {
+	singleton = this;
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	stop();
+	singleton = nullptr;
+}
+
+#endif // DEBUG_ENABLED
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Periodically samples the script call stack of every thread running GDScript, and accumulates
+// the stacks in the "folded" format read by flame graph tools (`frame;frame;frame count` per line).
+// A background thread only advances a tick counter; the VM takes the sample itself at the next
+// line it executes, so time spent in native calls is attributed to the line that made the call.
+class GDScriptSamplingProfiler {
+	struct Frame {
+		const GDScriptFunction *function = nullptr;
+		const int *line = nullptr;
+	};
+
+	struct ThreadStack {
+		LocalVector<Frame> frames;
+		uint32_t seen_tick = 0;
+	};
+
+	static GDScriptSamplingProfiler *singleton;
+	static thread_local ThreadStack thread_stack;
+
+	SafeFlag active;
+	SafeFlag exit_thread;
+	SafeNumeric<uint32_t> tick;
+	uint64_t interval_usec = 1000;
+	Thread thread;
+
+	Mutex mutex;
+	HashMap<String, uint64_t> folded_stacks;
+	uint64_t sample_count = 0;
+
+	static void _thread_func(void *p_userdata);
+	void _sample(uint32_t p_tick);
+
+public:
+	static GDScriptSamplingProfiler *get_singleton() { return singleton; }
+
+	_FORCE_INLINE_ bool is_active() const { return active.is_set(); }
+
+	// Called by the VM around a function body while the profiler is active.
+	_FORCE_INLINE_ void push_frame(const GDScriptFunction *p_function, const int *p_line) {
+		if (unlikely(thread_stack.frames.is_empty())) {
+			thread_stack.seen_tick = tick.get(); // Don't count time from before this thread got here.
+		}
+		thread_stack.frames.push_back({ p_function, p_line });
+	}
+	_FORCE_INLINE_ void pop_frame() {
+		if (likely(!thread_stack.frames.is_empty())) {
+			thread_stack.frames.resize(thread_stack.frames.size() - 1);
+		}
+	}
+	// Called by the VM on every line of a pushed frame.
+	_FORCE_INLINE_ void poll() {
+		uint32_t current = tick.get();
+		if (unlikely(current != thread_stack.seen_tick)) {
+			_sample(current);
+		}
+	}
+
+	void start(uint64_t p_interval_usec);
+	void stop();
+	void clear();
+
+	uint64_t get_sample_count();
+	String get_folded_stacks();
+	Error save_folded_stacks(const String &p_path);
+
+	GDScriptSamplingProfiler();
+	~GDScriptSamplingProfiler();
+};
+
+#endif // DEBUG_ENABLED
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
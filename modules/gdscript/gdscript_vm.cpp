@@ -210,11 +210,38 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedColorArray>::init, // PACKED_COLOR_ARRAY.
 };
 
+// Arithmetic for the typed operator opcodes, evaluated inline instead of through a validated evaluator.
+// The compiler only emits those for the operators handled here, with both operands and the result of the same type.
+template <typename T>
+static _FORCE_INLINE_ void evaluate_typed_arithmetic(Variant::Operator p_op, const T &p_a, const T &p_b, T &r_ret) {
+	switch (p_op) {
+		case Variant::OP_ADD:
+			r_ret = p_a + p_b;
+			break;
+		case Variant::OP_SUBTRACT:
+			r_ret = p_a - p_b;
+			break;
+		case Variant::OP_MULTIPLY:
+			r_ret = p_a * p_b;
+			break;
+		case Variant::OP_DIVIDE:
+			r_ret = p_a / p_b;
+			break;
+		default:
+			break;
+	}
+}
+
 #if defined(__GNUC__)
 #define OPCODES_TABLE                                  \
 	static const void *switch_table_ops[] = {          \
 		&&OPCODE_OPERATOR,                             \
 		&&OPCODE_OPERATOR_VALIDATED,                   \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,       \
+		&&OPCODE_OPERATOR_INT,                         \
+		&&OPCODE_OPERATOR_FLOAT,                       \
+		&&OPCODE_OPERATOR_VECTOR2,                     \
+		&&OPCODE_OPERATOR_VECTOR3,                     \
 		&&OPCODE_TYPE_TEST_BUILTIN,                    \
 		&&OPCODE_TYPE_TEST_ARRAY,                      \
 		&&OPCODE_TYPE_TEST_NATIVE,                     \
@@ -474,6 +501,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		return _get_default_variant_for_data_type(return_type);
 	}
 
+#ifdef DEBUG_ENABLED
+	if (unlikely(p_instance && GDScriptLanguage::get_singleton()->check_thread_affinity)) {
+		_check_thread_affinity(p_instance);
+	}
+#endif
+
 	Variant retvalue;
 	Variant *stack = nullptr;
 	Variant **instruction_args = nullptr;
@@ -655,6 +688,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	}
 	bool exit_ok = false;
 	bool awaited = false;
+	bool sampled_frame = false;
+	if (unlikely(GDScriptSamplingProfiler::get_singleton() && GDScriptSamplingProfiler::get_singleton()->is_active())) {
+		GDScriptSamplingProfiler::get_singleton()->push_frame(this, &line);
+		sampled_frame = true;
+	}
 	int variant_address_limits[ADDR_TYPE_MAX] = { _stack_size, _constant_count, p_instance ? (int)p_instance->members.size() : 0 };
 #endif
 
@@ -772,6 +810,49 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_type, m_c_type)                                                                               \
+	OPCODE(OPCODE_OPERATOR_##m_type) {                                                                                        \
+		CHECK_SPACE(5);                                                                                                       \
+		GET_VARIANT_PTR(a, 0);                                                                                                \
+		GET_VARIANT_PTR(b, 1);                                                                                                \
+		GET_VARIANT_PTR(dst, 2);                                                                                              \
+		const m_c_type &left = *VariantInternal::OP_GET_##m_type(a);                                                          \
+		const m_c_type &right = *VariantInternal::OP_GET_##m_type(b);                                                         \
+		VariantTypeChanger<m_c_type>::change(dst); /* May be a typed local that wasn't assigned yet. */                       \
+		evaluate_typed_arithmetic((Variant::Operator)_code_ptr[ip + 4], left, right, *VariantInternal::OP_GET_##m_type(dst)); \
+		ip += 5;                                                                                                              \
+	}                                                                                                                         \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(INT, int64_t);
+			OPCODE_OPERATOR_TYPED(FLOAT, double);
+			OPCODE_OPERATOR_TYPED(VECTOR2, Vector2);
+			OPCODE_OPERATOR_TYPED(VECTOR3, Vector3);
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				// The compiler only fuses operators that return a bool, so the result can be read directly.
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1698,10 +1779,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				StringName base_class = base_obj ? base_obj->get_class_name() : StringName();
 #endif
 
+				// Calls on objects go through the member cache of the method name, skipping the ClassDB lookup
+				// when the same method name is called on the same class again.
+				Object *cached_base = (base->get_type() == Variant::OBJECT && Thread::is_main_thread()) ? base->get_validated_object() : nullptr;
+
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (cached_base) {
+						*ret = _member_caches_ptr[methodname_idx].call(cached_base, (const Variant **)argptrs, argc, err);
+					} else {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1729,6 +1818,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
+				} else if (cached_base) {
+					_member_caches_ptr[methodname_idx].call(cached_base, (const Variant **)argptrs, argc, err);
 				} else {
 					Variant ret;
 					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
@@ -2345,17 +2436,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(lambda_index < 0 || lambda_index >= _lambdas_count);
 				GDScriptFunction *lambda = _lambdas_ptr[lambda_index];
 
-				Vector<Variant> captures;
-				captures.resize(captures_count);
-				for (int i = 0; i < captures_count; i++) {
-					GET_INSTRUCTION_ARG(arg, i);
-					captures.write[i] = *arg;
-				}
-
-				GDScriptLambdaCallable *callable = memnew(GDScriptLambdaCallable(Ref<GDScript>(script), lambda, captures));
-
 				GET_INSTRUCTION_ARG(result, captures_count);
-				*result = Callable(callable);
+				if (captures_count == 0 && !lambda->shared_lambda.is_null()) {
+					*result = lambda->shared_lambda;
+				} else {
+					Vector<Variant> captures;
+					captures.resize(captures_count);
+					for (int i = 0; i < captures_count; i++) {
+						GET_INSTRUCTION_ARG(arg, i);
+						captures.write[i] = *arg;
+					}
+
+					GDScriptLambdaCallable *callable = memnew(GDScriptLambdaCallable(Ref<GDScript>(script), lambda, captures));
+					*result = Callable(callable);
+				}
 
 				ip += 3;
 			}
@@ -3462,6 +3556,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
+#ifdef DEBUG_ENABLED
+				if (unlikely(sampled_frame)) {
+					GDScriptSamplingProfiler::get_singleton()->poll();
+				}
+#endif
+
 				if (EngineDebugger::is_active()) {
 					// line
 					bool do_break = false;
@@ -3554,6 +3654,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			GDScriptLanguage::get_singleton()->script_frame_time += time_taken - function_call_time;
 		}
 	}
+	if (sampled_frame) {
+		GDScriptSamplingProfiler::get_singleton()->pop_frame();
+	}
 
 	// Check if this is not the last time it was interrupted by `await` or if it's the first time executing.
 	// If that is the case then we exit the function as normal. Otherwise we postpone it until the last `await` is completed.
@@ -0,0 +1,14 @@
+func is_even(x: int) -> bool:
+	return x % 2 == 0
+
+
+func test():
+	var numbers: Array[int] = [1, 2, 3, 4, 5, 6]
+
+	print(numbers.map(func(x): return x * x))
+	var evens := numbers.filter(is_even)
+	print(evens, " ", evens.is_typed())
+	print(numbers.reduce(func(accum, x): return accum + x))
+	print(numbers.reduce(func(accum, x): return accum + x, 100))
+	print(numbers.any(is_even), " ", numbers.all(is_even))
+	print([].map(func(x): return x), " ", [].filter(is_even))
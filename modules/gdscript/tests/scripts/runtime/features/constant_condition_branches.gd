@@ -0,0 +1,31 @@
+# Branches behind constant conditions are compiled only when they can run.
+
+const DEBUG := false
+const LEVEL := 2
+
+func test():
+	if DEBUG:
+		print("not printed")
+	else:
+		print("release")
+
+	if LEVEL == 1:
+		print("level 1")
+	elif LEVEL == 2:
+		var local := "level 2"
+		print(local)
+	else:
+		print("other level")
+
+	while DEBUG:
+		print("never")
+
+	var count := 0
+	while count < 2:
+		if not DEBUG:
+			count += 1
+	print(count)
+
+	if LEVEL > 5:
+		print("not printed")
+	print("done")
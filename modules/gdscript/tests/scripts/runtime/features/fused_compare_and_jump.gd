@@ -0,0 +1,49 @@
+# Typed comparisons feeding `if`, `while`, `and`, `or` and ternaries
+# are compiled into a single fused instruction.
+
+func test():
+	var i := 0
+	var total := 0
+	while i < 10:
+		if i % 2 == 0 and i > 2:
+			total += i
+		i += 1
+	print(total)
+
+	var f := 0.5
+	var steps := 0
+	while f < 8.0:
+		f *= 2.0
+		steps += 1
+	print(steps, " ", f)
+
+	var a := 3
+	var b := 4
+	print("less" if a < b else "not less")
+	print("equal" if a == b else "not equal")
+	if a > b or b > 3:
+		print("or ok")
+
+	# Comparison result still stored, since the condition is an expression.
+	var flag := a <= b
+	if flag:
+		print(flag)
+
+	# Nested loops where a jump lands right after a comparison.
+	var count := 0
+	for x in 3:
+		var y := 0
+		while y < x:
+			count += 1
+			y += 1
+	print(count)
+
+	# Arguments mixing int and float stay correct.
+	var n := 5
+	n -= 2
+	n *= 3
+	n %= 4
+	print(n)
+	var g := 1.0
+	g += n
+	print(g)
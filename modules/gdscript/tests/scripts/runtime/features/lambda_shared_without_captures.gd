@@ -0,0 +1,21 @@
+func make_doubler() -> Callable:
+	return func(x): return x * 2
+
+
+func make_adder(amount: int) -> Callable:
+	return func(x): return x + amount
+
+
+func test():
+	# Lambdas without captures are shared between evaluations.
+	var doubler := make_doubler()
+	print(doubler == make_doubler())
+	print([1, 2, 3].map(doubler))
+
+	# Lambdas with captures are still created each time.
+	print(make_adder(1) == make_adder(1))
+	print([1, 2, 3].map(make_adder(10)))
+
+	var sorted := [3, 1, 2]
+	sorted.sort_custom(func(a, b): return a > b)
+	print(sorted)
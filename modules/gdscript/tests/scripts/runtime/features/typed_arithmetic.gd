@@ -0,0 +1,25 @@
+# Arithmetic between operands of the same int, float, Vector2 or Vector3 type
+# is evaluated inline by the VM.
+
+func test():
+	var a := 7
+	var b := 3
+	print(a + b, " ", a - b, " ", a * b)
+
+	var x := 1.5
+	var y := 0.5
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+
+	var v2 := Vector2(1, 2)
+	var w2 := Vector2(3, 4)
+	print(v2 + w2, " ", v2 - w2, " ", v2 * w2, " ", w2 / v2)
+
+	var v3 := Vector3(1, 2, 4)
+	var w3 := Vector3(2, 2, 2)
+	print(v3 + w3, " ", v3 - w3, " ", v3 * w3, " ", v3 / w3)
+
+	# Same variable as operand and result.
+	var acc := Vector3.ZERO
+	for i in 4:
+		acc = acc + Vector3(i, i * 2, 1)
+	print(acc)
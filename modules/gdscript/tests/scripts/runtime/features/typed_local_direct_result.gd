@@ -0,0 +1,28 @@
+# Typed arithmetic assigned to a typed local is computed directly in the local.
+
+func test():
+	var total := 0.0
+	for i in 3:
+		if i % 2 == 0:
+			var text := "even %d" % i
+			print(text)
+		else:
+			# May reuse the stack slot that held the String above.
+			var half := float(i) * 0.5
+			total = total + half
+	print(total)
+
+	var p := Vector3(1, 2, 3)
+	var q := Vector3(3, 2, 1)
+	var r := p + q
+	p = r * q
+	print(r, " ", p)
+
+	var n := 2
+	var m := n * n
+	m = m - n
+	print(n, " ", m)
+
+	var v4 := Vector4(1, 2, 3, 4)
+	var w4 := v4 * 2.0
+	print(w4)
@@ -0,0 +1,37 @@
+func count(n: int) -> Array:
+	var result := []
+	for i in range(n):
+		result.append(i)
+	return result
+
+
+func span(from: int, to: int) -> Array:
+	var result := []
+	for i in range(from, to):
+		result.append(i)
+	return result
+
+
+func stepped(from: int, to: int) -> Array:
+	var result := []
+	for i in range(from, to, 3):
+		result.append(i)
+	for i in range(to, from, -3):
+		result.append(i)
+	return result
+
+
+func test():
+	print(count(4))
+	print(count(0))
+	print(count(-2))
+	print(span(2, 6))
+	print(span(6, 2))
+	print(stepped(1, 10))
+
+	var total := 0
+	var n := 5
+	for i in range(n):
+		n = 2 # Bounds are evaluated once, like with an array.
+		total += i
+	print(total)
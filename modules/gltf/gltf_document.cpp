@@ -43,6 +43,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/3d/bone_attachment_3d.h"
 #include "scene/3d/camera_3d.h"
@@ -2538,6 +2539,7 @@ Error GLTFDocument::_parse_meshes(Ref<GLTFState> p_state) {
 	Array meshes = p_state->json["meshes"];
 	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
 		print_verbose("glTF: Parsing mesh: " + itos(i));
+		p_state->load_progress.set(0.7 + 0.25 * i / meshes.size());
 		Dictionary d = meshes[i];
 
 		Ref<GLTFMesh> mesh;
@@ -3156,7 +3158,7 @@ Error GLTFDocument::_serialize_images(Ref<GLTFState> p_state) {
 	return OK;
 }
 
-Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
+Ref<Image> GLTFDocument::_parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
 	Ref<Image> r_image;
 	r_image.instantiate();
 	// Check if any GLTFDocumentExtensions want to import this data as an image.
@@ -3169,6 +3171,28 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 			return r_image;
 		}
 	}
+	return Ref<Image>();
+}
+
+Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
+	Ref<Image> r_image = _parse_image_bytes_with_extensions(p_state, p_bytes, p_mime_type, p_index, r_file_extension);
+	if (r_image.is_valid()) {
+		return r_image;
+	}
+	return _decode_image_bytes(p_bytes, p_mime_type, p_index, r_file_extension);
+}
+
+void GLTFDocument::_decode_image_task(uint32_t p_index, ImageParseEntry *p_entries) {
+	ImageParseEntry &entry = p_entries[p_index];
+	if (entry.image.is_null() && !entry.data.is_empty()) {
+		entry.image = _decode_image_bytes(entry.data, entry.mime_type, p_index, entry.file_extension);
+	}
+}
+
+Ref<Image> GLTFDocument::_decode_image_bytes(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
+	// Only touches the given buffer, so it's safe to call from worker threads.
+	Ref<Image> r_image;
+	r_image.instantiate();
 	// If no extension wanted to import this data as an image, try to load a PNG or JPEG.
 	// First we honor the mime types if they were defined.
 	if (p_mime_type == "image/png") { // Load buffer as PNG.
@@ -3304,8 +3328,13 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 	const Array &images = p_state->json["images"];
 	HashSet<String> used_names;
+	// Gather the image data first, decode it in parallel, then store the results in order.
+	LocalVector<ImageParseEntry> entries;
+	entries.resize(images.size());
+	int pending_decodes = 0;
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &dict = images[i];
+		ImageParseEntry &entry = entries[i];
 
 		// glTF 2.0 supports PNG and JPEG types, which can be specified as (from spec):
 		// "- a URI to an external file in one of the supported images formats, or
@@ -3361,8 +3390,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				// the material), so we only do that only as fallback.
 				Ref<Texture2D> texture = ResourceLoader::load(uri);
 				if (texture.is_valid()) {
-					p_state->images.push_back(texture);
-					p_state->source_images.push_back(texture->get_image());
+					entry.texture = texture;
 					continue;
 				}
 				// mimeType is optional, but if we have it in the file extension, let's use it.
@@ -3376,9 +3404,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				data = FileAccess::get_file_as_bytes(uri);
 				if (data.size() == 0) {
 					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, mime_type, uri));
-					p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-					p_state->source_images.push_back(Ref<Image>());
-					continue;
+					continue; // Stored as a placeholder to keep count.
 				}
 			}
 		} else if (dict.has("bufferView")) {
@@ -3397,15 +3423,41 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		// Note: There are paths above that return early, so this point might not be reached.
 		if (data.is_empty()) {
 			WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded, no data found. Skipping it.", i));
+			continue; // Stored as a placeholder to keep count.
+		}
+		// Extensions may not be thread-safe, give them the first chance to parse the data here.
+		entry.data = data;
+		entry.mime_type = mime_type;
+		entry.name = image_name;
+		entry.image = _parse_image_bytes_with_extensions(p_state, data, mime_type, i, entry.file_extension);
+		if (entry.image.is_null()) {
+			pending_decodes++;
+		}
+	}
+
+	// Decode the remaining PNG and JPEG data on worker threads.
+	if (pending_decodes > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_decode_image_task, entries.ptr(), entries.size(), -1, true, SNAME("GLTFDecodeImages"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			_decode_image_task(i, entries.ptr());
+		}
+	}
+
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		ImageParseEntry &entry = entries[i];
+		if (entry.texture.is_valid()) {
+			p_state->images.push_back(entry.texture);
+			p_state->source_images.push_back(entry.texture->get_image());
+		} else if (entry.image.is_null()) {
 			p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 			p_state->source_images.push_back(Ref<Image>());
-			continue;
+		} else {
+			// Save the decoded Image resource if needed.
+			entry.image->set_name(entry.name);
+			_parse_image_save_image(p_state, entry.data, entry.file_extension, i, entry.image);
 		}
-		// Parse the image data from bytes into an Image resource and save if needed.
-		String file_extension;
-		Ref<Image> img = _parse_image_bytes_into_image(p_state, data, mime_type, i, file_extension);
-		img->set_name(image_name);
-		_parse_image_save_image(p_state, data, file_extension, i, img);
 	}
 
 	print_verbose("glTF: Total images: " + itos(p_state->images.size()));
@@ -6881,11 +6933,14 @@ Error GLTFDocument::_parse_asset_header(Ref<GLTFState> p_state) {
 
 Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_search_path) {
 	Error err;
+	p_state->load_progress.set(0.0);
 
 	/* PARSE EXTENSIONS */
 	err = _parse_gltf_extensions(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.02);
+
 	/* PARSE SCENE */
 	err = _parse_scenes(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
@@ -6894,11 +6949,15 @@ Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_se
 	err = _parse_nodes(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.05);
+
 	/* PARSE BUFFERS */
 	err = _parse_buffers(p_state, p_search_path);
 
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.35);
+
 	/* PARSE BUFFER VIEWS */
 	err = _parse_buffer_views(p_state);
 
@@ -6909,12 +6968,16 @@ Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_se
 
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.4);
+
 	if (!p_state->discard_meshes_and_materials) {
 		/* PARSE IMAGES */
 		err = _parse_images(p_state, p_search_path);
 
 		ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+		p_state->load_progress.set(0.6);
+
 		/* PARSE TEXTURE SAMPLERS */
 		err = _parse_texture_samplers(p_state);
 
@@ -6931,6 +6994,8 @@ Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_se
 		ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 	}
 
+	p_state->load_progress.set(0.65);
+
 	/* PARSE SKINS */
 	err = _parse_skins(p_state);
 
@@ -6940,10 +7005,14 @@ Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_se
 	err = SkinTool::_determine_skeletons(p_state->skins, p_state->nodes, p_state->skeletons, p_state->get_import_as_skeleton_bones() ? p_state->root_nodes : Vector<GLTFNodeIndex>());
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.7);
+
 	/* PARSE MESHES (we have enough info now) */
 	err = _parse_meshes(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.95);
+
 	/* PARSE LIGHTS */
 	err = _parse_lights(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
@@ -6956,9 +7025,12 @@ Error GLTFDocument::_parse_gltf_state(Ref<GLTFState> p_state, const String &p_se
 	err = _parse_animations(p_state);
 	ERR_FAIL_COND_V(err != OK, ERR_PARSE_ERROR);
 
+	p_state->load_progress.set(0.99);
+
 	/* ASSIGN SCENE NAMES */
 	_assign_node_names(p_state);
 
+	p_state->load_progress.set(1.0);
 	return OK;
 }
 
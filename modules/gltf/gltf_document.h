@@ -184,6 +184,17 @@ private:
 	Error _serialize_texture_samplers(Ref<GLTFState> p_state);
 	Error _serialize_images(Ref<GLTFState> p_state);
 	Error _serialize_lights(Ref<GLTFState> p_state);
+	struct ImageParseEntry {
+		Ref<Texture2D> texture; // Loaded as a resource, skips decoding.
+		Vector<uint8_t> data;
+		String mime_type;
+		String name;
+		Ref<Image> image;
+		String file_extension;
+	};
+	void _decode_image_task(uint32_t p_index, ImageParseEntry *p_entries);
+	static Ref<Image> _decode_image_bytes(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	Ref<Image> _parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
 	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_file_extension, int p_index, Ref<Image> p_image);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
@@ -100,6 +100,7 @@ void GLTFState::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_additional_data", "extension_name", "additional_data"), &GLTFState::set_additional_data);
 	ClassDB::bind_method(D_METHOD("get_handle_binary_image"), &GLTFState::get_handle_binary_image);
 	ClassDB::bind_method(D_METHOD("set_handle_binary_image", "method"), &GLTFState::set_handle_binary_image);
+	ClassDB::bind_method(D_METHOD("get_load_progress"), &GLTFState::get_load_progress);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "json"), "set_json", "get_json"); // Dictionary
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "major_version"), "set_major_version", "get_major_version"); // int
@@ -389,6 +390,10 @@ bool GLTFState::get_discard_meshes_and_materials() {
 	return discard_meshes_and_materials;
 }
 
+float GLTFState::get_load_progress() const {
+	return load_progress.get();
+}
+
 String GLTFState::get_base_path() {
 	return base_path;
 }
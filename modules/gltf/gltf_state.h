@@ -43,6 +43,7 @@
 #include "structures/gltf_texture.h"
 #include "structures/gltf_texture_sampler.h"
 
+#include "core/templates/safe_refcount.h"
 #include "scene/3d/importer_mesh_instance_3d.h"
 
 class GLTFState : public Resource {
@@ -68,6 +69,9 @@ protected:
 
 	int handle_binary_image = HANDLE_BINARY_EXTRACT_TEXTURES;
 
+	// Written by the thread parsing the file, may be read from any other.
+	SafeNumeric<float> load_progress;
+
 	Vector<Ref<GLTFNode>> nodes;
 	Vector<Vector<uint8_t>> buffers;
 	Vector<Ref<GLTFBufferView>> buffer_views;
@@ -154,6 +158,8 @@ public:
 	bool get_discard_meshes_and_materials();
 	void set_discard_meshes_and_materials(bool p_discard_meshes_and_materials);
 
+	float get_load_progress() const;
+
 	TypedArray<GLTFNode> get_nodes();
 	void set_nodes(TypedArray<GLTFNode> p_nodes);
 
@@ -30,6 +30,7 @@
 
 #include "stream_peer_mbedtls.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/file_access.h"
 #include "core/io/stream_peer_tcp.h"
 
@@ -42,6 +43,14 @@ int StreamPeerMbedTLS::bio_send(void *ctx, const unsigned char *buf, size_t len)
 
 	ERR_FAIL_NULL_V(sp, 0);
 
+	if (sp->status == STATUS_HANDSHAKING && sp->threaded_handshake) {
+		// Flushed to the base stream by _poll_threaded_handshake.
+		uint32_t from = sp->handshake_out.size();
+		sp->handshake_out.resize(from + len);
+		memcpy(sp->handshake_out.ptr() + from, buf, len);
+		return len;
+	}
+
 	int sent;
 	Error err = sp->base->put_partial_data((const uint8_t *)buf, len, sent);
 	if (err != OK) {
@@ -62,6 +71,20 @@ int StreamPeerMbedTLS::bio_recv(void *ctx, unsigned char *buf, size_t len) {
 
 	ERR_FAIL_NULL_V(sp, 0);
 
+	if (sp->handshake_in_pos < sp->handshake_in.size()) {
+		// Data received by _poll_threaded_handshake, this may also hold records sent right after the handshake.
+		size_t got = MIN(len, (size_t)(sp->handshake_in.size() - sp->handshake_in_pos));
+		memcpy(buf, sp->handshake_in.ptr() + sp->handshake_in_pos, got);
+		sp->handshake_in_pos += got;
+		if (sp->handshake_in_pos == sp->handshake_in.size()) {
+			sp->handshake_in.clear();
+			sp->handshake_in_pos = 0;
+		}
+		return got;
+	} else if (sp->status == STATUS_HANDSHAKING && sp->threaded_handshake) {
+		return MBEDTLS_ERR_SSL_WANT_READ;
+	}
+
 	int got;
 	Error err = sp->base->get_partial_data((uint8_t *)buf, len, got);
 	if (err != OK) {
@@ -74,29 +97,116 @@ int StreamPeerMbedTLS::bio_recv(void *ctx, unsigned char *buf, size_t len) {
 }
 
 void StreamPeerMbedTLS::_cleanup() {
+	_wait_handshake_step();
 	tls_ctx->clear();
 	base = Ref<StreamPeer>();
+	handshake_in.clear();
+	handshake_out.clear();
+	handshake_in_pos = 0;
 	status = STATUS_DISCONNECTED;
 }
 
-Error StreamPeerMbedTLS::_do_handshake() {
-	int ret = mbedtls_ssl_handshake(tls_ctx->get_context());
-	if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+Error StreamPeerMbedTLS::_handle_handshake_result(int p_ret) {
+	if (p_ret == MBEDTLS_ERR_SSL_WANT_READ || p_ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
 		// Handshake is still in progress, will retry via poll later.
 		return OK;
-	} else if (ret != 0) {
+	} else if (p_ret != 0) {
 		// An error occurred.
-		ERR_PRINT("TLS handshake error: " + itos(ret));
-		TLSContextMbedTLS::print_mbedtls_error(ret);
+		ERR_PRINT("TLS handshake error: " + itos(p_ret));
+		TLSContextMbedTLS::print_mbedtls_error(p_ret);
 		disconnect_from_stream();
 		status = STATUS_ERROR;
 		return FAILED;
 	}
 
+	tls_ctx->save_session();
 	status = STATUS_CONNECTED;
 	return OK;
 }
 
+Error StreamPeerMbedTLS::_do_handshake() {
+	return _handle_handshake_result(mbedtls_ssl_handshake(tls_ctx->get_context()));
+}
+
+void StreamPeerMbedTLS::_handshake_step(void *p_userdata) {
+	handshake_result = mbedtls_ssl_handshake(tls_ctx->get_context());
+}
+
+void StreamPeerMbedTLS::_wait_handshake_step() {
+	if (handshake_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(handshake_task);
+		handshake_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+Error StreamPeerMbedTLS::_start_handshake() {
+	if (!threaded_handshake) {
+		return _do_handshake();
+	}
+
+	// The first step writes our hello (client) or waits for one (server).
+	handshake_result = MBEDTLS_ERR_SSL_WANT_WRITE;
+	_poll_threaded_handshake();
+	return status == STATUS_HANDSHAKING ? OK : FAILED;
+}
+
+void StreamPeerMbedTLS::_poll_threaded_handshake() {
+	if (handshake_task != WorkerThreadPool::INVALID_TASK_ID) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(handshake_task)) {
+			return; // Still crunching.
+		}
+		_wait_handshake_step();
+	}
+
+	// Flush what the last step produced.
+	while (!handshake_out.is_empty()) {
+		int sent = 0;
+		Error err = base->put_partial_data(handshake_out.ptr(), handshake_out.size(), sent);
+		if (err != OK) {
+			_handle_handshake_result(MBEDTLS_ERR_SSL_INTERNAL_ERROR);
+			return;
+		}
+		if (sent == 0) {
+			return; // Retry next poll.
+		}
+		memmove(handshake_out.ptr(), handshake_out.ptr() + sent, handshake_out.size() - sent);
+		handshake_out.resize(handshake_out.size() - sent);
+	}
+
+	if (handshake_result == 0) {
+		// Done, and everything was sent.
+		threaded_handshake = false;
+		_handle_handshake_result(0);
+		return;
+	} else if (handshake_result != MBEDTLS_ERR_SSL_WANT_READ && handshake_result != MBEDTLS_ERR_SSL_WANT_WRITE) {
+		_handle_handshake_result(handshake_result);
+		return;
+	}
+
+	// Gather what arrived.
+	bool received = false;
+	uint8_t buffer[4096];
+	while (true) {
+		int got = 0;
+		Error err = base->get_partial_data(buffer, sizeof(buffer), got);
+		if (err != OK) {
+			_handle_handshake_result(MBEDTLS_ERR_SSL_INTERNAL_ERROR);
+			return;
+		}
+		if (got == 0) {
+			break;
+		}
+		uint32_t from = handshake_in.size();
+		handshake_in.resize(from + got);
+		memcpy(handshake_in.ptr() + from, buffer, got);
+		received = true;
+	}
+
+	if (received || handshake_result == MBEDTLS_ERR_SSL_WANT_WRITE) {
+		handshake_task = WorkerThreadPool::get_singleton()->add_template_task(this, &StreamPeerMbedTLS::_handshake_step, nullptr, true, "TLS handshake");
+	}
+}
+
 Error StreamPeerMbedTLS::connect_to_stream(Ref<StreamPeer> p_base, const String &p_common_name, Ref<TLSOptions> p_options) {
 	ERR_FAIL_COND_V(p_base.is_null(), ERR_INVALID_PARAMETER);
 
@@ -104,11 +214,12 @@ Error StreamPeerMbedTLS::connect_to_stream(Ref<StreamPeer> p_base, const String
 	ERR_FAIL_COND_V(err != OK, err);
 
 	base = p_base;
+	threaded_handshake = GLOBAL_GET("network/tls/threaded_handshake");
 	mbedtls_ssl_set_bio(tls_ctx->get_context(), this, bio_send, bio_recv, nullptr);
 
 	status = STATUS_HANDSHAKING;
 
-	if (_do_handshake() != OK) {
+	if (_start_handshake() != OK) {
 		status = STATUS_ERROR_HOSTNAME_MISMATCH;
 		return FAILED;
 	}
@@ -124,15 +235,20 @@ Error StreamPeerMbedTLS::accept_stream(Ref<StreamPeer> p_base, Ref<TLSOptions> p
 	ERR_FAIL_COND_V(err != OK, err);
 
 	base = p_base;
+	threaded_handshake = GLOBAL_GET("network/tls/threaded_handshake");
 
 	mbedtls_ssl_set_bio(tls_ctx->get_context(), this, bio_send, bio_recv, nullptr);
 
 	status = STATUS_HANDSHAKING;
 
-	if (_do_handshake() != OK) {
+	if (_start_handshake() != OK) {
 		return FAILED;
 	}
 
+	if (threaded_handshake) {
+		return OK; // Completed via poll.
+	}
+
 	status = STATUS_CONNECTED;
 	return OK;
 }
@@ -231,7 +347,11 @@ void StreamPeerMbedTLS::poll() {
 	ERR_FAIL_COND(!base.is_valid());
 
 	if (status == STATUS_HANDSHAKING) {
-		_do_handshake();
+		if (threaded_handshake) {
+			_poll_threaded_handshake();
+		} else {
+			_do_handshake();
+		}
 		return;
 	}
 
@@ -278,6 +398,8 @@ void StreamPeerMbedTLS::disconnect_from_stream() {
 		return;
 	}
 
+	_wait_handshake_step();
+
 	Ref<StreamPeerTCP> tcp = base;
 	if (tcp.is_valid() && tcp->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
 		// We are still connected on the socket, try to send close notify.
@@ -305,4 +427,5 @@ void StreamPeerMbedTLS::initialize_tls() {
 
 void StreamPeerMbedTLS::finalize_tls() {
 	_create = nullptr;
+	TLSContextMbedTLS::clear_sessions();
 }
@@ -34,6 +34,8 @@
 #include "tls_context_mbedtls.h"
 
 #include "core/io/stream_peer_tls.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 
 class StreamPeerMbedTLS : public StreamPeerTLS {
 private:
@@ -48,6 +50,21 @@ private:
 	static int bio_send(void *ctx, const unsigned char *buf, size_t len);
 	void _cleanup();
 
+	// Threaded handshake, the handshake steps run on the WorkerThreadPool and only see these buffers,
+	// the base stream is only used on the calling thread while no step is running.
+	bool threaded_handshake = false;
+	WorkerThreadPool::TaskID handshake_task = WorkerThreadPool::INVALID_TASK_ID;
+	int handshake_result = MBEDTLS_ERR_SSL_WANT_READ;
+	LocalVector<uint8_t> handshake_in;
+	LocalVector<uint8_t> handshake_out;
+	uint32_t handshake_in_pos = 0;
+
+	void _handshake_step(void *p_userdata);
+	void _wait_handshake_step();
+	void _poll_threaded_handshake();
+	Error _start_handshake();
+	Error _handle_handshake_result(int p_ret);
+
 protected:
 	Ref<TLSContextMbedTLS> tls_ctx;
 
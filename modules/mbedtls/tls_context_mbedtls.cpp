@@ -84,6 +84,99 @@ CookieContextMbedTLS::~CookieContextMbedTLS() {
 
 /// TLSContextMbedTLS
 
+Mutex TLSContextMbedTLS::client_sessions_mutex;
+HashMap<String, mbedtls_ssl_session *> TLSContextMbedTLS::client_sessions;
+Mutex TLSContextMbedTLS::ticket_mutex;
+bool TLSContextMbedTLS::ticket_inited = false;
+mbedtls_entropy_context TLSContextMbedTLS::ticket_entropy;
+mbedtls_ctr_drbg_context TLSContextMbedTLS::ticket_ctr_drbg;
+mbedtls_ssl_ticket_context TLSContextMbedTLS::ticket_ctx;
+
+bool TLSContextMbedTLS::_ticket_setup() {
+	MutexLock lock(ticket_mutex);
+	if (ticket_inited) {
+		return true;
+	}
+
+	mbedtls_entropy_init(&ticket_entropy);
+	mbedtls_ctr_drbg_init(&ticket_ctr_drbg);
+	mbedtls_ssl_ticket_init(&ticket_ctx);
+
+	int ret = mbedtls_ctr_drbg_seed(&ticket_ctr_drbg, mbedtls_entropy_func, &ticket_entropy, nullptr, 0);
+	if (ret == 0) {
+		// Tickets (and their keys) are valid for a day.
+		ret = mbedtls_ssl_ticket_setup(&ticket_ctx, mbedtls_ctr_drbg_random, &ticket_ctr_drbg, MBEDTLS_CIPHER_AES_256_GCM, 86400);
+	}
+	if (ret != 0) {
+		mbedtls_ssl_ticket_free(&ticket_ctx);
+		mbedtls_ctr_drbg_free(&ticket_ctr_drbg);
+		mbedtls_entropy_free(&ticket_entropy);
+		ERR_FAIL_V_MSG(false, "Failed to setup TLS session tickets, error: " + itos(ret));
+	}
+
+	ticket_inited = true;
+	return true;
+}
+
+int TLSContextMbedTLS::_ticket_write(void *p_ticket, const mbedtls_ssl_session *p_session, unsigned char *p_start, const unsigned char *p_end, size_t *r_len, uint32_t *r_lifetime) {
+	MutexLock lock(ticket_mutex);
+	return mbedtls_ssl_ticket_write(p_ticket, p_session, p_start, p_end, r_len, r_lifetime);
+}
+
+int TLSContextMbedTLS::_ticket_parse(void *p_ticket, mbedtls_ssl_session *p_session, unsigned char *p_buf, size_t p_len) {
+	MutexLock lock(ticket_mutex);
+	return mbedtls_ssl_ticket_parse(p_ticket, p_session, p_buf, p_len);
+}
+
+void TLSContextMbedTLS::save_session() {
+	ERR_FAIL_COND(!inited);
+	if (session_key.is_empty()) {
+		return; // Not a client stream.
+	}
+
+	mbedtls_ssl_session *session = memnew(mbedtls_ssl_session);
+	mbedtls_ssl_session_init(session);
+	if (mbedtls_ssl_get_session(&tls, session) != 0) {
+		mbedtls_ssl_session_free(session);
+		memdelete(session);
+		return;
+	}
+
+	MutexLock lock(client_sessions_mutex);
+	HashMap<String, mbedtls_ssl_session *>::Iterator E = client_sessions.find(session_key);
+	if (E) {
+		mbedtls_ssl_session_free(E->value);
+		memdelete(E->value);
+		E->value = session;
+		return;
+	}
+	if (client_sessions.size() >= MAX_CLIENT_SESSIONS) {
+		// Drop the oldest host.
+		HashMap<String, mbedtls_ssl_session *>::Iterator F = client_sessions.begin();
+		mbedtls_ssl_session_free(F->value);
+		memdelete(F->value);
+		client_sessions.remove(F);
+	}
+	client_sessions.insert(session_key, session);
+}
+
+void TLSContextMbedTLS::clear_sessions() {
+	MutexLock lock(client_sessions_mutex);
+	for (KeyValue<String, mbedtls_ssl_session *> &E : client_sessions) {
+		mbedtls_ssl_session_free(E.value);
+		memdelete(E.value);
+	}
+	client_sessions.clear();
+
+	MutexLock ticket_lock(ticket_mutex);
+	if (ticket_inited) {
+		mbedtls_ssl_ticket_free(&ticket_ctx);
+		mbedtls_ctr_drbg_free(&ticket_ctr_drbg);
+		mbedtls_entropy_free(&ticket_entropy);
+		ticket_inited = false;
+	}
+}
+
 Error TLSContextMbedTLS::_setup(int p_endpoint, int p_transport, int p_authmode) {
 	ERR_FAIL_COND_V_MSG(inited, ERR_ALREADY_IN_USE, "This SSL context is already active");
 
@@ -143,6 +236,9 @@ Error TLSContextMbedTLS::init_server(int p_transport, Ref<TLSOptions> p_options,
 		}
 		cookies = p_cookies;
 		mbedtls_ssl_conf_dtls_cookies(&conf, mbedtls_ssl_cookie_write, mbedtls_ssl_cookie_check, &(cookies->cookie_ctx));
+	} else if (_ticket_setup()) {
+		// Let clients resume their sessions.
+		mbedtls_ssl_conf_session_tickets_cb(&conf, _ticket_write, _ticket_parse, &ticket_ctx);
 	}
 	mbedtls_ssl_setup(&tls, &conf);
 	return OK;
@@ -188,6 +284,18 @@ Error TLSContextMbedTLS::init_client(int p_transport, const String &p_hostname,
 	// Set valid CAs
 	mbedtls_ssl_conf_ca_chain(&conf, &(cas->cert), nullptr);
 	mbedtls_ssl_setup(&tls, &conf);
+
+	// Resume a previous session with this host if we have one.
+	// Sessions are only shared between connections verified the same way.
+	if (p_transport == MBEDTLS_SSL_TRANSPORT_STREAM && !p_hostname.is_empty()) {
+		session_key = p_hostname + "|" + itos(p_options->get_verify_mode()) + "|" + p_options->get_common_name() + "|" + itos(cas->get_instance_id());
+
+		MutexLock lock(client_sessions_mutex);
+		HashMap<String, mbedtls_ssl_session *>::ConstIterator E = client_sessions.find(session_key);
+		if (E) {
+			mbedtls_ssl_set_session(&tls, E->value);
+		}
+	}
 	return OK;
 }
 
@@ -210,6 +318,7 @@ void TLSContextMbedTLS::clear() {
 	}
 	pkey = Ref<CryptoKeyMbedTLS>();
 	cookies = Ref<CookieContextMbedTLS>();
+	session_key = String();
 	inited = false;
 }
 
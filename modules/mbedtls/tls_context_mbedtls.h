@@ -35,6 +35,8 @@
 
 #include "core/io/file_access.h"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 
 #include <mbedtls/config.h>
 #include <mbedtls/ctr_drbg.h>
@@ -42,6 +44,7 @@
 #include <mbedtls/entropy.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/ssl_cookie.h>
+#include <mbedtls/ssl_ticket.h>
 
 class TLSContextMbedTLS;
 
@@ -66,6 +69,25 @@ class TLSContextMbedTLS : public RefCounted {
 protected:
 	bool inited = false;
 
+	// Client sessions of completed handshakes, so new connections to the same host can resume them
+	// (via session ID or session ticket) instead of doing a full handshake.
+	static const int MAX_CLIENT_SESSIONS = 64;
+	static Mutex client_sessions_mutex;
+	static HashMap<String, mbedtls_ssl_session *> client_sessions;
+	String session_key;
+
+	// Session tickets issued by our servers. mbedtls is built without threading support,
+	// so the shared ticket context is guarded by our own mutex.
+	static Mutex ticket_mutex;
+	static bool ticket_inited;
+	static mbedtls_entropy_context ticket_entropy;
+	static mbedtls_ctr_drbg_context ticket_ctr_drbg;
+	static mbedtls_ssl_ticket_context ticket_ctx;
+
+	static bool _ticket_setup();
+	static int _ticket_write(void *p_ticket, const mbedtls_ssl_session *p_session, unsigned char *p_start, const unsigned char *p_end, size_t *r_len, uint32_t *r_lifetime);
+	static int _ticket_parse(void *p_ticket, mbedtls_ssl_session *p_session, unsigned char *p_buf, size_t p_len);
+
 public:
 	static void print_mbedtls_error(int p_ret);
 
@@ -83,6 +105,9 @@ public:
 	Error init_client(int p_transport, const String &p_hostname, Ref<TLSOptions> p_options);
 	void clear();
 
+	void save_session();
+	static void clear_sessions();
+
 	mbedtls_ssl_context *get_context();
 
 	TLSContextMbedTLS();
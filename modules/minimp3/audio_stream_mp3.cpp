@@ -53,20 +53,33 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		beat_length_frames = mp3_stream->get_beat_count() * mp3_stream->sample_rate * 60 / mp3_stream->get_bpm();
 	}
 
+	const int channels = mp3_stream->channels;
+
 	while (todo && active) {
 		mp3dec_frame_info_t frame_info;
 		mp3d_sample_t *buf_frame = nullptr;
 
-		int samples_mixed = mp3dec_ex_read_frame(mp3d, &buf_frame, &frame_info, mp3_stream->channels);
+		// Take as many frames as the decoder has ready in one call, rather than one frame per call,
+		// but never past the loop point so beat loops still restart on the exact frame.
+		int frames_wanted = todo;
+		if (beat_loop) {
+			frames_wanted = CLAMP(beat_length_frames - (int)frames_mixed, 1, todo);
+		}
+
+		int samples_mixed = mp3dec_ex_read_frame(mp3d, &buf_frame, &frame_info, frames_wanted * channels);
 
 		if (samples_mixed) {
-			p_buffer[p_frames - todo] = AudioFrame(buf_frame[0], buf_frame[samples_mixed - 1]);
-			if (loop_fade_remaining < FADE_SIZE) {
-				p_buffer[p_frames - todo] += loop_fade[loop_fade_remaining] * (float(FADE_SIZE - loop_fade_remaining) / float(FADE_SIZE));
-				loop_fade_remaining++;
+			const int frames_read = MAX(samples_mixed / channels, 1);
+			for (int i = 0; i < frames_read; i++) {
+				const mp3d_sample_t *sample = &buf_frame[i * channels];
+				p_buffer[p_frames - todo] = AudioFrame(sample[0], sample[channels - 1]);
+				if (loop_fade_remaining < FADE_SIZE) {
+					p_buffer[p_frames - todo] += loop_fade[loop_fade_remaining] * (float(FADE_SIZE - loop_fade_remaining) / float(FADE_SIZE));
+					loop_fade_remaining++;
+				}
+				--todo;
+				++frames_mixed;
 			}
-			--todo;
-			++frames_mixed;
 
 			if (beat_loop && (int)frames_mixed >= beat_length_frames) {
 				for (int i = 0; i < FADE_SIZE; i++) {
@@ -32,6 +32,13 @@ partial class EventSignals
         add => backing_MySignal += value;
         remove => backing_MySignal -= value;
 }
+    /// <summary>
+    /// Emits the 'MySignal' signal, using its cached name.
+    /// </summary>
+    protected void EmitSignalMySignal(string @str, int @num)
+    {
+        EmitSignal(SignalName.MySignal, global::Godot.Variant.From<string>(@str), global::Godot.Variant.From<int>(@num));
+    }
     /// <inheritdoc/>
     [global::System.ComponentModel.EditorBrowsable(global::System.ComponentModel.EditorBrowsableState.Never)]
     protected override void RaiseGodotClassSignalCallbacks(in godot_string_name signal, NativeVariantPtrArgs args)
@@ -5,12 +5,8 @@ using Microsoft.CodeAnalysis;
 using Microsoft.CodeAnalysis.CSharp.Syntax;
 using Microsoft.CodeAnalysis.Text;
 
-// TODO:
-//   Determine a proper way to emit the signal.
-//   'Emit(nameof(TheEvent))' creates a StringName every time and has the overhead of string marshaling.
-//   I haven't decided on the best option yet. Some possibilities:
-//     - Expose the generated StringName fields to the user, for use with 'Emit(...)'.
-//     - Generate a 'EmitSignalName' method for each event signal.
+// 'Emit(nameof(TheEvent))' creates a StringName every time and has the overhead of string marshaling.
+// A typed 'EmitSignal{Name}' method is generated for each event signal, which uses the cached StringName.
 
 namespace Godot.SourceGenerators
 {
@@ -288,6 +284,8 @@ namespace Godot.SourceGenerators
                     .Append(signalName)
                     .Append(" -= value;\n")
                     .Append("}\n");
+
+                GenerateSignalEmitter(signalDelegate, source);
             }
 
             // Generate RaiseGodotClassSignalCallbacks
@@ -485,6 +483,52 @@ namespace Godot.SourceGenerators
             source.Append(") {\n           return true;\n        }\n");
         }
 
+        private static void GenerateSignalEmitter(
+            GodotSignalDelegateData signal,
+            StringBuilder source
+        )
+        {
+            string signalName = signal.Name;
+            var invokeMethodData = signal.InvokeMethodData;
+            var parameters = invokeMethodData.Method.Parameters;
+
+            source.Append("    /// <summary>\n")
+                .Append("    /// Emits the '")
+                .Append(signalName)
+                .Append("' signal, using its cached name.\n")
+                .Append("    /// </summary>\n");
+
+            source.Append("    protected void EmitSignal")
+                .Append(signalName)
+                .Append("(");
+
+            for (int i = 0; i < parameters.Length; i++)
+            {
+                if (i != 0)
+                    source.Append(", ");
+
+                source.Append(parameters[i].Type.FullQualifiedNameIncludeGlobal())
+                    .Append(" @")
+                    .Append(parameters[i].Name);
+            }
+
+            source.Append(")\n    {\n");
+
+            source.Append("        EmitSignal(SignalName.")
+                .Append(signalName);
+
+            for (int i = 0; i < parameters.Length; i++)
+            {
+                source.Append(", ");
+                source.AppendManagedToVariantExpr(string.Concat("@", parameters[i].Name),
+                    invokeMethodData.ParamTypeSymbols[i], invokeMethodData.ParamTypes[i]);
+            }
+
+            source.Append(");\n");
+
+            source.Append("    }\n");
+        }
+
         private static void GenerateSignalEventInvoker(
             GodotSignalDelegateData signal,
             StringBuilder source
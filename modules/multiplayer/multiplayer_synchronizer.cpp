@@ -31,6 +31,7 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "core/os/os.h"
 #include "scene/main/multiplayer_api.h"
 
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
@@ -153,16 +154,38 @@ PackedStringArray MultiplayerSynchronizer::get_configuration_warnings() const {
 	return warnings;
 }
 
-Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs) {
+Variant MultiplayerSynchronizer::_get_prop_value(const Object *p_obj, const NodePath &p_prop, ObjectMemberCache *p_cache, bool *r_valid) {
+	const Vector<StringName> &subnames = p_prop.get_subnames();
+	if (p_cache && subnames.size() == 1) {
+		p_cache->set_member(subnames[0]);
+		return p_cache->get(p_obj, r_valid);
+	}
+	return p_obj->get_indexed(subnames, r_valid);
+}
+
+void MultiplayerSynchronizer::_set_prop_value(Object *p_obj, const NodePath &p_prop, ObjectMemberCache *p_cache, const Variant &p_value) {
+	const Vector<StringName> &subnames = p_prop.get_subnames();
+	if (p_cache && subnames.size() == 1) {
+		p_cache->set_member(subnames[0]);
+		p_cache->set(p_obj, p_value);
+		return;
+	}
+	p_obj->set_indexed(subnames, p_value);
+}
+
+Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, LocalVector<ObjectMemberCache> *p_caches) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	r_variant.resize(p_properties.size());
 	r_variant_ptrs.resize(r_variant.size());
+	if (p_caches) {
+		p_caches->resize(p_properties.size());
+	}
 	int i = 0;
 	for (const NodePath &prop : p_properties) {
 		bool valid = false;
 		const Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		r_variant.write[i] = obj->get_indexed(prop.get_subnames(), &valid);
+		r_variant.write[i] = _get_prop_value(obj, prop, p_caches ? &(*p_caches)[i] : nullptr, &valid);
 		r_variant_ptrs.write[i] = &r_variant[i];
 		ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, vformat("Property '%s' not found.", prop));
 		i++;
@@ -170,13 +193,16 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 	return OK;
 }
 
-Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state) {
+Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, LocalVector<ObjectMemberCache> *p_caches) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
+	if (p_caches) {
+		p_caches->resize(p_properties.size());
+	}
 	int i = 0;
 	for (const NodePath &prop : p_properties) {
 		Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		obj->set_indexed(prop.get_subnames(), p_state[i]);
+		_set_prop_value(obj, prop, p_caches ? &(*p_caches)[i] : nullptr, p_state[i]);
 		i += 1;
 	}
 	return OK;
@@ -242,6 +268,19 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_visibility_update_interval(double p_interval) {
+	ERR_FAIL_COND_MSG(p_interval < 0, "Interval must be greater or equal to 0 (where 0 means every frame)");
+	visibility_update_interval_usec = uint64_t(p_interval * 1000 * 1000);
+	if (visibility_update_interval_usec > 0) {
+		// Spread synchronizers created together over the interval, so their filters don't all run on the same frame.
+		last_visibility_update_usec = OS::get_singleton()->get_ticks_usec() - Math::rand() % visibility_update_interval_usec;
+	}
+}
+
+double MultiplayerSynchronizer::get_visibility_update_interval() const {
+	return double(visibility_update_interval_usec) / 1000.0 / 1000.0;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -257,6 +296,8 @@ void MultiplayerSynchronizer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_visibility_update_mode", "mode"), &MultiplayerSynchronizer::set_visibility_update_mode);
 	ClassDB::bind_method(D_METHOD("get_visibility_update_mode"), &MultiplayerSynchronizer::get_visibility_update_mode);
+	ClassDB::bind_method(D_METHOD("set_visibility_update_interval", "interval"), &MultiplayerSynchronizer::set_visibility_update_interval);
+	ClassDB::bind_method(D_METHOD("get_visibility_update_interval"), &MultiplayerSynchronizer::get_visibility_update_interval);
 	ClassDB::bind_method(D_METHOD("update_visibility", "for_peer"), &MultiplayerSynchronizer::update_visibility, DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("set_visibility_public", "visible"), &MultiplayerSynchronizer::set_visibility_public);
@@ -272,6 +313,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "visibility_update_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_visibility_update_interval", "get_visibility_update_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
@@ -304,6 +346,13 @@ void MultiplayerSynchronizer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS:
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
+			if (visibility_update_interval_usec > 0) {
+				uint64_t now = OS::get_singleton()->get_ticks_usec();
+				if (now < last_visibility_update_usec + visibility_update_interval_usec) {
+					break;
+				}
+				last_visibility_update_usec = now;
+			}
 			update_visibility(0);
 		} break;
 	}
@@ -387,9 +436,9 @@ Error MultiplayerSynchronizer::_watch_changes(uint64_t p_usec) {
 		bool valid = false;
 		const Object *obj = _get_prop_target(node, prop);
 		ERR_CONTINUE_MSG(!obj, vformat("Node not found for property '%s'.", prop));
-		Variant v = obj->get_indexed(prop.get_subnames(), &valid);
-		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
 		Watcher &w = ptr[idx];
+		Variant v = _get_prop_value(obj, prop, &w.cache, &valid);
+		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
 		if (w.prop != prop) {
 			w.prop = prop;
 			w.value = v.duplicate(true);
@@ -33,6 +33,7 @@
 
 #include "scene_replication_config.h"
 
+#include "core/object/object_member_cache.h"
 #include "scene/main/node.h"
 
 class MultiplayerSynchronizer : public Node {
@@ -50,6 +51,7 @@ private:
 		NodePath prop;
 		uint64_t last_change_usec = 0;
 		Variant value;
+		ObjectMemberCache cache;
 	};
 
 	Ref<SceneReplicationConfig> replication_config;
@@ -57,9 +59,12 @@ private:
 	uint64_t sync_interval_usec = 0;
 	uint64_t delta_interval_usec = 0;
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
+	uint64_t visibility_update_interval_usec = 0;
+	uint64_t last_visibility_update_usec = 0;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
 	Vector<Watcher> watchers;
+	LocalVector<ObjectMemberCache> sync_property_caches;
 	uint64_t last_watch_usec = 0;
 
 	ObjectID root_node_cache;
@@ -69,6 +74,8 @@ private:
 	bool sync_started = false;
 
 	static Object *_get_prop_target(Object *p_obj, const NodePath &p_prop);
+	static Variant _get_prop_value(const Object *p_obj, const NodePath &p_prop, ObjectMemberCache *p_cache, bool *r_valid);
+	static void _set_prop_value(Object *p_obj, const NodePath &p_prop, ObjectMemberCache *p_cache, const Variant &p_value);
 	void _start();
 	void _stop();
 	void _update_process();
@@ -79,8 +86,9 @@ protected:
 	void _notification(int p_what);
 
 public:
-	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs);
-	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state);
+	// When given, p_caches holds one member cache per property and is kept across calls to speed up property access.
+	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, LocalVector<ObjectMemberCache> *p_caches = nullptr);
+	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, LocalVector<ObjectMemberCache> *p_caches = nullptr);
 
 	void reset();
 	Node *get_root_node();
@@ -116,10 +124,13 @@ public:
 	void add_visibility_filter(Callable p_callback);
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
+	void set_visibility_update_interval(double p_interval);
+	double get_visibility_update_interval() const;
 
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
+	LocalVector<ObjectMemberCache> *get_sync_property_caches() { return &sync_property_caches; }
 
 	MultiplayerSynchronizer();
 };
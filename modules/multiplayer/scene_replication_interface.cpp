@@ -144,6 +144,7 @@ void SceneReplicationInterface::on_network_process() {
 
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
+	sync_state_cache.clear();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
@@ -823,14 +824,25 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		// The state only depends on the synchronizer, encode it once per frame and reuse it for every peer.
+		const Vector<uint8_t> *state = sync_state_cache.getptr(oid);
+		if (!state) {
+			int state_size;
+			Vector<Variant> vars;
+			Vector<const Variant *> varp;
+			const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+			Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp, sync->get_sync_property_caches());
+			ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
+			err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, state_size);
+			ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+			Vector<uint8_t> encoded;
+			encoded.resize(state_size);
+			if (state_size) {
+				MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), encoded.ptrw(), state_size);
+			}
+			state = &sync_state_cache.insert(oid, encoded)->value;
+		}
+		int size = state->size();
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
 		if (ofs + 4 + 4 + size > sync_mtu) {
@@ -841,7 +853,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state->ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -891,7 +903,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		int consumed;
 		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		err = MultiplayerSynchronizer::set_state(props, node, vars, sync->get_sync_property_caches());
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
 		sync->emit_signal(SNAME("synchronized"));
@@ -90,6 +90,8 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	PackedByteArray packet_cache;
+	// Encoded sync states for the current network frame, shared by all peers.
+	HashMap<ObjectID, Vector<uint8_t>> sync_state_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
@@ -104,16 +104,16 @@ void SceneRPCInterface::_parse_rpc_config(const Variant &p_config, bool p_for_no
 
 const SceneRPCInterface::RPCConfigCache &SceneRPCInterface::_get_node_config(const Node *p_node) {
 	const ObjectID oid = p_node->get_instance_id();
-	if (rpc_cache.has(oid)) {
-		return rpc_cache[oid];
+	const RPCConfigCache *cached = rpc_cache.getptr(oid);
+	if (cached) {
+		return *cached;
 	}
 	RPCConfigCache cache;
 	_parse_rpc_config(p_node->get_node_rpc_config(), true, cache);
 	if (p_node->get_script_instance()) {
 		_parse_rpc_config(p_node->get_script_instance()->get_rpc_config(), false, cache);
 	}
-	rpc_cache[oid] = cache;
-	return rpc_cache[oid];
+	return rpc_cache.insert(oid, cache)->value;
 }
 
 String SceneRPCInterface::get_rpc_md5(const Object *p_obj) {
@@ -128,12 +128,13 @@ String SceneRPCInterface::get_rpc_md5(const Object *p_obj) {
 }
 
 Node *SceneRPCInterface::_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len) {
-	Node *root_node = SceneTree::get_singleton()->get_root()->get_node(multiplayer->get_root_path());
-	ERR_FAIL_NULL_V(root_node, nullptr);
 	Node *node = nullptr;
 
 	if (p_node_target & 0x80000000) {
 		// Use full path (not cached yet).
+		// The root node is only needed here, cached targets are resolved by ID.
+		Node *root_node = SceneTree::get_singleton()->get_root()->get_node(multiplayer->get_root_path());
+		ERR_FAIL_NULL_V(root_node, nullptr);
 		int ofs = p_node_target & 0x7FFFFFFF;
 
 		ERR_FAIL_COND_V_MSG(ofs >= p_packet_len, nullptr, "Invalid packet received. Size smaller than declared.");
@@ -233,8 +234,9 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 
 	// Check that remote can call the RPC on this node.
 	const RPCConfigCache &cache_config = _get_node_config(p_node);
-	ERR_FAIL_COND(!cache_config.configs.has(p_rpc_method_id));
-	const RPCConfig &config = cache_config.configs[p_rpc_method_id];
+	const RPCConfig *config_ptr = cache_config.configs.getptr(p_rpc_method_id);
+	ERR_FAIL_NULL(config_ptr);
+	const RPCConfig &config = *config_ptr;
 
 	bool can_call = false;
 	switch (config.rpc_mode) {
@@ -267,9 +269,8 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 	}
 
 	Vector<Variant> args;
-	Vector<const Variant *> argp;
 	args.resize(argc);
-	argp.resize(argc);
+	const Variant **argp = (const Variant **)alloca(sizeof(Variant *) * argc);
 
 #ifdef DEBUG_ENABLED
 	_profile_node_data("rpc_in", p_node->get_instance_id(), p_packet_len);
@@ -277,15 +278,16 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 
 	int out;
 	MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+	const Variant *argv = args.ptr();
 	for (int i = 0; i < argc; i++) {
-		argp.write[i] = &args[i];
+		argp[i] = &argv[i];
 	}
 
 	Callable::CallError ce;
 
-	p_node->callp(config.name, (const Variant **)argp.ptr(), argc, ce);
+	p_node->callp(config.name, argp, argc, ce);
 	if (ce.error != Callable::CallError::CALL_OK) {
-		String error = Variant::get_call_error_text(p_node, config.name, (const Variant **)argp.ptr(), argc, ce);
+		String error = Variant::get_call_error_text(p_node, config.name, argp, argc, ce);
 		error = "RPC - " + error;
 		ERR_PRINT(error);
 	}
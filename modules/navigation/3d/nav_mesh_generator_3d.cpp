@@ -781,13 +781,21 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
 	Vector<Vector3> nav_vertices;
-
+	nav_vertices.resize(detail_mesh->nverts);
+	Vector3 *nav_vertices_ptrw = nav_vertices.ptrw();
 	for (int i = 0; i < detail_mesh->nverts; i++) {
 		const float *v = &detail_mesh->verts[i * 3];
-		nav_vertices.push_back(Vector3(v[0], v[1], v[2]));
+		nav_vertices_ptrw[i] = Vector3(v[0], v[1], v[2]);
 	}
-	p_navigation_mesh->set_vertices(nav_vertices);
-	p_navigation_mesh->clear_polygons();
+
+	int nav_polygon_count = 0;
+	for (int i = 0; i < detail_mesh->nmeshes; i++) {
+		nav_polygon_count += detail_mesh->meshes[i * 4 + 3];
+	}
+	Vector<Vector<int>> nav_polygons;
+	nav_polygons.resize(nav_polygon_count);
+	Vector<int> *nav_polygons_ptrw = nav_polygons.ptrw();
+	int nav_polygon_index = 0;
 
 	for (int i = 0; i < detail_mesh->nmeshes; i++) {
 		const unsigned int *detail_mesh_m = &detail_mesh->meshes[i * 4];
@@ -802,10 +810,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[0] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 0]));
 			nav_indices.write[1] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 2]));
 			nav_indices.write[2] = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 1]));
-			p_navigation_mesh->add_polygon(nav_indices);
+			nav_polygons_ptrw[nav_polygon_index++] = nav_indices;
 		}
 	}
 
+	// Assign everything at once, so listeners are notified a single time.
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
 	bake_state = "Cleanup..."; // step #11
 
 	rcFreePolyMesh(poly_mesh);
@@ -160,6 +160,26 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	Vector3 end_point;
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
+
+	// Crowds moving to a shared goal query the same destination over and over,
+	// so remember where the last destination landed on this map.
+	struct DestinationCache {
+		RID map;
+		uint32_t iteration_id = 0;
+		uint32_t navigation_layers = 0;
+		Vector3 destination;
+		const gd::Polygon *end_poly = nullptr;
+		Vector3 end_point;
+		real_t end_d = FLT_MAX;
+	};
+	thread_local DestinationCache destination_cache;
+	const bool end_cached = destination_cache.map == get_self() && destination_cache.iteration_id == iteration_id && destination_cache.navigation_layers == p_navigation_layers && destination_cache.destination == p_destination;
+	if (end_cached) {
+		end_poly = destination_cache.end_poly;
+		end_point = destination_cache.end_point;
+		end_d = destination_cache.end_d;
+	}
+
 	// Find the initial poly and the end poly on this map.
 	for (const gd::Polygon &p : polygons) {
 		// Only consider the polygon if it in a region with compatible layers.
@@ -179,6 +199,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				begin_point = point;
 			}
 
+			if (end_cached) {
+				continue;
+			}
+
 			point = face.get_closest_point_to(p_destination);
 			distance_to_point = point.distance_to(p_destination);
 			if (distance_to_point < end_d) {
@@ -189,6 +213,16 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 	}
 
+	if (!end_cached) {
+		destination_cache.map = get_self();
+		destination_cache.iteration_id = iteration_id;
+		destination_cache.navigation_layers = p_navigation_layers;
+		destination_cache.destination = p_destination;
+		destination_cache.end_poly = end_poly;
+		destination_cache.end_point = end_point;
+		destination_cache.end_d = end_d;
+	}
+
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
 		return Vector<Vector3>();
@@ -220,9 +254,15 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	}
 
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
+	// The buffers are kept per thread, so repeated queries don't reallocate them.
+	thread_local LocalVector<gd::NavigationPoly> navigation_polys;
+	navigation_polys.clear();
 	navigation_polys.reserve(polygons.size() * 0.75);
 
+	// Index of each reached polygon in navigation_polys.
+	thread_local HashMap<const gd::Polygon *, uint32_t> navigation_poly_ids;
+	navigation_poly_ids.clear();
+
 	// Add the start polygon to the reachable navigation polygons.
 	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
 	begin_navigation_poly.self_id = 0;
@@ -230,6 +270,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	navigation_polys.push_back(begin_navigation_poly);
+	navigation_poly_ids.insert(begin_poly, 0);
 
 	// List of polygon IDs to visit.
 	List<uint32_t> to_visit;
@@ -237,6 +278,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 	// This is an implementation of the A* algorithm.
 	int least_cost_id = 0;
+	List<uint32_t>::Element *least_cost_element = to_visit.front();
 	int prev_least_cost_id = -1;
 	bool found_route = false;
 
@@ -269,11 +311,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, pathway);
 				const real_t new_distance = (least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost) + poly_enter_cost + least_cost_poly.traveled_distance;
 
-				int64_t already_visited_polygon_index = navigation_polys.find(gd::NavigationPoly(connection.polygon));
+				HashMap<const gd::Polygon *, uint32_t>::Iterator already_visited = navigation_poly_ids.find(connection.polygon);
 
-				if (already_visited_polygon_index != -1) {
+				if (already_visited) {
 					// Polygon already visited, check if we can reduce the travel cost.
-					gd::NavigationPoly &avp = navigation_polys[already_visited_polygon_index];
+					gd::NavigationPoly &avp = navigation_polys[already_visited->value];
 					if (new_distance < avp.traveled_distance) {
 						avp.back_navigation_poly_id = least_cost_id;
 						avp.back_navigation_edge = connection.edge;
@@ -293,6 +335,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					new_navigation_poly.traveled_distance = new_distance;
 					new_navigation_poly.entry = new_entry;
 					navigation_polys.push_back(new_navigation_poly);
+					navigation_poly_ids.insert(connection.polygon, new_navigation_poly.self_id);
 
 					// Add the neighbor polygon to the polygons to visit.
 					to_visit.push_back(navigation_polys.size() - 1);
@@ -301,7 +344,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 
 		// Removes the least cost polygon from the list of polygons to visit so we can advance.
-		to_visit.erase(least_cost_id);
+		to_visit.erase(least_cost_element);
 
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
@@ -370,9 +413,12 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			gd::NavigationPoly np = navigation_polys[0];
 			navigation_polys.clear();
 			navigation_polys.push_back(np);
+			navigation_poly_ids.clear();
+			navigation_poly_ids.insert(np.poly, 0);
 			to_visit.clear();
 			to_visit.push_back(0);
 			least_cost_id = 0;
+			least_cost_element = to_visit.front();
 			prev_least_cost_id = -1;
 
 			reachable_end = nullptr;
@@ -382,6 +428,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 		// Find the polygon with the minimum cost from the list of polygons to visit.
 		least_cost_id = -1;
+		least_cost_element = nullptr;
 		real_t least_cost = FLT_MAX;
 		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
 			gd::NavigationPoly *np = &navigation_polys[element->get()];
@@ -389,6 +436,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
 			if (cost < least_cost) {
 				least_cost_id = np->self_id;
+				least_cost_element = element;
 				least_cost = cost;
 			}
 		}
@@ -789,13 +837,13 @@ void NavMap::set_agent_as_controlled(NavAgent *agent) {
 		int64_t agent_3d_index = active_3d_avoidance_agents.find(agent);
 		if (agent_3d_index < 0) {
 			active_3d_avoidance_agents.push_back(agent);
-			agents_dirty = true;
+			agents_3d_dirty = true;
 		}
 	} else {
 		int64_t agent_2d_index = active_2d_avoidance_agents.find(agent);
 		if (agent_2d_index < 0) {
 			active_2d_avoidance_agents.push_back(agent);
-			agents_dirty = true;
+			agents_2d_dirty = true;
 		}
 	}
 }
@@ -804,12 +852,12 @@ void NavMap::remove_agent_as_controlled(NavAgent *agent) {
 	int64_t agent_3d_index = active_3d_avoidance_agents.find(agent);
 	if (agent_3d_index >= 0) {
 		active_3d_avoidance_agents.remove_at_unordered(agent_3d_index);
-		agents_dirty = true;
+		agents_3d_dirty = true;
 	}
 	int64_t agent_2d_index = active_2d_avoidance_agents.find(agent);
 	if (agent_2d_index >= 0) {
 		active_2d_avoidance_agents.remove_at_unordered(agent_2d_index);
-		agents_dirty = true;
+		agents_2d_dirty = true;
 	}
 }
 
@@ -936,6 +984,7 @@ void NavMap::sync() {
 
 		// Copy all region polygons in the map.
 		count = 0;
+		uint32_t edge_count = 0;
 		for (const NavRegion *region : regions) {
 			if (!region->get_enabled()) {
 				continue;
@@ -943,6 +992,7 @@ void NavMap::sync() {
 			const LocalVector<gd::Polygon> &polygons_source = region->get_polygons();
 			for (uint32_t n = 0; n < polygons_source.size(); n++) {
 				polygons[count + n] = polygons_source[n];
+				edge_count += polygons_source[n].points.size();
 			}
 			count += region->get_polygons().size();
 		}
@@ -950,25 +1000,26 @@ void NavMap::sync() {
 		_new_pm_polygon_count = polygons.size();
 
 		// Group all edges per key.
-		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
+		HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey> connections;
+		connections.reserve(edge_count);
 		for (gd::Polygon &poly : polygons) {
 			for (uint32_t p = 0; p < poly.points.size(); p++) {
 				int next_point = (p + 1) % poly.points.size();
 				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
 
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
+				HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey>::Iterator connection = connections.find(ek);
 				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
+					connection = connections.insert(ek, gd::EdgeConnectionPair());
 					_new_pm_edge_count += 1;
 				}
-				if (connections[ek].size() <= 1) {
+				gd::EdgeConnectionPair &pair = connection->value;
+				if (pair.size < 2) {
 					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
+					gd::Edge::Connection &new_connection = pair.connections[pair.size++];
 					new_connection.polygon = &poly;
 					new_connection.edge = p;
 					new_connection.pathway_start = poly.points[p].pos;
 					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
 				} else {
 					// The edge is already connected with another edge, skip.
 					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
@@ -976,20 +1027,20 @@ void NavMap::sync() {
 			}
 		}
 
-		Vector<gd::Edge::Connection> free_edges;
-		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
-			if (E.value.size() == 2) {
+		LocalVector<gd::Edge::Connection> free_edges;
+		for (KeyValue<gd::EdgeKey, gd::EdgeConnectionPair> &E : connections) {
+			if (E.value.size == 2) {
 				// Connect edge that are shared in different polygons.
-				gd::Edge::Connection &c1 = E.value.write[0];
-				gd::Edge::Connection &c2 = E.value.write[1];
+				gd::Edge::Connection &c1 = E.value.connections[0];
+				gd::Edge::Connection &c2 = E.value.connections[1];
 				c1.polygon->edges[c1.edge].connections.push_back(c2);
 				c2.polygon->edges[c2.edge].connections.push_back(c1);
 				// Note: The pathway_start/end are full for those connection and do not need to be modified.
 				_new_pm_edge_merge_count += 1;
 			} else {
-				CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
-				if (use_edge_connections && E.value[0].polygon->owner->get_use_edge_connections()) {
-					free_edges.push_back(E.value[0]);
+				CRASH_COND_MSG(E.value.size != 1, vformat("Number of connection != 1. Found: %d", E.value.size));
+				if (use_edge_connections && E.value.connections[0].polygon->owner->get_use_edge_connections()) {
+					free_edges.push_back(E.value.connections[0]);
 				}
 			}
 		}
@@ -1003,19 +1054,29 @@ void NavMap::sync() {
 		// connection, integration and path finding.
 		_new_pm_edge_free_count = free_edges.size();
 
-		for (int i = 0; i < free_edges.size(); i++) {
+		// Every free edge is tested against every other one, so gather the endpoints once.
+		LocalVector<Vector3> free_edge_points;
+		free_edge_points.resize(free_edges.size() * 2);
+		for (uint32_t i = 0; i < free_edges.size(); i++) {
 			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+			free_edge_points[i * 2] = free_edge.polygon->points[free_edge.edge].pos;
+			free_edge_points[i * 2 + 1] = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+		}
+
+		for (uint32_t i = 0; i < free_edges.size(); i++) {
+			const gd::Edge::Connection &free_edge = free_edges[i];
+			const Vector3 &edge_p1 = free_edge_points[i * 2];
+			const Vector3 &edge_p2 = free_edge_points[i * 2 + 1];
+			const NavBase *owner = free_edge.polygon->owner;
 
-			for (int j = 0; j < free_edges.size(); j++) {
+			for (uint32_t j = 0; j < free_edges.size(); j++) {
 				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
+				if (i == j || owner == other_edge.polygon->owner) {
 					continue;
 				}
 
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
+				const Vector3 &other_edge_p1 = free_edge_points[j * 2];
+				const Vector3 &other_edge_p2 = free_edge_points[j * 2 + 1];
 
 				// Compute the projection of the opposite edge on the current one
 				Vector3 edge_vector = edge_p2 - edge_p1;
@@ -1187,12 +1248,16 @@ void NavMap::sync() {
 	// Do we have modified agent arrays?
 	for (NavAgent *agent : agents) {
 		if (agent->check_dirty()) {
-			agents_dirty = true;
+			if (agent->get_use_3d_avoidance()) {
+				agents_3d_dirty = true;
+			} else {
+				agents_2d_dirty = true;
+			}
 		}
 	}
 
 	// Update avoidance worlds.
-	if (obstacles_dirty || agents_dirty) {
+	if (obstacles_dirty || agents_dirty || agents_2d_dirty || agents_3d_dirty) {
 		_update_rvo_simulation();
 	}
 
@@ -1200,6 +1265,8 @@ void NavMap::sync() {
 	regenerate_links = false;
 	obstacles_dirty = false;
 	agents_dirty = false;
+	agents_2d_dirty = false;
+	agents_3d_dirty = false;
 
 	// Performance Monitor.
 	pm_region_count = _new_pm_region_count;
@@ -1297,7 +1364,7 @@ void NavMap::_update_rvo_agents_tree_2d() {
 	for (NavAgent *agent : active_2d_avoidance_agents) {
 		raw_agents.push_back(agent->get_rvo_agent_2d());
 	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
+	rvo_simulation_2d.kdTree_->buildAgentTree(std::move(raw_agents));
 }
 
 void NavMap::_update_rvo_agents_tree_3d() {
@@ -1307,31 +1374,39 @@ void NavMap::_update_rvo_agents_tree_3d() {
 	for (NavAgent *agent : active_3d_avoidance_agents) {
 		raw_agents.push_back(agent->get_rvo_agent_3d());
 	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
+	rvo_simulation_3d.kdTree_->buildAgentTree(std::move(raw_agents));
 }
 
 void NavMap::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
-	if (agents_dirty) {
+	if (agents_dirty || agents_2d_dirty) {
 		_update_rvo_agents_tree_2d();
+	}
+	if (agents_dirty || agents_3d_dirty) {
 		_update_rvo_agents_tree_3d();
 	}
 }
 
-void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
+void NavMap::compute_avoidance_step_range_2d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		NavAgent *agent = p_agents[i];
+		agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+		agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
+		agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+		agent->update();
+	}
 }
 
-void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
+void NavMap::compute_avoidance_step_range_3d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		NavAgent *agent = p_agents[i];
+		agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+		agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
+		agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+		agent->update();
+	}
 }
 
 void NavMap::step(real_t p_deltatime) {
@@ -1342,29 +1417,19 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_step_range_2d, active_2d_avoidance_agents.ptr(), 0, active_2d_avoidance_agents.size(), 0, -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
-			}
+			compute_avoidance_step_range_2d(0, active_2d_avoidance_agents.size(), active_2d_avoidance_agents.ptr());
 		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_step_range_3d, active_3d_avoidance_agents.ptr(), 0, active_3d_avoidance_agents.size(), 0, -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
-			}
+			compute_avoidance_step_range_3d(0, active_3d_avoidance_agents.size(), active_3d_avoidance_agents.ptr());
 		}
 	}
 }
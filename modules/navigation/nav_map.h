@@ -95,6 +95,10 @@ class NavMap : public NavRid {
 	/// dirty flag when one of the agent's arrays are modified
 	bool agents_dirty = true;
 
+	/// Only one of the avoidance trees needs a rebuild.
+	bool agents_2d_dirty = false;
+	bool agents_3d_dirty = false;
+
 	/// All the Agents (even the controlled one)
 	LocalVector<NavAgent *> agents;
 
@@ -220,8 +224,8 @@ public:
 private:
 	void compute_single_step(uint32_t index, NavAgent **agent);
 
-	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
-	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
+	void compute_avoidance_step_range_2d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents);
+	void compute_avoidance_step_range_3d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents);
 
 	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
 	void _update_rvo_simulation();
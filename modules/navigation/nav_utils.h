@@ -97,18 +97,26 @@ struct Edge {
 	Vector<Connection> connections;
 };
 
+/// The polygon edges sharing the same key, used while merging regions.
+/// An edge can be shared by two polygons at most.
+struct EdgeConnectionPair {
+	Edge::Connection connections[2];
+	int size = 0;
+};
+
 struct Polygon {
 	/// Navigation region or link that contains this polygon.
 	const NavBase *owner = nullptr;
 
 	/// The points of this `Polygon`
-	LocalVector<Point> points;
+	/// Tight storage, polygons never grow after being built and there can be a lot of them.
+	TightLocalVector<Point> points;
 
 	/// Are the points clockwise?
 	bool clockwise;
 
 	/// The edges of this `Polygon`
-	LocalVector<Edge> edges;
+	TightLocalVector<Edge> edges;
 
 	/// The center of this `Polygon`
 	Vector3 center;
@@ -336,6 +336,39 @@ real_t FastNoiseLite::get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const {
 	return _noise.GetNoise(p_x, p_y, p_z);
 }
 
+// Same as calling get_noise_2d() for each point, without the virtual call and
+// with the domain warp check hoisted out of the loop.
+void FastNoiseLite::get_noise_2d_array(const Vector2 *p_points, int p_count, real_t *r_values) const {
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_points[i].x + offset.x;
+			real_t y = p_points[i].y + offset.y;
+			_domain_warp_noise.DomainWarp(x, y);
+			r_values[i] = _noise.GetNoise(x, y);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_points[i].x + offset.x, p_points[i].y + offset.y);
+		}
+	}
+}
+
+void FastNoiseLite::get_noise_3d_array(const Vector3 *p_points, int p_count, real_t *r_values) const {
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_points[i].x + offset.x;
+			real_t y = p_points[i].y + offset.y;
+			real_t z = p_points[i].z + offset.z;
+			_domain_warp_noise.DomainWarp(x, y, z);
+			r_values[i] = _noise.GetNoise(x, y, z);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_points[i].x + offset.x, p_points[i].y + offset.y, p_points[i].z + offset.z);
+		}
+	}
+}
+
 void FastNoiseLite::_changed() {
 	emit_changed();
 }
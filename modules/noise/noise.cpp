@@ -30,6 +30,8 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include <float.h>
 
 Vector<Ref<Image>> Noise::_get_seamless_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt, bool p_normalize) const {
@@ -80,35 +82,76 @@ uint8_t Noise::_alpha_blend<uint8_t>(uint8_t p_bg, uint8_t p_fg, int p_alpha) co
 	return (uint8_t)((alpha * p_fg + inv_alpha * p_bg) >> 8);
 }
 
+void Noise::get_noise_2d_array(const Vector2 *p_points, int p_count, real_t *r_values) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_2d(p_points[i].x, p_points[i].y);
+	}
+}
+
+void Noise::get_noise_3d_array(const Vector3 *p_points, int p_count, real_t *r_values) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_3d(p_points[i].x, p_points[i].y, p_points[i].z);
+	}
+}
+
 Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
 	Vector<Ref<Image>> images;
 	images.resize(p_depth);
 
-	if (p_normalize) {
-		// Get all values and identify min/max values.
-		LocalVector<real_t> values;
-		values.resize(p_width * p_height * p_depth);
+	// Sample every row of every slice, rows are independent so they are spread over the worker threads.
+	LocalVector<real_t> values;
+	values.resize(p_width * p_height * p_depth);
+	const uint32_t rows = p_height * p_depth;
+
+	auto sample_rows = [&](uint32_t p_begin, uint32_t p_end) {
+		LocalVector<Vector2> points_2d;
+		LocalVector<Vector3> points_3d;
+		if (p_in_3d_space) {
+			points_3d.resize(p_width);
+		} else {
+			points_2d.resize(p_width);
+		}
+		for (uint32_t row = p_begin; row < p_end; row++) {
+			int y = row % p_height;
+			int d = row / p_height;
+			real_t *row_values = &values[row * p_width];
+			if (p_in_3d_space) {
+				for (int x = 0; x < p_width; x++) {
+					points_3d[x] = Vector3(x, y, d);
+				}
+				get_noise_3d_array(points_3d.ptr(), p_width, row_values);
+			} else {
+				for (int x = 0; x < p_width; x++) {
+					points_2d[x] = Vector2(x, y);
+				}
+				get_noise_2d_array(points_2d.ptr(), p_width, row_values);
+			}
+		}
+	};
+
+	// Keep a few thousand samples per task, so small images don't pay for the dispatch.
+	const uint32_t grain = MAX(1, 4096 / p_width);
+	if (rows > grain && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::get_singleton()->parallel_for_range(0, rows, grain, sample_rows, "NoiseGenerateImage");
+	} else {
+		sample_rows(0, rows);
+	}
 
+	if (p_normalize) {
+		// Identify min/max values.
 		real_t min_val = FLT_MAX;
 		real_t max_val = -FLT_MAX;
-		int idx = 0;
-		for (int d = 0; d < p_depth; d++) {
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					values[idx] = p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y);
-					if (values[idx] > max_val) {
-						max_val = values[idx];
-					}
-					if (values[idx] < min_val) {
-						min_val = values[idx];
-					}
-					idx++;
-				}
+		for (uint32_t i = 0; i < values.size(); i++) {
+			if (values[i] > max_val) {
+				max_val = values[i];
+			}
+			if (values[i] < min_val) {
+				min_val = values[i];
 			}
 		}
-		idx = 0;
+		int idx = 0;
 		// Normalize values and write to texture.
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -138,7 +181,7 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 		}
 	} else {
 		// Without normalization, the expected range of the noise function is [-1, 1].
-
+		int idx = 0;
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
 			data.resize(p_width * p_height);
@@ -146,14 +189,11 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 			uint8_t *wd8 = data.ptrw();
 
 			uint8_t ivalue;
-			int idx = 0;
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					float value = (p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y));
-					ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
-					wd8[idx] = p_invert ? (255 - ivalue) : ivalue;
-					idx++;
-				}
+			for (int i = 0; i < p_width * p_height; i++) {
+				float value = values[idx];
+				ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
+				wd8[i] = p_invert ? (255 - ivalue) : ivalue;
+				idx++;
 			}
 
 			Ref<Image> img = memnew(Image(p_width, p_height, false, Image::FORMAT_L8, data));
@@ -290,6 +290,11 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	// Batched sampling, used when generating images. Implementations may override these
+	// to avoid per-sample overhead, and must be safe to call from several threads at once.
+	virtual void get_noise_2d_array(const Vector2 *p_points, int p_count, real_t *r_values) const;
+	virtual void get_noise_3d_array(const Vector3 *p_points, int p_count, real_t *r_values) const;
+
 	Vector<Ref<Image>> _get_image(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual TypedArray<Image> get_image_3d(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_normalize = true) const;
@@ -172,6 +172,30 @@ Ref<Image> NoiseTexture3D::_modulate_with_gradient(Ref<Image> p_image, Ref<Gradi
 	int w = p_image->get_width();
 	int h = p_image->get_height();
 
+	if (p_image->get_format() == Image::FORMAT_L8) {
+		// Noise images only have 256 possible values, so map each one through the gradient once.
+		Vector<uint8_t> levels;
+		levels.resize(256);
+		for (int i = 0; i < 256; i++) {
+			levels.write[i] = i;
+		}
+		Ref<Image> levels_image = memnew(Image(256, 1, false, Image::FORMAT_L8, levels));
+		Ref<Image> lut = Image::create_empty(256, 1, false, Image::FORMAT_RGBA8);
+		for (int i = 0; i < 256; i++) {
+			lut->set_pixel(i, 0, p_gradient->get_color_at_offset(levels_image->get_pixel(i, 0).get_luminance()));
+		}
+		const uint32_t *lut_ptr = (const uint32_t *)lut->ptr();
+
+		Vector<uint8_t> dest;
+		dest.resize(w * h * 4);
+		const uint8_t *src = p_image->ptr();
+		uint32_t *dst = (uint32_t *)dest.ptrw();
+		for (int i = 0; i < w * h; i++) {
+			dst[i] = lut_ptr[src[i]];
+		}
+		return memnew(Image(w, h, false, Image::FORMAT_RGBA8, dest));
+	}
+
 	Ref<Image> new_image = Image::create_empty(w, h, false, Image::FORMAT_RGBA8);
 
 	for (int row = 0; row < h; row++) {
@@ -587,6 +587,44 @@ const Vector<uint8_t> ref_img_1_data = { 0xff, 0xe6, 0xd2, 0xc2, 0xb7, 0xb4, 0xb
 const Vector<uint8_t> ref_img_2_data = { 0xff, 0xe6, 0xd2, 0xc2, 0xb7, 0xb4, 0xb4, 0xb7, 0xc2, 0xd2, 0xe6, 0xe6, 0xcb, 0xb4, 0xa1, 0x94, 0x90, 0x90, 0x94, 0xa1, 0xb4, 0xcb, 0xd2, 0xb4, 0x99, 0x82, 0x72, 0x6c, 0x6c, 0x72, 0x82, 0x99, 0xb4, 0xc2, 0xa1, 0x82, 0x65, 0x50, 0x48, 0x48, 0x50, 0x65, 0x82, 0xa1, 0xb7, 0x94, 0x72, 0x50, 0x32, 0x24, 0x24, 0x32, 0x50, 0x72, 0x94, 0xb4, 0x90, 0x6c, 0x48, 0x24, 0x0, 0x0, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0x90, 0x6c, 0x48, 0x24, 0x0, 0x0, 0x24, 0x48, 0x6c, 0x90, 0xb7, 0x94, 0x72, 0x50, 0x32, 0x24, 0x24, 0x33, 0x50, 0x72, 0x94, 0xc2, 0xa1, 0x82, 0x65, 0x50, 0x48, 0x48, 0x50, 0x66, 0x82, 0xa1, 0xd2, 0xb4, 0x99, 0x82, 0x72, 0x6c, 0x6c, 0x72, 0x82, 0x99, 0xb4, 0xe6, 0xcb, 0xb4, 0xa1, 0x94, 0x90, 0x90, 0x94, 0xa1, 0xb4, 0xcc };
 const Vector<uint8_t> ref_img_3_data = { 0xff, 0xe6, 0xd2, 0xc2, 0xb7, 0xb4, 0xb4, 0xb7, 0xc2, 0xd2, 0xe6, 0xe6, 0xcb, 0xb4, 0xa1, 0x94, 0x90, 0x90, 0x94, 0xa1, 0xb4, 0xcb, 0xd2, 0xb4, 0x99, 0x82, 0x72, 0x6c, 0x6c, 0x72, 0x82, 0x99, 0xb4, 0xc2, 0xa1, 0x82, 0x65, 0x50, 0x48, 0x48, 0x50, 0x65, 0x82, 0xa1, 0xb7, 0x94, 0x72, 0x50, 0x32, 0x24, 0x24, 0x32, 0x50, 0x72, 0x94, 0xb4, 0x90, 0x6c, 0x48, 0x24, 0x0, 0x0, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0x90, 0x6c, 0x48, 0x24, 0x0, 0x0, 0x24, 0x48, 0x6c, 0x90, 0xb7, 0x94, 0x72, 0x50, 0x32, 0x24, 0x24, 0x33, 0x50, 0x72, 0x94, 0xc2, 0xa1, 0x82, 0x65, 0x50, 0x48, 0x48, 0x50, 0x66, 0x82, 0xa1, 0xd2, 0xb4, 0x99, 0x82, 0x72, 0x6c, 0x6c, 0x72, 0x82, 0x99, 0xb4, 0xe6, 0xcb, 0xb4, 0xa1, 0x94, 0x90, 0x90, 0x94, 0xa1, 0xb4, 0xcc };
 
+TEST_CASE("[FastNoiseLite] Batched sampling matches single samples") {
+	FastNoiseLite noise;
+	noise.set_noise_type(FastNoiseLite::NoiseType::TYPE_SIMPLEX);
+	noise.set_offset(Vector3(3, 7, 11));
+
+	Vector2 points_2d[16];
+	Vector3 points_3d[16];
+	for (int i = 0; i < 16; i++) {
+		points_2d[i] = Vector2(i * 1.5, i * -0.5);
+		points_3d[i] = Vector3(i * 1.5, i * -0.5, i);
+	}
+
+	SUBCASE("Without domain warp") {
+		real_t values[16];
+		noise.get_noise_2d_array(points_2d, 16, values);
+		for (int i = 0; i < 16; i++) {
+			CHECK(values[i] == noise.get_noise_2dv(points_2d[i]));
+		}
+		noise.get_noise_3d_array(points_3d, 16, values);
+		for (int i = 0; i < 16; i++) {
+			CHECK(values[i] == noise.get_noise_3dv(points_3d[i]));
+		}
+	}
+
+	SUBCASE("With domain warp") {
+		noise.set_domain_warp_enabled(true);
+		real_t values[16];
+		noise.get_noise_2d_array(points_2d, 16, values);
+		for (int i = 0; i < 16; i++) {
+			CHECK(values[i] == noise.get_noise_2dv(points_2d[i]));
+		}
+		noise.get_noise_3d_array(points_3d, 16, values);
+		for (int i = 0; i < 16; i++) {
+			CHECK(values[i] == noise.get_noise_3dv(points_3d[i]));
+		}
+	}
+}
+
 // Utiliy function to compare two images pixel by pixel (for easy debugging of regressions)
 void compare_image_with_reference(const Ref<Image> &p_img, const Ref<Image> &p_reference_img) {
 	for (int y = 0; y < p_img->get_height(); y++) {
@@ -0,0 +1,64 @@
+/**************************************************************************/
+/*  openxr_fb_space_warp_extension.cpp                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "openxr_fb_space_warp_extension.h"
+
+#include "core/config/project_settings.h"
+#include "core/os/os.h"
+
+OpenXRFBSpaceWarpExtension *OpenXRFBSpaceWarpExtension::singleton = nullptr;
+
+OpenXRFBSpaceWarpExtension *OpenXRFBSpaceWarpExtension::get_singleton() {
+	return singleton;
+}
+
+OpenXRFBSpaceWarpExtension::OpenXRFBSpaceWarpExtension(const String &p_rendering_driver) {
+	singleton = this;
+	rendering_driver = p_rendering_driver;
+}
+
+OpenXRFBSpaceWarpExtension::~OpenXRFBSpaceWarpExtension() {
+	singleton = nullptr;
+}
+
+HashMap<String, bool *> OpenXRFBSpaceWarpExtension::get_requested_extensions() {
+	HashMap<String, bool *> request_extensions;
+
+	// Only our Forward+ renderer outputs motion vectors.
+	if (rendering_driver == "vulkan" && OS::get_singleton()->get_current_rendering_method() == "forward_plus" && GLOBAL_GET("xr/openxr/extensions/space_warp")) {
+		request_extensions[XR_FB_SPACE_WARP_EXTENSION_NAME] = &fb_space_warp_ext;
+	}
+
+	return request_extensions;
+}
+
+bool OpenXRFBSpaceWarpExtension::is_available() const {
+	return fb_space_warp_ext;
+}
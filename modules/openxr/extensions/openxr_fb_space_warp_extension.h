@@ -0,0 +1,62 @@
+/**************************************************************************/
+/*  openxr_fb_space_warp_extension.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef OPENXR_FB_SPACE_WARP_EXTENSION_H
+#define OPENXR_FB_SPACE_WARP_EXTENSION_H
+
+// This extension implements the FB Space Warp extension.
+// With this extension we submit motion vectors and depth with our projection views,
+// the runtime uses these to synthesize every other frame so we can render at half the display rate.
+// See: https://registry.khronos.org/OpenXR/specs/1.0/html/xrspec.html#XR_FB_space_warp
+
+// Note: This is only supported with the Forward+ renderer,
+// the other renderers do not output motion vectors.
+
+#include "openxr_extension_wrapper.h"
+
+class OpenXRFBSpaceWarpExtension : public OpenXRExtensionWrapper {
+public:
+	static OpenXRFBSpaceWarpExtension *get_singleton();
+
+	OpenXRFBSpaceWarpExtension(const String &p_rendering_driver);
+	virtual ~OpenXRFBSpaceWarpExtension() override;
+
+	virtual HashMap<String, bool *> get_requested_extensions() override;
+
+	bool is_available() const;
+
+private:
+	static OpenXRFBSpaceWarpExtension *singleton;
+
+	String rendering_driver;
+	bool fb_space_warp_ext = false;
+};
+
+#endif // OPENXR_FB_SPACE_WARP_EXTENSION_H
@@ -56,6 +56,7 @@
 #include "extensions/openxr_composition_layer_depth_extension.h"
 #include "extensions/openxr_fb_display_refresh_rate_extension.h"
 #include "extensions/openxr_fb_foveation_extension.h"
+#include "extensions/openxr_fb_space_warp_extension.h"
 #include "extensions/openxr_fb_update_swapchain_extension.h"
 #include "extensions/openxr_hand_tracking_extension.h"
 
@@ -935,11 +936,14 @@ bool OpenXRAPI::create_swapchains() {
 	projection_views = (XrCompositionLayerProjectionView *)memalloc(sizeof(XrCompositionLayerProjectionView) * view_count);
 	ERR_FAIL_NULL_V_MSG(projection_views, false, "OpenXR Couldn't allocate memory for projection views");
 
+	bool use_depth_layer = submit_depth_buffer && OpenXRCompositionLayerDepthExtension::get_singleton()->is_available();
+	bool use_space_warp = OpenXRFBSpaceWarpExtension::get_singleton()->is_available();
+
 	// We create our depth swapchain if:
 	// - we've enabled submitting depth buffer
 	// - we support our depth layer extension
-	// - we have our spacewarp extension (not yet implemented)
-	if (submit_depth_buffer && OpenXRCompositionLayerDepthExtension::get_singleton()->is_available()) {
+	// - we have our spacewarp extension
+	if (use_depth_layer || use_space_warp) {
 		// Build a vector with swapchain formats we want to use, from best fit to worst
 		Vector<int64_t> usable_swapchain_formats;
 		int64_t swapchain_format_to_use = 0;
@@ -955,6 +959,8 @@ bool OpenXRAPI::create_swapchains() {
 
 		if (swapchain_format_to_use == 0) {
 			print_line("Couldn't find usable depth swap chain format, depth buffer will not be submitted.");
+			use_depth_layer = false;
+			use_space_warp = false;
 		} else {
 			print_verbose(String("Using depth swap chain format:") + get_swapchain_format_name(swapchain_format_to_use));
 
@@ -964,15 +970,43 @@ bool OpenXRAPI::create_swapchains() {
 				return false;
 			}
 
-			depth_views = (XrCompositionLayerDepthInfoKHR *)memalloc(sizeof(XrCompositionLayerDepthInfoKHR) * view_count);
-			ERR_FAIL_NULL_V_MSG(depth_views, false, "OpenXR Couldn't allocate memory for depth views");
+			if (use_depth_layer) {
+				depth_views = (XrCompositionLayerDepthInfoKHR *)memalloc(sizeof(XrCompositionLayerDepthInfoKHR) * view_count);
+				ERR_FAIL_NULL_V_MSG(depth_views, false, "OpenXR Couldn't allocate memory for depth views");
+			}
 		}
 	}
 
 	// We create our velocity swapchain if:
-	// - we have our spacewarp extension (not yet implemented)
-	{
-		// TBD
+	// - we have our spacewarp extension
+	if (use_space_warp) {
+		// Build a vector with swapchain formats we want to use, from best fit to worst
+		Vector<int64_t> usable_swapchain_formats;
+		int64_t swapchain_format_to_use = 0;
+
+		graphics_extension->get_usable_motion_vector_formats(usable_swapchain_formats);
+
+		// now find out which one is supported
+		for (int i = 0; i < usable_swapchain_formats.size() && swapchain_format_to_use == 0; i++) {
+			if (is_swapchain_format_supported(usable_swapchain_formats[i])) {
+				swapchain_format_to_use = usable_swapchain_formats[i];
+			}
+		}
+
+		if (swapchain_format_to_use == 0) {
+			print_line("Couldn't find usable motion vector swap chain format, space warp will not be used.");
+		} else {
+			print_verbose(String("Using motion vector swap chain format:") + get_swapchain_format_name(swapchain_format_to_use));
+
+			// Note, we render our motion vectors at our render target size as they are rendered in the same pass as our color,
+			// the runtime recommends a lower resolution but accepts any size.
+			if (!create_swapchain(XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT, swapchain_format_to_use, recommended_size.width, recommended_size.height, sample_count, view_count, swapchains[OPENXR_SWAPCHAIN_VELOCITY].swapchain, &swapchains[OPENXR_SWAPCHAIN_VELOCITY].swapchain_graphics_data)) {
+				return false;
+			}
+
+			space_warp_views = (XrCompositionLayerSpaceWarpInfoFB *)memalloc(sizeof(XrCompositionLayerSpaceWarpInfoFB) * view_count);
+			ERR_FAIL_NULL_V_MSG(space_warp_views, false, "OpenXR Couldn't allocate memory for space warp views");
+		}
 	}
 
 	for (uint32_t i = 0; i < view_count; i++) {
@@ -988,7 +1022,7 @@ bool OpenXRAPI::create_swapchains() {
 		projection_views[i].subImage.imageRect.extent.width = recommended_size.width;
 		projection_views[i].subImage.imageRect.extent.height = recommended_size.height;
 
-		if (submit_depth_buffer && OpenXRCompositionLayerDepthExtension::get_singleton()->is_available() && depth_views) {
+		if (depth_views) {
 			projection_views[i].next = &depth_views[i];
 
 			depth_views[i].type = XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR;
@@ -1004,6 +1038,37 @@ bool OpenXRAPI::create_swapchains() {
 			depth_views[i].nearZ = 0.01; // Near and far Z will be set to the correct values in fill_projection_matrix
 			depth_views[i].farZ = 100.0;
 		}
+
+		if (space_warp_views) {
+			// Chain after our depth info if we submit that as well.
+			if (depth_views) {
+				depth_views[i].next = &space_warp_views[i];
+			} else {
+				projection_views[i].next = &space_warp_views[i];
+			}
+
+			space_warp_views[i].type = XR_TYPE_COMPOSITION_LAYER_SPACE_WARP_INFO_FB;
+			space_warp_views[i].next = nullptr;
+			space_warp_views[i].layerFlags = 0;
+			space_warp_views[i].motionVectorSubImage.swapchain = swapchains[OPENXR_SWAPCHAIN_VELOCITY].swapchain;
+			space_warp_views[i].motionVectorSubImage.imageArrayIndex = i;
+			space_warp_views[i].motionVectorSubImage.imageRect.offset.x = 0;
+			space_warp_views[i].motionVectorSubImage.imageRect.offset.y = 0;
+			space_warp_views[i].motionVectorSubImage.imageRect.extent.width = recommended_size.width;
+			space_warp_views[i].motionVectorSubImage.imageRect.extent.height = recommended_size.height;
+			// Our play space does not move between frames, movement of our XROrigin node is not reported to the runtime.
+			space_warp_views[i].appSpaceDeltaPose = { { 0.0, 0.0, 0.0, 1.0 }, { 0.0, 0.0, 0.0 } };
+			space_warp_views[i].depthSubImage.swapchain = swapchains[OPENXR_SWAPCHAIN_DEPTH].swapchain;
+			space_warp_views[i].depthSubImage.imageArrayIndex = i;
+			space_warp_views[i].depthSubImage.imageRect.offset.x = 0;
+			space_warp_views[i].depthSubImage.imageRect.offset.y = 0;
+			space_warp_views[i].depthSubImage.imageRect.extent.width = recommended_size.width;
+			space_warp_views[i].depthSubImage.imageRect.extent.height = recommended_size.height;
+			space_warp_views[i].minDepth = 0.0;
+			space_warp_views[i].maxDepth = 1.0;
+			space_warp_views[i].nearZ = 0.01; // Near and far Z will be set to the correct values in fill_projection_matrix
+			space_warp_views[i].farZ = 100.0;
+		}
 	};
 
 	return true;
@@ -1033,6 +1098,11 @@ void OpenXRAPI::destroy_session() {
 		depth_views = nullptr;
 	}
 
+	if (space_warp_views != nullptr) {
+		memfree(space_warp_views);
+		space_warp_views = nullptr;
+	}
+
 	for (int i = 0; i < OPENXR_SWAPCHAIN_MAX; i++) {
 		if (swapchains[i].swapchain != XR_NULL_HANDLE) {
 			xrDestroySwapchain(swapchains[i].swapchain);
@@ -1424,6 +1494,7 @@ bool OpenXRAPI::initialize(const String &p_rendering_driver) {
 	// Also register our rendering extensions
 	register_extension_wrapper(memnew(OpenXRFBUpdateSwapchainExtension(p_rendering_driver)));
 	register_extension_wrapper(memnew(OpenXRFBFoveationExtension(p_rendering_driver)));
+	register_extension_wrapper(memnew(OpenXRFBSpaceWarpExtension(p_rendering_driver)));
 
 	// initialize
 	for (OpenXRExtensionWrapper *wrapper : registered_extension_wrappers) {
@@ -1663,6 +1734,14 @@ bool OpenXRAPI::get_view_projection(uint32_t p_view, double p_z_near, double p_z
 		}
 	}
 
+	// and the same for our space warp views
+	if (space_warp_views != nullptr) {
+		for (uint32_t i = 0; i < view_count; i++) {
+			space_warp_views[i].nearZ = p_z_near;
+			space_warp_views[i].farZ = p_z_far;
+		}
+	}
+
 	// now update our projection
 	return graphics_extension->create_projection_fov(views[p_view].fov, p_z_near, p_z_far, p_camera_matrix);
 }
@@ -2012,13 +2091,22 @@ RID OpenXRAPI::get_color_texture() {
 
 RID OpenXRAPI::get_depth_texture() {
 	// Note, image will not be acquired if we didn't have a suitable swap chain format.
-	if (submit_depth_buffer && swapchains[OPENXR_SWAPCHAIN_DEPTH].image_acquired) {
+	if ((depth_views || space_warp_views) && swapchains[OPENXR_SWAPCHAIN_DEPTH].image_acquired) {
 		return graphics_extension->get_texture(swapchains[OPENXR_SWAPCHAIN_DEPTH].swapchain_graphics_data, swapchains[OPENXR_SWAPCHAIN_DEPTH].image_index);
 	} else {
 		return RID();
 	}
 }
 
+RID OpenXRAPI::get_velocity_texture() {
+	// Note, image will not be acquired if we didn't have a suitable swap chain format.
+	if (space_warp_views && swapchains[OPENXR_SWAPCHAIN_VELOCITY].image_acquired) {
+		return graphics_extension->get_texture(swapchains[OPENXR_SWAPCHAIN_VELOCITY].swapchain_graphics_data, swapchains[OPENXR_SWAPCHAIN_VELOCITY].image_index);
+	} else {
+		return RID();
+	}
+}
+
 void OpenXRAPI::post_draw_viewport(RID p_render_target) {
 	if (!can_render()) {
 		return;
@@ -129,11 +129,12 @@ private:
 	XrView *views = nullptr;
 	XrCompositionLayerProjectionView *projection_views = nullptr;
 	XrCompositionLayerDepthInfoKHR *depth_views = nullptr; // Only used by Composition Layer Depth Extension if available
+	XrCompositionLayerSpaceWarpInfoFB *space_warp_views = nullptr; // Only used by FB Space Warp Extension if available
 
 	enum OpenXRSwapChainTypes {
 		OPENXR_SWAPCHAIN_COLOR,
 		OPENXR_SWAPCHAIN_DEPTH,
-		// OPENXR_SWAPCHAIN_VELOCITY,
+		OPENXR_SWAPCHAIN_VELOCITY,
 		OPENXR_SWAPCHAIN_MAX
 	};
 
@@ -372,6 +373,7 @@ public:
 	XrSwapchain get_color_swapchain();
 	RID get_color_texture();
 	RID get_depth_texture();
+	RID get_velocity_texture();
 	void post_draw_viewport(RID p_render_target);
 	void end_frame();
 
@@ -152,6 +152,7 @@ public:
 
 	virtual RID get_color_texture() override;
 	virtual RID get_depth_texture() override;
+	virtual RID get_velocity_texture() override;
 
 	virtual void process() override;
 	virtual void pre_render() override;
@@ -5967,17 +5967,59 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 		hb_buffer_set_language(p_sd->hb_buffer, lang);
 	}
 
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
-
 	Vector<hb_feature_t> ftrs;
 	_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
-
-	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+	// HarfBuzz only looks at a few characters of context on each side of the run.
+	const int64_t context_length = 5;
+	int64_t context_start = MAX(0, p_start - context_length);
+	int64_t context_end = MIN(p_sd->text.length(), p_end + context_length);
+
+	ShapedRunKey run_key;
+	run_key.text = p_sd->text.substr(context_start, context_end - context_start);
+	run_key.start = p_start - context_start;
+	run_key.length = p_end - p_start;
+	run_key.direction = p_direction;
+	run_key.script = p_script;
+	run_key.language = hb_buffer_get_language(p_sd->hb_buffer);
+	run_key.flags = flags;
+	run_key.features = ftrs;
+
+	HashMap<ShapedRunKey, ShapedRunGlyphs, ShapedRunKeyHasher> &shaped_runs = fd->cache[fss]->shaped_runs;
+	ShapedRunGlyphs *run = shaped_runs.getptr(run_key);
+	if (!run) {
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		unsigned int count = 0;
+		const hb_glyph_info_t *info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &count);
+		const hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &count);
+
+		if (shaped_runs.size() >= SHAPED_RUN_CACHE_SIZE) {
+			shaped_runs.clear();
+		}
+		run = &shaped_runs.insert(run_key, ShapedRunGlyphs())->value;
+		run->info.resize(count);
+		run->pos.resize(count);
+		hb_glyph_info_t *info_w = run->info.ptrw();
+		hb_glyph_position_t *pos_w = run->pos.ptrw();
+		for (unsigned int i = 0; i < count; i++) {
+			info_w[i] = info[i];
+			info_w[i].cluster -= p_start;
+			pos_w[i] = pos[i];
+		}
+	}
+
+	// Keep references to the cached arrays, fallback shaping below may evict the entry.
+	unsigned int glyph_count = run->info.size();
+	Vector<hb_glyph_info_t> run_info = run->info;
+	Vector<hb_glyph_position_t> run_pos = run->pos;
+	hb_glyph_info_t *glyph_info = run_info.ptrw();
+	for (unsigned int i = 0; i < glyph_count; i++) {
+		glyph_info[i].cluster += p_start;
+	}
+	const hb_glyph_position_t *glyph_pos = run_pos.ptr();
 
 	int mod = 0;
 	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
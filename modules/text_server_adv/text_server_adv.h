@@ -260,6 +260,56 @@ class TextServerAdvanced : public TextServerExtension {
 		Vector2 advance;
 	};
 
+	// HarfBuzz output for a single run, cached per font size so identical text is not shaped again.
+	struct ShapedRunKey {
+		String text; // The run, including the surrounding context HarfBuzz looks at.
+		int32_t start = 0; // Run offset inside `text`.
+		int32_t length = 0;
+		hb_direction_t direction = HB_DIRECTION_INVALID;
+		hb_script_t script = HB_SCRIPT_INVALID;
+		hb_language_t language = HB_LANGUAGE_INVALID;
+		int flags = 0;
+		Vector<hb_feature_t> features;
+
+		bool operator==(const ShapedRunKey &p_b) const {
+			if (start != p_b.start || length != p_b.length || direction != p_b.direction || script != p_b.script || language != p_b.language || flags != p_b.flags || features.size() != p_b.features.size() || text != p_b.text) {
+				return false;
+			}
+			for (int i = 0; i < features.size(); i++) {
+				const hb_feature_t &a = features[i];
+				const hb_feature_t &b = p_b.features[i];
+				if (a.tag != b.tag || a.value != b.value || a.start != b.start || a.end != b.end) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	struct ShapedRunKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapedRunKey &p_a) {
+			uint32_t hash = p_a.text.hash();
+			hash = hash_murmur3_one_32(p_a.start, hash);
+			hash = hash_murmur3_one_32(p_a.length, hash);
+			hash = hash_murmur3_one_32(p_a.direction, hash);
+			hash = hash_murmur3_one_32(p_a.script, hash);
+			hash = hash_murmur3_one_64((uint64_t)(uintptr_t)p_a.language, hash);
+			hash = hash_murmur3_one_32(p_a.flags, hash);
+			for (const hb_feature_t &ftr : p_a.features) {
+				hash = hash_murmur3_one_32(ftr.tag, hash);
+				hash = hash_murmur3_one_32(ftr.value, hash);
+			}
+			return hash_fmix32(hash);
+		}
+	};
+
+	static const uint32_t SHAPED_RUN_CACHE_SIZE = 4096; // Per font size, the cache is flushed when full.
+
+	struct ShapedRunGlyphs {
+		Vector<hb_glyph_info_t> info; // Clusters are relative to the run start.
+		Vector<hb_glyph_position_t> pos;
+	};
+
 	struct FontForSizeAdvanced {
 		double ascent = 0.0;
 		double descent = 0.0;
@@ -275,6 +325,7 @@ class TextServerAdvanced : public TextServerExtension {
 		HashMap<int32_t, FontGlyph> glyph_map;
 		HashMap<Vector2i, Vector2> kerning_map;
 		hb_font_t *hb_handle = nullptr;
+		HashMap<ShapedRunKey, ShapedRunGlyphs, ShapedRunKeyHasher> shaped_runs;
 
 #ifdef MODULE_FREETYPE_ENABLED
 		FT_Face face = nullptr;
@@ -31,7 +31,6 @@
 #include "video_stream_theora.h"
 
 #include "core/config/project_settings.h"
-#include "core/os/os.h"
 #include "scene/resources/image_texture.h"
 
 #ifdef _MSC_VER
@@ -48,31 +47,9 @@
 int VideoStreamPlaybackTheora::buffer_data() {
 	char *buffer = ogg_sync_buffer(&oy, 4096);
 
-#ifdef THEORA_USE_THREAD_STREAMING
-
-	int read;
-
-	do {
-		thread_sem->post();
-		read = MIN(ring_buffer.data_left(), 4096);
-		if (read) {
-			ring_buffer.read((uint8_t *)buffer, read);
-			ogg_sync_wrote(&oy, read);
-		} else {
-			OS::get_singleton()->delay_usec(100);
-		}
-
-	} while (read == 0);
-
-	return read;
-
-#else
-
 	uint64_t bytes = file->get_buffer((uint8_t *)buffer, 4096);
 	ogg_sync_wrote(&oy, bytes);
 	return (bytes);
-
-#endif
 }
 
 int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
@@ -91,14 +68,15 @@ int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
 	return 0;
 }
 
-void VideoStreamPlaybackTheora::video_write() {
+// Called from the decoder thread.
+void VideoStreamPlaybackTheora::video_write(Vector<uint8_t> &r_data) {
 	th_ycbcr_buffer yuv;
 	th_decode_ycbcr_out(td, yuv);
 
 	int pitch = 4;
-	frame_data.resize(size.x * size.y * pitch);
+	r_data.resize(size.x * size.y * pitch);
 	{
-		uint8_t *w = frame_data.ptrw();
+		uint8_t *w = r_data.ptrw();
 		char *dst = (char *)w;
 
 		if (px_fmt == TH_PF_444) {
@@ -110,15 +88,187 @@ void VideoStreamPlaybackTheora::video_write() {
 		} else if (px_fmt == TH_PF_420) {
 			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
 		}
+	}
+}
+
+// Called from the decoder thread.
+VideoStreamPlaybackTheora::DecodeResult VideoStreamPlaybackTheora::_decode_audio() {
+	// Stay a bit ahead of the newest video frame, the rest waits in the ogg stream.
+	const double AUDIO_LEAD = 0.5;
+	if (theora_p && !theora_eos && audio_frames_decoded / double(vi.rate) > newest_video_time + AUDIO_LEAD) {
+		return DECODE_BLOCKED;
+	}
+
+	float **pcm;
+	int ret = vorbis_synthesis_pcmout(&vd, &pcm);
+	if (ret > 0) {
+		const int AUXBUF_LEN = 4096;
+		float aux_buffer[AUXBUF_LEN];
+		int written = 0;
+
+		MutexLock lock(audio_mutex);
+		int to_write = MIN(ret, audio_buffer.space_left() / vi.channels);
+		while (written < to_write) {
+			int m = MIN(AUXBUF_LEN / vi.channels, to_write - written);
+			int count = 0;
+			for (int j = 0; j < m; j++) {
+				for (int i = 0; i < vi.channels; i++) {
+					aux_buffer[count++] = pcm[i][written + j];
+				}
+			}
+			audio_buffer.write(aux_buffer, count);
+			written += m;
+		}
+
+		if (written == 0) {
+			return DECODE_BLOCKED; // Mix buffer is full.
+		}
+		vorbis_synthesis_read(&vd, written);
+		audio_frames_decoded += written;
+		return DECODE_PROGRESS;
+	}
+
+	/* no pending audio; is there a pending packet to decode? */
+	ogg_packet op;
+	if (ogg_stream_packetout(&vo, &op) > 0) {
+		if (vorbis_synthesis(&vb, &op) == 0) { /* test for success! */
+			vorbis_synthesis_blockin(&vd, &vb);
+		}
+		return DECODE_PROGRESS;
+	}
+
+	return vorbis_eos ? DECODE_DONE : DECODE_NEED_DATA;
+}
+
+// Called from the decoder thread.
+VideoStreamPlaybackTheora::DecodeResult VideoStreamPlaybackTheora::_decode_video() {
+	int write_index;
+	bool queue_empty;
+	{
+		MutexLock lock(frame_mutex);
+		if (frames_queued == MAX_FRAMES) {
+			return DECODE_BLOCKED;
+		}
+		write_index = (frame_read + frames_queued) % MAX_FRAMES;
+		queue_empty = frames_queued == 0;
+	}
+
+	/* theora is one in, one out... */
+	ogg_packet op;
+	if (ogg_stream_packetout(&to, &op) <= 0) {
+		return theora_eos ? DECODE_DONE : DECODE_NEED_DATA;
+	}
+
+	/*HACK: This should be set after a seek or a gap, but we might not have
+	a granulepos for the first packet (we only have them for the last
+	packet on a page), so we just set it as often as we get it.
+	To do this right, we should back-track from the last packet on the
+	page and compute the correct granulepos for the first packet after
+	a seek or a gap.*/
+	if (op.granulepos >= 0) {
+		th_decode_ctl(td, TH_DECCTL_SET_GRANPOS, &op.granulepos, sizeof(op.granulepos));
+	}
+
+	ogg_int64_t videobuf_granulepos;
+	if (th_decode_packetin(td, &op, &videobuf_granulepos) == 0) {
+		double frame_time = th_granule_time(td, videobuf_granulepos);
+		newest_video_time = frame_time;
+
+		// Frames that are already late still have to be decoded because of keyframing,
+		// but converting them is wasted work unless there is nothing else to show.
+		if (!queue_empty && frame_time < playback_usec.get() / 1000000.0) {
+			return DECODE_PROGRESS;
+		}
+
+		Frame &frame = frames[write_index];
+		video_write(frame.data);
+		frame.time = frame_time;
+
+		MutexLock lock(frame_mutex);
+		frames_queued++;
+	}
+
+	return DECODE_PROGRESS;
+}
 
-		format = Image::FORMAT_RGBA8;
+bool VideoStreamPlaybackTheora::_decode_step() {
+	if (decode_eof.is_set()) {
+		return false;
 	}
 
-	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
+	// Audio first, so it is ready by the time its frame shows.
+	DecodeResult audio = vorbis_p ? _decode_audio() : DECODE_DONE;
+	DecodeResult video = theora_p ? _decode_video() : DECODE_DONE;
 
-	texture->update(img); //zero copy send to rendering server
+	if (audio == DECODE_PROGRESS || video == DECODE_PROGRESS) {
+		return true;
+	}
 
-	frames_pending = 1;
+	if (audio == DECODE_NEED_DATA || video == DECODE_NEED_DATA) {
+		if (ogg_sync_pageout(&oy, &og) > 0) {
+			queue_page(&og); /* demux into the appropriate stream */
+			return true;
+		}
+		if (buffer_data() > 0) {
+			return true;
+		}
+		// The file ended before the streams did, nothing more will arrive.
+		decode_eof.set();
+		return false;
+	}
+
+	if (audio == DECODE_DONE && video == DECODE_DONE) {
+		decode_eof.set();
+	}
+	return false;
+}
+
+void VideoStreamPlaybackTheora::_decode_thread(void *p_ud) {
+	VideoStreamPlaybackTheora *vs = static_cast<VideoStreamPlaybackTheora *>(p_ud);
+
+	while (!vs->decode_exit.is_set()) {
+		if (!vs->_decode_step()) {
+			// Queues are full or the stream is over, wait until update() consumes something.
+			vs->decode_sem.wait();
+		}
+	}
+}
+
+void VideoStreamPlaybackTheora::_start_decoder() {
+	decode_exit.clear();
+	decode_eof.clear();
+#ifdef THREADS_ENABLED
+	decode_thread.start(_decode_thread, this);
+#endif
+}
+
+void VideoStreamPlaybackTheora::_stop_decoder() {
+	if (decode_thread.is_started()) {
+		decode_exit.set();
+		decode_sem.post();
+		decode_thread.wait_to_finish();
+	}
+}
+
+void VideoStreamPlaybackTheora::_mix_decoded_audio() {
+	const int AUXBUF_LEN = 4096;
+	float aux_buffer[AUXBUF_LEN];
+
+	MutexLock lock(audio_mutex);
+	if (!mix_callback) {
+		audio_buffer.clear(); // Nobody listens, just pretend we sent the audio.
+		return;
+	}
+
+	while (audio_buffer.data_left() >= vi.channels) {
+		int m = MIN(AUXBUF_LEN / vi.channels, audio_buffer.data_left() / vi.channels);
+		audio_buffer.copy(aux_buffer, 0, m * vi.channels);
+		int mixed = mix_callback(mix_udata, aux_buffer, m);
+		audio_buffer.advance_read(mixed * vi.channels);
+		if (mixed != m) { //could mix no more
+			break;
+		}
+	}
 }
 
 void VideoStreamPlaybackTheora::clear() {
@@ -126,6 +276,9 @@ void VideoStreamPlaybackTheora::clear() {
 		return;
 	}
 
+	// The decoder owns the codec state, it has to be gone before tearing that down.
+	_stop_decoder();
+
 	if (vorbis_p) {
 		ogg_stream_clear(&vo);
 		if (vorbis_p >= 3) {
@@ -145,17 +298,17 @@ void VideoStreamPlaybackTheora::clear() {
 	}
 	ogg_sync_clear(&oy);
 
-#ifdef THEORA_USE_THREAD_STREAMING
-	thread_exit = true;
-	thread_sem->post(); //just in case
-	thread.wait_to_finish();
-	ring_buffer.clear();
-#endif
+	for (int i = 0; i < MAX_FRAMES; i++) {
+		frames[i].data.clear();
+	}
+	frame_read = 0;
+	frames_queued = 0;
+	audio_buffer.clear();
+	audio_frames_decoded = 0;
+	newest_video_time = 0;
 
 	theora_p = 0;
 	vorbis_p = 0;
-	videobuf_ready = 0;
-	frames_pending = 0;
 	videobuf_time = 0;
 	theora_eos = false;
 	vorbis_eos = false;
@@ -173,17 +326,6 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 	file = FileAccess::open(p_file, FileAccess::READ);
 	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_file + "'.");
 
-#ifdef THEORA_USE_THREAD_STREAMING
-	thread_exit = false;
-	thread_eof = false;
-	//pre-fill buffer
-	int to_read = ring_buffer.space_left();
-	uint64_t read = file->get_buffer(read_buffer.ptr(), to_read);
-	ring_buffer.write(read_buffer.ptr(), read);
-
-	thread.start(_streaming_thread, this);
-#endif
-
 	ogg_sync_init(&oy);
 
 	/* init supporting Vorbis structures needed in header parsing */
@@ -334,7 +476,6 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 				sizeof(pp_level_max));
 		pp_level = 0;
 		th_decode_ctl(td, TH_DECCTL_SET_PPLEVEL, &pp_level, sizeof(pp_level));
-		pp_inc = 0;
 
 		int w;
 		int h;
@@ -357,7 +498,8 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 	if (vorbis_p) {
 		vorbis_synthesis_init(&vd, &vi);
 		vorbis_block_init(&vd, &vb);
-		//_setup(vi.channels, vi.rate);
+		// About a second of audio can be decoded ahead of playback.
+		audio_buffer.resize(nearest_shift(vi.rate * vi.channels));
 	} else {
 		/* tear down the partial vorbis setup */
 		vorbis_info_clear(&vi);
@@ -365,9 +507,11 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 	}
 
 	playing = false;
-	buffering = true;
 	time = 0;
-	audio_frames_wrote = 0;
+	playback_usec.set(0);
+
+	// Start decoding right away, so the first frames are ready when play() is called.
+	_start_decoder();
 }
 
 double VideoStreamPlaybackTheora::get_time() const {
@@ -391,161 +535,61 @@ void VideoStreamPlaybackTheora::update(double p_delta) {
 		return;
 	}
 
-#ifdef THEORA_USE_THREAD_STREAMING
-	thread_sem->post();
-#endif
-
 	time += p_delta;
+	playback_usec.set(uint64_t(MAX(0.0, get_time()) * 1000000.0));
 
-	if (videobuf_time > get_time()) {
-		return; //no new frames need to be produced
+	if (!decode_thread.is_started()) {
+		// No threads available, decode until the queues are full.
+		while (_decode_step()) {
+		}
 	}
 
-	bool frame_done = false;
-	bool audio_done = !vorbis_p;
-
-	while (!frame_done || (!audio_done && !vorbis_eos)) {
-		//a frame needs to be produced
-
-		ogg_packet op;
-		bool no_theora = false;
-		bool buffer_full = false;
-
-		while (vorbis_p && !audio_done && !buffer_full) {
-			int ret;
-			float **pcm;
-
-			/* if there's pending, decoded audio, grab it */
-			ret = vorbis_synthesis_pcmout(&vd, &pcm);
-			if (ret > 0) {
-				const int AUXBUF_LEN = 4096;
-				int to_read = ret;
-				float aux_buffer[AUXBUF_LEN];
-
-				while (to_read) {
-					int m = MIN(AUXBUF_LEN / vi.channels, to_read);
-
-					int count = 0;
-
-					for (int j = 0; j < m; j++) {
-						for (int i = 0; i < vi.channels; i++) {
-							aux_buffer[count++] = pcm[i][j];
-						}
-					}
-
-					if (mix_callback) {
-						int mixed = mix_callback(mix_udata, aux_buffer, m);
-						to_read -= mixed;
-						if (mixed != m) { //could mix no more
-							buffer_full = true;
-							break;
-						}
-					} else {
-						to_read -= m; //just pretend we sent the audio
-					}
-				}
-
-				vorbis_synthesis_read(&vd, ret - to_read);
-
-				audio_frames_wrote += ret - to_read;
-
-			} else {
-				/* no pending audio; is there a pending packet to decode? */
-				if (ogg_stream_packetout(&vo, &op) > 0) {
-					if (vorbis_synthesis(&vb, &op) == 0) { /* test for success! */
-						vorbis_synthesis_blockin(&vd, &vb);
-					}
-				} else { /* we need more data; break out to suck in another page */
-					break;
-				}
-			}
-
-			audio_done = videobuf_time < (audio_frames_wrote / float(vi.rate));
+	if (vorbis_p) {
+		_mix_decoded_audio();
+	}
 
-			if (buffer_full) {
-				break;
-			}
+	Vector<uint8_t> frame_data;
+	bool frame_ready = false;
+	bool queue_empty = false;
+	if (videobuf_time <= get_time()) { // Otherwise no new frames need to be shown yet.
+		MutexLock lock(frame_mutex);
+		// Skip frames that are already late, unless that leaves nothing to show.
+		while (frames_queued > 1 && frames[frame_read].time < get_time()) {
+			frames[frame_read].data = Vector<uint8_t>();
+			frame_read = (frame_read + 1) % MAX_FRAMES;
+			frames_queued--;
+		}
+		if (frames_queued > 0) {
+			frame_data = frames[frame_read].data;
+			videobuf_time = frames[frame_read].time;
+			frames[frame_read].data = Vector<uint8_t>();
+			frame_read = (frame_read + 1) % MAX_FRAMES;
+			frames_queued--;
+			frame_ready = true;
 		}
+		queue_empty = frames_queued == 0;
+	}
 
-		while (theora_p && !frame_done) {
-			/* theora is one in, one out... */
-			if (ogg_stream_packetout(&to, &op) > 0) {
-				/*HACK: This should be set after a seek or a gap, but we might not have
-				a granulepos for the first packet (we only have them for the last
-				packet on a page), so we just set it as often as we get it.
-				To do this right, we should back-track from the last packet on the
-				page and compute the correct granulepos for the first packet after
-				a seek or a gap.*/
-				if (op.granulepos >= 0) {
-					th_decode_ctl(td, TH_DECCTL_SET_GRANPOS, &op.granulepos,
-							sizeof(op.granulepos));
-				}
-				ogg_int64_t videobuf_granulepos;
-				if (th_decode_packetin(td, &op, &videobuf_granulepos) == 0) {
-					videobuf_time = th_granule_time(td, videobuf_granulepos);
-
-					//printf("frame time %f, play time %f, ready %i\n", (float)videobuf_time, get_time(), videobuf_ready);
-
-					/* is it already too old to be useful? This is only actually
-					 useful cosmetically after a SIGSTOP. Note that we have to
-					 decode the frame even if we don't show it (for now) due to
-					 keyframing. Soon enough libtheora will be able to deal
-					 with non-keyframe seeks.  */
-
-					if (videobuf_time >= get_time()) {
-						frame_done = true;
-					} else {
-						/*If we are too slow, reduce the pp level.*/
-						pp_inc = pp_level > 0 ? -1 : 0;
-					}
-				}
+	// Let the decoder refill the queues.
+	decode_sem.post();
 
-			} else {
-				no_theora = true;
-				break;
-			}
-		}
+	if (frame_ready) {
+		Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
+		texture->update(img); //zero copy send to rendering server
+	}
 
-#ifdef THEORA_USE_THREAD_STREAMING
-		if (file.is_valid() && thread_eof && no_theora && theora_eos && ring_buffer.data_left() == 0) {
-#else
-		if (file.is_valid() && /*!videobuf_ready && */ no_theora && theora_eos) {
-#endif
+	if (decode_eof.is_set() && queue_empty && !frame_ready) {
+		bool audio_pending = false;
+		{
+			MutexLock lock(audio_mutex);
+			audio_pending = mix_callback && audio_buffer.data_left() > 0;
+		}
+		if (!audio_pending) {
 			//printf("video done, stopping\n");
 			stop();
 			return;
 		}
-
-		if (!frame_done || !audio_done) {
-			//what's the point of waiting for audio to grab a page?
-
-			buffer_data();
-			while (ogg_sync_pageout(&oy, &og) > 0) {
-				queue_page(&og);
-			}
-		}
-
-		/* If playback has begun, top audio buffer off immediately. */
-		//if(stateflag) audio_write_nonblocking();
-
-		/* are we at or past time for this video frame? */
-		if (videobuf_ready && videobuf_time <= get_time()) {
-			//video_write();
-			//videobuf_ready=0;
-		} else {
-			//printf("frame at %f not ready (time %f), ready %i\n", (float)videobuf_time, get_time(), videobuf_ready);
-		}
-
-		double tdiff = videobuf_time - get_time();
-		/*If we have lots of extra time, increase the post-processing level.*/
-		if (tdiff > ti.fps_denominator * 0.25 / ti.fps_numerator) {
-			pp_inc = pp_level < pp_level_max ? 1 : 0;
-		} else if (tdiff < ti.fps_denominator * 0.05 / ti.fps_numerator) {
-			pp_inc = pp_level > 0 ? -1 : 0;
-		}
 	}
-
-	video_write();
 }
 
 void VideoStreamPlaybackTheora::play() {
@@ -605,44 +649,11 @@ int VideoStreamPlaybackTheora::get_mix_rate() const {
 	return vi.rate;
 }
 
-#ifdef THEORA_USE_THREAD_STREAMING
-
-void VideoStreamPlaybackTheora::_streaming_thread(void *ud) {
-	VideoStreamPlaybackTheora *vs = static_cast<VideoStreamPlaybackTheora *>(ud);
-
-	while (!vs->thread_exit) {
-		//just fill back the buffer
-		if (!vs->thread_eof) {
-			int to_read = vs->ring_buffer.space_left();
-			if (to_read > 0) {
-				uint64_t read = vs->file->get_buffer(vs->read_buffer.ptr(), to_read);
-				vs->ring_buffer.write(vs->read_buffer.ptr(), read);
-				vs->thread_eof = vs->file->eof_reached();
-			}
-		}
-
-		vs->thread_sem->wait();
-	}
-}
-
-#endif
-
 VideoStreamPlaybackTheora::VideoStreamPlaybackTheora() {
 	texture = Ref<ImageTexture>(memnew(ImageTexture));
-
-#ifdef THEORA_USE_THREAD_STREAMING
-	int rb_power = nearest_shift(RB_SIZE_KB * 1024);
-	ring_buffer.resize(rb_power);
-	read_buffer.resize(RB_SIZE_KB * 1024);
-	thread_sem = Semaphore::create();
-
-#endif
 }
 
 VideoStreamPlaybackTheora::~VideoStreamPlaybackTheora() {
-#ifdef THEORA_USE_THREAD_STREAMING
-	memdelete(thread_sem);
-#endif
 	clear();
 };
 
@@ -33,6 +33,7 @@
 
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
+#include "core/os/mutex.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
 #include "core/templates/ring_buffer.h"
@@ -45,8 +46,6 @@
 
 class ImageTexture;
 
-//#define THEORA_USE_THREAD_STREAMING
-
 class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	GDCLASS(VideoStreamPlaybackTheora, VideoStreamPlayback);
 
@@ -54,20 +53,54 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 		MAX_FRAMES = 4,
 	};
 
-	//Image frames[MAX_FRAMES];
-	Image::Format format = Image::Format::FORMAT_L8;
-	Vector<uint8_t> frame_data;
-	int frames_pending = 0;
+	enum DecodeResult {
+		DECODE_PROGRESS,
+		DECODE_BLOCKED,
+		DECODE_NEED_DATA,
+		DECODE_DONE,
+	};
+
+	// Decoded frames waiting to be shown, converted to RGBA by the decoder.
+	struct Frame {
+		Vector<uint8_t> data;
+		double time = 0;
+	};
+
+	Frame frames[MAX_FRAMES];
+	int frame_read = 0;
+	int frames_queued = 0;
+	Mutex frame_mutex;
+
+	// Interleaved PCM decoded ahead of the video, handed to the mix callback on update().
+	RingBuffer<float> audio_buffer;
+	Mutex audio_mutex;
+	uint64_t audio_frames_decoded = 0;
+	double newest_video_time = 0;
+
+	// Everything below the headers (demuxing, decoding, colour conversion) runs on this thread.
+	Thread decode_thread;
+	Semaphore decode_sem;
+	SafeFlag decode_exit;
+	SafeFlag decode_eof;
+	SafeNumeric<uint64_t> playback_usec;
+
 	Ref<FileAccess> file;
 	String file_name;
-	int audio_frames_wrote = 0;
 	Point2i size;
 
 	int buffer_data();
 	int queue_page(ogg_page *page);
-	void video_write();
+	void video_write(Vector<uint8_t> &r_data);
 	double get_time() const;
 
+	DecodeResult _decode_audio();
+	DecodeResult _decode_video();
+	bool _decode_step();
+	void _mix_decoded_audio();
+	static void _decode_thread(void *p_ud);
+	void _start_decoder();
+	void _stop_decoder();
+
 	bool theora_eos = false;
 	bool vorbis_eos = false;
 
@@ -84,16 +117,13 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	vorbis_comment vc;
 	th_pixel_fmt px_fmt;
 	double videobuf_time = 0;
-	int pp_inc = 0;
 
 	int theora_p = 0;
 	int vorbis_p = 0;
 	int pp_level_max = 0;
 	int pp_level = 0;
-	int videobuf_ready = 0;
 
 	bool playing = false;
-	bool buffering = false;
 
 	double last_update_time = 0;
 	double time = 0;
@@ -103,23 +133,6 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 
 	bool paused = false;
 
-#ifdef THEORA_USE_THREAD_STREAMING
-
-	enum {
-		RB_SIZE_KB = 1024
-	};
-
-	RingBuffer<uint8_t> ring_buffer;
-	Vector<uint8_t> read_buffer;
-	bool thread_eof = false;
-	Semaphore *thread_sem = nullptr;
-	Thread thread;
-	SafeFlag thread_exit;
-
-	static void _streaming_thread(void *ud);
-
-#endif
-
 	int audio_track = 0;
 
 protected:
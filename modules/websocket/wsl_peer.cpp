@@ -586,6 +586,21 @@ ssize_t WSLPeer::_wsl_send_callback(wslay_event_context_ptr ctx, const uint8_t *
 		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
 		return -1;
 	}
+	LocalVector<uint8_t> &out = peer->out_buffer;
+	if (out.size() || len < OUT_BUFFER_MAX) {
+		// Coalesce, the buffer is written to the connection once wslay is done sending.
+		uint32_t space = OUT_BUFFER_MAX > out.size() ? OUT_BUFFER_MAX - out.size() : 0;
+		if (space == 0) {
+			wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
+			return -1;
+		}
+		uint32_t to_copy = MIN((uint32_t)len, space);
+		uint32_t ofs = out.size();
+		out.resize(ofs + to_copy);
+		memcpy(out.ptr() + ofs, data, to_copy);
+		return to_copy;
+	}
+	// Large frame with nothing pending, write it directly.
 	int sent = 0;
 	Error err = conn->put_partial_data(data, len, sent);
 	if (err != OK) {
@@ -678,7 +693,7 @@ void WSLPeer::poll() {
 	if (ready_state == STATE_OPEN || ready_state == STATE_CLOSING) {
 		ERR_FAIL_NULL(wsl_ctx);
 		int err = 0;
-		if ((err = wslay_event_recv(wsl_ctx)) != 0 || (err = wslay_event_send(wsl_ctx)) != 0) {
+		if ((err = wslay_event_recv(wsl_ctx)) != 0 || (err = _send_pending()) != 0) {
 			// Error close.
 			print_verbose("Websocket (wslay) poll error: " + itos(err));
 			wslay_event_context_free(wsl_ctx);
@@ -686,7 +701,7 @@ void WSLPeer::poll() {
 			close(-1);
 			return;
 		}
-		if (wslay_event_get_close_sent(wsl_ctx) && wslay_event_get_close_received(wsl_ctx)) {
+		if (out_buffer.is_empty() && wslay_event_get_close_sent(wsl_ctx) && wslay_event_get_close_received(wsl_ctx)) {
 			// Clean close.
 			wslay_event_context_free(wsl_ctx);
 			wsl_ctx = nullptr;
@@ -707,13 +722,47 @@ Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_
 	msg.msg_length = p_buffer_size;
 
 	// Queue & send message.
-	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || wslay_event_send(wsl_ctx) != 0) {
+	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || _send_pending() != 0) {
 		close(-1);
 		return FAILED;
 	}
 	return OK;
 }
 
+int WSLPeer::_send_pending() {
+	// Let wslay fill the output buffer, and write it out, until the connection is saturated or nothing is left.
+	while (true) {
+		int err = wslay_event_send(wsl_ctx);
+		if (err != 0) {
+			return err;
+		}
+		if (_flush_out_buffer() != OK) {
+			return WSLAY_ERR_CALLBACK_FAILURE;
+		}
+		if (out_buffer.size() || !wslay_event_want_write(wsl_ctx)) {
+			return 0;
+		}
+	}
+}
+
+Error WSLPeer::_flush_out_buffer() {
+	if (out_buffer.is_empty()) {
+		return OK;
+	}
+	ERR_FAIL_COND_V(connection.is_null(), FAILED);
+	int sent = 0;
+	Error err = connection->put_partial_data(out_buffer.ptr(), out_buffer.size(), sent);
+	if (err != OK) {
+		return err;
+	}
+	uint32_t left = out_buffer.size() - sent;
+	if (left && sent) {
+		memmove(out_buffer.ptr(), out_buffer.ptr() + sent, left);
+	}
+	out_buffer.resize(left);
+	return OK;
+}
+
 Error WSLPeer::send(const uint8_t *p_buffer, int p_buffer_size, WriteMode p_mode) {
 	wslay_opcode opcode = p_mode == WRITE_MODE_TEXT ? WSLAY_TEXT_FRAME : WSLAY_BINARY_FRAME;
 	return _send(p_buffer, p_buffer_size, opcode);
@@ -755,7 +804,7 @@ int WSLPeer::get_current_outbound_buffered_amount() const {
 		return 0;
 	}
 
-	return wslay_event_get_queued_msg_length(wsl_ctx);
+	return wslay_event_get_queued_msg_length(wsl_ctx) + out_buffer.size();
 }
 
 void WSLPeer::close(int p_code, String p_reason) {
@@ -767,10 +816,11 @@ void WSLPeer::close(int p_code, String p_reason) {
 	if (ready_state == STATE_OPEN && !wslay_event_get_close_sent(wsl_ctx)) {
 		CharString cs = p_reason.utf8();
 		wslay_event_queue_close(wsl_ctx, p_code, (uint8_t *)cs.ptr(), cs.length());
-		wslay_event_send(wsl_ctx);
+		_send_pending();
 		ready_state = STATE_CLOSING;
 	} else if (ready_state == STATE_CONNECTING || ready_state == STATE_CLOSED) {
 		ready_state = STATE_CLOSED;
+		out_buffer.clear();
 		connection.unref();
 		if (tcp.is_valid()) {
 			tcp->disconnect_from_host();
@@ -831,6 +881,7 @@ void WSLPeer::_clear() {
 	was_string = 0;
 	in_buffer.clear();
 	packet_buffer.clear();
+	out_buffer.clear();
 
 	// Close code info.
 	close_code = -1;
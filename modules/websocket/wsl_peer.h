@@ -40,6 +40,7 @@
 #include "core/error/error_list.h"
 #include "core/io/packet_peer.h"
 #include "core/io/stream_peer_tcp.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/ring_buffer.h"
 
 #include <wslay/wslay.h>
@@ -108,8 +109,13 @@ private:
 	Vector<uint8_t> packet_buffer;
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
 	PacketBuffer<uint8_t> in_buffer;
+	// Outgoing frames (headers and payloads) are coalesced here, so small messages don't cost one write (and one TCP segment, with no_delay) each.
+	static const uint32_t OUT_BUFFER_MAX = 65536;
+	LocalVector<uint8_t> out_buffer;
 
 	Error _send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode);
+	int _send_pending();
+	Error _flush_out_buffer();
 
 	Error _do_server_handshake();
 	bool _parse_client_request();
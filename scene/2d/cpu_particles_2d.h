@@ -107,7 +107,21 @@ private:
 	RID mesh;
 	RID multimesh;
 
+	// What the serial pass of _particles_process() decided for each particle.
+	enum ParticleStepState : uint8_t {
+		STEP_SKIP,
+		STEP_SPAWNED,
+		STEP_FINISHED,
+		STEP_INTEGRATE,
+	};
+
+	struct ParticleStep {
+		double local_delta = 0.0;
+		ParticleStepState state = STEP_SKIP;
+	};
+
 	Vector<Particle> particles;
+	LocalVector<ParticleStep> particle_steps;
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
@@ -178,6 +192,8 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _prebake_curves();
+	void _particle_update(Particle &p_particle, const ParticleStep &p_step, const Transform2D &p_emission_xform);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
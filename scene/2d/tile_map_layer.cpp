@@ -2237,6 +2237,16 @@ void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vec
 	used_rect_cache_dirty = true;
 }
 
+void TileMapLayer::set_cells(const TypedArray<Vector2i> &p_coords_array, int p_source_id, const Vector2i p_atlas_coords, int p_alternative_tile) {
+	// Grow the map once instead of rehashing repeatedly while filling large areas.
+	if (p_source_id != TileSet::INVALID_SOURCE) {
+		tile_map.reserve(tile_map.size() + p_coords_array.size());
+	}
+	for (int i = 0; i < p_coords_array.size(); i++) {
+		set_cell(p_coords_array[i], p_source_id, p_atlas_coords, p_alternative_tile);
+	}
+}
+
 void TileMapLayer::erase_cell(const Vector2i &p_coords) {
 	set_cell(p_coords, TileSet::INVALID_SOURCE, TileSetSource::INVALID_ATLAS_COORDS, TileSetSource::INVALID_TILE_ALTERNATIVE);
 }
@@ -2307,6 +2317,23 @@ TileData *TileMapLayer::get_cell_tile_data(const Vector2i &p_coords, bool p_use_
 	return nullptr;
 }
 
+void TileMapLayer::erase_cells_in_rect(const Rect2i &p_rect) {
+	// Cells are only removed from the map on the next internal update, so it is safe to erase while iterating.
+	if ((int64_t)p_rect.size.x * p_rect.size.y > (int64_t)tile_map.size()) {
+		for (KeyValue<Vector2i, CellData> &kv : tile_map) {
+			if (p_rect.has_point(kv.key)) {
+				erase_cell(kv.key);
+			}
+		}
+	} else {
+		for (int y = p_rect.position.y; y < p_rect.get_end().y; y++) {
+			for (int x = p_rect.position.x; x < p_rect.get_end().x; x++) {
+				erase_cell(Vector2i(x, y));
+			}
+		}
+	}
+}
+
 void TileMapLayer::clear() {
 	// Remove all tiles.
 	for (KeyValue<Vector2i, CellData> &kv : tile_map) {
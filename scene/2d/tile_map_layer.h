@@ -377,7 +377,9 @@ public:
 	// --- Exposed in TileMap ---
 	// Cells manipulation.
 	void set_cell(const Vector2i &p_coords, int p_source_id = TileSet::INVALID_SOURCE, const Vector2i p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
+	void set_cells(const TypedArray<Vector2i> &p_coords_array, int p_source_id = TileSet::INVALID_SOURCE, const Vector2i p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
 	void erase_cell(const Vector2i &p_coords);
+	void erase_cells_in_rect(const Rect2i &p_rect);
 
 	int get_cell_source_id(const Vector2i &p_coords, bool p_use_proxies = false) const;
 	Vector2i get_cell_atlas_coords(const Vector2i &p_coords, bool p_use_proxies = false) const;
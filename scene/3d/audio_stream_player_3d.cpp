@@ -427,12 +427,19 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 			AudioServer::get_singleton()->set_playback_highshelf_params(playback, linear_attenuation, attenuation_filter_cutoff_hz);
 		}
 		// Bake in a constant factor here to allow the project setting defaults for 2d and 3d to be normalized to 1.0.
-		float tightness = cached_global_panning_strength * 2.0f;
-		tightness *= panning_strength;
-		_calc_output_vol(local_pos.normalized(), tightness, output_volume_vector);
+		if (multiplier > 0) {
+			float tightness = cached_global_panning_strength * 2.0f;
+			tightness *= panning_strength;
+			_calc_output_vol(local_pos.normalized(), tightness, output_volume_vector);
 
-		for (unsigned int k = 0; k < 4; k++) {
-			output_volume_vector.write[k] = multiplier * output_volume_vector[k];
+			for (unsigned int k = 0; k < 4; k++) {
+				output_volume_vector.write[k] = multiplier * output_volume_vector[k];
+			}
+		} else {
+			// Out of range, so panning doesn't matter.
+			for (AudioFrame &frame : output_volume_vector) {
+				frame = AudioFrame(0, 0);
+			}
 		}
 
 		HashMap<StringName, Vector<AudioFrame>> bus_volumes;
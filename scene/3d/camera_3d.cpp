@@ -97,6 +97,13 @@ void Camera3D::_update_camera() {
 	get_viewport()->_camera_3d_transform_changed_notify();
 }
 
+void Camera3D::_reset_physics_interpolation() {
+	// Set the transform first, so the camera doesn't slide there from wherever it was before.
+	RenderingServer::get_singleton()->camera_set_interpolated(camera, is_physics_interpolated_and_enabled());
+	RenderingServer::get_singleton()->camera_set_transform(camera, get_camera_transform());
+	RenderingServer::get_singleton()->camera_reset_physics_interpolation(camera);
+}
+
 void Camera3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_WORLD: {
@@ -106,6 +113,8 @@ void Camera3D::_notification(int p_what) {
 			viewport = get_viewport();
 			ERR_FAIL_NULL(viewport);
 
+			_reset_physics_interpolation();
+
 			bool first_camera = viewport->_camera_3d_add(this);
 			if (current || first_camera) {
 				viewport->_camera_3d_set(this);
@@ -125,6 +134,10 @@ void Camera3D::_notification(int p_what) {
 			}
 		} break;
 
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			_reset_physics_interpolation();
+		} break;
+
 		case NOTIFICATION_EXIT_WORLD: {
 			if (!get_tree()->is_node_being_edited(this)) {
 				if (is_current()) {
@@ -101,6 +101,7 @@ private:
 protected:
 	void _update_camera();
 	virtual void _request_camera_update();
+	void _reset_physics_interpolation();
 	void _update_camera_mode();
 
 	void _notification(int p_what);
@@ -134,6 +134,14 @@ RID LightmapGIData::get_rid() const {
 	return lightmap;
 }
 
+void LightmapGIData::set_bake_input_hash(uint32_t p_hash) {
+	bake_input_hash = p_hash;
+}
+
+uint32_t LightmapGIData::get_bake_input_hash() const {
+	return bake_input_hash;
+}
+
 void LightmapGIData::clear() {
 	users.clear();
 }
@@ -260,6 +268,9 @@ void LightmapGIData::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_user_path", "user_idx"), &LightmapGIData::get_user_path);
 	ClassDB::bind_method(D_METHOD("clear_users"), &LightmapGIData::clear_users);
 
+	ClassDB::bind_method(D_METHOD("set_bake_input_hash", "hash"), &LightmapGIData::set_bake_input_hash);
+	ClassDB::bind_method(D_METHOD("get_bake_input_hash"), &LightmapGIData::get_bake_input_hash);
+
 	ClassDB::bind_method(D_METHOD("_set_probe_data", "data"), &LightmapGIData::_set_probe_data);
 	ClassDB::bind_method(D_METHOD("_get_probe_data"), &LightmapGIData::_get_probe_data);
 
@@ -267,6 +278,7 @@ void LightmapGIData::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "uses_spherical_harmonics", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_uses_spherical_harmonics", "is_using_spherical_harmonics");
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "user_data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "_set_user_data", "_get_user_data");
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "probe_data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "_set_probe_data", "_get_probe_data");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bake_input_hash", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_bake_input_hash", "get_bake_input_hash");
 
 #ifndef DISABLE_DEPRECATED
 	ClassDB::bind_method(D_METHOD("set_light_texture", "light_texture"), &LightmapGIData::set_light_texture);
@@ -687,6 +699,79 @@ void LightmapGI::_gen_new_positions_from_octree(const GenProbesOctree *p_cell, f
 	}
 }
 
+uint32_t LightmapGI::_get_bake_input_hash(const Vector<Lightmapper::MeshData> &p_mesh_data, const Vector<LightsFound> &p_lights, const Vector<Vector3> &p_probes, const Ref<Image> &p_environment_image, const Basis &p_environment_transform, float p_exposure_normalization) const {
+	uint32_t h = hash_murmur3_one_32(p_mesh_data.size());
+	for (const Lightmapper::MeshData &md : p_mesh_data) {
+		h = hash_murmur3_one_32(md.userdata.hash(), h);
+		h = hash_murmur3_buffer(md.points.ptr(), md.points.size() * sizeof(Vector3), h);
+		h = hash_murmur3_buffer(md.uv2.ptr(), md.uv2.size() * sizeof(Vector2), h);
+		h = hash_murmur3_buffer(md.normal.ptr(), md.normal.size() * sizeof(Vector3), h);
+		for (const Ref<Image> &image : { md.albedo_on_uv2, md.emission_on_uv2 }) {
+			h = hash_murmur3_one_32(image->get_width(), h);
+			h = hash_murmur3_one_32(image->get_height(), h);
+			Vector<uint8_t> data = image->get_data();
+			h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+		}
+	}
+
+	h = hash_murmur3_one_32(p_lights.size(), h);
+	for (const LightsFound &lf : p_lights) {
+		const Light3D *light = lf.light;
+		h = hash_murmur3_one_32(light->get_class_name().hash(), h);
+		h = hash_murmur3_buffer(&lf.xform, sizeof(Transform3D), h);
+		Color color = light->get_color();
+		Color correlated_color = light->get_correlated_color();
+		h = hash_murmur3_buffer(&color, sizeof(Color), h);
+		h = hash_murmur3_buffer(&correlated_color, sizeof(Color), h);
+		for (int i = 0; i < Light3D::PARAM_MAX; i++) {
+			h = hash_murmur3_one_float(light->get_param(Light3D::Param(i)), h);
+		}
+		h = hash_murmur3_one_32(light->get_bake_mode(), h);
+		h = hash_murmur3_one_32(light->is_editor_only(), h);
+		const DirectionalLight3D *directional_light = Object::cast_to<DirectionalLight3D>(light);
+		h = hash_murmur3_one_32(directional_light ? directional_light->get_sky_mode() : 0, h);
+	}
+
+	h = hash_murmur3_buffer(p_probes.ptr(), p_probes.size() * sizeof(Vector3), h);
+
+	if (p_environment_image.is_valid()) {
+		Vector<uint8_t> data = p_environment_image->get_data();
+		h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+		h = hash_murmur3_buffer(&p_environment_transform, sizeof(Basis), h);
+	}
+	h = hash_murmur3_one_float(p_exposure_normalization, h);
+
+	// Bake settings, including the project settings read by the lightmapper.
+	h = hash_murmur3_one_32(bake_quality, h);
+	h = hash_murmur3_one_32(use_denoiser, h);
+	h = hash_murmur3_one_float(denoiser_strength, h);
+	h = hash_murmur3_one_32(bounces, h);
+	h = hash_murmur3_one_float(bounce_indirect_energy, h);
+	h = hash_murmur3_one_float(bias, h);
+	h = hash_murmur3_one_32(max_texture_size, h);
+	h = hash_murmur3_one_32(interior, h);
+	h = hash_murmur3_one_32(directional, h);
+	h = hash_murmur3_one_32(use_texture_for_bounces, h);
+	h = hash_murmur3_one_32(gen_probes, h);
+	h = hash_murmur3_one_32(GLOBAL_GET("rendering/lights_and_shadows/use_physical_light_units").hash(), h);
+	static const char *quality_settings[] = {
+		"rendering/lightmapping/bake_quality/low_quality_ray_count",
+		"rendering/lightmapping/bake_quality/medium_quality_ray_count",
+		"rendering/lightmapping/bake_quality/high_quality_ray_count",
+		"rendering/lightmapping/bake_quality/ultra_quality_ray_count",
+		"rendering/lightmapping/bake_quality/low_quality_probe_ray_count",
+		"rendering/lightmapping/bake_quality/medium_quality_probe_ray_count",
+		"rendering/lightmapping/bake_quality/high_quality_probe_ray_count",
+		"rendering/lightmapping/bake_quality/ultra_quality_probe_ray_count",
+		"rendering/lightmapping/denoising/denoiser",
+	};
+	for (const char *setting : quality_settings) {
+		h = hash_murmur3_one_32(GLOBAL_GET(setting).hash(), h);
+	}
+
+	return hash_fmix32(h);
+}
+
 LightmapGI::BakeError LightmapGI::bake(Node *p_from_node, String p_image_data_path, Lightmapper::BakeStepFunc p_bake_step, void *p_bake_userdata) {
 	if (p_image_data_path.is_empty()) {
 		if (get_light_data().is_null()) {
@@ -1061,6 +1146,23 @@ LightmapGI::BakeError LightmapGI::bake(Node *p_from_node, String p_image_data_pa
 		}
 	}
 
+	// Nothing that affects the result changed since the last bake to this path, keep the existing lightmaps.
+	uint32_t bake_input_hash = _get_bake_input_hash(mesh_data, lights_found, probes_found, environment_image, environment_transform, exposure_normalization);
+	if (get_light_data().is_valid() && get_light_data()->get_path() == p_image_data_path && get_light_data()->get_bake_input_hash() == bake_input_hash) {
+		TypedArray<TextureLayered> current_textures = get_light_data()->get_lightmap_textures();
+		bool textures_valid = !current_textures.is_empty();
+		for (int i = 0; i < current_textures.size(); i++) {
+			textures_valid = textures_valid && Ref<TextureLayered>(current_textures[i]).is_valid();
+		}
+		if (textures_valid) {
+			print_verbose(vformat("LightmapGI: Bake inputs of %s are unchanged, skipping the bake.", p_image_data_path));
+			if (p_bake_step) {
+				p_bake_step(1.0, RTR("Lightmaps are up to date"), p_bake_userdata, true);
+			}
+			return BAKE_ERROR_OK;
+		}
+	}
+
 	Lightmapper::BakeError bake_err = lightmapper->bake(Lightmapper::BakeQuality(bake_quality), use_denoiser, denoiser_strength, bounces, bounce_indirect_energy, bias, max_texture_size, directional, use_texture_for_bounces, Lightmapper::GenerateProbes(gen_probes), environment_image, environment_transform, _lightmap_bake_step_function, &bsud, exposure_normalization);
 
 	if (bake_err == Lightmapper::BAKE_ERROR_LIGHTMAP_TOO_SMALL) {
@@ -1289,6 +1391,7 @@ LightmapGI::BakeError LightmapGI::bake(Node *p_from_node, String p_image_data_pa
 		/* Obtain the colors from the images, they will be re-created as cubemaps on the server, depending on the driver */
 
 		gi_data->set_capture_data(bounds, interior, points, sh, tetrahedrons, bsp_array, exposure_normalization);
+		gi_data->set_bake_input_hash(bake_input_hash);
 		/* Compute a BSP tree of the simplices, so it's easy to find the exact one */
 	}
 
@@ -52,6 +52,7 @@ class LightmapGIData : public Resource {
 	RID lightmap;
 	AABB bounds;
 	float baked_exposure = 1.0;
+	uint32_t bake_input_hash = 0;
 
 	struct User {
 		NodePath path;
@@ -95,6 +96,9 @@ public:
 	bool is_interior() const;
 	float get_baked_exposure() const;
 
+	void set_bake_input_hash(uint32_t p_hash);
+	uint32_t get_bake_input_hash() const;
+
 	void set_capture_data(const AABB &p_bounds, bool p_interior, const PackedVector3Array &p_points, const PackedColorArray &p_point_sh, const PackedInt32Array &p_tetrahedra, const PackedInt32Array &p_bsp_tree, float p_baked_exposure);
 	PackedVector3Array get_capture_points() const;
 	PackedColorArray get_capture_sh() const;
@@ -192,6 +196,8 @@ private:
 	void _assign_lightmaps();
 	void _clear_lightmaps();
 
+	uint32_t _get_bake_input_hash(const Vector<Lightmapper::MeshData> &p_mesh_data, const Vector<LightsFound> &p_lights, const Vector<Vector3> &p_probes, const Ref<Image> &p_environment_image, const Basis &p_environment_transform, float p_exposure_normalization) const;
+
 	struct BakeTimeData {
 		String text;
 		int pass = 0;
@@ -108,6 +108,14 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// Moving a node several times before notifications are flushed (or moving many siblings under an already moved
+	// parent) would walk the same subtree again. If it was already marked dirty and queued since the last flush, the
+	// walk would change nothing.
+	SceneTree *tree = get_tree();
+	if (data.xform_propagated_epoch == tree->xform_change_epoch && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		return;
+	}
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
@@ -120,13 +128,14 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
 #endif
 		if (likely(is_accessible_from_caller_thread())) {
-			get_tree()->xform_change_list.add(&xform_change);
+			tree->xform_change_list.add(&xform_change);
 		} else {
 			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	data.xform_propagated_epoch = tree->xform_change_epoch;
 }
 
 void Node3D::_notification(int p_what) {
@@ -612,6 +621,9 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	if (is_inside_tree()) {
+		get_tree()->xform_change_epoch++; // Gizmos need transform notifications too.
+	}
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -736,6 +748,35 @@ bool Node3D::is_scale_disabled() const {
 	return data.disable_scale;
 }
 
+void Node3D::set_physics_interpolated(bool p_interpolated) {
+	ERR_THREAD_GUARD;
+	if (data.physics_interpolated == p_interpolated) {
+		return;
+	}
+
+	data.physics_interpolated = p_interpolated;
+	if (is_inside_tree()) {
+		notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+	}
+}
+
+bool Node3D::is_physics_interpolated() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return data.physics_interpolated;
+}
+
+bool Node3D::is_physics_interpolated_and_enabled() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return data.physics_interpolated && is_inside_tree() && get_tree()->is_physics_interpolation_enabled();
+}
+
+void Node3D::reset_physics_interpolation() {
+	ERR_THREAD_GUARD;
+	if (is_inside_tree()) {
+		propagate_notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+	}
+}
+
 void Node3D::set_as_top_level(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	if (data.top_level == p_enabled) {
@@ -956,9 +997,19 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform && is_inside_tree()) {
+		get_tree()->xform_change_epoch++; // Dirty subtrees may contain this node without it being queued.
+	}
 	data.notify_transform = p_enabled;
 }
 
+void Node3D::set_ignore_transform_notification(bool p_ignore) {
+	if (!p_ignore && data.ignore_notification && is_inside_tree()) {
+		get_tree()->xform_change_epoch++; // Same as enabling notifications.
+	}
+	data.ignore_notification = p_ignore;
+}
+
 bool Node3D::is_transform_notification_enabled() const {
 	ERR_READ_THREAD_GUARD_V(false);
 	return data.notify_transform;
@@ -981,6 +1032,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->xform_change_epoch++; // No longer queued, even if still dirty.
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -1145,6 +1197,10 @@ void Node3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_set_as_top_level"), &Node3D::is_set_as_top_level);
 	ClassDB::bind_method(D_METHOD("set_disable_scale", "disable"), &Node3D::set_disable_scale);
 	ClassDB::bind_method(D_METHOD("is_scale_disabled"), &Node3D::is_scale_disabled);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolated", "interpolated"), &Node3D::set_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated"), &Node3D::is_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated_and_enabled"), &Node3D::is_physics_interpolated_and_enabled);
+	ClassDB::bind_method(D_METHOD("reset_physics_interpolation"), &Node3D::reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("get_world_3d"), &Node3D::get_world_3d);
 
 	ClassDB::bind_method(D_METHOD("force_update_transform"), &Node3D::force_update_transform);
@@ -1196,6 +1252,7 @@ void Node3D::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_EXIT_WORLD);
 	BIND_CONSTANT(NOTIFICATION_VISIBILITY_CHANGED);
 	BIND_CONSTANT(NOTIFICATION_LOCAL_TRANSFORM_CHANGED);
+	BIND_CONSTANT(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
 
 	BIND_ENUM_CONSTANT(ROTATION_EDIT_MODE_EULER);
 	BIND_ENUM_CONSTANT(ROTATION_EDIT_MODE_QUATERNION);
@@ -1221,6 +1278,8 @@ void Node3D::_bind_methods() {
 	ADD_GROUP("Visibility", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "visible"), "set_visible", "is_visible");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "visibility_parent", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "GeometryInstance3D"), "set_visibility_parent", "get_visibility_parent");
+	ADD_GROUP("Physics Interpolation", "");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "physics_interpolated"), "set_physics_interpolated", "is_physics_interpolated");
 
 	ADD_SIGNAL(MethodInfo("visibility_changed"));
 }
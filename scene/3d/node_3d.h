@@ -110,12 +110,15 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		uint32_t xform_propagated_epoch = UINT32_MAX; // SceneTree::xform_change_epoch when the subtree was last marked dirty.
+
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
 		bool notify_transform = false;
 
 		bool visible = true;
 		bool disable_scale = false;
+		bool physics_interpolated = true;
 
 #ifdef TOOLS_ENABLED
 		Vector<Ref<Node3DGizmo>> gizmos;
@@ -145,7 +148,7 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	void set_ignore_transform_notification(bool p_ignore);
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -165,6 +168,7 @@ public:
 		NOTIFICATION_EXIT_WORLD = 42,
 		NOTIFICATION_VISIBILITY_CHANGED = 43,
 		NOTIFICATION_LOCAL_TRANSFORM_CHANGED = 44,
+		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = SceneTree::NOTIFICATION_RESET_PHYSICS_INTERPOLATION,
 	};
 
 	Node3D *get_parent_node_3d() const;
@@ -232,6 +236,11 @@ public:
 	void set_disable_scale(bool p_enabled);
 	bool is_scale_disabled() const;
 
+	void set_physics_interpolated(bool p_interpolated);
+	bool is_physics_interpolated() const;
+	bool is_physics_interpolated_and_enabled() const;
+	void reset_physics_interpolation();
+
 	_FORCE_INLINE_ bool is_inside_world() const { return data.inside_world; }
 
 	Transform3D get_relative_transform(const Node *p_parent) const;
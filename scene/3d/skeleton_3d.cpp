@@ -34,6 +34,7 @@
 #include "core/variant/type_info.h"
 #include "scene/3d/physics/physical_bone_3d.h"
 #include "scene/3d/physics/physics_body_3d.h"
+#include "scene/resources/animation.h"
 #include "scene/resources/surface_tool.h"
 #include "scene/scene_string_names.h"
 
@@ -619,6 +620,30 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	}
 }
 
+void Skeleton3D::set_bone_pose_components(int p_bone, const Vector3 *p_position, const Quaternion *p_rotation, const Vector3 *p_scale) {
+	const int bone_size = bones.size();
+	ERR_FAIL_INDEX(p_bone, bone_size);
+
+	if (!p_position && !p_rotation && !p_scale) {
+		return;
+	}
+
+	Bone &bone = bones.write[p_bone];
+	if (p_position) {
+		bone.pose_position = *p_position;
+	}
+	if (p_rotation) {
+		bone.pose_rotation = *p_rotation;
+	}
+	if (p_scale) {
+		bone.pose_scale = *p_scale;
+	}
+	bone.pose_cache_dirty = true;
+	if (is_inside_tree()) {
+		_make_dirty();
+	}
+}
+
 Vector3 Skeleton3D::get_bone_pose_position(int p_bone) const {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX_V(p_bone, bone_size, Vector3());
@@ -899,6 +924,130 @@ Ref<Skin> Skeleton3D::create_skin_from_rest_transforms() {
 	return skin;
 }
 
+Ref<Image> Skeleton3D::bake_animation_texture(const Ref<Animation> &p_animation, const Ref<Skin> &p_skin, float p_fps) {
+	ERR_FAIL_COND_V(p_animation.is_null(), Ref<Image>());
+	ERR_FAIL_COND_V_MSG(p_fps <= 0.0, Ref<Image>(), "Bake FPS must be greater than 0.");
+	const int len = bones.size();
+	ERR_FAIL_COND_V_MSG(len == 0, Ref<Image>(), "Skeleton3D has no bones to bake.");
+
+	Ref<Skin> skin = p_skin.is_valid() ? p_skin : create_skin_from_rest_transforms();
+	const int bind_count = skin->get_bind_count();
+	ERR_FAIL_COND_V_MSG(bind_count == 0, Ref<Image>(), "Skin has no binds to bake.");
+	ERR_FAIL_COND_V_MSG(bind_count * 3 > Image::MAX_WIDTH, Ref<Image>(), "Too many skin binds to fit in a texture row.");
+
+	// Resolve binds the same way skin bindings do for rendering.
+	LocalVector<int> bind_bones;
+	bind_bones.resize(bind_count);
+	for (int i = 0; i < bind_count; i++) {
+		StringName bind_name = skin->get_bind_name(i);
+		int bone = bind_name != StringName() ? find_bone(bind_name) : skin->get_bind_bone(i);
+		ERR_FAIL_INDEX_V_MSG(bone, len, Ref<Image>(), "Skin bind #" + itos(i) + " doesn't match any bone in this Skeleton3D.");
+		bind_bones[i] = bone;
+	}
+
+	// Bones sorted parents first, so global poses can be accumulated in one pass.
+	LocalVector<int> order;
+	order.reserve(len);
+	for (int bone : get_parentless_bones()) {
+		order.push_back(bone);
+	}
+	for (uint32_t i = 0; i < order.size(); i++) {
+		for (int child : bones[order[i]].child_bones) {
+			order.push_back(child);
+		}
+	}
+
+	struct BoneTrack {
+		int track = -1;
+		int bone = -1;
+		Animation::TrackType type = Animation::TYPE_POSITION_3D;
+	};
+	LocalVector<BoneTrack> bone_tracks;
+	for (int i = 0; i < p_animation->get_track_count(); i++) {
+		Animation::TrackType type = p_animation->track_get_type(i);
+		if (!p_animation->track_is_enabled(i) || (type != Animation::TYPE_POSITION_3D && type != Animation::TYPE_ROTATION_3D && type != Animation::TYPE_SCALE_3D)) {
+			continue;
+		}
+		NodePath path = p_animation->track_get_path(i);
+		if (path.get_subname_count() != 1) {
+			continue;
+		}
+		int bone = find_bone(path.get_subname(0));
+		if (bone < 0) {
+			continue;
+		}
+		bone_tracks.push_back({ i, bone, type });
+	}
+
+	const int frame_count = int(Math::ceil(p_animation->get_length() * p_fps)) + 1;
+	const int width = bind_count * 3;
+	ERR_FAIL_COND_V_MSG(frame_count > Image::MAX_HEIGHT, Ref<Image>(), "Too many frames to fit in a texture.");
+
+	Vector<uint8_t> data;
+	data.resize(width * frame_count * 4 * sizeof(float));
+	float *dst = reinterpret_cast<float *>(data.ptrw());
+
+	LocalVector<Vector3> positions;
+	LocalVector<Quaternion> rotations;
+	LocalVector<Vector3> scales;
+	LocalVector<Transform3D> globals;
+	positions.resize(len);
+	rotations.resize(len);
+	scales.resize(len);
+	globals.resize(len);
+
+	for (int f = 0; f < frame_count; f++) {
+		double time = MIN(double(f) / p_fps, p_animation->get_length());
+
+		// Bones without tracks stay at their rest.
+		for (int i = 0; i < len; i++) {
+			const Transform3D &rest = bones[i].rest;
+			positions[i] = rest.origin;
+			rotations[i] = rest.basis.get_rotation_quaternion();
+			scales[i] = rest.basis.get_scale();
+		}
+		for (const BoneTrack &bt : bone_tracks) {
+			switch (bt.type) {
+				case Animation::TYPE_POSITION_3D: {
+					if (p_animation->try_position_track_interpolate(bt.track, time, &positions[bt.bone]) == OK) {
+						positions[bt.bone] *= motion_scale;
+					}
+				} break;
+				case Animation::TYPE_ROTATION_3D: {
+					p_animation->try_rotation_track_interpolate(bt.track, time, &rotations[bt.bone]);
+				} break;
+				case Animation::TYPE_SCALE_3D: {
+					p_animation->try_scale_track_interpolate(bt.track, time, &scales[bt.bone]);
+				} break;
+				default: {
+				} break;
+			}
+		}
+
+		for (int bone : order) {
+			Transform3D pose;
+			pose.basis.set_quaternion_scale(rotations[bone], scales[bone]);
+			pose.origin = positions[bone];
+			int parent = bones[bone].parent;
+			globals[bone] = parent >= 0 ? globals[parent] * pose : pose;
+		}
+
+		// Each bind takes three texels holding the rows of its 3x4 skinning matrix, like the skeleton buffer.
+		for (int i = 0; i < bind_count; i++) {
+			Transform3D xform = globals[bind_bones[i]] * skin->get_bind_pose(i);
+			for (int r = 0; r < 3; r++) {
+				dst[0] = xform.basis.rows[r][0];
+				dst[1] = xform.basis.rows[r][1];
+				dst[2] = xform.basis.rows[r][2];
+				dst[3] = xform.origin[r];
+				dst += 4;
+			}
+		}
+	}
+
+	return Image::create_from_data(width, frame_count, false, Image::FORMAT_RGBAF, data);
+}
+
 Ref<SkinReference> Skeleton3D::register_skin(const Ref<Skin> &p_skin) {
 	ERR_FAIL_COND_V(p_skin.is_null(), Ref<SkinReference>());
 
@@ -1021,6 +1170,7 @@ void Skeleton3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_bone_global_rest", "bone_idx"), &Skeleton3D::get_bone_global_rest);
 
 	ClassDB::bind_method(D_METHOD("create_skin_from_rest_transforms"), &Skeleton3D::create_skin_from_rest_transforms);
+	ClassDB::bind_method(D_METHOD("bake_animation_texture", "animation", "skin", "fps"), &Skeleton3D::bake_animation_texture, DEFVAL(Ref<Skin>()), DEFVAL(30.0));
 	ClassDB::bind_method(D_METHOD("register_skin", "skin"), &Skeleton3D::register_skin);
 
 	ClassDB::bind_method(D_METHOD("localize_rests"), &Skeleton3D::localize_rests);
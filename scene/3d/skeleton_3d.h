@@ -36,6 +36,7 @@
 
 typedef int BoneId;
 
+class Animation;
 class PhysicalBone3D;
 class Skeleton3D;
 
@@ -197,6 +198,8 @@ public:
 	void set_bone_pose_position(int p_bone, const Vector3 &p_position);
 	void set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation);
 	void set_bone_pose_scale(int p_bone, const Vector3 &p_scale);
+	// Sets any non-null pose component with a single dirty notification, for bulk writers such as AnimationMixer.
+	void set_bone_pose_components(int p_bone, const Vector3 *p_position, const Quaternion *p_rotation, const Vector3 *p_scale);
 
 	Transform3D get_bone_pose(int p_bone) const;
 
@@ -214,6 +217,7 @@ public:
 	void localize_rests(); // used for loaders and tools
 
 	Ref<Skin> create_skin_from_rest_transforms();
+	Ref<Image> bake_animation_texture(const Ref<Animation> &p_animation, const Ref<Skin> &p_skin = Ref<Skin>(), float p_fps = 30.0);
 
 	Ref<SkinReference> register_skin(const Ref<Skin> &p_skin);
 
@@ -47,11 +47,19 @@ void VisualInstance3D::_update_visibility() {
 	RS::get_singleton()->instance_set_visible(get_instance(), is_visible_in_tree());
 }
 
+void VisualInstance3D::_reset_physics_interpolation() {
+	// Set the transform first, so the instance doesn't slide there from wherever it was before.
+	RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated_and_enabled());
+	RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+	RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+}
+
 void VisualInstance3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_WORLD: {
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			_reset_physics_interpolation();
 			_update_visibility();
 		} break;
 
@@ -60,6 +68,10 @@ void VisualInstance3D::_notification(int p_what) {
 			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
 		} break;
 
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			_reset_physics_interpolation();
+		} break;
+
 		case NOTIFICATION_EXIT_WORLD: {
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
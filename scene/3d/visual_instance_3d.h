@@ -44,6 +44,7 @@ class VisualInstance3D : public Node3D {
 
 protected:
 	void _update_visibility();
+	void _reset_physics_interpolation();
 
 	void _notification(int p_what);
 	static void _bind_methods();
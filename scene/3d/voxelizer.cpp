@@ -31,6 +31,7 @@
 #include "voxelizer.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
@@ -72,7 +73,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void Voxelizer::_plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
 	if (p_level == cell_subdiv) {
 		//plot the face by guessing its albedo and emission value
 
@@ -219,16 +220,16 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 		}
 
 		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		r_cells.write[p_idx].albedo[0] += albedo_accum.r;
+		r_cells.write[p_idx].albedo[1] += albedo_accum.g;
+		r_cells.write[p_idx].albedo[2] += albedo_accum.b;
+		r_cells.write[p_idx].emission[0] += emission_accum.r;
+		r_cells.write[p_idx].emission[1] += emission_accum.g;
+		r_cells.write[p_idx].emission[2] += emission_accum.b;
+		r_cells.write[p_idx].normal[0] += normal_accum.x;
+		r_cells.write[p_idx].normal[1] += normal_accum.y;
+		r_cells.write[p_idx].normal[2] += normal_accum.z;
+		r_cells.write[p_idx].alpha += alpha;
 
 	} else {
 		//go down
@@ -271,19 +272,19 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			if (r_cells[p_idx].children[i] == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+				uint32_t child_idx = r_cells.size();
+				r_cells.write[p_idx].children[i] = child_idx;
+				r_cells.resize(r_cells.size() + 1);
+				r_cells.write[child_idx].level = p_level + 1;
+				r_cells.write[child_idx].x = nx / half;
+				r_cells.write[child_idx].y = ny / half;
+				r_cells.write[child_idx].z = nz / half;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			_plot_face(r_cells, r_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
 		}
 	}
 }
@@ -382,9 +383,89 @@ Voxelizer::MaterialCache Voxelizer::_get_material_cache(Ref<Material> p_material
 	return mc;
 }
 
+void Voxelizer::_plot_faces(const LocalVector<PlotFace> &p_faces, const MaterialCache &p_material) {
+	uint32_t face_count = p_faces.size();
+
+	if (face_count < PLOT_FACES_PER_BATCH * 2) {
+		for (const PlotFace &face : p_faces) {
+			_plot_face(bake_cells, 0, 0, 0, 0, 0, face.vtx, face.normal, face.uv, p_material, po2_bounds);
+		}
+		return;
+	}
+
+	// Each batch of faces is plotted into its own octree on a worker thread, then merged into the main
+	// octree in batch order so the accumulated values don't depend on thread scheduling.
+	// Batches are processed in waves to bound the memory used by the intermediate octrees.
+	uint32_t batch_count = (face_count + PLOT_FACES_PER_BATCH - 1) / PLOT_FACES_PER_BATCH;
+	uint32_t wave_size = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count()) * 2;
+	LocalVector<Vector<Cell>> batch_cells;
+
+	for (uint32_t wave_from = 0; wave_from < batch_count; wave_from += wave_size) {
+		uint32_t wave_to = MIN(wave_from + wave_size, batch_count);
+		batch_cells.resize(wave_to - wave_from);
+
+		WorkerThreadPool::get_singleton()->parallel_for_range(wave_from, wave_to, 1, [&](uint32_t p_begin, uint32_t p_end) {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Vector<Cell> &cells = batch_cells[i - wave_from];
+				cells.resize(1);
+
+				uint32_t from = i * PLOT_FACES_PER_BATCH;
+				uint32_t to = MIN(from + PLOT_FACES_PER_BATCH, face_count);
+				for (uint32_t j = from; j < to; j++) {
+					const PlotFace &face = p_faces[j];
+					_plot_face(cells, 0, 0, 0, 0, 0, face.vtx, face.normal, face.uv, p_material, po2_bounds);
+				}
+			}
+		},
+				SNAME("VoxelizerPlotFaces"));
+
+		for (Vector<Cell> &cells : batch_cells) {
+			_merge_cells(cells, 0, 0);
+			cells.clear();
+		}
+	}
+}
+
+void Voxelizer::_merge_cells(const Vector<Cell> &p_src_cells, uint32_t p_src_idx, uint32_t p_dst_idx) {
+	const Cell &src = p_src_cells[p_src_idx];
+
+	{
+		Cell &dst = bake_cells.write[p_dst_idx];
+		for (int i = 0; i < 3; i++) {
+			dst.albedo[i] += src.albedo[i];
+			dst.emission[i] += src.emission[i];
+			dst.normal[i] += src.normal[i];
+		}
+		dst.alpha += src.alpha;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		uint32_t src_child = src.children[i];
+		if (src_child == CHILD_EMPTY) {
+			continue;
+		}
+
+		if (bake_cells[p_dst_idx].children[i] == CHILD_EMPTY) {
+			//sub cell must be created
+
+			uint32_t child_idx = bake_cells.size();
+			bake_cells.write[p_dst_idx].children[i] = child_idx;
+			bake_cells.resize(bake_cells.size() + 1);
+			bake_cells.write[child_idx].level = p_src_cells[src_child].level;
+			bake_cells.write[child_idx].x = p_src_cells[src_child].x;
+			bake_cells.write[child_idx].y = p_src_cells[src_child].y;
+			bake_cells.write[child_idx].z = p_src_cells[src_child].z;
+		}
+
+		_merge_cells(p_src_cells, src_child, bake_cells[p_dst_idx].children[i]);
+	}
+}
+
 void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const Vector<Ref<Material>> &p_materials, const Ref<Material> &p_override_material) {
 	ERR_FAIL_COND_MSG(!p_xform.is_finite(), "Invalid mesh bake transform.");
 
+	LocalVector<PlotFace> faces;
+
 	for (int i = 0; i < p_mesh->get_surface_count(); i++) {
 		if (p_mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
 			continue; //only triangles
@@ -419,71 +500,37 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 			nr = normals.ptr();
 		}
 
-		if (index.size()) {
-			int facecount = index.size() / 3;
-			const int *ir = index.ptr();
-
-			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
-
-				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[ir[j * 3 + k]]);
-				}
-
-				if (uvr) {
-					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[ir[j * 3 + k]];
-					}
-				}
-
-				if (nr) {
-					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[ir[j * 3 + k]];
-					}
-				}
-
-				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
-					continue;
-				}
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
-			}
+		const int *ir = index.size() ? index.ptr() : nullptr;
+		int facecount = ir ? index.size() / 3 : vertices.size() / 3;
 
-		} else {
-			int facecount = vertices.size() / 3;
+		faces.clear();
+		faces.reserve(facecount);
 
-			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+		for (int j = 0; j < facecount; j++) {
+			PlotFace face;
 
-				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[j * 3 + k]);
-				}
+			for (int k = 0; k < 3; k++) {
+				int vtx_idx = ir ? ir[j * 3 + k] : j * 3 + k;
 
+				face.vtx[k] = p_xform.xform(vr[vtx_idx]);
 				if (uvr) {
-					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[j * 3 + k];
-					}
+					face.uv[k] = uvr[vtx_idx];
 				}
-
 				if (nr) {
-					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[j * 3 + k];
-					}
+					face.normal[k] = nr[vtx_idx];
 				}
+			}
 
-				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
-					continue;
-				}
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+			//test against original bounds
+			if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, face.vtx)) {
+				continue;
 			}
+
+			faces.push_back(face);
 		}
+
+		//plot
+		_plot_faces(faces, material);
 	}
 
 	max_original_cells = bake_cells.size();
@@ -847,30 +894,39 @@ Vector<uint8_t> Voxelizer::get_sdf_3d_image() const {
 		}
 	}
 
-	//process in each direction
+	//process in each direction, every line within a pass is independent
 
 	//xy->z
 
-	for (int i = 0; i < octree_size.x; i++) {
-		for (int j = 0; j < octree_size.y; j++) {
-			edt(&work_memory[i + j * y_mult], z_mult, octree_size.z);
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, octree_size.x, 1, [&](uint32_t p_begin, uint32_t p_end) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			for (int j = 0; j < octree_size.y; j++) {
+				edt(&work_memory[i + j * y_mult], z_mult, octree_size.z);
+			}
 		}
-	}
+	},
+			SNAME("VoxelizerSDFZ"));
 
 	//xz->y
 
-	for (int i = 0; i < octree_size.x; i++) {
-		for (int j = 0; j < octree_size.z; j++) {
-			edt(&work_memory[i + j * z_mult], y_mult, octree_size.y);
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, octree_size.x, 1, [&](uint32_t p_begin, uint32_t p_end) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			for (int j = 0; j < octree_size.z; j++) {
+				edt(&work_memory[i + j * z_mult], y_mult, octree_size.y);
+			}
 		}
-	}
+	},
+			SNAME("VoxelizerSDFY"));
 
 	//yz->x
-	for (int i = 0; i < octree_size.y; i++) {
-		for (int j = 0; j < octree_size.z; j++) {
-			edt(&work_memory[i * y_mult + j * z_mult], 1, octree_size.x);
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, octree_size.y, 1, [&](uint32_t p_begin, uint32_t p_end) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			for (int j = 0; j < octree_size.z; j++) {
+				edt(&work_memory[i * y_mult + j * z_mult], 1, octree_size.x);
+			}
 		}
-	}
+	},
+			SNAME("VoxelizerSDFX"));
 
 	Vector<uint8_t> image3d;
 	image3d.resize(float_count);
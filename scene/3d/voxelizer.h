@@ -31,12 +31,14 @@
 #ifndef VOXELIZER_H
 #define VOXELIZER_H
 
+#include "core/templates/local_vector.h"
 #include "scene/resources/multimesh.h"
 
 class Voxelizer {
 private:
 	enum {
-		CHILD_EMPTY = 0xFFFFFFFF
+		CHILD_EMPTY = 0xFFFFFFFF,
+		PLOT_FACES_PER_BATCH = 256,
 
 	};
 
@@ -86,6 +88,12 @@ private:
 		Vector<Color> emission;
 	};
 
+	struct PlotFace {
+		Vector3 vtx[3];
+		Vector3 normal[3];
+		Vector2 uv[3];
+	};
+
 	HashMap<Ref<Material>, MaterialCache> material_cache;
 	float exposure_normalization = 1.0;
 	AABB original_bounds;
@@ -104,7 +112,9 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_faces(const LocalVector<PlotFace> &p_faces, const MaterialCache &p_material);
+	void _merge_cells(const Vector<Cell> &p_src_cells, uint32_t p_src_idx, uint32_t p_dst_idx);
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
@@ -466,6 +466,23 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+static uint32_t update_interval_phase_counter = 0;
+
+void AnimationMixer::set_update_interval(int p_interval) {
+	ERR_FAIL_COND_MSG(p_interval < 1, "Update interval must be at least 1.");
+	if (update_interval == p_interval) {
+		return;
+	}
+	update_interval = p_interval;
+	// Stagger mixers sharing an interval so their updates don't all land on the same frame.
+	update_interval_counter = update_interval_phase_counter++ % update_interval;
+	update_delta_accum = 0.0;
+}
+
+int AnimationMixer::get_update_interval() const {
+	return update_interval;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -687,6 +704,9 @@ bool AnimationMixer::_update_caches() {
 						track_value->is_using_angle = anim->track_get_interpolation_type(i) == Animation::INTERPOLATION_LINEAR_ANGLE || anim->track_get_interpolation_type(i) == Animation::INTERPOLATION_CUBIC_ANGLE;
 
 						track_value->subpath = leftover_path;
+						if (leftover_path.size() == 1) {
+							track_value->property_cache.set_member(leftover_path[0]);
+						}
 
 						track = track_value;
 
@@ -910,6 +930,10 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->blend_idx = track_map[K.value->path];
+	}
+
 	cache_valid = true;
 
 	return true;
@@ -919,6 +943,27 @@ bool AnimationMixer::_update_caches() {
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
 
+void AnimationMixer::_process_animation_interval(double p_delta) {
+	if (update_interval <= 1) {
+		_process_animation(p_delta);
+		return;
+	}
+
+	update_delta_accum += p_delta;
+	if (++update_interval_counter < update_interval) {
+		// Nothing moved on this frame, so consumers applying root motion every frame must not apply the last one again.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		return;
+	}
+
+	double delta = update_delta_accum;
+	update_interval_counter = 0;
+	update_delta_accum = 0.0;
+	_process_animation(delta);
+}
+
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
@@ -1060,28 +1105,33 @@ void AnimationMixer::blend_capture(double p_delta) {
 }
 
 void AnimationMixer::_blend_calc_total_weight() {
+	LocalVector<bool> processed_indices;
+	processed_indices.resize(track_count);
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		real_t weight = ai.playback_info.weight;
 		Vector<real_t> track_weights = ai.playback_info.track_weights;
-		Vector<int> processed_indices;
+		for (bool &processed : processed_indices) {
+			processed = false;
+		}
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
 			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache **track_ptr = track_cache.getptr(thash);
+			if (!track_ptr) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			int blend_idx = track_map[track->path];
-			if (processed_indices.has(blend_idx)) {
-				continue; // There is the case different track type with same path... Is there more faster iterating way than has()?
-			}
+			TrackCache *track = *track_ptr;
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
+			if (processed_indices[blend_idx]) {
+				continue; // There is the case different track type with same path.
+			}
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_indices.push_back(blend_idx);
+			processed_indices[blend_idx] = true;
 		}
 	}
 }
@@ -1110,12 +1160,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				continue;
 			}
 			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache **track_ptr = track_cache.getptr(thash);
+			if (!track_ptr) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			ERR_CONTINUE(!track_map.has(track->path));
-			int blend_idx = track_map[track->path];
+			TrackCache *track = *track_ptr;
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			if (!deterministic) {
@@ -1462,7 +1512,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							value = post_process_key_value(a, i, value, t->object_id);
 							Object *t_obj = ObjectDB::get_instance(t->object_id);
 							if (t_obj) {
-								t_obj->set_indexed(t->subpath, value);
+								t->set_property_value(t_obj, value);
 							}
 						} else {
 							List<int> indices;
@@ -1472,7 +1522,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 								value = post_process_key_value(a, i, value, t->object_id);
 								Object *t_obj = ObjectDB::get_instance(t->object_id);
 								if (t_obj) {
-									t_obj->set_indexed(t->subpath, value);
+									t->set_property_value(t_obj, value);
 								}
 							}
 						}
@@ -1690,15 +1740,10 @@ void AnimationMixer::_blend_apply() {
 					if (!t_skeleton) {
 						return;
 					}
-					if (t->loc_used) {
-						t_skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-					}
-					if (t->rot_used) {
-						t_skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-					}
-					if (t->scale_used) {
-						t_skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
-					}
+					t_skeleton->set_bone_pose_components(t->bone_idx,
+							t->loc_used ? &t->loc : nullptr,
+							t->rot_used ? &t->rot : nullptr,
+							t->scale_used ? &t->scale : nullptr);
 
 				} else if (!t->skeleton_id.is_valid()) {
 					Node3D *t_node_3d = Object::cast_to<Node3D>(ObjectDB::get_instance(t->object_id));
@@ -1749,7 +1794,7 @@ void AnimationMixer::_blend_apply() {
 
 				Object *t_obj = ObjectDB::get_instance(t->object_id);
 				if (t_obj) {
-					t_obj->set_indexed(t->subpath, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
+					t->set_property_value(t_obj, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
 				}
 
 			} break;
@@ -1970,7 +2015,7 @@ void AnimationMixer::_build_backup_track_cache() {
 				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 				Object *t_obj = ObjectDB::get_instance(t->object_id);
 				if (t_obj) {
-					t->value = Animation::cast_to_blendwise(t_obj->get_indexed(t->subpath));
+					t->value = Animation::cast_to_blendwise(t->get_property_value(t_obj));
 				}
 				t->use_discrete = false;
 				if (t->init_value.is_array()) {
@@ -2101,7 +2146,7 @@ void AnimationMixer::capture(const StringName &p_name, double p_duration, Tween:
 			TrackCacheValue *t = static_cast<TrackCacheValue *>(track_cache[reference_animation->track_get_type_hash(i)]);
 			Object *t_obj = ObjectDB::get_instance(t->object_id);
 			if (t_obj) {
-				Variant value = t_obj->get_indexed(t->subpath);
+				Variant value = t->get_property_value(t_obj);
 				int inserted_idx = capture_cache.animation->add_track(Animation::TYPE_VALUE);
 				capture_cache.animation->track_set_path(inserted_idx, reference_animation->track_get_path(i));
 				capture_cache.animation->track_insert_key(inserted_idx, 0, value);
@@ -2136,13 +2181,13 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_process_animation_interval(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_process_animation_interval(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -2195,6 +2240,9 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
+	ClassDB::bind_method(D_METHOD("set_update_interval", "interval"), &AnimationMixer::set_update_interval);
+	ClassDB::bind_method(D_METHOD("get_update_interval"), &AnimationMixer::get_update_interval);
+
 	ClassDB::bind_method(D_METHOD("set_callback_mode_process", "mode"), &AnimationMixer::set_callback_mode_process);
 	ClassDB::bind_method(D_METHOD("get_callback_mode_process"), &AnimationMixer::get_callback_mode_process);
 
@@ -2225,6 +2273,7 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater,suffix:frames"), "set_update_interval", "get_update_interval");
 
 	/* ---- Reset on save ---- */
 	ClassDB::bind_method(D_METHOD("set_reset_on_save_enabled", "enabled"), &AnimationMixer::set_reset_on_save_enabled);
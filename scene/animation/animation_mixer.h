@@ -31,6 +31,7 @@
 #ifndef ANIMATION_MIXER_H
 #define ANIMATION_MIXER_H
 
+#include "core/object/object_member_cache.h"
 #include "scene/animation/tween.h"
 #include "scene/main/node.h"
 #include "scene/resources/animation.h"
@@ -133,7 +134,12 @@ protected:
 	bool processing = false;
 	bool active = true;
 
+	int update_interval = 1;
+	int update_interval_counter = 0;
+	double update_delta_accum = 0.0;
+
 	void _set_process(bool p_process, bool p_force = false);
+	void _process_animation_interval(double p_delta);
 
 	/* ---- Caches for blending ---- */
 	bool cache_valid = false;
@@ -147,6 +153,7 @@ protected:
 		NodePath path;
 		ObjectID object_id;
 		real_t total_weight = 0.0;
+		int blend_idx = -1; // Index of the path in track_map, cached to avoid looking it up on every blend.
 
 		TrackCache() = default;
 		TrackCache(const TrackCache &p_other) :
@@ -154,7 +161,8 @@ protected:
 				setup_pass(p_other.setup_pass),
 				type(p_other.type),
 				object_id(p_other.object_id),
-				total_weight(p_other.total_weight) {}
+				total_weight(p_other.total_weight),
+				blend_idx(p_other.blend_idx) {}
 
 		virtual ~TrackCache() {}
 	};
@@ -222,16 +230,33 @@ protected:
 		Variant init_value;
 		Variant value;
 		Vector<StringName> subpath;
+		ObjectMemberCache property_cache; // For the common single property subpath.
 		bool use_discrete = false;
 		bool is_using_angle = false;
 		bool is_variant_interpolatable = true;
 		Variant element_size;
 
+		void set_property_value(Object *p_object, const Variant &p_value) {
+			if (subpath.size() == 1) {
+				property_cache.set(p_object, p_value);
+			} else {
+				p_object->set_indexed(subpath, p_value);
+			}
+		}
+
+		Variant get_property_value(const Object *p_object) {
+			if (subpath.size() == 1) {
+				return property_cache.get(p_object);
+			}
+			return p_object->get_indexed(subpath);
+		}
+
 		TrackCacheValue(const TrackCacheValue &p_other) :
 				TrackCache(p_other),
 				init_value(p_other.init_value),
 				value(p_other.value),
 				subpath(p_other.subpath),
+				property_cache(p_other.property_cache),
 				use_discrete(p_other.use_discrete),
 				is_using_angle(p_other.is_using_angle),
 				is_variant_interpolatable(p_other.is_variant_interpolatable),
@@ -405,6 +430,9 @@ public:
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
+	void set_update_interval(int p_interval);
+	int get_update_interval() const;
+
 	void set_callback_mode_process(AnimationCallbackModeProcess p_mode);
 	AnimationCallbackModeProcess get_callback_mode_process() const;
 
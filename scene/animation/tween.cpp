@@ -553,7 +553,7 @@ void PropertyTweener::start() {
 
 	if (do_continue) {
 		if (Math::is_zero_approx(delay)) {
-			initial_val = target_instance->get_indexed(property);
+			initial_val = _get_property_value(target_instance);
 		} else {
 			do_continue_delayed = true;
 		}
@@ -566,6 +566,21 @@ void PropertyTweener::start() {
 	delta_val = Animation::subtract_variant(final_val, initial_val);
 }
 
+void PropertyTweener::_set_property_value(Object *p_object, const Variant &p_value) {
+	if (property.size() == 1) {
+		property_cache.set(p_object, p_value);
+	} else {
+		p_object->set_indexed(property, p_value);
+	}
+}
+
+Variant PropertyTweener::_get_property_value(const Object *p_object) {
+	if (property.size() == 1) {
+		return property_cache.get(p_object);
+	}
+	return p_object->get_indexed(property);
+}
+
 bool PropertyTweener::step(double &r_delta) {
 	if (finished) {
 		// This is needed in case there's a parallel Tweener with longer duration.
@@ -582,7 +597,7 @@ bool PropertyTweener::step(double &r_delta) {
 		r_delta = 0;
 		return true;
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
-		initial_val = target_instance->get_indexed(property);
+		initial_val = _get_property_value(target_instance);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
 		do_continue_delayed = false;
 	}
@@ -604,14 +619,14 @@ bool PropertyTweener::step(double &r_delta) {
 				ERR_FAIL_V_MSG(false, vformat("Wrong return type in PropertyTweener custom method. Expected float, got %s.", Variant::get_type_name(result.get_type())));
 			}
 
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+			_set_property_value(target_instance, Animation::interpolate_variant(initial_val, final_val, result));
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			_set_property_value(target_instance, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		}
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_property_value(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SNAME("finished"));
@@ -642,7 +657,10 @@ void PropertyTweener::_bind_methods() {
 PropertyTweener::PropertyTweener(const Object *p_target, const Vector<StringName> &p_property, const Variant &p_to, double p_duration) {
 	target = p_target->get_instance_id();
 	property = p_property;
-	initial_val = p_target->get_indexed(property);
+	if (property.size() == 1) {
+		property_cache.set_member(property[0]);
+	}
+	initial_val = _get_property_value(p_target);
 	base_final_val = p_to;
 	final_val = base_final_val;
 	duration = p_duration;
@@ -31,6 +31,7 @@
 #ifndef TWEEN_H
 #define TWEEN_H
 
+#include "core/object/object_member_cache.h"
 #include "core/object/ref_counted.h"
 
 class Tween;
@@ -215,6 +216,7 @@ protected:
 private:
 	ObjectID target;
 	Vector<StringName> property;
+	ObjectMemberCache property_cache; // For the common single property subpath.
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
@@ -231,6 +233,9 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	void _set_property_value(Object *p_object, const Variant &p_value);
+	Variant _get_property_value(const Object *p_object);
 };
 
 class IntervalTweener : public Tweener {
@@ -80,6 +80,36 @@ void Container::remove_child_notify(Node *p_child) {
 	queue_sort();
 }
 
+LocalVector<ObjectID> Container::sort_queue;
+
+void Container::_flush_sort_queue() {
+	LocalVector<Container *> batch;
+	for (const ObjectID &id : sort_queue) {
+		Container *container = Object::cast_to<Container>(ObjectDB::get_instance(id));
+		if (container && container->pending_sort && container->is_inside_tree()) {
+			batch.push_back(container);
+		}
+	}
+	// Containers queued while sorting this batch go into a new one.
+	sort_queue.clear();
+
+	batch.sort_custom<Node::Comparator>();
+
+	LocalVector<ObjectID> ids;
+	ids.resize(batch.size());
+	for (uint32_t i = 0; i < batch.size(); i++) {
+		ids[i] = batch[i]->get_instance_id();
+	}
+
+	for (const ObjectID &id : ids) {
+		// Sort callbacks may free other containers of the batch.
+		Container *container = Object::cast_to<Container>(ObjectDB::get_instance(id));
+		if (container && container->pending_sort) {
+			container->_sort_children();
+		}
+	}
+}
+
 void Container::_sort_children() {
 	if (!is_inside_tree()) {
 		return;
@@ -137,7 +167,10 @@ void Container::queue_sort() {
 		return;
 	}
 
-	callable_mp(this, &Container::_sort_children).call_deferred();
+	if (sort_queue.is_empty()) {
+		callable_mp_static(&Container::_flush_sort_queue).call_deferred();
+	}
+	sort_queue.push_back(get_instance_id());
 	pending_sort = true;
 }
 
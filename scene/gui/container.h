@@ -38,6 +38,12 @@ class Container : public Control {
 
 	bool pending_sort = false;
 	void _sort_children();
+
+	// Sort requests are batched and processed parents-first, so a nested container resized
+	// by its parent is sorted once per batch rather than once before and once after.
+	static LocalVector<ObjectID> sort_queue;
+	static void _flush_sort_queue();
+
 	void _child_minsize_changed();
 
 protected:
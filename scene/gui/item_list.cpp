@@ -54,6 +54,11 @@ void ItemList::_shape_text(int p_idx) {
 	item.text_buf->set_max_lines_visible(max_text_lines);
 }
 
+void ItemList::_item_min_size_changed(int p_idx) {
+	items.write[p_idx].min_size_dirty = true;
+	layout_changed = true;
+}
+
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
 	Item item;
 	item.icon = p_texture;
@@ -66,7 +71,7 @@ int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bo
 	_shape_text(items.size() - 1);
 
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	notify_property_list_changed();
 	return item_id;
 }
@@ -79,7 +84,7 @@ int ItemList::add_icon_item(const Ref<Texture2D> &p_item, bool p_selectable) {
 	int item_id = items.size() - 1;
 
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	notify_property_list_changed();
 	return item_id;
 }
@@ -98,7 +103,7 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 	items.write[p_idx].xl_text = atr(p_text);
 	_shape_text(p_idx);
 	queue_redraw();
-	shape_changed = true;
+	_item_min_size_changed(p_idx);
 }
 
 String ItemList::get_item_text(int p_idx) const {
@@ -116,6 +121,7 @@ void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_
 		items.write[p_idx].text_direction = p_text_direction;
 		_shape_text(p_idx);
 		queue_redraw();
+		_item_min_size_changed(p_idx);
 	}
 }
 
@@ -133,6 +139,7 @@ void ItemList::set_item_language(int p_idx, const String &p_language) {
 		items.write[p_idx].language = p_language;
 		_shape_text(p_idx);
 		queue_redraw();
+		_item_min_size_changed(p_idx);
 	}
 }
 
@@ -166,7 +173,6 @@ void ItemList::set_item_tooltip(int p_idx, const String &p_tooltip) {
 
 	items.write[p_idx].tooltip = p_tooltip;
 	queue_redraw();
-	shape_changed = true;
 }
 
 String ItemList::get_item_tooltip(int p_idx) const {
@@ -186,7 +192,7 @@ void ItemList::set_item_icon(int p_idx, const Ref<Texture2D> &p_icon) {
 
 	items.write[p_idx].icon = p_icon;
 	queue_redraw();
-	shape_changed = true;
+	_item_min_size_changed(p_idx);
 }
 
 Ref<Texture2D> ItemList::get_item_icon(int p_idx) const {
@@ -207,7 +213,7 @@ void ItemList::set_item_icon_transposed(int p_idx, const bool p_transposed) {
 
 	items.write[p_idx].icon_transposed = p_transposed;
 	queue_redraw();
-	shape_changed = true;
+	_item_min_size_changed(p_idx);
 }
 
 bool ItemList::is_item_icon_transposed(int p_idx) const {
@@ -228,7 +234,7 @@ void ItemList::set_item_icon_region(int p_idx, const Rect2 &p_region) {
 
 	items.write[p_idx].icon_region = p_region;
 	queue_redraw();
-	shape_changed = true;
+	_item_min_size_changed(p_idx);
 }
 
 Rect2 ItemList::get_item_icon_region(int p_idx) const {
@@ -321,7 +327,6 @@ void ItemList::set_item_tag_icon(int p_idx, const Ref<Texture2D> &p_tag_icon) {
 
 	items.write[p_idx].tag_icon = p_tag_icon;
 	queue_redraw();
-	shape_changed = true;
 }
 
 void ItemList::set_item_selectable(int p_idx, bool p_selectable) {
@@ -369,7 +374,6 @@ void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
 
 	items.write[p_idx].metadata = p_metadata;
 	queue_redraw();
-	shape_changed = true;
 }
 
 Variant ItemList::get_item_metadata(int p_idx) const {
@@ -461,7 +465,7 @@ void ItemList::move_item(int p_from_idx, int p_to_idx) {
 	items.insert(p_to_idx, item);
 
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	notify_property_list_changed();
 }
 
@@ -474,7 +478,7 @@ void ItemList::set_item_count(int p_count) {
 
 	items.resize(p_count);
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	notify_property_list_changed();
 }
 
@@ -490,7 +494,7 @@ void ItemList::remove_item(int p_idx) {
 		current = -1;
 	}
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	defer_select_single = -1;
 	notify_property_list_changed();
 }
@@ -500,7 +504,7 @@ void ItemList::clear() {
 	current = -1;
 	ensure_selected_visible = false;
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 	defer_select_single = -1;
 	notify_property_list_changed();
 }
@@ -1326,7 +1330,7 @@ void ItemList::_notification(int p_what) {
 }
 
 void ItemList::force_update_list_size() {
-	if (!shape_changed) {
+	if (!shape_changed && !layout_changed) {
 		return;
 	}
 
@@ -1336,6 +1340,13 @@ void ItemList::force_update_list_size() {
 
 	//1- compute item minimum sizes
 	for (int i = 0; i < items.size(); i++) {
+		// With same_column_width the text wraps to the width of the previous layout, so it always has to be measured again.
+		if (!shape_changed && !items[i].min_size_dirty && !(same_column_width && !items[i].text.is_empty())) {
+			items.write[i].rect_cache.size = items[i].min_rect_cache.size;
+			max_column_width = MAX(max_column_width, items[i].min_rect_cache.size.x - theme_cache.h_separation);
+			continue;
+		}
+
 		Size2 minsize;
 		if (items[i].icon.is_valid()) {
 			if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
@@ -1387,6 +1398,7 @@ void ItemList::force_update_list_size() {
 		minsize.x += theme_cache.h_separation;
 		items.write[i].rect_cache.size = minsize;
 		items.write[i].min_rect_cache.size = minsize;
+		items.write[i].min_size_dirty = false;
 	}
 
 	int fit_size = size.x - theme_cache.panel_style->get_minimum_size().width - scroll_bar_minwidth;
@@ -1468,6 +1480,7 @@ void ItemList::force_update_list_size() {
 
 	update_minimum_size();
 	shape_changed = false;
+	layout_changed = false;
 }
 
 void ItemList::_scroll_changed(double) {
@@ -1559,7 +1572,7 @@ String ItemList::get_tooltip(const Point2 &p_pos) const {
 void ItemList::sort_items_by_text() {
 	items.sort();
 	queue_redraw();
-	shape_changed = true;
+	layout_changed = true;
 
 	if (select_mode == SELECT_SINGLE) {
 		for (int i = 0; i < items.size(); i++) {
@@ -75,6 +75,8 @@ private:
 		int column = 0;
 		Rect2 rect_cache;
 		Rect2 min_rect_cache;
+		// Set when something affecting this item's own minimum size changes, so relayouts only re-measure dirty items.
+		bool min_size_dirty = true;
 
 		Size2 get_icon_size() const;
 
@@ -93,7 +95,8 @@ private:
 	int current = -1;
 	int hovered = -1;
 
-	bool shape_changed = true;
+	bool shape_changed = true; // Every item needs to be measured again.
+	bool layout_changed = false; // Only items flagged with min_size_dirty need to be measured again.
 
 	bool ensure_selected_visible = false;
 	bool same_column_width = false;
@@ -156,6 +159,7 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	void _item_min_size_changed(int p_idx);
 	void _mouse_exited();
 
 protected:
@@ -33,9 +33,37 @@
 #include "scene/main/timer.h"
 
 Error HTTPRequest::_request() {
+	connection_reused = false;
+	if (reuse_connections && client->get_status() == HTTPClient::STATUS_CONNECTED && connected_url == url && connected_port == port && connected_tls == use_tls && connected_tls_options == tls_options) {
+		client->poll(); // Notice if the server closed the idle connection.
+		if (client->get_status() == HTTPClient::STATUS_CONNECTED) {
+			connection_reused = true;
+			return OK;
+		}
+	}
+	connected_url = url;
+	connected_port = port;
+	connected_tls = use_tls;
+	connected_tls_options = tls_options;
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+bool HTTPRequest::_retry_fresh_connection() {
+	// The server may drop an idle keep-alive connection at any time, retry once on a new one before failing.
+	if (!connection_reused || got_response) {
+		return false;
+	}
+	client->close();
+	request_sent = false;
+	return _request() == OK;
+}
+
+void HTTPRequest::_close_idle_connection() {
+	if (!requesting) {
+		client->close();
+	}
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -199,7 +227,10 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	// A connection is only left open once the response has been fully read.
+	if (!reuse_connections || client->get_status() != HTTPClient::STATUS_CONNECTED) {
+		client->close();
+	}
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -290,6 +321,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_fresh_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -342,6 +376,9 @@ bool HTTPRequest::_update_connection() {
 				int size = request_data.size();
 				Error err = client->request(method, request_string, headers, size > 0 ? request_data.ptr() : nullptr, size);
 				if (err != OK) {
+					if (_retry_fresh_connection()) {
+						return false;
+					}
 					_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 					return true;
 				}
@@ -408,10 +445,11 @@ bool HTTPRequest::_update_connection() {
 					int w = 0;
 					Error err = decompressor->put_partial_data(compressed.ptr() + pos, left, w);
 					if (err == OK) {
-						PackedByteArray dc;
-						dc.resize(decompressor->get_available_bytes());
-						err = decompressor->get_data(dc.ptrw(), dc.size());
-						chunk.append_array(dc);
+						// Decompress straight into the chunk, without an intermediate buffer.
+						int chunk_size = chunk.size();
+						int available = decompressor->get_available_bytes();
+						chunk.resize(chunk_size + available);
+						err = decompressor->get_data(chunk.ptrw() + chunk_size, available);
 					}
 					if (err != OK) {
 						_defer_done(RESULT_BODY_DECOMPRESS_FAILED, response_code, response_headers, PackedByteArray());
@@ -461,6 +499,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_fresh_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -504,6 +545,7 @@ void HTTPRequest::_notification(int p_what) {
 }
 
 void HTTPRequest::set_use_threads(bool p_use) {
+	_close_idle_connection();
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 #ifdef THREADS_ENABLED
 	use_threads.set_to(p_use);
@@ -522,6 +564,17 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_reuse_connections(bool p_enable) {
+	reuse_connections = p_enable;
+	if (!reuse_connections) {
+		_close_idle_connection();
+	}
+}
+
+bool HTTPRequest::is_reusing_connections() const {
+	return reuse_connections;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -543,6 +596,7 @@ String HTTPRequest::get_download_file() const {
 }
 
 void HTTPRequest::set_download_chunk_size(int p_chunk_size) {
+	_close_idle_connection();
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
 	client->set_read_chunk_size(p_chunk_size);
@@ -573,10 +627,12 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	_close_idle_connection();
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	_close_idle_connection();
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -613,6 +669,9 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_reuse_connections", "enable"), &HTTPRequest::set_reuse_connections);
+	ClassDB::bind_method(D_METHOD("is_reusing_connections"), &HTTPRequest::is_reusing_connections);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -638,6 +697,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reuse_connections"), "set_reuse_connections", "is_reusing_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
@@ -79,6 +79,14 @@ private:
 	SafeFlag use_threads;
 	bool accept_gzip = true;
 
+	// Keep-alive: the connection left open by the previous request, reused when the next one targets the same server.
+	bool reuse_connections = false;
+	bool connection_reused = false;
+	String connected_url;
+	int connected_port = 0;
+	bool connected_tls = false;
+	Ref<TLSOptions> connected_tls_options;
+
 	bool got_response = false;
 	int response_code = 0;
 	Vector<String> response_headers;
@@ -96,6 +104,8 @@ private:
 	int redirections = 0;
 
 	bool _update_connection();
+	bool _retry_fresh_connection();
+	void _close_idle_connection();
 
 	int max_redirects = 8;
 
@@ -136,6 +146,9 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_reuse_connections(bool p_enable);
+	bool is_reusing_connections() const;
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
@@ -69,6 +69,66 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 #define ENCODE_16 1 << 6
 #define ENCODE_32 2 << 6
 #define ENCODE_64 3 << 6
+
+// Floating point scalars and vectors are stored as their raw components, in 32 bits
+// when that is lossless and 64 bits otherwise, without the marshalling header.
+static int _get_float_component_count(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return 1;
+		case Variant::VECTOR2:
+			return 2;
+		case Variant::VECTOR3:
+			return 3;
+		case Variant::QUATERNION:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+static void _get_float_components(const Variant &p_variant, double *r_components) {
+	switch (p_variant.get_type()) {
+		case Variant::FLOAT: {
+			r_components[0] = p_variant;
+		} break;
+		case Variant::VECTOR2: {
+			Vector2 v = p_variant;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+		} break;
+		case Variant::VECTOR3: {
+			Vector3 v = p_variant;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+		} break;
+		case Variant::QUATERNION: {
+			Quaternion q = p_variant;
+			r_components[0] = q.x;
+			r_components[1] = q.y;
+			r_components[2] = q.z;
+			r_components[3] = q.w;
+		} break;
+		default: {
+		} break;
+	}
+}
+
+static Variant _make_from_float_components(Variant::Type p_type, const double *p_components) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return p_components[0];
+		case Variant::VECTOR2:
+			return Vector2(p_components[0], p_components[1]);
+		case Variant::VECTOR3:
+			return Vector3(p_components[0], p_components[1], p_components[2]);
+		case Variant::QUATERNION:
+			return Quaternion(p_components[0], p_components[1], p_components[2], p_components[3]);
+		default:
+			return Variant();
+	}
+}
 Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_allow_object_decoding) {
 	// Unreachable because `VARIANT_MAX` == 38 and `ENCODE_VARIANT_MASK` == 77
 	CRASH_COND(p_variant.get_type() > VARIANT_META_TYPE_MASK);
@@ -128,6 +188,33 @@ Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint
 				buf[0] = encode_mode | p_variant.get_type();
 			}
 		} break;
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::QUATERNION: {
+			const int count = _get_float_component_count(p_variant.get_type());
+			double components[4];
+			_get_float_components(p_variant, components);
+			bool use_32 = true;
+			for (int i = 0; i < count; i++) {
+				if ((double)(float)components[i] != components[i]) {
+					use_32 = false; // Also the case for NaN, which is kept as is in 64 bits.
+					break;
+				}
+			}
+			encode_mode = use_32 ? ENCODE_32 : ENCODE_64;
+			if (buf) {
+				buf[0] = encode_mode | p_variant.get_type();
+				for (int i = 0; i < count; i++) {
+					if (use_32) {
+						encode_float(components[i], &buf[1 + i * 4]);
+					} else {
+						encode_double(components[i], &buf[1 + i * 8]);
+					}
+				}
+			}
+			r_len += 1 + count * (use_32 ? 4 : 8);
+		} break;
 		default:
 			// Any other case is not yet compressed.
 			Error err = encode_variant(p_variant, r_buffer, r_len, p_allow_object_decoding);
@@ -202,6 +289,23 @@ Error MultiplayerAPI::decode_and_decompress_variant(Variant &r_variant, const ui
 				}
 			}
 		} break;
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::QUATERNION: {
+			const int count = _get_float_component_count(Variant::Type(type));
+			const int size = encode_mode == ENCODE_32 ? 4 : 8;
+			ERR_FAIL_COND_V(encode_mode != ENCODE_32 && encode_mode != ENCODE_64, ERR_INVALID_DATA);
+			ERR_FAIL_COND_V(len < 1 + count * size, ERR_INVALID_DATA);
+			double components[4];
+			for (int i = 0; i < count; i++) {
+				components[i] = size == 4 ? (double)decode_float(&buf[1 + i * 4]) : decode_double(&buf[1 + i * 8]);
+			}
+			r_variant = _make_from_float_components(Variant::Type(type), components);
+			if (r_len) {
+				*r_len = 1 + count * size;
+			}
+		} break;
 		default:
 			Error err = decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
 			if (err != OK) {
@@ -266,15 +370,12 @@ Error MultiplayerAPI::decode_and_decompress_variants(Vector<Variant> &r_variants
 		return OK;
 	}
 
-	Vector<Variant> args;
-	Vector<const Variant *> argp;
-	args.resize(argc);
-
+	Variant *variants = r_variants.ptrw();
 	for (int i = 0; i < argc; i++) {
 		ERR_FAIL_COND_V_MSG(r_len >= p_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
 
 		int vlen;
-		Error err = MultiplayerAPI::decode_and_decompress_variant(r_variants.write[i], &p_buffer[r_len], p_len - r_len, &vlen, p_allow_object_decoding);
+		Error err = MultiplayerAPI::decode_and_decompress_variant(variants[i], &p_buffer[r_len], p_len - r_len, &vlen, p_allow_object_decoding);
 		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
 		r_len += vlen;
 	}
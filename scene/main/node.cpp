@@ -54,11 +54,22 @@ thread_local Node *Node::current_process_thread_group = nullptr;
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
 		case NOTIFICATION_PROCESS: {
-			GDVIRTUAL_CALL(_process, get_process_delta_time());
+			double delta = get_process_delta_time();
+			if (data.process_interval > 1) {
+				// Time since this node last processed, not just this frame.
+				delta = data.process_delta_accum;
+				data.process_delta_accum = 0.0;
+			}
+			GDVIRTUAL_CALL(_process, delta);
 		} break;
 
 		case NOTIFICATION_PHYSICS_PROCESS: {
-			GDVIRTUAL_CALL(_physics_process, get_physics_process_delta_time());
+			double delta = get_physics_process_delta_time();
+			if (data.physics_process_interval > 1) {
+				delta = data.physics_process_delta_accum;
+				data.physics_process_delta_accum = 0.0;
+			}
+			GDVIRTUAL_CALL(_physics_process, delta);
 		} break;
 
 		case NOTIFICATION_ENTER_TREE: {
@@ -258,7 +269,9 @@ void Node::_propagate_ready() {
 	if (data.ready_first) {
 		data.ready_first = false;
 		notification(NOTIFICATION_READY);
-		emit_signal(SceneStringNames::get_singleton()->ready);
+		if (has_signal_connections(SceneStringNames::get_singleton()->ready)) {
+			emit_signal(SceneStringNames::get_singleton()->ready);
+		}
 	}
 }
 
@@ -287,11 +300,14 @@ void Node::_propagate_enter_tree() {
 
 	GDVIRTUAL_CALL(_enter_tree);
 
-	emit_signal(SceneStringNames::get_singleton()->tree_entered);
+	// Unconnected signals are skipped, this is called for every node of every instantiated scene.
+	if (has_signal_connections(SceneStringNames::get_singleton()->tree_entered)) {
+		emit_signal(SceneStringNames::get_singleton()->tree_entered);
+	}
 
 	data.tree->node_added(this);
 
-	if (data.parent) {
+	if (data.parent && data.parent->has_signal_connections(SNAME("child_entered_tree"))) {
 		Variant c = this;
 		const Variant *cptr = &c;
 		data.parent->emit_signalp(SNAME("child_entered_tree"), &cptr, 1);
@@ -309,7 +325,10 @@ void Node::_propagate_enter_tree() {
 	data.blocked--;
 
 #ifdef DEBUG_ENABLED
-	SceneDebugger::add_to_cache(data.scene_file_path, this);
+	if (!data.scene_file_path.is_empty()) {
+		// Only add if file path is set (optimization).
+		SceneDebugger::add_to_cache(data.scene_file_path, this);
+	}
 #endif
 	// enter groups
 }
@@ -342,7 +361,9 @@ void Node::_propagate_after_exit_tree() {
 
 	data.blocked--;
 
-	emit_signal(SceneStringNames::get_singleton()->tree_exited);
+	if (has_signal_connections(SceneStringNames::get_singleton()->tree_exited)) {
+		emit_signal(SceneStringNames::get_singleton()->tree_exited);
+	}
 }
 
 void Node::_propagate_exit_tree() {
@@ -364,14 +385,16 @@ void Node::_propagate_exit_tree() {
 
 	GDVIRTUAL_CALL(_exit_tree);
 
-	emit_signal(SceneStringNames::get_singleton()->tree_exiting);
+	if (has_signal_connections(SceneStringNames::get_singleton()->tree_exiting)) {
+		emit_signal(SceneStringNames::get_singleton()->tree_exiting);
+	}
 
 	notification(NOTIFICATION_EXIT_TREE, true);
 	if (data.tree) {
 		data.tree->node_removed(this);
 	}
 
-	if (data.parent) {
+	if (data.parent && data.parent->has_signal_connections(SNAME("child_exiting_tree"))) {
 		Variant c = this;
 		const Variant *cptr = &c;
 		data.parent->emit_signalp(SNAME("child_exiting_tree"), &cptr, 1);
@@ -984,6 +1007,45 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+// Phases are handed out round-robin, so nodes sharing an interval don't all tick on the same frame.
+static uint32_t process_interval_phase_counter = 0;
+
+void Node::set_process_interval(int p_interval) {
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(p_interval < 1, "The process interval must be at least 1 frame.");
+	if (data.process_interval == p_interval) {
+		return;
+	}
+	if (data.process_interval <= 1 && data.physics_process_interval <= 1) {
+		data.process_interval_phase = process_interval_phase_counter++;
+	}
+	data.process_interval = p_interval;
+	data.process_delta_accum = 0.0;
+}
+
+int Node::get_process_interval() const {
+	ERR_READ_THREAD_GUARD_V(1);
+	return data.process_interval;
+}
+
+void Node::set_physics_process_interval(int p_interval) {
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(p_interval < 1, "The physics process interval must be at least 1 frame.");
+	if (data.physics_process_interval == p_interval) {
+		return;
+	}
+	if (data.process_interval <= 1 && data.physics_process_interval <= 1) {
+		data.process_interval_phase = process_interval_phase_counter++;
+	}
+	data.physics_process_interval = p_interval;
+	data.physics_process_delta_accum = 0.0;
+}
+
+int Node::get_physics_process_interval() const {
+	ERR_READ_THREAD_GUARD_V(1);
+	return data.physics_process_interval;
+}
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -3456,6 +3518,10 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
 	ClassDB::bind_method(D_METHOD("set_physics_process_priority", "priority"), &Node::set_physics_process_priority);
 	ClassDB::bind_method(D_METHOD("get_physics_process_priority"), &Node::get_physics_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_interval", "interval"), &Node::set_process_interval);
+	ClassDB::bind_method(D_METHOD("get_process_interval"), &Node::get_process_interval);
+	ClassDB::bind_method(D_METHOD("set_physics_process_interval", "interval"), &Node::set_physics_process_interval);
+	ClassDB::bind_method(D_METHOD("get_physics_process_interval"), &Node::get_physics_process_interval);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -3666,6 +3732,8 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_physics_priority"), "set_physics_process_priority", "get_physics_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater,suffix:frames"), "set_process_interval", "get_process_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_physics_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater,suffix:ticks"), "set_physics_process_interval", "get_physics_process_interval");
 
 	ADD_SUBGROUP("Thread Group", "process_thread");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
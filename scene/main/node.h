@@ -202,6 +202,13 @@ private:
 		int process_priority = 0;
 		int physics_process_priority = 0;
 
+		// Reduced tick rates: the callbacks run every N frames with the summed delta, nodes are spread over the N frames.
+		int process_interval = 1;
+		int physics_process_interval = 1;
+		uint32_t process_interval_phase = 0;
+		double process_delta_accum = 0.0;
+		double physics_process_delta_accum = 0.0;
+
 		bool physics_process_internal = false;
 		bool process_internal = false;
 
@@ -539,6 +546,22 @@ public:
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
+	void set_process_interval(int p_interval);
+	int get_process_interval() const;
+
+	void set_physics_process_interval(int p_interval);
+	int get_physics_process_interval() const;
+
+	// Called by SceneTree every frame the node processes, returns whether NOTIFICATION_(PHYSICS_)PROCESS is due.
+	_FORCE_INLINE_ bool _is_process_tick_due(bool p_physics, double p_delta, uint64_t p_frame) {
+		int interval = p_physics ? data.physics_process_interval : data.process_interval;
+		if (likely(interval <= 1)) {
+			return true;
+		}
+		(p_physics ? data.physics_process_delta_accum : data.process_delta_accum) += p_delta;
+		return (p_frame + data.process_interval_phase) % uint64_t(interval) == 0;
+	}
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*  node_pool.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "node_pool.h"
+
+#include "core/core_string_names.h"
+
+void NodePool::_snapshot_node(Node *p_root, Node *p_node) {
+	NodeSnapshot node_snapshot;
+	node_snapshot.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE)) || E.name == CoreStringNames::get_singleton()->_script) {
+			continue;
+		}
+
+		Variant value = p_node->get(E.name);
+		if (value.get_type() == Variant::OBJECT) {
+			// Resources local to scene are unique to each instance, and other objects (nodes) can't be shared either.
+			Ref<Resource> res = value;
+			if (res.is_null() ? value.get_validated_object() != nullptr : res->is_local_to_scene()) {
+				continue;
+			}
+		} else if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate(true);
+		}
+		node_snapshot.properties.push_back(Pair<StringName, Variant>(E.name, value));
+	}
+	snapshot.push_back(node_snapshot);
+
+	// Only nodes that are part of the scene, internal children are handled by their parents.
+	for (int i = 0; i < p_node->get_child_count(false); i++) {
+		Node *child = p_node->get_child(i, false);
+		if (child->get_owner()) {
+			_snapshot_node(p_root, child);
+		}
+	}
+}
+
+void NodePool::_take_snapshot(Node *p_root) {
+	snapshot.clear();
+	_snapshot_node(p_root, p_root);
+	snapshot_valid = true;
+}
+
+void NodePool::_free_unowned_children(Node *p_node) {
+	for (int i = p_node->get_child_count(false) - 1; i >= 0; i--) {
+		Node *child = p_node->get_child(i, false);
+		if (child->get_owner()) {
+			_free_unowned_children(child);
+		} else {
+			// Added after instantiation, a fresh instance wouldn't have it.
+			p_node->remove_child(child);
+			memdelete(child);
+		}
+	}
+}
+
+void NodePool::_reset(Node *p_root) {
+	_free_unowned_children(p_root);
+
+	// Only write what changed, so releasing an instance that was barely touched is cheap.
+	for (const NodeSnapshot &node_snapshot : snapshot) {
+		Node *node = p_root->get_node_or_null(node_snapshot.path);
+		if (!node) {
+			continue;
+		}
+
+		for (const Pair<StringName, Variant> &E : node_snapshot.properties) {
+			if (node->get(E.first) == E.second) {
+				continue;
+			}
+			if (E.second.get_type() == Variant::ARRAY || E.second.get_type() == Variant::DICTIONARY) {
+				node->set(E.first, E.second.duplicate(true));
+			} else {
+				node->set(E.first, E.second);
+			}
+		}
+	}
+
+	p_root->request_ready();
+}
+
+Node *NodePool::_create() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "A scene must be set before using the pool.");
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	if (!snapshot_valid) {
+		_take_snapshot(node);
+	}
+	return node;
+}
+
+void NodePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+
+	clear();
+	snapshot.clear();
+	snapshot_valid = false;
+	scene = p_scene;
+}
+
+Ref<PackedScene> NodePool::get_scene() const {
+	return scene;
+}
+
+void NodePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+
+	while (available.size() > uint32_t(max_size)) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(available[available.size() - 1]));
+		available.resize(available.size() - 1);
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+}
+
+int NodePool::get_max_size() const {
+	return max_size;
+}
+
+int NodePool::get_available_count() const {
+	return available.size();
+}
+
+Node *NodePool::acquire() {
+	while (available.size()) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(available[available.size() - 1]));
+		available.resize(available.size() - 1);
+		if (node && !node->is_queued_for_deletion() && !node->get_parent()) {
+			return node;
+		}
+	}
+
+	return _create();
+}
+
+void NodePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(scene.is_valid() && !scene->get_path().is_empty() && p_node->get_scene_file_path() != scene->get_path(), vformat("Node \"%s\" was not instantiated from the scene of this pool.", p_node->get_name()));
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release a node that is queued for deletion.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	if (!snapshot_valid || available.size() >= uint32_t(max_size)) {
+		memdelete(p_node);
+		return;
+	}
+
+	_reset(p_node);
+	available.push_back(p_node->get_instance_id());
+}
+
+void NodePool::prefill(int p_count) {
+	while (available.size() < uint32_t(MIN(p_count, max_size))) {
+		Node *node = _create();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+void NodePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+	available.clear();
+}
+
+void NodePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &NodePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &NodePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &NodePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &NodePool::get_max_size);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &NodePool::get_available_count);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &NodePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &NodePool::release);
+	ClassDB::bind_method(D_METHOD("prefill", "count"), &NodePool::prefill);
+	ClassDB::bind_method(D_METHOD("clear"), &NodePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+NodePool::~NodePool() {
+	clear();
+}
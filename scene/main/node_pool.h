@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  node_pool.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include "scene/resources/packed_scene.h"
+
+class NodePool : public RefCounted {
+	GDCLASS(NodePool, RefCounted);
+
+	// Stored properties of one scene node right after instantiation, used to reset released instances.
+	struct NodeSnapshot {
+		NodePath path;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 64;
+
+	LocalVector<ObjectID> available;
+	LocalVector<NodeSnapshot> snapshot;
+	bool snapshot_valid = false;
+
+	void _take_snapshot(Node *p_root);
+	void _snapshot_node(Node *p_root, Node *p_node);
+	void _free_unowned_children(Node *p_node);
+	void _reset(Node *p_root);
+	Node *_create();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	int get_available_count() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prefill(int p_count);
+	void clear();
+
+	~NodePool();
+};
+
+#endif // NODE_POOL_H
@@ -30,6 +30,7 @@
 
 #include "scene_tree.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
@@ -38,6 +39,7 @@
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/object_member_cache.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
@@ -125,7 +127,9 @@ void SceneTree::tree_changed() {
 }
 
 void SceneTree::node_added(Node *p_node) {
-	emit_signal(node_added_name, p_node);
+	if (has_signal_connections(node_added_name)) {
+		emit_signal(node_added_name, p_node);
+	}
 }
 
 void SceneTree::node_removed(Node *p_node) {
@@ -133,7 +137,9 @@ void SceneTree::node_removed(Node *p_node) {
 	if (current_scene == p_node) {
 		current_scene = nullptr;
 	}
-	emit_signal(node_removed_name, p_node);
+	if (has_signal_connections(node_removed_name)) {
+		emit_signal(node_removed_name, p_node);
+	}
 	if (nodes_removed_on_group_call_lock) {
 		nodes_removed_on_group_call.insert(p_node);
 	}
@@ -181,6 +187,8 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_change_epoch++;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -270,6 +278,9 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	Node **gr_nodes = nodes_copy.ptrw();
 	int gr_node_count = nodes_copy.size();
 
+	// Group members are usually of the same few classes, so resolve the method once instead of per node.
+	ObjectMemberCache method_cache(p_function);
+
 	{
 		_THREAD_SAFE_METHOD_
 		nodes_removed_on_group_call_lock++;
@@ -283,7 +294,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				method_cache.call(gr_nodes[i], p_args, p_argcount, ce);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -297,7 +308,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				method_cache.call(gr_nodes[i], p_args, p_argcount, ce);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -396,6 +407,8 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 	Node **gr_nodes = nodes_copy.ptrw();
 	int gr_node_count = nodes_copy.size();
 
+	ObjectMemberCache property_cache(p_name);
+
 	{
 		_THREAD_SAFE_METHOD_
 		nodes_removed_on_group_call_lock++;
@@ -408,7 +421,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
+				property_cache.set(gr_nodes[i], p_value);
 			} else {
 				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
 			}
@@ -421,7 +434,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
+				property_cache.set(gr_nodes[i], p_value);
 			} else {
 				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
 			}
@@ -721,6 +734,23 @@ bool SceneTree::is_node_being_edited(const Node *p_node) const {
 }
 #endif
 
+void SceneTree::set_physics_interpolation_enabled(bool p_enabled) {
+	// Disabled in the editor, where transforms have to follow the gizmos right away.
+	p_enabled = p_enabled && !Engine::get_singleton()->is_editor_hint();
+	if (physics_interpolation == p_enabled) {
+		return;
+	}
+
+	physics_interpolation = p_enabled;
+	if (root) {
+		root->propagate_notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+	}
+}
+
+bool SceneTree::is_physics_interpolation_enabled() const {
+	return physics_interpolation;
+}
+
 #ifdef DEBUG_ENABLED
 void SceneTree::set_debug_collisions_hint(bool p_enabled) {
 	debug_collisions_hint = p_enabled;
@@ -928,6 +958,9 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	uint32_t node_count = nodes_copy.size();
 	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 
+	double delta = p_physics ? physics_process_time : process_time;
+	uint64_t frame = p_physics ? Engine::get_singleton()->get_physics_frames() : Engine::get_singleton()->get_process_frames();
+
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
 		if (nodes_removed_on_group_call.has(n)) {
@@ -944,14 +977,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			if (n->is_physics_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 			}
-			if (n->is_physics_processing()) {
+			if (n->is_physics_processing() && n->_is_process_tick_due(true, delta, frame)) {
 				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
 			}
 		} else {
 			if (n->is_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
 			}
-			if (n->is_processing()) {
+			if (n->is_processing() && n->_is_process_tick_due(false, delta, frame)) {
 				n->notification(Node::NOTIFICATION_PROCESS);
 			}
 		}
@@ -1646,6 +1679,8 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_multiplayer", "for_path"), &SceneTree::get_multiplayer, DEFVAL(NodePath()));
 	ClassDB::bind_method(D_METHOD("set_multiplayer_poll_enabled", "enabled"), &SceneTree::set_multiplayer_poll_enabled);
 	ClassDB::bind_method(D_METHOD("is_multiplayer_poll_enabled"), &SceneTree::is_multiplayer_poll_enabled);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolation_enabled", "enabled"), &SceneTree::set_physics_interpolation_enabled);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolation_enabled"), &SceneTree::is_physics_interpolation_enabled);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_accept_quit"), "set_auto_accept_quit", "is_auto_accept_quit");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "quit_on_go_back"), "set_quit_on_go_back", "is_quit_on_go_back");
@@ -1653,6 +1688,7 @@ void SceneTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_paths_hint"), "set_debug_paths_hint", "is_debugging_paths_hint");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_navigation_hint"), "set_debug_navigation_hint", "is_debugging_navigation_hint");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "paused"), "set_pause", "is_paused");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "physics_interpolation"), "set_physics_interpolation_enabled", "is_physics_interpolation_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "edited_scene_root", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_edited_scene_root", "get_edited_scene_root");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "current_scene", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_current_scene", "get_current_scene");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "root", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "", "get_root");
@@ -1885,6 +1921,7 @@ SceneTree::SceneTree() {
 #endif // _3D_DISABLED
 
 	root->set_physics_object_picking(GLOBAL_DEF("physics/common/enable_object_picking", true));
+	set_physics_interpolation_enabled(GLOBAL_DEF("physics/common/physics_interpolation", false));
 
 	root->connect("close_requested", callable_mp(this, &SceneTree::_main_window_close));
 	root->connect("go_back_requested", callable_mp(this, &SceneTree::_main_window_go_back));
@@ -127,6 +127,7 @@ private:
 	double process_time = 0.0;
 	bool accept_quit = true;
 	bool quit_on_go_back = true;
+	bool physics_interpolation = false;
 
 #ifdef DEBUG_ENABLED
 	bool debug_collisions_hint = false;
@@ -234,6 +235,9 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Bumped whenever queued transform notifications may no longer match the dirty state of the nodes (on flush, or
+	// when a node starts wanting notifications). While it doesn't change, a dirty Node3D subtree needs no new propagation.
+	uint32_t xform_change_epoch = 0;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -267,7 +271,8 @@ protected:
 
 public:
 	enum {
-		NOTIFICATION_TRANSFORM_CHANGED = 2000
+		NOTIFICATION_TRANSFORM_CHANGED = 2000,
+		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 2001,
 	};
 
 	enum GroupCallFlags {
@@ -338,6 +343,9 @@ public:
 	void set_pause(bool p_enabled);
 	bool is_paused() const;
 
+	void set_physics_interpolation_enabled(bool p_enabled);
+	bool is_physics_interpolation_enabled() const;
+
 #ifdef DEBUG_ENABLED
 	void set_debug_collisions_hint(bool p_enabled);
 	bool is_debugging_collisions_hint() const;
@@ -4530,6 +4530,30 @@ float Viewport::get_scaling_3d_scale() const {
 	return scaling_3d_scale;
 }
 
+void Viewport::set_scaling_3d_dynamic_target_time(float p_target_time_msec) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_target_time = MAX(p_target_time_msec, 0.0);
+
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic_target_time(viewport, scaling_3d_dynamic_target_time);
+}
+
+float Viewport::get_scaling_3d_dynamic_target_time() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_target_time;
+}
+
+void Viewport::set_scaling_3d_dynamic_min_scale(float p_min_scale) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_min_scale = CLAMP(p_min_scale, 0.1, 1.0);
+
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic_min_scale(viewport, scaling_3d_dynamic_min_scale);
+}
+
+float Viewport::get_scaling_3d_dynamic_min_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_min_scale;
+}
+
 void Viewport::set_fsr_sharpness(float p_fsr_sharpness) {
 	ERR_MAIN_THREAD_GUARD;
 	if (fsr_sharpness == p_fsr_sharpness) {
@@ -4739,6 +4763,12 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_scaling_3d_scale", "scale"), &Viewport::set_scaling_3d_scale);
 	ClassDB::bind_method(D_METHOD("get_scaling_3d_scale"), &Viewport::get_scaling_3d_scale);
 
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_target_time", "target_time_msec"), &Viewport::set_scaling_3d_dynamic_target_time);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_target_time"), &Viewport::get_scaling_3d_dynamic_target_time);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_min_scale", "min_scale"), &Viewport::set_scaling_3d_dynamic_min_scale);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_min_scale"), &Viewport::get_scaling_3d_dynamic_min_scale);
+
 	ClassDB::bind_method(D_METHOD("set_fsr_sharpness", "fsr_sharpness"), &Viewport::set_fsr_sharpness);
 	ClassDB::bind_method(D_METHOD("get_fsr_sharpness"), &Viewport::get_fsr_sharpness);
 
@@ -4776,6 +4806,8 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("Scaling 3D", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "scaling_3d_mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),FSR 2.2 (Slow)"), "set_scaling_3d_mode", "get_scaling_3d_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_scale", "get_scaling_3d_scale");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_target_time", PROPERTY_HINT_RANGE, "0,100,0.01,suffix:ms"), "set_scaling_3d_dynamic_target_time", "get_scaling_3d_dynamic_target_time");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_min_scale", PROPERTY_HINT_RANGE, "0.25,1.0,0.01"), "set_scaling_3d_dynamic_min_scale", "get_scaling_3d_dynamic_min_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), "set_texture_mipmap_bias", "get_texture_mipmap_bias");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), "set_fsr_sharpness", "get_fsr_sharpness");
 	ADD_GROUP("Variable Rate Shading", "vrs_");
@@ -4842,6 +4874,7 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_INFO_OBJECTS_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_PRIMITIVES_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_INFO_BATCH_BREAKS_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_MAX);
 
 	BIND_ENUM_CONSTANT(RENDER_INFO_TYPE_VISIBLE);
@@ -4948,6 +4981,8 @@ Viewport::Viewport() {
 #ifndef _3D_DISABLED
 	set_scaling_3d_mode((Viewport::Scaling3DMode)(int)GLOBAL_GET("rendering/scaling_3d/mode"));
 	set_scaling_3d_scale(GLOBAL_GET("rendering/scaling_3d/scale"));
+	set_scaling_3d_dynamic_target_time(GLOBAL_GET("rendering/scaling_3d/dynamic_target_time"));
+	set_scaling_3d_dynamic_min_scale(GLOBAL_GET("rendering/scaling_3d/dynamic_min_scale"));
 	set_fsr_sharpness((float)GLOBAL_GET("rendering/scaling_3d/fsr_sharpness"));
 	set_texture_mipmap_bias((float)GLOBAL_GET("rendering/textures/default_filters/texture_mipmap_bias"));
 #endif // _3D_DISABLED
@@ -132,6 +132,7 @@ public:
 		RENDER_INFO_OBJECTS_IN_FRAME,
 		RENDER_INFO_PRIMITIVES_IN_FRAME,
 		RENDER_INFO_DRAW_CALLS_IN_FRAME,
+		RENDER_INFO_BATCH_BREAKS_IN_FRAME,
 		RENDER_INFO_MAX
 	};
 
@@ -304,6 +305,8 @@ private:
 
 	Scaling3DMode scaling_3d_mode = SCALING_3D_MODE_BILINEAR;
 	float scaling_3d_scale = 1.0;
+	float scaling_3d_dynamic_target_time = 0.0;
+	float scaling_3d_dynamic_min_scale = 0.5;
 	float fsr_sharpness = 0.2f;
 	float texture_mipmap_bias = 0.0f;
 	bool use_debanding = false;
@@ -567,6 +570,12 @@ public:
 	void set_scaling_3d_scale(float p_scaling_3d_scale);
 	float get_scaling_3d_scale() const;
 
+	void set_scaling_3d_dynamic_target_time(float p_target_time_msec);
+	float get_scaling_3d_dynamic_target_time() const;
+
+	void set_scaling_3d_dynamic_min_scale(float p_min_scale);
+	float get_scaling_3d_dynamic_min_scale() const;
+
 	void set_fsr_sharpness(float p_fsr_sharpness);
 	float get_fsr_sharpness() const;
 
@@ -179,6 +179,32 @@ Vector<real_t> HeightMapShape3D::get_map_data() const {
 	return map_data;
 }
 
+void HeightMapShape3D::update_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data) {
+	ERR_FAIL_COND_MSG(p_region.size.x <= 0 || p_region.size.y <= 0, "The region to update must not be empty.");
+	ERR_FAIL_COND_MSG(!Rect2i(0, 0, map_width, map_depth).encloses(p_region), "The region to update must be inside the height map.");
+	ERR_FAIL_COND_MSG(p_data.size() != p_region.get_area(), "The data size must match the size of the region to update.");
+
+	real_t *w = map_data.ptrw();
+	const real_t *r = p_data.ptr();
+	for (int z = 0; z < p_region.size.y; z++) {
+		real_t *row = w + (p_region.position.y + z) * map_width + p_region.position.x;
+		for (int x = 0; x < p_region.size.x; x++) {
+			real_t val = *r++;
+			row[x] = val;
+			// Only grow the range, shrinking it would need to go through the whole map.
+			min_height = MIN(min_height, val);
+			max_height = MAX(max_height, val);
+		}
+	}
+
+	// Only send the region, so the physics server doesn't rebuild the whole shape.
+	Dictionary d;
+	d["region"] = p_region;
+	d["heights"] = p_data;
+	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
+	Shape3D::_update_shape();
+}
+
 real_t HeightMapShape3D::get_min_height() const {
 	return min_height;
 }
@@ -194,6 +220,7 @@ void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_map_depth"), &HeightMapShape3D::get_map_depth);
 	ClassDB::bind_method(D_METHOD("set_map_data", "data"), &HeightMapShape3D::set_map_data);
 	ClassDB::bind_method(D_METHOD("get_map_data"), &HeightMapShape3D::get_map_data);
+	ClassDB::bind_method(D_METHOD("update_map_data_region", "region", "data"), &HeightMapShape3D::update_map_data_region);
 	ClassDB::bind_method(D_METHOD("get_min_height"), &HeightMapShape3D::get_min_height);
 	ClassDB::bind_method(D_METHOD("get_max_height"), &HeightMapShape3D::get_max_height);
 
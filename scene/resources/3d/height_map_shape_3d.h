@@ -53,6 +53,7 @@ public:
 	int get_map_depth() const;
 	void set_map_data(Vector<real_t> p_new);
 	Vector<real_t> get_map_data() const;
+	void update_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data);
 
 	real_t get_min_height() const;
 	real_t get_max_height() const;
@@ -5110,12 +5110,20 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
+	// Pages are sorted by time, so find the last one starting at or before p_time with a binary search.
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	{
+		uint32_t lo = 0;
+		uint32_t hi = compression.pages.size();
+		while (lo < hi) {
+			uint32_t mid = (lo + hi) / 2;
+			if (compression.pages[mid].time_offset > p_time) {
+				hi = mid;
+			} else {
+				lo = mid + 1;
+			}
 		}
-		page_index = i;
+		page_index = int32_t(lo) - 1;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
@@ -5127,27 +5135,31 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
+	// Time keys are sorted too; find the last packet starting at or before p_time.
 	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
-
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
-
-		if (frame_time > p_time) {
-			break;
+	{
+		uint32_t lo = 1;
+		uint32_t hi = time_key_count;
+		while (lo < hi) {
+			uint32_t mid = (lo + hi) / 2;
+			if (double(time_keys[mid * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+				hi = mid;
+			} else {
+				lo = mid + 1;
+			}
 		}
+		packet_idx = int32_t(lo) - 1;
+	}
 
-		if (key_index) {
-			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
+	if (key_index) {
+		for (int32_t i = 0; i < packet_idx; i++) {
+			(*key_index) += (time_keys[i * 2 + 1] >> 12) + 1;
 		}
-
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
 	}
 
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+	double packet_time = double(base_frame) * frame_to_sec + page_base_time;
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
@@ -30,6 +30,7 @@
 
 #include "audio_stream_wav.h"
 
+#include "core/config/engine.h"
 #include "core/io/file_access.h"
 #include "core/io/marshalls.h"
 
@@ -497,7 +498,10 @@ void AudioStreamWAV::set_data(const Vector<uint8_t> &p_data) {
 	}
 
 	int datalen = p_data.size();
-	if (datalen) {
+	if (datalen && Engine::get_singleton()->is_dedicated_server_mode_enabled()) {
+		// Nothing is ever heard on a dedicated server, only keep the size so the length is still known.
+		data_bytes = datalen;
+	} else if (datalen) {
 		const uint8_t *r = p_data.ptr();
 		int alloc_len = datalen + DATA_PAD * 2;
 		data = memalloc(alloc_len); //alloc with some padding for interpolation
@@ -530,6 +534,7 @@ Error AudioStreamWAV::save_to_wav(const String &p_path) {
 		WARN_PRINT("Saving IMA_ADPC samples are not supported yet");
 		return ERR_UNAVAILABLE;
 	}
+	ERR_FAIL_COND_V_MSG(!data && data_bytes, ERR_UNAVAILABLE, "Sample data is not loaded in dedicated server mode.");
 
 	int sub_chunk_2_size = data_bytes; //Subchunk2Size = Size of data in bytes
 
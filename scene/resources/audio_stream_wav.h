@@ -138,6 +138,7 @@ public:
 	bool is_stereo() const;
 
 	virtual double get_length() const override; //if supported, otherwise return 0
+	virtual uint64_t get_memory_usage() const override { return data_bytes; }
 
 	virtual bool is_monophonic() const override;
 
@@ -30,11 +30,12 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "servers/rendering/rendering_device.h"
 #include "scene/resources/bit_map.h"
 
 Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
-	alpha_cache.unref();
-
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
@@ -75,7 +76,8 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	r_request_normal = false;
 
 #endif
-	if (!(df & FORMAT_BIT_STREAM)) {
+	// Reduced sizes can only be loaded by dropping mipmaps.
+	if (!(df & (FORMAT_BIT_STREAM | FORMAT_BIT_HAS_MIPMAPS))) {
 		p_size_limit = 0;
 	}
 
@@ -88,6 +90,151 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	return OK;
 }
 
+Mutex CompressedTexture2D::streaming_mutex;
+SelfList<CompressedTexture2D>::List CompressedTexture2D::streamed_in_textures;
+uint64_t CompressedTexture2D::streamed_in_total_size = 0;
+
+int CompressedTexture2D::_get_streaming_size_limit() {
+	if (Engine::get_singleton()->is_editor_hint() || !GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		return 0;
+	}
+	return MAX(int(GLOBAL_GET("rendering/textures/streaming/initial_size_limit")), 1);
+}
+
+void CompressedTexture2D::_queue_stream_in() const {
+	if (!is_referenced()) {
+		return; // Not owned by a Ref, the task couldn't keep it alive.
+	}
+
+	MutexLock lock(streaming_mutex);
+	if (!streamed_out || stream_in_queued) {
+		return;
+	}
+	stream_in_queued = true;
+	Ref<CompressedTexture2D> *self = memnew(Ref<CompressedTexture2D>(const_cast<CompressedTexture2D *>(this)));
+	WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_in_task, self, false, SNAME("CompressedTexture2DStreamIn"));
+}
+
+void CompressedTexture2D::_stream_in_task(void *p_userdata) {
+	Ref<CompressedTexture2D> *self = (Ref<CompressedTexture2D> *)p_userdata;
+	(*self)->_stream_in();
+	memdelete(self);
+}
+
+void CompressedTexture2D::_stream_in() {
+	uint32_t generation;
+	String load_path;
+	{
+		MutexLock lock(streaming_mutex);
+		generation = stream_generation;
+		load_path = path_to_file;
+	}
+
+	int lw, lh;
+	Ref<Image> image;
+	image.instantiate();
+	bool request_3d;
+	bool request_normal;
+	bool request_roughness;
+	int mipmap_limit;
+	Error err = _load_data(load_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+
+	if (err == OK) {
+		uint64_t size = image->get_data().size();
+		_make_streaming_room(size);
+
+		RID new_texture = RS::get_singleton()->texture_2d_create(image);
+		MutexLock lock(streaming_mutex);
+		if (generation == stream_generation && streamed_out) {
+			RS::get_singleton()->texture_replace(texture, new_texture);
+			streamed_out = false;
+			streamed_in_size = size;
+			streamed_in_total_size += size;
+			streamed_in_textures.add(&streamed_in_element);
+		} else {
+			// Reloaded meanwhile.
+			RS::get_singleton()->free(new_texture);
+		}
+	}
+
+	MutexLock lock(streaming_mutex);
+	stream_in_queued = false;
+}
+
+void CompressedTexture2D::_make_streaming_room(uint64_t p_size) {
+	uint64_t budget = uint64_t(MAX(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb")), 0)) * 1024 * 1024;
+
+	// Don't push video memory past what the device is currently willing to give us,
+	// the driver would otherwise start evicting resources or failing allocations.
+	RenderingDevice *rd = RS::get_singleton()->get_rendering_device();
+	if (rd) {
+		const uint64_t device_budget = rd->get_memory_budget();
+		if (device_budget > 0) {
+			const uint64_t device_used = rd->get_memory_usage(RenderingDevice::MEMORY_TOTAL);
+			const uint64_t headroom = device_budget > device_used ? device_budget - device_used : 0;
+			MutexLock lock(streaming_mutex);
+			budget = MIN(budget, streamed_in_total_size + headroom);
+		}
+	}
+
+	const int size_limit = _get_streaming_size_limit();
+
+	while (true) {
+		Ref<CompressedTexture2D> victim;
+		uint32_t generation;
+		String load_path;
+		{
+			MutexLock lock(streaming_mutex);
+			if (streamed_in_total_size + p_size <= budget) {
+				return;
+			}
+
+			CompressedTexture2D *lru = nullptr;
+			for (SelfList<CompressedTexture2D> *E = streamed_in_textures.first(); E; E = E->next()) {
+				if (!lru || E->self()->last_used_frame < lru->last_used_frame) {
+					lru = E->self();
+				}
+			}
+			if (!lru) {
+				return; // A single texture bigger than the budget, let it in.
+			}
+
+			streamed_in_textures.remove(&lru->streamed_in_element);
+			streamed_in_total_size -= lru->streamed_in_size;
+			lru->streamed_in_size = 0;
+
+			// It may be getting freed on another thread, in which case there's nothing to reload.
+			if (size_limit == 0 || !lru->reference()) {
+				continue;
+			}
+			victim = Ref<CompressedTexture2D>(lru);
+			lru->unreference();
+			generation = lru->stream_generation;
+			load_path = lru->path_to_file;
+		}
+
+		int lw, lh;
+		Ref<Image> image;
+		image.instantiate();
+		bool request_3d;
+		bool request_normal;
+		bool request_roughness;
+		int mipmap_limit;
+		if (victim->_load_data(load_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit) != OK) {
+			continue;
+		}
+
+		RID new_texture = RS::get_singleton()->texture_2d_create(image);
+		MutexLock lock(streaming_mutex);
+		if (generation == victim->stream_generation && !victim->streamed_out && !victim->streamed_in_element.in_list()) {
+			RS::get_singleton()->texture_replace(victim->texture, new_texture);
+			victim->streamed_out = image->get_width() < victim->w || image->get_height() < victim->h;
+		} else {
+			RS::get_singleton()->free(new_texture);
+		}
+	}
+}
+
 void CompressedTexture2D::set_path(const String &p_path, bool p_take_over) {
 	if (texture.is_valid()) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -125,7 +272,63 @@ Image::Format CompressedTexture2D::get_format() const {
 	return format;
 }
 
+// Dedicated servers never draw, so only the size and format are read and the
+// pixel data is left on disk.
+Error CompressedTexture2D::_load_placeholder(const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Unable to open file: %s.", p_path));
+
+	uint8_t header[4];
+	f->get_buffer(header, 4);
+	if (header[0] != 'G' || header[1] != 'S' || header[2] != 'T' || header[3] != '2') {
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Compressed texture file is corrupt (Bad header).");
+	}
+
+	uint32_t version = f->get_32();
+
+	if (version > FORMAT_VERSION) {
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Compressed texture file is too new.");
+	}
+	int lw = f->get_32();
+	int lh = f->get_32();
+	f->get_32(); // Data format bits.
+	f->get_32(); // Mipmap limit.
+	f->get_32(); // Reserved.
+	f->get_32();
+	f->get_32();
+
+	// Image header, see load_image_from_file().
+	f->get_32(); // Data format.
+	f->get_16(); // Stored width and height.
+	f->get_16();
+	f->get_32(); // Mipmaps.
+	Image::Format image_format = Image::Format(f->get_32());
+	ERR_FAIL_INDEX_V_MSG(image_format, Image::FORMAT_MAX, ERR_FILE_CORRUPT, "Compressed texture file is corrupt (Bad image format).");
+
+	alpha_cache.unref();
+	if (texture.is_valid()) {
+		RID new_texture = RS::get_singleton()->texture_2d_placeholder_create();
+		RS::get_singleton()->texture_replace(texture, new_texture);
+	} else {
+		texture = RS::get_singleton()->texture_2d_placeholder_create();
+	}
+	RS::get_singleton()->texture_set_size_override(texture, lw, lh);
+
+	w = lw;
+	h = lh;
+	path_to_file = p_path;
+	format = image_format;
+
+	notify_property_list_changed();
+	emit_changed();
+	return OK;
+}
+
 Error CompressedTexture2D::load(const String &p_path) {
+	if (Engine::get_singleton()->is_dedicated_server_mode_enabled()) {
+		return _load_placeholder(p_path);
+	}
+
 	int lw, lh;
 	Ref<Image> image;
 	image.instantiate();
@@ -135,11 +338,23 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	alpha_cache.unref();
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, _get_streaming_size_limit());
 	if (err) {
 		return err;
 	}
 
+	{
+		MutexLock lock(streaming_mutex);
+		stream_generation++;
+		if (streamed_in_element.in_list()) {
+			streamed_in_textures.remove(&streamed_in_element);
+			streamed_in_total_size -= streamed_in_size;
+			streamed_in_size = 0;
+		}
+		streamed_out = image->get_width() < lw || image->get_height() < lh;
+	}
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
@@ -207,6 +422,8 @@ int CompressedTexture2D::get_height() const {
 RID CompressedTexture2D::get_rid() const {
 	if (!texture.is_valid()) {
 		texture = RS::get_singleton()->texture_2d_placeholder_create();
+	} else {
+		_mark_used();
 	}
 	return texture;
 }
@@ -215,6 +432,7 @@ void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Col
 	if ((w | h) == 0) {
 		return;
 	}
+	_mark_used();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, Rect2(p_pos, Size2(w, h)), texture, false, p_modulate, p_transpose);
 }
 
@@ -222,6 +440,7 @@ void CompressedTexture2D::draw_rect(RID p_canvas_item, const Rect2 &p_rect, bool
 	if ((w | h) == 0) {
 		return;
 	}
+	_mark_used();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, p_rect, texture, p_tile, p_modulate, p_transpose);
 }
 
@@ -229,6 +448,7 @@ void CompressedTexture2D::draw_rect_region(RID p_canvas_item, const Rect2 &p_rec
 	if ((w | h) == 0) {
 		return;
 	}
+	_mark_used();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, p_rect, texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
 }
 
@@ -244,6 +464,14 @@ Ref<Image> CompressedTexture2D::get_image() const {
 	}
 }
 
+uint64_t CompressedTexture2D::get_memory_usage() const {
+	if (!texture.is_valid()) {
+		return 0;
+	}
+	// Whether the file has mipmaps isn't kept after loading, assume it does so this errs on the high side.
+	return Image::get_image_data_size(w, h, format, true);
+}
+
 bool CompressedTexture2D::is_pixel_opaque(int p_x, int p_y) const {
 	if (!alpha_cache.is_valid()) {
 		Ref<Image> img = get_image();
@@ -389,21 +617,14 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			// The first image is smaller than the texture when large mipmaps were skipped.
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
 	} else if (data_format == DATA_FORMAT_BASIS_UNIVERSAL) {
-		int sw = w;
-		int sh = h;
+		// Stored as a single blob, the size limit can't drop mipmaps so it's loaded whole.
 		uint32_t size = f->get_32();
-		if (p_size_limit > 0 && (sw > p_size_limit || sh > p_size_limit)) {
-			//can't load this due to size limit
-			sw = MAX(sw >> 1, 1);
-			sh = MAX(sh >> 1, 1);
-			f->seek(f->get_position() + size);
-			return Ref<Image>();
-		}
 		Vector<uint8_t> pv;
 		pv.resize(size);
 		{
@@ -416,23 +637,22 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
 		format = img->get_format();
-		sw = MAX(sw >> 1, 1);
-		sh = MAX(sh >> 1, 1);
 		return img;
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_start = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			// Skip straight to the first mipmap that fits.
+			f->seek(data_start + ofs);
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -457,9 +677,17 @@ void CompressedTexture2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
-CompressedTexture2D::CompressedTexture2D() {}
+CompressedTexture2D::CompressedTexture2D() :
+		streamed_in_element(this) {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	{
+		MutexLock lock(streaming_mutex);
+		if (streamed_in_element.in_list()) {
+			streamed_in_textures.remove(&streamed_in_element);
+			streamed_in_total_size -= streamed_in_size;
+		}
+	}
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
@@ -31,6 +31,8 @@
 #ifndef COMPRESSED_TEXTURE_H
 #define COMPRESSED_TEXTURE_H
 
+#include "core/config/engine.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -67,7 +69,34 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Texture streaming. When enabled, only the mipmaps that fit the initial size limit are uploaded on load,
+	// and the full texture is loaded on a worker thread once the texture is used. Full textures stay within
+	// a memory budget, evicting the least recently used ones back to their reduced mipmaps.
+	static Mutex streaming_mutex;
+	static SelfList<CompressedTexture2D>::List streamed_in_textures;
+	static uint64_t streamed_in_total_size;
+
+	SelfList<CompressedTexture2D> streamed_in_element;
+	uint64_t streamed_in_size = 0;
+	uint32_t stream_generation = 0; // Changes on every load, so stale stream-ins are discarded.
+	bool streamed_out = false; // Only the reduced mipmaps are uploaded.
+	mutable bool stream_in_queued = false;
+	mutable uint64_t last_used_frame = 0;
+
+	_FORCE_INLINE_ void _mark_used() const {
+		last_used_frame = Engine::get_singleton()->get_frames_drawn();
+		if (unlikely(streamed_out)) {
+			_queue_stream_in();
+		}
+	}
+	void _queue_stream_in() const;
+	void _stream_in();
+	static void _stream_in_task(void *p_userdata);
+	static void _make_streaming_room(uint64_t p_size);
+	static int _get_streaming_size_limit();
+
 	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	Error _load_placeholder(const String &p_path);
 	virtual void reload_from_file() override;
 
 	static void _requested_3d(void *p_ud);
@@ -106,6 +135,7 @@ public:
 	bool is_pixel_opaque(int p_x, int p_y) const override;
 
 	virtual Ref<Image> get_image() const override;
+	virtual uint64_t get_memory_usage() const override;
 
 	CompressedTexture2D();
 	~CompressedTexture2D();
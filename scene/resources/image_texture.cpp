@@ -132,6 +132,13 @@ Ref<Image> ImageTexture::get_image() const {
 	}
 }
 
+uint64_t ImageTexture::get_memory_usage() const {
+	if (!image_stored) {
+		return 0;
+	}
+	return Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 int ImageTexture::get_width() const {
 	return w;
 }
@@ -65,6 +65,7 @@ public:
 
 	void update(const Ref<Image> &p_image);
 	Ref<Image> get_image() const override;
+	virtual uint64_t get_memory_usage() const override;
 
 	int get_width() const override;
 	int get_height() const override;
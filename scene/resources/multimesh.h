@@ -53,6 +53,7 @@ private:
 	bool use_custom_data = false;
 	int instance_count = 0;
 	int visible_instance_count = -1;
+	float cull_distance = 0.0;
 
 protected:
 	static void _bind_methods();
@@ -93,6 +94,9 @@ public:
 	void set_visible_instance_count(int p_count);
 	int get_visible_instance_count() const;
 
+	void set_cull_distance(float p_distance);
+	float get_cull_distance() const;
+
 	void set_instance_transform(int p_instance, const Transform3D &p_transform);
 	void set_instance_transform_2d(int p_instance, const Transform2D &p_transform);
 	Transform3D get_instance_transform(int p_instance) const;
@@ -355,6 +355,16 @@ void NavigationMesh::clear() {
 	vertices.clear();
 }
 
+void NavigationMesh::set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons) {
+	vertices = p_vertices;
+	polygons.resize(p_polygons.size());
+	Polygon *polygons_ptrw = polygons.ptrw();
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons_ptrw[i].indices = p_polygons[i];
+	}
+	notify_property_list_changed();
+}
+
 #ifdef DEBUG_ENABLED
 Ref<ArrayMesh> NavigationMesh::get_debug_mesh() {
 	if (debug_mesh.is_valid()) {
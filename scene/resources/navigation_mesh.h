@@ -195,6 +195,9 @@ public:
 
 	void clear();
 
+	// Replaces the whole mesh at once, used by the bakers instead of adding polygons one by one.
+	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons);
+
 #ifdef DEBUG_ENABLED
 	Ref<ArrayMesh> get_debug_mesh();
 #endif // DEBUG_ENABLED
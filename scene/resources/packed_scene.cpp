@@ -156,6 +156,39 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	struct PropertyCacheLock {
+		const BinaryMutex *mutex = nullptr;
+		~PropertyCacheLock() {
+			if (mutex) {
+				mutex->unlock();
+			}
+		}
+	} property_cache_lock;
+
+	ObjectMemberCache *prop_caches = nullptr;
+	if (property_cache_mutex.try_lock()) {
+		property_cache_lock.mutex = &property_cache_mutex;
+		if (property_cache_offsets.size() != uint32_t(nc)) {
+			property_cache_offsets.resize(nc);
+			uint32_t total = 0;
+			for (int i = 0; i < nc; i++) {
+				property_cache_offsets[i] = total;
+				total += nd[i].properties.size();
+			}
+			property_caches.clear();
+			property_caches.resize(total);
+			for (int i = 0; i < nc; i++) {
+				for (int j = 0; j < nd[i].properties.size(); j++) {
+					int name_idx = nd[i].properties[j].name;
+					if (name_idx >= 0 && name_idx < sname_count) { // Skips deferred node paths too.
+						property_caches[property_cache_offsets[i] + j].set_member(snames[name_idx]);
+					}
+				}
+			}
+		}
+		prop_caches = property_caches.ptr();
+	}
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
@@ -398,7 +431,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (prop_caches) {
+								prop_caches[property_cache_offsets[i] + j].set(node, value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -1141,6 +1178,8 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	property_cache_offsets.clear();
+	property_caches.clear();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1349,6 +1388,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	property_cache_offsets.clear();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1819,6 +1860,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	property_cache_offsets.clear();
 
 	return nodes.size() - 1;
 }
@@ -1835,6 +1877,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	property_cache_offsets.clear();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -32,6 +32,8 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/object/object_member_cache.h"
+#include "core/os/mutex.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +91,13 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Accessor caches for the properties set by instantiate(), one per entry of each node's property list,
+	// so spawning the same scene many times resolves every setter only once. They belong to whichever
+	// instantiation holds the mutex, concurrent or nested instantiations use the generic Object::set().
+	mutable LocalVector<ObjectMemberCache> property_caches;
+	mutable LocalVector<uint32_t> property_cache_offsets; // Per node, empty until the first instantiation.
+	mutable BinaryMutex property_cache_mutex;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
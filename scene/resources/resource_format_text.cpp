@@ -41,7 +41,8 @@
 // Version 3: new string ID for ext/subresources, breaks forward compat.
 #define FORMAT_VERSION 3
 
-#define BINARY_FORMAT_VERSION 4
+// Must match the binary format version, since sub-resources are written with ResourceFormatSaverBinaryInstance::write_variant().
+#define BINARY_FORMAT_VERSION 6
 
 #include "core/io/dir_access.h"
 #include "core/version.h"
@@ -133,6 +133,24 @@ void AudioStreamPlaybackResampled::_bind_methods() {
 	GDVIRTUAL_BIND(_get_stream_sampling_rate);
 }
 
+void AudioStreamPlaybackResampled::_refill_internal_buffer() {
+	while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
+		internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
+		internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
+		internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
+		internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
+		int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+		if (mixed_frames != INTERNAL_BUFFER_LEN) {
+			// internal_buffer[mixed_frames] is the first frame of silence.
+			internal_buffer_end = mixed_frames;
+		} else {
+			// The internal buffer does not contain the first frame of silence.
+			internal_buffer_end = -1;
+		}
+		mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
+	}
+}
+
 int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	float target_rate = AudioServer::get_singleton()->get_mix_rate();
 	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
@@ -141,12 +159,38 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	int mixed_frames_total = -1;
 
-	int i;
-	for (i = 0; i < p_frames; i++) {
+	int i = 0;
+	if (mix_increment == FP_LEN && (mix_offset & FP_MASK) == 0) {
+		// Playing at the mixing rate, so every output frame lands exactly on a source frame
+		// and the cubic interpolation below reduces to y1. Copy whole runs instead.
+		while (i < p_frames) {
+			uint32_t pos = uint32_t(mix_offset >> FP_BITS);
+			uint32_t idx = CUBIC_INTERP_HISTORY + pos;
+			uint32_t count = MIN(uint32_t(p_frames - i), uint32_t(INTERNAL_BUFFER_LEN) - pos);
+
+			if (mixed_frames_total == -1) {
+				uint32_t silence_at = idx >= internal_buffer_end ? 0 : internal_buffer_end - idx;
+				if (silence_at < count) {
+					mixed_frames_total = i + silence_at;
+				}
+			}
+
+			memcpy(p_buffer + i, internal_buffer + idx - 2, count * sizeof(AudioFrame));
+			i += count;
+			mix_offset += uint64_t(count) << FP_BITS;
+			_refill_internal_buffer();
+		}
+		if (mixed_frames_total == -1) {
+			mixed_frames_total = p_frames;
+		}
+		return mixed_frames_total;
+	}
+
+	for (; i < p_frames; i++) {
 		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
 		//standard cubic interpolation (great quality/performance ratio)
 		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
+		float mu = (mix_offset & FP_MASK) * (1.0f / FP_LEN);
 		AudioFrame y0 = internal_buffer[idx - 3];
 		AudioFrame y1 = internal_buffer[idx - 2];
 		AudioFrame y2 = internal_buffer[idx - 1];
@@ -163,25 +207,10 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 		AudioFrame a2 = y2 - y0;
 		AudioFrame a3 = 2 * y1;
 
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) * 0.5f;
 
 		mix_offset += mix_increment;
-
-		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
-			if (mixed_frames != INTERNAL_BUFFER_LEN) {
-				// internal_buffer[mixed_frames] is the first frame of silence.
-				internal_buffer_end = mixed_frames;
-			} else {
-				// The internal buffer does not contain the first frame of silence.
-				internal_buffer_end = -1;
-			}
-			mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
-		}
+		_refill_internal_buffer();
 	}
 	if (mixed_frames_total == -1 && i == p_frames) {
 		mixed_frames_total = p_frames;
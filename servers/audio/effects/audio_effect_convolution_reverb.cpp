@@ -0,0 +1,304 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_effect_convolution_reverb.h"
+#include "servers/audio_server.h"
+
+// Uniformly partitioned overlap-save convolution. The impulse response is split into blocks of
+// PARTITION_SIZE frames whose spectra are computed once. Each block of input is transformed once
+// and multiplied against every partition through a frequency-domain delay line, so the cost per
+// frame grows with the impulse length only through cheap complex multiply-adds. Latency is one
+// partition. Both channels, being real signals, share a single complex FFT each way.
+
+void AudioEffectConvolutionReverbInstance::_update_impulse() {
+	impulse_version = base->impulse_version;
+	partitions = base->partitions;
+	partition_count = base->partition_count;
+
+	const int fft_size = AudioEffectConvolutionReverb::FFT_SIZE;
+	input_history.resize(fft_size);
+	for (AudioFrame &frame : input_history) {
+		frame = AudioFrame(0, 0);
+	}
+	output_block.resize(AudioEffectConvolutionReverb::PARTITION_SIZE);
+	for (AudioFrame &frame : output_block) {
+		frame = AudioFrame(0, 0);
+	}
+	delay_line.resize(partition_count * AudioEffectConvolutionReverb::PARTITION_STRIDE);
+	for (float &value : delay_line) {
+		value = 0;
+	}
+	accum.resize(AudioEffectConvolutionReverb::PARTITION_STRIDE);
+	fft_buffer.resize(fft_size * 2);
+	delay_line_pos = 0;
+	block_pos = 0;
+}
+
+void AudioEffectConvolutionReverbInstance::_process_block() {
+	const int fft_size = AudioEffectConvolutionReverb::FFT_SIZE;
+	const int partition_size = AudioEffectConvolutionReverb::PARTITION_SIZE;
+	const int bins = AudioEffectConvolutionReverb::SPECTRUM_BINS;
+	const int stride = AudioEffectConvolutionReverb::PARTITION_STRIDE;
+
+	// Transform the last two input blocks, left in the real part and right in the imaginary part.
+	float *fft = fft_buffer.ptr();
+	for (int i = 0; i < fft_size; i++) {
+		fft[i * 2 + 0] = input_history[i].left;
+		fft[i * 2 + 1] = input_history[i].right;
+	}
+	AudioEffectConvolutionReverb::fft(fft, false);
+
+	float *slot = &delay_line[delay_line_pos * stride];
+	AudioEffectConvolutionReverb::split_stereo_spectrum(fft, slot, slot + bins * 2);
+
+	// Multiply-accumulate every partition against the input block it is aligned with.
+	for (float &value : accum) {
+		value = 0;
+	}
+	const float *h = partitions.ptr();
+	float *acc = accum.ptr();
+	for (int p = 0; p < partition_count; p++) {
+		int x_idx = delay_line_pos - p;
+		if (x_idx < 0) {
+			x_idx += partition_count;
+		}
+		const float *x = &delay_line[x_idx * stride];
+		const float *hp = &h[p * stride];
+		for (int k = 0; k < bins * 2; k++) {
+			const float xr = x[k * 2 + 0];
+			const float xi = x[k * 2 + 1];
+			const float hr = hp[k * 2 + 0];
+			const float hi = hp[k * 2 + 1];
+			acc[k * 2 + 0] += xr * hr - xi * hi;
+			acc[k * 2 + 1] += xr * hi + xi * hr;
+		}
+	}
+	delay_line_pos = (delay_line_pos + 1) % partition_count;
+
+	// Rebuild the full spectrum of left + i * right and transform back.
+	const float *yl = acc;
+	const float *yr = acc + bins * 2;
+	for (int k = 0; k < bins; k++) {
+		fft[k * 2 + 0] = yl[k * 2 + 0] - yr[k * 2 + 1];
+		fft[k * 2 + 1] = yl[k * 2 + 1] + yr[k * 2 + 0];
+	}
+	for (int k = bins; k < fft_size; k++) {
+		const int m = fft_size - k;
+		fft[k * 2 + 0] = yl[m * 2 + 0] + yr[m * 2 + 1];
+		fft[k * 2 + 1] = yr[m * 2 + 0] - yl[m * 2 + 1];
+	}
+	AudioEffectConvolutionReverb::fft(fft, true);
+
+	// Overlap-save: only the second half is free of circular wrap-around.
+	const float scale = 1.0f / fft_size;
+	for (int i = 0; i < partition_size; i++) {
+		output_block[i] = AudioFrame(fft[(partition_size + i) * 2 + 0], fft[(partition_size + i) * 2 + 1]) * scale;
+		input_history[i] = input_history[partition_size + i];
+	}
+}
+
+void AudioEffectConvolutionReverbInstance::process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
+	if (impulse_version != base->impulse_version) {
+		_update_impulse();
+	}
+
+	const float dry = base->dry;
+
+	if (partition_count == 0) {
+		for (int i = 0; i < p_frame_count; i++) {
+			p_dst_frames[i] = p_src_frames[i] * dry;
+		}
+		return;
+	}
+
+	const float wet = base->wet;
+	const int partition_size = AudioEffectConvolutionReverb::PARTITION_SIZE;
+
+	for (int i = 0; i < p_frame_count; i++) {
+		input_history[partition_size + block_pos] = p_src_frames[i];
+		p_dst_frames[i] = p_src_frames[i] * dry + output_block[block_pos] * wet;
+		block_pos++;
+		if (block_pos == partition_size) {
+			_process_block();
+			block_pos = 0;
+		}
+	}
+}
+
+/////////////////////////////
+
+namespace {
+struct ConvolutionFFTTwiddles {
+	float cos[AudioEffectConvolutionReverb::FFT_SIZE / 2];
+	float sin[AudioEffectConvolutionReverb::FFT_SIZE / 2];
+
+	ConvolutionFFTTwiddles() {
+		for (int i = 0; i < AudioEffectConvolutionReverb::FFT_SIZE / 2; i++) {
+			double angle = Math_TAU * i / AudioEffectConvolutionReverb::FFT_SIZE;
+			cos[i] = Math::cos(angle);
+			sin[i] = Math::sin(angle);
+		}
+	}
+};
+} // namespace
+
+// In-place iterative radix-2 FFT of FFT_SIZE interleaved complex values. Not normalized.
+void AudioEffectConvolutionReverb::fft(float *p_data, bool p_inverse) {
+	static const ConvolutionFFTTwiddles twiddles;
+	const int n = FFT_SIZE;
+
+	for (int i = 1, j = 0; i < n; i++) {
+		int bit = n >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j ^= bit;
+		if (i < j) {
+			SWAP(p_data[i * 2 + 0], p_data[j * 2 + 0]);
+			SWAP(p_data[i * 2 + 1], p_data[j * 2 + 1]);
+		}
+	}
+
+	const float sign = p_inverse ? 1.0f : -1.0f;
+	for (int len = 2; len <= n; len <<= 1) {
+		const int half = len >> 1;
+		const int step = n / len;
+		for (int i = 0; i < n; i += len) {
+			for (int k = 0; k < half; k++) {
+				const float wr = twiddles.cos[k * step];
+				const float wi = sign * twiddles.sin[k * step];
+				float *a = &p_data[(i + k) * 2];
+				float *b = &p_data[(i + k + half) * 2];
+				const float tr = b[0] * wr - b[1] * wi;
+				const float ti = b[0] * wi + b[1] * wr;
+				b[0] = a[0] - tr;
+				b[1] = a[1] - ti;
+				a[0] += tr;
+				a[1] += ti;
+			}
+		}
+	}
+}
+
+// Separates the spectrum of left + i * right into the half spectra of each channel.
+void AudioEffectConvolutionReverb::split_stereo_spectrum(const float *p_spectrum, float *r_left, float *r_right) {
+	for (int k = 0; k < SPECTRUM_BINS; k++) {
+		const int m = (FFT_SIZE - k) % FFT_SIZE;
+		const float xr = p_spectrum[k * 2 + 0];
+		const float xi = p_spectrum[k * 2 + 1];
+		const float mr = p_spectrum[m * 2 + 0];
+		const float mi = p_spectrum[m * 2 + 1];
+		r_left[k * 2 + 0] = (xr + mr) * 0.5f;
+		r_left[k * 2 + 1] = (xi - mi) * 0.5f;
+		r_right[k * 2 + 0] = (xi + mi) * 0.5f;
+		r_right[k * 2 + 1] = (mr - xr) * 0.5f;
+	}
+}
+
+void AudioEffectConvolutionReverb::_update_partitions() {
+	const int frames = impulse_response.size();
+	const int count = (frames + PARTITION_SIZE - 1) / PARTITION_SIZE;
+
+	Vector<float> spectra;
+	spectra.resize(count * PARTITION_STRIDE);
+	float *dst = spectra.ptrw();
+	const Vector2 *src = impulse_response.ptr();
+
+	LocalVector<float> buffer;
+	buffer.resize(FFT_SIZE * 2);
+	for (int p = 0; p < count; p++) {
+		for (float &value : buffer) {
+			value = 0;
+		}
+		const int from = p * PARTITION_SIZE;
+		const int to = MIN(from + PARTITION_SIZE, frames);
+		for (int i = from; i < to; i++) {
+			buffer[(i - from) * 2 + 0] = src[i].x;
+			buffer[(i - from) * 2 + 1] = src[i].y;
+		}
+		fft(buffer.ptr(), false);
+		float *slot = &dst[p * PARTITION_STRIDE];
+		split_stereo_spectrum(buffer.ptr(), slot, slot + SPECTRUM_BINS * 2);
+	}
+
+	// Instances pick up the new spectra from the mix thread.
+	AudioServer::get_singleton()->lock();
+	partitions = spectra;
+	partition_count = count;
+	impulse_version++;
+	AudioServer::get_singleton()->unlock();
+}
+
+Ref<AudioEffectInstance> AudioEffectConvolutionReverb::instantiate() {
+	Ref<AudioEffectConvolutionReverbInstance> ins;
+	ins.instantiate();
+	ins->base = Ref<AudioEffectConvolutionReverb>(this);
+	return ins;
+}
+
+void AudioEffectConvolutionReverb::set_impulse_response(const PackedVector2Array &p_impulse_response) {
+	impulse_response = p_impulse_response;
+	_update_partitions();
+}
+
+PackedVector2Array AudioEffectConvolutionReverb::get_impulse_response() const {
+	return impulse_response;
+}
+
+void AudioEffectConvolutionReverb::set_dry(float p_dry) {
+	dry = p_dry;
+}
+
+float AudioEffectConvolutionReverb::get_dry() const {
+	return dry;
+}
+
+void AudioEffectConvolutionReverb::set_wet(float p_wet) {
+	wet = p_wet;
+}
+
+float AudioEffectConvolutionReverb::get_wet() const {
+	return wet;
+}
+
+void AudioEffectConvolutionReverb::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_impulse_response", "impulse_response"), &AudioEffectConvolutionReverb::set_impulse_response);
+	ClassDB::bind_method(D_METHOD("get_impulse_response"), &AudioEffectConvolutionReverb::get_impulse_response);
+
+	ClassDB::bind_method(D_METHOD("set_dry", "amount"), &AudioEffectConvolutionReverb::set_dry);
+	ClassDB::bind_method(D_METHOD("get_dry"), &AudioEffectConvolutionReverb::get_dry);
+
+	ClassDB::bind_method(D_METHOD("set_wet", "amount"), &AudioEffectConvolutionReverb::set_wet);
+	ClassDB::bind_method(D_METHOD("get_wet"), &AudioEffectConvolutionReverb::get_wet);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "impulse_response"), "set_impulse_response", "get_impulse_response");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dry", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_dry", "get_dry");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wet", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_wet", "get_wet");
+}
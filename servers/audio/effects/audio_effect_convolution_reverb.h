@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  audio_effect_convolution_reverb.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_EFFECT_CONVOLUTION_REVERB_H
+#define AUDIO_EFFECT_CONVOLUTION_REVERB_H
+
+#include "core/templates/local_vector.h"
+#include "servers/audio/audio_effect.h"
+
+class AudioEffectConvolutionReverb;
+
+class AudioEffectConvolutionReverbInstance : public AudioEffectInstance {
+	GDCLASS(AudioEffectConvolutionReverbInstance, AudioEffectInstance);
+
+	friend class AudioEffectConvolutionReverb;
+	Ref<AudioEffectConvolutionReverb> base;
+
+	uint64_t impulse_version = 0;
+	Vector<float> partitions; // Shared copy of the base spectra, taken when the impulse changes.
+	int partition_count = 0;
+
+	LocalVector<AudioFrame> input_history; // Previous and current partition of input.
+	LocalVector<AudioFrame> output_block; // Wet output of the last processed partition.
+	LocalVector<float> delay_line; // Spectra of the last partition_count input blocks.
+	LocalVector<float> accum;
+	LocalVector<float> fft_buffer;
+	int delay_line_pos = 0;
+	int block_pos = 0;
+
+	void _update_impulse();
+	void _process_block();
+
+public:
+	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
+};
+
+class AudioEffectConvolutionReverb : public AudioEffect {
+	GDCLASS(AudioEffectConvolutionReverb, AudioEffect);
+
+	friend class AudioEffectConvolutionReverbInstance;
+
+public:
+	enum {
+		PARTITION_SIZE = 256,
+		FFT_SIZE = PARTITION_SIZE * 2,
+		SPECTRUM_BINS = PARTITION_SIZE + 1, // Real signals only need the non-negative half of the spectrum.
+		PARTITION_STRIDE = SPECTRUM_BINS * 2 * 2, // Complex bins, for both channels.
+	};
+
+private:
+	PackedVector2Array impulse_response;
+	float dry = 1.0;
+	float wet = 0.5;
+
+	uint64_t impulse_version = 1;
+	Vector<float> partitions;
+	int partition_count = 0;
+
+	void _update_partitions();
+
+protected:
+	static void _bind_methods();
+
+public:
+	static void fft(float *p_data, bool p_inverse);
+	static void split_stereo_spectrum(const float *p_spectrum, float *r_left, float *r_right);
+
+	void set_impulse_response(const PackedVector2Array &p_impulse_response);
+	PackedVector2Array get_impulse_response() const;
+
+	void set_dry(float p_dry);
+	float get_dry() const;
+
+	void set_wet(float p_wet);
+	float get_wet() const;
+
+	Ref<AudioEffectInstance> instantiate() override;
+
+	AudioEffectConvolutionReverb() {}
+};
+
+#endif // AUDIO_EFFECT_CONVOLUTION_REVERB_H
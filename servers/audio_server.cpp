@@ -245,6 +245,7 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope memory_tag(Memory::TAG_AUDIO);
 	mix_count++;
 	int todo = p_frames;
 
@@ -409,8 +410,30 @@ void AudioServer::_mix_step() {
 		// By putting null into the bus details pointers, we're taking ownership of their memory for the duration of this mix.
 		AudioStreamPlaybackBusDetails bus_details = *ptr;
 
+		// A voice that is silent on all of its buses, both now and in the previous step, can't be heard.
+		// It was still mixed above so it keeps its playback position, but accumulating it into the buses is skipped.
+		bool audible = false;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK && !audible; idx++) {
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				if (bus_details.bus_active[idx] && !fading_out) {
+					const AudioFrame &vol = bus_details.volume[idx][channel_idx];
+					if (vol.left != 0 || vol.right != 0) {
+						audible = true;
+						break;
+					}
+				}
+				if (playback->prev_bus_details->bus_active[idx]) {
+					const AudioFrame &vol = playback->prev_bus_details->volume[idx][channel_idx];
+					if (vol.left != 0 || vol.right != 0) {
+						audible = true;
+						break;
+					}
+				}
+			}
+		}
+
 		// Mix to any active buses.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK && audible; idx++) {
 			if (!bus_details.bus_active[idx]) {
 				continue;
 			}
@@ -442,7 +465,7 @@ void AudioServer::_mix_step() {
 		}
 
 		// Now go through and fade-out any buses that were being played to previously that we missed by going through current data.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK && audible; idx++) {
 			if (!playback->prev_bus_details->bus_active[idx]) {
 				continue;
 			}
@@ -467,6 +490,15 @@ void AudioServer::_mix_step() {
 			}
 		}
 
+		if (!audible && fading_out) {
+			// Normally done while mixing; the next step must ramp from silence.
+			for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+				for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+					bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
+				}
+			}
+		}
+
 		// Copy the bus details we mixed with to the previous bus details to maintain volume ramps.
 		std::copy(std::begin(bus_details.bus_active), std::end(bus_details.bus_active), std::begin(playback->prev_bus_details->bus_active));
 		std::copy(std::begin(bus_details.bus), std::end(bus_details.bus), std::begin(playback->prev_bus_details->bus));
@@ -645,9 +677,10 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		const float lerp_step = 1.0f / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
+			float lerp_param = frame_idx * lerp_step;
 			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.left);
@@ -655,10 +688,19 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 			p_out_buf[frame_idx] += mixed;
 		}
 
+	} else if (p_vol_start.left == p_vol_final.left && p_vol_start.right == p_vol_final.right) {
+		// Steady volume, which is the common case for most voices: no ramp to interpolate.
+		if (p_vol_final.left == 0 && p_vol_final.right == 0) {
+			return;
+		}
+		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
+			p_out_buf[frame_idx] += p_vol_final * p_source_buf[frame_idx];
+		}
 	} else {
+		const float lerp_step = 1.0f / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
+			float lerp_param = frame_idx * lerp_step;
 			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
 		}
 	}
@@ -706,11 +748,8 @@ int AudioServer::thread_get_mix_buffer_size() const {
 }
 
 int AudioServer::thread_find_bus_index(const StringName &p_name) {
-	if (bus_map.has(p_name)) {
-		return bus_map[p_name]->index_cache;
-	} else {
-		return 0;
-	}
+	Bus **bus = bus_map.getptr(p_name);
+	return bus ? (*bus)->index_cache : 0;
 }
 
 void AudioServer::set_bus_count(int p_count) {
@@ -1218,24 +1257,50 @@ void AudioServer::set_playback_bus_volumes_linear(Ref<AudioStreamPlayback> p_pla
 	if (!playback_node) {
 		return;
 	}
-	AudioStreamPlaybackBusDetails *old_bus_details, *new_bus_details = new AudioStreamPlaybackBusDetails();
+	AudioStreamPlaybackBusDetails details;
 
 	int idx = 0;
-	for (KeyValue<StringName, Vector<AudioFrame>> pair : p_bus_volumes) {
+	for (const KeyValue<StringName, Vector<AudioFrame>> &pair : p_bus_volumes) {
 		if (idx >= MAX_BUSES_PER_PLAYBACK) {
 			break;
 		}
 		ERR_FAIL_COND(pair.value.size() < channel_count);
 		ERR_FAIL_COND(pair.value.size() != MAX_CHANNELS_PER_BUS);
 
-		new_bus_details->bus_active[idx] = true;
-		new_bus_details->bus[idx] = pair.key;
+		details.bus_active[idx] = true;
+		details.bus[idx] = pair.key;
 		for (int channel_idx = 0; channel_idx < MAX_CHANNELS_PER_BUS; channel_idx++) {
-			new_bus_details->volume[idx][channel_idx] = pair.value[channel_idx];
+			details.volume[idx][channel_idx] = pair.value[channel_idx];
 		}
 		idx++;
 	}
 
+	// Players usually push their volumes every frame; when nothing changed, skip allocating and swapping in a copy.
+	// Only the main thread replaces the details, so reading the current ones here is safe.
+	const AudioStreamPlaybackBusDetails *current = playback_node->bus_details.load();
+	if (current) {
+		bool changed = false;
+		for (int i = 0; i < MAX_BUSES_PER_PLAYBACK && !changed; i++) {
+			if (current->bus_active[i] != details.bus_active[i] || current->bus[i] != details.bus[i]) {
+				changed = true;
+				break;
+			}
+			for (int channel_idx = 0; channel_idx < MAX_CHANNELS_PER_BUS; channel_idx++) {
+				const AudioFrame &a = current->volume[i][channel_idx];
+				const AudioFrame &b = details.volume[i][channel_idx];
+				if (a.left != b.left || a.right != b.right) {
+					changed = true;
+					break;
+				}
+			}
+		}
+		if (!changed) {
+			return;
+		}
+	}
+
+	AudioStreamPlaybackBusDetails *old_bus_details, *new_bus_details = new AudioStreamPlaybackBusDetails(details);
+
 	do {
 		old_bus_details = playback_node->bus_details.load();
 	} while (!playback_node->bus_details.compare_exchange_strong(old_bus_details, new_bus_details));
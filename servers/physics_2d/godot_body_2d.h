@@ -106,6 +106,10 @@ class GodotBody2D : public GodotCollisionObject2D {
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
 
+	// Shape motion computed by integrate_forces(), applied to the broadphase by apply_integrated_forces().
+	Vector2 integrated_motion;
+	bool integrated_motion_pending = false;
+
 	List<Pair<GodotConstraint2D *, int>> constraint_list;
 
 	struct AreaCMP {
@@ -284,6 +288,10 @@ public:
 	void set_active(bool p_active);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
+	_FORCE_INLINE_ real_t get_still_time() const { return still_time; }
+	// Sets the state saved by a space snapshot, without waking up the body's neighbors.
+	void restore_snapshot_state(const Transform2D &p_transform, const Vector2 &p_linear_velocity, real_t p_angular_velocity, real_t p_still_time, bool p_active);
+
 	_FORCE_INLINE_ void wakeup() {
 		if ((!get_space()) || mode == PhysicsServer2D::BODY_MODE_STATIC || mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 			return;
@@ -315,8 +323,13 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// integrate_forces() and integrate_velocities() only touch the body's own state and can run in
+	// parallel for different bodies. Their space and broadphase side effects are deferred to the
+	// matching apply_*() call, which must run serially.
 	void integrate_forces(real_t p_step);
+	void apply_integrated_forces();
 	void integrate_velocities(real_t p_step);
+	void apply_integrated_velocities();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
@@ -591,6 +591,43 @@ void GodotBodyPair2D::solve(real_t p_step) {
 	}
 }
 
+GodotBodyPair2D::SnapshotKey GodotBodyPair2D::get_snapshot_key() const {
+	SnapshotKey key;
+	key.rid_A = A->get_self().get_id();
+	key.rid_B = B->get_self().get_id();
+	key.shape_A = shape_A;
+	key.shape_B = shape_B;
+	return key;
+}
+
+void GodotBodyPair2D::save_snapshot_state(SnapshotState &r_state) const {
+	r_state.key = get_snapshot_key();
+	r_state.sep_axis = sep_axis;
+	r_state.contact_count = contact_count;
+	r_state.collided = collided ? 1 : 0;
+	r_state.oneway_disabled = oneway_disabled ? 1 : 0;
+	for (int i = 0; i < contact_count; i++) {
+		r_state.contacts[i] = contacts[i];
+	}
+}
+
+void GodotBodyPair2D::restore_snapshot_state(const SnapshotState &p_state) {
+	sep_axis = p_state.sep_axis;
+	contact_count = CLAMP(p_state.contact_count, 0, (int)MAX_CONTACTS);
+	collided = p_state.collided != 0;
+	oneway_disabled = p_state.oneway_disabled != 0;
+	for (int i = 0; i < contact_count; i++) {
+		contacts[i] = p_state.contacts[i];
+	}
+}
+
+void GodotBodyPair2D::clear_contacts() {
+	contact_count = 0;
+	collided = false;
+	oneway_disabled = false;
+	sep_axis = Vector2();
+}
+
 GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B) :
 		GodotConstraint2D(_arr, 2) {
 	A = p_A;
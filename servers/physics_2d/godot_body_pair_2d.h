@@ -90,6 +90,47 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
+	// Identifies the pair in space snapshots. The bodies aren't sorted, as contacts are stored relative to A and B.
+	struct SnapshotKey {
+		uint64_t rid_A = 0;
+		uint64_t rid_B = 0;
+		int shape_A = 0;
+		int shape_B = 0;
+
+		_FORCE_INLINE_ bool operator==(const SnapshotKey &p_key) const {
+			return rid_A == p_key.rid_A && rid_B == p_key.rid_B && shape_A == p_key.shape_A && shape_B == p_key.shape_B;
+		}
+		_FORCE_INLINE_ bool operator<(const SnapshotKey &p_key) const {
+			if (rid_A != p_key.rid_A) {
+				return rid_A < p_key.rid_A;
+			}
+			if (rid_B != p_key.rid_B) {
+				return rid_B < p_key.rid_B;
+			}
+			if (shape_A != p_key.shape_A) {
+				return shape_A < p_key.shape_A;
+			}
+			return shape_B < p_key.shape_B;
+		}
+	};
+
+	// Contact cache saved in space snapshots, so restored pairs keep warm starting.
+	struct SnapshotState {
+		SnapshotKey key;
+		Vector2 sep_axis;
+		Contact contacts[MAX_CONTACTS];
+		int contact_count = 0;
+		uint32_t collided = 0;
+		uint32_t oneway_disabled = 0;
+	};
+
+	SnapshotKey get_snapshot_key() const;
+	void save_snapshot_state(SnapshotState &r_state) const;
+	void restore_snapshot_state(const SnapshotState &p_state);
+	void clear_contacts();
+
+	virtual bool is_body_pair() const override { return true; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
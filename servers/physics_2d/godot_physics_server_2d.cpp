@@ -276,6 +276,22 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+PackedByteArray GodotPhysicsServer2D::space_save_snapshot(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Can't save a snapshot of a space while it's being stepped.");
+
+	return space->save_snapshot();
+}
+
+void GodotPhysicsServer2D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't restore a snapshot of a space while it's being stepped.");
+
+	space->restore_snapshot(p_snapshot);
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -1292,6 +1308,8 @@ void GodotPhysicsServer2D::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::TAG_PHYSICS);
+
 	_update_shapes();
 
 	island_count = 0;
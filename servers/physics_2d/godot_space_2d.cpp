@@ -33,12 +33,15 @@
 #include "godot_collision_solver_2d.h"
 #include "godot_physics_server_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/templates/pair.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
+#define BATCH_QUERY_GRAIN 64
+
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject2D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -55,29 +58,25 @@ _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject2D *p_object, u
 	return true;
 }
 
-int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	if (p_result_max <= 0) {
-		return 0;
-	}
-
+int GodotPhysicsDirectSpaceState2D::_intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results) const {
 	Rect2 aabb;
 	aabb.position = p_parameters.position - Vector2(0.00001, 0.00001);
 	aabb.size = Vector2(0.00002, 0.00002);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_aabb(aabb, r_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	int cc = 0;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject2D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject2D *col_obj = r_query_results[i];
 
 		if (p_parameters.pick_point && !col_obj->is_pickable()) {
 			continue;
@@ -87,7 +86,7 @@ int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_par
 			continue;
 		}
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = r_query_subindex_results[i];
 
 		GodotShape2D *shape = col_obj->get_shape(shape_idx);
 
@@ -114,6 +113,38 @@ int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
+int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	return _intersect_point(p_parameters, r_results, p_result_max, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState2D::intersect_points(const PointParameters &p_parameters, const Vector2 *p_positions, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	if (p_result_max <= 0) {
+		for (int i = 0; i < p_count; i++) {
+			r_result_counts[i] = 0;
+		}
+		return;
+	}
+
+	// Each range gets its own broadphase query buffers, as the space ones are shared.
+	auto intersect_range = [&](uint32_t p_from_index, uint32_t p_to_index) {
+		LocalVector<GodotCollisionObject2D *> query_results;
+		LocalVector<int> query_subindex_results;
+		query_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+		query_subindex_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+
+		PointParameters parameters = p_parameters;
+		for (uint32_t i = p_from_index; i < p_to_index; i++) {
+			parameters.position = p_positions[i];
+			r_result_counts[i] = _intersect_point(parameters, &r_results[i * p_result_max], p_result_max, query_results.ptr(), query_subindex_results.ptr());
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, p_count, BATCH_QUERY_GRAIN, intersect_range, SNAME("Physics2DIntersectPoints"));
+}
+
 bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
@@ -204,19 +235,12 @@ bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
-int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	if (p_result_max <= 0) {
-		return 0;
-	}
-
-	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, 0);
-
-	Rect2 aabb = p_parameters.transform.xform(shape->get_aabb());
+int GodotPhysicsDirectSpaceState2D::_intersect_shape(const ShapeParameters &p_parameters, GodotShape2D *p_shape, ShapeResult *r_results, int p_result_max, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results) const {
+	Rect2 aabb = p_parameters.transform.xform(p_shape->get_aabb());
 	aabb = aabb.merge(Rect2(aabb.position + p_parameters.motion, aabb.size)); //motion
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_aabb(aabb, r_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	int cc = 0;
 
@@ -225,18 +249,18 @@ int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_par
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject2D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject2D *col_obj = r_query_results[i];
+		int shape_idx = r_query_subindex_results[i];
 
-		if (!GodotCollisionSolver2D::solve(shape, p_parameters.transform, p_parameters.motion, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), Vector2(), nullptr, nullptr, nullptr, p_parameters.margin)) {
+		if (!GodotCollisionSolver2D::solve(p_shape, p_parameters.transform, p_parameters.motion, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), Vector2(), nullptr, nullptr, nullptr, p_parameters.margin)) {
 			continue;
 		}
 
@@ -253,6 +277,44 @@ int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, 0);
+
+	return _intersect_shape(p_parameters, shape, r_results, p_result_max, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState2D::intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	for (int i = 0; i < p_count; i++) {
+		r_result_counts[i] = 0;
+	}
+
+	if (p_result_max <= 0) {
+		return;
+	}
+
+	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	auto intersect_range = [&](uint32_t p_from_index, uint32_t p_to_index) {
+		LocalVector<GodotCollisionObject2D *> query_results;
+		LocalVector<int> query_subindex_results;
+		query_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+		query_subindex_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+
+		ShapeParameters parameters = p_parameters;
+		for (uint32_t i = p_from_index; i < p_to_index; i++) {
+			parameters.transform = p_transforms[i];
+			r_result_counts[i] = _intersect_shape(parameters, shape, &r_results[i * p_result_max], p_result_max, query_results.ptr(), query_subindex_results.ptr());
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, p_count, BATCH_QUERY_GRAIN, intersect_range, SNAME("Physics2DIntersectShapes"));
+}
+
 bool GodotPhysicsDirectSpaceState2D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe) {
 	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_NULL_V(shape, false);
@@ -1143,6 +1205,164 @@ void GodotSpace2D::update() {
 	broadphase->update();
 }
 
+// Raw state of a body in a space snapshot. Snapshots are only meant to be
+// restored by the same build, so there is no need for a portable encoding.
+struct GodotBodySnapshot2D {
+	uint64_t rid = 0;
+	Transform2D transform;
+	Vector2 linear_velocity;
+	real_t angular_velocity = 0.0;
+	real_t still_time = 0.0;
+	uint32_t active = 0;
+};
+
+// Snapshots start with the number of bodies and body pairs, followed by the
+// body states sorted by RID and the pair states sorted by key.
+struct GodotSpaceSnapshotHeader2D {
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+void GodotSpace2D::_get_snapshot_pairs(LocalVector<GodotBodyPair2D *> &r_pairs) const {
+	for (const GodotCollisionObject2D *E : objects) {
+		if (E->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+			continue;
+		}
+		for (const Pair<GodotConstraint2D *, int> &F : static_cast<const GodotBody2D *>(E)->get_constraint_list()) {
+			// Each pair is in the constraint lists of both bodies, only take it from the first one.
+			if (F.second == 0 && F.first->is_body_pair()) {
+				r_pairs.push_back(static_cast<GodotBodyPair2D *>(F.first));
+			}
+		}
+	}
+
+	struct PairSort {
+		_FORCE_INLINE_ bool operator()(const GodotBodyPair2D *p_a, const GodotBodyPair2D *p_b) const {
+			return p_a->get_snapshot_key() < p_b->get_snapshot_key();
+		}
+	};
+	r_pairs.sort_custom<PairSort>();
+}
+
+PackedByteArray GodotSpace2D::save_snapshot() const {
+	ERR_FAIL_COND_V_MSG(locked, PackedByteArray(), "Can't save a snapshot of a space while it's being stepped.");
+
+	LocalVector<const GodotBody2D *> bodies;
+	for (const GodotCollisionObject2D *E : objects) {
+		if (E->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody2D *body = static_cast<const GodotBody2D *>(E);
+		if (body->get_mode() == PhysicsServer2D::BODY_MODE_STATIC) {
+			continue;
+		}
+		bodies.push_back(body);
+	}
+
+	struct BodySort {
+		_FORCE_INLINE_ bool operator()(const GodotBody2D *p_a, const GodotBody2D *p_b) const {
+			return p_a->get_self().get_id() < p_b->get_self().get_id();
+		}
+	};
+	bodies.sort_custom<BodySort>();
+
+	LocalVector<GodotBodyPair2D *> pairs;
+	_get_snapshot_pairs(pairs);
+
+	GodotSpaceSnapshotHeader2D header;
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+
+	PackedByteArray snapshot;
+	snapshot.resize(sizeof(GodotSpaceSnapshotHeader2D) + header.body_count * sizeof(GodotBodySnapshot2D) + header.pair_count * sizeof(GodotBodyPair2D::SnapshotState));
+	uint8_t *w = snapshot.ptrw();
+	memcpy(w, &header, sizeof(GodotSpaceSnapshotHeader2D));
+	w += sizeof(GodotSpaceSnapshotHeader2D);
+
+	for (const GodotBody2D *body : bodies) {
+		GodotBodySnapshot2D state;
+		state.rid = body->get_self().get_id();
+		state.transform = body->get_transform();
+		state.linear_velocity = body->get_linear_velocity();
+		state.angular_velocity = body->get_angular_velocity();
+		state.still_time = body->get_still_time();
+		state.active = body->is_active() ? 1 : 0;
+		memcpy(w, &state, sizeof(GodotBodySnapshot2D));
+		w += sizeof(GodotBodySnapshot2D);
+	}
+
+	for (const GodotBodyPair2D *pair : pairs) {
+		GodotBodyPair2D::SnapshotState state;
+		pair->save_snapshot_state(state);
+		memcpy(w, &state, sizeof(GodotBodyPair2D::SnapshotState));
+		w += sizeof(GodotBodyPair2D::SnapshotState);
+	}
+
+	return snapshot;
+}
+
+void GodotSpace2D::restore_snapshot(const PackedByteArray &p_snapshot) {
+	ERR_FAIL_COND_MSG(locked, "Can't restore a snapshot of a space while it's being stepped.");
+	ERR_FAIL_COND_MSG(p_snapshot.size() < (int64_t)sizeof(GodotSpaceSnapshotHeader2D), "Invalid space snapshot.");
+
+	const uint8_t *r = p_snapshot.ptr();
+	GodotSpaceSnapshotHeader2D header;
+	memcpy(&header, r, sizeof(GodotSpaceSnapshotHeader2D));
+	r += sizeof(GodotSpaceSnapshotHeader2D);
+	ERR_FAIL_COND_MSG(p_snapshot.size() != (int64_t)(sizeof(GodotSpaceSnapshotHeader2D) + header.body_count * sizeof(GodotBodySnapshot2D) + header.pair_count * sizeof(GodotBodyPair2D::SnapshotState)), "Invalid space snapshot.");
+
+	HashMap<uint64_t, GodotBody2D *> bodies;
+	bodies.reserve(objects.size());
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody2D *>(E));
+		}
+	}
+
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotBodySnapshot2D state;
+		memcpy(&state, r, sizeof(GodotBodySnapshot2D));
+		r += sizeof(GodotBodySnapshot2D);
+
+		GodotBody2D **body = bodies.getptr(state.rid);
+		if (!body) {
+			// The body was freed or moved to another space since the snapshot was saved.
+			continue;
+		}
+		(*body)->restore_snapshot_state(state.transform, state.linear_velocity, state.angular_velocity, state.still_time, state.active != 0);
+	}
+
+	// Both lists are sorted by key, so they can be matched in a single pass.
+	// Pairs that didn't exist when the snapshot was saved lose their contacts,
+	// and the broadphase removes the ones that don't overlap anymore on the next step.
+	LocalVector<GodotBodyPair2D *> pairs;
+	_get_snapshot_pairs(pairs);
+
+	GodotBodyPair2D::SnapshotState state;
+	uint32_t state_index = 0;
+	bool state_loaded = false;
+	for (GodotBodyPair2D *pair : pairs) {
+		const GodotBodyPair2D::SnapshotKey key = pair->get_snapshot_key();
+		while (state_index < header.pair_count) {
+			if (!state_loaded) {
+				memcpy(&state, r + state_index * sizeof(GodotBodyPair2D::SnapshotState), sizeof(GodotBodyPair2D::SnapshotState));
+				state_loaded = true;
+			}
+			if (!(state.key < key)) {
+				break;
+			}
+			state_index++;
+			state_loaded = false;
+		}
+
+		if (state_loaded && state.key == key) {
+			pair->restore_snapshot_state(state);
+		} else {
+			pair->clear_contacts();
+		}
+	}
+}
+
 void GodotSpace2D::set_param(PhysicsServer2D::SpaceParameter p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer2D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS:
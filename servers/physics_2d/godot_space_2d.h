@@ -45,6 +45,10 @@
 class GodotPhysicsDirectSpaceState2D : public PhysicsDirectSpaceState2D {
 	GDCLASS(GodotPhysicsDirectSpaceState2D, PhysicsDirectSpaceState2D);
 
+	// Query bodies that take their broadphase result buffers as arguments, so batches can run them on threads.
+	int _intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results) const;
+	int _intersect_shape(const ShapeParameters &p_parameters, GodotShape2D *p_shape, ShapeResult *r_results, int p_result_max, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results) const;
+
 public:
 	GodotSpace2D *space = nullptr;
 
@@ -54,6 +58,8 @@ public:
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector2 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
+	virtual void intersect_points(const PointParameters &p_parameters, const Vector2 *p_positions, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
 
 	GodotPhysicsDirectSpaceState2D() {}
 };
@@ -92,6 +98,8 @@ private:
 	static void *_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_data, void *p_self);
 
+	void _get_snapshot_pairs(LocalVector<GodotBodyPair2D *> &r_pairs) const;
+
 	HashSet<GodotCollisionObject2D *> objects;
 
 	GodotArea2D *area = nullptr;
@@ -179,6 +187,9 @@ public:
 	real_t get_last_step() const { return last_step; }
 	void set_last_step(real_t p_step) { last_step = p_step; }
 
+	PackedByteArray save_snapshot() const;
+	void restore_snapshot(const PackedByteArray &p_snapshot);
+
 	void set_param(PhysicsServer2D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer2D::SpaceParameter p_param) const;
 
@@ -99,6 +99,7 @@ GodotAreaPair3D::GodotAreaPair3D(GodotBody3D *p_body, int p_body_shape, GodotAre
 	area_shape = p_area_shape;
 	body->add_constraint(this, 0);
 	area->add_constraint(this);
+	_set_order_key(ORDER_KIND_AREA_PAIR, body->get_self(), body_shape, area->get_self(), area_shape);
 	if (p_body->get_mode() == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 		p_body->set_active(true);
 	}
@@ -184,6 +185,7 @@ GodotArea2Pair3D::GodotArea2Pair3D(GodotArea3D *p_area_a, int p_shape_a, GodotAr
 	area_b_monitorable = area_b->is_monitorable();
 	area_a->add_constraint(this);
 	area_b->add_constraint(this);
+	_set_order_key(ORDER_KIND_AREA_2_PAIR, area_a->get_self(), shape_a, area_b->get_self(), shape_b);
 }
 
 GodotArea2Pair3D::~GodotArea2Pair3D() {
@@ -277,6 +279,7 @@ GodotAreaSoftBodyPair3D::GodotAreaSoftBodyPair3D(GodotSoftBody3D *p_soft_body, i
 	area_shape = p_area_shape;
 	soft_body->add_constraint(this);
 	area->add_constraint(this);
+	_set_order_key(ORDER_KIND_AREA_SOFT_BODY_PAIR, soft_body->get_self(), soft_body_shape, area->get_self(), area_shape);
 }
 
 GodotAreaSoftBodyPair3D::~GodotAreaSoftBodyPair3D() {
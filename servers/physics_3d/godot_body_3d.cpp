@@ -189,6 +189,20 @@ void GodotBody3D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody3D::restore_snapshot_state(const Transform3D &p_transform, const Vector3 &p_linear_velocity, const Vector3 &p_angular_velocity, real_t p_still_time, bool p_active) {
+	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		new_transform = p_transform;
+	}
+	_set_transform(p_transform);
+	_set_inv_transform(p_transform.affine_inverse());
+	_update_transform_dependent();
+
+	linear_velocity = p_linear_velocity;
+	angular_velocity = p_angular_velocity;
+	set_active(p_active);
+	still_time = p_still_time;
+}
+
 void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::BODY_PARAM_BOUNCE: {
@@ -437,6 +451,17 @@ Variant GodotBody3D::get_state(PhysicsServer3D::BodyState p_state) const {
 	return Variant();
 }
 
+void GodotBody3D::shift_origin(const Vector3 &p_offset) {
+	GodotCollisionObject3D::shift_origin(p_offset);
+
+	// The kinematic target and the reported contacts are in world space too.
+	new_transform.origin -= p_offset;
+	Contact *c = contacts.ptrw();
+	for (int i = 0; i < contact_count; i++) {
+		c[i].collider_pos -= p_offset;
+	}
+}
+
 void GodotBody3D::set_space(GodotSpace3D *p_space) {
 	if (get_space()) {
 		if (mass_properties_update_list.in_list()) {
@@ -612,13 +637,21 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	bool do_motion = false;
 
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		// With substeps, reach the target in equal parts so contacts see the same velocity in each one.
+		int substeps_left = get_space()->get_substeps_left();
+		if (substeps_left > 1) {
+			step_transform = get_transform().interpolate_with(new_transform, 1.0 / substeps_left);
+		} else {
+			step_transform = new_transform;
+		}
+
 		//compute motion, angular and etc. velocities from prev transform
-		motion = new_transform.origin - get_transform().origin;
+		motion = step_transform.origin - get_transform().origin;
 		do_motion = true;
 		linear_velocity = constant_linear_velocity + motion / p_step;
 
 		//compute a FAKE angular velocity, not so easy
-		Basis rot = new_transform.basis.orthonormalized() * get_transform().basis.orthonormalized().transposed();
+		Basis rot = step_transform.basis.orthonormalized() * get_transform().basis.orthonormalized().transposed();
 		Vector3 axis;
 		real_t angle;
 
@@ -663,28 +696,31 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_angular_velocity = Vector3();
 	biased_linear_velocity = Vector3();
 
-	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
-	}
+	integrated_motion = motion;
+	integrated_motion_pending = do_motion;
 
 	contact_count = 0;
 }
 
+void GodotBody3D::apply_integrated_forces() {
+	if (integrated_motion_pending) { //shapes temporarily extend for raycast
+		integrated_motion_pending = false;
+		_update_shapes_with_motion(integrated_motion);
+	}
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
 			linear_velocity[i] = 0;
 			biased_linear_velocity[i] = 0;
 			new_transform.origin[i] = get_transform().origin[i];
+			step_transform.origin[i] = get_transform().origin[i];
 		}
 	}
 	//apply axis lock angular
@@ -696,12 +732,8 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	}
 
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
-		_set_transform(new_transform, false);
-		_set_inv_transform(new_transform.affine_inverse());
-		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
-		}
-
+		_set_transform(step_transform, false);
+		_set_inv_transform(step_transform.affine_inverse());
 		return;
 	}
 
@@ -728,12 +760,32 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::apply_integrated_velocities() {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
+		return;
+	}
+
+	if (fi_callback_data || body_state_callback.is_valid()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
+			set_active(false); //stopped moving, deactivate
+		}
+
+		return;
+	}
+
+	_update_shapes();
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
@@ -111,6 +111,12 @@ class GodotBody3D : public GodotCollisionObject3D {
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
+	// Part of the way to new_transform a kinematic body moves in the current substep.
+	Transform3D step_transform;
+
+	// Shape motion computed by integrate_forces(), applied to the broadphase by apply_integrated_forces().
+	Vector3 integrated_motion;
+	bool integrated_motion_pending = false;
 
 	HashMap<GodotConstraint3D *, int> constraint_map;
 
@@ -283,6 +289,10 @@ public:
 	void set_active(bool p_active);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
+	_FORCE_INLINE_ real_t get_still_time() const { return still_time; }
+	// Sets the state saved by a space snapshot, without waking up the body's neighbors.
+	void restore_snapshot_state(const Transform3D &p_transform, const Vector3 &p_linear_velocity, const Vector3 &p_angular_velocity, real_t p_still_time, bool p_active);
+
 	_FORCE_INLINE_ void wakeup() {
 		if ((!get_space()) || mode == PhysicsServer3D::BODY_MODE_STATIC || mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 			return;
@@ -303,6 +313,7 @@ public:
 	_FORCE_INLINE_ bool is_continuous_collision_detection_enabled() const { return continuous_cd; }
 
 	void set_space(GodotSpace3D *p_space) override;
+	virtual void shift_origin(const Vector3 &p_offset) override;
 
 	void update_mass_properties();
 	void reset_mass_properties();
@@ -316,8 +327,13 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// integrate_forces() and integrate_velocities() only touch the body's own state and can run in
+	// parallel for different bodies. Their space and broadphase side effects are deferred to the
+	// matching apply_*() call, which must run serially.
 	void integrate_forces(real_t p_step);
+	void apply_integrated_forces();
 	void integrate_velocities(real_t p_step);
+	void apply_integrated_velocities();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
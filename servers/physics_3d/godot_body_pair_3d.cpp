@@ -161,6 +161,39 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
+// Upper bound of how far any point within p_aabb moved between the two transforms.
+static real_t _get_max_point_motion(const Transform3D &p_from, const Transform3D &p_to, const AABB &p_aabb) {
+	Vector3 extent = p_aabb.position.abs().max((p_aabb.position + p_aabb.size).abs());
+
+	real_t basis_delta = 0.0;
+	for (int i = 0; i < 3; i++) {
+		basis_delta += (p_to.basis.get_column(i) - p_from.basis.get_column(i)).length_squared();
+	}
+
+	return p_to.origin.distance_to(p_from.origin) + Math::sqrt(basis_delta) * extent.length();
+}
+
+bool GodotBodyPair3D::_can_reuse_manifold(const Transform3D &p_xform_A_to_B, const Transform3D &p_xform_B_to_A, const AABB &p_aabb_A, const AABB &p_aabb_B) const {
+	if (!manifold_valid || !collided || contact_count == 0) {
+		return false;
+	}
+
+	// Shapes edited in place keep their transforms, but not their bounds.
+	if (p_aabb_A != manifold_aabb_A || p_aabb_B != manifold_aabb_B) {
+		return false;
+	}
+
+	// Measuring the points of the smaller shape gives the tighter bound.
+	real_t motion;
+	if (p_aabb_A.get_volume() <= p_aabb_B.get_volume()) {
+		motion = _get_max_point_motion(manifold_xform_A_to_B, p_xform_A_to_B, p_aabb_A);
+	} else {
+		motion = _get_max_point_motion(manifold_xform_B_to_A, p_xform_B_to_A, p_aabb_B);
+	}
+
+	return motion < space->get_contact_manifold_reuse_distance();
+}
+
 // _test_ccd prevents tunneling by slowing down a high velocity body that is about to collide so that next frame it will be at an appropriate location to collide (i.e. slight overlap)
 // Warning: the way velocity is adjusted down to cause a collision means the momentum will be weaker than it should for a bounce!
 // Process: only proceed if body A's motion is high relative to its size.
@@ -281,6 +314,11 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	offset_B = B->get_transform().get_origin() - A->get_transform().get_origin();
 
+	if (space->is_deterministic()) {
+		// Start over every step, so the result only depends on the current body states.
+		clear_contacts();
+	}
+
 	validate_contacts();
 
 	const Vector3 &offset_A = A->get_transform().get_origin();
@@ -294,7 +332,28 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
 	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
+	if (space->get_contact_manifold_reuse_distance() > 0.0) {
+		Transform3D xform_A_to_B = xform_B.affine_inverse() * xform_A;
+		Transform3D xform_B_to_A = xform_A.affine_inverse() * xform_B;
+		const AABB &aabb_A = shape_A_ptr->get_aabb();
+		const AABB &aabb_B = shape_B_ptr->get_aabb();
+
+		if (_can_reuse_manifold(xform_A_to_B, xform_B_to_A, aabb_A, aabb_B)) {
+			// Keep the contacts from the last test alive, as if the collision had found them again.
+			for (int i = 0; i < contact_count; i++) {
+				contacts[i].used = true;
+			}
+			return true;
+		}
+
+		manifold_xform_A_to_B = xform_A_to_B;
+		manifold_xform_B_to_A = xform_B_to_A;
+		manifold_aabb_A = aabb_A;
+		manifold_aabb_B = aabb_B;
+	}
+
 	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	manifold_valid = collided;
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -595,6 +654,43 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+GodotBodyPair3D::SnapshotKey GodotBodyPair3D::get_snapshot_key() const {
+	SnapshotKey key;
+	key.rid_A = A->get_self().get_id();
+	key.rid_B = B->get_self().get_id();
+	key.shape_A = shape_A;
+	key.shape_B = shape_B;
+	return key;
+}
+
+void GodotBodyPair3D::save_snapshot_state(SnapshotState &r_state) const {
+	r_state.key = get_snapshot_key();
+	r_state.sep_axis = sep_axis;
+	r_state.contact_count = contact_count;
+	r_state.collided = collided ? 1 : 0;
+	for (int i = 0; i < contact_count; i++) {
+		r_state.contacts[i] = contacts[i];
+	}
+}
+
+void GodotBodyPair3D::restore_snapshot_state(const SnapshotState &p_state) {
+	sep_axis = p_state.sep_axis;
+	contact_count = CLAMP(p_state.contact_count, 0, (int)MAX_CONTACTS);
+	collided = p_state.collided != 0;
+	for (int i = 0; i < contact_count; i++) {
+		contacts[i] = p_state.contacts[i];
+	}
+	// The shapes may have moved since the manifold was computed, so validate it again on the next step.
+	manifold_valid = false;
+}
+
+void GodotBodyPair3D::clear_contacts() {
+	contact_count = 0;
+	collided = false;
+	manifold_valid = false;
+	sep_axis = Vector3();
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
@@ -604,6 +700,7 @@ GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p
 	space = A->get_space();
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
+	_set_order_key(ORDER_KIND_BODY_PAIR, A->get_self(), shape_A, B->get_self(), shape_B);
 }
 
 GodotBodyPair3D::~GodotBodyPair3D() {
@@ -717,6 +814,12 @@ bool GodotBodySoftBodyPair3D::setup(real_t p_step) {
 	Transform3D xform_Bu = soft_body->get_transform();
 	Transform3D xform_B = xform_Bu * soft_body->get_shape_transform(0);
 
+	if (space->is_deterministic()) {
+		// Start over every step, so the result only depends on the current body states.
+		contacts.clear();
+		sep_axis = Vector3();
+	}
+
 	validate_contacts();
 
 	GodotShape3D *shape_A_ptr = body->get_shape(body_shape);
@@ -980,6 +1083,7 @@ GodotBodySoftBodyPair3D::GodotBodySoftBodyPair3D(GodotBody3D *p_A, int p_shape_A
 	space = p_A->get_space();
 	body->add_constraint(this, 0);
 	soft_body->add_constraint(this);
+	_set_order_key(ORDER_KIND_BODY_SOFT_BODY_PAIR, body->get_self(), body_shape, soft_body->get_self(), 0);
 }
 
 GodotBodySoftBodyPair3D::~GodotBodySoftBodyPair3D() {
@@ -97,6 +97,15 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Relative shape transforms when the contacts were last computed, to reuse them while the shapes don't move.
+	Transform3D manifold_xform_A_to_B;
+	Transform3D manifold_xform_B_to_A;
+	AABB manifold_aabb_A;
+	AABB manifold_aabb_B;
+	bool manifold_valid = false;
+
+	bool _can_reuse_manifold(const Transform3D &p_xform_A_to_B, const Transform3D &p_xform_B_to_A, const AABB &p_aabb_A, const AABB &p_aabb_B) const;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -105,6 +114,44 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	// Identifies the pair in space snapshots. The bodies aren't sorted, as contacts are stored relative to A and B.
+	struct SnapshotKey {
+		uint64_t rid_A = 0;
+		uint64_t rid_B = 0;
+		int shape_A = 0;
+		int shape_B = 0;
+
+		_FORCE_INLINE_ bool operator==(const SnapshotKey &p_key) const {
+			return rid_A == p_key.rid_A && rid_B == p_key.rid_B && shape_A == p_key.shape_A && shape_B == p_key.shape_B;
+		}
+		_FORCE_INLINE_ bool operator<(const SnapshotKey &p_key) const {
+			if (rid_A != p_key.rid_A) {
+				return rid_A < p_key.rid_A;
+			}
+			if (rid_B != p_key.rid_B) {
+				return rid_B < p_key.rid_B;
+			}
+			if (shape_A != p_key.shape_A) {
+				return shape_A < p_key.shape_A;
+			}
+			return shape_B < p_key.shape_B;
+		}
+	};
+
+	// Contact cache saved in space snapshots, so restored pairs keep warm starting.
+	struct SnapshotState {
+		SnapshotKey key;
+		Vector3 sep_axis;
+		Contact contacts[MAX_CONTACTS];
+		int contact_count = 0;
+		uint32_t collided = 0;
+	};
+
+	SnapshotKey get_snapshot_key() const;
+	void save_snapshot_state(SnapshotState &r_state) const;
+	void restore_snapshot_state(const SnapshotState &p_state);
+	void clear_contacts();
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
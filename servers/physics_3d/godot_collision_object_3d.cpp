@@ -125,6 +125,13 @@ void GodotCollisionObject3D::remove_shape(int p_index) {
 	}
 }
 
+void GodotCollisionObject3D::shift_origin(const Vector3 &p_offset) {
+	Transform3D xform = transform;
+	xform.origin -= p_offset;
+	_set_transform(xform);
+	_set_inv_transform(xform.affine_inverse());
+}
+
 void GodotCollisionObject3D::_set_static(bool p_static) {
 	if (_static == p_static) {
 		return;
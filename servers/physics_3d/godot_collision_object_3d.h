@@ -79,9 +79,8 @@ private:
 
 	SelfList<GodotCollisionObject3D> pending_shape_update_list;
 
-	void _update_shapes();
-
 protected:
+	void _update_shapes();
 	void _update_shapes_with_motion(const Vector3 &p_motion);
 	void _unregister_shapes();
 
@@ -186,6 +185,9 @@ public:
 
 	virtual void set_space(GodotSpace3D *p_space) = 0;
 
+	// Moves the object by -p_offset without any other side effect, for rebasing the whole space.
+	virtual void shift_origin(const Vector3 &p_offset);
+
 	_FORCE_INLINE_ bool is_static() const { return _static; }
 
 	virtual ~GodotCollisionObject3D() {}
@@ -33,6 +33,7 @@
 #include "gjk_epa.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/templates/local_vector.h"
 
 #define fallback_collision_solver gjk_epa_calculate_penetration
 
@@ -2090,6 +2091,24 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 
 	// A<->B edges
 
+	// Transform the edges of B once, rather than once per edge of A.
+	// The values are computed the same way, so the results are unchanged.
+	struct TransformedEdge {
+		Vector3 e;
+		Vector3 u;
+		Vector3 v;
+	};
+	InlineLocalVector<TransformedEdge, 64> transformed_edges_B;
+	transformed_edges_B.resize(edge_count_B);
+	for (int j = 0; j < edge_count_B; j++) {
+		Vector3 p2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_a]);
+		Vector3 q2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_b]);
+		TransformedEdge &edge = transformed_edges_B[j];
+		edge.e = q2 - p2;
+		edge.u = p_transform_b.basis.xform(faces_B[edges_B[j].face_a].plane.normal).normalized();
+		edge.v = p_transform_b.basis.xform(faces_B[edges_B[j].face_b].plane.normal).normalized();
+	}
+
 	for (int i = 0; i < edge_count_A; i++) {
 		Vector3 p1 = p_transform_a.xform(vertices_A[edges_A[i].vertex_a]);
 		Vector3 q1 = p_transform_a.xform(vertices_A[edges_A[i].vertex_b]);
@@ -2098,11 +2117,9 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 		Vector3 v1 = p_transform_a.basis.xform(faces_A[edges_A[i].face_b].plane.normal).normalized();
 
 		for (int j = 0; j < edge_count_B; j++) {
-			Vector3 p2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_a]);
-			Vector3 q2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_b]);
-			Vector3 e2 = q2 - p2;
-			Vector3 u2 = p_transform_b.basis.xform(faces_B[edges_B[j].face_a].plane.normal).normalized();
-			Vector3 v2 = p_transform_b.basis.xform(faces_B[edges_B[j].face_b].plane.normal).normalized();
+			const Vector3 &e2 = transformed_edges_B[j].e;
+			const Vector3 &u2 = transformed_edges_B[j].u;
+			const Vector3 &v2 = transformed_edges_B[j].v;
 
 			if (is_minkowski_face(u1, v1, -e1, -u2, -v2, -e2)) {
 				Vector3 axis = e1.cross(e2).normalized();
@@ -2115,12 +2132,24 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 	}
 
 	if (withMargin) {
+		// Vertices in world space, shared by the tests below.
+		InlineLocalVector<Vector3, 64> transformed_vertices_A;
+		transformed_vertices_A.resize(vertex_count_A);
+		for (int i = 0; i < vertex_count_A; i++) {
+			transformed_vertices_A[i] = p_transform_a.xform(vertices_A[i]);
+		}
+		InlineLocalVector<Vector3, 64> transformed_vertices_B;
+		transformed_vertices_B.resize(vertex_count_B);
+		for (int i = 0; i < vertex_count_B; i++) {
+			transformed_vertices_B[i] = p_transform_b.xform(vertices_B[i]);
+		}
+
 		//vertex-vertex
 		for (int i = 0; i < vertex_count_A; i++) {
-			Vector3 va = p_transform_a.xform(vertices_A[i]);
+			const Vector3 &va = transformed_vertices_A[i];
 
 			for (int j = 0; j < vertex_count_B; j++) {
-				if (!separator.test_axis((va - p_transform_b.xform(vertices_B[j])).normalized())) {
+				if (!separator.test_axis((va - transformed_vertices_B[j]).normalized())) {
 					return;
 				}
 			}
@@ -2133,7 +2162,7 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 			Vector3 n = (e2 - e1);
 
 			for (int j = 0; j < vertex_count_B; j++) {
-				Vector3 e3 = p_transform_b.xform(vertices_B[j]);
+				const Vector3 &e3 = transformed_vertices_B[j];
 
 				if (!separator.test_axis((e1 - e3).cross(n).cross(n).normalized())) {
 					return;
@@ -2147,7 +2176,7 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 			Vector3 n = (e2 - e1);
 
 			for (int j = 0; j < vertex_count_A; j++) {
-				Vector3 e3 = p_transform_a.xform(vertices_A[j]);
+				const Vector3 &e3 = transformed_vertices_A[j];
 
 				if (!separator.test_axis((e1 - e3).cross(n).cross(n).normalized())) {
 					return;
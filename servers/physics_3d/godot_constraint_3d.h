@@ -35,6 +35,17 @@ class GodotBody3D;
 class GodotSoftBody3D;
 
 class GodotConstraint3D {
+public:
+	enum OrderKind {
+		ORDER_KIND_JOINT,
+		ORDER_KIND_BODY_PAIR,
+		ORDER_KIND_BODY_SOFT_BODY_PAIR,
+		ORDER_KIND_AREA_PAIR,
+		ORDER_KIND_AREA_2_PAIR,
+		ORDER_KIND_AREA_SOFT_BODY_PAIR,
+	};
+
+private:
 	GodotBody3D **_body_ptr;
 	int _body_count;
 	uint64_t island_step;
@@ -43,6 +54,10 @@ class GodotConstraint3D {
 
 	RID self;
 
+	// Identifies the constraint by what it connects rather than by when it was created, so deterministic
+	// spaces can solve islands in the same order after a snapshot is restored.
+	uint64_t order_key[4] = {};
+
 protected:
 	GodotConstraint3D(GodotBody3D **p_body_ptr = nullptr, int p_body_count = 0) {
 		_body_ptr = p_body_ptr;
@@ -52,8 +67,23 @@ protected:
 		disabled_collisions_between_bodies = true;
 	}
 
+	// The objects are sorted, so the key doesn't depend on which one the broadphase reported first.
+	void _set_order_key(OrderKind p_kind, const RID &p_object_a, int p_shape_a, const RID &p_object_b, int p_shape_b) {
+		if (p_object_b.get_id() < p_object_a.get_id()) {
+			_set_order_key(p_kind, p_object_b, p_shape_b, p_object_a, p_shape_a);
+			return;
+		}
+		order_key[0] = p_kind;
+		order_key[1] = p_object_a.get_id();
+		order_key[2] = p_object_b.get_id();
+		order_key[3] = ((uint64_t)(uint32_t)p_shape_a << 32) | (uint32_t)p_shape_b;
+	}
+
 public:
-	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
+	_FORCE_INLINE_ void set_self(const RID &p_self) {
+		self = p_self;
+		order_key[1] = p_self.get_id();
+	}
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
@@ -71,6 +101,16 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	_FORCE_INLINE_ OrderKind get_order_kind() const { return (OrderKind)order_key[0]; }
+	_FORCE_INLINE_ bool is_ordered_before(const GodotConstraint3D *p_other) const {
+		for (int i = 0; i < 4; i++) {
+			if (order_key[i] != p_other->order_key[i]) {
+				return order_key[i] < p_other->order_key[i];
+			}
+		}
+		return false;
+	}
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
@@ -0,0 +1,187 @@
+/**************************************************************************/
+/*  godot_particle_pool_3d.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_particle_pool_3d.h"
+
+#include "godot_space_3d.h"
+
+#include "core/object/worker_thread_pool.h"
+
+#define PARTICLE_POOL_GRAIN 256
+// Distance kept from the surface after a point particle hits it, so the next ray doesn't start inside the shape.
+#define PARTICLE_POINT_SURFACE_MARGIN 0.001
+
+void GodotParticlePool3D::_step_particle(uint32_t p_index, real_t p_step, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) {
+	particle_collided[p_index] = false;
+
+	Vector3 &position = positions[p_index];
+	Vector3 &velocity = velocities[p_index];
+
+	if (gravity_scale != 0.0) {
+		Vector3 gravity;
+		space->get_default_area()->compute_gravity(position, gravity);
+		velocity += gravity * gravity_scale * p_step;
+	}
+
+	Vector3 motion = velocity * p_step;
+	if (motion == Vector3()) {
+		return;
+	}
+
+	const GodotPhysicsDirectSpaceState3D *direct_state = space->get_direct_state();
+	Collision &collision = particle_collisions[p_index];
+
+	if (radius > 0.0) {
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.transform.origin = position;
+		parameters.motion = motion;
+		parameters.collision_mask = collision_mask;
+
+		real_t closest_safe = 1.0;
+		real_t closest_unsafe = 1.0;
+		PhysicsDirectSpaceState3D::ShapeRestInfo info;
+		direct_state->_cast_motion(parameters, &sphere, closest_safe, closest_unsafe, &info, r_query_results, r_query_subindex_results);
+
+		if (closest_safe < 1.0) {
+			position += motion * closest_safe;
+			collision.position = info.point;
+			collision.normal = info.normal;
+			collision.collider_id = info.collider_id;
+			particle_collided[p_index] = true;
+		} else {
+			position += motion;
+		}
+	} else {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		parameters.from = position;
+		parameters.to = position + motion;
+		parameters.collision_mask = collision_mask;
+
+		PhysicsDirectSpaceState3D::RayResult result;
+		if (direct_state->_intersect_ray(parameters, result, r_query_results, r_query_subindex_results)) {
+			position = result.position + result.normal * PARTICLE_POINT_SURFACE_MARGIN;
+			collision.position = result.position;
+			collision.normal = result.normal;
+			collision.collider_id = result.collider_id;
+			particle_collided[p_index] = true;
+		} else {
+			position += motion;
+		}
+	}
+
+	if (particle_collided[p_index]) {
+		collision.particle = p_index;
+		velocity = velocity.bounce(collision.normal) * bounce;
+	}
+}
+
+void GodotParticlePool3D::set_space(GodotSpace3D *p_space) {
+	if (space) {
+		space->particle_pool_remove_from_list(&pool_list);
+	}
+
+	space = p_space;
+	collisions.clear();
+
+	if (space) {
+		space->particle_pool_add_to_list(&pool_list);
+	}
+}
+
+void GodotParticlePool3D::set_radius(real_t p_radius) {
+	ERR_FAIL_COND(p_radius < 0.0);
+
+	radius = p_radius;
+	if (radius > 0.0) {
+		sphere.set_data(radius);
+	}
+}
+
+void GodotParticlePool3D::set_particles(const Vector3 *p_positions, const Vector3 *p_velocities, int p_count) {
+	positions.resize(p_count);
+	velocities.resize(p_count);
+	particle_collisions.resize(p_count);
+	particle_collided.resize(p_count);
+
+	for (int i = 0; i < p_count; i++) {
+		positions[i] = p_positions[i];
+		velocities[i] = p_velocities ? p_velocities[i] : Vector3();
+		particle_collided[i] = false;
+	}
+
+	// Reported indices would point to the wrong particles now.
+	collisions.clear();
+}
+
+void GodotParticlePool3D::shift_origin(const Vector3 &p_offset) {
+	for (Vector3 &position : positions) {
+		position -= p_offset;
+	}
+	for (Collision &collision : collisions) {
+		collision.position -= p_offset;
+	}
+}
+
+void GodotParticlePool3D::step(real_t p_step, bool p_clear_collisions) {
+	if (p_clear_collisions) {
+		collisions.clear();
+	}
+
+	uint32_t particle_count = positions.size();
+	if (particle_count == 0) {
+		return;
+	}
+
+	// Each range gets its own broadphase query buffers, as the space ones are shared.
+	auto step_range = [&](uint32_t p_from, uint32_t p_to) {
+		LocalVector<GodotCollisionObject3D *> query_results;
+		LocalVector<int> query_subindex_results;
+		query_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+		query_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+		for (uint32_t i = p_from; i < p_to; i++) {
+			_step_particle(i, p_step, query_results.ptr(), query_subindex_results.ptr());
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, particle_count, PARTICLE_POOL_GRAIN, step_range, SNAME("Physics3DStepParticlePool"));
+
+	for (uint32_t i = 0; i < particle_count; i++) {
+		if (particle_collided[i]) {
+			collisions.push_back(particle_collisions[i]);
+		}
+	}
+}
+
+GodotParticlePool3D::GodotParticlePool3D() :
+		pool_list(this) {
+}
+
+GodotParticlePool3D::~GodotParticlePool3D() {
+}
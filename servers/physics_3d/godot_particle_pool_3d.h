@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  godot_particle_pool_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PARTICLE_POOL_3D_H
+#define GODOT_PARTICLE_POOL_3D_H
+
+#include "godot_shape_3d.h"
+
+#include "core/math/vector3.h"
+#include "core/object/object_id.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
+#include "core/templates/self_list.h"
+
+class GodotCollisionObject3D;
+class GodotSpace3D;
+
+// A pool of spheres or points that move with swept collision tests against the space, but take
+// no part in the broadphase, the islands or the solver. Meant for thousands of simple movers.
+class GodotParticlePool3D {
+public:
+	struct Collision {
+		Vector3 position;
+		Vector3 normal;
+		ObjectID collider_id;
+		int particle = 0;
+	};
+
+private:
+	RID self;
+	GodotSpace3D *space = nullptr;
+	SelfList<GodotParticlePool3D> pool_list;
+
+	real_t radius = 0.0;
+	real_t gravity_scale = 1.0;
+	real_t bounce = 0.0;
+	uint32_t collision_mask = 1;
+
+	GodotSphereShape3D sphere;
+
+	LocalVector<Vector3> positions;
+	LocalVector<Vector3> velocities;
+
+	// One slot per particle, so the swept tests can run on threads without sharing an output.
+	LocalVector<Collision> particle_collisions;
+	LocalVector<bool> particle_collided;
+	LocalVector<Collision> collisions;
+
+	void _step_particle(uint32_t p_index, real_t p_step, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results);
+
+public:
+	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
+	_FORCE_INLINE_ RID get_self() const { return self; }
+
+	void set_space(GodotSpace3D *p_space);
+	_FORCE_INLINE_ GodotSpace3D *get_space() const { return space; }
+
+	void set_radius(real_t p_radius);
+	_FORCE_INLINE_ real_t get_radius() const { return radius; }
+
+	_FORCE_INLINE_ void set_gravity_scale(real_t p_gravity_scale) { gravity_scale = p_gravity_scale; }
+	_FORCE_INLINE_ real_t get_gravity_scale() const { return gravity_scale; }
+
+	_FORCE_INLINE_ void set_bounce(real_t p_bounce) { bounce = p_bounce; }
+	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
+
+	_FORCE_INLINE_ void set_collision_mask(uint32_t p_mask) { collision_mask = p_mask; }
+	_FORCE_INLINE_ uint32_t get_collision_mask() const { return collision_mask; }
+
+	void set_particles(const Vector3 *p_positions, const Vector3 *p_velocities, int p_count);
+	_FORCE_INLINE_ int get_particle_count() const { return positions.size(); }
+	_FORCE_INLINE_ const Vector3 *get_positions() const { return positions.ptr(); }
+	_FORCE_INLINE_ const Vector3 *get_velocities() const { return velocities.ptr(); }
+
+	// Collisions reported since the start of the last physics step, in particle order.
+	_FORCE_INLINE_ const LocalVector<Collision> &get_collisions() const { return collisions; }
+
+	void shift_origin(const Vector3 &p_offset);
+	void step(real_t p_step, bool p_clear_collisions);
+
+	GodotParticlePool3D();
+	~GodotParticlePool3D();
+};
+
+#endif // GODOT_PARTICLE_POOL_3D_H
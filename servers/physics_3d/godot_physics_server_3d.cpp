@@ -196,6 +196,30 @@ PhysicsDirectSpaceState3D *GodotPhysicsServer3D::space_get_direct_state(RID p_sp
 	return space->get_direct_state();
 }
 
+void GodotPhysicsServer3D::space_shift_origin(RID p_space, const Vector3 &p_offset) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't shift the origin of a space while it's being stepped.");
+
+	space->shift_origin(p_offset);
+}
+
+PackedByteArray GodotPhysicsServer3D::space_save_snapshot(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Can't save a snapshot of a space while it's being stepped.");
+
+	return space->save_snapshot();
+}
+
+void GodotPhysicsServer3D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't restore a snapshot of a space while it's being stepped.");
+
+	space->restore_snapshot(p_snapshot);
+}
+
 void GodotPhysicsServer3D::space_set_debug_contacts(RID p_space, int p_max_contacts) {
 	GodotSpace3D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
@@ -920,6 +944,36 @@ bool GodotPhysicsServer3D::body_test_motion(RID p_body, const MotionParameters &
 	return body->get_space()->test_body_motion(body, p_parameters, r_result);
 }
 
+void GodotPhysicsServer3D::body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) {
+	for (int i = 0; i < p_count; i++) {
+		r_collided[i] = false;
+		r_results[i] = MotionResult();
+	}
+
+	if (p_count <= 0) {
+		return;
+	}
+
+	LocalVector<GodotBody3D *> bodies;
+	bodies.resize(p_count);
+
+	GodotSpace3D *space = nullptr;
+	for (int i = 0; i < p_count; i++) {
+		GodotBody3D *body = body_owner.get_or_null(p_bodies[i]);
+		ERR_FAIL_NULL(body);
+		ERR_FAIL_NULL(body->get_space());
+		ERR_FAIL_COND_MSG(space && body->get_space() != space, "All the bodies must be in the same space.");
+		space = body->get_space();
+		bodies[i] = body;
+	}
+
+	ERR_FAIL_COND(space->is_locked());
+
+	_update_shapes();
+
+	space->test_body_motions(bodies.ptr(), p_parameters, p_count, r_results, r_collided);
+}
+
 PhysicsDirectBodyState3D *GodotPhysicsServer3D::body_get_direct_state(RID p_body) {
 	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync), nullptr, "Body state is inaccessible right now, wait for iteration or physics process notification.");
 
@@ -1199,6 +1253,175 @@ bool GodotPhysicsServer3D::soft_body_is_point_pinned(RID p_body, int p_point_ind
 	return soft_body->is_vertex_pinned(p_point_index);
 }
 
+/* PARTICLE POOL API */
+
+RID GodotPhysicsServer3D::particle_pool_create() {
+	GodotParticlePool3D *particle_pool = memnew(GodotParticlePool3D);
+	RID rid = particle_pool_owner.make_rid(particle_pool);
+	particle_pool->set_self(rid);
+	return rid;
+}
+
+void GodotPhysicsServer3D::particle_pool_set_space(RID p_pool, RID p_space) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+
+	GodotSpace3D *space = nullptr;
+	if (p_space.is_valid()) {
+		space = space_owner.get_or_null(p_space);
+		ERR_FAIL_NULL(space);
+	}
+
+	if (particle_pool->get_space() == space) {
+		return; //pointless
+	}
+
+	particle_pool->set_space(space);
+}
+
+RID GodotPhysicsServer3D::particle_pool_get_space(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, RID());
+
+	GodotSpace3D *space = particle_pool->get_space();
+	if (!space) {
+		return RID();
+	}
+	return space->get_self();
+}
+
+void GodotPhysicsServer3D::particle_pool_set_radius(RID p_pool, real_t p_radius) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+
+	particle_pool->set_radius(p_radius);
+}
+
+real_t GodotPhysicsServer3D::particle_pool_get_radius(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, 0.0);
+
+	return particle_pool->get_radius();
+}
+
+void GodotPhysicsServer3D::particle_pool_set_collision_mask(RID p_pool, uint32_t p_mask) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+
+	particle_pool->set_collision_mask(p_mask);
+}
+
+uint32_t GodotPhysicsServer3D::particle_pool_get_collision_mask(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, 0);
+
+	return particle_pool->get_collision_mask();
+}
+
+void GodotPhysicsServer3D::particle_pool_set_gravity_scale(RID p_pool, real_t p_gravity_scale) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+
+	particle_pool->set_gravity_scale(p_gravity_scale);
+}
+
+real_t GodotPhysicsServer3D::particle_pool_get_gravity_scale(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, 0.0);
+
+	return particle_pool->get_gravity_scale();
+}
+
+void GodotPhysicsServer3D::particle_pool_set_bounce(RID p_pool, real_t p_bounce) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+
+	particle_pool->set_bounce(p_bounce);
+}
+
+real_t GodotPhysicsServer3D::particle_pool_get_bounce(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, 0.0);
+
+	return particle_pool->get_bounce();
+}
+
+void GodotPhysicsServer3D::particle_pool_set_particles(RID p_pool, const PackedVector3Array &p_positions, const PackedVector3Array &p_velocities) {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL(particle_pool);
+	ERR_FAIL_COND_MSG(!p_velocities.is_empty() && p_velocities.size() != p_positions.size(), "The velocities array must be empty or have the same size as the positions array.");
+	ERR_FAIL_COND_MSG(particle_pool->get_space() && particle_pool->get_space()->is_locked(), "Can't change the particles of a pool while its space is being stepped.");
+
+	particle_pool->set_particles(p_positions.ptr(), p_velocities.is_empty() ? nullptr : p_velocities.ptr(), p_positions.size());
+}
+
+int GodotPhysicsServer3D::particle_pool_get_particle_count(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, 0);
+
+	return particle_pool->get_particle_count();
+}
+
+PackedVector3Array GodotPhysicsServer3D::particle_pool_get_positions(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, PackedVector3Array());
+
+	int count = particle_pool->get_particle_count();
+	PackedVector3Array positions;
+	positions.resize(count);
+	memcpy(positions.ptrw(), particle_pool->get_positions(), count * sizeof(Vector3));
+	return positions;
+}
+
+PackedVector3Array GodotPhysicsServer3D::particle_pool_get_velocities(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, PackedVector3Array());
+
+	int count = particle_pool->get_particle_count();
+	PackedVector3Array velocities;
+	velocities.resize(count);
+	memcpy(velocities.ptrw(), particle_pool->get_velocities(), count * sizeof(Vector3));
+	return velocities;
+}
+
+Dictionary GodotPhysicsServer3D::particle_pool_get_collisions(RID p_pool) const {
+	GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_pool);
+	ERR_FAIL_NULL_V(particle_pool, Dictionary());
+
+	const LocalVector<GodotParticlePool3D::Collision> &collisions = particle_pool->get_collisions();
+	int count = collisions.size();
+
+	PackedInt32Array particle;
+	PackedVector3Array position;
+	PackedVector3Array normal;
+	PackedInt64Array collider_id;
+	particle.resize(count);
+	position.resize(count);
+	normal.resize(count);
+	collider_id.resize(count);
+
+	int32_t *particle_w = particle.ptrw();
+	Vector3 *position_w = position.ptrw();
+	Vector3 *normal_w = normal.ptrw();
+	int64_t *collider_id_w = collider_id.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		const GodotParticlePool3D::Collision &collision = collisions[i];
+		particle_w[i] = collision.particle;
+		position_w[i] = collision.position;
+		normal_w[i] = collision.normal;
+		collider_id_w[i] = (int64_t)collision.collider_id;
+	}
+
+	Dictionary d;
+	d["particle"] = particle;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+
+	return d;
+}
+
 /* JOINT API */
 
 RID GodotPhysicsServer3D::joint_create() {
@@ -1584,6 +1807,13 @@ void GodotPhysicsServer3D::free(RID p_rid) {
 
 		soft_body_owner.free(p_rid);
 		memdelete(soft_body);
+	} else if (particle_pool_owner.owns(p_rid)) {
+		GodotParticlePool3D *particle_pool = particle_pool_owner.get_or_null(p_rid);
+
+		particle_pool->set_space(nullptr);
+
+		particle_pool_owner.free(p_rid);
+		memdelete(particle_pool);
 	} else if (area_owner.owns(p_rid)) {
 		GodotArea3D *area = area_owner.get_or_null(p_rid);
 
@@ -1603,6 +1833,10 @@ void GodotPhysicsServer3D::free(RID p_rid) {
 			co->set_space(nullptr);
 		}
 
+		while (space->get_particle_pool_list().first()) {
+			space->get_particle_pool_list().first()->self()->set_space(nullptr);
+		}
+
 		active_spaces.erase(space);
 		free(space->get_default_area()->get_self());
 		free(space->get_static_global_body());
@@ -1635,13 +1869,22 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::TAG_PHYSICS);
+
 	_update_shapes();
 
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
 	for (const GodotSpace3D *E : active_spaces) {
-		stepper->step(const_cast<GodotSpace3D *>(E), p_step);
+		GodotSpace3D *space = const_cast<GodotSpace3D *>(E);
+		int substeps = space->get_solver_substeps();
+		real_t substep = p_step / substeps;
+		for (int i = 0; i < substeps; i++) {
+			space->set_substeps_left(substeps - i);
+			stepper->step(space, substep);
+		}
+		space->set_substeps_left(1);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
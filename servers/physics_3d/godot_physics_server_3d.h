@@ -61,6 +61,7 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	mutable RID_PtrOwner<GodotArea3D, true> area_owner;
 	mutable RID_PtrOwner<GodotBody3D, true> body_owner;
 	mutable RID_PtrOwner<GodotSoftBody3D, true> soft_body_owner;
+	mutable RID_PtrOwner<GodotParticlePool3D, true> particle_pool_owner;
 	mutable RID_PtrOwner<GodotJoint3D, true> joint_owner;
 
 	//void _clear_query(QuerySW *p_query);
@@ -112,6 +113,9 @@ public:
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
+	virtual void space_shift_origin(RID p_space, const Vector3 &p_offset) override;
+	virtual PackedByteArray space_save_snapshot(RID p_space) const override;
+	virtual void space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
@@ -251,6 +255,7 @@ public:
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) override;
+	virtual void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) override;
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override;
@@ -310,6 +315,34 @@ public:
 	virtual void soft_body_pin_point(RID p_body, int p_point_index, bool p_pin) override;
 	virtual bool soft_body_is_point_pinned(RID p_body, int p_point_index) const override;
 
+	/* PARTICLE POOL API */
+
+	virtual RID particle_pool_create() override;
+
+	virtual void particle_pool_set_space(RID p_pool, RID p_space) override;
+	virtual RID particle_pool_get_space(RID p_pool) const override;
+
+	virtual void particle_pool_set_radius(RID p_pool, real_t p_radius) override;
+	virtual real_t particle_pool_get_radius(RID p_pool) const override;
+
+	virtual void particle_pool_set_collision_mask(RID p_pool, uint32_t p_mask) override;
+	virtual uint32_t particle_pool_get_collision_mask(RID p_pool) const override;
+
+	virtual void particle_pool_set_gravity_scale(RID p_pool, real_t p_gravity_scale) override;
+	virtual real_t particle_pool_get_gravity_scale(RID p_pool) const override;
+
+	virtual void particle_pool_set_bounce(RID p_pool, real_t p_bounce) override;
+	virtual real_t particle_pool_get_bounce(RID p_pool) const override;
+
+	virtual void particle_pool_set_particles(RID p_pool, const PackedVector3Array &p_positions, const PackedVector3Array &p_velocities) override;
+
+	virtual int particle_pool_get_particle_count(RID p_pool) const override;
+
+	virtual PackedVector3Array particle_pool_get_positions(RID p_pool) const override;
+	virtual PackedVector3Array particle_pool_get_velocities(RID p_pool) const override;
+
+	virtual Dictionary particle_pool_get_collisions(RID p_pool) const override;
+
 	/* JOINT API */
 
 	virtual RID joint_create() override;
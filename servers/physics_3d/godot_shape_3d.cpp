@@ -33,8 +33,14 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/sort_array.h"
 
+#define BVH_CULL_STACK_SIZE 64
+// Relative slack added to the closest hit distance when clipping segment culls.
+#define BVH_SEGMENT_CLIP_MARGIN 0.001
+#define BVH_PARALLEL_BUILD_MIN_FACES 65536
+
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
 
 /*
@@ -959,9 +965,13 @@ void GodotConvexPolygonShape3D::get_supports(const Vector3 &p_normal, int p_max,
 	}
 
 	for (int i = 0; i < ec; i++) {
+		// Only edges touching the support vertex qualify, check that before normalizing.
+		if (edges[i].vertex_a != vtx && edges[i].vertex_b != vtx) {
+			continue;
+		}
 		real_t dot = (vertices[edges[i].vertex_a] - vertices[edges[i].vertex_b]).normalized().dot(p_normal);
 		dot = ABS(dot);
-		if (dot < edge_support_threshold_lower && (edges[i].vertex_a == vtx || edges[i].vertex_b == vtx)) {
+		if (dot < edge_support_threshold_lower) {
 			r_amount = 2;
 			r_type = FEATURE_EDGE;
 			r_supports[0] = vertices[edges[i].vertex_a];
@@ -1346,39 +1356,63 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 }
 
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+	int stack[BVH_CULL_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = p_idx;
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
+	// Once a face is hit, nodes beyond it can't hold a closer hit, so the segment tested
+	// against the nodes is clipped to the closest hit found so far.
+	const real_t length = p_params->to.distance_to(p_params->from);
+	Vector3 cull_to = p_params->to;
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->face_index = face_index;
-				p_params->collisions++;
-			}
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
+	while (stack_size > 0) {
+		const BVH *params_bvh = &p_params->bvh[stack[--stack_size]];
+
+		if (!params_bvh->aabb.intersects_segment(p_params->from, cull_to)) {
+			continue;
 		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
+
+		if (params_bvh->face_index >= 0) {
+			const Face *f = &p_params->faces[params_bvh->face_index];
+			GodotFaceShape3D *face = p_params->face;
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+
+			Vector3 res;
+			Vector3 normal;
+			int face_index = params_bvh->face_index;
+			if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
+				real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+				if ((d > 0) && (d < p_params->min_d)) {
+					p_params->min_d = d;
+					p_params->result = res;
+					p_params->normal = normal;
+					p_params->face_index = face_index;
+					p_params->collisions++;
+
+					real_t clip = d * (1.0 + BVH_SEGMENT_CLIP_MARGIN) + CMP_EPSILON;
+					if (clip < length) {
+						cull_to = p_params->from + p_params->dir * clip;
+					}
+				}
+			}
+		} else {
+			DEV_ASSERT(stack_size + 2 <= BVH_CULL_STACK_SIZE);
+
+			// Visit the child closer to the segment start first, so the clip above prunes more.
+			int first = params_bvh->left;
+			int second = params_bvh->right;
+			if (first >= 0 && second >= 0 && p_params->dir.dot(p_params->bvh[second].aabb.get_center()) < p_params->dir.dot(p_params->bvh[first].aabb.get_center())) {
+				SWAP(first, second);
+			}
+			if (second >= 0) {
+				stack[stack_size++] = second;
+			}
+			if (first >= 0) {
+				stack[stack_size++] = first;
+			}
 		}
 	}
 }
@@ -1429,32 +1463,36 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 }
 
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+	int stack[BVH_CULL_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = p_idx;
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
-	}
+	while (stack_size > 0) {
+		const BVH *params_bvh = &p_params->bvh[stack[--stack_size]];
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
+		if (!p_params->aabb.intersects(params_bvh->aabb)) {
+			continue;
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
+
+		if (params_bvh->face_index >= 0) {
+			const Face *f = &p_params->faces[params_bvh->face_index];
+			GodotFaceShape3D *face = p_params->face;
+			face->normal = f->normal;
+			face->vertex[0] = p_params->vertices[f->indices[0]];
+			face->vertex[1] = p_params->vertices[f->indices[1]];
+			face->vertex[2] = p_params->vertices[f->indices[2]];
+			if (p_params->callback(p_params->userdata, face)) {
 				return true;
 			}
-		}
+		} else {
+			DEV_ASSERT(stack_size + 2 <= BVH_CULL_STACK_SIZE);
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
+			// Push the right child first, so faces are visited in the same order as a recursive walk.
+			if (params_bvh->right >= 0) {
+				stack[stack_size++] = params_bvh->right;
+			}
+			if (params_bvh->left >= 0) {
+				stack[stack_size++] = params_bvh->left;
 			}
 		}
 	}
@@ -1526,87 +1564,59 @@ struct _Volume_BVH_CompareZ {
 	}
 };
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
-
-	int face_index = 0;
-};
-
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
+void GodotConcavePolygonShape3D::_build_bvh(_Volume_BVH_Element *p_elements, int p_size, BVH *p_bvh_array, int p_node, int p_task_size, LocalVector<_BVHBuildTask> *r_tasks) {
+	BVH &node = p_bvh_array[p_node];
 
 	if (p_size == 1) {
 		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+		node.aabb = p_elements[0].aabb;
+		node.left = -1;
+		node.right = -1;
+		node.face_index = p_elements[0].face_index;
+		return;
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
-		}
+	if (r_tasks && p_size <= p_task_size) {
+		// Small enough, leave this subtree to a worker thread.
+		_BVHBuildTask task;
+		task.elements = p_elements;
+		task.size = p_size;
+		task.node = p_node;
+		r_tasks->push_back(task);
+		return;
+	}
+
+	AABB aabb = p_elements[0].aabb;
+	for (int i = 1; i < p_size; i++) {
+		aabb.merge_with(p_elements[i].aabb);
 	}
-	bvh->aabb = aabb;
+	node.aabb = aabb;
+	node.face_index = -1;
+
+	// Only the median has to be in place for the split, a full sort isn't needed.
+	int split = p_size / 2;
 	switch (aabb.get_longest_axis_index()) {
 		case 0: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
-
+			sort_x.nth_element(0, p_size, split, p_elements);
 		} break;
 		case 1: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.nth_element(0, p_size, split, p_elements);
 		} break;
 		case 2: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.nth_element(0, p_size, split, p_elements);
 		} break;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
-
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
-
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
-
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
-	}
+	// A subtree over n faces always has 2n - 1 nodes, which places the right child
+	// without building the left one first. This is what lets subtrees build in parallel.
+	node.left = p_node + 1;
+	node.right = p_node + 2 * split;
 
-	memdelete(p_bvh_tree);
+	_build_bvh(p_elements, split, p_bvh_array, node.left, p_task_size, r_tasks);
+	_build_bvh(&p_elements[split], p_size - split, p_bvh_array, node.right, p_task_size, r_tasks);
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
@@ -1654,15 +1664,26 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
+	bvh.resize(src_face_count * 2 - 1);
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (src_face_count >= BVH_PARALLEL_BUILD_MIN_FACES && pool && pool->get_thread_count() > 1 && WorkerThreadPool::get_thread_index() == -1) {
+		// Split the top of the tree here, then build the subtrees below it on the worker threads.
+		LocalVector<_BVHBuildTask> tasks;
+		int task_size = MAX(BVH_PARALLEL_BUILD_MIN_FACES / 4, src_face_count / (pool->get_thread_count() * 4));
+		_build_bvh(bvh_arrayw, src_face_count, bvh_arrayw2, 0, task_size, &tasks);
+
+		auto build_subtrees = [&](uint32_t p_from, uint32_t p_to) {
+			for (uint32_t i = p_from; i < p_to; i++) {
+				_build_bvh(tasks[i].elements, tasks[i].size, bvh_arrayw2, tasks[i].node, 0, nullptr);
+			}
+		};
+		pool->parallel_for_range(0, tasks.size(), 1, build_subtrees, SNAME("ConcavePolygonShape3DBuildBVH"));
+	} else {
+		_build_bvh(bvh_arrayw, src_face_count, bvh_arrayw2, 0, 0, nullptr);
+	}
 
 	backface_collision = p_backface_collision;
 
@@ -2025,6 +2046,85 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+struct GodotHeightMapShape3D::CullParams {
+	// Cells to test, the end is exclusive.
+	int start_x = 0;
+	int start_z = 0;
+	int end_x = 0;
+	int end_z = 0;
+
+	real_t min_y = 0.0;
+	real_t max_y = 0.0;
+
+	GodotFaceShape3D face;
+	QueryCallback callback = nullptr;
+	void *userdata = nullptr;
+	bool done = false;
+};
+
+void GodotHeightMapShape3D::_cull_cells(int p_from_x, int p_from_z, int p_to_x, int p_to_z, CullParams &p_params) const {
+	GodotFaceShape3D &face = p_params.face;
+
+	for (int z = p_from_z; z < p_to_z; z++) {
+		for (int x = p_from_x; x < p_to_x; x++) {
+			// First triangle.
+			_get_point(x, z, face.vertex[0]);
+			_get_point(x + 1, z, face.vertex[1]);
+			_get_point(x, z + 1, face.vertex[2]);
+			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, &face)) {
+				p_params.done = true;
+				return;
+			}
+
+			// Second triangle.
+			face.vertex[0] = face.vertex[1];
+			_get_point(x + 1, z + 1, face.vertex[1]);
+			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, &face)) {
+				p_params.done = true;
+				return;
+			}
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_cull_bounds_node(int p_level, int p_x, int p_z, CullParams &p_params) const {
+	if (p_params.done) {
+		return;
+	}
+
+	// Cells covered by the node, clipped to the query.
+	const int node_cells = BOUNDS_CHUNK_SIZE << p_level;
+	const int from_x = MAX(p_x * node_cells, p_params.start_x);
+	const int from_z = MAX(p_z * node_cells, p_params.start_z);
+	const int to_x = MIN((p_x + 1) * node_cells, p_params.end_x);
+	const int to_z = MIN((p_z + 1) * node_cells, p_params.end_z);
+	if (from_x >= to_x || from_z >= to_z) {
+		return;
+	}
+
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	if (range.max < p_params.min_y || range.min > p_params.max_y) {
+		return;
+	}
+
+	if (p_level == 0) {
+		_cull_cells(from_x, from_z, to_x, to_z, p_params);
+		return;
+	}
+
+	const int child_width = (p_level == 1) ? bounds_grid_width : bounds_levels[p_level - 2].width;
+	const int child_depth = (p_level == 1) ? bounds_grid_depth : bounds_levels[p_level - 2].depth;
+	const int child_x_end = MIN(p_x * 2 + 2, child_width);
+	const int child_z_end = MIN(p_z * 2 + 2, child_depth);
+	for (int child_z = p_z * 2; child_z < child_z_end; child_z++) {
+		for (int child_x = p_x * 2; child_x < child_x_end; child_x++) {
+			_cull_bounds_node(p_level - 1, child_x, child_z, p_params);
+		}
+	}
+}
+
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
 	if (heights.is_empty()) {
 		return;
@@ -2046,35 +2146,25 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 		aabb_max[i]++;
 	}
 
-	int start_x = MAX(0, aabb_min[0]);
-	int end_x = MIN(width - 1, aabb_max[0]);
-	int start_z = MAX(0, aabb_min[2]);
-	int end_z = MIN(depth - 1, aabb_max[2]);
-
-	GodotFaceShape3D face;
-	face.backface_collision = !p_invert_backface_collision;
-	face.invert_backface_collision = p_invert_backface_collision;
-
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
+	CullParams params;
+	params.start_x = MAX(0, aabb_min[0]);
+	params.end_x = MIN(width - 1, aabb_max[0]);
+	params.start_z = MAX(0, aabb_min[2]);
+	params.end_z = MIN(depth - 1, aabb_max[2]);
+	params.min_y = local_aabb.position.y;
+	params.max_y = local_aabb.position.y + local_aabb.size.y;
+	params.face.backface_collision = !p_invert_backface_collision;
+	params.face.invert_backface_collision = p_invert_backface_collision;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
-		}
+	if (bounds_grid.is_empty()) {
+		_cull_cells(params.start_x, params.start_z, params.end_x, params.end_z, params);
+		return;
 	}
+
+	// The top level is a single node covering the whole heightmap.
+	_cull_bounds_node(bounds_levels.size(), 0, 0, params);
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2087,8 +2177,68 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
+GodotHeightMapShape3D::Range GodotHeightMapShape3D::_compute_bounds_chunk(int p_chunk_x, int p_chunk_z) const {
+	int z0 = p_chunk_z * BOUNDS_CHUNK_SIZE;
+	int x0 = p_chunk_x * BOUNDS_CHUNK_SIZE;
+
+	Range r;
+
+	r.min = _get_height(x0, z0);
+	r.max = r.min;
+
+	// Compute min and max height for this chunk.
+	// We have to include one extra cell to account for neighbors.
+	// Here is why:
+	// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+	//
+	//   Left        Right
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	//           x
+	//
+	// If the AABB for the Left chunk did not share vertices with the Right,
+	// then we would fail collision tests at x due to a gap.
+	//
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+	for (int z = z0; z < z_max; ++z) {
+		for (int x = x0; x < x_max; ++x) {
+			real_t height = _get_height(x, z);
+			if (height < r.min) {
+				r.min = height;
+			} else if (height > r.max) {
+				r.max = height;
+			}
+		}
+	}
+
+	return r;
+}
+
+GodotHeightMapShape3D::Range GodotHeightMapShape3D::_compute_bounds_node(int p_level, int p_x, int p_z) const {
+	const int child_width = (p_level == 1) ? bounds_grid_width : bounds_levels[p_level - 2].width;
+	const int child_depth = (p_level == 1) ? bounds_grid_depth : bounds_levels[p_level - 2].depth;
+	const int child_x_end = MIN(p_x * 2 + 2, child_width);
+	const int child_z_end = MIN(p_z * 2 + 2, child_depth);
+
+	Range r = _get_bounds_node(p_level - 1, p_x * 2, p_z * 2);
+	for (int child_z = p_z * 2; child_z < child_z_end; child_z++) {
+		for (int child_x = p_x * 2; child_x < child_x_end; child_x++) {
+			const Range &child = _get_bounds_node(p_level - 1, child_x, child_z);
+			r.min = MIN(r.min, child.min);
+			r.max = MAX(r.max, child.max);
+		}
+	}
+
+	return r;
+}
+
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_levels.clear();
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2112,50 +2262,95 @@ void GodotHeightMapShape3D::_build_accelerator() {
 
 	// Compute min and max height for all chunks.
 	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
 		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
-					}
-				}
+			bounds_grid[cx + cz * bounds_grid_width] = _compute_bounds_chunk(cx, cz);
+		}
+	}
+
+	// Merge them up to a single node.
+	int level_width = bounds_grid_width;
+	int level_depth = bounds_grid_depth;
+	while (level_width > 1 || level_depth > 1) {
+		level_width = (level_width + 1) / 2;
+		level_depth = (level_depth + 1) / 2;
+
+		bounds_levels.resize(bounds_levels.size() + 1);
+		const int level_index = bounds_levels.size();
+		BoundsLevel &level = bounds_levels[level_index - 1];
+		level.width = level_width;
+		level.depth = level_depth;
+		level.ranges.resize(level_width * level_depth);
+
+		for (int z = 0; z < level_depth; ++z) {
+			for (int x = 0; x < level_width; ++x) {
+				level.ranges[x + z * level_width] = _compute_bounds_node(level_index, x, z);
 			}
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	if (bounds_grid.is_empty()) {
+		return;
+	}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+	// Chunks include the first row and column of vertices of their next neighbors,
+	// so a vertex on a chunk border is also part of the previous chunk.
+	int from_x = MAX(p_from_x - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int from_z = MAX(p_from_z - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int to_x = MIN(p_to_x / BOUNDS_CHUNK_SIZE, bounds_grid_width - 1);
+	int to_z = MIN(p_to_z / BOUNDS_CHUNK_SIZE, bounds_grid_depth - 1);
+
+	for (int cz = from_z; cz <= to_z; ++cz) {
+		for (int cx = from_x; cx <= to_x; ++cx) {
+			bounds_grid[cx + cz * bounds_grid_width] = _compute_bounds_chunk(cx, cz);
+		}
+	}
+
+	for (uint32_t level_index = 1; level_index <= bounds_levels.size(); ++level_index) {
+		from_x /= 2;
+		from_z /= 2;
+		to_x /= 2;
+		to_z /= 2;
+
+		BoundsLevel &level = bounds_levels[level_index - 1];
+		for (int z = from_z; z <= to_z; ++z) {
+			for (int x = from_x; x <= to_x; ++x) {
+				level.ranges[x + z * level.width] = _compute_bounds_node(level_index, x, z);
+			}
 		}
 	}
 }
 
+void GodotHeightMapShape3D::_update_heights(const Rect2i &p_region, const Vector<real_t> &p_heights) {
+	const real_t *r = p_heights.ptr();
+	real_t *w = heights.ptrw();
+
+	real_t min_height = r[0];
+	real_t max_height = r[0];
+	for (int z = 0; z < p_region.size.y; ++z) {
+		real_t *row = w + (p_region.position.y + z) * width + p_region.position.x;
+		for (int x = 0; x < p_region.size.x; ++x) {
+			real_t h = *r++;
+			row[x] = h;
+			min_height = MIN(min_height, h);
+			max_height = MAX(max_height, h);
+		}
+	}
+
+	_update_accelerator(p_region.position.x, p_region.position.y, p_region.position.x + p_region.size.x - 1, p_region.position.y + p_region.size.y - 1);
+
+	// Only grow the bounds, finding out whether they can shrink would need to go through all the heights.
+	AABB aabb_new = get_aabb();
+	real_t aabb_min = MIN(aabb_new.position.y, min_height);
+	real_t aabb_max = MAX(aabb_new.position.y + aabb_new.size.y, max_height);
+	aabb_new.position.y = aabb_min;
+	aabb_new.size.y = aabb_max - aabb_min;
+
+	// Also lets the owners know the shape changed, to wake up the bodies resting on it.
+	configure(aabb_new);
+}
+
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
 	heights = p_heights;
 	width = p_width;
@@ -2181,6 +2376,20 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 	ERR_FAIL_COND(p_data.get_type() != Variant::DICTIONARY);
 
 	Dictionary d = p_data;
+
+	if (d.has("region")) {
+		// Update part of the current heights, without rebuilding the whole accelerator.
+		Rect2i region = d["region"];
+		ERR_FAIL_COND_MSG(region.size.x <= 0 || region.size.y <= 0, "The region to update must not be empty.");
+		ERR_FAIL_COND_MSG(!Rect2i(0, 0, width, depth).encloses(region), "The region to update must be inside the heightmap.");
+
+		Vector<real_t> region_heights = d.get("heights", Vector<real_t>());
+		ERR_FAIL_COND_MSG(region_heights.size() != region.get_area(), "The number of heights must match the size of the region to update.");
+
+		_update_heights(region, region_heights);
+		return;
+	}
+
 	ERR_FAIL_COND(!d.has("width"));
 	ERR_FAIL_COND(!d.has("depth"));
 	ERR_FAIL_COND(!d.has("heights"));
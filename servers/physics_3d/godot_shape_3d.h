@@ -302,7 +302,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -316,6 +316,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Nodes are stored in depth-first order, so a node's left child always directly follows it.
 	struct BVH {
 		AABB aabb;
 		int left = 0;
@@ -326,6 +327,12 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	Vector<BVH> bvh;
 
+	struct _BVHBuildTask {
+		_Volume_BVH_Element *elements = nullptr;
+		int size = 0;
+		int node = 0;
+	};
+
 	struct _CullParams {
 		AABB aabb;
 		QueryCallback callback = nullptr;
@@ -357,7 +364,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	static void _build_bvh(_Volume_BVH_Element *p_elements, int p_size, BVH *p_bvh_array, int p_node, int p_task_size, LocalVector<_BVHBuildTask> *r_tasks);
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -398,12 +405,30 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int bounds_grid_width = 0;
 	int bounds_grid_depth = 0;
 
+	// Coarser levels over the bounds grid, each node merging 2x2 nodes of the level below,
+	// up to a single node covering the whole heightmap. Culls descend them to skip large areas at once.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_levels;
+
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
 		return bounds_grid[(p_z * bounds_grid_width) + p_x];
 	}
 
+	// Level 0 is the bounds grid itself.
+	_FORCE_INLINE_ const Range &_get_bounds_node(int p_level, int p_x, int p_z) const {
+		if (p_level == 0) {
+			return _get_bounds_chunk(p_x, p_z);
+		}
+		const BoundsLevel &level = bounds_levels[p_level - 1];
+		return level.ranges[(p_z * level.width) + p_x];
+	}
+
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
 		return heights[(p_z * width) + p_x];
 	}
@@ -416,7 +441,15 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
+	Range _compute_bounds_chunk(int p_chunk_x, int p_chunk_z) const;
+	Range _compute_bounds_node(int p_level, int p_x, int p_z) const;
 	void _build_accelerator();
+	void _update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
+	void _update_heights(const Rect2i &p_region, const Vector<real_t> &p_heights);
+
+	struct CullParams;
+	void _cull_cells(int p_from_x, int p_from_z, int p_to_x, int p_to_z, CullParams &p_params) const;
+	void _cull_bounds_node(int p_level, int p_x, int p_z, CullParams &p_params) const;
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
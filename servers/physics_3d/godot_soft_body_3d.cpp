@@ -33,9 +33,25 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
+// Loops over fewer nodes, links or faces than this run on the physics thread.
+#define SOFT_BODY_PARALLEL_MIN_ELEMENTS 2048
+#define SOFT_BODY_PARALLEL_GRAIN 256
+// Links that don't fit in the first colors go to the last one, which is solved serially.
+#define SOFT_BODY_MAX_LINK_COLORS 64
+
+template <typename F>
+static void _soft_body_for_range(uint32_t p_begin, uint32_t p_end, const F &p_func, const StringName &p_description) {
+	if (p_end - p_begin < SOFT_BODY_PARALLEL_MIN_ELEMENTS) {
+		p_func(p_begin, p_end);
+		return;
+	}
+	WorkerThreadPool::get_singleton()->parallel_for_range(p_begin, p_end, SOFT_BODY_PARALLEL_GRAIN, p_func, p_description);
+}
+
 // Based on Bullet soft body.
 
 /*
@@ -110,6 +126,30 @@ Variant GodotSoftBody3D::get_state(PhysicsServer3D::BodyState p_state) const {
 	return Variant();
 }
 
+void GodotSoftBody3D::shift_origin(const Vector3 &p_offset) {
+	Transform3D xform = get_transform();
+	xform.origin -= p_offset;
+	_set_transform(xform, false);
+	_set_inv_transform(xform.affine_inverse());
+
+	// Unlike apply_nodes_transform(), this keeps velocities and rest lengths.
+	uint32_t node_count = nodes.size();
+	Vector3 leaf_size = Vector3(collision_margin, collision_margin, collision_margin) * 2.0;
+	for (uint32_t node_index = 0; node_index < node_count; ++node_index) {
+		Node &node = nodes[node_index];
+		node.x -= p_offset;
+		node.q -= p_offset;
+
+		AABB node_aabb(node.x, leaf_size);
+		node_tree.update(node.leaf, node_aabb);
+	}
+
+	face_tree.clear();
+
+	update_normals_and_centroids();
+	update_bounds();
+}
+
 void GodotSoftBody3D::set_space(GodotSpace3D *p_space) {
 	if (get_space()) {
 		get_space()->soft_body_remove_from_active_list(&active_list);
@@ -164,26 +204,38 @@ void GodotSoftBody3D::update_rendering_server(PhysicsServer3DRenderingServerHand
 }
 
 void GodotSoftBody3D::update_normals_and_centroids() {
-	for (Node &node : nodes) {
-		node.n = Vector3();
-	}
-
-	for (Face &face : faces) {
-		const Vector3 n = vec3_cross(face.n[0]->x - face.n[2]->x, face.n[0]->x - face.n[1]->x);
-		face.n[0]->n += n;
-		face.n[1]->n += n;
-		face.n[2]->n += n;
-		face.normal = n;
-		face.normal.normalize();
-		face.centroid = 0.33333333333 * (face.n[0]->x + face.n[1]->x + face.n[2]->x);
-	}
+	// Node normals are gathered from their faces instead of scattered from each face, so each pass can
+	// run in parallel. Faces are summed in face order, which gives the same result as scattering.
+	auto update_faces = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Face &face = faces[i];
+			face.normal = vec3_cross(face.n[0]->x - face.n[2]->x, face.n[0]->x - face.n[1]->x);
+			face.centroid = 0.33333333333 * (face.n[0]->x + face.n[1]->x + face.n[2]->x);
+		}
+	};
+	_soft_body_for_range(0, faces.size(), update_faces, SNAME("SoftBody3DUpdateFaces"));
+
+	auto update_nodes = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Node &node = nodes[i];
+			node.n = Vector3();
+			for (uint32_t j = node_face_offsets[i]; j < node_face_offsets[i + 1]; j++) {
+				node.n += faces[node_faces[j]].normal;
+			}
+			real_t len = node.n.length();
+			if (len > CMP_EPSILON) {
+				node.n /= len;
+			}
+		}
+	};
+	_soft_body_for_range(0, node_face_offsets.is_empty() ? 0 : nodes.size(), update_nodes, SNAME("SoftBody3DUpdateNodeNormals"));
 
-	for (Node &node : nodes) {
-		real_t len = node.n.length();
-		if (len > CMP_EPSILON) {
-			node.n /= len;
+	auto normalize_faces = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			faces[i].normal.normalize();
 		}
-	}
+	};
+	_soft_body_for_range(0, faces.size(), normalize_faces, SNAME("SoftBody3DNormalizeFaces"));
 }
 
 void GodotSoftBody3D::update_bounds() {
@@ -577,6 +629,8 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	color_links();
+	build_node_faces();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -821,6 +875,86 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::color_links() {
+	link_color_offsets.clear();
+
+	uint32_t link_count = links.size();
+	if (link_count == 0) {
+		return;
+	}
+
+	// Greedy coloring, each link takes the first color none of its nodes has yet.
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, node_colors.size() * sizeof(uint64_t));
+
+	LocalVector<uint8_t> link_colors;
+	link_colors.resize(link_count);
+
+	uint32_t color_counts[SOFT_BODY_MAX_LINK_COLORS] = {};
+	uint32_t color_count = 0;
+	const Node *node0 = nodes.ptr();
+	for (uint32_t i = 0; i < link_count; i++) {
+		const uint32_t a = links[i].n[0] - node0;
+		const uint32_t b = links[i].n[1] - node0;
+		const uint64_t used = node_colors[a] | node_colors[b];
+
+		uint32_t color = 0;
+		while (color < SOFT_BODY_MAX_LINK_COLORS - 1 && (used & (uint64_t(1) << color))) {
+			color++;
+		}
+
+		node_colors[a] |= uint64_t(1) << color;
+		node_colors[b] |= uint64_t(1) << color;
+		link_colors[i] = color;
+		color_counts[color]++;
+		color_count = MAX(color_count, color + 1);
+	}
+
+	link_color_offsets.resize(color_count + 1);
+	link_color_offsets[0] = 0;
+	for (uint32_t color = 0; color < color_count; color++) {
+		link_color_offsets[color + 1] = link_color_offsets[color] + color_counts[color];
+	}
+
+	// Stable sort by color, so links keep the order reoptimize_link_order() gave them within each color.
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	LocalVector<uint32_t> color_heads = link_color_offsets;
+	for (uint32_t i = 0; i < link_count; i++) {
+		sorted_links[color_heads[link_colors[i]]++] = links[i];
+	}
+	links = sorted_links;
+}
+
+void GodotSoftBody3D::build_node_faces() {
+	uint32_t node_count = nodes.size();
+	uint32_t face_count = faces.size();
+
+	node_face_offsets.resize(node_count + 1);
+	memset(node_face_offsets.ptr(), 0, node_face_offsets.size() * sizeof(uint32_t));
+	node_faces.resize(face_count * 3);
+
+	const Node *node0 = nodes.ptr();
+	for (const Face &face : faces) {
+		for (int j = 0; j < 3; j++) {
+			node_face_offsets[face.n[j] - node0 + 1]++;
+		}
+	}
+	for (uint32_t i = 0; i < node_count; i++) {
+		node_face_offsets[i + 1] += node_face_offsets[i];
+	}
+
+	LocalVector<uint32_t> node_heads;
+	node_heads.resize(node_count);
+	memcpy(node_heads.ptr(), node_face_offsets.ptr(), node_count * sizeof(uint32_t));
+	for (uint32_t i = 0; i < face_count; i++) {
+		for (int j = 0; j < 3; j++) {
+			node_faces[node_heads[faces[i].n[j] - node0]++] = i;
+		}
+	}
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -910,7 +1044,7 @@ void GodotSoftBody3D::add_velocity(const Vector3 &p_velocity) {
 	}
 }
 
-void GodotSoftBody3D::apply_forces(const LocalVector<GodotArea3D *> &p_wind_areas) {
+void GodotSoftBody3D::apply_forces(const InlineLocalVector<GodotArea3D *, 4> &p_wind_areas) {
 	if (nodes.is_empty()) {
 		return;
 	}
@@ -972,7 +1106,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	bool gravity_done = false;
 	Vector3 gravity;
 
-	LocalVector<GodotArea3D *> wind_areas;
+	InlineLocalVector<GodotArea3D *, 4> wind_areas;
 
 	int ac = areas.size();
 	if (ac) {
@@ -1029,16 +1163,20 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	real_t clamp_delta_v = max_displacement * inv_delta;
 
 	// Integrate.
-	for (Node &node : nodes) {
-		node.q = node.x;
-		Vector3 delta_v = node.f * node.im * p_delta;
-		for (int c = 0; c < 3; c++) {
-			delta_v[c] = CLAMP(delta_v[c], -clamp_delta_v, clamp_delta_v);
+	auto integrate_nodes = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Node &node = nodes[i];
+			node.q = node.x;
+			Vector3 delta_v = node.f * node.im * p_delta;
+			for (int c = 0; c < 3; c++) {
+				delta_v[c] = CLAMP(delta_v[c], -clamp_delta_v, clamp_delta_v);
+			}
+			node.v += delta_v;
+			node.x += node.v * p_delta;
+			node.f = Vector3();
 		}
-		node.v += delta_v;
-		node.x += node.v * p_delta;
-		node.f = Vector3();
-	}
+	};
+	_soft_body_for_range(0, nodes.size(), integrate_nodes, SNAME("SoftBody3DIntegrateNodes"));
 
 	// Bounds and tree update.
 	update_bounds();
@@ -1065,15 +1203,23 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	const real_t inv_delta = 1.0 / p_delta;
 
-	for (Link &link : links) {
-		link.c3 = link.n[1]->q - link.n[0]->q;
-		link.c2 = 1 / (link.c3.length_squared() * link.c0);
-	}
+	auto prepare_links = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Link &link = links[i];
+			link.c3 = link.n[1]->q - link.n[0]->q;
+			link.c2 = 1 / (link.c3.length_squared() * link.c0);
+		}
+	};
+	_soft_body_for_range(0, links.size(), prepare_links, SNAME("SoftBody3DPrepareLinks"));
 
 	// Solve velocities.
-	for (Node &node : nodes) {
-		node.x = node.q + node.v * p_delta;
-	}
+	auto solve_velocities = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Node &node = nodes[i];
+			node.x = node.q + node.v * p_delta;
+		}
+	};
+	_soft_body_for_range(0, nodes.size(), solve_velocities, SNAME("SoftBody3DSolveVelocities"));
 
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
@@ -1081,31 +1227,50 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 		solve_links(1.0, ti);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
-	for (Node &node : nodes) {
-		node.x += node.bv * p_delta;
-		node.bv = Vector3();
+	auto update_velocities = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Node &node = nodes[i];
+			node.x += node.bv * p_delta;
+			node.bv = Vector3();
 
-		node.v = (node.x - node.q) * vc;
+			node.v = (node.x - node.q) * vc;
 
-		node.q = node.x;
-	}
+			node.q = node.x;
+		}
+	};
+	_soft_body_for_range(0, nodes.size(), update_velocities, SNAME("SoftBody3DUpdateVelocities"));
 
 	update_normals_and_centroids();
 }
 
 void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
-			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
+	auto solve_range = [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			Link &link = links[i];
+			if (link.c0 > 0) {
+				Node &node_a = *link.n[0];
+				Node &node_b = *link.n[1];
+				const Vector3 del = node_b.x - node_a.x;
+				const real_t len = del.length_squared();
+				if (link.c1 + len > CMP_EPSILON) {
+					const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
+					node_a.x -= del * (k * node_a.im);
+					node_b.x += del * (k * node_b.im);
+				}
 			}
 		}
+	};
+
+	// Colors are solved one after the other, Gauss-Seidel style, and the links of each color in parallel.
+	uint32_t color_count = link_color_offsets.is_empty() ? 0 : link_color_offsets.size() - 1;
+	for (uint32_t color = 0; color < color_count; color++) {
+		uint32_t begin = link_color_offsets[color];
+		uint32_t end = link_color_offsets[color + 1];
+		if (color == SOFT_BODY_MAX_LINK_COLORS - 1) {
+			solve_range(begin, end);
+		} else {
+			_soft_body_for_range(begin, end, solve_range, SNAME("SoftBody3DSolveLinks"));
+		}
 	}
 }
 
@@ -1218,6 +1383,10 @@ void GodotSoftBody3D::destroy() {
 	links.clear();
 	faces.clear();
 
+	link_color_offsets.clear();
+	node_face_offsets.clear();
+	node_faces.clear();
+
 	bounds = AABB();
 	deinitialize_shape();
 }
@@ -82,6 +82,14 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Links are sorted by color, links of the same color share no node so they can be solved in parallel.
+	// Color i spans [link_color_offsets[i], link_color_offsets[i + 1]).
+	LocalVector<uint32_t> link_color_offsets;
+
+	// Faces of each node in face order, node i has node_faces[node_face_offsets[i]] to node_faces[node_face_offsets[i + 1] - 1].
+	LocalVector<uint32_t> node_face_offsets;
+	LocalVector<uint32_t> node_faces;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -154,6 +162,7 @@ public:
 	}
 
 	virtual void set_space(GodotSpace3D *p_space) override;
+	virtual void shift_origin(const Vector3 &p_offset) override;
 
 	void set_mesh(RID p_mesh);
 
@@ -229,11 +238,13 @@ private:
 
 	void add_velocity(const Vector3 &p_velocity);
 
-	void apply_forces(const LocalVector<GodotArea3D *> &p_wind_areas);
+	void apply_forces(const InlineLocalVector<GodotArea3D *, 4> &p_wind_areas);
 
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void color_links();
+	void build_node_faces();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
@@ -34,9 +34,14 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
+#define TEST_MOTION_QUERY_RECOVERY_FACTOR 0.1
+#define TEST_MOTION_BATCH_GROUP_MAX 32
+
+#define BATCH_QUERY_GRAIN 64
 
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject3D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
@@ -105,16 +110,14 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const {
 	Vector3 begin, end;
 	Vector3 normal;
 	begin = p_parameters.from;
 	end = p_parameters.to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_segment(begin, end, r_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -126,21 +129,21 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(r_query_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = r_query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = r_query_subindex_results[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -205,6 +208,32 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
+
+	return _intersect_ray(p_parameters, r_result, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND(space->locked);
+
+	// Each range gets its own broadphase query buffers, as the space ones are shared.
+	auto intersect_range = [&](uint32_t p_from_index, uint32_t p_to_index) {
+		LocalVector<GodotCollisionObject3D *> query_results;
+		LocalVector<int> query_subindex_results;
+		query_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+		query_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+		RayParameters parameters = p_parameters;
+		for (uint32_t i = p_from_index; i < p_to_index; i++) {
+			parameters.from = p_from[i];
+			parameters.to = p_to[i];
+			r_hits[i] = _intersect_ray(parameters, r_results[i], query_results.ptr(), query_subindex_results.ptr());
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, p_count, BATCH_QUERY_GRAIN, intersect_range, SNAME("Physics3DIntersectRays"));
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -260,22 +289,19 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
-	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, false);
-
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
+bool GodotPhysicsDirectSpaceState3D::_cast_motion(const ShapeParameters &p_parameters, GodotShape3D *p_shape, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const {
+	AABB aabb = p_parameters.transform.xform(p_shape->get_aabb());
 	aabb = aabb.merge(AABB(aabb.position + p_parameters.motion, aabb.size)); //motion
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_aabb(aabb, r_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	real_t best_safe = 1;
 	real_t best_unsafe = 1;
 
 	Transform3D xform_inv = p_parameters.transform.affine_inverse();
 	GodotMotionShape3D mshape;
-	mshape.shape = shape;
+	mshape.shape = p_shape;
 	mshape.motion = xform_inv.basis.xform(p_parameters.motion);
 
 	bool best_first = true;
@@ -285,16 +311,16 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 	Vector3 closest_A, closest_B;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue; //ignore excluded
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = r_query_results[i];
+		int shape_idx = r_query_subindex_results[i];
 
 		Vector3 point_A, point_B;
 		Vector3 sep_axis = motion_normal;
@@ -308,7 +334,7 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 		//test initial overlap, ignore objects it's inside of.
 		sep_axis = motion_normal;
 
-		if (!GodotCollisionSolver3D::solve_distance(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (!GodotCollisionSolver3D::solve_distance(p_shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
 			continue;
 		}
 
@@ -379,6 +405,38 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 	return true;
 }
 
+bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, false);
+
+	return _cast_motion(p_parameters, shape, p_closest_safe, p_closest_unsafe, r_info, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	for (int i = 0; i < p_count; i++) {
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	auto cast_range = [&](uint32_t p_from_index, uint32_t p_to_index) {
+		LocalVector<GodotCollisionObject3D *> query_results;
+		LocalVector<int> query_subindex_results;
+		query_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+		query_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+		ShapeParameters parameters = p_parameters;
+		for (uint32_t i = p_from_index; i < p_to_index; i++) {
+			parameters.transform = p_transforms[i];
+			parameters.motion = p_motions[i];
+			_cast_motion(parameters, shape, r_closest_safe[i], r_closest_unsafe[i], nullptr, query_results.ptr(), query_subindex_results.ptr());
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, p_count, BATCH_QUERY_GRAIN, cast_range, SNAME("Physics3DCastMotions"));
+}
+
 bool GodotPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) {
 	if (p_result_max <= 0) {
 		return false;
@@ -615,8 +673,82 @@ GodotPhysicsDirectSpaceState3D::GodotPhysicsDirectSpaceState3D() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
-	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+bool GodotSpace3D::_get_body_motion_aabb(const GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, AABB &r_body_aabb) const {
+	bool shapes_found = false;
+
+	for (int i = 0; i < p_body->get_shape_count(); i++) {
+		if (p_body->is_shape_disabled(i)) {
+			continue;
+		}
+
+		if (!shapes_found) {
+			r_body_aabb = p_body->get_shape_aabb(i);
+			shapes_found = true;
+		} else {
+			r_body_aabb = r_body_aabb.merge(p_body->get_shape_aabb(i));
+		}
+	}
+
+	if (!shapes_found) {
+		return false;
+	}
+
+	real_t margin = MAX(p_parameters.margin, TEST_MOTION_MARGIN_MIN_VALUE);
+
+	// Undo the currently transform the physics server is aware of and apply the provided one
+	r_body_aabb = p_parameters.from.xform(p_body->get_inv_transform().xform(r_body_aabb));
+	r_body_aabb = r_body_aabb.grow(margin);
+
+	return true;
+}
+
+AABB GodotSpace3D::_get_motion_query_aabb(const AABB &p_body_aabb, const Vector3 &p_motion) const {
+	AABB query_aabb = p_body_aabb;
+	query_aabb.position += p_motion;
+	query_aabb = query_aabb.merge(p_body_aabb);
+
+	// Leave some room for the recovery step to push the body around,
+	// steps that end up outside of the query cull the broadphase themselves.
+	return query_aabb.grow(p_body_aabb.get_longest_axis_size() * TEST_MOTION_QUERY_RECOVERY_FACTOR);
+}
+
+void GodotSpace3D::_fill_motion_query(const AABB &p_aabb, MotionQuery &p_query) const {
+	int amount = broadphase->cull_aabb(p_aabb, p_query.candidates.ptr(), INTERSECTION_QUERY_MAX, p_query.candidate_shapes.ptr());
+
+	p_query.aabb = p_aabb;
+	// Some objects may be missing from a full query, let each step cull the broadphase instead.
+	p_query.candidates_valid = amount < INTERSECTION_QUERY_MAX;
+	p_query.candidate_count = 0;
+
+	for (int i = 0; i < amount; i++) {
+		GodotCollisionObject3D *object = p_query.candidates[i];
+		if (object->get_type() == GodotCollisionObject3D::TYPE_AREA || object->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+			continue;
+		}
+		p_query.candidates[p_query.candidate_count] = object;
+		p_query.candidate_shapes[p_query.candidate_count] = p_query.candidate_shapes[i];
+		p_query.candidate_count++;
+	}
+}
+
+int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb, MotionQuery &p_query) const {
+	GodotCollisionObject3D **intersection_query_results = p_query.results.ptr();
+	int *intersection_query_subindex_results = p_query.subindex_results.ptr();
+
+	int amount = 0;
+	if (p_query.candidates_valid && p_query.aabb.encloses(p_aabb)) {
+		for (int i = 0; i < p_query.candidate_count; i++) {
+			GodotCollisionObject3D *object = p_query.candidates[i];
+			int shape = p_query.candidate_shapes[i];
+			if (object->get_shape_aabb(shape).intersects_inclusive(p_aabb)) {
+				intersection_query_results[amount] = object;
+				intersection_query_subindex_results[amount] = shape;
+				amount++;
+			}
+		}
+	} else {
+		amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+	}
 
 	for (int i = 0; i < amount; i++) {
 		bool keep = true;
@@ -647,7 +779,133 @@ int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
 	return amount;
 }
 
+// Conservative advancement of a round shape towards a convex one. The distance between two convex shapes is a convex
+// function of the fraction of a linear motion, so advancing by the distance divided by the approach speed never goes
+// past the contact, and usually gets close enough in a couple of iterations where the generic bisection needs 8.
+// Returns false when it doesn't converge, to fall back to bisection.
+static bool _test_motion_conservative_advance(const GodotShape3D *p_shape, const Transform3D &p_shape_xform, const GodotShape3D *p_other, const Transform3D &p_other_xform, const Vector3 &p_motion, const Vector3 &p_point_A, const Vector3 &p_point_B, real_t p_tolerance, const AABB &p_motion_aabb, real_t &r_low, real_t &r_hi) {
+	const int max_iterations = 16;
+
+	real_t fraction = 0.0;
+	Vector3 point_A = p_point_A;
+	Vector3 point_B = p_point_B;
+
+	for (int k = 0; k < max_iterations; k++) {
+		Vector3 separation = point_B - point_A;
+		real_t distance = separation.length();
+		Vector3 sep_axis = (distance > CMP_EPSILON) ? separation / distance : p_motion.normalized();
+
+		real_t speed = p_motion.dot(sep_axis);
+		if (speed <= CMP_EPSILON) {
+			// Moving away from the closest points, which contradicts the overlap found along the whole motion.
+			return false;
+		}
+
+		if (distance <= p_tolerance) {
+			r_low = fraction;
+			r_hi = MIN(fraction + 2.0 * p_tolerance / speed, (real_t)1.0);
+			return true;
+		}
+
+		fraction += (distance - p_tolerance * 0.5) / speed;
+		if (fraction >= 1.0) {
+			return false;
+		}
+
+		Transform3D shape_xform = p_shape_xform;
+		shape_xform.origin += p_motion * fraction;
+		if (!GodotCollisionSolver3D::solve_distance(p_shape, shape_xform, p_other, p_other_xform, point_A, point_B, p_motion_aabb, &sep_axis)) {
+			return false;
+		}
+	}
+
+	return false;
+}
+
 bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) {
+	return _test_body_motion(p_body, p_parameters, r_result, motion_query, true);
+}
+
+void GodotSpace3D::test_body_motions(GodotBody3D *const *p_bodies, const PhysicsServer3D::MotionParameters *p_parameters, int p_count, PhysicsServer3D::MotionResult *r_results, bool *r_collided) {
+	if (p_count <= 0) {
+		return;
+	}
+
+	struct MotionEntry {
+		int index = 0;
+		AABB aabb;
+		int64_t cell[3] = {};
+	};
+
+	LocalVector<MotionEntry> entries;
+	entries.resize(p_count);
+
+	real_t size_sum = 0.0;
+	for (int i = 0; i < p_count; i++) {
+		MotionEntry &entry = entries[i];
+		entry.index = i;
+
+		AABB body_aabb;
+		if (_get_body_motion_aabb(p_bodies[i], p_parameters[i], body_aabb)) {
+			entry.aabb = _get_motion_query_aabb(body_aabb, p_parameters[i].motion);
+			size_sum += entry.aabb.get_longest_axis_size();
+		}
+	}
+
+	// Sort the motions into cells about twice their average size, and share one broadphase query per cell.
+	real_t cell_size = MAX(size_sum * 2.0 / p_count, (real_t)CMP_EPSILON);
+	for (MotionEntry &entry : entries) {
+		Vector3 center = entry.aabb.get_center() / cell_size;
+		entry.cell[0] = (int64_t)Math::floor(center.x);
+		entry.cell[1] = (int64_t)Math::floor(center.y);
+		entry.cell[2] = (int64_t)Math::floor(center.z);
+	}
+
+	struct MotionEntrySort {
+		_FORCE_INLINE_ bool operator()(const MotionEntry &p_a, const MotionEntry &p_b) const {
+			for (int i = 0; i < 3; i++) {
+				if (p_a.cell[i] != p_b.cell[i]) {
+					return p_a.cell[i] < p_b.cell[i];
+				}
+			}
+			return p_a.index < p_b.index;
+		}
+	};
+	entries.sort_custom<MotionEntrySort>();
+
+	// Groups are ranges of entries in the same cell, capped so they still spread over threads.
+	LocalVector<uint32_t> group_starts;
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		bool same_cell = i > 0 && entries[i].cell[0] == entries[i - 1].cell[0] && entries[i].cell[1] == entries[i - 1].cell[1] && entries[i].cell[2] == entries[i - 1].cell[2];
+		if (!same_cell || i - group_starts[group_starts.size() - 1] >= TEST_MOTION_BATCH_GROUP_MAX) {
+			group_starts.push_back(i);
+		}
+	}
+	group_starts.push_back(entries.size());
+
+	auto test_range = [&](uint32_t p_from_group, uint32_t p_to_group) {
+		MotionQuery query;
+
+		for (uint32_t group = p_from_group; group < p_to_group; group++) {
+			const uint32_t from = group_starts[group];
+			const uint32_t to = group_starts[group + 1];
+
+			AABB group_aabb = entries[from].aabb;
+			for (uint32_t i = from + 1; i < to; i++) {
+				group_aabb.merge_with(entries[i].aabb);
+			}
+			_fill_motion_query(group_aabb, query);
+
+			for (uint32_t i = from; i < to; i++) {
+				const int index = entries[i].index;
+				r_collided[index] = _test_body_motion(p_bodies[index], p_parameters[index], &r_results[index], query, false);
+			}
+		}
+	};
+	WorkerThreadPool::get_singleton()->parallel_for_range(0, group_starts.size() - 1, 1, test_range, SNAME("Physics3DTestBodyMotions"));
+}
+
+bool GodotSpace3D::_test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result, MotionQuery &p_query, bool p_fill_query) const {
 	//give me back regular physics engine logic
 	//this is madness
 	//and most people using this function will think
@@ -662,22 +920,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 	}
 
 	AABB body_aabb;
-	bool shapes_found = false;
-
-	for (int i = 0; i < p_body->get_shape_count(); i++) {
-		if (p_body->is_shape_disabled(i)) {
-			continue;
-		}
-
-		if (!shapes_found) {
-			body_aabb = p_body->get_shape_aabb(i);
-			shapes_found = true;
-		} else {
-			body_aabb = body_aabb.merge(p_body->get_shape_aabb(i));
-		}
-	}
-
-	if (!shapes_found) {
+	if (!_get_body_motion_aabb(p_body, p_parameters, body_aabb)) {
 		if (r_result) {
 			r_result->travel = p_parameters.motion;
 		}
@@ -685,11 +928,11 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		return false;
 	}
 
-	real_t margin = MAX(p_parameters.margin, TEST_MOTION_MARGIN_MIN_VALUE);
+	if (p_fill_query) {
+		_fill_motion_query(_get_motion_query_aabb(body_aabb, p_parameters.motion), p_query);
+	}
 
-	// Undo the currently transform the physics server is aware of and apply the provided one
-	body_aabb = p_parameters.from.xform(p_body->get_inv_transform().xform(body_aabb));
-	body_aabb = body_aabb.grow(margin);
+	real_t margin = MAX(p_parameters.margin, TEST_MOTION_MARGIN_MIN_VALUE);
 
 	real_t min_contact_depth = margin * TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR;
 
@@ -720,7 +963,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 
 			bool collided = false;
 
-			int amount = _cull_aabb_for_body(p_body, body_aabb);
+			int amount = _cull_aabb_for_body(p_body, body_aabb, p_query);
 
 			for (int j = 0; j < p_body->get_shape_count(); j++) {
 				if (p_body->is_shape_disabled(j)) {
@@ -731,7 +974,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 				GodotShape3D *body_shape = p_body->get_shape(j);
 
 				for (int i = 0; i < amount; i++) {
-					const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+					const GodotCollisionObject3D *col_obj = p_query.results[i];
 					if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 						continue;
 					}
@@ -739,7 +982,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 						continue;
 					}
 
-					int shape_idx = intersection_query_subindex_results[i];
+					int shape_idx = p_query.subindex_results[i];
 
 					if (GodotCollisionSolver3D::solve_static(body_shape, body_shape_xform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), cbkres, cbkptr, nullptr, margin)) {
 						collided = cbk.amount > 0;
@@ -804,7 +1047,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		motion_aabb.position += p_parameters.motion;
 		motion_aabb = motion_aabb.merge(body_aabb);
 
-		int amount = _cull_aabb_for_body(p_body, motion_aabb);
+		int amount = _cull_aabb_for_body(p_body, motion_aabb, p_query);
 
 		for (int j = 0; j < p_body->get_shape_count(); j++) {
 			if (p_body->is_shape_disabled(j)) {
@@ -829,13 +1072,15 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			mshape.shape = body_shape;
 			mshape.motion = body_shape_xform_inv.basis.xform(p_parameters.motion);
 
+			const bool round_shape = body_shape->get_type() == PhysicsServer3D::SHAPE_CAPSULE || body_shape->get_type() == PhysicsServer3D::SHAPE_SPHERE;
+
 			bool stuck = false;
 
 			real_t best_safe = 1;
 			real_t best_unsafe = 1;
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = p_query.results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -843,7 +1088,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = p_query.subindex_results[i];
 
 				//test initial overlap, does it collide if going all the way?
 				Vector3 point_A, point_B;
@@ -861,9 +1106,19 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					break;
 				}
 
-				//just do kinematic solving
 				real_t low = 0.0;
 				real_t hi = 1.0;
+
+				// Fast path for the usual character shapes against convex colliders.
+				if (round_shape && !col_obj->get_shape(shape_idx)->is_concave() && _test_motion_conservative_advance(body_shape, body_shape_xform, col_obj->get_shape(shape_idx), col_obj_xform, p_parameters.motion, point_A, point_B, min_contact_depth, motion_aabb, low, hi)) {
+					if (low < best_safe) {
+						best_safe = low;
+						best_unsafe = hi;
+					}
+					continue;
+				}
+
+				//just do kinematic solving
 				real_t fraction_coeff = 0.5;
 				for (int k = 0; k < 8; k++) { //steps should be customizable..
 					real_t fraction = low + (hi - low) * fraction_coeff;
@@ -944,7 +1199,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		rcd.min_allowed_depth = MIN(motion_length, min_contact_depth);
 
 		body_aabb.position += p_parameters.motion * unsafe;
-		int amount = _cull_aabb_for_body(p_body, body_aabb);
+		int amount = _cull_aabb_for_body(p_body, body_aabb, p_query);
 
 		int from_shape = best_shape != -1 ? best_shape : 0;
 		int to_shape = best_shape != -1 ? best_shape + 1 : p_body->get_shape_count();
@@ -958,7 +1213,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			GodotShape3D *body_shape = p_body->get_shape(j);
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = p_query.results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -966,7 +1221,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = p_query.subindex_results[i];
 
 				rcd.object = col_obj;
 				rcd.shape = shape_idx;
@@ -1160,6 +1415,18 @@ void GodotSpace3D::soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *
 	active_soft_body_list.remove(p_soft_body);
 }
 
+const SelfList<GodotParticlePool3D>::List &GodotSpace3D::get_particle_pool_list() const {
+	return particle_pool_list;
+}
+
+void GodotSpace3D::particle_pool_add_to_list(SelfList<GodotParticlePool3D> *p_particle_pool) {
+	particle_pool_list.add(p_particle_pool);
+}
+
+void GodotSpace3D::particle_pool_remove_from_list(SelfList<GodotParticlePool3D> *p_particle_pool) {
+	particle_pool_list.remove(p_particle_pool);
+}
+
 void GodotSpace3D::call_queries() {
 	while (state_query_list.first()) {
 		GodotBody3D *b = state_query_list.first()->self();
@@ -1186,6 +1453,176 @@ void GodotSpace3D::update() {
 	broadphase->update();
 }
 
+void GodotSpace3D::shift_origin(const Vector3 &p_offset) {
+	ERR_FAIL_COND_MSG(locked, "Can't shift the origin of a space while it's being stepped.");
+
+	for (GodotCollisionObject3D *E : objects) {
+		E->shift_origin(p_offset);
+	}
+
+	for (SelfList<GodotParticlePool3D> *E = particle_pool_list.first(); E; E = E->next()) {
+		E->self()->shift_origin(p_offset);
+	}
+}
+
+// Raw state of a body in a space snapshot. Snapshots are only meant to be
+// restored by the same build, so there is no need for a portable encoding.
+struct GodotBodySnapshot3D {
+	uint64_t rid = 0;
+	Transform3D transform;
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+	real_t still_time = 0.0;
+	uint32_t active = 0;
+};
+
+// Snapshots start with the number of bodies and body pairs, followed by the
+// body states sorted by RID and the pair states sorted by key.
+struct GodotSpaceSnapshotHeader3D {
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+void GodotSpace3D::_get_snapshot_pairs(LocalVector<GodotBodyPair3D *> &r_pairs) const {
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		for (const KeyValue<GodotConstraint3D *, int> &F : static_cast<const GodotBody3D *>(E)->get_constraint_map()) {
+			// Each pair is in the constraint maps of both bodies, only take it from the first one.
+			if (F.value == 0 && F.key->get_order_kind() == GodotConstraint3D::ORDER_KIND_BODY_PAIR) {
+				r_pairs.push_back(static_cast<GodotBodyPair3D *>(F.key));
+			}
+		}
+	}
+
+	struct PairSort {
+		_FORCE_INLINE_ bool operator()(const GodotBodyPair3D *p_a, const GodotBodyPair3D *p_b) const {
+			return p_a->get_snapshot_key() < p_b->get_snapshot_key();
+		}
+	};
+	r_pairs.sort_custom<PairSort>();
+}
+
+PackedByteArray GodotSpace3D::save_snapshot() const {
+	ERR_FAIL_COND_V_MSG(locked, PackedByteArray(), "Can't save a snapshot of a space while it's being stepped.");
+
+	LocalVector<const GodotBody3D *> bodies;
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(E);
+		if (body->get_mode() == PhysicsServer3D::BODY_MODE_STATIC) {
+			continue;
+		}
+		bodies.push_back(body);
+	}
+
+	struct BodySort {
+		_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const {
+			return p_a->get_self().get_id() < p_b->get_self().get_id();
+		}
+	};
+	bodies.sort_custom<BodySort>();
+
+	LocalVector<GodotBodyPair3D *> pairs;
+	_get_snapshot_pairs(pairs);
+
+	GodotSpaceSnapshotHeader3D header;
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+
+	PackedByteArray snapshot;
+	snapshot.resize(sizeof(GodotSpaceSnapshotHeader3D) + header.body_count * sizeof(GodotBodySnapshot3D) + header.pair_count * sizeof(GodotBodyPair3D::SnapshotState));
+	uint8_t *w = snapshot.ptrw();
+	memcpy(w, &header, sizeof(GodotSpaceSnapshotHeader3D));
+	w += sizeof(GodotSpaceSnapshotHeader3D);
+
+	for (const GodotBody3D *body : bodies) {
+		GodotBodySnapshot3D state;
+		state.rid = body->get_self().get_id();
+		state.transform = body->get_transform();
+		state.linear_velocity = body->get_linear_velocity();
+		state.angular_velocity = body->get_angular_velocity();
+		state.still_time = body->get_still_time();
+		state.active = body->is_active() ? 1 : 0;
+		memcpy(w, &state, sizeof(GodotBodySnapshot3D));
+		w += sizeof(GodotBodySnapshot3D);
+	}
+
+	for (const GodotBodyPair3D *pair : pairs) {
+		GodotBodyPair3D::SnapshotState state;
+		pair->save_snapshot_state(state);
+		memcpy(w, &state, sizeof(GodotBodyPair3D::SnapshotState));
+		w += sizeof(GodotBodyPair3D::SnapshotState);
+	}
+
+	return snapshot;
+}
+
+void GodotSpace3D::restore_snapshot(const PackedByteArray &p_snapshot) {
+	ERR_FAIL_COND_MSG(locked, "Can't restore a snapshot of a space while it's being stepped.");
+	ERR_FAIL_COND_MSG(p_snapshot.size() < (int64_t)sizeof(GodotSpaceSnapshotHeader3D), "Invalid space snapshot.");
+
+	const uint8_t *r = p_snapshot.ptr();
+	GodotSpaceSnapshotHeader3D header;
+	memcpy(&header, r, sizeof(GodotSpaceSnapshotHeader3D));
+	r += sizeof(GodotSpaceSnapshotHeader3D);
+	ERR_FAIL_COND_MSG(p_snapshot.size() != (int64_t)(sizeof(GodotSpaceSnapshotHeader3D) + header.body_count * sizeof(GodotBodySnapshot3D) + header.pair_count * sizeof(GodotBodyPair3D::SnapshotState)), "Invalid space snapshot.");
+
+	HashMap<uint64_t, GodotBody3D *> bodies;
+	bodies.reserve(objects.size());
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotBodySnapshot3D state;
+		memcpy(&state, r, sizeof(GodotBodySnapshot3D));
+		r += sizeof(GodotBodySnapshot3D);
+
+		GodotBody3D **body = bodies.getptr(state.rid);
+		if (!body) {
+			// The body was freed or moved to another space since the snapshot was saved.
+			continue;
+		}
+		(*body)->restore_snapshot_state(state.transform, state.linear_velocity, state.angular_velocity, state.still_time, state.active != 0);
+	}
+
+	// Both lists are sorted by key, so they can be matched in a single pass.
+	// Pairs that didn't exist when the snapshot was saved lose their contacts,
+	// and the broadphase removes the ones that don't overlap anymore on the next step.
+	LocalVector<GodotBodyPair3D *> pairs;
+	_get_snapshot_pairs(pairs);
+
+	GodotBodyPair3D::SnapshotState state;
+	uint32_t state_index = 0;
+	bool state_loaded = false;
+	for (GodotBodyPair3D *pair : pairs) {
+		const GodotBodyPair3D::SnapshotKey key = pair->get_snapshot_key();
+		while (state_index < header.pair_count) {
+			if (!state_loaded) {
+				memcpy(&state, r + state_index * sizeof(GodotBodyPair3D::SnapshotState), sizeof(GodotBodyPair3D::SnapshotState));
+				state_loaded = true;
+			}
+			if (!(state.key < key)) {
+				break;
+			}
+			state_index++;
+			state_loaded = false;
+		}
+
+		if (state_loaded && state.key == key) {
+			pair->restore_snapshot_state(state);
+		} else {
+			pair->clear_contacts();
+		}
+	}
+}
+
 void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS:
@@ -1212,6 +1649,9 @@ void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_v
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			solver_iterations = p_value;
 			break;
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS:
+			solver_substeps = MAX(1, (int)p_value);
+			break;
 	}
 }
 
@@ -1233,6 +1673,8 @@ real_t GodotSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 			return body_time_to_sleep;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			return solver_iterations;
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS:
+			return solver_substeps;
 	}
 	return 0;
 }
@@ -1258,8 +1700,11 @@ GodotSpace3D::GodotSpace3D() {
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_angular");
 	body_time_to_sleep = GLOBAL_GET("physics/3d/time_before_sleep");
 	solver_iterations = GLOBAL_GET("physics/3d/solver/solver_iterations");
+	solver_substeps = MAX(1, (int)GLOBAL_GET("physics/3d/solver/solver_substeps"));
+	deterministic = GLOBAL_GET("physics/3d/solver/deterministic");
 	contact_recycle_radius = GLOBAL_GET("physics/3d/solver/contact_recycle_radius");
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
+	contact_manifold_reuse_distance = GLOBAL_GET("physics/3d/solver/contact_manifold_reuse_distance");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/3d/solver/default_contact_bias");
 
@@ -37,15 +37,23 @@
 #include "godot_body_pair_3d.h"
 #include "godot_broad_phase_3d.h"
 #include "godot_collision_object_3d.h"
+#include "godot_particle_pool_3d.h"
 #include "godot_soft_body_3d.h"
 
 #include "core/config/project_settings.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	friend class GodotParticlePool3D;
+
+	// Query bodies that take their broadphase result buffers as arguments, so batches can run them on threads.
+	bool _intersect_ray(const RayParameters &p_parameters, RayResult &r_result, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const;
+	bool _cast_motion(const ShapeParameters &p_parameters, GodotShape3D *p_shape, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const;
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -55,6 +63,8 @@ public:
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
+	virtual void cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
 	GodotPhysicsDirectSpaceState3D();
@@ -85,18 +95,25 @@ private:
 	SelfList<GodotArea3D>::List monitor_query_list;
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
+	SelfList<GodotParticlePool3D>::List particle_pool_list;
 
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
 
+	void _get_snapshot_pairs(LocalVector<GodotBodyPair3D *> &r_pairs) const;
+
 	HashSet<GodotCollisionObject3D *> objects;
 
 	GodotArea3D *area = nullptr;
 
 	int solver_iterations = 0;
+	int solver_substeps = 1;
+	int substeps_left = 1;
+	bool deterministic = false;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
+	real_t contact_manifold_reuse_distance = 0.0;
 	real_t contact_max_allowed_penetration = 0.0;
 	real_t contact_bias = 0.0;
 
@@ -107,6 +124,30 @@ private:
 	GodotCollisionObject3D *intersection_query_results[INTERSECTION_QUERY_MAX];
 	int intersection_query_subindex_results[INTERSECTION_QUERY_MAX];
 
+	// Broadphase results for body motion tests. A test culls the whole area it can reach once,
+	// then each of its steps only filters the candidates against its own AABB.
+	// Nearby bodies tested in the same batch share their candidates.
+	struct MotionQuery {
+		AABB aabb;
+		bool candidates_valid = false;
+		int candidate_count = 0;
+		LocalVector<GodotCollisionObject3D *> candidates;
+		LocalVector<int> candidate_shapes;
+
+		// Results of the current step.
+		LocalVector<GodotCollisionObject3D *> results;
+		LocalVector<int> subindex_results;
+
+		MotionQuery() {
+			candidates.resize(INTERSECTION_QUERY_MAX);
+			candidate_shapes.resize(INTERSECTION_QUERY_MAX);
+			results.resize(INTERSECTION_QUERY_MAX);
+			subindex_results.resize(INTERSECTION_QUERY_MAX);
+		}
+	};
+
+	MotionQuery motion_query;
+
 	real_t body_linear_velocity_sleep_threshold = 0.0;
 	real_t body_angular_velocity_sleep_threshold = 0.0;
 	real_t body_time_to_sleep = 0.0;
@@ -125,8 +166,13 @@ private:
 	int contact_debug_count = 0;
 
 	friend class GodotPhysicsDirectSpaceState3D;
+	friend class GodotParticlePool3D;
 
-	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb);
+	bool _get_body_motion_aabb(const GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, AABB &r_body_aabb) const;
+	AABB _get_motion_query_aabb(const AABB &p_body_aabb, const Vector3 &p_motion) const;
+	void _fill_motion_query(const AABB &p_aabb, MotionQuery &p_query) const;
+	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb, MotionQuery &p_query) const;
+	bool _test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result, MotionQuery &p_query, bool p_fill_query) const;
 
 public:
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
@@ -154,6 +200,10 @@ public:
 	void soft_body_add_to_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 	void soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 
+	const SelfList<GodotParticlePool3D>::List &get_particle_pool_list() const;
+	void particle_pool_add_to_list(SelfList<GodotParticlePool3D> *p_particle_pool);
+	void particle_pool_remove_from_list(SelfList<GodotParticlePool3D> *p_particle_pool);
+
 	GodotBroadPhase3D *get_broadphase();
 
 	void add_object(GodotCollisionObject3D *p_object);
@@ -161,8 +211,14 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ int get_solver_substeps() const { return solver_substeps; }
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
+	// Substeps of the current physics step that are not done yet, including the one being stepped.
+	_FORCE_INLINE_ void set_substeps_left(int p_substeps) { substeps_left = p_substeps; }
+	_FORCE_INLINE_ int get_substeps_left() const { return substeps_left; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
+	_FORCE_INLINE_ real_t get_contact_manifold_reuse_distance() const { return contact_manifold_reuse_distance; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
 	_FORCE_INLINE_ real_t get_contact_bias() const { return contact_bias; }
 	_FORCE_INLINE_ real_t get_body_linear_velocity_sleep_threshold() const { return body_linear_velocity_sleep_threshold; }
@@ -180,6 +236,11 @@ public:
 	real_t get_last_step() const { return last_step; }
 	void set_last_step(real_t p_step) { last_step = p_step; }
 
+	void shift_origin(const Vector3 &p_offset);
+
+	PackedByteArray save_snapshot() const;
+	void restore_snapshot(const PackedByteArray &p_snapshot);
+
 	void set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer3D::SpaceParameter p_param) const;
 
@@ -210,6 +271,7 @@ public:
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
 	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result);
+	void test_body_motions(GodotBody3D *const *p_bodies, const PhysicsServer3D::MotionParameters *p_parameters, int p_count, PhysicsServer3D::MotionResult *r_results, bool *r_collided);
 
 	GodotSpace3D();
 	~GodotSpace3D();
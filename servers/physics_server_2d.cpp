@@ -73,6 +73,14 @@ PhysicsServer2D *PhysicsServer2D::get_singleton() {
 	return singleton;
 }
 
+PackedByteArray PhysicsServer2D::space_save_snapshot(RID p_space) const {
+	ERR_FAIL_V_MSG(PackedByteArray(), "Space snapshots are not supported by this physics server.");
+}
+
+void PhysicsServer2D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	ERR_FAIL_MSG("Space snapshots are not supported by this physics server.");
+}
+
 void PhysicsDirectBodyState2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_total_gravity"), &PhysicsDirectBodyState2D::get_total_gravity);
 	ClassDB::bind_method(D_METHOD("get_total_linear_damp"), &PhysicsDirectBodyState2D::get_total_linear_damp);
@@ -395,6 +403,66 @@ TypedArray<Dictionary> PhysicsDirectSpaceState2D::_intersect_shape(const Ref<Phy
 	return ret;
 }
 
+static Array _shape_results_to_array(const Vector<PhysicsDirectSpaceState2D::ShapeResult> &p_results, const Vector<int> &p_result_counts, int p_result_max) {
+	Array ret;
+	ret.resize(p_result_counts.size());
+	for (int i = 0; i < p_result_counts.size(); i++) {
+		int rc = p_result_counts[i];
+		TypedArray<Dictionary> r;
+		r.resize(rc);
+		for (int j = 0; j < rc; j++) {
+			const PhysicsDirectSpaceState2D::ShapeResult &result = p_results[i * p_result_max + j];
+			Dictionary d;
+			d["rid"] = result.rid;
+			d["collider_id"] = result.collider_id;
+			d["collider"] = result.collider;
+			d["shape"] = result.shape;
+			r[j] = d;
+		}
+		ret[i] = r;
+	}
+	return ret;
+}
+
+Array PhysicsDirectSpaceState2D::_intersect_points(const Ref<PhysicsPointQueryParameters2D> &p_point_query, const PackedVector2Array &p_positions, int p_max_results) {
+	ERR_FAIL_COND_V(p_point_query.is_null(), Array());
+	ERR_FAIL_COND_V(p_max_results < 0, Array());
+
+	int count = p_positions.size();
+
+	Vector<ShapeResult> results;
+	results.resize(count * p_max_results);
+	Vector<int> result_counts;
+	result_counts.resize(count);
+
+	intersect_points(p_point_query->get_parameters(), p_positions.ptr(), count, results.ptrw(), p_max_results, result_counts.ptrw());
+
+	return _shape_results_to_array(results, result_counts, p_max_results);
+}
+
+Array PhysicsDirectSpaceState2D::_intersect_shapes(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, const TypedArray<Transform2D> &p_transforms, int p_max_results) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
+	ERR_FAIL_COND_V(p_max_results < 0, Array());
+
+	int count = p_transforms.size();
+
+	Vector<Transform2D> transforms;
+	transforms.resize(count);
+	Transform2D *transforms_w = transforms.ptrw();
+	for (int i = 0; i < count; i++) {
+		transforms_w[i] = p_transforms[i];
+	}
+
+	Vector<ShapeResult> results;
+	results.resize(count * p_max_results);
+	Vector<int> result_counts;
+	result_counts.resize(count);
+
+	intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), count, results.ptrw(), p_max_results, result_counts.ptrw());
+
+	return _shape_results_to_array(results, result_counts, p_max_results);
+}
+
 Vector<real_t> PhysicsDirectSpaceState2D::_cast_motion(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
 
@@ -449,6 +517,22 @@ Dictionary PhysicsDirectSpaceState2D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+void PhysicsDirectSpaceState2D::intersect_points(const PointParameters &p_parameters, const Vector2 *p_positions, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	PointParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.position = p_positions[i];
+		r_result_counts[i] = intersect_point(parameters, &r_results[i * p_result_max], p_result_max);
+	}
+}
+
+void PhysicsDirectSpaceState2D::intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, &r_results[i * p_result_max], p_result_max);
+	}
+}
+
 PhysicsDirectSpaceState2D::PhysicsDirectSpaceState2D() {
 }
 
@@ -456,6 +540,8 @@ void PhysicsDirectSpaceState2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState2D::_intersect_ray);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_points", "parameters", "positions", "max_results"), &PhysicsDirectSpaceState2D::_intersect_points, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shapes, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState2D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState2D::_get_rest_info);
@@ -638,6 +724,8 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_snapshot", "space"), &PhysicsServer2D::space_save_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer2D::space_restore_snapshot);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer2D::area_set_space);
@@ -120,6 +120,8 @@ class PhysicsDirectSpaceState2D : public Object {
 	Dictionary _intersect_ray(const Ref<PhysicsRayQueryParameters2D> &p_ray_query);
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters2D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results = 32);
+	Array _intersect_points(const Ref<PhysicsPointQueryParameters2D> &p_point_query, const PackedVector2Array &p_positions, int p_max_results = 32);
+	Array _intersect_shapes(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, const TypedArray<Transform2D> &p_transforms, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query);
 	TypedArray<Vector2> _collide_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query);
@@ -198,6 +200,13 @@ public:
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector2 *r_results, int p_result_max, int &r_result_count) = 0;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) = 0;
 
+	// Batched queries. Every point or shape uses p_parameters with its own position or transform.
+	// Query i writes up to p_result_max results starting at r_results[i * p_result_max], and its
+	// result count to r_result_counts[i]. The default implementations run the single queries in
+	// order; servers can override them to spread a batch over worker threads.
+	virtual void intersect_points(const PointParameters &p_parameters, const Vector2 *p_positions, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+
 	PhysicsDirectSpaceState2D();
 };
 
@@ -276,6 +285,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	virtual PackedByteArray space_save_snapshot(RID p_space) const;
+	virtual void space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot);
+
 	//missing space parameters
 
 	/* AREA API */
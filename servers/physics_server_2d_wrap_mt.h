@@ -114,6 +114,8 @@ public:
 	}
 
 	FUNC2(space_set_debug_contacts, RID, int);
+	FUNC1RC(PackedByteArray, space_save_snapshot, RID);
+	FUNC2(space_restore_snapshot, RID, const PackedByteArray &);
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override {
 		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), Vector<Vector2>());
 		return physics_server_2d->space_get_contacts(p_space);
@@ -56,6 +56,82 @@ void PhysicsServer3DRenderingServerHandler::_bind_methods() {
 
 PhysicsServer3D *PhysicsServer3D::singleton = nullptr;
 
+void PhysicsServer3D::space_shift_origin(RID p_space, const Vector3 &p_offset) {
+	ERR_FAIL_MSG("Shifting the origin of a space is not supported by this physics server.");
+}
+
+PackedByteArray PhysicsServer3D::space_save_snapshot(RID p_space) const {
+	ERR_FAIL_V_MSG(PackedByteArray(), "Space snapshots are not supported by this physics server.");
+}
+
+void PhysicsServer3D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	ERR_FAIL_MSG("Space snapshots are not supported by this physics server.");
+}
+
+RID PhysicsServer3D::particle_pool_create() {
+	ERR_FAIL_V_MSG(RID(), "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_space(RID p_pool, RID p_space) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+RID PhysicsServer3D::particle_pool_get_space(RID p_pool) const {
+	ERR_FAIL_V_MSG(RID(), "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_radius(RID p_pool, real_t p_radius) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+real_t PhysicsServer3D::particle_pool_get_radius(RID p_pool) const {
+	ERR_FAIL_V_MSG(0.0, "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_collision_mask(RID p_pool, uint32_t p_mask) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+uint32_t PhysicsServer3D::particle_pool_get_collision_mask(RID p_pool) const {
+	ERR_FAIL_V_MSG(0, "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_gravity_scale(RID p_pool, real_t p_gravity_scale) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+real_t PhysicsServer3D::particle_pool_get_gravity_scale(RID p_pool) const {
+	ERR_FAIL_V_MSG(0.0, "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_bounce(RID p_pool, real_t p_bounce) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+real_t PhysicsServer3D::particle_pool_get_bounce(RID p_pool) const {
+	ERR_FAIL_V_MSG(0.0, "Particle pools are not supported by this physics server.");
+}
+
+void PhysicsServer3D::particle_pool_set_particles(RID p_pool, const PackedVector3Array &p_positions, const PackedVector3Array &p_velocities) {
+	ERR_FAIL_MSG("Particle pools are not supported by this physics server.");
+}
+
+int PhysicsServer3D::particle_pool_get_particle_count(RID p_pool) const {
+	ERR_FAIL_V_MSG(0, "Particle pools are not supported by this physics server.");
+}
+
+PackedVector3Array PhysicsServer3D::particle_pool_get_positions(RID p_pool) const {
+	ERR_FAIL_V_MSG(PackedVector3Array(), "Particle pools are not supported by this physics server.");
+}
+
+PackedVector3Array PhysicsServer3D::particle_pool_get_velocities(RID p_pool) const {
+	ERR_FAIL_V_MSG(PackedVector3Array(), "Particle pools are not supported by this physics server.");
+}
+
+Dictionary PhysicsServer3D::particle_pool_get_collisions(RID p_pool) const {
+	ERR_FAIL_V_MSG(Dictionary(), "Particle pools are not supported by this physics server.");
+}
+
 void PhysicsDirectBodyState3D::integrate_forces() {
 	real_t step = get_step();
 	Vector3 lv = get_linear_velocity();
@@ -435,6 +511,99 @@ Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion(const Ref<PhysicsShapeQue
 	return ret;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The from and to arrays must have the same size.");
+
+	int count = p_from.size();
+
+	Vector<RayResult> results;
+	results.resize(count);
+	Vector<bool> hits;
+	hits.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptrw(), hits.ptrw());
+
+	PackedByteArray hit;
+	PackedVector3Array position;
+	PackedVector3Array normal;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	PackedInt32Array face_index;
+	hit.resize(count);
+	position.resize(count);
+	normal.resize(count);
+	collider_id.resize(count);
+	shape.resize(count);
+	face_index.resize(count);
+
+	uint8_t *hit_w = hit.ptrw();
+	Vector3 *position_w = position.ptrw();
+	Vector3 *normal_w = normal.ptrw();
+	int64_t *collider_id_w = collider_id.ptrw();
+	int32_t *shape_w = shape.ptrw();
+	int32_t *face_index_w = face_index.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		const RayResult &result = results[i];
+		if (hits[i]) {
+			hit_w[i] = 1;
+			position_w[i] = result.position;
+			normal_w[i] = result.normal;
+			collider_id_w[i] = (int64_t)result.collider_id;
+			shape_w[i] = result.shape;
+			face_index_w[i] = result.face_index;
+		} else {
+			hit_w[i] = 0;
+			position_w[i] = Vector3();
+			normal_w[i] = Vector3();
+			collider_id_w[i] = 0;
+			shape_w[i] = 0;
+			face_index_w[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["face_index"] = face_index;
+
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
+	ERR_FAIL_COND_V_MSG(p_transforms.size() != p_motions.size(), Vector<real_t>(), "The transforms and motions arrays must have the same size.");
+
+	int count = p_motions.size();
+
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+	Transform3D *transforms_w = transforms.ptrw();
+	for (int i = 0; i < count; i++) {
+		transforms_w[i] = p_transforms[i];
+	}
+
+	Vector<real_t> closest_safe;
+	closest_safe.resize(count);
+	Vector<real_t> closest_unsafe;
+	closest_unsafe.resize(count);
+
+	cast_motions(p_shape_query->get_parameters(), transforms.ptr(), p_motions.ptr(), count, closest_safe.ptrw(), closest_unsafe.ptrw());
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *ret_w = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		ret_w[i * 2 + 0] = closest_safe[i];
+		ret_w[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
 TypedArray<Vector3> PhysicsDirectSpaceState3D::_collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), TypedArray<Vector3>());
 
@@ -474,6 +643,29 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		parameters.motion = p_motions[i];
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+		if (!cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i])) {
+			r_closest_safe[i] = 1.0;
+			r_closest_unsafe[i] = 1.0;
+		}
+	}
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -482,6 +674,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
+	ClassDB::bind_method(D_METHOD("cast_motions", "parameters", "transforms", "motions"), &PhysicsDirectSpaceState3D::_cast_motions);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
 }
@@ -660,6 +854,52 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+PackedByteArray PhysicsServer3D::_body_test_motions(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results) {
+	ERR_FAIL_COND_V_MSG(p_bodies.size() != p_parameters.size(), PackedByteArray(), "The bodies and parameters arrays must have the same size.");
+	ERR_FAIL_COND_V_MSG(!p_results.is_empty() && p_results.size() != p_bodies.size(), PackedByteArray(), "The results array must be empty or have the same size as the bodies array.");
+
+	int count = p_bodies.size();
+
+	Vector<RID> bodies;
+	Vector<MotionParameters> parameters;
+	bodies.resize(count);
+	parameters.resize(count);
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsTestMotionParameters3D> motion_parameters = p_parameters[i];
+		ERR_FAIL_COND_V(motion_parameters.is_null(), PackedByteArray());
+		bodies.write[i] = p_bodies[i];
+		parameters.write[i] = motion_parameters->get_parameters();
+	}
+
+	Vector<MotionResult> results;
+	Vector<bool> collided;
+	results.resize(count);
+	collided.resize(count);
+
+	body_test_motions(bodies.ptr(), parameters.ptr(), count, results.ptrw(), collided.ptrw());
+
+	PackedByteArray ret;
+	ret.resize(count);
+	uint8_t *w = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		w[i] = collided[i] ? 1 : 0;
+		if (!p_results.is_empty()) {
+			Ref<PhysicsTestMotionResult3D> result = p_results[i];
+			if (result.is_valid()) {
+				*result->get_result_ptr() = results[i];
+			}
+		}
+	}
+
+	return ret;
+}
+
+void PhysicsServer3D::body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) {
+	for (int i = 0; i < p_count; i++) {
+		r_collided[i] = body_test_motion(p_bodies[i], p_parameters[i], &r_results[i]);
+	}
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -712,6 +952,9 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_shift_origin", "space", "offset"), &PhysicsServer3D::space_shift_origin);
+	ClassDB::bind_method(D_METHOD("space_save_snapshot", "space"), &PhysicsServer3D::space_save_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer3D::space_restore_snapshot);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -830,6 +1073,7 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("body_set_ray_pickable", "body", "enable"), &PhysicsServer3D::body_set_ray_pickable);
 
 	ClassDB::bind_method(D_METHOD("body_test_motion", "body", "parameters", "result"), &PhysicsServer3D::_body_test_motion, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("body_test_motions", "bodies", "parameters", "results"), &PhysicsServer3D::_body_test_motions, DEFVAL(TypedArray<PhysicsTestMotionResult3D>()));
 
 	ClassDB::bind_method(D_METHOD("body_get_direct_state", "body"), &PhysicsServer3D::body_get_direct_state);
 
@@ -889,6 +1133,33 @@ void PhysicsServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("soft_body_is_point_pinned", "body", "point_index"), &PhysicsServer3D::soft_body_is_point_pinned);
 
+	/* PARTICLE POOL API */
+
+	ClassDB::bind_method(D_METHOD("particle_pool_create"), &PhysicsServer3D::particle_pool_create);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_space", "pool", "space"), &PhysicsServer3D::particle_pool_set_space);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_space", "pool"), &PhysicsServer3D::particle_pool_get_space);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_radius", "pool", "radius"), &PhysicsServer3D::particle_pool_set_radius);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_radius", "pool"), &PhysicsServer3D::particle_pool_get_radius);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_collision_mask", "pool", "mask"), &PhysicsServer3D::particle_pool_set_collision_mask);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_collision_mask", "pool"), &PhysicsServer3D::particle_pool_get_collision_mask);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_gravity_scale", "pool", "gravity_scale"), &PhysicsServer3D::particle_pool_set_gravity_scale);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_gravity_scale", "pool"), &PhysicsServer3D::particle_pool_get_gravity_scale);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_bounce", "pool", "bounce"), &PhysicsServer3D::particle_pool_set_bounce);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_bounce", "pool"), &PhysicsServer3D::particle_pool_get_bounce);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_set_particles", "pool", "positions", "velocities"), &PhysicsServer3D::particle_pool_set_particles);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_particle_count", "pool"), &PhysicsServer3D::particle_pool_get_particle_count);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_get_positions", "pool"), &PhysicsServer3D::particle_pool_get_positions);
+	ClassDB::bind_method(D_METHOD("particle_pool_get_velocities", "pool"), &PhysicsServer3D::particle_pool_get_velocities);
+
+	ClassDB::bind_method(D_METHOD("particle_pool_get_collisions", "pool"), &PhysicsServer3D::particle_pool_get_collisions);
+
 	/* JOINT API */
 
 	ClassDB::bind_method(D_METHOD("joint_create"), &PhysicsServer3D::joint_create);
@@ -1094,6 +1365,7 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_TIME_TO_SLEEP);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_SOLVER_ITERATIONS);
+	BIND_ENUM_CONSTANT(SPACE_PARAM_SOLVER_SUBSTEPS);
 
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_X);
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_Y);
@@ -1119,10 +1391,13 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF("physics/3d/sleep_threshold_angular", Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"), 16);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_substeps", PROPERTY_HINT_RANGE, "1,8,1,or_greater"), 1);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.01);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_manifold_reuse_distance", PROPERTY_HINT_RANGE, "0,0.01,0.0001,or_greater"), 0.0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF("physics/3d/solver/deterministic", false);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
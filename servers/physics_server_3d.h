@@ -125,6 +125,8 @@ private:
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
+	Vector<real_t> _cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, const PackedVector3Array &p_motions);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 
@@ -203,6 +205,12 @@ public:
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) = 0;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) = 0;
 
+	// Batched queries. Every ray or motion uses p_parameters with its own from/to or transform/motion,
+	// and the output arrays must hold p_count elements. The default implementations run the single
+	// queries in order; servers can override them to spread a batch over worker threads.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits);
+	virtual void cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe);
+
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
 	PhysicsDirectSpaceState3D();
@@ -234,6 +242,7 @@ class PhysicsServer3D : public Object {
 	static PhysicsServer3D *singleton;
 
 	virtual bool _body_test_motion(RID p_body, const Ref<PhysicsTestMotionParameters3D> &p_parameters, const Ref<PhysicsTestMotionResult3D> &p_result = Ref<PhysicsTestMotionResult3D>());
+	PackedByteArray _body_test_motions(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results);
 
 protected:
 	static void _bind_methods();
@@ -294,6 +303,7 @@ public:
 		SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD,
 		SPACE_PARAM_BODY_TIME_TO_SLEEP,
 		SPACE_PARAM_SOLVER_ITERATIONS,
+		SPACE_PARAM_SOLVER_SUBSTEPS,
 	};
 
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
@@ -302,6 +312,11 @@ public:
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) = 0;
 
+	// Moves everything in the space by -p_offset at once, keeping velocities and contacts, for floating origin setups.
+	virtual void space_shift_origin(RID p_space, const Vector3 &p_offset);
+	virtual PackedByteArray space_save_snapshot(RID p_space) const;
+	virtual void space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot);
+
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) = 0;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
@@ -566,6 +581,8 @@ public:
 	};
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) = 0;
+	// Tests many motions at once, the default implementation runs them one by one.
+	virtual void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided);
 
 	/* SOFT BODY */
 
@@ -622,6 +639,37 @@ public:
 	virtual void soft_body_pin_point(RID p_body, int p_point_index, bool p_pin) = 0;
 	virtual bool soft_body_is_point_pinned(RID p_body, int p_point_index) const = 0;
 
+	/* PARTICLE POOL API */
+
+	// Pools of spheres or points that move with swept collision tests, for projectiles and debris.
+	// Particles have no RID or node of their own, and collisions are reported in packed arrays once
+	// per step. The default implementations report an error, so servers only need to support them if
+	// they can.
+	virtual RID particle_pool_create();
+
+	virtual void particle_pool_set_space(RID p_pool, RID p_space);
+	virtual RID particle_pool_get_space(RID p_pool) const;
+
+	virtual void particle_pool_set_radius(RID p_pool, real_t p_radius);
+	virtual real_t particle_pool_get_radius(RID p_pool) const;
+
+	virtual void particle_pool_set_collision_mask(RID p_pool, uint32_t p_mask);
+	virtual uint32_t particle_pool_get_collision_mask(RID p_pool) const;
+
+	virtual void particle_pool_set_gravity_scale(RID p_pool, real_t p_gravity_scale);
+	virtual real_t particle_pool_get_gravity_scale(RID p_pool) const;
+
+	virtual void particle_pool_set_bounce(RID p_pool, real_t p_bounce);
+	virtual real_t particle_pool_get_bounce(RID p_pool) const;
+
+	virtual void particle_pool_set_particles(RID p_pool, const PackedVector3Array &p_positions, const PackedVector3Array &p_velocities);
+	virtual int particle_pool_get_particle_count(RID p_pool) const;
+
+	virtual PackedVector3Array particle_pool_get_positions(RID p_pool) const;
+	virtual PackedVector3Array particle_pool_get_velocities(RID p_pool) const;
+
+	virtual Dictionary particle_pool_get_collisions(RID p_pool) const;
+
 	/* JOINT API */
 
 	enum JointType {
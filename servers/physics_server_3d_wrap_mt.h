@@ -110,6 +110,9 @@ public:
 
 	FUNC3(space_set_param, RID, SpaceParameter, real_t);
 	FUNC2RC(real_t, space_get_param, RID, SpaceParameter);
+	FUNC2(space_shift_origin, RID, const Vector3 &);
+	FUNC1RC(PackedByteArray, space_save_snapshot, RID);
+	FUNC2(space_restore_snapshot, RID, const PackedByteArray &);
 
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override {
@@ -264,6 +267,11 @@ public:
 		return physics_server_3d->body_test_motion(p_body, p_parameters, r_result);
 	}
 
+	void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) override {
+		ERR_FAIL_COND(main_thread != Thread::get_caller_id());
+		physics_server_3d->body_test_motions(p_bodies, p_parameters, p_count, r_results, r_collided);
+	}
+
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override {
 		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), nullptr);
@@ -325,6 +333,33 @@ public:
 	FUNC3(soft_body_pin_point, RID, int, bool);
 	FUNC2RC(bool, soft_body_is_point_pinned, RID, int);
 
+	/* PARTICLE POOL API */
+
+	FUNCRID(particle_pool)
+
+	FUNC2(particle_pool_set_space, RID, RID);
+	FUNC1RC(RID, particle_pool_get_space, RID);
+
+	FUNC2(particle_pool_set_radius, RID, real_t);
+	FUNC1RC(real_t, particle_pool_get_radius, RID);
+
+	FUNC2(particle_pool_set_collision_mask, RID, uint32_t);
+	FUNC1RC(uint32_t, particle_pool_get_collision_mask, RID);
+
+	FUNC2(particle_pool_set_gravity_scale, RID, real_t);
+	FUNC1RC(real_t, particle_pool_get_gravity_scale, RID);
+
+	FUNC2(particle_pool_set_bounce, RID, real_t);
+	FUNC1RC(real_t, particle_pool_get_bounce, RID);
+
+	FUNC3(particle_pool_set_particles, RID, const PackedVector3Array &, const PackedVector3Array &);
+	FUNC1RC(int, particle_pool_get_particle_count, RID);
+
+	FUNC1RC(PackedVector3Array, particle_pool_get_positions, RID);
+	FUNC1RC(PackedVector3Array, particle_pool_get_velocities, RID);
+
+	FUNC1RC(Dictionary, particle_pool_get_collisions, RID);
+
 	/* JOINT API */
 
 	FUNCRID(joint)
@@ -30,6 +30,8 @@
 
 #include "material_storage.h"
 
+#include "core/config/engine.h"
+
 using namespace RendererDummy;
 
 MaterialStorage *MaterialStorage::singleton = nullptr;
@@ -65,6 +67,9 @@ void MaterialStorage::shader_set_code(RID p_shader, const String &p_code) {
 	if (p_code.is_empty()) {
 		return;
 	}
+	if (Engine::get_singleton()->is_dedicated_server_mode_enabled()) {
+		return; // Only needed for the uniform list, which a dedicated server has no use for.
+	}
 
 	String mode_string = ShaderLanguage::get_shader_type(p_code);
 
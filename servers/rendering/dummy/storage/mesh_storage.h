@@ -31,6 +31,7 @@
 #ifndef MESH_STORAGE_DUMMY_H
 #define MESH_STORAGE_DUMMY_H
 
+#include "core/config/engine.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "servers/rendering/storage/mesh_storage.h"
@@ -93,6 +94,15 @@ public:
 		s->blend_shape_data = p_surface.blend_shape_data;
 		s->uv_scale = p_surface.uv_scale;
 		s->material = p_surface.material;
+
+		if (Engine::get_singleton()->is_dedicated_server_mode_enabled()) {
+			// Only positions, normals and indices can matter without drawing (e.g. to build
+			// collision or navigation), drop the rest so it's not kept around for nothing.
+			s->format &= ~uint64_t(RS::ARRAY_FORMAT_COLOR | RS::ARRAY_FORMAT_TEX_UV | RS::ARRAY_FORMAT_TEX_UV2 | RS::ARRAY_FORMAT_CUSTOM0 | RS::ARRAY_FORMAT_CUSTOM1 | RS::ARRAY_FORMAT_CUSTOM2 | RS::ARRAY_FORMAT_CUSTOM3 | RS::ARRAY_FORMAT_BONES | RS::ARRAY_FORMAT_WEIGHTS);
+			s->attribute_data.clear();
+			s->skin_data.clear();
+			s->lods.clear();
+		}
 	}
 
 	virtual int mesh_get_blend_shape_count(RID p_mesh) const override { return 0; }
@@ -175,6 +185,9 @@ public:
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override {}
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override { return 0; }
 
+	virtual void multimesh_set_cull_distance(RID p_multimesh, float p_distance) override {}
+	virtual float multimesh_get_cull_distance(RID p_multimesh) const override { return 0.0; }
+
 	/* SKELETON API */
 
 	virtual RID skeleton_allocate() override { return RID(); }
@@ -120,6 +120,13 @@ public:
 	virtual String get_video_adapter_api_version() const override { return String(); }
 
 	virtual Size2i get_maximum_viewport_size() const override { return Size2i(); };
+
+	virtual void pipeline_manifest_set_recording(bool p_enable) override {}
+	virtual bool pipeline_manifest_is_recording() const override { return false; }
+	virtual TypedArray<Dictionary> pipeline_manifest_get() const override { return TypedArray<Dictionary>(); }
+	virtual void pipeline_manifest_clear() override {}
+	virtual void pipeline_manifest_precompile(const TypedArray<Dictionary> &p_manifest) override {}
+	virtual float pipeline_manifest_get_precompile_progress() const override { return 1.0; }
 };
 
 } // namespace RendererDummy
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -213,10 +214,12 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		}
 
 		if (ci->visibility_notifier) {
+			visibility_notifier_list_lock.lock();
 			if (!ci->visibility_notifier->visible_element.in_list()) {
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
 				ci->visibility_notifier->just_visible = true;
 			}
+			visibility_notifier_list_lock.unlock();
 
 			ci->visibility_notifier->visible_in_frame = RSG::rasterizer->get_frame_number();
 		}
@@ -344,6 +347,11 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		if (!use_canvas_group && !culling_children_threaded && child_item_count >= (int)cull_thread_threshold) {
+			_cull_canvas_item_children_threaded(ci, child_items, child_item_count, xform, p_clip_rect, global_rect, modulate, p_z, r_z_list, r_z_last_list, p_canvas_clip, p_material_owner, p_canvas_cull_mask);
+			return;
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -360,6 +368,69 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 }
 
+void RendererCanvasCull::_append_z_lists(RendererCanvasRender::Item **p_z_list, RendererCanvasRender::Item **p_z_last_list, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	for (int i = 0; i < z_range; i++) {
+		if (!p_z_list[i]) {
+			continue;
+		}
+		if (r_z_last_list[i]) {
+			r_z_last_list[i]->next = p_z_list[i];
+		} else {
+			r_z_list[i] = p_z_list[i];
+		}
+		r_z_last_list[i] = p_z_last_list[i];
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_item_children_chunk(uint32_t p_chunk, CullChildrenData *p_data) {
+	uint32_t from = p_chunk * p_data->child_item_count / p_data->chunk_count;
+	uint32_t to = (p_chunk + 1) * p_data->child_item_count / p_data->chunk_count;
+
+	RendererCanvasRender::Item **lists = chunk_z_lists.ptr() + p_chunk * CHUNK_Z_LIST_MAX * z_range;
+
+	for (uint32_t i = from; i < to; i++) {
+		Item *child = p_data->child_items[i];
+		RendererCanvasRender::Item **child_z_list = lists + (child->behind ? CHUNK_Z_LIST_BEHIND : CHUNK_Z_LIST) * z_range;
+		RendererCanvasRender::Item **child_z_last_list = lists + (child->behind ? CHUNK_Z_LAST_LIST_BEHIND : CHUNK_Z_LAST_LIST) * z_range;
+		_cull_canvas_item(child, p_data->xform, p_data->clip_rect, p_data->modulate, p_data->z, child_z_list, child_z_last_list, p_data->canvas_clip, p_data->material_owner, true, p_data->canvas_cull_mask);
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_item_children_threaded(Item *p_canvas_item, Item **p_child_items, int p_child_item_count, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Rect2 &p_global_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, uint32_t p_canvas_cull_mask) {
+	CullChildrenData data;
+	data.child_items = p_child_items;
+	data.child_item_count = p_child_item_count;
+	data.chunk_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), (uint32_t)p_child_item_count);
+	data.xform = p_xform;
+	data.clip_rect = p_clip_rect;
+	data.modulate = p_modulate;
+	data.z = p_z;
+	data.canvas_clip = (Item *)p_canvas_item->final_clip_owner;
+	data.material_owner = p_material_owner;
+	data.canvas_cull_mask = p_canvas_cull_mask;
+
+	chunk_z_lists.resize(data.chunk_count * CHUNK_Z_LIST_MAX * z_range);
+	memset(chunk_z_lists.ptr(), 0, chunk_z_lists.size() * sizeof(RendererCanvasRender::Item *));
+
+	// Only one level is culled in parallel, children with many children of their own are culled on the same thread.
+	culling_children_threaded = true;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_canvas_item_children_chunk, &data, data.chunk_count, -1, true, SNAME("CullCanvasItemChildren"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	culling_children_threaded = false;
+
+	for (uint32_t i = 0; i < data.chunk_count; i++) {
+		RendererCanvasRender::Item **lists = chunk_z_lists.ptr() + i * CHUNK_Z_LIST_MAX * z_range;
+		_append_z_lists(lists + CHUNK_Z_LIST_BEHIND * z_range, lists + CHUNK_Z_LAST_LIST_BEHIND * z_range, r_z_list, r_z_last_list);
+	}
+
+	_attach_canvas_item_for_draw(p_canvas_item, p_canvas_clip, r_z_list, r_z_last_list, p_xform, p_clip_rect, p_global_rect, p_modulate, p_z, p_material_owner, false, nullptr);
+
+	for (uint32_t i = 0; i < data.chunk_count; i++) {
+		RendererCanvasRender::Item **lists = chunk_z_lists.ptr() + i * CHUNK_Z_LIST_MAX * z_range;
+		_append_z_lists(lists + CHUNK_Z_LIST * z_range, lists + CHUNK_Z_LAST_LIST * z_range, r_z_list, r_z_last_list);
+	}
+}
+
 void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info) {
 	RENDER_TIMESTAMP("> Render Canvas");
 
@@ -524,6 +595,19 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	canvas_item->xform = p_transform;
 }
 
+void RendererCanvasCull::canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+
+	const RID *items = p_items.ptr();
+	const Transform2D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(items[i]);
+		ERR_CONTINUE(!canvas_item);
+
+		canvas_item->xform = transforms[i];
+	}
+}
+
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
@@ -2203,6 +2287,9 @@ RendererCanvasCull::RendererCanvasCull() {
 
 	debug_redraw_time = GLOBAL_DEF("debug/canvas_items/debug_redraw_time", 1.0);
 	debug_redraw_color = GLOBAL_DEF("debug/canvas_items/debug_redraw_color", Color(1.0, 0.2, 0.2, 0.5));
+
+	cull_thread_threshold = GLOBAL_GET("rendering/limits/canvas/threaded_cull_minimum_children");
+	cull_thread_threshold = MAX(cull_thread_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); // Make sure there is at least one child per thread.
 }
 
 RendererCanvasCull::~RendererCanvasCull() {
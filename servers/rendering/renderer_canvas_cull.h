@@ -31,6 +31,8 @@
 #ifndef RENDERER_CANVAS_CULL_H
 #define RENDERER_CANVAS_CULL_H
 
+#include "core/os/spin_lock.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
@@ -183,6 +185,7 @@ public:
 
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
+	SpinLock visibility_notifier_list_lock;
 
 	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from);
 
@@ -195,6 +198,37 @@ private:
 	RendererCanvasRender::Item **z_list;
 	RendererCanvasRender::Item **z_last_list;
 
+	// Children of an item with many of them are culled in chunks on worker threads, each chunk into its own z lists.
+	// The lists are then appended in child order, so the draw order is the same as when culling on a single thread.
+	struct CullChildrenData {
+		Item **child_items = nullptr;
+		uint32_t child_item_count = 0;
+		uint32_t chunk_count = 0;
+		Transform2D xform;
+		Rect2 clip_rect;
+		Color modulate;
+		int z = 0;
+		Item *canvas_clip = nullptr;
+		Item *material_owner = nullptr;
+		uint32_t canvas_cull_mask = 0;
+	};
+
+	enum {
+		CHUNK_Z_LIST_BEHIND,
+		CHUNK_Z_LAST_LIST_BEHIND,
+		CHUNK_Z_LIST,
+		CHUNK_Z_LAST_LIST,
+		CHUNK_Z_LIST_MAX
+	};
+
+	uint32_t cull_thread_threshold = 0;
+	bool culling_children_threaded = false;
+	LocalVector<RendererCanvasRender::Item *> chunk_z_lists; // CHUNK_Z_LIST_MAX lists of z_range per chunk.
+
+	void _cull_canvas_item_children_threaded(Item *p_canvas_item, Item **p_child_items, int p_child_item_count, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Rect2 &p_global_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, uint32_t p_canvas_cull_mask);
+	void _cull_canvas_item_children_chunk(uint32_t p_chunk, CullChildrenData *p_data);
+	void _append_z_lists(RendererCanvasRender::Item **p_z_list, RendererCanvasRender::Item **p_z_last_list, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+
 public:
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
@@ -220,6 +254,7 @@ public:
 	uint32_t canvas_item_get_visibility_layer(RID p_item);
 
 	void canvas_item_set_transform(RID p_item, const Transform2D &p_transform);
+	void canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms);
 	void canvas_item_set_clip(RID p_item, bool p_clip);
 	void canvas_item_set_distance_field_mode(RID p_item, bool p_enable);
 	void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2());
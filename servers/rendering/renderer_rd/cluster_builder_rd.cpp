@@ -245,8 +245,12 @@ void ClusterBuilderRD::_clear() {
 	element_buffer = RID();
 
 	memfree(render_elements);
+	memfree(baked_render_elements);
 
 	render_elements = nullptr;
+	baked_render_elements = nullptr;
+	baked_render_element_count = 0;
+	baked = false;
 	render_element_max = 0;
 	render_element_count = 0;
 
@@ -287,6 +291,7 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 	cluster_buffer = RD::get_singleton()->storage_buffer_create(cluster_buffer_size);
 
 	render_elements = static_cast<RenderElementData *>(memalloc(sizeof(RenderElementData) * render_element_max));
+	baked_render_elements = static_cast<RenderElementData *>(memalloc(sizeof(RenderElementData) * render_element_max));
 	render_element_count = 0;
 
 	element_buffer = RD::get_singleton()->storage_buffer_create(sizeof(RenderElementData) * render_element_max);
@@ -417,6 +422,28 @@ void ClusterBuilderRD::begin(const Transform3D &p_view_transform, const Projecti
 void ClusterBuilderRD::bake_cluster() {
 	RENDER_TIMESTAMP("> Bake 3D Cluster");
 
+	StateUniform state = {};
+
+	RendererRD::MaterialStorage::store_camera(adjusted_projection, state.projection);
+	state.inv_z_far = 1.0 / z_far;
+	state.screen_to_clusters_shift = get_shift_from_power_of_2(cluster_size);
+	state.screen_to_clusters_shift -= divisor; //screen is smaller, shift one less
+
+	state.cluster_screen_width = cluster_screen_size.x;
+	state.cluster_depth_offset = (render_element_max / 32);
+	state.cluster_data_size = state.cluster_depth_offset + render_element_max;
+
+	// The cluster buffer only depends on the camera and the elements, so keep the previous result if none of them changed.
+	if (baked && render_element_count == baked_render_element_count && (render_element_count == 0 || memcmp(&state, &baked_state, sizeof(StateUniform)) == 0) && memcmp(render_elements, baked_render_elements, sizeof(RenderElementData) * render_element_count) == 0) {
+		RENDER_TIMESTAMP("< Bake 3D Cluster (Unchanged)");
+		return;
+	}
+
+	baked = true;
+	baked_state = state;
+	baked_render_element_count = render_element_count;
+	memcpy(baked_render_elements, render_elements, sizeof(RenderElementData) * render_element_count);
+
 	RD::get_singleton()->draw_command_begin_label("Bake Light Cluster");
 
 	// Clear cluster buffer.
@@ -426,21 +453,8 @@ void ClusterBuilderRD::bake_cluster() {
 		// Clear render buffer.
 		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size);
 
-		{ // Fill state uniform.
-
-			StateUniform state;
-
-			RendererRD::MaterialStorage::store_camera(adjusted_projection, state.projection);
-			state.inv_z_far = 1.0 / z_far;
-			state.screen_to_clusters_shift = get_shift_from_power_of_2(cluster_size);
-			state.screen_to_clusters_shift -= divisor; //screen is smaller, shift one less
-
-			state.cluster_screen_width = cluster_screen_size.x;
-			state.cluster_depth_offset = (render_element_max / 32);
-			state.cluster_data_size = state.cluster_depth_offset + render_element_max;
-
-			RD::get_singleton()->buffer_update(state_uniform, 0, sizeof(StateUniform), &state);
-		}
+		// Fill state uniform.
+		RD::get_singleton()->buffer_update(state_uniform, 0, sizeof(StateUniform), &state);
 
 		// Update instances.
 
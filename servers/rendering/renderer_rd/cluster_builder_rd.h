@@ -220,6 +220,12 @@ private:
 
 	RID state_uniform;
 
+	// Inputs of the last bake, used to skip rebuilding the cluster when neither the camera nor the elements changed.
+	RenderElementData *baked_render_elements = nullptr;
+	uint32_t baked_render_element_count = 0;
+	StateUniform baked_state = {};
+	bool baked = false;
+
 	RID debug_uniform_set;
 
 public:
@@ -262,6 +268,7 @@ public:
 			e.scale[0] = radius;
 			e.scale[1] = radius;
 			e.scale[2] = radius;
+			e.has_wide_spot_angle = false;
 			e.type = ELEMENT_TYPE_OMNI_LIGHT;
 			e.original_index = cluster_count_by_type[ELEMENT_TYPE_OMNI_LIGHT];
 
@@ -365,6 +372,7 @@ public:
 		e.scale[0] = scale.x;
 		e.scale[1] = scale.y;
 		e.scale[2] = scale.z;
+		e.has_wide_spot_angle = false;
 
 		e.type = (p_box_type == BOX_TYPE_DECAL) ? ELEMENT_TYPE_DECAL : ELEMENT_TYPE_REFLECTION_PROBE;
 		e.original_index = cluster_count_by_type[e.type];
@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*  hiz.cpp                                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hiz.h"
+#include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
+using namespace RendererRD;
+
+HiZ::HiZ() {
+	Vector<String> hiz_modes;
+	hiz_modes.push_back("\n#define MODE_FROM_DEPTH\n");
+	hiz_modes.push_back("\n");
+
+	hiz.shader.initialize(hiz_modes);
+
+	hiz.shader_version = hiz.shader.version_create();
+
+	for (int i = 0; i < HIZ_MODE_MAX; i++) {
+		hiz.pipelines[i] = RD::get_singleton()->compute_pipeline_create(hiz.shader.version_get_shader(hiz.shader_version, i));
+	}
+}
+
+HiZ::~HiZ() {
+	hiz.shader.version_free(hiz.shader_version);
+}
+
+HiZ::Result HiZ::build(Ref<RenderSceneBuffersRD> p_render_buffers, RID p_source_depth) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL_V(uniform_set_cache, Result());
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL_V(material_storage, Result());
+	ERR_FAIL_COND_V(p_render_buffers.is_null(), Result());
+
+	Size2i internal_size = p_render_buffers->get_internal_size();
+	Size2i size(MAX(internal_size.x >> 1, 1), MAX(internal_size.y >> 1, 1));
+
+	uint32_t mip_count = 1;
+	for (Size2i mip_size = size; mip_size.x > 1 || mip_size.y > 1; mip_count++) {
+		mip_size.x = MAX(mip_size.x >> 1, 1);
+		mip_size.y = MAX(mip_size.y >> 1, 1);
+	}
+
+	// Make sure our buffers exist, buffers are automatically cleared if view count or size changes.
+	if (!p_render_buffers->has_texture(RB_SCOPE_HIZ, RB_HIZ_DEPTH)) {
+		p_render_buffers->create_texture(RB_SCOPE_HIZ, RB_HIZ_DEPTH, RD::DATA_FORMAT_R32_SFLOAT, RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT, RD::TEXTURE_SAMPLES_1, size, 1, mip_count);
+	}
+
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+
+	Size2i source_size = internal_size;
+	for (uint32_t i = 0; i < mip_count; i++) {
+		HiZMode mode = i == 0 ? HIZ_MODE_FROM_DEPTH : HIZ_MODE_DOWNSAMPLE;
+		RID shader = hiz.shader.version_get_shader(hiz.shader_version, mode);
+		ERR_FAIL_COND_V(shader.is_null(), Result());
+
+		Size2i dest_size = p_render_buffers->get_texture_slice_size(RB_SCOPE_HIZ, RB_HIZ_DEPTH, i);
+
+		RD::Uniform u_source;
+		if (i == 0) {
+			u_source = RD::Uniform(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, p_source_depth }));
+		} else {
+			u_source = RD::Uniform(RD::UNIFORM_TYPE_IMAGE, 0, p_render_buffers->get_texture_slice(RB_SCOPE_HIZ, RB_HIZ_DEPTH, 0, i - 1));
+		}
+		RD::Uniform u_dest(RD::UNIFORM_TYPE_IMAGE, 0, p_render_buffers->get_texture_slice(RB_SCOPE_HIZ, RB_HIZ_DEPTH, 0, i));
+
+		hiz.push_constant.source_size[0] = source_size.x;
+		hiz.push_constant.source_size[1] = source_size.y;
+		hiz.push_constant.dest_size[0] = dest_size.x;
+		hiz.push_constant.dest_size[1] = dest_size.y;
+
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, hiz.pipelines[mode]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source), 0);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 1, u_dest), 1);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &hiz.push_constant, sizeof(HiZPushConstant));
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, dest_size.x, dest_size.y, 1);
+		RD::get_singleton()->compute_list_add_barrier(compute_list);
+
+		source_size = dest_size;
+	}
+
+	RD::get_singleton()->compute_list_end();
+
+	Result result;
+	result.texture = p_render_buffers->get_texture(RB_SCOPE_HIZ, RB_HIZ_DEPTH);
+	result.size = size;
+	result.mip_count = mip_count;
+	return result;
+}
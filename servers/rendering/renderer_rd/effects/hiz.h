@@ -0,0 +1,84 @@
+/**************************************************************************/
+/*  hiz.h                                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HIZ_RD_H
+#define HIZ_RD_H
+
+#include "servers/rendering/renderer_rd/shaders/effects/hiz.glsl.gen.h"
+#include "servers/rendering/renderer_rd/storage_rd/render_scene_buffers_rd.h"
+#include "servers/rendering/renderer_scene_render.h"
+
+#include "servers/rendering_server.h"
+
+#define RB_SCOPE_HIZ SNAME("rb_hiz")
+
+#define RB_HIZ_DEPTH SNAME("hiz_depth")
+
+namespace RendererRD {
+
+// Builds a hierarchical Z-buffer (a max depth pyramid) from a resolved depth buffer,
+// used by compute culling passes to reject bounds hidden behind already rendered geometry.
+class HiZ {
+private:
+	struct HiZPushConstant {
+		int32_t source_size[2];
+		int32_t dest_size[2];
+	};
+
+	enum HiZMode {
+		HIZ_MODE_FROM_DEPTH,
+		HIZ_MODE_DOWNSAMPLE,
+		HIZ_MODE_MAX
+	};
+
+	struct HiZShader {
+		HiZPushConstant push_constant;
+		HiZShaderRD shader;
+		RID shader_version;
+		RID pipelines[HIZ_MODE_MAX];
+	} hiz;
+
+public:
+	struct Result {
+		RID texture;
+		Size2i size;
+		uint32_t mip_count = 0;
+	};
+
+	HiZ();
+	~HiZ();
+
+	// Returns the pyramid, its first level is half the internal size of the render buffers.
+	Result build(Ref<RenderSceneBuffersRD> p_render_buffers, RID p_source_depth);
+};
+
+} // namespace RendererRD
+
+#endif // HIZ_RD_H
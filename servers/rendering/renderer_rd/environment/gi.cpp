@@ -414,6 +414,10 @@ void GI::SDFGI::create(RID p_env, const Vector3 &p_world_position, uint32_t p_re
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
 	gi = p_gi;
+
+	static uint32_t timestamp_id = 0;
+	timestamp_prefix = vformat("sdfgi_%d_", timestamp_id++);
+
 	num_cascades = RendererSceneRenderRD::get_singleton()->environment_get_sdfgi_cascades(p_env);
 	min_cell_size = RendererSceneRenderRD::get_singleton()->environment_get_sdfgi_min_cell_size(p_env);
 	uses_occlusion = RendererSceneRenderRD::get_singleton()->environment_get_sdfgi_use_occlusion(p_env);
@@ -1189,8 +1193,18 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
-	for (SDFGI::Cascade &cascade : cascades) {
+	const bool use_budget = gi->sdfgi_update_budget_msec > 0.0;
+	if (use_budget) {
+		_read_update_timestamps();
+	}
+
+	Vector3i previous_positions[SDFGI::MAX_CASCADES];
+	uint32_t dirty_cells[SDFGI::MAX_CASCADES] = {};
+
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		SDFGI::Cascade &cascade = cascades[i];
 		cascade.dirty_regions = Vector3i();
+		previous_positions[i] = cascade.position;
 
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
@@ -1232,13 +1246,111 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 			if (dirty_volume > (safe_volume / 2)) {
 				//more than half the volume is dirty, make all dirty so its only rendered once
 				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+			} else {
+				dirty_cells[i] = dirty_volume;
+			}
+		}
+
+		if (cascade.dirty_regions == SDFGI::Cascade::DIRTY_ALL) {
+			dirty_cells[i] = cascade_size * cascade_size * cascade_size;
+		}
+	}
+
+	update_cells = 0;
+	if (!use_budget || update_msec_per_mcell <= 0.0) {
+		// Unlimited, or nothing measured yet to estimate the cost with.
+		for (uint32_t i = 0; i < cascades.size(); i++) {
+			update_cells += dirty_cells[i];
+			cascades[i].deferred_frames = 0;
+		}
+		return;
+	}
+
+	// The nearest cascade always scrolls, the others go by how long they have been waiting.
+	// Cascades that don't fit in the budget keep their position and try again next frame.
+	uint32_t order[SDFGI::MAX_CASCADES];
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		order[i] = i;
+	}
+	for (uint32_t i = 1; i < cascades.size(); i++) {
+		for (uint32_t j = i + 1; j < cascades.size(); j++) {
+			if (cascades[order[j]].deferred_frames > cascades[order[i]].deferred_frames) {
+				SWAP(order[i], order[j]);
+			}
+		}
+	}
+
+	double budget = gi->sdfgi_update_budget_msec - light_update_msec;
+	double spent = 0.0;
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		SDFGI::Cascade &cascade = cascades[order[i]];
+		if (dirty_cells[order[i]] == 0) {
+			cascade.deferred_frames = 0;
+			continue;
+		}
+
+		double cost = dirty_cells[order[i]] * update_msec_per_mcell / 1000000.0;
+		if (order[i] != 0 && spent + cost > budget) {
+			cascade.position = previous_positions[order[i]];
+			cascade.dirty_regions = Vector3i();
+			cascade.deferred_frames++;
+			continue;
+		}
+
+		spent += cost;
+		update_cells += dirty_cells[order[i]];
+		cascade.deferred_frames = 0;
+	}
+}
+
+void GI::SDFGI::capture_timestamp(const String &p_event) {
+	if (gi->sdfgi_update_budget_msec > 0.0) {
+		RSG::utilities->capture_timestamp(timestamp_prefix + p_event);
+	}
+}
+
+void GI::SDFGI::_read_update_timestamps() {
+	uint64_t sdf_begin = 0;
+	uint64_t light_begin = 0;
+	for (uint32_t i = 0; i < RSG::utilities->get_captured_timestamps_count(); i++) {
+		String name = RSG::utilities->get_captured_timestamp_name(i);
+		if (!name.begins_with(timestamp_prefix)) {
+			continue;
+		}
+
+		String event = name.substr(timestamp_prefix.length());
+		uint64_t time = RSG::utilities->get_captured_timestamp_gpu_time(i);
+		if (event == "sdf_begin") {
+			sdf_begin = time;
+		} else if (event.begins_with("sdf_end_") && sdf_begin != 0 && time > sdf_begin) {
+			// The voxelized cell count of that frame is part of the name, as results arrive frames later.
+			int64_t cells = event.get_slicec('_', 2).to_int();
+			if (cells > 0) {
+				double sample = double(time - sdf_begin) / 1000000.0 / (double(cells) / 1000000.0);
+				update_msec_per_mcell = update_msec_per_mcell > 0.0 ? Math::lerp(update_msec_per_mcell, sample, 0.2) : sample;
 			}
+		} else if (event == "light_begin") {
+			light_begin = time;
+		} else if (event == "light_end" && light_begin != 0 && time > light_begin) {
+			double sample = double(time - light_begin) / 1000000.0;
+			light_update_msec = Math::lerp(light_update_msec, sample, 0.2);
 		}
 	}
+
+	// Spread dynamic light injection over more frames when it alone eats most of the budget.
+	uint32_t max_shift = RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1;
+	if (light_update_msec > gi->sdfgi_update_budget_msec * 0.5 && light_update_shift < max_shift) {
+		light_update_shift++;
+		light_update_msec *= 0.5; // Expected cost at the new rate, until measured again.
+	} else if (light_update_msec < gi->sdfgi_update_budget_msec * 0.125 && light_update_shift > 0) {
+		light_update_shift--;
+		light_update_msec *= 2.0;
+	}
 }
 
 void GI::SDFGI::update_light() {
 	RD::get_singleton()->draw_command_begin_label("SDFGI Update dynamic Light");
+	capture_timestamp("light_begin");
 
 	for (uint32_t i = 0; i < cascades.size(); i++) {
 		RD::get_singleton()->buffer_copy(cascades[i].solid_cell_dispatch_buffer_storage, cascades[i].solid_cell_dispatch_buffer_call, 0, 0, sizeof(uint32_t) * 4);
@@ -1265,7 +1377,8 @@ void GI::SDFGI::update_light() {
 		push_constant.light_count = cascade_dynamic_light_count[i];
 		push_constant.cascade = i;
 
-		if (cascades[i].all_dynamic_lights_dirty || gi->sdfgi_frames_to_update_light == RS::ENV_SDFGI_UPDATE_LIGHT_IN_1_FRAME) {
+		uint32_t frames_to_update_light = MIN(uint32_t(gi->sdfgi_frames_to_update_light) + light_update_shift, uint32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1));
+		if (cascades[i].all_dynamic_lights_dirty || frames_to_update_light == RS::ENV_SDFGI_UPDATE_LIGHT_IN_1_FRAME) {
 			push_constant.process_offset = 0;
 			push_constant.process_increment = 1;
 		} else {
@@ -1273,7 +1386,7 @@ void GI::SDFGI::update_light() {
 				1, 2, 4, 8, 16
 			};
 
-			uint32_t frames_to_update = frames_to_update_table[gi->sdfgi_frames_to_update_light];
+			uint32_t frames_to_update = frames_to_update_table[frames_to_update_light];
 
 			push_constant.process_offset = RSG::rasterizer->get_frame_number() % frames_to_update;
 			push_constant.process_increment = frames_to_update;
@@ -1285,6 +1398,7 @@ void GI::SDFGI::update_light() {
 		RD::get_singleton()->compute_list_dispatch_indirect(compute_list, cascade.solid_cell_dispatch_buffer_call, 0);
 	}
 	RD::get_singleton()->compute_list_end();
+	capture_timestamp("light_end");
 	RD::get_singleton()->draw_command_end_label();
 }
 
@@ -3350,6 +3464,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_update_budget_msec = MAX(float(GLOBAL_GET("rendering/global_illumination/sdfgi/update_budget_ms")), 0.0f);
 }
 
 GI::~GI() {
@@ -609,6 +609,7 @@ public:
 			float baked_exposure_normalization = 1.0;
 
 			bool all_dynamic_lights_dirty = true;
+			uint32_t deferred_frames = 0; // Frames this cascade waited to scroll because of the update budget.
 		};
 
 		// access to our containers
@@ -675,6 +676,15 @@ public:
 		int32_t cascade_dynamic_light_count[SDFGI::MAX_CASCADES]; //used dynamically
 		RID integrate_sky_uniform_set;
 
+		// Update budget, measured with GPU timestamps.
+		String timestamp_prefix;
+		uint32_t update_cells = 0; // Cells voxelized this frame.
+		double update_msec_per_mcell = 0.0; // Cost of voxelizing a million cells, 0 until measured.
+		double light_update_msec = 0.0;
+		uint32_t light_update_shift = 0; // Extra halvings of the dynamic light update rate when over budget.
+
+		void _read_update_timestamps();
+
 		virtual void configure(RenderSceneBuffersRD *p_render_buffers) override{};
 		virtual void free_data() override;
 		~SDFGI();
@@ -686,6 +696,7 @@ public:
 		void store_probes();
 		int get_pending_region_data(int p_region, Vector3i &r_local_offset, Vector3i &r_local_size, AABB &r_bounds) const;
 		void update_cascades();
+		void capture_timestamp(const String &p_event);
 
 		void debug_draw(uint32_t p_view_count, const Projection *p_projections, const Transform3D &p_transform, int p_width, int p_height, RID p_render_target, RID p_texture, const Vector<RID> &p_texture_views);
 		void debug_probes(RID p_framebuffer, const uint32_t p_view_count, const Projection *p_camera_with_transforms);
@@ -698,6 +709,7 @@ public:
 	RS::EnvironmentSDFGIRayCount sdfgi_ray_count = RS::ENV_SDFGI_RAY_COUNT_16;
 	RS::EnvironmentSDFGIFramesToConverge sdfgi_frames_to_converge = RS::ENV_SDFGI_CONVERGE_IN_30_FRAMES;
 	RS::EnvironmentSDFGIFramesToUpdateLight sdfgi_frames_to_update_light = RS::ENV_SDFGI_UPDATE_LIGHT_IN_4_FRAMES;
+	float sdfgi_update_budget_msec = 0.0; // 0 means unlimited.
 
 	float sdfgi_solid_cell_ratio = 0.25;
 	Vector3 sdfgi_debug_probe_pos;
@@ -372,6 +372,15 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 		RS::PrimitiveType primitive = surf->primitive;
 		RID xforms_uniform_set = surf->owner->transforms_uniform_set;
 
+		// Multimeshes culled on the GPU draw their compacted instances, unless a shadow mesh replaces the surface.
+		bool gpu_culled = p_params->gpu_culling != GPU_CULLING_DISABLED && surf->owner->gpu_culled && mesh_surface == surf->surface;
+		if ((p_params->gpu_culling == GPU_CULLING_SKIP_CULLED && gpu_culled) || (p_params->gpu_culling == GPU_CULLING_ONLY_CULLED && !gpu_culled)) {
+			continue;
+		}
+		if (gpu_culled) {
+			xforms_uniform_set = mesh_storage->multimesh_get_culled_3d_uniform_set(surf->owner->data->base, scene_shader.default_shader_rd, TRANSFORMS_UNIFORM_SET);
+		}
+
 		SceneShaderForwardClustered::PipelineVersion pipeline_version = SceneShaderForwardClustered::PIPELINE_VERSION_MAX; // Assigned to silence wrong -Wmaybe-initialized.
 		uint32_t pipeline_color_pass_flags = 0;
 		uint32_t pipeline_specialization = p_params->spec_constant_base_flags;
@@ -477,6 +486,8 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 		}
 
 		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, pipeline_specialization);
+		// Only read when the ubershader is used while the specialized pipeline compiles.
+		push_constant.ubershader_flags = pipeline_specialization & SceneShaderForwardClustered::SHADER_SPECIALIZATION_UBERSHADER_DYNAMIC_MASK;
 
 		if (pipeline_rd != prev_pipeline_rd) {
 			// checking with prev shader does not make so much sense, as
@@ -515,7 +526,13 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			instance_count /= surf->owner->trail_steps;
 		}
 
-		RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		if (gpu_culled) {
+			RID args_buffer = mesh_storage->multimesh_get_culled_args_buffer(surf->owner->data->base);
+			uint32_t args_offset = mesh_storage->multimesh_get_culled_args_offset(surf->owner->data->base, surf->surface_index, mesh_surface, element_info.lod_index);
+			RD::get_singleton()->draw_list_draw_indirect(draw_list, index_array_rd.is_valid(), args_buffer, args_offset);
+		} else {
+			RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		}
 		i += element_info.repeat - 1; //skip equal elements
 	}
 
@@ -681,6 +698,51 @@ void RenderForwardClustered::_update_instance_data_buffer(RenderListType p_rende
 		RD::get_singleton()->buffer_update(scene_state.instance_buffer[p_render_list], 0, sizeof(SceneState::InstanceData) * scene_state.instance_data[p_render_list].size(), scene_state.instance_data[p_render_list].ptr());
 	}
 }
+bool RenderForwardClustered::_setup_gpu_culled_multimeshes(const RenderDataRD *p_render_data) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+
+	// Multiview would need the union of all the view frustums, those are drawn entirely.
+	bool can_cull = p_render_data->scene_data->view_count == 1;
+
+	bool any_culled = false;
+	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
+		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_render_data->instances)[i]);
+		inst->gpu_culled = false;
+		if (!can_cull || !(inst->base_flags & INSTANCE_DATA_FLAG_MULTIMESH) || (inst->base_flags & INSTANCE_DATA_FLAG_PARTICLES) || inst->instance_count == 0) {
+			continue;
+		}
+
+		inst->gpu_culled = mesh_storage->multimesh_can_gpu_cull(inst->data->base);
+		any_culled = any_culled || inst->gpu_culled;
+	}
+
+	return any_culled;
+}
+
+void RenderForwardClustered::_gpu_cull_multimeshes(const RenderDataRD *p_render_data, const RendererRD::HiZ::Result &p_hiz) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+
+	// Same depth correction as the camera uses for rendering to the render buffers.
+	Projection correction;
+	correction.set_depth_correction(true);
+	Projection view_projection = correction * p_render_data->scene_data->cam_projection * Projection(p_render_data->scene_data->cam_transform.affine_inverse());
+
+	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
+		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_render_data->instances)[i]);
+		if (!inst->gpu_culled) {
+			continue;
+		}
+
+		// Multimesh transforms are relative to the instance, so cull in its space.
+		Projection clip_transform = view_projection * Projection(inst->transform);
+		Vector3 camera_position = inst->transform.affine_inverse().xform(p_render_data->scene_data->cam_transform.origin);
+		// The cull distance is in world units, the smallest scale axis keeps it conservative for non-uniform scales.
+		Vector3 scale = inst->transform.basis.get_scale_abs();
+		float distance_scale = 1.0 / MAX(MIN(MIN(scale.x, scale.y), scale.z), CMP_EPSILON);
+		inst->gpu_culled = mesh_storage->multimesh_gpu_cull(inst->data->base, clip_transform, camera_position, distance_scale, p_hiz.texture, p_hiz.size, p_hiz.mip_count);
+	}
+}
+
 void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
 	RenderList *rl = &render_list[p_render_list];
 	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
@@ -800,62 +862,31 @@ _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primit
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
-void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_using_motion_pass, bool p_append) {
+void RenderForwardClustered::_fill_render_list_instances(const RenderDataRD *p_render_data, const Plane &p_near_plane, float p_z_max, uint32_t p_from, uint32_t p_to, uint64_t &r_primitives) {
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
-	uint64_t frame = RSG::rasterizer->get_frame_number();
 
-	if (p_render_list == RENDER_LIST_OPAQUE) {
-		scene_state.used_sss = false;
-		scene_state.used_screen_texture = false;
-		scene_state.used_normal_texture = false;
-		scene_state.used_depth_texture = false;
-		scene_state.used_lightmap = false;
-	}
-	uint32_t lightmap_captures_used = 0;
-
-	Plane near_plane = Plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
-	near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
-	float z_max = p_render_data->scene_data->cam_projection.get_z_far() - p_render_data->scene_data->cam_projection.get_z_near();
-
-	RenderList *rl = &render_list[p_render_list];
-	_update_dirty_geometry_instances();
-
-	if (!p_append) {
-		rl->clear();
-		if (p_render_list == RENDER_LIST_OPAQUE) {
-			// Opaque fills motion and alpha lists.
-			render_list[RENDER_LIST_MOTION].clear();
-			render_list[RENDER_LIST_ALPHA].clear();
-		}
-	}
-
-	//fill list
-
-	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_render_data->instances)[i]);
 
 		Vector3 center = inst->transform.origin;
 		if (p_render_data->scene_data->cam_orthogonal) {
 			if (inst->use_aabb_center) {
-				center = inst->transformed_aabb.get_support(-near_plane.normal);
+				center = inst->transformed_aabb.get_support(-p_near_plane.normal);
 			}
-			inst->depth = near_plane.distance_to(center) - inst->sorting_offset;
+			inst->depth = p_near_plane.distance_to(center) - inst->sorting_offset;
 		} else {
 			if (inst->use_aabb_center) {
 				center = inst->transformed_aabb.position + (inst->transformed_aabb.size * 0.5);
 			}
 			inst->depth = p_render_data->scene_data->cam_transform.origin.distance_to(center) - inst->sorting_offset;
 		}
-		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / z_max), 0, 15);
+		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / p_z_max), 0, 15);
 
 		uint32_t flags = inst->base_flags; //fill flags if appropriate
 
 		if (inst->non_uniform_scale) {
 			flags |= INSTANCE_DATA_FLAGS_NON_UNIFORM_SCALE;
 		}
-		bool uses_lightmap = false;
-		bool uses_gi = false;
-		bool uses_motion = false;
 		float fade_alpha = 1.0;
 
 		if (inst->fade_near || inst->fade_far) {
@@ -871,6 +902,141 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		fade_alpha *= inst->force_alpha * inst->parent_fade_alpha;
 
 		flags = (flags & ~INSTANCE_DATA_FLAGS_FADE_MASK) | (uint32_t(fade_alpha * 255.0) << INSTANCE_DATA_FLAGS_FADE_SHIFT);
+		inst->flags_cache = flags;
+		inst->fade_alpha_cache = fade_alpha;
+
+		GeometryInstanceSurfaceDataCache *surf = inst->surface_caches;
+
+		while (surf) {
+			surf->sort.uses_forward_gi = 0;
+			surf->sort.uses_lightmap = 0;
+
+			// LOD
+
+			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
+				float distance = 0.0;
+
+				// Check if camera is NOT inside the mesh AABB.
+				if (!inst->transformed_aabb.has_point(p_render_data->scene_data->cam_transform.origin)) {
+					// Get the LOD support points on the mesh AABB.
+					Vector3 lod_support_min = inst->transformed_aabb.get_support(p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z));
+					Vector3 lod_support_max = inst->transformed_aabb.get_support(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z));
+
+					// Get the distances to those points on the AABB from the camera origin.
+					float distance_min = (float)p_render_data->scene_data->cam_transform.origin.distance_to(lod_support_min);
+					float distance_max = (float)p_render_data->scene_data->cam_transform.origin.distance_to(lod_support_max);
+
+					if (distance_min * distance_max < 0.0) {
+						//crossing plane
+						distance = 0.0;
+					} else if (distance_min >= 0.0) {
+						distance = distance_min;
+					} else if (distance_max <= 0.0) {
+						distance = -distance_max;
+					}
+				}
+				if (p_render_data->scene_data->cam_orthogonal) {
+					distance = 1.0;
+				}
+
+				uint32_t indices = 0;
+				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
+				if (p_render_data->render_info) {
+					r_primitives += _indices_to_primitives(surf->primitive, indices);
+				}
+			} else {
+				surf->sort.lod_index = 0;
+				if (p_render_data->render_info) {
+					uint32_t to_draw = mesh_storage->mesh_surface_get_vertices_drawn_count(surf->surface);
+					to_draw = _indices_to_primitives(surf->primitive, to_draw);
+					to_draw *= inst->instance_count;
+					r_primitives += to_draw;
+				}
+			}
+
+			surf->sort.depth_layer = depth_layer;
+
+			surf = surf->next;
+		}
+	}
+}
+
+void RenderForwardClustered::_fill_render_list_instances_threaded(uint32_t p_task, FillRenderListData *p_data) {
+	uint32_t total = p_data->render_data->instances->size();
+	uint32_t from = p_task * total / p_data->task_count;
+	uint32_t to = (p_task + 1 == p_data->task_count) ? total : ((p_task + 1) * total / p_data->task_count);
+
+	_fill_render_list_instances(p_data->render_data, p_data->near_plane, p_data->z_max, from, to, p_data->task_primitives[p_task]);
+}
+
+void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_using_motion_pass, bool p_append) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+
+	if (p_render_list == RENDER_LIST_OPAQUE) {
+		scene_state.used_sss = false;
+		scene_state.used_screen_texture = false;
+		scene_state.used_normal_texture = false;
+		scene_state.used_depth_texture = false;
+		scene_state.used_lightmap = false;
+	}
+	uint32_t lightmap_captures_used = 0;
+
+	RenderList *rl = &render_list[p_render_list];
+	_update_dirty_geometry_instances();
+
+	if (!p_append) {
+		rl->clear();
+		if (p_render_list == RENDER_LIST_OPAQUE) {
+			// Opaque fills motion and alpha lists.
+			render_list[RENDER_LIST_MOTION].clear();
+			render_list[RENDER_LIST_ALPHA].clear();
+		}
+	}
+
+	// Sorting depth, fade and LOD only depend on the instance itself, so large lists compute them on worker threads.
+	FillRenderListData fill_data;
+	fill_data.render_data = p_render_data;
+	fill_data.near_plane = Plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
+	fill_data.near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
+	fill_data.z_max = p_render_data->scene_data->cam_projection.get_z_far() - p_render_data->scene_data->cam_projection.get_z_near();
+
+	uint64_t primitives = 0;
+	if (p_render_data->instances->size() > render_list_thread_threshold) {
+		fill_data.task_count = WorkerThreadPool::get_singleton()->get_thread_count();
+		fill_data.task_primitives.resize(fill_data.task_count);
+		for (uint64_t &task_primitives : fill_data.task_primitives) {
+			task_primitives = 0;
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_fill_render_list_instances_threaded, &fill_data, fill_data.task_count, -1, true, SNAME("FillRenderList"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint64_t task_primitives : fill_data.task_primitives) {
+			primitives += task_primitives;
+		}
+	} else {
+		_fill_render_list_instances(p_render_data, fill_data.near_plane, fill_data.z_max, 0, p_render_data->instances->size(), primitives);
+	}
+
+	if (p_render_data->render_info) {
+		if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
+			p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += primitives;
+		} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
+			p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += primitives;
+		}
+	}
+
+	//fill list
+
+	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
+		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_render_data->instances)[i]);
+
+		uint32_t flags = inst->flags_cache;
+		bool uses_lightmap = false;
+		bool uses_gi = false;
+		bool uses_motion = false;
+		float fade_alpha = inst->fade_alpha_cache;
 
 		if (p_render_list == RENDER_LIST_OPAQUE) {
 			// Setup GI
@@ -961,61 +1127,6 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		GeometryInstanceSurfaceDataCache *surf = inst->surface_caches;
 
 		while (surf) {
-			surf->sort.uses_forward_gi = 0;
-			surf->sort.uses_lightmap = 0;
-
-			// LOD
-
-			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
-				float distance = 0.0;
-
-				// Check if camera is NOT inside the mesh AABB.
-				if (!inst->transformed_aabb.has_point(p_render_data->scene_data->cam_transform.origin)) {
-					// Get the LOD support points on the mesh AABB.
-					Vector3 lod_support_min = inst->transformed_aabb.get_support(p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z));
-					Vector3 lod_support_max = inst->transformed_aabb.get_support(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z));
-
-					// Get the distances to those points on the AABB from the camera origin.
-					float distance_min = (float)p_render_data->scene_data->cam_transform.origin.distance_to(lod_support_min);
-					float distance_max = (float)p_render_data->scene_data->cam_transform.origin.distance_to(lod_support_max);
-
-					if (distance_min * distance_max < 0.0) {
-						//crossing plane
-						distance = 0.0;
-					} else if (distance_min >= 0.0) {
-						distance = distance_min;
-					} else if (distance_max <= 0.0) {
-						distance = -distance_max;
-					}
-				}
-				if (p_render_data->scene_data->cam_orthogonal) {
-					distance = 1.0;
-				}
-
-				uint32_t indices = 0;
-				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
-				if (p_render_data->render_info) {
-					indices = _indices_to_primitives(surf->primitive, indices);
-					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
-					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
-					}
-				}
-			} else {
-				surf->sort.lod_index = 0;
-				if (p_render_data->render_info) {
-					uint32_t to_draw = mesh_storage->mesh_surface_get_vertices_drawn_count(surf->surface);
-					to_draw = _indices_to_primitives(surf->primitive, to_draw);
-					to_draw *= inst->instance_count;
-					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
-					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
-					}
-				}
-			}
-
 			// ADD Element
 			if (p_pass_mode == PASS_MODE_COLOR) {
 #ifdef DEBUG_ENABLED
@@ -1072,8 +1183,6 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 				}
 			}
 
-			surf->sort.depth_layer = depth_layer;
-
 			surf = surf->next;
 		}
 	}
@@ -1136,12 +1245,18 @@ void RenderForwardClustered::_update_sdfgi(RenderDataRD *p_render_data) {
 		if (p_render_data->camera_attributes.is_valid()) {
 			exposure_normalization = RSG::camera_attributes->camera_attributes_get_exposure_normalization_factor(p_render_data->camera_attributes);
 		}
+		if (p_render_data->render_sdfgi_region_count > 0) {
+			sdfgi->capture_timestamp("sdf_begin");
+		}
 		for (int i = 0; i < p_render_data->render_sdfgi_region_count; i++) {
 			sdfgi->render_region(rb, p_render_data->render_sdfgi_regions[i].region, p_render_data->render_sdfgi_regions[i].instances, exposure_normalization);
 		}
 		if (p_render_data->sdfgi_update_data->update_static) {
 			sdfgi->render_static_lights(p_render_data, rb, p_render_data->sdfgi_update_data->static_cascade_count, p_render_data->sdfgi_update_data->static_cascade_indices, p_render_data->sdfgi_update_data->static_positional_lights);
 		}
+		if (p_render_data->render_sdfgi_region_count > 0) {
+			sdfgi->capture_timestamp("sdf_end_" + itos(sdfgi->update_cells));
+		}
 	}
 }
 
@@ -1384,6 +1499,7 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 	p_render_data->cube_shadows.clear();
 	p_render_data->shadows.clear();
 	p_render_data->directional_shadows.clear();
+	bool use_cached_directional_shadows = false;
 
 	Plane camera_plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
 	float lod_distance_multiplier = p_render_data->scene_data->cam_projection.get_lod_multiplier();
@@ -1409,8 +1525,22 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		if (p_render_data->directional_shadows.size()) {
 			//open the pass for directional shadows
 			light_storage->update_directional_shadow_atlas();
-			RD::get_singleton()->draw_list_begin(light_storage->direction_shadow_get_fb(), RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE);
-			RD::get_singleton()->draw_list_end();
+
+			// Cached cascades are only valid as long as the atlas they were rendered to exists.
+			use_cached_directional_shadows = light_storage->directional_shadow_get_texture() == directional_shadow_cached_atlas;
+			directional_shadow_cached_atlas = light_storage->directional_shadow_get_texture();
+			bool has_cached_directional_shadows = false;
+			if (use_cached_directional_shadows) {
+				for (const int &index : p_render_data->directional_shadows) {
+					has_cached_directional_shadows = has_cached_directional_shadows || p_render_data->render_shadows[index].cached;
+				}
+			}
+			use_cached_directional_shadows = has_cached_directional_shadows;
+
+			if (!use_cached_directional_shadows) {
+				RD::get_singleton()->draw_list_begin(light_storage->direction_shadow_get_fb(), RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE);
+				RD::get_singleton()->draw_list_end();
+			}
 		}
 	}
 
@@ -1433,7 +1563,18 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 
 		//render directional shadows
 		for (uint32_t i = 0; i < p_render_data->directional_shadows.size(); i++) {
-			_render_shadow_pass(p_render_data->render_shadows[p_render_data->directional_shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->directional_shadows[i]].pass, p_render_data->render_shadows[p_render_data->directional_shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, false, i == p_render_data->directional_shadows.size() - 1, false, p_render_data->render_info, viewport_size, p_render_data->scene_data->cam_transform);
+			const RendererSceneRender::RenderShadowData &shadow_data = p_render_data->render_shadows[p_render_data->directional_shadows[i]];
+			if (use_cached_directional_shadows && shadow_data.cached) {
+				// Keep the previous contents, but the light still claims its atlas rect so the following lights keep theirs.
+				if (light_storage->light_instance_get_shadow_pass(shadow_data.light) != get_scene_pass()) {
+					light_storage->light_instance_set_directional_rect(shadow_data.light, light_storage->get_directional_shadow_rect());
+					light_storage->directional_shadow_increase_current_light();
+					light_storage->light_instance_set_shadow_pass(shadow_data.light, get_scene_pass());
+				}
+				continue;
+			}
+			// When some cascades are kept the atlas is not cleared as a whole, so each rendered cascade clears its own rect.
+			_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, false, i == p_render_data->directional_shadows.size() - 1, use_cached_directional_shadows, p_render_data->render_info, viewport_size, p_render_data->scene_data->cam_transform);
 		}
 		//render positional shadows
 		for (uint32_t i = 0; i < p_render_data->shadows.size(); i++) {
@@ -1632,6 +1773,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	bool using_debug_mvs = get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS;
 	bool using_taa = rb->get_use_taa();
 	bool using_fsr2 = rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR2;
+	// An overridden velocity texture is provided by an XR interface to submit motion vectors for reprojection (spacewarp).
+	bool using_velocity_override = RendererRD::TextureStorage::get_singleton()->render_target_get_override_velocity(rb->get_render_target()).is_valid();
 
 	// check if we need motion vectors
 	bool motion_vectors_required;
@@ -1643,12 +1786,15 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		motion_vectors_required = true;
 	} else if (!is_reflection_probe && using_fsr2) {
 		motion_vectors_required = true;
+	} else if (!is_reflection_probe && using_velocity_override) {
+		motion_vectors_required = true;
 	} else {
 		motion_vectors_required = false;
 	}
 
 	//p_render_data->scene_data->subsurface_scatter_width = subsurface_scatter_size;
 	p_render_data->scene_data->calculate_motion_vectors = motion_vectors_required;
+	p_render_data->scene_data->motion_vectors_for_reprojection = !is_reflection_probe && using_velocity_override;
 	p_render_data->scene_data->directional_light_count = 0;
 	p_render_data->scene_data->opaque_prepass_threshold = 0.99f;
 
@@ -1739,6 +1885,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	_fill_instance_data(RENDER_LIST_MOTION, render_info);
 	_fill_instance_data(RENDER_LIST_ALPHA);
 
+	bool using_gpu_culling = _setup_gpu_culled_multimeshes(p_render_data);
+
 	RD::get_singleton()->draw_command_end_label();
 
 	if (!is_reflection_probe) {
@@ -1912,6 +2060,14 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 	bool using_ssao = depth_pre_pass && !is_reflection_probe && p_render_data->environment.is_valid() && environment_get_ssao_enabled(p_render_data->environment);
 
+	// Multimeshes culled on the GPU are tested against a depth pyramid of the rest of the depth pre-pass, this needs the resolved depth of a single view.
+	bool using_hiz_culling = using_gpu_culling && depth_pre_pass && !use_msaa && !is_reflection_probe && RendererRD::MeshStorage::get_singleton()->multimesh_gpu_culling_uses_occlusion();
+	if (using_gpu_culling && !using_hiz_culling) {
+		RD::get_singleton()->draw_command_begin_label("Cull Multimeshes");
+		_gpu_cull_multimeshes(p_render_data);
+		RD::get_singleton()->draw_command_end_label();
+	}
+
 	if (depth_pre_pass) { //depth pre pass
 		bool needs_pre_resolve = _needs_post_prepass_render(p_render_data, using_sdfgi || using_voxelgi);
 		if (needs_pre_resolve) {
@@ -1933,10 +2089,25 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 		bool finish_depth = using_ssao || using_ssil || using_sdfgi || using_voxelgi || ce_pre_opaque_resolved_depth || ce_post_opaque_resolved_depth;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, depth_pass_mode, 0, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count, 0, spec_constant_base_flags);
+		render_list_params.gpu_culling = using_hiz_culling ? GPU_CULLING_SKIP_CULLED : GPU_CULLING_INDIRECT;
 		_render_list_with_draw_list(&render_list_params, depth_framebuffer, needs_pre_resolve ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, needs_pre_resolve ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, needs_pre_resolve ? Vector<Color>() : depth_pass_clear);
 
 		RD::get_singleton()->draw_command_end_label();
 
+		if (using_hiz_culling) {
+			// The depth of the occluders is complete, cull against it and add what remains visible to the pre-pass.
+			RENDER_TIMESTAMP("Cull Multimeshes (HiZ)");
+			RD::get_singleton()->draw_command_begin_label("Cull Multimeshes (HiZ)");
+
+			RendererRD::HiZ::Result hiz = hiz_effects->build(rb, rb->get_depth_texture(0));
+			_gpu_cull_multimeshes(p_render_data, hiz);
+
+			render_list_params.gpu_culling = GPU_CULLING_ONLY_CULLED;
+			_render_list_with_draw_list(&render_list_params, depth_framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE);
+
+			RD::get_singleton()->draw_command_end_label();
+		}
+
 		if (use_msaa) {
 			RENDER_TIMESTAMP("Resolve Depth Pre-Pass (MSAA)");
 			RD::get_singleton()->draw_command_begin_label("Resolve Depth Pre-Pass (MSAA)");
@@ -2011,6 +2182,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			uint32_t opaque_color_pass_flags = using_motion_pass ? (color_pass_flags & ~COLOR_PASS_FLAG_MOTION_VECTORS) : color_pass_flags;
 			RID opaque_framebuffer = using_motion_pass ? rb_data->get_color_pass_fb(opaque_color_pass_flags) : color_framebuffer;
 			RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, PASS_MODE_COLOR, opaque_color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count, 0, spec_constant_base_flags);
+			render_list_params.gpu_culling = GPU_CULLING_INDIRECT;
 			_render_list_with_draw_list(&render_list_params, opaque_framebuffer, load_color ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, depth_pre_pass ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, c, 1.0, 0);
 		}
 
@@ -2217,7 +2389,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	RD::get_singleton()->draw_command_begin_label("Resolve");
 
 	if (rb_data.is_valid() && use_msaa) {
-		bool resolve_velocity_buffer = (using_taa || using_fsr2 || ce_needs_motion_vectors) && rb->has_velocity_buffer(true);
+		bool resolve_velocity_buffer = (using_taa || using_fsr2 || ce_needs_motion_vectors || using_velocity_override) && rb->has_velocity_buffer(true);
 		for (uint32_t v = 0; v < rb->get_view_count(); v++) {
 			RD::get_singleton()->texture_resolve_multisample(rb->get_color_msaa(v), rb->get_internal_texture(v));
 			resolve_effects->resolve_depth(rb->get_depth_msaa(v), rb->get_depth_texture(v), rb->get_internal_size(), texture_multisamples[msaa]);
@@ -4266,6 +4438,9 @@ RenderForwardClustered::RenderForwardClustered() {
 		shadow_sampler = RD::get_singleton()->sampler_create(sampler);
 	}
 
+	render_list_thread_threshold = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_minimum_instances");
+	render_list_thread_threshold = MAX(render_list_thread_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); // Make sure there is at least one instance per thread.
+
 	{
 		Vector<String> modes;
 		modes.push_back("\n");
@@ -4307,6 +4482,7 @@ RenderForwardClustered::RenderForwardClustered() {
 	_update_shader_quality_settings();
 
 	resolve_effects = memnew(RendererRD::Resolve());
+	hiz_effects = memnew(RendererRD::HiZ());
 	taa = memnew(RendererRD::TAA);
 	fsr2_effect = memnew(RendererRD::FSR2Effect);
 	ss_effects = memnew(RendererRD::SSEffects);
@@ -4333,6 +4509,11 @@ RenderForwardClustered::~RenderForwardClustered() {
 		resolve_effects = nullptr;
 	}
 
+	if (hiz_effects != nullptr) {
+		memdelete(hiz_effects);
+		hiz_effects = nullptr;
+	}
+
 	RD::get_singleton()->free(shadow_sampler);
 	RSG::light_storage->directional_shadow_atlas_set_size(0);
 	RD::get_singleton()->free(best_fit_normal.texture);
@@ -34,6 +34,7 @@
 #include "core/templates/paged_allocator.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
 #include "servers/rendering/renderer_rd/effects/fsr2.h"
+#include "servers/rendering/renderer_rd/effects/hiz.h"
 #include "servers/rendering/renderer_rd/effects/resolve.h"
 #include "servers/rendering/renderer_rd/effects/ss_effects.h"
 #include "servers/rendering/renderer_rd/effects/taa.h"
@@ -191,6 +192,14 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		COLOR_PASS_FLAG_MOTION_VECTORS = 1 << 3,
 	};
 
+	// How a render list draws the multimeshes culled by _gpu_cull_multimeshes().
+	enum GPUCullingMode {
+		GPU_CULLING_DISABLED, // Draw every instance.
+		GPU_CULLING_INDIRECT, // Draw the culled multimeshes with their indirect arguments.
+		GPU_CULLING_SKIP_CULLED, // Only draw what is not culled on the GPU, used to render the occluders.
+		GPU_CULLING_ONLY_CULLED, // Only draw the culled multimeshes, with their indirect arguments.
+	};
+
 	struct GeometryInstanceSurfaceDataCache;
 	struct RenderElementInfo;
 
@@ -212,6 +221,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		uint32_t element_offset = 0;
 		bool use_directional_soft_shadow = false;
 		uint32_t spec_constant_base_flags = 0;
+		GPUCullingMode gpu_culling = GPU_CULLING_DISABLED;
 
 		RenderListParameters(GeometryInstanceSurfaceDataCache **p_elements, RenderElementInfo *p_element_info, int p_element_count, bool p_reverse_cull, PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_no_gi, bool p_use_directional_soft_shadows, RID p_render_pass_uniform_set, bool p_force_wireframe = false, const Vector2 &p_uv_offset = Vector2(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, uint32_t p_view_count = 1, uint32_t p_element_offset = 0, uint32_t p_spec_constant_base_flags = 0) {
 			elements = p_elements;
@@ -296,6 +306,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			uint32_t uv_offset; //packed
 			uint32_t multimesh_motion_vectors_current_offset;
 			uint32_t multimesh_motion_vectors_previous_offset;
+			uint32_t ubershader_flags;
 		};
 
 		struct InstanceData {
@@ -383,6 +394,20 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
 	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+	bool _setup_gpu_culled_multimeshes(const RenderDataRD *p_render_data);
+	void _gpu_cull_multimeshes(const RenderDataRD *p_render_data, const RendererRD::HiZ::Result &p_hiz = RendererRD::HiZ::Result());
+	struct FillRenderListData {
+		const RenderDataRD *render_data = nullptr;
+		Plane near_plane;
+		float z_max = 0.0;
+		uint32_t task_count = 0;
+		LocalVector<uint64_t> task_primitives;
+	};
+
+	uint32_t render_list_thread_threshold = 0;
+
+	void _fill_render_list_instances(const RenderDataRD *p_render_data, const Plane &p_near_plane, float p_z_max, uint32_t p_from, uint32_t p_to, uint64_t &r_primitives);
+	void _fill_render_list_instances_threaded(uint32_t p_task, FillRenderListData *p_data);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi = false, bool p_using_opaque_gi = false, bool p_using_motion_pass = false, bool p_append = false);
 
 	HashMap<Size2i, RID> sdfgi_framebuffer_size_cache;
@@ -462,6 +487,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		//used during rendering
 
 		uint32_t gi_offset_cache = 0;
+		float fade_alpha_cache = 1.0;
 		bool store_transform_cache = true;
 		RID transforms_uniform_set;
 		uint32_t instance_count = 0;
@@ -469,6 +495,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		bool can_sdfgi = false;
 		bool using_projectors = false;
 		bool using_softshadows = false;
+		bool gpu_culled = false;
 
 		//used during setup
 		uint64_t prev_transform_change_frame = 0xFFFFFFFF;
@@ -575,6 +602,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	/* Effects */
 
 	RendererRD::Resolve *resolve_effects = nullptr;
+	RendererRD::HiZ *hiz_effects = nullptr;
 	RendererRD::TAA *taa = nullptr;
 	RendererRD::FSR2Effect *fsr2_effect = nullptr;
 	RendererRD::SSEffects *ss_effects = nullptr;
@@ -594,6 +622,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	/* Render shadows */
 
+	RID directional_shadow_cached_atlas; // Atlas the cached directional cascades were rendered to.
+
 	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
 	void _render_shadow_begin();
 	void _render_shadow_append(RID p_framebuffer, const PagedArray<RenderGeometryInstance *> &p_instances, const Projection &p_projection, const Transform3D &p_transform, float p_zfar, float p_bias, float p_normal_bias, bool p_reverse_cull_face, bool p_use_dp, bool p_use_dp_flip, bool p_use_pancake, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, const Rect2i &p_rect = Rect2i(), bool p_flip_y = false, bool p_clear_region = true, bool p_begin = true, bool p_end = true, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
@@ -265,6 +265,9 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	}
 	bool depth_pre_pass_enabled = bool(GLOBAL_GET("rendering/driver/depth_prepass/enable"));
 
+	// Stable across runs, so pipelines recorded in a manifest can be found again when precompiling.
+	String manifest_key_base = String::num_uint64(code.hash64(), 16);
+
 	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
 		RD::PolygonCullMode cull_mode_rd_table[CULL_VARIANT_MAX][3] = {
 			{ RD::POLYGON_CULL_DISABLED, RD::POLYGON_CULL_FRONT, RD::POLYGON_CULL_BACK },
@@ -369,7 +372,9 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 						}
 
 						RID shader_variant = shader_singleton->shader.version_get_shader(version, variant);
+						color_pipelines[i][j][l].set_ubershader_specializations(shader_singleton->use_ubershaders ? SHADER_SPECIALIZATION_UBERSHADER : 0, SHADER_SPECIALIZATION_UBERSHADER_DYNAMIC_MASK);
 						color_pipelines[i][j][l].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+						color_pipelines[i][j][l].set_manifest_key(vformat("forward_clustered/%s/color/%d/%d/%d", manifest_key_base, i, j, l));
 					}
 				} else {
 					RD::PipelineColorBlendState blend_state;
@@ -390,6 +395,7 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 
 					RID shader_variant = shader_singleton->shader.version_get_shader(version, shader_version);
 					pipelines[i][j][k].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+					pipelines[i][j][k].set_manifest_key(vformat("forward_clustered/%s/%d/%d/%d", manifest_key_base, i, j, k));
 				}
 			}
 		}
@@ -485,6 +491,8 @@ SceneShaderForwardClustered::~SceneShaderForwardClustered() {
 void SceneShaderForwardClustered::init(const String p_defines) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
+	use_ubershaders = GLOBAL_GET("rendering/shader_compiler/use_ubershaders") && RD::get_singleton()->render_pipeline_supports_async_creation();
+
 	{
 		Vector<ShaderRD::VariantDefine> shader_versions;
 		shader_versions.push_back(ShaderRD::VariantDefine(SHADER_GROUP_BASE, "\n#define MODE_RENDER_DEPTH\n", true)); // SHADER_VERSION_DEPTH_PASS
@@ -98,6 +98,9 @@ public:
 		SHADER_SPECIALIZATION_PROJECTOR = 1 << 1,
 		SHADER_SPECIALIZATION_SOFT_SHADOWS = 1 << 2,
 		SHADER_SPECIALIZATION_DIRECTIONAL_SOFT_SHADOWS = 1 << 3,
+		// Resolves the specializations above with dynamic branches on the draw call flags instead.
+		SHADER_SPECIALIZATION_UBERSHADER = 1 << 13,
+		SHADER_SPECIALIZATION_UBERSHADER_DYNAMIC_MASK = SHADER_SPECIALIZATION_FORWARD_GI | SHADER_SPECIALIZATION_PROJECTOR | SHADER_SPECIALIZATION_SOFT_SHADOWS | SHADER_SPECIALIZATION_DIRECTIONAL_SOFT_SHADOWS,
 	};
 
 	struct ShaderData : public RendererRD::MaterialStorage::ShaderData {
@@ -250,6 +253,7 @@ public:
 	ShaderData *debug_shadow_splits_material_shader_ptr = nullptr;
 
 	Vector<RD::PipelineSpecializationConstant> default_specialization_constants;
+	bool use_ubershaders = false;
 	bool valid_color_pass_pipelines[PIPELINE_COLOR_PASS_FLAG_COUNT];
 	SceneShaderForwardClustered();
 	~SceneShaderForwardClustered();
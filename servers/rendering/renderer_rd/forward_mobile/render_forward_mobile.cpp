@@ -780,6 +780,9 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 		} else if (p_render_data->environment.is_valid() && (environment_get_glow_enabled(p_render_data->environment) || RSG::camera_attributes->camera_attributes_uses_auto_exposure(p_render_data->camera_attributes) || RSG::camera_attributes->camera_attributes_uses_dof(p_render_data->camera_attributes))) {
 			// can't do blit subpass because we're using post processes
 			using_subpass_post_process = false;
+		} else if (rb->get_screen_space_aa() == RS::VIEWPORT_SCREEN_SPACE_AA_FXAA) {
+			// can't do blit subpass because FXAA samples neighboring pixels
+			using_subpass_post_process = false;
 		}
 
 		if (scene_state.used_screen_texture || scene_state.used_depth_texture) {
@@ -984,7 +987,11 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 			}
 		}
 
-		RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, load_color ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, c, 1.0, 0);
+		// When post processing is merged into the same render pass nothing reads depth once the pass ends,
+		// so tile based GPUs don't need to write it back to memory.
+		bool discard_depth = rb_data.is_valid() && using_subpass_post_process && p_render_data->scene_data->view_count == 1 && get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_DISABLED;
+
+		RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, load_color ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_CLEAR, discard_depth ? RD::FINAL_ACTION_DISCARD : RD::FINAL_ACTION_STORE, c, 1.0, 0);
 		RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
 		if (copy_canvas) {
@@ -2196,6 +2203,8 @@ void RenderForwardMobile::_render_list_template(RenderingDevice::DrawListID p_dr
 		}
 
 		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, p_params->subpass, base_spec_constants);
+		// Only read when the ubershader is used while the specialized pipeline compiles.
+		push_constant.ubershader_flags = base_spec_constants & SPEC_CONSTANT_UBERSHADER_DYNAMIC_MASK;
 
 		if (pipeline_rd != prev_pipeline_rd) {
 			// checking with prev shader does not make so much sense, as
@@ -82,6 +82,10 @@ private:
 		SPEC_CONSTANT_DISABLE_FOG = 14,
 		SPEC_CONSTANT_USE_DEPTH_FOG = 16,
 
+		// Resolves the per-instance toggles with dynamic branches on the draw call flags instead.
+		SPEC_CONSTANT_USE_UBERSHADER = 17,
+		SPEC_CONSTANT_UBERSHADER_DYNAMIC_MASK = (1 << SPEC_CONSTANT_USING_PROJECTOR) | (1 << SPEC_CONSTANT_USING_SOFT_SHADOWS) | (1 << SPEC_CONSTANT_USING_DIRECTIONAL_SOFT_SHADOWS) | (1 << SPEC_CONSTANT_DISABLE_OMNI_LIGHTS) | (1 << SPEC_CONSTANT_DISABLE_SPOT_LIGHTS) | (1 << SPEC_CONSTANT_DISABLE_REFLECTION_PROBES) | (1 << SPEC_CONSTANT_DISABLE_DECALS),
+
 	};
 
 	enum {
@@ -223,7 +227,7 @@ private:
 		struct PushConstant {
 			float uv_offset[2];
 			uint32_t base_index;
-			uint32_t pad;
+			uint32_t ubershader_flags;
 		};
 
 		struct InstanceData {
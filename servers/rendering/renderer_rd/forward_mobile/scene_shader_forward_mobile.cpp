@@ -275,6 +275,9 @@ void SceneShaderForwardMobile::ShaderData::set_code(const String &p_code) {
 		depth_stencil_state.enable_depth_write = depth_draw != DEPTH_DRAW_DISABLED ? true : false;
 	}
 
+	// Stable across runs, so pipelines recorded in a manifest can be found again when precompiling.
+	String manifest_key_base = String::num_uint64(code.hash64(), 16);
+
 	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
 		RD::PolygonCullMode cull_mode_rd_table[CULL_VARIANT_MAX][3] = {
 			{ RD::POLYGON_CULL_DISABLED, RD::POLYGON_CULL_FRONT, RD::POLYGON_CULL_BACK },
@@ -341,8 +344,11 @@ void SceneShaderForwardMobile::ShaderData::set_code(const String &p_code) {
 					}
 				}
 
+				bool color_pass = k == SHADER_VERSION_COLOR_PASS || k == SHADER_VERSION_COLOR_PASS_MULTIVIEW || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS_MULTIVIEW;
 				RID shader_variant = shader_singleton->shader.version_get_shader(version, k);
+				pipelines[i][j][k].set_ubershader_specializations(color_pass && shader_singleton->use_ubershaders ? (1 << RenderForwardMobile::SPEC_CONSTANT_USE_UBERSHADER) : 0, RenderForwardMobile::SPEC_CONSTANT_UBERSHADER_DYNAMIC_MASK);
 				pipelines[i][j][k].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+				pipelines[i][j][k].set_manifest_key(vformat("forward_mobile/%s/%d/%d/%d", manifest_key_base, i, j, k));
 			}
 		}
 	}
@@ -424,6 +430,8 @@ SceneShaderForwardMobile::SceneShaderForwardMobile() {
 void SceneShaderForwardMobile::init(const String p_defines) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
+	use_ubershaders = GLOBAL_GET("rendering/shader_compiler/use_ubershaders") && RD::get_singleton()->render_pipeline_supports_async_creation();
+
 	/* SCENE SHADER */
 
 	{
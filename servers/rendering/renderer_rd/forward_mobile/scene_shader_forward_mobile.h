@@ -204,6 +204,7 @@ public:
 	~SceneShaderForwardMobile();
 
 	Vector<RD::PipelineSpecializationConstant> default_specialization_constants;
+	bool use_ubershaders = false;
 
 	void init(const String p_defines);
 	void set_default_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_constants);
@@ -32,14 +32,20 @@
 
 #include "core/os/memory.h"
 
-RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+Mutex PipelineCacheRD::manifest_mutex;
+SafeFlag PipelineCacheRD::manifest_recording;
+HashMap<String, PipelineCacheRD *> PipelineCacheRD::manifest_caches;
+HashSet<uint32_t> PipelineCacheRD::manifest_recorded_hashes;
+LocalVector<Dictionary> PipelineCacheRD::manifest_recorded;
+SafeNumeric<uint32_t> PipelineCacheRD::manifest_precompile_requested;
+SafeNumeric<uint32_t> PipelineCacheRD::manifest_precompile_completed;
+
+RID PipelineCacheRD::_create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) const {
 	RD::PipelineMultisampleState multisample_state_version = multisample_state;
 	multisample_state_version.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
 
-	bool wireframe = p_wireframe;
-
 	RD::PipelineRasterizationState raster_state_version = rasterization_state;
-	raster_state_version.wireframe = wireframe;
+	raster_state_version.wireframe = p_wireframe;
 
 	Vector<RD::PipelineSpecializationConstant> specialization_constants = base_specialization_constants;
 
@@ -57,16 +63,91 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 		bool_index++;
 	}
 
-	RID pipeline = RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
-	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	return RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
+}
+
+uint32_t PipelineCacheRD::_add_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, RID p_pipeline) {
 	versions = static_cast<Version *>(memrealloc(versions, sizeof(Version) * (version_count + 1)));
 	versions[version_count].framebuffer_id = p_framebuffer_format_id;
 	versions[version_count].vertex_id = p_vertex_format_id;
-	versions[version_count].wireframe = wireframe;
-	versions[version_count].pipeline = pipeline;
+	versions[version_count].wireframe = p_wireframe;
+	versions[version_count].pipeline = p_pipeline;
 	versions[version_count].render_pass = p_render_pass;
 	versions[version_count].bool_specializations = p_bool_specializations;
-	version_count++;
+	versions[version_count].compile_task = WorkerThreadPool::INVALID_TASK_ID;
+	versions[version_count].compile_request = nullptr;
+
+	if (manifest_recording.is_set() && !manifest_key.is_empty()) {
+		_record_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+	}
+	return version_count++;
+}
+
+void PipelineCacheRD::_add_compiling_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, bool p_precompile) {
+	CompileRequest *request = memnew(CompileRequest);
+	request->cache = this;
+	request->vertex_id = p_vertex_format_id;
+	request->framebuffer_id = p_framebuffer_format_id;
+	request->wireframe = p_wireframe;
+	request->render_pass = p_render_pass;
+	request->bool_specializations = p_bool_specializations;
+	request->precompile = p_precompile;
+
+	uint32_t index = _add_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, RID());
+	versions[index].compile_request = request;
+	versions[index].compile_task = WorkerThreadPool::get_singleton()->add_native_task(&PipelineCacheRD::_compile_version_task, request, false, "PipelineCompile");
+}
+
+void PipelineCacheRD::_compile_version_task(void *p_request) {
+	CompileRequest *request = static_cast<CompileRequest *>(p_request);
+	// The cache state used here is only modified after waiting for all pending tasks, see _clear().
+	request->pipeline = request->cache->_create_pipeline(request->vertex_id, request->framebuffer_id, request->wireframe, request->render_pass, request->bool_specializations);
+	if (request->precompile) {
+		manifest_precompile_completed.increment();
+	}
+}
+
+RID PipelineCacheRD::_get_ubershader_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	uint32_t bool_specializations = (p_bool_specializations & ~ubershader_dynamic_specializations) | ubershader_specialization;
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == bool_specializations) {
+			return versions[i].pipeline;
+		}
+	}
+
+	// The ubershader is shared by all the specializations, so it's only compiled synchronously once.
+	RID pipeline = _create_pipeline(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, bool_specializations);
+	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	_add_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, bool_specializations, pipeline);
+	return pipeline;
+}
+
+RID PipelineCacheRD::_get_compiling_version(uint32_t p_index) {
+	Version &version = versions[p_index];
+	if (ubershader_specialization != 0 && !WorkerThreadPool::get_singleton()->is_task_completed(version.compile_task)) {
+		return _get_ubershader_version(version.vertex_id, version.framebuffer_id, version.wireframe, version.render_pass, version.bool_specializations);
+	}
+
+	// Without an ubershader to fall back to, wait as a synchronous compilation would have.
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(version.compile_task);
+	version.pipeline = version.compile_request->pipeline;
+	version.compile_task = WorkerThreadPool::INVALID_TASK_ID;
+	memdelete(version.compile_request);
+	version.compile_request = nullptr;
+	ERR_FAIL_COND_V(version.pipeline.is_null(), RID());
+	return version.pipeline;
+}
+
+RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	if (ubershader_specialization != 0 && !(p_bool_specializations & ubershader_specialization)) {
+		_add_compiling_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, false);
+		return _get_ubershader_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+	}
+
+	RID pipeline = _create_pipeline(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	_add_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, pipeline);
 	return pipeline;
 }
 
@@ -74,6 +155,12 @@ void PipelineCacheRD::_clear() {
 	// TODO: Clear should probably recompile all the variants already compiled instead to avoid stalls? Needs discussion.
 	if (versions) {
 		for (uint32_t i = 0; i < version_count; i++) {
+			if (versions[i].compile_task != WorkerThreadPool::INVALID_TASK_ID) {
+				// Background compilations read the cache state, so they must finish before it changes.
+				WorkerThreadPool::get_singleton()->wait_for_task_completion(versions[i].compile_task);
+				versions[i].pipeline = versions[i].compile_request->pipeline;
+				memdelete(versions[i].compile_request);
+			}
 			//shader may be gone, so this may not be valid
 			if (RD::get_singleton()->render_pipeline_is_valid(versions[i].pipeline)) {
 				RD::get_singleton()->free(versions[i].pipeline);
@@ -99,8 +186,8 @@ void PipelineCacheRD::setup(RID p_shader, RD::RenderPrimitive p_primitive, const
 	base_specialization_constants = p_base_specialization_constants;
 }
 void PipelineCacheRD::update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants) {
-	base_specialization_constants = p_base_specialization_constants;
 	_clear();
+	base_specialization_constants = p_base_specialization_constants;
 }
 
 void PipelineCacheRD::update_shader(RID p_shader) {
@@ -109,7 +196,220 @@ void PipelineCacheRD::update_shader(RID p_shader) {
 	setup(p_shader, render_primitive, rasterization_state, multisample_state, depth_stencil_state, blend_state, dynamic_state_flags);
 }
 
+void PipelineCacheRD::set_ubershader_specializations(uint32_t p_ubershader_specialization, uint32_t p_dynamic_specializations) {
+	_clear();
+	ubershader_specialization = p_ubershader_specialization;
+	ubershader_dynamic_specializations = p_dynamic_specializations;
+}
+
+void PipelineCacheRD::set_manifest_key(const String &p_key) {
+	MutexLock lock(manifest_mutex);
+	_unregister_manifest_key();
+	manifest_key = p_key;
+	if (!manifest_key.is_empty()) {
+		manifest_caches[manifest_key] = this;
+	}
+}
+
+void PipelineCacheRD::_unregister_manifest_key() {
+	// Identical shaders share the key, only the most recent cache is used for precompiling.
+	HashMap<String, PipelineCacheRD *>::Iterator E = manifest_caches.find(manifest_key);
+	if (E && E->value == this) {
+		manifest_caches.remove(E);
+	}
+}
+
+void PipelineCacheRD::_record_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) const {
+	RenderingDevice *rd = RD::get_singleton();
+	Dictionary entry;
+	entry["key"] = manifest_key;
+
+	PackedInt64Array vertex_format;
+	if (p_vertex_format_id != RD::INVALID_ID) {
+		Vector<RD::VertexAttribute> attributes = rd->vertex_format_get_attributes(p_vertex_format_id);
+		for (const RD::VertexAttribute &attribute : attributes) {
+			vertex_format.push_back(attribute.location);
+			vertex_format.push_back(attribute.offset);
+			vertex_format.push_back(attribute.format);
+			vertex_format.push_back(attribute.stride);
+			vertex_format.push_back(attribute.frequency);
+		}
+	}
+	entry["vertex_format"] = vertex_format;
+
+	PackedInt64Array attachments;
+	for (const RD::AttachmentFormat &attachment : rd->framebuffer_format_get_attachments(p_framebuffer_format_id)) {
+		attachments.push_back(attachment.format);
+		attachments.push_back(attachment.samples);
+		attachments.push_back(attachment.usage_flags);
+	}
+	entry["attachments"] = attachments;
+
+	Array passes;
+	for (const RD::FramebufferPass &pass : rd->framebuffer_format_get_passes(p_framebuffer_format_id)) {
+		Dictionary pass_entry;
+		pass_entry["color"] = PackedInt32Array(pass.color_attachments);
+		pass_entry["input"] = PackedInt32Array(pass.input_attachments);
+		pass_entry["resolve"] = PackedInt32Array(pass.resolve_attachments);
+		pass_entry["preserve"] = PackedInt32Array(pass.preserve_attachments);
+		pass_entry["depth"] = pass.depth_attachment;
+		pass_entry["vrs"] = pass.vrs_attachment;
+		passes.push_back(pass_entry);
+	}
+	entry["passes"] = passes;
+	entry["view_count"] = rd->framebuffer_format_get_view_count(p_framebuffer_format_id);
+	entry["samples"] = rd->framebuffer_format_get_texture_samples(p_framebuffer_format_id, 0);
+	entry["wireframe"] = p_wireframe;
+	entry["render_pass"] = p_render_pass;
+	entry["specializations"] = p_bool_specializations;
+
+	MutexLock lock(manifest_mutex);
+	uint32_t hash = entry.hash();
+	if (!manifest_recorded_hashes.has(hash)) {
+		manifest_recorded_hashes.insert(hash);
+		manifest_recorded.push_back(entry);
+	}
+}
+
+void PipelineCacheRD::_precompile_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	spin_lock.lock();
+	p_wireframe |= rasterization_state.wireframe;
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == p_bool_specializations) {
+			spin_lock.unlock();
+			manifest_precompile_completed.increment();
+			return;
+		}
+	}
+
+	if (RD::get_singleton()->render_pipeline_supports_async_creation()) {
+		_add_compiling_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, true);
+	} else {
+		RID pipeline = _create_pipeline(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+		if (pipeline.is_valid()) {
+			_add_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, pipeline);
+		}
+		manifest_precompile_completed.increment();
+	}
+	spin_lock.unlock();
+}
+
+void PipelineCacheRD::manifest_set_recording(bool p_enable) {
+	manifest_recording.set_to(p_enable);
+}
+
+bool PipelineCacheRD::manifest_is_recording() {
+	return manifest_recording.is_set();
+}
+
+TypedArray<Dictionary> PipelineCacheRD::manifest_get() {
+	MutexLock lock(manifest_mutex);
+	TypedArray<Dictionary> manifest;
+	manifest.resize(manifest_recorded.size());
+	for (uint32_t i = 0; i < manifest_recorded.size(); i++) {
+		manifest[i] = manifest_recorded[i];
+	}
+	return manifest;
+}
+
+void PipelineCacheRD::manifest_clear() {
+	MutexLock lock(manifest_mutex);
+	manifest_recorded.reset();
+	manifest_recorded_hashes.reset();
+}
+
+void PipelineCacheRD::manifest_precompile(const TypedArray<Dictionary> &p_manifest) {
+	RenderingDevice *rd = RD::get_singleton();
+	if (manifest_precompile_completed.get() == manifest_precompile_requested.get()) {
+		// Start reporting progress from scratch once the previous precompilation is done.
+		manifest_precompile_requested.set(0);
+		manifest_precompile_completed.set(0);
+	}
+
+	MutexLock lock(manifest_mutex);
+	for (int i = 0; i < p_manifest.size(); i++) {
+		const Dictionary entry = p_manifest[i];
+		HashMap<String, PipelineCacheRD *>::Iterator E = manifest_caches.find(entry.get("key", String()));
+		if (!E) {
+			// The shader was not loaded yet (or does not exist anymore), nothing to compile it for.
+			continue;
+		}
+
+		RD::VertexFormatID vertex_format_id = RD::INVALID_ID;
+		const PackedInt64Array vertex_format = entry.get("vertex_format", PackedInt64Array());
+		ERR_CONTINUE(vertex_format.size() % 5 != 0);
+		if (!vertex_format.is_empty()) {
+			Vector<RD::VertexAttribute> attributes;
+			for (int j = 0; j < vertex_format.size(); j += 5) {
+				RD::VertexAttribute attribute;
+				attribute.location = vertex_format[j + 0];
+				attribute.offset = vertex_format[j + 1];
+				attribute.format = RD::DataFormat(vertex_format[j + 2]);
+				attribute.stride = vertex_format[j + 3];
+				attribute.frequency = RD::VertexFrequency(vertex_format[j + 4]);
+				attributes.push_back(attribute);
+			}
+			vertex_format_id = rd->vertex_format_create(attributes);
+		}
+
+		const PackedInt64Array attachment_data = entry.get("attachments", PackedInt64Array());
+		ERR_CONTINUE(attachment_data.size() % 3 != 0);
+		Vector<RD::AttachmentFormat> attachments;
+		for (int j = 0; j < attachment_data.size(); j += 3) {
+			RD::AttachmentFormat attachment;
+			attachment.format = RD::DataFormat(attachment_data[j + 0]);
+			attachment.samples = RD::TextureSamples(attachment_data[j + 1]);
+			attachment.usage_flags = attachment_data[j + 2];
+			attachments.push_back(attachment);
+		}
+
+		RD::FramebufferFormatID framebuffer_format_id;
+		if (attachments.is_empty()) {
+			framebuffer_format_id = rd->framebuffer_format_create_empty(RD::TextureSamples(int(entry.get("samples", 0))));
+		} else {
+			const Array pass_data = entry.get("passes", Array());
+			Vector<RD::FramebufferPass> passes;
+			for (int j = 0; j < pass_data.size(); j++) {
+				const Dictionary pass_entry = pass_data[j];
+				RD::FramebufferPass pass;
+				pass.color_attachments = PackedInt32Array(pass_entry.get("color", PackedInt32Array()));
+				pass.input_attachments = PackedInt32Array(pass_entry.get("input", PackedInt32Array()));
+				pass.resolve_attachments = PackedInt32Array(pass_entry.get("resolve", PackedInt32Array()));
+				pass.preserve_attachments = PackedInt32Array(pass_entry.get("preserve", PackedInt32Array()));
+				pass.depth_attachment = pass_entry.get("depth", RD::ATTACHMENT_UNUSED);
+				pass.vrs_attachment = pass_entry.get("vrs", RD::ATTACHMENT_UNUSED);
+				passes.push_back(pass);
+			}
+			framebuffer_format_id = rd->framebuffer_format_create_multipass(attachments, passes, entry.get("view_count", 1));
+		}
+		ERR_CONTINUE(framebuffer_format_id == RD::INVALID_ID);
+
+		manifest_precompile_requested.increment();
+		E->value->_precompile_version(vertex_format_id, framebuffer_format_id, entry.get("wireframe", false), entry.get("render_pass", 0), entry.get("specializations", 0));
+	}
+}
+
+float PipelineCacheRD::manifest_get_precompile_progress() {
+	uint32_t requested = manifest_precompile_requested.get();
+	if (requested == 0) {
+		return 1.0;
+	}
+	return MIN(float(manifest_precompile_completed.get()) / float(requested), 1.0f);
+}
+
+void PipelineCacheRD::manifest_finalize() {
+	MutexLock lock(manifest_mutex);
+	manifest_recorded.reset();
+	manifest_recorded_hashes.reset();
+	manifest_caches.clear();
+}
+
 void PipelineCacheRD::clear() {
+	{
+		MutexLock lock(manifest_mutex);
+		_unregister_manifest_key();
+		manifest_key = String();
+	}
 	_clear();
 	shader = RID(); //clear shader
 	input_mask = 0;
@@ -122,5 +422,9 @@ PipelineCacheRD::PipelineCacheRD() {
 }
 
 PipelineCacheRD::~PipelineCacheRD() {
+	if (!manifest_key.is_empty()) {
+		MutexLock lock(manifest_mutex);
+		_unregister_manifest_key();
+	}
 	_clear();
 }
@@ -31,7 +31,13 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/typed_array.h"
 #include "servers/rendering/rendering_device.h"
 
 class PipelineCacheRD {
@@ -48,6 +54,22 @@ class PipelineCacheRD {
 	int dynamic_state_flags = 0;
 	Vector<RD::PipelineSpecializationConstant> base_specialization_constants;
 
+	// When set, specialized versions are compiled in the background and the ubershader
+	// version (which resolves the dynamic specializations with branches) is used meanwhile.
+	uint32_t ubershader_specialization = 0;
+	uint32_t ubershader_dynamic_specializations = 0;
+
+	struct CompileRequest {
+		PipelineCacheRD *cache = nullptr;
+		RD::VertexFormatID vertex_id;
+		RD::FramebufferFormatID framebuffer_id;
+		uint32_t render_pass;
+		bool wireframe;
+		uint32_t bool_specializations;
+		bool precompile = false;
+		RID pipeline;
+	};
+
 	struct Version {
 		RD::VertexFormatID vertex_id;
 		RD::FramebufferFormatID framebuffer_id;
@@ -55,11 +77,36 @@ class PipelineCacheRD {
 		bool wireframe;
 		uint32_t bool_specializations;
 		RID pipeline;
+		WorkerThreadPool::TaskID compile_task;
+		CompileRequest *compile_request;
 	};
 
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	// Identifies this cache across runs, so the versions it creates can be recorded in
+	// a pipeline manifest and compiled ahead of time on the next run.
+	String manifest_key;
+
+	static Mutex manifest_mutex;
+	static SafeFlag manifest_recording;
+	static HashMap<String, PipelineCacheRD *> manifest_caches;
+	static HashSet<uint32_t> manifest_recorded_hashes;
+	static LocalVector<Dictionary> manifest_recorded;
+	static SafeNumeric<uint32_t> manifest_precompile_requested;
+	static SafeNumeric<uint32_t> manifest_precompile_completed;
+
+	void _record_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) const;
+	void _precompile_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations);
+	void _unregister_manifest_key();
+
+	static void _compile_version_task(void *p_request);
+
+	RID _create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) const;
+	uint32_t _add_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, RID p_pipeline);
+	void _add_compiling_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, bool p_precompile);
+	RID _get_ubershader_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations);
+	RID _get_compiling_version(uint32_t p_index);
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
 
 	void _clear();
@@ -68,6 +115,16 @@ public:
 	void setup(RID p_shader, RD::RenderPrimitive p_primitive, const RD::PipelineRasterizationState &p_rasterization_state, RD::PipelineMultisampleState p_multisample, const RD::PipelineDepthStencilState &p_depth_stencil_state, const RD::PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags = 0, const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants = Vector<RD::PipelineSpecializationConstant>());
 	void update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants);
 	void update_shader(RID p_shader);
+	void set_ubershader_specializations(uint32_t p_ubershader_specialization, uint32_t p_dynamic_specializations);
+	void set_manifest_key(const String &p_key);
+
+	static void manifest_set_recording(bool p_enable);
+	static bool manifest_is_recording();
+	static TypedArray<Dictionary> manifest_get();
+	static void manifest_clear();
+	static void manifest_precompile(const TypedArray<Dictionary> &p_manifest);
+	static float manifest_get_precompile_progress();
+	static void manifest_finalize();
 
 	_FORCE_INLINE_ RID get_render_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe = false, uint32_t p_render_pass = 0, uint32_t p_bool_specializations = 0) {
 #ifdef DEBUG_ENABLED
@@ -81,7 +138,11 @@ public:
 		RID result;
 		for (uint32_t i = 0; i < version_count; i++) {
 			if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == p_bool_specializations) {
-				result = versions[i].pipeline;
+				if (unlikely(versions[i].compile_task != WorkerThreadPool::INVALID_TASK_ID)) {
+					result = _get_compiling_version(i);
+				} else {
+					result = versions[i].pipeline;
+				}
 				spin_lock.unlock();
 				return result;
 			}
@@ -350,15 +350,11 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
+RID RendererCanvasRenderRD::_get_canvas_texture_uniform_set(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
 
-	if (r_last_texture == p_texture) {
-		return; //nothing to do, its the same
-	}
-
 	RID uniform_set;
 	Color specular_shininess;
 	Size2i size;
@@ -368,12 +364,9 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, bool(push_constant.flags & FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR), uniform_set, size, specular_shininess, use_normal, use_specular, p_texture_is_data);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
-		return;
+		return _get_canvas_texture_uniform_set(default_canvas_texture, p_base_filter, p_base_repeat, push_constant, r_texpixel_size);
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
-
 	if (specular_shininess.a < 0.999) {
 		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	} else {
@@ -397,15 +390,377 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	push_constant.color_texture_pixel_size[0] = r_texpixel_size.x;
 	push_constant.color_texture_pixel_size[1] = r_texpixel_size.y;
 
+	return uniform_set;
+}
+
+void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
+	if (p_texture == RID()) {
+		p_texture = default_canvas_texture;
+	}
+
+	if (r_last_texture == p_texture) {
+		return; //nothing to do, its the same
+	}
+
+	RID uniform_set = _get_canvas_texture_uniform_set(p_texture, p_base_filter, p_base_repeat, push_constant, r_texpixel_size, p_texture_is_data);
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+
 	r_last_texture = p_texture;
 }
 
+uint32_t RendererCanvasRenderRD::_get_item_lights(const Item *p_item, Light *p_lights, uint32_t *r_lights) {
+	uint32_t light_count = 0;
+	Light *light = p_lights;
+
+	while (light) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+			uint32_t light_index = light->render_index_cache;
+			r_lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+
+			light_count++;
+
+			if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
+				break;
+			}
+		}
+		light = light->next_ptr;
+	}
+
+	return light_count;
+}
+
 _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primitive, uint32_t p_indices) {
 	static const uint32_t divisor[RS::PRIMITIVE_MAX] = { 1, 2, 1, 3, 1 };
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
 
+void RendererCanvasRenderRD::_prepare_rect_batch(RID p_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights) {
+	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
+
+	rect_batch.draw_data.clear();
+	rect_batch.instances.clear();
+	rect_batch.next_instance = 0;
+	rect_batch.count = 0;
+
+	bool use_linear_colors = texture_storage->render_target_is_using_hdr(p_render_target);
+
+	// Walks the commands exactly like _render_item() does, so rects and nine-patches are found in draw order.
+	for (int i = 0; i < p_item_count; i++) {
+		const Item *p_item = items[i];
+
+		RS::CanvasItemTextureFilter current_filter = default_filter;
+		RS::CanvasItemTextureRepeat current_repeat = default_repeat;
+
+		if (p_item->texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT) {
+			current_filter = p_item->texture_filter;
+		}
+
+		if (p_item->texture_repeat != RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT) {
+			current_repeat = p_item->texture_repeat;
+		}
+
+		PushConstant push_constant;
+		memset(&push_constant, 0, sizeof(PushConstant));
+
+		Transform2D base_transform = p_canvas_transform_inverse * p_item->final_transform;
+		_update_transform_2d_to_mat2x3(base_transform, push_constant.world);
+
+		Color base_color = p_item->final_modulate;
+
+		uint32_t base_flags = use_linear_colors ? FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR : 0;
+		base_flags |= _get_item_lights(p_item, p_lights, push_constant.lights) << FLAGS_LIGHT_COUNT_SHIFT;
+
+		RID last_texture;
+		RID last_texture_uniform_set;
+		Size2 texpixel_size;
+
+		bool skipping = false;
+
+		const Item::Command *c = p_item->commands;
+		while (c) {
+			if (skipping && c->type != Item::Command::TYPE_ANIMATION_SLICE) {
+				c = c->next;
+				continue;
+			}
+
+			push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
+
+			switch (c->type) {
+				case Item::Command::TYPE_RECT: {
+					const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+
+					if (rect->flags & CANVAS_RECT_TILE) {
+						current_repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
+					}
+
+					if (last_texture_uniform_set.is_null() || rect->texture != last_texture) {
+						last_texture_uniform_set = _get_canvas_texture_uniform_set(rect->texture, current_filter, current_repeat, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
+						last_texture = rect->texture;
+					}
+
+					Rect2 src_rect;
+					Rect2 dst_rect;
+
+					if (rect->texture != RID()) {
+						src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
+						dst_rect = Rect2(rect->rect.position, rect->rect.size);
+
+						if (dst_rect.size.width < 0) {
+							dst_rect.position.x += dst_rect.size.width;
+							dst_rect.size.width *= -1;
+						}
+						if (dst_rect.size.height < 0) {
+							dst_rect.position.y += dst_rect.size.height;
+							dst_rect.size.height *= -1;
+						}
+
+						if (rect->flags & CANVAS_RECT_FLIP_H) {
+							src_rect.size.x *= -1;
+							push_constant.flags |= FLAGS_FLIP_H;
+						}
+
+						if (rect->flags & CANVAS_RECT_FLIP_V) {
+							src_rect.size.y *= -1;
+							push_constant.flags |= FLAGS_FLIP_V;
+						}
+
+						if (rect->flags & CANVAS_RECT_TRANSPOSE) {
+							push_constant.flags |= FLAGS_TRANSPOSE_RECT;
+						}
+
+						if (rect->flags & CANVAS_RECT_CLIP_UV) {
+							push_constant.flags |= FLAGS_CLIP_RECT_UV;
+						}
+
+					} else {
+						dst_rect = Rect2(rect->rect.position, rect->rect.size);
+
+						if (dst_rect.size.width < 0) {
+							dst_rect.position.x += dst_rect.size.width;
+							dst_rect.size.width *= -1;
+						}
+						if (dst_rect.size.height < 0) {
+							dst_rect.position.y += dst_rect.size.height;
+							dst_rect.size.height *= -1;
+						}
+
+						src_rect = Rect2(0, 0, 1, 1);
+					}
+
+					if (rect->flags & CANVAS_RECT_MSDF) {
+						push_constant.flags |= FLAGS_USE_MSDF;
+						push_constant.msdf[0] = rect->px_range; // Pixel range.
+						push_constant.msdf[1] = rect->outline; // Outline size.
+						push_constant.msdf[2] = 0.f; // Reserved.
+						push_constant.msdf[3] = 0.f; // Reserved.
+					} else if (rect->flags & CANVAS_RECT_LCD) {
+						push_constant.flags |= FLAGS_USE_LCD;
+					}
+
+					Color modulated = rect->modulate * base_color;
+					if (use_linear_colors) {
+						modulated = modulated.srgb_to_linear();
+					}
+
+					push_constant.modulation[0] = modulated.r;
+					push_constant.modulation[1] = modulated.g;
+					push_constant.modulation[2] = modulated.b;
+					push_constant.modulation[3] = modulated.a;
+
+					push_constant.src_rect[0] = src_rect.position.x;
+					push_constant.src_rect[1] = src_rect.position.y;
+					push_constant.src_rect[2] = src_rect.size.width;
+					push_constant.src_rect[3] = src_rect.size.height;
+
+					push_constant.dst_rect[0] = dst_rect.position.x;
+					push_constant.dst_rect[1] = dst_rect.position.y;
+					push_constant.dst_rect[2] = dst_rect.size.width;
+					push_constant.dst_rect[3] = dst_rect.size.height;
+
+					rect_batch.draw_data.push_back(push_constant);
+					rect_batch.instances.push_back({ last_texture_uniform_set, rect->modulate });
+
+				} break;
+
+				case Item::Command::TYPE_NINEPATCH: {
+					const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
+
+					if (last_texture_uniform_set.is_null() || np->texture != last_texture) {
+						last_texture_uniform_set = _get_canvas_texture_uniform_set(np->texture, current_filter, current_repeat, push_constant, texpixel_size);
+						last_texture = np->texture;
+					}
+
+					Rect2 src_rect;
+					Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
+
+					if (np->texture == RID()) {
+						texpixel_size = Size2(1, 1);
+						src_rect = Rect2(0, 0, 1, 1);
+
+					} else {
+						if (np->source != Rect2()) {
+							src_rect = Rect2(np->source.position.x * texpixel_size.width, np->source.position.y * texpixel_size.height, np->source.size.x * texpixel_size.width, np->source.size.y * texpixel_size.height);
+							push_constant.color_texture_pixel_size[0] = 1.0 / np->source.size.width;
+							push_constant.color_texture_pixel_size[1] = 1.0 / np->source.size.height;
+
+						} else {
+							src_rect = Rect2(0, 0, 1, 1);
+						}
+					}
+
+					Color modulated = np->color * base_color;
+					if (use_linear_colors) {
+						modulated = modulated.srgb_to_linear();
+					}
+
+					push_constant.modulation[0] = modulated.r;
+					push_constant.modulation[1] = modulated.g;
+					push_constant.modulation[2] = modulated.b;
+					push_constant.modulation[3] = modulated.a;
+
+					push_constant.src_rect[0] = src_rect.position.x;
+					push_constant.src_rect[1] = src_rect.position.y;
+					push_constant.src_rect[2] = src_rect.size.width;
+					push_constant.src_rect[3] = src_rect.size.height;
+
+					push_constant.dst_rect[0] = dst_rect.position.x;
+					push_constant.dst_rect[1] = dst_rect.position.y;
+					push_constant.dst_rect[2] = dst_rect.size.width;
+					push_constant.dst_rect[3] = dst_rect.size.height;
+
+					push_constant.flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
+					push_constant.flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
+
+					if (np->draw_center) {
+						push_constant.flags |= FLAGS_NINEPACH_DRAW_CENTER;
+					}
+
+					push_constant.ninepatch_margins[0] = np->margin[SIDE_LEFT];
+					push_constant.ninepatch_margins[1] = np->margin[SIDE_TOP];
+					push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
+					push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
+
+					rect_batch.draw_data.push_back(push_constant);
+					rect_batch.instances.push_back({ last_texture_uniform_set, Color() });
+
+					// Restore if overridden.
+					push_constant.color_texture_pixel_size[0] = texpixel_size.x;
+					push_constant.color_texture_pixel_size[1] = texpixel_size.y;
+
+				} break;
+				case Item::Command::TYPE_TRANSFORM: {
+					const Item::CommandTransform *transform = static_cast<const Item::CommandTransform *>(c);
+					_update_transform_2d_to_mat2x3(base_transform * transform->xform, push_constant.world);
+
+				} break;
+				case Item::Command::TYPE_ANIMATION_SLICE: {
+					const Item::CommandAnimationSlice *as = static_cast<const Item::CommandAnimationSlice *>(c);
+					double current_time = RendererCompositorRD::get_singleton()->get_total_time();
+					double local_time = Math::fposmod(current_time - as->offset, as->animation_length);
+					skipping = !(local_time >= as->slice_begin && local_time < as->slice_end);
+				} break;
+				default: {
+				} break;
+			}
+
+			c = c->next;
+		}
+#ifdef DEBUG_ENABLED
+		if (debug_redraw && p_item->debug_redraw_time > 0.0) {
+			Color dc = debug_redraw_color;
+			dc.a *= p_item->debug_redraw_time / debug_redraw_time;
+
+			push_constant.flags = base_flags;
+			RID texture_uniform_set = _get_canvas_texture_uniform_set(RID(), current_filter, current_repeat, push_constant, texpixel_size);
+
+			push_constant.modulation[0] = dc.r;
+			push_constant.modulation[1] = dc.g;
+			push_constant.modulation[2] = dc.b;
+			push_constant.modulation[3] = dc.a;
+
+			push_constant.src_rect[0] = 0;
+			push_constant.src_rect[1] = 0;
+			push_constant.src_rect[2] = 1;
+			push_constant.src_rect[3] = 1;
+
+			push_constant.dst_rect[0] = 0;
+			push_constant.dst_rect[1] = 0;
+			push_constant.dst_rect[2] = p_item->rect.size.width;
+			push_constant.dst_rect[3] = p_item->rect.size.height;
+
+			rect_batch.draw_data.push_back(push_constant);
+			rect_batch.instances.push_back({ texture_uniform_set, Color() });
+		}
+#endif
+	}
+
+	if (rect_batch.draw_data.is_empty()) {
+		return;
+	}
+
+	if (rect_batch.draw_data.size() > rect_batch.buffer_size) {
+		// Grow the buffer, the base uniform sets using it are invalidated and recreated.
+		RD::get_singleton()->free(rect_batch.buffer);
+		rect_batch.buffer_size = next_power_of_2(rect_batch.draw_data.size());
+		rect_batch.buffer = RD::get_singleton()->storage_buffer_create(rect_batch.buffer_size * sizeof(PushConstant));
+	}
+
+	RD::get_singleton()->buffer_update(rect_batch.buffer, 0, rect_batch.draw_data.size() * sizeof(PushConstant), rect_batch.draw_data.ptr());
+}
+
+void RendererCanvasRenderRD::_add_to_rect_batch(RD::DrawListID p_draw_list, RID p_pipeline, RenderingMethod::RenderInfo *r_render_info) {
+	ERR_FAIL_COND(rect_batch.next_instance >= rect_batch.instances.size());
+
+	uint32_t index = rect_batch.next_instance++;
+	const RectBatchInstance &instance = rect_batch.instances[index];
+	bool use_blend_constant = rect_batch.draw_data[index].flags & FLAGS_USE_LCD;
+
+	if (rect_batch.count == 0 || use_blend_constant || rect_batch.pipeline != p_pipeline || rect_batch.texture_uniform_set != instance.texture_uniform_set) {
+		_flush_rect_batch(p_draw_list, r_render_info);
+
+		RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, p_pipeline);
+		if (use_blend_constant) {
+			RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, instance.blend_constant);
+		}
+		RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, instance.texture_uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+
+		rect_batch.pipeline = p_pipeline;
+		rect_batch.texture_uniform_set = instance.texture_uniform_set;
+		rect_batch.from = index;
+	}
+
+	rect_batch.count++;
+
+	if (r_render_info) {
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
+	}
+}
+
+void RendererCanvasRenderRD::_flush_rect_batch(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info, bool p_batch_break) {
+	if (rect_batch.count == 0) {
+		return;
+	}
+
+	PushConstant push_constant;
+	memset(&push_constant, 0, sizeof(PushConstant));
+	push_constant.batch_offset = rect_batch.from;
+
+	RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+	RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
+	RD::get_singleton()->draw_list_draw(p_draw_list, true, rect_batch.count);
+
+	if (r_render_info) {
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
+		if (p_batch_break) {
+			r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_BATCH_BREAKS_IN_FRAME]++;
+		}
+	}
+
+	rect_batch.count = 0;
+}
+
 void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
@@ -441,8 +796,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	push_constant.color_texture_pixel_size[0] = 0;
 	push_constant.color_texture_pixel_size[1] = 0;
 
-	push_constant.pad[0] = 0;
-	push_constant.pad[1] = 0;
+	push_constant.batch_offset = 0;
+	push_constant.pad = 0;
 
 	push_constant.lights[0] = 0;
 	push_constant.lights[1] = 0;
@@ -452,30 +807,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	uint32_t base_flags = 0;
 	base_flags |= use_linear_colors ? FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR : 0;
 
-	uint16_t light_count = 0;
-	PipelineLightMode light_mode;
-
-	{
-		Light *light = p_lights;
-
-		while (light) {
-			if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
-				uint32_t light_index = light->render_index_cache;
-				push_constant.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+	uint32_t light_count = _get_item_lights(p_item, p_lights, push_constant.lights);
+	base_flags |= light_count << FLAGS_LIGHT_COUNT_SHIFT;
 
-				light_count++;
-
-				if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
-					break;
-				}
-			}
-			light = light->next_ptr;
-		}
-
-		base_flags |= light_count << FLAGS_LIGHT_COUNT_SHIFT;
-	}
-
-	light_mode = (light_count > 0 || using_directional_lights) ? PIPELINE_LIGHT_MODE_ENABLED : PIPELINE_LIGHT_MODE_DISABLED;
+	PipelineLightMode light_mode = (light_count > 0 || using_directional_lights) ? PIPELINE_LIGHT_MODE_ENABLED : PIPELINE_LIGHT_MODE_DISABLED;
 
 	PipelineVariants *pipeline_variants = p_pipeline_variants;
 
@@ -495,6 +830,11 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 		push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
 
+		if (c->type != Item::Command::TYPE_RECT && c->type != Item::Command::TYPE_NINEPATCH && c->type != Item::Command::TYPE_TRANSFORM && c->type != Item::Command::TYPE_ANIMATION_SLICE) {
+			// Commands that bind their own state end the current batch.
+			_flush_rect_batch(p_draw_list, r_render_info);
+		}
+
 		switch (c->type) {
 			case Item::Command::TYPE_RECT: {
 				const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
@@ -503,187 +843,17 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					current_repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
 				}
 
-				//bind pipeline
-				if (rect->flags & CANVAS_RECT_LCD) {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, rect->modulate);
-				} else {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-				}
-
-				//bind textures
-
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
-
-				Rect2 src_rect;
-				Rect2 dst_rect;
-
-				if (rect->texture != RID()) {
-					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
-
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
-
-					if (rect->flags & CANVAS_RECT_FLIP_H) {
-						src_rect.size.x *= -1;
-						push_constant.flags |= FLAGS_FLIP_H;
-					}
-
-					if (rect->flags & CANVAS_RECT_FLIP_V) {
-						src_rect.size.y *= -1;
-						push_constant.flags |= FLAGS_FLIP_V;
-					}
-
-					if (rect->flags & CANVAS_RECT_TRANSPOSE) {
-						push_constant.flags |= FLAGS_TRANSPOSE_RECT;
-					}
-
-					if (rect->flags & CANVAS_RECT_CLIP_UV) {
-						push_constant.flags |= FLAGS_CLIP_RECT_UV;
-					}
-
-				} else {
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
-
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
-
-					src_rect = Rect2(0, 0, 1, 1);
-				}
-
-				if (rect->flags & CANVAS_RECT_MSDF) {
-					push_constant.flags |= FLAGS_USE_MSDF;
-					push_constant.msdf[0] = rect->px_range; // Pixel range.
-					push_constant.msdf[1] = rect->outline; // Outline size.
-					push_constant.msdf[2] = 0.f; // Reserved.
-					push_constant.msdf[3] = 0.f; // Reserved.
-				} else if (rect->flags & CANVAS_RECT_LCD) {
-					push_constant.flags |= FLAGS_USE_LCD;
-				}
-
-				Color modulated = rect->modulate * base_color;
-				if (use_linear_colors) {
-					modulated = modulated.srgb_to_linear();
-				}
-
-				push_constant.modulation[0] = modulated.r;
-				push_constant.modulation[1] = modulated.g;
-				push_constant.modulation[2] = modulated.b;
-				push_constant.modulation[3] = modulated.a;
-
-				push_constant.src_rect[0] = src_rect.position.x;
-				push_constant.src_rect[1] = src_rect.position.y;
-				push_constant.src_rect[2] = src_rect.size.width;
-				push_constant.src_rect[3] = src_rect.size.height;
-
-				push_constant.dst_rect[0] = dst_rect.position.x;
-				push_constant.dst_rect[1] = dst_rect.position.y;
-				push_constant.dst_rect[2] = dst_rect.size.width;
-				push_constant.dst_rect[3] = dst_rect.size.height;
-
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
-
-				if (r_render_info) {
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
-				}
+				PipelineVariant variant = (rect->flags & CANVAS_RECT_LCD) ? PIPELINE_VARIANT_QUAD_LCD_BLEND : PIPELINE_VARIANT_QUAD;
+				RID pipeline = pipeline_variants->variants[light_mode][variant].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+				_add_to_rect_batch(p_draw_list, pipeline, r_render_info);
+				last_texture = RID(); // Texture bound by the batch.
 
 			} break;
 
 			case Item::Command::TYPE_NINEPATCH: {
-				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
-
-				//bind pipeline
-				{
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-				}
-
-				//bind textures
-
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
-
-				Rect2 src_rect;
-				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
-
-				if (np->texture == RID()) {
-					texpixel_size = Size2(1, 1);
-					src_rect = Rect2(0, 0, 1, 1);
-
-				} else {
-					if (np->source != Rect2()) {
-						src_rect = Rect2(np->source.position.x * texpixel_size.width, np->source.position.y * texpixel_size.height, np->source.size.x * texpixel_size.width, np->source.size.y * texpixel_size.height);
-						push_constant.color_texture_pixel_size[0] = 1.0 / np->source.size.width;
-						push_constant.color_texture_pixel_size[1] = 1.0 / np->source.size.height;
-
-					} else {
-						src_rect = Rect2(0, 0, 1, 1);
-					}
-				}
-
-				Color modulated = np->color * base_color;
-				if (use_linear_colors) {
-					modulated = modulated.srgb_to_linear();
-				}
-
-				push_constant.modulation[0] = modulated.r;
-				push_constant.modulation[1] = modulated.g;
-				push_constant.modulation[2] = modulated.b;
-				push_constant.modulation[3] = modulated.a;
-
-				push_constant.src_rect[0] = src_rect.position.x;
-				push_constant.src_rect[1] = src_rect.position.y;
-				push_constant.src_rect[2] = src_rect.size.width;
-				push_constant.src_rect[3] = src_rect.size.height;
-
-				push_constant.dst_rect[0] = dst_rect.position.x;
-				push_constant.dst_rect[1] = dst_rect.position.y;
-				push_constant.dst_rect[2] = dst_rect.size.width;
-				push_constant.dst_rect[3] = dst_rect.size.height;
-
-				push_constant.flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
-				push_constant.flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
-
-				if (np->draw_center) {
-					push_constant.flags |= FLAGS_NINEPACH_DRAW_CENTER;
-				}
-
-				push_constant.ninepatch_margins[0] = np->margin[SIDE_LEFT];
-				push_constant.ninepatch_margins[1] = np->margin[SIDE_TOP];
-				push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
-				push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
-
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
-
-				if (r_render_info) {
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
-				}
-
-				// Restore if overridden.
-				push_constant.color_texture_pixel_size[0] = texpixel_size.x;
-				push_constant.color_texture_pixel_size[1] = texpixel_size.y;
+				RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+				_add_to_rect_batch(p_draw_list, pipeline, r_render_info);
+				last_texture = RID(); // Texture bound by the batch.
 
 			} break;
 			case Item::Command::TYPE_POLYGON: {
@@ -1003,40 +1173,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 	}
 #ifdef DEBUG_ENABLED
 	if (debug_redraw && p_item->debug_redraw_time > 0.0) {
-		Color dc = debug_redraw_color;
-		dc.a *= p_item->debug_redraw_time / debug_redraw_time;
-
 		RID pipeline = pipeline_variants->variants[PIPELINE_LIGHT_MODE_DISABLED][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-		RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-
-		//bind textures
-
-		_bind_canvas_texture(p_draw_list, RID(), current_filter, current_repeat, last_texture, push_constant, texpixel_size);
-
-		Rect2 src_rect;
-		Rect2 dst_rect;
-
-		dst_rect = Rect2(Vector2(), p_item->rect.size);
-		src_rect = Rect2(0, 0, 1, 1);
-
-		push_constant.modulation[0] = dc.r;
-		push_constant.modulation[1] = dc.g;
-		push_constant.modulation[2] = dc.b;
-		push_constant.modulation[3] = dc.a;
-
-		push_constant.src_rect[0] = src_rect.position.x;
-		push_constant.src_rect[1] = src_rect.position.y;
-		push_constant.src_rect[2] = src_rect.size.width;
-		push_constant.src_rect[3] = src_rect.size.height;
-
-		push_constant.dst_rect[0] = dst_rect.position.x;
-		push_constant.dst_rect[1] = dst_rect.position.y;
-		push_constant.dst_rect[2] = dst_rect.size.width;
-		push_constant.dst_rect[3] = dst_rect.size.height;
-
-		RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-		RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-		RD::get_singleton()->draw_list_draw(p_draw_list, true);
+		_add_to_rect_batch(p_draw_list, pipeline, r_render_info);
 
 		p_item->debug_redraw_time -= RSG::rasterizer->get_frame_delta_time();
 
@@ -1122,6 +1260,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 8;
+		u.append_id(rect_batch.buffer);
+		uniforms.push_back(u);
+	}
+
 	{
 		RD::Uniform u;
 		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
@@ -1171,6 +1317,9 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		fb_uniform_set = texture_storage->render_target_get_framebuffer_uniform_set(p_to_render_target);
 	}
 
+	// Must happen before the draw list begins, and may recreate the base uniform set.
+	_prepare_rect_batch(p_to_render_target, p_item_count, canvas_transform_inverse, p_lights);
+
 	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
 		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
 	}
@@ -1190,6 +1339,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		Item *ci = items[i];
 
 		if (current_clip != ci->final_clip_owner) {
+			_flush_rect_batch(draw_list, r_render_info);
 			current_clip = ci->final_clip_owner;
 
 			//setup clip
@@ -1218,6 +1368,8 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		}
 
 		if (material != prev_material) {
+			_flush_rect_batch(draw_list, r_render_info);
+
 			CanvasMaterialData *material_data = nullptr;
 			if (material.is_valid()) {
 				material_data = static_cast<CanvasMaterialData *>(material_storage->material_get_data(material, RendererRD::MaterialStorage::SHADER_TYPE_2D));
@@ -1245,6 +1397,8 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		prev_material = material;
 	}
 
+	_flush_rect_batch(draw_list, r_render_info, false);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -2600,7 +2754,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_shader_uniforms.data";
 
@@ -2681,6 +2835,9 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		state.canvas_state_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(State::Buffer));
 		state.lights_uniform_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(LightUniform) * state.max_lights_per_render);
 
+		rect_batch.buffer_size = DEFAULT_RECT_BATCH_SIZE;
+		rect_batch.buffer = RD::get_singleton()->storage_buffer_create(rect_batch.buffer_size * sizeof(PushConstant));
+
 		RD::SamplerState shadow_sampler_state;
 		shadow_sampler_state.mag_filter = RD::SAMPLER_FILTER_LINEAR;
 		shadow_sampler_state.min_filter = RD::SAMPLER_FILTER_LINEAR;
@@ -2875,6 +3032,7 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+		RD::get_singleton()->free(rect_batch.buffer);
 	}
 
 	//shadow rendering
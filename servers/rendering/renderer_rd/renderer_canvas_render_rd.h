@@ -112,7 +112,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		MAX_RENDER_ITEMS = 256 * 1024,
 		MAX_LIGHT_TEXTURES = 1024,
 		MAX_LIGHTS_PER_ITEM = 16,
-		DEFAULT_MAX_LIGHTS_PER_RENDER = 256
+		DEFAULT_MAX_LIGHTS_PER_RENDER = 256,
+		DEFAULT_RECT_BATCH_SIZE = 1024, // Rects and nine-patches, the buffer grows as needed.
 	};
 
 	/****************/
@@ -391,7 +392,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 				};
 				float dst_rect[4];
 				float src_rect[4];
-				float pad[2];
+				uint32_t batch_offset; // First instance in the rect batch buffer.
+				uint32_t pad;
 			};
 			//primitive
 			struct {
@@ -406,6 +408,33 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	Item *items[MAX_RENDER_ITEMS];
 
+	/*****************/
+	/**** BATCHES ****/
+	/*****************/
+
+	// Rects and nine-patches read their draw data from a storage buffer, uploaded before the draw list begins.
+	// Consecutive ones using the same pipeline and texture are then drawn with a single instanced draw call.
+
+	struct RectBatchInstance {
+		RID texture_uniform_set;
+		Color blend_constant; // LCD subpixel rects only.
+	};
+
+	struct {
+		RID buffer;
+		uint32_t buffer_size = 0; // In instances.
+
+		LocalVector<PushConstant> draw_data;
+		LocalVector<RectBatchInstance> instances;
+		uint32_t next_instance = 0;
+
+		// Batch not drawn yet.
+		RID pipeline;
+		RID texture_uniform_set;
+		uint32_t from = 0;
+		uint32_t count = 0;
+	} rect_batch;
+
 	bool using_directional_lights = false;
 	RID default_canvas_texture;
 
@@ -423,7 +452,13 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	Color debug_redraw_color;
 	double debug_redraw_time = 1.0;
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
+	RID _get_canvas_texture_uniform_set(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false);
+	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false);
+	uint32_t _get_item_lights(const Item *p_item, Light *p_lights, uint32_t *r_lights);
+
+	void _prepare_rect_batch(RID p_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights);
+	void _add_to_rect_batch(RD::DrawListID p_draw_list, RID p_pipeline, RenderingMethod::RenderInfo *r_render_info);
+	void _flush_rect_batch(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info, bool p_batch_break = true);
 	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
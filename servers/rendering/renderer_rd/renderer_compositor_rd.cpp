@@ -293,6 +293,12 @@ RendererCompositorRD::RendererCompositorRD() {
 				}
 			}
 		}
+
+		// Read-only cache shipped with the project, used when a shader is not in the cache above.
+		String prebuilt_dir = GLOBAL_GET("rendering/shader_compiler/shader_cache/prebuilt_path");
+		if (!prebuilt_dir.is_empty() && DirAccess::exists(prebuilt_dir)) {
+			ShaderRD::set_shader_cache_prebuilt_dir(prebuilt_dir);
+		}
 	}
 
 	singleton = this;
@@ -329,4 +335,5 @@ RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(uniform_set_cache);
 	memdelete(framebuffer_cache);
 	ShaderRD::set_shader_cache_dir(String());
+	ShaderRD::set_shader_cache_prebuilt_dir(String());
 }
@@ -220,8 +220,8 @@ void ShaderRD::_build_variant_code(StringBuilder &builder, uint32_t p_variant, c
 	}
 }
 
-void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
-	uint32_t variant = group_to_variant_map[p_data->group][p_variant];
+void ShaderRD::_compile_variant(uint32_t p_variant, CompileData p_data) {
+	uint32_t variant = group_to_variant_map[p_data.group][p_variant];
 
 	if (!variants_enabled[variant]) {
 		return; // Variant is disabled, return.
@@ -238,7 +238,7 @@ void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 		//vertex stage
 
 		StringBuilder builder;
-		_build_variant_code(builder, variant, p_data->version, stage_templates[STAGE_TYPE_VERTEX]);
+		_build_variant_code(builder, variant, p_data.version, stage_templates[STAGE_TYPE_VERTEX]);
 
 		current_source = builder.as_string();
 		RD::ShaderStageSPIRVData stage;
@@ -256,7 +256,7 @@ void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 		current_stage = RD::SHADER_STAGE_FRAGMENT;
 
 		StringBuilder builder;
-		_build_variant_code(builder, variant, p_data->version, stage_templates[STAGE_TYPE_FRAGMENT]);
+		_build_variant_code(builder, variant, p_data.version, stage_templates[STAGE_TYPE_FRAGMENT]);
 
 		current_source = builder.as_string();
 		RD::ShaderStageSPIRVData stage;
@@ -274,7 +274,7 @@ void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 		current_stage = RD::SHADER_STAGE_COMPUTE;
 
 		StringBuilder builder;
-		_build_variant_code(builder, variant, p_data->version, stage_templates[STAGE_TYPE_COMPUTE]);
+		_build_variant_code(builder, variant, p_data.version, stage_templates[STAGE_TYPE_COMPUTE]);
 
 		current_source = builder.as_string();
 
@@ -306,8 +306,8 @@ void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 	{
 		MutexLock lock(variant_set_mutex);
 
-		p_data->version->variants[variant] = RD::get_singleton()->shader_create_from_bytecode(shader_data, p_data->version->variants[variant]);
-		p_data->version->variant_data[variant] = shader_data;
+		p_data.version->variants[variant] = RD::get_singleton()->shader_create_from_bytecode(shader_data, p_data.version->variants[variant]);
+		p_data.version->variant_data[variant] = shader_data;
 	}
 }
 
@@ -395,16 +395,22 @@ String ShaderRD::_version_get_sha1(Version *p_version) const {
 static const char *shader_file_header = "GDSC";
 static const uint32_t cache_file_version = 3;
 
-String ShaderRD::_get_cache_file_path(Version *p_version, int p_group) {
+String ShaderRD::_get_cache_file_path(const String &p_cache_dir, Version *p_version, int p_group) {
 	const String &sha1 = _version_get_sha1(p_version);
 	const String &api_safe_name = String(RD::get_singleton()->get_device_api_name()).validate_filename().to_lower();
-	const String &path = shader_cache_dir.path_join(name).path_join(group_sha256[p_group]).path_join(sha1) + "." + api_safe_name + ".cache";
+	const String &path = p_cache_dir.path_join(name).path_join(group_sha256[p_group]).path_join(sha1) + "." + api_safe_name + ".cache";
 	return path;
 }
 
 bool ShaderRD::_load_from_cache(Version *p_version, int p_group) {
-	const String &path = _get_cache_file_path(p_version, p_group);
-	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	Ref<FileAccess> f;
+	if (shader_cache_dir_valid) {
+		f = FileAccess::open(_get_cache_file_path(shader_cache_dir, p_version, p_group), FileAccess::READ);
+	}
+	if (f.is_null() && !shader_cache_prebuilt_dir.is_empty()) {
+		// Fall back to the read-only cache shipped with the project.
+		f = FileAccess::open(_get_cache_file_path(shader_cache_prebuilt_dir, p_version, p_group), FileAccess::READ);
+	}
 	if (f.is_null()) {
 		return false;
 	}
@@ -461,15 +467,13 @@ bool ShaderRD::_load_from_cache(Version *p_version, int p_group) {
 		}
 	}
 
-	memdelete_arr(p_version->variant_data); //clear stages
-	p_version->variant_data = nullptr;
 	p_version->valid = true;
 	return true;
 }
 
 void ShaderRD::_save_to_cache(Version *p_version, int p_group) {
 	ERR_FAIL_COND(!shader_cache_dir_valid);
-	const String &path = _get_cache_file_path(p_version, p_group);
+	const String &path = _get_cache_file_path(shader_cache_dir, p_version, p_group);
 	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
 	ERR_FAIL_COND(f.is_null());
 	f->store_buffer((const uint8_t *)shader_file_header, 4);
@@ -495,21 +499,20 @@ void ShaderRD::_allocate_placeholders(Version *p_version, int p_group) {
 	}
 }
 
-// Try to compile all variants for a given group.
+// Start compiling all variants for a given group, either by loading them from
+// the cache or by queuing them on the worker thread pool. Returns the group task
+// to wait on, or WorkerThreadPool::INVALID_TASK_ID if there is nothing to wait for.
 // Will skip variants that are disabled.
-void ShaderRD::_compile_version(Version *p_version, int p_group) {
+WorkerThreadPool::GroupID ShaderRD::_compile_version_start(Version *p_version, int p_group) {
 	if (!group_enabled[p_group]) {
-		return;
+		return WorkerThreadPool::INVALID_TASK_ID;
 	}
 
-	typedef Vector<uint8_t> ShaderStageData;
-	p_version->variant_data = memnew_arr(ShaderStageData, variant_defines.size());
-
 	p_version->dirty = false;
 
-	if (shader_cache_dir_valid) {
+	if (shader_cache_dir_valid || !shader_cache_prebuilt_dir.is_empty()) {
 		if (_load_from_cache(p_version, p_group)) {
-			return;
+			return WorkerThreadPool::INVALID_TASK_ID;
 		}
 	}
 
@@ -517,16 +520,12 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 	compile_data.version = p_version;
 	compile_data.group = p_group;
 
-#if 1
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, &compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-
-#else
-	for (uint32_t i = 0; i < group_to_variant_map[p_group].size(); i++) {
-		_compile_variant(i, &compile_data);
-	}
-#endif
+	return WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+}
 
+// Validate the variants of a group whose compilation task has completed and save
+// them to the cache. Returns false (and clears all variants) if any failed.
+bool ShaderRD::_compile_version_end(Version *p_version, int p_group) {
 	bool all_valid = true;
 
 	for (uint32_t i = 0; i < group_to_variant_map[p_group].size(); i++) {
@@ -551,21 +550,69 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 			}
 		}
 		memdelete_arr(p_version->variants);
-		if (p_version->variant_data) {
-			memdelete_arr(p_version->variant_data);
-		}
 		p_version->variants = nullptr;
-		p_version->variant_data = nullptr;
-		return;
+		p_version->valid = false;
+		return false;
 	} else if (shader_cache_dir_valid) {
 		// Save shader cache.
 		_save_to_cache(p_version, p_group);
 	}
 
+	p_version->valid = true;
+	return true;
+}
+
+// Compile a single group, used when a group is enabled at run time.
+void ShaderRD::_compile_version(Version *p_version, int p_group) {
+	if (!group_enabled[p_group] || p_version->variants == nullptr) {
+		return;
+	}
+
+	typedef Vector<uint8_t> ShaderStageData;
+	p_version->variant_data = memnew_arr(ShaderStageData, variant_defines.size());
+
+	WorkerThreadPool::GroupID group_task = _compile_version_start(p_version, p_group);
+	if (group_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		_compile_version_end(p_version, p_group);
+	}
+
 	memdelete_arr(p_version->variant_data); //clear stages
 	p_version->variant_data = nullptr;
+}
 
-	p_version->valid = true;
+// Compile all enabled groups of a version. The groups are queued together so
+// their variants are compiled concurrently instead of one group at a time.
+void ShaderRD::_compile_version_groups(Version *p_version) {
+	typedef Vector<uint8_t> ShaderStageData;
+	p_version->variant_data = memnew_arr(ShaderStageData, variant_defines.size());
+	p_version->dirty = false;
+
+	LocalVector<WorkerThreadPool::GroupID> group_tasks;
+	group_tasks.resize(group_enabled.size());
+	for (int i = 0; i < group_enabled.size(); i++) {
+		if (!group_enabled[i]) {
+			_allocate_placeholders(p_version, i);
+			group_tasks[i] = WorkerThreadPool::INVALID_TASK_ID;
+			continue;
+		}
+		group_tasks[i] = _compile_version_start(p_version, i);
+	}
+
+	for (uint32_t i = 0; i < group_tasks.size(); i++) {
+		if (group_tasks[i] != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_tasks[i]);
+		}
+	}
+
+	for (uint32_t i = 0; i < group_tasks.size(); i++) {
+		if (group_tasks[i] != WorkerThreadPool::INVALID_TASK_ID && !_compile_version_end(p_version, i)) {
+			break;
+		}
+	}
+
+	memdelete_arr(p_version->variant_data); //clear stages
+	p_version->variant_data = nullptr;
 }
 
 void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines) {
@@ -589,13 +636,7 @@ void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_
 	version->dirty = true;
 	if (version->initialize_needed) {
 		_initialize_version(version);
-		for (int i = 0; i < group_enabled.size(); i++) {
-			if (!group_enabled[i]) {
-				_allocate_placeholders(version, i);
-				continue;
-			}
-			_compile_version(version, i);
-		}
+		_compile_version_groups(version);
 		version->initialize_needed = false;
 	}
 }
@@ -622,13 +663,7 @@ void ShaderRD::version_set_compute_code(RID p_version, const HashMap<String, Str
 	version->dirty = true;
 	if (version->initialize_needed) {
 		_initialize_version(version);
-		for (int i = 0; i < group_enabled.size(); i++) {
-			if (!group_enabled[i]) {
-				_allocate_placeholders(version, i);
-				continue;
-			}
-			_compile_version(version, i);
-		}
+		_compile_version_groups(version);
 		version->initialize_needed = false;
 	}
 }
@@ -639,13 +674,7 @@ bool ShaderRD::version_is_valid(RID p_version) {
 
 	if (version->dirty) {
 		_initialize_version(version);
-		for (int i = 0; i < group_enabled.size(); i++) {
-			if (!group_enabled[i]) {
-				_allocate_placeholders(version, i);
-				continue;
-			}
-			_compile_version(version, i);
-		}
+		_compile_version_groups(version);
 	}
 
 	return version->valid;
@@ -731,7 +760,7 @@ void ShaderRD::initialize(const Vector<String> &p_variant_defines, const String
 		group_to_variant_map[0].push_back(i);
 	}
 
-	if (!shader_cache_dir.is_empty()) {
+	if (!shader_cache_dir.is_empty() || !shader_cache_prebuilt_dir.is_empty()) {
 		group_sha256.resize(1);
 		_initialize_cache();
 	}
@@ -754,6 +783,13 @@ void ShaderRD::_initialize_cache() {
 
 		group_sha256[E.key] = hash_build.as_string().sha256_text();
 
+		print_verbose("Shader '" + name + "' (group " + itos(E.key) + ") SHA256: " + group_sha256[E.key]);
+
+		if (shader_cache_dir.is_empty()) {
+			// Only the prebuilt cache is used, which is read-only.
+			continue;
+		}
+
 		Ref<DirAccess> d = DirAccess::open(shader_cache_dir);
 		ERR_FAIL_COND(d.is_null());
 		if (d->change_dir(name) != OK) {
@@ -771,8 +807,6 @@ void ShaderRD::_initialize_cache() {
 			ERR_FAIL_COND(err != OK);
 		}
 		shader_cache_dir_valid = true;
-
-		print_verbose("Shader '" + name + "' (group " + itos(E.key) + ") SHA256: " + group_sha256[E.key]);
 	}
 }
 
@@ -811,7 +845,7 @@ void ShaderRD::initialize(const Vector<VariantDefine> &p_variant_defines, const
 		}
 	}
 
-	if (!shader_cache_dir.is_empty()) {
+	if (!shader_cache_dir.is_empty() || !shader_cache_prebuilt_dir.is_empty()) {
 		group_sha256.resize(max_group_id + 1);
 		_initialize_cache();
 	}
@@ -821,6 +855,10 @@ void ShaderRD::set_shader_cache_dir(const String &p_dir) {
 	shader_cache_dir = p_dir;
 }
 
+void ShaderRD::set_shader_cache_prebuilt_dir(const String &p_dir) {
+	shader_cache_prebuilt_dir = p_dir;
+}
+
 void ShaderRD::set_shader_cache_save_compressed(bool p_enable) {
 	shader_cache_save_compressed = p_enable;
 }
@@ -834,6 +872,7 @@ void ShaderRD::set_shader_cache_save_debug(bool p_enable) {
 }
 
 String ShaderRD::shader_cache_dir;
+String ShaderRD::shader_cache_prebuilt_dir;
 bool ShaderRD::shader_cache_save_compressed = true;
 bool ShaderRD::shader_cache_save_compressed_zstd = true;
 bool ShaderRD::shader_cache_save_debug = true;
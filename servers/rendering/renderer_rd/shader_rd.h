@@ -31,6 +31,7 @@
 #ifndef SHADER_RD_H
 #define SHADER_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
@@ -85,11 +86,14 @@ private:
 		int group = 0;
 	};
 
-	void _compile_variant(uint32_t p_variant, const CompileData *p_data);
+	void _compile_variant(uint32_t p_variant, CompileData p_data);
 
 	void _initialize_version(Version *p_version);
 	void _clear_version(Version *p_version);
+	WorkerThreadPool::GroupID _compile_version_start(Version *p_version, int p_group);
+	bool _compile_version_end(Version *p_version, int p_group);
 	void _compile_version(Version *p_version, int p_group);
+	void _compile_version_groups(Version *p_version);
 	void _allocate_placeholders(Version *p_version, int p_group);
 
 	RID_Owner<Version> version_owner;
@@ -123,6 +127,7 @@ private:
 	LocalVector<String> group_sha256;
 
 	static String shader_cache_dir;
+	static String shader_cache_prebuilt_dir;
 	static bool shader_cache_cleanup_on_start;
 	static bool shader_cache_save_compressed;
 	static bool shader_cache_save_compressed_zstd;
@@ -143,7 +148,7 @@ private:
 	void _add_stage(const char *p_code, StageType p_stage_type);
 
 	String _version_get_sha1(Version *p_version) const;
-	String _get_cache_file_path(Version *p_version, int p_group);
+	String _get_cache_file_path(const String &p_cache_dir, Version *p_version, int p_group);
 	bool _load_from_cache(Version *p_version, int p_group);
 	void _save_to_cache(Version *p_version, int p_group);
 	void _initialize_cache();
@@ -167,13 +172,7 @@ public:
 
 		if (version->dirty) {
 			_initialize_version(version);
-			for (int i = 0; i < group_enabled.size(); i++) {
-				if (!group_enabled[i]) {
-					_allocate_placeholders(version, i);
-					continue;
-				}
-				_compile_version(version, i);
-			}
+			_compile_version_groups(version);
 		}
 
 		if (!version->valid) {
@@ -196,6 +195,7 @@ public:
 	bool is_group_enabled(int p_group) const;
 
 	static void set_shader_cache_dir(const String &p_dir);
+	static void set_shader_cache_prebuilt_dir(const String &p_dir);
 	static void set_shader_cache_save_compressed(bool p_enable);
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
 	static void set_shader_cache_save_debug(bool p_enable);
@@ -34,6 +34,10 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_RECT_BATCH
+layout(location = 4) flat out uint rect_batch_index;
+#endif
+
 #ifdef MATERIAL_UNIFORMS_USED
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 
@@ -51,6 +55,9 @@ vec3 srgb_to_linear(vec3 color) {
 #endif
 
 void main() {
+#ifdef USE_RECT_BATCH
+	rect_batch_index = push_data.batch_offset + uint(gl_InstanceIndex);
+#endif
 	vec4 instance_custom = vec4(0.0);
 #if defined(CUSTOM0_USED)
 	vec4 custom0 = vec4(0.0);
@@ -258,6 +265,10 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_RECT_BATCH
+layout(location = 4) flat in uint rect_batch_index;
+#endif
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef MATERIAL_UNIFORMS_USED
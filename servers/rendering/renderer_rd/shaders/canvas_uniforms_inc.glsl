@@ -30,6 +30,11 @@
 #define FLAGS_FLIP_H (1 << 30)
 #define FLAGS_FLIP_V (1 << 31)
 
+#if !defined(USE_PRIMITIVE) && !defined(USE_ATTRIBUTES)
+// Rects and nine-patches are batched, their draw data is read from the rect batch buffer instead.
+#define USE_RECT_BATCH
+#endif
+
 // Push Constant
 
 layout(push_constant, std430) uniform DrawData {
@@ -47,13 +52,18 @@ layout(push_constant, std430) uniform DrawData {
 	vec4 ninepatch_margins;
 	vec4 dst_rect; //for built-in rect and UV
 	vec4 src_rect;
-	vec2 pad;
+	uint batch_offset;
+	uint pad;
 
 #endif
 	vec2 color_texture_pixel_size;
 	uint lights[4];
 }
+#ifdef USE_RECT_BATCH
+push_data;
+#else
 draw_data;
+#endif
 
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
@@ -127,6 +137,31 @@ layout(set = 0, binding = 5) uniform sampler shadow_sampler;
 layout(set = 0, binding = 6) uniform texture2D color_buffer;
 layout(set = 0, binding = 7) uniform texture2D sdf_texture;
 
+struct RectDrawData {
+	vec2 world_x;
+	vec2 world_y;
+	vec2 world_ofs;
+	uint flags;
+	uint specular_shininess;
+	vec4 modulation;
+	vec4 ninepatch_margins;
+	vec4 dst_rect;
+	vec4 src_rect;
+	uint batch_offset;
+	uint pad;
+	vec2 color_texture_pixel_size;
+	uint lights[4];
+};
+
+layout(set = 0, binding = 8, std430) restrict readonly buffer RectBatch {
+	RectDrawData data[];
+}
+rect_batch;
+
+#ifdef USE_RECT_BATCH
+#define draw_data rect_batch.data[rect_batch_index]
+#endif
+
 #include "samplers_inc.glsl"
 
 layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalShaderUniformData {
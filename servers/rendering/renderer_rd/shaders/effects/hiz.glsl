@@ -0,0 +1,56 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+#ifdef MODE_FROM_DEPTH
+layout(set = 0, binding = 0) uniform sampler2D source_depth;
+#else
+layout(r32f, set = 0, binding = 0) uniform restrict readonly image2D source_depth;
+#endif
+
+layout(r32f, set = 1, binding = 0) uniform restrict writeonly image2D dest_depth;
+
+layout(push_constant, std430) uniform Params {
+	ivec2 source_size;
+	ivec2 dest_size;
+}
+params;
+
+float read_depth(ivec2 p_pos) {
+#ifdef MODE_FROM_DEPTH
+	return texelFetch(source_depth, p_pos, 0).r;
+#else
+	return imageLoad(source_depth, p_pos).r;
+#endif
+}
+
+void main() {
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.dest_size))) {
+		return;
+	}
+
+	// Keep the farthest depth of the footprint. Odd sizes make the footprint of the last
+	// texel three texels wide, so always cover up to three texels to stay conservative.
+	ivec2 base = pos * 2;
+	ivec2 last = min(base + 2, params.source_size - 1);
+	if (pos.x < params.dest_size.x - 1) {
+		last.x = min(last.x, base.x + 1);
+	}
+	if (pos.y < params.dest_size.y - 1) {
+		last.y = min(last.y, base.y + 1);
+	}
+
+	float depth = 0.0;
+	for (int y = base.y; y <= last.y; y++) {
+		for (int x = base.x; x <= last.x; x++) {
+			depth = max(depth, read_depth(ivec2(x, y)));
+		}
+	}
+
+	imageStore(dest_depth, pos, vec4(depth));
+}
@@ -641,10 +641,13 @@ void main() {
 
 /* Specialization Constants (Toggles) */
 
-layout(constant_id = 0) const bool sc_use_forward_gi = false;
-layout(constant_id = 1) const bool sc_use_light_projector = false;
-layout(constant_id = 2) const bool sc_use_light_soft_shadows = false;
-layout(constant_id = 3) const bool sc_use_directional_soft_shadows = false;
+layout(constant_id = 0) const bool sc_use_forward_gi_specialized = false;
+layout(constant_id = 1) const bool sc_use_light_projector_specialized = false;
+layout(constant_id = 2) const bool sc_use_light_soft_shadows_specialized = false;
+layout(constant_id = 3) const bool sc_use_directional_soft_shadows_specialized = false;
+
+// Used while the specialized pipeline is compiled, the toggles are read from the draw call instead.
+layout(constant_id = 13) const bool sc_use_ubershader = false;
 
 /* Specialization Constants (Values) */
 
@@ -663,6 +666,11 @@ const float sc_luminance_multiplier = 1.0;
 
 #include "scene_forward_clustered_inc.glsl"
 
+#define sc_use_forward_gi (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 0)) : sc_use_forward_gi_specialized)
+#define sc_use_light_projector (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 1)) : sc_use_light_projector_specialized)
+#define sc_use_light_soft_shadows (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 2)) : sc_use_light_soft_shadows_specialized)
+#define sc_use_directional_soft_shadows (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 3)) : sc_use_directional_soft_shadows_specialized)
+
 /* Varyings */
 
 layout(location = 0) in vec3 vertex_interp;
@@ -2447,10 +2455,8 @@ void fragment_shader(in SceneData scene_data) {
 	vec2 position_clip = (screen_position.xy / screen_position.w) - scene_data.taa_jitter;
 	vec2 prev_position_clip = (prev_screen_position.xy / prev_screen_position.w) - scene_data_block.prev_data.taa_jitter;
 
-	vec2 position_uv = position_clip * vec2(0.5, 0.5);
-	vec2 prev_position_uv = prev_position_clip * vec2(0.5, 0.5);
-
-	motion_vector = prev_position_uv - position_uv;
+	// Scaled to UV space (previous - current), or to NDC space (current - previous) when submitted for XR reprojection.
+	motion_vector = (prev_position_clip - position_clip) * scene_data.motion_vector_scale;
 #endif
 }
 
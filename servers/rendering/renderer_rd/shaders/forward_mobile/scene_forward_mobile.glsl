@@ -501,11 +501,14 @@ void main() {
 
 #if !defined(MODE_RENDER_DEPTH)
 
+// Used while the specialized pipeline is compiled, the per-instance toggles are read from the draw call instead.
+layout(constant_id = 17) const bool sc_use_ubershader = false;
+
 #if !defined(MODE_UNSHADED)
 
-layout(constant_id = 0) const bool sc_use_light_projector = false;
-layout(constant_id = 1) const bool sc_use_light_soft_shadows = false;
-layout(constant_id = 2) const bool sc_use_directional_soft_shadows = false;
+layout(constant_id = 0) const bool sc_use_light_projector_specialized = false;
+layout(constant_id = 1) const bool sc_use_light_soft_shadows_specialized = false;
+layout(constant_id = 2) const bool sc_use_directional_soft_shadows_specialized = false;
 
 layout(constant_id = 3) const uint sc_soft_shadow_samples = 4;
 layout(constant_id = 4) const uint sc_penumbra_shadow_samples = 4;
@@ -515,15 +518,15 @@ layout(constant_id = 6) const uint sc_directional_penumbra_shadow_samples = 4;
 
 layout(constant_id = 8) const bool sc_projector_use_mipmaps = true;
 
-layout(constant_id = 9) const bool sc_disable_omni_lights = false;
-layout(constant_id = 10) const bool sc_disable_spot_lights = false;
-layout(constant_id = 11) const bool sc_disable_reflection_probes = false;
+layout(constant_id = 9) const bool sc_disable_omni_lights_specialized = false;
+layout(constant_id = 10) const bool sc_disable_spot_lights_specialized = false;
+layout(constant_id = 11) const bool sc_disable_reflection_probes_specialized = false;
 layout(constant_id = 12) const bool sc_disable_directional_lights = false;
 
 #endif //!MODE_UNSHADED
 
 layout(constant_id = 7) const bool sc_decal_use_mipmaps = true;
-layout(constant_id = 13) const bool sc_disable_decals = false;
+layout(constant_id = 13) const bool sc_disable_decals_specialized = false;
 layout(constant_id = 14) const bool sc_disable_fog = false;
 layout(constant_id = 16) const bool sc_use_depth_fog = false;
 
@@ -534,6 +537,24 @@ layout(constant_id = 15) const float sc_luminance_multiplier = 2.0;
 /* Include our forward mobile UBOs definitions etc. */
 #include "scene_forward_mobile_inc.glsl"
 
+#if !defined(MODE_RENDER_DEPTH)
+
+#if !defined(MODE_UNSHADED)
+
+#define sc_use_light_projector (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 0)) : sc_use_light_projector_specialized)
+#define sc_use_light_soft_shadows (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 1)) : sc_use_light_soft_shadows_specialized)
+#define sc_use_directional_soft_shadows (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 2)) : sc_use_directional_soft_shadows_specialized)
+
+#define sc_disable_omni_lights (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 9)) : sc_disable_omni_lights_specialized)
+#define sc_disable_spot_lights (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 10)) : sc_disable_spot_lights_specialized)
+#define sc_disable_reflection_probes (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 11)) : sc_disable_reflection_probes_specialized)
+
+#endif //!MODE_UNSHADED
+
+#define sc_disable_decals (sc_use_ubershader ? bool(draw_call.ubershader_flags & (1 << 13)) : sc_disable_decals_specialized)
+
+#endif //!MODE_RENDER_DEPTH
+
 /* Varyings */
 
 layout(location = 0) highp in vec3 vertex_interp;
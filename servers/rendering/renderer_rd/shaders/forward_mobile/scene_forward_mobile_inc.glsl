@@ -19,7 +19,7 @@
 layout(push_constant, std430) uniform DrawCall {
 	vec2 uv_offset;
 	uint instance_index;
-	uint pad;
+	uint ubershader_flags;
 }
 draw_call;
 
@@ -0,0 +1,147 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0, std430) buffer restrict readonly SrcInstances {
+	vec4 data[];
+}
+src_instances;
+
+layout(set = 0, binding = 1, std430) buffer restrict writeonly DstInstances {
+	vec4 data[];
+}
+dst_instances;
+
+// Visible instance counter and draw argument count, padded to four uints,
+// followed by the indirect draw arguments (five uints each) of every surface LOD.
+layout(set = 0, binding = 2, std430) buffer restrict DrawArgs {
+	uint data[];
+}
+draw_args;
+
+// Max depth pyramid of the occluders already in the depth buffer.
+layout(set = 1, binding = 0) uniform sampler2D hiz;
+
+layout(push_constant, std430) uniform Params {
+	mat4 clip_transform; // From multimesh space to clip space, with depth correction.
+
+	vec3 aabb_center; // Mesh AABB.
+	uint instance_count;
+
+	vec3 aabb_extents;
+	uint stride; // In vec4s.
+
+	ivec2 hiz_size;
+	uint hiz_mip_count; // No occlusion test when zero.
+	uint pad;
+
+	vec3 camera_position; // In multimesh space.
+	float max_distance_squared; // No distance test when zero.
+}
+params;
+
+bool is_occluded(vec3 p_center, vec3 p_extents) {
+	vec3 rect_min = vec3(1.0);
+	vec3 rect_max = vec3(-1.0);
+	for (uint i = 0; i < 8; i++) {
+		vec3 corner = p_center + p_extents * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = params.clip_transform * vec4(corner, 1.0);
+		if (clip.w <= 0.0) {
+			return false; // Crosses the camera plane.
+		}
+		vec3 ndc = clip.xyz / clip.w;
+		rect_min = min(rect_min, ndc);
+		rect_max = max(rect_max, ndc);
+	}
+
+	vec2 uv_min = clamp(rect_min.xy * 0.5 + 0.5, 0.0, 1.0);
+	vec2 uv_max = clamp(rect_max.xy * 0.5 + 0.5, 0.0, 1.0);
+
+	// Pick the level where the rectangle covers at most two texels on each axis, so four fetches cover it.
+	vec2 rect_size = (uv_max - uv_min) * vec2(params.hiz_size);
+	int lod = int(ceil(log2(max(max(rect_size.x, rect_size.y), 1.0))));
+	lod = clamp(lod, 0, int(params.hiz_mip_count) - 1);
+
+	ivec2 lod_size = max(params.hiz_size >> lod, ivec2(1));
+	ivec2 texel_min = clamp(ivec2(uv_min * vec2(lod_size)), ivec2(0), lod_size - 1);
+	ivec2 texel_max = clamp(ivec2(uv_max * vec2(lod_size)), ivec2(0), lod_size - 1);
+
+	float max_depth = texelFetch(hiz, texel_min, lod).r;
+	max_depth = max(max_depth, texelFetch(hiz, ivec2(texel_max.x, texel_min.y), lod).r);
+	max_depth = max(max_depth, texelFetch(hiz, ivec2(texel_min.x, texel_max.y), lod).r);
+	max_depth = max(max_depth, texelFetch(hiz, texel_max, lod).r);
+
+	return rect_min.z > max_depth;
+}
+
+shared uint group_visible;
+shared uint group_base;
+
+void main() {
+	if (gl_LocalInvocationIndex == 0) {
+		group_visible = 0;
+	}
+	barrier();
+
+	uint index = gl_GlobalInvocationID.x;
+	bool visible = false;
+	uint local_slot = 0;
+
+	if (index < params.instance_count) {
+		uint src = index * params.stride;
+		vec4 row0 = src_instances.data[src + 0];
+		vec4 row1 = src_instances.data[src + 1];
+		vec4 row2 = src_instances.data[src + 2];
+
+		vec3 center = vec3(dot(row0.xyz, params.aabb_center) + row0.w, dot(row1.xyz, params.aabb_center) + row1.w, dot(row2.xyz, params.aabb_center) + row2.w);
+		vec3 extents = vec3(dot(abs(row0.xyz), params.aabb_extents), dot(abs(row1.xyz), params.aabb_extents), dot(abs(row2.xyz), params.aabb_extents));
+
+		// Frustum planes taken from the rows of the clip transform, normals pointing inwards.
+		mat4 clip_rows = transpose(params.clip_transform);
+		vec4 planes[6] = vec4[](clip_rows[3] + clip_rows[0], clip_rows[3] - clip_rows[0], clip_rows[3] + clip_rows[1], clip_rows[3] - clip_rows[1], clip_rows[2], clip_rows[3] - clip_rows[2]);
+
+		visible = true;
+		if (params.max_distance_squared > 0.0) {
+			vec3 to_camera = center - params.camera_position;
+			visible = dot(to_camera, to_camera) <= params.max_distance_squared;
+		}
+
+		for (uint i = 0; visible && i < 6; i++) {
+			if (dot(planes[i].xyz, center) + planes[i].w < -dot(abs(planes[i].xyz), extents)) {
+				visible = false;
+				break;
+			}
+		}
+
+		if (visible && params.hiz_mip_count > 0) {
+			visible = !is_occluded(center, extents);
+		}
+
+		if (visible) {
+			local_slot = atomicAdd(group_visible, 1);
+		}
+	}
+	barrier();
+
+	// Reserve room for the whole group at once so contention on the counters stays per group rather than per instance.
+	if (gl_LocalInvocationIndex == 0 && group_visible > 0) {
+		group_base = atomicAdd(draw_args.data[0], group_visible);
+		uint args_count = draw_args.data[1];
+		for (uint i = 0; i < args_count; i++) {
+			atomicAdd(draw_args.data[4 + i * 5 + 1], group_visible);
+		}
+	}
+	barrier();
+
+	if (visible) {
+		uint src = index * params.stride;
+		uint dst = (group_base + local_slot) * params.stride;
+		for (uint i = 0; i < params.stride; i++) {
+			dst_instances.data[dst + i] = src_instances.data[src + i];
+		}
+	}
+}
@@ -55,7 +55,7 @@ struct SceneData {
 	highp float fog_height_density;
 
 	highp float fog_depth_curve;
-	highp float pad;
+	highp float motion_vector_scale;
 	highp float fog_depth_begin;
 
 	mediump vec3 fog_light_color;
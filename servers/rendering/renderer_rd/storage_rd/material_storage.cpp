@@ -1486,6 +1486,7 @@ void MaterialStorage::global_shader_parameter_add(const StringName &p_name, RS::
 	}
 
 	global_shader_uniforms.variables[p_name] = gv;
+	ShaderCompiler::invalidate_caches();
 }
 
 void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
@@ -1502,6 +1503,7 @@ void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
 	}
 
 	global_shader_uniforms.variables.erase(p_name);
+	ShaderCompiler::invalidate_caches();
 }
 
 Vector<StringName> MaterialStorage::global_shader_parameter_get_list() const {
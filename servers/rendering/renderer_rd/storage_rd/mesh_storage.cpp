@@ -30,6 +30,11 @@
 
 #include "mesh_storage.h"
 
+#include "core/config/project_settings.h"
+#include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
 using namespace RendererRD;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -157,6 +162,11 @@ MeshStorage::MeshStorage() {
 		}
 	}
 
+	lod_streaming_enabled = GLOBAL_GET("rendering/mesh_lod/streaming/enabled");
+	lod_streaming_budget = uint64_t(MAX(int(GLOBAL_GET("rendering/mesh_lod/streaming/memory_budget_mb")), 0)) * 1024 * 1024;
+
+	geometry_arena_block_size = uint64_t(MAX(int(GLOBAL_GET("rendering/limits/geometry_arenas/block_size_kb")), 0)) * 1024;
+
 	{
 		Vector<String> skeleton_modes;
 		skeleton_modes.push_back("\n#define MODE_2D\n");
@@ -181,6 +191,20 @@ MeshStorage::MeshStorage() {
 			skeleton_shader.default_skeleton_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, skeleton_shader.version_shader[0], SkeletonShader::UNIFORM_SET_SKELETON);
 		}
 	}
+
+	multimesh_gpu_culling_enabled = GLOBAL_GET("rendering/multimesh/gpu_culling/enabled");
+	multimesh_gpu_culling_min_instances = MAX(int(GLOBAL_GET("rendering/multimesh/gpu_culling/min_instances")), 1);
+	multimesh_gpu_culling_use_occlusion = GLOBAL_GET("rendering/multimesh/gpu_culling/use_occlusion");
+
+	{
+		Vector<String> cull_modes;
+		cull_modes.push_back("");
+
+		multimesh_cull_shader.shader.initialize(cull_modes);
+		multimesh_cull_shader.version = multimesh_cull_shader.shader.version_create();
+		multimesh_cull_shader.version_shader = multimesh_cull_shader.shader.version_get_shader(multimesh_cull_shader.version, 0);
+		multimesh_cull_shader.pipeline = RD::get_singleton()->compute_pipeline_create(multimesh_cull_shader.version_shader);
+	}
 }
 
 MeshStorage::~MeshStorage() {
@@ -189,7 +213,16 @@ MeshStorage::~MeshStorage() {
 		RD::get_singleton()->free(mesh_default_rd_buffers[i]);
 	}
 
+	for (int i = 0; i < GEOMETRY_ARENA_MAX; i++) {
+		for (const GeometryArena::Block &block : geometry_arenas[i].blocks) {
+			if (block.buffer.is_valid()) {
+				RD::get_singleton()->free(block.buffer);
+			}
+		}
+	}
+
 	skeleton_shader.shader.version_free(skeleton_shader.version);
+	multimesh_cull_shader.shader.version_free(multimesh_cull_shader.version);
 
 	RD::get_singleton()->free(default_rd_storage_buffer);
 
@@ -384,16 +417,32 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 			Vector<uint8_t> new_vertex_data;
 			new_vertex_data.resize_zeroed(new_surface.vertex_data.size() + sizeof(uint16_t) * 2);
 			memcpy(new_vertex_data.ptrw(), new_surface.vertex_data.ptr(), new_surface.vertex_data.size());
-			s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(new_vertex_data.size(), new_vertex_data, use_as_storage);
+			if (!use_as_storage) {
+				s->vertex_buffer = _geometry_arena_allocate(GEOMETRY_ARENA_VERTEX, new_vertex_data, s->vertex_range);
+			}
+			if (s->vertex_buffer.is_null()) {
+				s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(new_vertex_data.size(), new_vertex_data, use_as_storage);
+			}
 			s->vertex_buffer_size = new_vertex_data.size();
 		} else {
-			s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(new_surface.vertex_data.size(), new_surface.vertex_data, use_as_storage);
+			if (!use_as_storage) {
+				s->vertex_buffer = _geometry_arena_allocate(GEOMETRY_ARENA_VERTEX, new_surface.vertex_data, s->vertex_range);
+			}
+			if (s->vertex_buffer.is_null()) {
+				s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(new_surface.vertex_data.size(), new_surface.vertex_data, use_as_storage);
+			}
 			s->vertex_buffer_size = new_surface.vertex_data.size();
 		}
 	}
 
 	if (new_surface.attribute_data.size()) {
-		s->attribute_buffer = RD::get_singleton()->vertex_buffer_create(new_surface.attribute_data.size(), new_surface.attribute_data);
+		if (!use_as_storage) {
+			s->attribute_buffer = _geometry_arena_allocate(GEOMETRY_ARENA_VERTEX, new_surface.attribute_data, s->attribute_range);
+		}
+		if (s->attribute_buffer.is_null()) {
+			s->attribute_buffer = RD::get_singleton()->vertex_buffer_create(new_surface.attribute_data.size(), new_surface.attribute_data);
+		}
+		s->attribute_buffer_size = new_surface.attribute_data.size();
 	}
 	if (new_surface.skin_data.size()) {
 		s->skin_buffer = RD::get_singleton()->vertex_buffer_create(new_surface.skin_data.size(), new_surface.skin_data, use_as_storage);
@@ -409,21 +458,59 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 	if (new_surface.index_count) {
 		bool is_index_16 = new_surface.vertex_count <= 65536 && new_surface.vertex_count > 0;
 
-		s->index_buffer = RD::get_singleton()->index_buffer_create(new_surface.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.index_data, false);
 		s->index_count = new_surface.index_count;
-		s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+		s->index_16 = is_index_16;
 		if (new_surface.lods.size()) {
 			s->lods = memnew_arr(Mesh::Surface::LOD, new_surface.lods.size());
 			s->lod_count = new_surface.lods.size();
 
 			for (int i = 0; i < new_surface.lods.size(); i++) {
 				uint32_t indices = new_surface.lods[i].index_data.size() / (is_index_16 ? 2 : 4);
-				s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.lods[i].index_data);
-				s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
 				s->lods[i].edge_length = new_surface.lods[i].edge_length;
 				s->lods[i].index_count = indices;
 			}
 		}
+
+		if (lod_streaming_enabled && s->lod_count) {
+			// Only the coarsest level is uploaded now, finer ones stream in when drawing selects them.
+			s->lod_streamed = true;
+			s->lod_resident = s->lod_count;
+			s->lod_index_data.resize(s->lod_count + 1);
+			s->lod_index_data[0] = new_surface.index_data;
+			for (uint32_t i = 1; i <= s->lod_count; i++) {
+				s->lod_index_data[i] = new_surface.lods[i - 1].index_data;
+			}
+			lod_streamed_surfaces.add(&s->lod_stream_element);
+			_lod_stream_in(s, s->lod_count);
+		} else if (!use_as_storage && geometry_arena_block_size > 0) {
+			// Index arrays address the shared buffer with an offset in indices, ranges are aligned so it's always exact.
+			GeometryArenaType arena = is_index_16 ? GEOMETRY_ARENA_INDEX_16 : GEOMETRY_ARENA_INDEX_32;
+			uint32_t index_size = is_index_16 ? 2 : 4;
+
+			RID index_buffer = _geometry_arena_allocate(arena, new_surface.index_data, s->index_range);
+			if (index_buffer.is_valid()) {
+				s->index_array = RD::get_singleton()->index_array_create(index_buffer, s->index_range.offset / index_size, s->index_count);
+			} else {
+				s->index_buffer = RD::get_singleton()->index_buffer_create(new_surface.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.index_data, false);
+				s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+			}
+			for (uint32_t i = 0; i < s->lod_count; i++) {
+				index_buffer = _geometry_arena_allocate(arena, new_surface.lods[i].index_data, s->lods[i].index_range);
+				if (index_buffer.is_valid()) {
+					s->lods[i].index_array = RD::get_singleton()->index_array_create(index_buffer, s->lods[i].index_range.offset / index_size, s->lods[i].index_count);
+				} else {
+					s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(s->lods[i].index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.lods[i].index_data);
+					s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, s->lods[i].index_count);
+				}
+			}
+		} else {
+			s->index_buffer = RD::get_singleton()->index_buffer_create(new_surface.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.index_data, false);
+			s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+			for (uint32_t i = 0; i < s->lod_count; i++) {
+				s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(s->lods[i].index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.lods[i].index_data);
+				s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, s->lods[i].index_count);
+			}
+		}
 	}
 
 	ERR_FAIL_COND_MSG(!new_surface.index_count && !new_surface.vertex_count, "Meshes must contain a vertex array, an index array, or both");
@@ -530,11 +617,14 @@ void MeshStorage::mesh_surface_update_vertex_region(RID p_mesh, int p_surface, i
 	ERR_FAIL_NULL(mesh);
 	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_surface, mesh->surface_count);
 	ERR_FAIL_COND(p_data.is_empty());
-	ERR_FAIL_COND(mesh->surfaces[p_surface]->vertex_buffer.is_null());
+	Mesh::Surface *s = mesh->surfaces[p_surface];
+	ERR_FAIL_COND(s->vertex_buffer.is_null());
 	uint64_t data_size = p_data.size();
+	// The buffer may be shared with other surfaces, so writing past this surface's data is not allowed.
+	ERR_FAIL_COND(p_offset < 0 || p_offset + data_size > s->vertex_buffer_size);
 	const uint8_t *r = p_data.ptr();
 
-	RD::get_singleton()->buffer_update(mesh->surfaces[p_surface]->vertex_buffer, p_offset, data_size, r);
+	RD::get_singleton()->buffer_update(s->vertex_buffer, s->vertex_range.offset + p_offset, data_size, r);
 }
 
 void MeshStorage::mesh_surface_update_attribute_region(RID p_mesh, int p_surface, int p_offset, const Vector<uint8_t> &p_data) {
@@ -542,11 +632,13 @@ void MeshStorage::mesh_surface_update_attribute_region(RID p_mesh, int p_surface
 	ERR_FAIL_NULL(mesh);
 	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_surface, mesh->surface_count);
 	ERR_FAIL_COND(p_data.is_empty());
-	ERR_FAIL_COND(mesh->surfaces[p_surface]->attribute_buffer.is_null());
+	Mesh::Surface *s = mesh->surfaces[p_surface];
+	ERR_FAIL_COND(s->attribute_buffer.is_null());
 	uint64_t data_size = p_data.size();
+	ERR_FAIL_COND(p_offset < 0 || p_offset + data_size > s->attribute_buffer_size);
 	const uint8_t *r = p_data.ptr();
 
-	RD::get_singleton()->buffer_update(mesh->surfaces[p_surface]->attribute_buffer, p_offset, data_size, r);
+	RD::get_singleton()->buffer_update(s->attribute_buffer, s->attribute_range.offset + p_offset, data_size, r);
 }
 
 void MeshStorage::mesh_surface_update_skin_region(RID p_mesh, int p_surface, int p_offset, const Vector<uint8_t> &p_data) {
@@ -589,14 +681,14 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	RS::SurfaceData sd;
 	sd.format = s.format;
 	if (s.vertex_buffer.is_valid()) {
-		sd.vertex_data = RD::get_singleton()->buffer_get_data(s.vertex_buffer);
+		sd.vertex_data = RD::get_singleton()->buffer_get_data(s.vertex_buffer, s.vertex_range.offset, s.vertex_buffer_size);
 		// When using an uncompressed buffer with normals, but without tangents, we have to trim the padding.
 		if (!(s.format & RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES) && (s.format & RS::ARRAY_FORMAT_NORMAL) && !(s.format & RS::ARRAY_FORMAT_TANGENT)) {
 			sd.vertex_data.resize(sd.vertex_data.size() - sizeof(uint16_t) * 2);
 		}
 	}
 	if (s.attribute_buffer.is_valid()) {
-		sd.attribute_data = RD::get_singleton()->buffer_get_data(s.attribute_buffer);
+		sd.attribute_data = RD::get_singleton()->buffer_get_data(s.attribute_buffer, s.attribute_range.offset, s.attribute_buffer_size);
 	}
 	if (s.skin_buffer.is_valid()) {
 		sd.skin_data = RD::get_singleton()->buffer_get_data(s.skin_buffer);
@@ -605,15 +697,29 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	sd.index_count = s.index_count;
 	sd.primitive = s.primitive;
 
+	const GeometryArena &index_arena = geometry_arenas[s.index_16 ? GEOMETRY_ARENA_INDEX_16 : GEOMETRY_ARENA_INDEX_32];
+	const uint32_t index_size = s.index_16 ? 2 : 4;
 	if (sd.index_count) {
-		sd.index_data = RD::get_singleton()->buffer_get_data(s.index_buffer);
+		if (s.lod_streamed) {
+			sd.index_data = s.lod_index_data[0];
+		} else if (s.index_range.is_shared()) {
+			sd.index_data = RD::get_singleton()->buffer_get_data(index_arena.blocks[s.index_range.block].buffer, s.index_range.offset, s.index_count * index_size);
+		} else {
+			sd.index_data = RD::get_singleton()->buffer_get_data(s.index_buffer);
+		}
 	}
 	sd.aabb = s.aabb;
 	sd.uv_scale = s.uv_scale;
 	for (uint32_t i = 0; i < s.lod_count; i++) {
 		RS::SurfaceData::LOD lod;
 		lod.edge_length = s.lods[i].edge_length;
-		lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		if (s.lod_streamed) {
+			lod.index_data = s.lod_index_data[i + 1];
+		} else if (s.lods[i].index_range.is_shared()) {
+			lod.index_data = RD::get_singleton()->buffer_get_data(index_arena.blocks[s.lods[i].index_range.block].buffer, s.lods[i].index_range.offset, s.lods[i].index_count * index_size);
+		} else {
+			lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		}
 		sd.lods.push_back(lod);
 	}
 
@@ -812,10 +918,20 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 
 	for (uint32_t i = 0; i < mesh->surface_count; i++) {
 		Mesh::Surface &s = *mesh->surfaces[i];
-		if (s.vertex_buffer.is_valid()) {
+		if (s.vertex_range.is_shared() || s.attribute_range.is_shared()) {
+			// Shared buffers outlive the surface, so its arrays are not freed as a dependency.
+			for (uint32_t j = 0; j < s.version_count; j++) {
+				RD::get_singleton()->free(s.versions[j].vertex_array);
+			}
+		}
+		if (s.vertex_range.is_shared()) {
+			_geometry_arena_free(GEOMETRY_ARENA_VERTEX, s.vertex_range);
+		} else if (s.vertex_buffer.is_valid()) {
 			RD::get_singleton()->free(s.vertex_buffer); //clears arrays as dependency automatically, including all versions
 		}
-		if (s.attribute_buffer.is_valid()) {
+		if (s.attribute_range.is_shared()) {
+			_geometry_arena_free(GEOMETRY_ARENA_VERTEX, s.attribute_range);
+		} else if (s.attribute_buffer.is_valid()) {
 			RD::get_singleton()->free(s.attribute_buffer);
 		}
 		if (s.skin_buffer.is_valid()) {
@@ -825,13 +941,29 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 			memfree(s.versions); //reallocs, so free with memfree.
 		}
 
-		if (s.index_buffer.is_valid()) {
+		if (s.lod_streamed) {
+			for (uint32_t j = s.lod_resident; j <= s.lod_count; j++) {
+				_lod_stream_out(&s, j);
+			}
+			lod_streamed_surfaces.remove(&s.lod_stream_element);
+		}
+
+		GeometryArenaType index_arena = s.index_16 ? GEOMETRY_ARENA_INDEX_16 : GEOMETRY_ARENA_INDEX_32;
+		if (s.index_range.is_shared()) {
+			RD::get_singleton()->free(s.index_array);
+			_geometry_arena_free(index_arena, s.index_range);
+		} else if (s.index_buffer.is_valid()) {
 			RD::get_singleton()->free(s.index_buffer);
 		}
 
 		if (s.lod_count) {
 			for (uint32_t j = 0; j < s.lod_count; j++) {
-				RD::get_singleton()->free(s.lods[j].index_buffer);
+				if (s.lods[j].index_range.is_shared()) {
+					RD::get_singleton()->free(s.lods[j].index_array);
+					_geometry_arena_free(index_arena, s.lods[j].index_range);
+				} else if (s.lods[j].index_buffer.is_valid()) {
+					RD::get_singleton()->free(s.lods[j].index_buffer);
+				}
 			}
 			memdelete_arr(s.lods);
 		}
@@ -918,6 +1050,10 @@ void MeshStorage::mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int
 	MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
 	ERR_FAIL_NULL(mi);
 	ERR_FAIL_INDEX(p_shape, (int)mi->blend_weights.size());
+	if (mi->blend_weights[p_shape] == p_weight) {
+		// Animations commonly set the same weight every frame, avoid blending the mesh again.
+		return;
+	}
 	mi->blend_weights[p_shape] = p_weight;
 	mi->weights_dirty = true;
 	//will be eventually updated
@@ -1321,6 +1457,15 @@ void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::V
 			continue; // Shader does not need this, skip it (but computing stride was important anyway)
 		}
 
+		// Surfaces living in a shared arena start somewhere inside the buffer (vertex and attribute data may even share one).
+		if (s->format & (1ULL << i)) {
+			if ((i == RS::ARRAY_VERTEX || i == RS::ARRAY_NORMAL) && !mis) {
+				offset += s->vertex_range.offset;
+			} else if (i >= RS::ARRAY_COLOR && i <= RS::ARRAY_CUSTOM3) {
+				offset += s->attribute_range.offset;
+			}
+		}
+
 		attributes.push_back(vd);
 		buffers.push_back(buffer);
 		offsets.push_back(offset);
@@ -1409,6 +1554,7 @@ void MeshStorage::multimesh_allocate_data(RID p_multimesh, int p_instances, RS::
 		multimesh->uniform_set_2d = RID(); //cleared by dependency
 		multimesh->uniform_set_3d = RID(); //cleared by dependency
 	}
+	_multimesh_free_cull_data(multimesh);
 
 	if (multimesh->data_cache_dirty_regions) {
 		memdelete_arr(multimesh->data_cache_dirty_regions);
@@ -1486,6 +1632,7 @@ void MeshStorage::_multimesh_enable_motion_vectors(MultiMesh *multimesh) {
 
 	multimesh->buffer = new_buffer;
 	multimesh->uniform_set_3d = RID(); // Cleared by dependency.
+	_multimesh_free_cull_data(multimesh);
 
 	// Invalidate any references to the buffer that was released and the uniform set that was pointing to it.
 	multimesh->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MULTIMESH);
@@ -1827,6 +1974,157 @@ Dependency *MeshStorage::multimesh_get_dependency(RID p_multimesh) const {
 	return &multimesh->dependency;
 }
 
+void MeshStorage::_multimesh_free_cull_data(MultiMesh *multimesh) {
+	// Uniform sets using these buffers are cleared by dependency.
+	if (multimesh->cull_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->cull_buffer);
+		multimesh->cull_buffer = RID();
+	}
+	if (multimesh->cull_args_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->cull_args_buffer);
+		multimesh->cull_args_buffer = RID();
+		multimesh->cull_args_buffer_size = 0;
+	}
+	multimesh->cull_uniform_set = RID();
+	multimesh->cull_uniform_set_3d = RID();
+}
+
+bool MeshStorage::multimesh_can_gpu_cull(RID p_multimesh) const {
+	if (!multimesh_gpu_culling_enabled) {
+		return false;
+	}
+
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL_V(multimesh, false);
+
+	// Motion vectors keep two copies of the instances in the buffer, these are left to the regular path.
+	uint32_t instance_count = multimesh_get_instances_to_draw(p_multimesh);
+	if (instance_count < multimesh_gpu_culling_min_instances || multimesh->xform_format != RS::MULTIMESH_TRANSFORM_3D || !multimesh->buffer.is_valid() || multimesh->motion_vectors_enabled) {
+		return false;
+	}
+
+	Mesh *mesh = mesh_owner.get_or_null(multimesh->mesh);
+	return mesh != nullptr && mesh->surface_count > 0;
+}
+
+bool MeshStorage::multimesh_gpu_cull(RID p_multimesh, const Projection &p_clip_transform, const Vector3 &p_camera_position, float p_distance_scale, RID p_hiz, const Size2i &p_hiz_size, uint32_t p_hiz_mip_count) {
+	if (!multimesh_can_gpu_cull(p_multimesh)) {
+		return false;
+	}
+
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	Mesh *mesh = mesh_owner.get_or_null(multimesh->mesh);
+	uint32_t instance_count = multimesh_get_instances_to_draw(p_multimesh);
+
+	// Draw arguments for every LOD of every surface, so drawing can pick whichever LOD it selected.
+	LocalVector<uint32_t> &args = multimesh->cull_args;
+	args.clear();
+	args.push_back(0); // Visible instance counter.
+	args.push_back(0); // Draw argument count.
+	args.push_back(0);
+	args.push_back(0);
+
+	multimesh->cull_args_surface_offsets.resize(mesh->surface_count);
+	uint32_t args_count = 0;
+	for (uint32_t i = 0; i < mesh->surface_count; i++) {
+		const Mesh::Surface *s = mesh->surfaces[i];
+		multimesh->cull_args_surface_offsets[i] = args.size() * sizeof(uint32_t);
+		for (uint32_t j = 0; j <= s->lod_count; j++) {
+			if (s->index_count) {
+				args.push_back(j == 0 ? s->index_count : s->lods[j - 1].index_count);
+			} else {
+				args.push_back(s->vertex_count);
+			}
+			args.push_back(0); // Instance count, written by the culling shader.
+			args.push_back(0);
+			args.push_back(0);
+			args.push_back(0);
+			args_count++;
+		}
+	}
+	args[1] = args_count;
+
+	uint32_t args_size = args.size() * sizeof(uint32_t);
+	if (multimesh->cull_args_buffer_size < args_size) {
+		if (multimesh->cull_args_buffer.is_valid()) {
+			RD::get_singleton()->free(multimesh->cull_args_buffer);
+		}
+		multimesh->cull_args_buffer = RD::get_singleton()->storage_buffer_create(args_size, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+		multimesh->cull_args_buffer_size = args_size;
+	}
+
+	if (!multimesh->cull_buffer.is_valid()) {
+		multimesh->cull_buffer = RD::get_singleton()->storage_buffer_create(multimesh->instances * multimesh->stride_cache * sizeof(float));
+	}
+
+	if (!multimesh->cull_uniform_set.is_valid() || !RD::get_singleton()->uniform_set_is_valid(multimesh->cull_uniform_set)) {
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 1;
+			u.append_id(multimesh->cull_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 2;
+			u.append_id(multimesh->cull_args_buffer);
+			uniforms.push_back(u);
+		}
+		multimesh->cull_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, multimesh_cull_shader.version_shader, 0);
+	}
+
+	RD::get_singleton()->buffer_update(multimesh->cull_args_buffer, 0, args_size, args.ptr());
+
+	MultiMeshCullShader::PushConstant push_constant;
+	MaterialStorage::store_camera(p_clip_transform, push_constant.clip_transform);
+
+	AABB aabb = mesh_get_aabb(multimesh->mesh, RID());
+	Vector3 center = aabb.get_center();
+	Vector3 extents = aabb.size * 0.5;
+	push_constant.aabb_center[0] = center.x;
+	push_constant.aabb_center[1] = center.y;
+	push_constant.aabb_center[2] = center.z;
+	push_constant.instance_count = instance_count;
+	push_constant.aabb_extents[0] = extents.x;
+	push_constant.aabb_extents[1] = extents.y;
+	push_constant.aabb_extents[2] = extents.z;
+	push_constant.stride = multimesh->stride_cache / 4;
+	push_constant.hiz_size[0] = p_hiz_size.x;
+	push_constant.hiz_size[1] = p_hiz_size.y;
+	push_constant.hiz_mip_count = p_hiz.is_valid() ? p_hiz_mip_count : 0;
+	push_constant.pad = 0;
+	push_constant.camera_position[0] = p_camera_position.x;
+	push_constant.camera_position[1] = p_camera_position.y;
+	push_constant.camera_position[2] = p_camera_position.z;
+	float max_distance = multimesh->cull_distance * p_distance_scale;
+	push_constant.max_distance_squared = max_distance * max_distance;
+
+	// Without a depth pyramid only the frustum is tested, the texture is a placeholder.
+	RID hiz = p_hiz.is_valid() ? p_hiz : TextureStorage::get_singleton()->texture_rd_get_default(TextureStorage::DEFAULT_RD_TEXTURE_BLACK);
+	RID hiz_sampler = MaterialStorage::get_singleton()->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+	RD::Uniform u_hiz(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ hiz_sampler, hiz }));
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, multimesh_cull_shader.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, multimesh->cull_uniform_set, 0);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, UniformSetCacheRD::get_singleton()->get_cache(multimesh_cull_shader.version_shader, 1, u_hiz), 1);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(MultiMeshCullShader::PushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, instance_count, 1, 1);
+	RD::get_singleton()->compute_list_end();
+
+	return true;
+}
+
 Transform3D MeshStorage::multimesh_instance_get_transform(RID p_multimesh, int p_index) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Transform3D());
@@ -2020,6 +2318,19 @@ int MeshStorage::multimesh_get_visible_instances(RID p_multimesh) const {
 	return multimesh->visible_instances;
 }
 
+void MeshStorage::multimesh_set_cull_distance(RID p_multimesh, float p_distance) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(p_distance < 0.0);
+	multimesh->cull_distance = p_distance;
+}
+
+float MeshStorage::multimesh_get_cull_distance(RID p_multimesh) const {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL_V(multimesh, 0.0);
+	return multimesh->cull_distance;
+}
+
 void MeshStorage::multimesh_set_custom_aabb(RID p_multimesh, const AABB &p_aabb) {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL(multimesh);
@@ -2046,6 +2357,240 @@ AABB MeshStorage::multimesh_get_aabb(RID p_multimesh) const {
 	return multimesh->aabb;
 }
 
+void MeshStorage::_lod_stream_in(Mesh::Surface *p_surface, uint32_t p_lod) {
+	bool is_index_16 = p_surface->vertex_count <= 65536 && p_surface->vertex_count > 0;
+	RID &index_buffer = p_lod == 0 ? p_surface->index_buffer : p_surface->lods[p_lod - 1].index_buffer;
+	RID &index_array = p_lod == 0 ? p_surface->index_array : p_surface->lods[p_lod - 1].index_array;
+	uint32_t index_count = p_lod == 0 ? p_surface->index_count : p_surface->lods[p_lod - 1].index_count;
+
+	index_buffer = RD::get_singleton()->index_buffer_create(index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_surface->lod_index_data[p_lod], false);
+	index_array = RD::get_singleton()->index_array_create(index_buffer, 0, index_count);
+	if (p_lod < p_surface->lod_count) {
+		lod_streaming_resident_size += p_surface->lod_index_data[p_lod].size();
+	}
+}
+
+void MeshStorage::_lod_stream_out(Mesh::Surface *p_surface, uint32_t p_lod) {
+	RID &index_buffer = p_lod == 0 ? p_surface->index_buffer : p_surface->lods[p_lod - 1].index_buffer;
+	RID &index_array = p_lod == 0 ? p_surface->index_array : p_surface->lods[p_lod - 1].index_array;
+
+	RD::get_singleton()->free(index_buffer); // Array gets freed as dependency.
+	index_buffer = RID();
+	index_array = RID();
+	if (p_lod < p_surface->lod_count) {
+		lod_streaming_resident_size -= p_surface->lod_index_data[p_lod].size();
+	}
+}
+
+void MeshStorage::_update_lod_streaming() {
+	if (!lod_streamed_surfaces.first()) {
+		return;
+	}
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+
+	struct Request {
+		Mesh::Surface *surface = nullptr;
+		uint32_t lod = 0;
+	};
+	LocalVector<Request> requests;
+	for (SelfList<Mesh::Surface> *E = lod_streamed_surfaces.first(); E; E = E->next()) {
+		Mesh::Surface *s = E->self();
+		if (s->lod_wanted == UINT32_MAX) {
+			continue;
+		}
+		s->lod_last_used_frame = frame;
+		if (s->lod_wanted < s->lod_resident) {
+			requests.push_back({ s, s->lod_wanted });
+		}
+		s->lod_wanted = UINT32_MAX;
+	}
+
+	if (requests.is_empty()) {
+		return;
+	}
+
+	// Surfaces not drawn this frame can give up their streamed levels, least recently drawn first.
+	LocalVector<Mesh::Surface *> evictable;
+	bool evictable_sorted = false;
+
+	for (const Request &request : requests) {
+		Mesh::Surface *s = request.surface;
+		uint64_t needed = 0;
+		for (uint32_t i = request.lod; i < s->lod_resident; i++) {
+			needed += s->lod_index_data[i].size();
+		}
+
+		if (lod_streaming_resident_size + needed > lod_streaming_budget) {
+			if (!evictable_sorted) {
+				for (SelfList<Mesh::Surface> *E = lod_streamed_surfaces.first(); E; E = E->next()) {
+					if (E->self()->lod_resident < E->self()->lod_count && E->self()->lod_last_used_frame != frame) {
+						evictable.push_back(E->self());
+					}
+				}
+				struct SortByLastUse {
+					_FORCE_INLINE_ bool operator()(const Mesh::Surface *p_a, const Mesh::Surface *p_b) const {
+						return p_a->lod_last_used_frame > p_b->lod_last_used_frame;
+					}
+				};
+				evictable.sort_custom<SortByLastUse>(); // Least recent last, so it pops cheaply.
+				evictable_sorted = true;
+			}
+
+			while (lod_streaming_resident_size + needed > lod_streaming_budget && evictable.size()) {
+				Mesh::Surface *lru = evictable[evictable.size() - 1];
+				evictable.resize(evictable.size() - 1);
+				while (lru->lod_resident < lru->lod_count) {
+					_lod_stream_out(lru, lru->lod_resident);
+					lru->lod_resident++;
+				}
+			}
+		}
+
+		// Stream in from coarse to fine, as far as the budget allows.
+		while (s->lod_resident > request.lod && lod_streaming_resident_size + s->lod_index_data[s->lod_resident - 1].size() <= lod_streaming_budget) {
+			s->lod_resident--;
+			_lod_stream_in(s, s->lod_resident);
+		}
+	}
+}
+
+RID MeshStorage::_geometry_arena_allocate(GeometryArenaType p_type, const Vector<uint8_t> &p_data, GeometryArenaRange &r_range) {
+	r_range = GeometryArenaRange();
+
+	// Keep ranges aligned so any vertex format and both index formats can start anywhere.
+	const uint64_t alignment = 16;
+	uint64_t size = (uint64_t(p_data.size()) + alignment - 1) & ~(alignment - 1);
+	if (size == 0 || size > geometry_arena_block_size / 4) {
+		return RID(); // Large surfaces are better off with a buffer of their own.
+	}
+
+	GeometryArena &arena = geometry_arenas[p_type];
+
+	uint32_t block_index = UINT32_MAX;
+	uint32_t range_index = 0;
+	for (uint32_t i = 0; i < arena.blocks.size() && block_index == UINT32_MAX; i++) {
+		const GeometryArena::Block &block = arena.blocks[i];
+		for (uint32_t j = 0; j < block.free_ranges.size(); j++) {
+			if (block.free_ranges[j].size >= size) {
+				block_index = i;
+				range_index = j;
+				break;
+			}
+		}
+	}
+
+	if (block_index == UINT32_MAX) {
+		// Reuse the slot of a block that was released, block indices must remain stable.
+		for (uint32_t i = 0; i < arena.blocks.size(); i++) {
+			if (arena.blocks[i].buffer.is_null()) {
+				block_index = i;
+				break;
+			}
+		}
+		if (block_index == UINT32_MAX) {
+			block_index = arena.blocks.size();
+			arena.blocks.push_back(GeometryArena::Block());
+		}
+
+		GeometryArena::Block &block = arena.blocks[block_index];
+		switch (p_type) {
+			case GEOMETRY_ARENA_VERTEX: {
+				block.buffer = RD::get_singleton()->vertex_buffer_create(geometry_arena_block_size);
+			} break;
+			case GEOMETRY_ARENA_INDEX_16: {
+				block.buffer = RD::get_singleton()->index_buffer_create(geometry_arena_block_size / 2, RD::INDEX_BUFFER_FORMAT_UINT16);
+			} break;
+			case GEOMETRY_ARENA_INDEX_32: {
+				block.buffer = RD::get_singleton()->index_buffer_create(geometry_arena_block_size / 4, RD::INDEX_BUFFER_FORMAT_UINT32);
+			} break;
+			default: {
+			}
+		}
+		ERR_FAIL_COND_V(block.buffer.is_null(), RID());
+
+		GeometryArena::FreeRange range;
+		range.size = geometry_arena_block_size;
+		block.free_ranges.push_back(range);
+		range_index = 0;
+	}
+
+	GeometryArena::Block &block = arena.blocks[block_index];
+	GeometryArena::FreeRange &free_range = block.free_ranges[range_index];
+
+	r_range.block = block_index;
+	r_range.offset = free_range.offset;
+	r_range.size = size;
+
+	free_range.offset += size;
+	free_range.size -= size;
+	if (free_range.size == 0) {
+		block.free_ranges.remove_at(range_index);
+	}
+	arena.used_size += size;
+
+	RD::get_singleton()->buffer_update(block.buffer, r_range.offset, p_data.size(), p_data.ptr());
+
+	return block.buffer;
+}
+
+void MeshStorage::_geometry_arena_free(GeometryArenaType p_type, const GeometryArenaRange &p_range) {
+	ERR_FAIL_COND(!p_range.is_shared());
+
+	GeometryArena &arena = geometry_arenas[p_type];
+	ERR_FAIL_UNSIGNED_INDEX(p_range.block, arena.blocks.size());
+	GeometryArena::Block &block = arena.blocks[p_range.block];
+
+	uint32_t insert_at = 0;
+	while (insert_at < block.free_ranges.size() && block.free_ranges[insert_at].offset < p_range.offset) {
+		insert_at++;
+	}
+
+	GeometryArena::FreeRange range;
+	range.offset = p_range.offset;
+	range.size = p_range.size;
+	block.free_ranges.insert(insert_at, range);
+
+	// Merge with the following and preceding ranges.
+	if (insert_at + 1 < block.free_ranges.size() && block.free_ranges[insert_at].offset + block.free_ranges[insert_at].size == block.free_ranges[insert_at + 1].offset) {
+		block.free_ranges[insert_at].size += block.free_ranges[insert_at + 1].size;
+		block.free_ranges.remove_at(insert_at + 1);
+	}
+	if (insert_at > 0 && block.free_ranges[insert_at - 1].offset + block.free_ranges[insert_at - 1].size == block.free_ranges[insert_at].offset) {
+		block.free_ranges[insert_at - 1].size += block.free_ranges[insert_at].size;
+		block.free_ranges.remove_at(insert_at);
+	}
+
+	arena.used_size -= p_range.size;
+
+	if (block.free_ranges.size() == 1 && block.free_ranges[0].size == geometry_arena_block_size) {
+		// Nothing left in this block, give the memory back.
+		RD::get_singleton()->free(block.buffer);
+		block.buffer = RID();
+		block.free_ranges.clear();
+	}
+}
+
+uint64_t MeshStorage::get_geometry_arena_reserved_memory() const {
+	uint64_t reserved = 0;
+	for (int i = 0; i < GEOMETRY_ARENA_MAX; i++) {
+		for (const GeometryArena::Block &block : geometry_arenas[i].blocks) {
+			if (block.buffer.is_valid()) {
+				reserved += geometry_arena_block_size;
+			}
+		}
+	}
+	return reserved;
+}
+
+uint64_t MeshStorage::get_geometry_arena_used_memory() const {
+	uint64_t used = 0;
+	for (int i = 0; i < GEOMETRY_ARENA_MAX; i++) {
+		used += geometry_arenas[i].used_size;
+	}
+	return used;
+}
+
 void MeshStorage::_update_dirty_multimeshes() {
 	while (multimesh_dirty_list) {
 		MultiMesh *multimesh = multimesh_dirty_list;
@@ -2185,20 +2730,27 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
-
-	dataptr[0] = p_transform.basis.rows[0][0];
-	dataptr[1] = p_transform.basis.rows[0][1];
-	dataptr[2] = p_transform.basis.rows[0][2];
-	dataptr[3] = p_transform.origin.x;
-	dataptr[4] = p_transform.basis.rows[1][0];
-	dataptr[5] = p_transform.basis.rows[1][1];
-	dataptr[6] = p_transform.basis.rows[1][2];
-	dataptr[7] = p_transform.origin.y;
-	dataptr[8] = p_transform.basis.rows[2][0];
-	dataptr[9] = p_transform.basis.rows[2][1];
-	dataptr[10] = p_transform.basis.rows[2][2];
-	dataptr[11] = p_transform.origin.z;
+	const float bone_data[12] = {
+		p_transform.basis.rows[0][0],
+		p_transform.basis.rows[0][1],
+		p_transform.basis.rows[0][2],
+		p_transform.origin.x,
+		p_transform.basis.rows[1][0],
+		p_transform.basis.rows[1][1],
+		p_transform.basis.rows[1][2],
+		p_transform.origin.y,
+		p_transform.basis.rows[2][0],
+		p_transform.basis.rows[2][1],
+		p_transform.basis.rows[2][2],
+		p_transform.origin.z,
+	};
+
+	if (memcmp(skeleton->data.ptr() + p_bone * 12, bone_data, sizeof(bone_data)) == 0) {
+		// The pose is often set again as is every frame, don't skin the meshes using this skeleton again.
+		return;
+	}
+
+	memcpy(skeleton->data.ptrw() + p_bone * 12, bone_data, sizeof(bone_data));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -2237,16 +2789,23 @@ void MeshStorage::skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, con
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(!skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 8;
+	const float bone_data[8] = {
+		p_transform.columns[0][0],
+		p_transform.columns[1][0],
+		0,
+		p_transform.columns[2][0],
+		p_transform.columns[0][1],
+		p_transform.columns[1][1],
+		0,
+		p_transform.columns[2][1],
+	};
+
+	if (memcmp(skeleton->data.ptr() + p_bone * 8, bone_data, sizeof(bone_data)) == 0) {
+		// The pose is often set again as is every frame, don't skin the meshes using this skeleton again.
+		return;
+	}
 
-	dataptr[0] = p_transform.columns[0][0];
-	dataptr[1] = p_transform.columns[1][0];
-	dataptr[2] = 0;
-	dataptr[3] = p_transform.columns[2][0];
-	dataptr[4] = p_transform.columns[0][1];
-	dataptr[5] = p_transform.columns[1][1];
-	dataptr[6] = 0;
-	dataptr[7] = p_transform.columns[2][1];
+	memcpy(skeleton->data.ptrw() + p_bone * 8, bone_data, sizeof(bone_data));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -35,6 +35,7 @@
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
+#include "servers/rendering/renderer_rd/shaders/multimesh_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/skeleton.glsl.gen.h"
 #include "servers/rendering/storage/mesh_storage.h"
 #include "servers/rendering/storage/utilities.h"
@@ -70,6 +71,16 @@ private:
 
 	struct MeshInstance;
 
+	// Location of a surface's data inside a shared geometry arena block. Surfaces that don't fit in
+	// an arena own their buffers, in which case block is UINT32_MAX and offset is 0.
+	struct GeometryArenaRange {
+		uint32_t block = UINT32_MAX;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+
+		_FORCE_INLINE_ bool is_shared() const { return block != UINT32_MAX; }
+	};
+
 	struct Mesh {
 		struct Surface {
 			RS::PrimitiveType primitive = RS::PRIMITIVE_POINTS;
@@ -80,8 +91,12 @@ private:
 			RID skin_buffer;
 			uint32_t vertex_count = 0;
 			uint32_t vertex_buffer_size = 0;
+			uint32_t attribute_buffer_size = 0;
 			uint32_t skin_buffer_size = 0;
 
+			GeometryArenaRange vertex_range;
+			GeometryArenaRange attribute_range;
+
 			// A different pipeline needs to be allocated
 			// depending on the inputs available in the
 			// material.
@@ -105,17 +120,29 @@ private:
 			RID index_buffer;
 			RID index_array;
 			uint32_t index_count = 0;
+			bool index_16 = false;
+			GeometryArenaRange index_range;
 
 			struct LOD {
 				float edge_length = 0.0;
 				uint32_t index_count = 0;
 				RID index_buffer;
 				RID index_array;
+				GeometryArenaRange index_range;
 			};
 
 			LOD *lods = nullptr;
 			uint32_t lod_count = 0;
 
+			// LOD streaming. Levels finer than lod_resident (0 being the full index array) only exist in RAM
+			// until drawing asks for them. The coarsest level is always resident.
+			bool lod_streamed = false;
+			uint32_t lod_resident = 0;
+			uint32_t lod_wanted = UINT32_MAX; // Finest level requested since the last streaming update.
+			uint64_t lod_last_used_frame = 0;
+			LocalVector<Vector<uint8_t>> lod_index_data; // One per level.
+			SelfList<Surface> lod_stream_element;
+
 			AABB aabb;
 
 			Vector<AABB> bone_aabbs;
@@ -140,6 +167,9 @@ private:
 			uint64_t particles_render_pass = 0;
 
 			RID uniform_set;
+
+			Surface() :
+					lod_stream_element(this) {}
 		};
 
 		uint32_t blend_shape_count = 0;
@@ -169,6 +199,46 @@ private:
 
 	mutable RID_Owner<Mesh, true> mesh_owner;
 
+	bool lod_streaming_enabled = false;
+	uint64_t lod_streaming_budget = 0;
+	uint64_t lod_streaming_resident_size = 0; // Index buffers of streamed levels currently in VRAM.
+	SelfList<Mesh::Surface>::List lod_streamed_surfaces;
+
+	void _lod_stream_in(Mesh::Surface *p_surface, uint32_t p_lod);
+	void _lod_stream_out(Mesh::Surface *p_surface, uint32_t p_lod);
+
+	/* Geometry arenas */
+
+	// Static surfaces (no skin, no blend shapes) suballocate their vertex, attribute and index data
+	// from a few large buffers instead of creating a handful of small buffers each.
+	enum GeometryArenaType {
+		GEOMETRY_ARENA_VERTEX,
+		GEOMETRY_ARENA_INDEX_16,
+		GEOMETRY_ARENA_INDEX_32,
+		GEOMETRY_ARENA_MAX,
+	};
+
+	struct GeometryArena {
+		struct FreeRange {
+			uint64_t offset = 0;
+			uint64_t size = 0;
+		};
+
+		struct Block {
+			RID buffer;
+			LocalVector<FreeRange> free_ranges; // Sorted by offset, neighbors are always merged.
+		};
+
+		LocalVector<Block> blocks;
+		uint64_t used_size = 0;
+	};
+
+	GeometryArena geometry_arenas[GEOMETRY_ARENA_MAX];
+	uint64_t geometry_arena_block_size = 0; // 0 disables the arenas.
+
+	RID _geometry_arena_allocate(GeometryArenaType p_type, const Vector<uint8_t> &p_data, GeometryArenaRange &r_range);
+	void _geometry_arena_free(GeometryArenaType p_type, const GeometryArenaRange &p_range);
+
 	/* Mesh Instance API */
 
 	struct MeshInstance {
@@ -219,6 +289,7 @@ private:
 		bool uses_colors = false;
 		bool uses_custom_data = false;
 		int visible_instances = -1;
+		float cull_distance = 0.0;
 		AABB aabb;
 		AABB custom_aabb;
 		bool aabb_dirty = false;
@@ -241,6 +312,15 @@ private:
 		RID uniform_set_3d;
 		RID uniform_set_2d;
 
+		// GPU culling, visible instances are compacted into their own buffer.
+		RID cull_buffer;
+		RID cull_args_buffer;
+		uint32_t cull_args_buffer_size = 0;
+		RID cull_uniform_set;
+		RID cull_uniform_set_3d;
+		LocalVector<uint32_t> cull_args;
+		LocalVector<uint32_t> cull_args_surface_offsets; // Byte offset of the first draw argument of each surface.
+
 		bool dirty = false;
 		MultiMesh *dirty_list = nullptr;
 
@@ -258,6 +338,35 @@ private:
 	_FORCE_INLINE_ void _multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
+	void _multimesh_free_cull_data(MultiMesh *multimesh);
+
+	struct MultiMeshCullShader {
+		struct PushConstant {
+			float clip_transform[16];
+
+			float aabb_center[3];
+			uint32_t instance_count;
+
+			float aabb_extents[3];
+			uint32_t stride;
+
+			int32_t hiz_size[2];
+			uint32_t hiz_mip_count;
+			uint32_t pad;
+
+			float camera_position[3];
+			float max_distance_squared;
+		};
+
+		MultimeshCullShaderRD shader;
+		RID version;
+		RID version_shader;
+		RID pipeline;
+	} multimesh_cull_shader;
+
+	bool multimesh_gpu_culling_enabled = false;
+	uint32_t multimesh_gpu_culling_min_instances = 0;
+	bool multimesh_gpu_culling_use_occlusion = false;
 
 	/* Skeleton */
 
@@ -473,6 +582,12 @@ public:
 	_FORCE_INLINE_ RID mesh_surface_get_index_array(void *p_surface, uint32_t p_lod) const {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
+		if (unlikely(s->lod_streamed)) {
+			// Ask for the level, and draw the finest resident one until it streams in.
+			s->lod_wanted = MIN(s->lod_wanted, p_lod);
+			p_lod = MAX(p_lod, s->lod_resident);
+		}
+
 		if (p_lod == 0) {
 			return s->index_array;
 		} else {
@@ -605,6 +720,9 @@ public:
 
 	Dependency *mesh_get_dependency(RID p_mesh) const;
 
+	uint64_t get_geometry_arena_reserved_memory() const;
+	uint64_t get_geometry_arena_used_memory() const;
+
 	/* MESH INSTANCE API */
 
 	bool owns_mesh_instance(RID p_rid) const { return mesh_instance_owner.owns(p_rid); };
@@ -647,12 +765,16 @@ public:
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override;
 
+	virtual void multimesh_set_cull_distance(RID p_multimesh, float p_distance) override;
+	virtual float multimesh_get_cull_distance(RID p_multimesh) const override;
+
 	virtual void multimesh_set_custom_aabb(RID p_multimesh, const AABB &p_aabb) override;
 	virtual AABB multimesh_get_custom_aabb(RID p_multimesh) const override;
 
 	virtual AABB multimesh_get_aabb(RID p_multimesh) const override;
 
 	void _update_dirty_multimeshes();
+	void _update_lod_streaming();
 	void _multimesh_get_motion_vectors_offsets(RID p_multimesh, uint32_t &r_current_offset, uint32_t &r_prev_offset);
 	bool _multimesh_uses_motion_vectors_offsets(RID p_multimesh);
 	bool _multimesh_uses_motion_vectors(RID p_multimesh);
@@ -724,6 +846,46 @@ public:
 
 	Dependency *multimesh_get_dependency(RID p_multimesh) const;
 
+	_FORCE_INLINE_ bool multimesh_gpu_culling_uses_occlusion() const {
+		return multimesh_gpu_culling_enabled && multimesh_gpu_culling_use_occlusion;
+	}
+
+	bool multimesh_can_gpu_cull(RID p_multimesh) const;
+	bool multimesh_gpu_cull(RID p_multimesh, const Projection &p_clip_transform, const Vector3 &p_camera_position, float p_distance_scale, RID p_hiz = RID(), const Size2i &p_hiz_size = Size2i(), uint32_t p_hiz_mip_count = 0);
+
+	_FORCE_INLINE_ RID multimesh_get_culled_3d_uniform_set(RID p_multimesh, RID p_shader, uint32_t p_set) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr || !multimesh->cull_buffer.is_valid()) {
+			return RID();
+		}
+		if (!multimesh->cull_uniform_set_3d.is_valid() || !RD::get_singleton()->uniform_set_is_valid(multimesh->cull_uniform_set_3d)) {
+			Vector<RD::Uniform> uniforms;
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->cull_buffer);
+			uniforms.push_back(u);
+			multimesh->cull_uniform_set_3d = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_set);
+		}
+
+		return multimesh->cull_uniform_set_3d;
+	}
+
+	_FORCE_INLINE_ RID multimesh_get_culled_args_buffer(RID p_multimesh) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		return multimesh ? multimesh->cull_args_buffer : RID();
+	}
+
+	// The draw arguments of the given surface and LOD, matching the index array drawn for them.
+	_FORCE_INLINE_ uint32_t multimesh_get_culled_args_offset(RID p_multimesh, uint32_t p_surface, void *p_mesh_surface, uint32_t p_lod) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_mesh_surface);
+		if (unlikely(s->lod_streamed)) {
+			p_lod = MAX(p_lod, s->lod_resident);
+		}
+		return multimesh->cull_args_surface_offsets[p_surface] + p_lod * 5 * sizeof(uint32_t);
+	}
+
 	/* SKELETON API */
 
 	bool owns_skeleton(RID p_rid) const { return skeleton_owner.owns(p_rid); };
@@ -30,6 +30,7 @@
 
 #include "particles_storage.h"
 
+#include "core/config/project_settings.h"
 #include "servers/rendering/renderer_rd/renderer_compositor_rd.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "texture_storage.h"
@@ -53,6 +54,8 @@ ParticlesStorage::ParticlesStorage() {
 
 	/* Particles */
 
+	particles_lod_distance = MAX(float(GLOBAL_GET("rendering/particles/lod/distance")), 0.0f);
+
 	{
 		String defines = "#define SAMPLERS_BINDING_FIRST_INDEX " + itos(SAMPLERS_BINDING_FIRST_INDEX) + "\n";
 		// Initialize particles
@@ -298,6 +301,7 @@ void ParticlesStorage::_particles_free_data(Particles *particles) {
 		RD::get_singleton()->free(particles->particles_sort_buffer);
 		particles->particles_sort_buffer = RID();
 		particles->particles_sort_uniform_set = RID();
+		particles->sort_buffer_valid = false;
 	}
 
 	if (particles->emission_buffer != nullptr) {
@@ -607,6 +611,17 @@ void ParticlesStorage::particles_request_process(RID p_particles) {
 	}
 }
 
+void ParticlesStorage::particles_set_view_distance(RID p_particles, float p_distance) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	if (particles->view_distance_frame != frame || p_distance < particles->view_distance) {
+		particles->view_distance = p_distance;
+		particles->view_distance_frame = frame;
+	}
+}
+
 AABB ParticlesStorage::particles_get_current_aabb(RID p_particles) {
 	if (RSG::threaded) {
 		WARN_PRINT_ONCE("Calling this function with threaded rendering enabled stalls the renderer, use with care.");
@@ -832,7 +847,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 
 	frame_params.cycle = p_particles->cycle_number;
 	frame_params.frame = p_particles->frame_counter++;
-	frame_params.amount_ratio = p_particles->amount_ratio;
+	frame_params.amount_ratio = p_particles->amount_ratio * p_particles->lod_amount_ratio;
 	frame_params.pad1 = 0;
 	frame_params.pad2 = 0;
 	frame_params.emitter_velocity[0] = p_particles->emitter_velocity.x;
@@ -1207,6 +1222,7 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		}
 		size *= sizeof(float) * 2;
 		particles->particles_sort_buffer = RD::get_singleton()->storage_buffer_create(size);
+		particles->sort_buffer_valid = false;
 
 		{
 			Vector<RD::Uniform> uniforms;
@@ -1265,7 +1281,14 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 
 	copy_push_constant.align_mode = particles->transform_align;
 
-	if (do_sort) {
+	// The order from the last sort is still good if the particles have not been processed since and the view barely turned.
+	bool sort_current = particles->sort_buffer_valid && particles->sort_frame_counter == particles->frame_counter && particles->sort_axis.dot(axis) > 0.9999;
+
+	if (do_sort && !sort_current) {
+		particles->sort_buffer_valid = true;
+		particles->sort_frame_counter = particles->frame_counter;
+		particles->sort_axis = axis;
+
 		RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
 		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_SORT_BUFFER + particles->userdata_count * ParticlesShader::COPY_MODE_MAX]);
@@ -1440,6 +1463,34 @@ void ParticlesStorage::update_particles() {
 		} else if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
 			fixed_fps = screen_hz;
 		}
+
+		// Distance LOD: far away emitters emit fewer particles and are simulated at a lower rate.
+		uint32_t lod_interval = 1;
+		particles->lod_amount_ratio = 1.0;
+		// Particles are processed before culling, so the distance comes from the previous frame.
+		bool seen_recently = particles->view_distance_frame != UINT64_MAX && RSG::rasterizer->get_frame_number() - particles->view_distance_frame <= 1;
+		if (particles_lod_distance > 0.0 && seen_recently && particles->view_distance > particles_lod_distance && !particles->clear) {
+			float lod = particles->view_distance / particles_lod_distance;
+			particles->lod_amount_ratio = MAX(1.0f / lod, 0.25f);
+			// Trails keep their rate, as their history length depends on it.
+			if (!particles->trails_enabled || particles->trail_bind_poses.size() <= 1) {
+				lod_interval = MIN(nearest_power_of_2_templated(uint32_t(lod)), 4u);
+			}
+		}
+
+		if (lod_interval > 1) {
+			if (fixed_fps > 0) {
+				fixed_fps = MAX(fixed_fps / int(lod_interval), 1);
+			} else {
+				// Stagger emitters so they don't all process on the same frame.
+				if ((frame + (uint32_t(uint64_t(particles) >> 4))) % lod_interval != 0) {
+					particles->lod_skipped_time += RendererCompositorRD::get_singleton()->get_frame_delta_time();
+					continue;
+				}
+			}
+		}
+		double lod_skipped_time = particles->lod_skipped_time;
+		particles->lod_skipped_time = 0.0;
 		{
 			//update trails
 			int history_size = 1;
@@ -1545,7 +1596,7 @@ void ParticlesStorage::update_particles() {
 			if (zero_time_scale) {
 				_particles_process(particles, 0.0);
 			} else {
-				_particles_process(particles, RendererCompositorRD::get_singleton()->get_frame_delta_time());
+				_particles_process(particles, RendererCompositorRD::get_singleton()->get_frame_delta_time() + lod_skipped_time);
 			}
 		}
 
@@ -51,6 +51,8 @@ private:
 	/* EFFECTS */
 	SortEffects *sort_effects = nullptr;
 
+	float particles_lod_distance = 0.0; // 0 disables distance LOD.
+
 	/* PARTICLES */
 
 	enum {
@@ -207,6 +209,15 @@ private:
 
 		RID particles_sort_buffer;
 		RID particles_sort_uniform_set;
+		bool sort_buffer_valid = false;
+		uint32_t sort_frame_counter = 0;
+		Vector3 sort_axis;
+
+		// Distance LOD, from the nearest camera that saw the particles this frame.
+		float view_distance = 0.0;
+		uint64_t view_distance_frame = UINT64_MAX;
+		float lod_amount_ratio = 1.0;
+		double lod_skipped_time = 0.0;
 
 		bool dirty = false;
 		SelfList<Particles> update_list;
@@ -479,6 +490,7 @@ public:
 	virtual RID particles_get_draw_pass_mesh(RID p_particles, int p_pass) const override;
 
 	virtual void particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) override;
+	virtual void particles_set_view_distance(RID p_particles, float p_distance) override;
 
 	virtual bool particles_is_inactive(RID p_particles) const override;
 
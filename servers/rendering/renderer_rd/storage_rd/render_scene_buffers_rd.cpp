@@ -657,7 +657,14 @@ void RenderSceneBuffersRD::ensure_velocity() {
 			uint32_t msaa_usage_bits = RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
 			usage_bits |= RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
-			create_texture(RB_SCOPE_BUFFERS, RB_TEX_VELOCITY_MSAA, RD::DATA_FORMAT_R16G16_SFLOAT, msaa_usage_bits, texture_samples);
+			// Our MSAA buffer is resolved into an overridden velocity texture if we have one, so it must match its format.
+			RD::DataFormat msaa_format = RD::DATA_FORMAT_R16G16_SFLOAT;
+			RID velocity_override = RendererRD::TextureStorage::get_singleton()->render_target_get_override_velocity(render_target);
+			if (velocity_override.is_valid()) {
+				msaa_format = RD::get_singleton()->texture_get_format(velocity_override).format;
+			}
+
+			create_texture(RB_SCOPE_BUFFERS, RB_TEX_VELOCITY_MSAA, msaa_format, msaa_usage_bits, texture_samples);
 		}
 
 		create_texture(RB_SCOPE_BUFFERS, RB_TEX_VELOCITY, RD::DATA_FORMAT_R16G16_SFLOAT, usage_bits);
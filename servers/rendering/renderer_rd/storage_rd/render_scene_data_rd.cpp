@@ -254,7 +254,13 @@ void RenderSceneDataRD::update_ubo(RID p_uniform_buffer, RS::ViewportDebugDraw p
 	ubo.roughness_limiter_amount = render_scene_render->screen_space_roughness_limiter_get_amount();
 	ubo.roughness_limiter_limit = render_scene_render->screen_space_roughness_limiter_get_limit();
 
-	if (calculate_motion_vectors) {
+	ubo.motion_vector_scale = motion_vectors_for_reprojection ? -1.0 : 0.5;
+
+	if (calculate_motion_vectors && motion_vectors_for_reprojection) {
+		// Use our current camera for our previous positions so only object motion remains.
+		memcpy(&prev_ubo, &ubo, sizeof(UBO));
+		prev_ubo.time -= time_step;
+	} else if (calculate_motion_vectors) {
 		// Q : Should we make a complete copy or should we define a separate UBO with just the components we need?
 		memcpy(&prev_ubo, &ubo, sizeof(UBO));
 
@@ -44,6 +44,9 @@ class RenderSceneDataRD : public RenderSceneData {
 
 public:
 	bool calculate_motion_vectors = false;
+	// Motion vectors are submitted to an XR runtime for reprojection, these are stored in NDC space (current - previous)
+	// and exclude camera motion as the runtime applies that itself.
+	bool motion_vectors_for_reprojection = false;
 
 	Transform3D cam_transform;
 	Projection cam_projection;
@@ -149,7 +152,7 @@ private:
 
 		float fog_height_density;
 		float fog_depth_curve;
-		float pad;
+		float motion_vector_scale;
 		float fog_depth_begin;
 
 		float fog_light_color[3];
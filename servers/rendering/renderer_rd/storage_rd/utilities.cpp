@@ -31,6 +31,7 @@
 #include "utilities.h"
 #include "../environment/fog.h"
 #include "../environment/gi.h"
+#include "../pipeline_cache_rd.h"
 #include "light_storage.h"
 #include "mesh_storage.h"
 #include "particles_storage.h"
@@ -45,6 +46,7 @@ Utilities::Utilities() {
 }
 
 Utilities::~Utilities() {
+	PipelineCacheRD::manifest_finalize();
 	singleton = nullptr;
 }
 
@@ -253,6 +255,7 @@ void Utilities::update_dirty_resources() {
 	MaterialStorage::get_singleton()->_update_queued_materials();
 	MeshStorage::get_singleton()->_update_dirty_multimeshes();
 	MeshStorage::get_singleton()->_update_dirty_skeletons();
+	MeshStorage::get_singleton()->_update_lod_streaming();
 	TextureStorage::get_singleton()->update_decal_atlas();
 }
 
@@ -293,6 +296,7 @@ void Utilities::update_memory_info() {
 	texture_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TEXTURES);
 	buffer_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_BUFFERS);
 	total_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TOTAL);
+	graph_statistics_cache = RenderingDevice::get_singleton()->get_graph_statistics();
 }
 
 uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
@@ -302,6 +306,18 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_PIPELINE_BARRIERS_IN_FRAME) {
+		return graph_statistics_cache.pipeline_barrier_count;
+	} else if (p_info == RS::RENDERING_INFO_LAYOUT_TRANSITIONS_IN_FRAME) {
+		return graph_statistics_cache.layout_transition_count;
+	} else if (p_info == RS::RENDERING_INFO_RENDER_PASSES_IN_FRAME) {
+		return graph_statistics_cache.render_pass_count;
+	} else if (p_info == RS::RENDERING_INFO_GRAPH_LEVELS_IN_FRAME) {
+		return graph_statistics_cache.level_count;
+	} else if (p_info == RS::RENDERING_INFO_GEOMETRY_ARENA_MEM_RESERVED) {
+		return MeshStorage::get_singleton()->get_geometry_arena_reserved_memory();
+	} else if (p_info == RS::RENDERING_INFO_GEOMETRY_ARENA_MEM_USED) {
+		return MeshStorage::get_singleton()->get_geometry_arena_used_memory();
 	}
 	return 0;
 }
@@ -329,3 +345,29 @@ Size2i Utilities::get_maximum_viewport_size() const {
 	int max_y = device->limit_get(RenderingDevice::LIMIT_MAX_VIEWPORT_DIMENSIONS_Y);
 	return Size2i(max_x, max_y);
 }
+
+/* PIPELINE MANIFEST */
+
+void Utilities::pipeline_manifest_set_recording(bool p_enable) {
+	PipelineCacheRD::manifest_set_recording(p_enable);
+}
+
+bool Utilities::pipeline_manifest_is_recording() const {
+	return PipelineCacheRD::manifest_is_recording();
+}
+
+TypedArray<Dictionary> Utilities::pipeline_manifest_get() const {
+	return PipelineCacheRD::manifest_get();
+}
+
+void Utilities::pipeline_manifest_clear() {
+	PipelineCacheRD::manifest_clear();
+}
+
+void Utilities::pipeline_manifest_precompile(const TypedArray<Dictionary> &p_manifest) {
+	PipelineCacheRD::manifest_precompile(p_manifest);
+}
+
+float Utilities::pipeline_manifest_get_precompile_progress() const {
+	return PipelineCacheRD::manifest_get_precompile_progress();
+}
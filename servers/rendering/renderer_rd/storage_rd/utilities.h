@@ -59,6 +59,7 @@ private:
 	uint64_t texture_mem_cache = 0;
 	uint64_t buffer_mem_cache = 0;
 	uint64_t total_mem_cache = 0;
+	RenderingDeviceGraph::Statistics graph_statistics_cache;
 
 public:
 	static Utilities *get_singleton() { return singleton; }
@@ -117,6 +118,15 @@ public:
 	virtual String get_video_adapter_api_version() const override;
 
 	virtual Size2i get_maximum_viewport_size() const override;
+
+	/* PIPELINE MANIFEST */
+
+	virtual void pipeline_manifest_set_recording(bool p_enable) override;
+	virtual bool pipeline_manifest_is_recording() const override;
+	virtual TypedArray<Dictionary> pipeline_manifest_get() const override;
+	virtual void pipeline_manifest_clear() override;
+	virtual void pipeline_manifest_precompile(const TypedArray<Dictionary> &p_manifest) override;
+	virtual float pipeline_manifest_get_precompile_progress() const override;
 };
 
 } // namespace RendererRD
@@ -30,6 +30,7 @@
 
 #include "renderer_scene_cull.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
@@ -93,9 +94,52 @@ void RendererSceneCull::camera_set_frustum(RID p_camera, float p_size, Vector2 p
 void RendererSceneCull::camera_set_transform(RID p_camera, const Transform3D &p_transform) {
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_NULL(camera);
+	if (camera->interpolated) {
+		camera->transform_curr = p_transform.orthonormalized();
+		if (!camera->interpolate_item.in_list()) {
+			_camera_interpolate_list.add(&camera->interpolate_item);
+		}
+		return;
+	}
+
 	camera->transform = p_transform.orthonormalized();
 }
 
+void RendererSceneCull::camera_set_interpolated(RID p_camera, bool p_interpolated) {
+	Camera *camera = camera_owner.get_or_null(p_camera);
+	ERR_FAIL_NULL(camera);
+
+	if (camera->interpolated == p_interpolated) {
+		return;
+	}
+
+	camera->interpolated = p_interpolated;
+	if (p_interpolated) {
+		camera->transform_prev = camera->transform;
+		camera->transform_curr = camera->transform;
+	} else {
+		camera->transform = camera->transform_curr;
+		if (camera->interpolate_item.in_list()) {
+			_camera_interpolate_list.remove(&camera->interpolate_item);
+		}
+	}
+}
+
+void RendererSceneCull::camera_reset_physics_interpolation(RID p_camera) {
+	Camera *camera = camera_owner.get_or_null(p_camera);
+	ERR_FAIL_NULL(camera);
+
+	if (!camera->interpolated) {
+		return;
+	}
+
+	camera->transform_prev = camera->transform_curr;
+	camera->transform = camera->transform_curr;
+	if (camera->interpolate_item.in_list()) {
+		_camera_interpolate_list.remove(&camera->interpolate_item);
+	}
+}
+
 void RendererSceneCull::camera_set_cull_mask(RID p_camera, uint32_t p_layers) {
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_NULL(camera);
@@ -920,10 +964,69 @@ void RendererSceneCull::instance_geometry_set_transparency(RID p_instance, float
 	}
 }
 
+void RendererSceneCull::_instance_set_interpolated_transform(Instance *p_instance, const Transform3D &p_transform) {
+	// The drawn transform is updated by _update_interpolated_transforms() before drawing.
+	p_instance->transform_curr = p_transform;
+	if (!p_instance->interpolate_item.in_list()) {
+		_instance_interpolate_list.add(&p_instance->interpolate_item);
+	}
+}
+
+void RendererSceneCull::_update_interpolated_transforms() {
+	real_t fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+
+	SelfList<Instance> *E = _instance_interpolate_list.first();
+	while (E) {
+		SelfList<Instance> *N = E->next();
+		Instance *instance = E->self();
+
+		bool settled = instance->transform_prev == instance->transform_curr;
+		Transform3D xform = settled ? instance->transform_curr : instance->transform_prev.interpolate_with(instance->transform_curr, fraction);
+		if (instance->transform != xform) {
+			instance->transform = xform;
+			_instance_queue_update(instance, true);
+		}
+		if (settled) {
+			_instance_interpolate_list.remove(E);
+		}
+
+		E = N;
+	}
+
+	SelfList<Camera> *C = _camera_interpolate_list.first();
+	while (C) {
+		SelfList<Camera> *N = C->next();
+		Camera *camera = C->self();
+
+		if (camera->transform_prev == camera->transform_curr) {
+			camera->transform = camera->transform_curr;
+			_camera_interpolate_list.remove(C);
+		} else {
+			camera->transform = camera->transform_prev.interpolate_with(camera->transform_curr, fraction).orthonormalized();
+		}
+
+		C = N;
+	}
+}
+
 void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D &p_transform) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
 
+	if (instance->interpolated) {
+		if (instance->transform_curr == p_transform) {
+			return;
+		}
+#ifdef DEBUG_ENABLED
+		for (int i = 0; i < 4; i++) {
+			const Vector3 &v = i < 3 ? p_transform.basis.rows[i] : p_transform.origin;
+			ERR_FAIL_COND(!v.is_finite());
+		}
+#endif
+		_instance_set_interpolated_transform(instance, p_transform);
+		return;
+	}
+
 	if (instance->transform == p_transform) {
 		return; //must be checked to avoid worst evil
 	}
@@ -940,6 +1043,83 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		const Transform3D &transform = transforms[i];
+		if ((instance->interpolated ? instance->transform_curr : instance->transform) == transform) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		bool is_finite = true;
+		for (int j = 0; j < 4; j++) {
+			is_finite = is_finite && (j < 3 ? transform.basis.rows[j] : transform.origin).is_finite();
+		}
+		ERR_CONTINUE(!is_finite);
+#endif
+
+		if (instance->interpolated) {
+			_instance_set_interpolated_transform(instance, transform);
+			continue;
+		}
+
+		instance->transform = transform;
+		// Same as _instance_queue_update(), inlined as this is the whole point of the bulk call.
+		instance->update_aabb = true;
+		if (!instance->update_item.in_list()) {
+			_instance_update_list.add(&instance->update_item);
+		}
+	}
+}
+
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+
+	if (instance->interpolated == p_interpolated) {
+		return;
+	}
+
+	instance->interpolated = p_interpolated;
+	if (p_interpolated) {
+		instance->transform_prev = instance->transform;
+		instance->transform_curr = instance->transform;
+	} else {
+		if (instance->transform != instance->transform_curr) {
+			instance->transform = instance->transform_curr;
+			_instance_queue_update(instance, true);
+		}
+		if (instance->interpolate_item.in_list()) {
+			_instance_interpolate_list.remove(&instance->interpolate_item);
+		}
+	}
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+
+	if (!instance->interpolated) {
+		return;
+	}
+
+	instance->transform_prev = instance->transform_curr;
+	if (instance->transform != instance->transform_curr) {
+		instance->transform = instance->transform_curr;
+		_instance_queue_update(instance, true);
+	}
+	if (instance->interpolate_item.in_list()) {
+		_instance_interpolate_list.remove(&instance->interpolate_item);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -2137,6 +2317,7 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	cull.shadow_count = p_shadow_index + 1;
 	cull.shadows[p_shadow_index].cascade_count = splits;
 	cull.shadows[p_shadow_index].light_instance = light->instance;
+	cull.shadows[p_shadow_index].instance = p_instance;
 
 	for (int i = 0; i < splits; i++) {
 		RENDER_TIMESTAMP("Cull DirectionalLight3D, Split " + itos(i));
@@ -2307,13 +2488,11 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
-bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
-	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
-
+bool RendererSceneCull::_light_instance_setup_shadow(Instance *p_instance) {
 	Transform3D light_transform = p_instance->transform;
 	light_transform.orthonormalize(); //scale does not count on lights
 
-	bool animated_material_found = false;
+	real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
@@ -2326,67 +2505,21 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					return true;
 				}
 				for (int i = 0; i < 2; i++) {
-					//using this one ensures that raster deferred will have it
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Paraboloid, Half " + itos(i));
-
-					real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
-
 					real_t z = i == 0 ? -1 : 1;
-					Vector<Plane> planes;
-					planes.resize(6);
-					planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
-					planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
-					planes.write[2] = light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius));
-					planes.write[3] = light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius));
-					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
-					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
-
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
-
-					RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
+					shadow_cull_passes.push_back(ShadowCullPass());
+					ShadowCullPass &shadow_pass = shadow_cull_passes[shadow_cull_passes.size() - 1];
+					shadow_pass.light = p_instance;
+					shadow_pass.shadow_index = max_shadows_used++;
+					shadow_pass.pass = i;
+					shadow_pass.planes.resize(6);
+					shadow_pass.planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
+					shadow_pass.planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
+					shadow_pass.planes.write[2] = light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius));
+					shadow_pass.planes.write[3] = light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius));
+					shadow_pass.planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
+					shadow_pass.planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
+					shadow_pass.transform = light_transform;
+					shadow_pass.radius = radius;
 				}
 			} else { //shadow cube
 
@@ -2394,152 +2527,158 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					return true;
 				}
 
-				real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 				Projection cm;
 				cm.set_perspective(90, 1, radius * 0.005f, radius);
 
-				for (int i = 0; i < 6; i++) {
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Cube, Side " + itos(i));
-					//using this one ensures that raster deferred will have it
-
-					static const Vector3 view_normals[6] = {
-						Vector3(+1, 0, 0),
-						Vector3(-1, 0, 0),
-						Vector3(0, -1, 0),
-						Vector3(0, +1, 0),
-						Vector3(0, 0, +1),
-						Vector3(0, 0, -1)
-					};
-					static const Vector3 view_up[6] = {
-						Vector3(0, -1, 0),
-						Vector3(0, -1, 0),
-						Vector3(0, 0, -1),
-						Vector3(0, 0, +1),
-						Vector3(0, -1, 0),
-						Vector3(0, -1, 0)
-					};
+				static const Vector3 view_normals[6] = {
+					Vector3(+1, 0, 0),
+					Vector3(-1, 0, 0),
+					Vector3(0, -1, 0),
+					Vector3(0, +1, 0),
+					Vector3(0, 0, +1),
+					Vector3(0, 0, -1)
+				};
+				static const Vector3 view_up[6] = {
+					Vector3(0, -1, 0),
+					Vector3(0, -1, 0),
+					Vector3(0, 0, -1),
+					Vector3(0, 0, +1),
+					Vector3(0, -1, 0),
+					Vector3(0, -1, 0)
+				};
 
+				for (int i = 0; i < 6; i++) {
 					Transform3D xform = light_transform * Transform3D().looking_at(view_normals[i], view_up[i]);
 
-					Vector<Plane> planes = cm.get_projection_planes(xform);
-
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
-					RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, xform, radius, 0, i, 0);
-
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
+					shadow_cull_passes.push_back(ShadowCullPass());
+					ShadowCullPass &shadow_pass = shadow_cull_passes[shadow_cull_passes.size() - 1];
+					shadow_pass.light = p_instance;
+					shadow_pass.shadow_index = max_shadows_used++;
+					shadow_pass.pass = i;
+					shadow_pass.planes = cm.get_projection_planes(xform);
+					shadow_pass.projection = cm;
+					shadow_pass.transform = xform;
+					shadow_pass.radius = radius;
 				}
-
-				//restore the regular DP matrix
-				//RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, 0, 0);
 			}
 
 		} break;
 		case RS::LIGHT_SPOT: {
-			RENDER_TIMESTAMP("Cull SpotLight3D Shadow");
-
 			if (max_shadows_used + 1 > MAX_UPDATE_SHADOWS) {
 				return true;
 			}
 
-			real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 			real_t angle = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SPOT_ANGLE);
 
 			Projection cm;
 			cm.set_perspective(angle * 2.0, 1.0, 0.005f * radius, radius);
 
-			Vector<Plane> planes = cm.get_projection_planes(light_transform);
+			shadow_cull_passes.push_back(ShadowCullPass());
+			ShadowCullPass &shadow_pass = shadow_cull_passes[shadow_cull_passes.size() - 1];
+			shadow_pass.light = p_instance;
+			shadow_pass.shadow_index = max_shadows_used++;
+			shadow_pass.pass = 0;
+			shadow_pass.planes = cm.get_projection_planes(light_transform);
+			shadow_pass.projection = cm;
+			shadow_pass.transform = light_transform;
+			shadow_pass.radius = radius;
 
-			instance_shadow_cull_result.clear();
+		} break;
+	}
 
-			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+	return false;
+}
 
-			struct CullConvex {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+void RendererSceneCull::_light_shadow_pass_cull(uint32_t p_index, ShadowCullData *p_cull_data) {
+	ShadowCullPass &shadow_pass = shadow_cull_passes[p_index];
+	PagedArray<Instance *> &cull_result = shadow_pass_cull_results[p_index];
+	cull_result.clear();
 
-			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
+	struct CullConvex {
+		PagedArray<Instance *> *result;
+		uint32_t visible_layers;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			Instance *p_instance = (Instance *)p_data;
+			if (!p_instance->visible || !((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(p_instance->base_data)->can_cast_shadows || !(visible_layers & p_instance->layer_mask)) {
+				return false;
+			}
+			result->push_back(p_instance);
+			return false;
+		}
+	};
 
-			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+	Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&shadow_pass.planes[0], shadow_pass.planes.size());
 
-			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+	CullConvex cull_convex;
+	cull_convex.result = &cull_result;
+	cull_convex.visible_layers = p_cull_data->visible_layers;
 
-			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
-			}
+	p_cull_data->scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(shadow_pass.planes.ptr(), shadow_pass.planes.size(), points.ptr(), points.size(), cull_convex);
+}
 
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
+void RendererSceneCull::_light_instances_cull_shadows(Scenario *p_scenario, uint32_t p_visible_layers) {
+	if (shadow_cull_passes.is_empty()) {
+		return;
+	}
 
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
-				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	RENDER_TIMESTAMP("Cull Light3D Shadows");
+
+	// The passes only read the scenario, so the shadows of every light are culled at once.
+	ShadowCullData cull_data;
+	cull_data.scenario = p_scenario;
+	cull_data.visible_layers = p_visible_layers;
+
+	if (shadow_cull_passes.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_light_shadow_pass_cull, &cull_data, shadow_cull_passes.size(), -1, true, SNAME("CullLightShadows"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_light_shadow_pass_cull(0, &cull_data);
+	}
+
+	// Tighter caster culling and mesh instance updates are not thread safe, finish each pass in order.
+	Instance *prepared_light = nullptr;
+	for (uint32_t i = 0; i < shadow_cull_passes.size(); i++) {
+		const ShadowCullPass &shadow_pass = shadow_cull_passes[i];
+		InstanceLightData *light = static_cast<InstanceLightData *>(shadow_pass.light->base_data);
+		PagedArray<Instance *> &cull_result = shadow_pass_cull_results[i];
+
+		if (!light->is_shadow_update_full()) {
+			if (prepared_light != shadow_pass.light) {
+				light_culler->prepare_regular_light(*shadow_pass.light);
+				prepared_light = shadow_pass.light;
 			}
+			light_culler->cull_regular_light(cull_result);
+		}
 
-			RSG::mesh_storage->update_mesh_instances();
+		RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[shadow_pass.shadow_index];
+		bool animated_material_found = false;
 
-			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
-			shadow_data.light = light->instance;
-			shadow_data.pass = 0;
+		for (uint32_t j = 0; j < cull_result.size(); j++) {
+			Instance *instance = cull_result[j];
+			if (instance->mesh_instance.is_valid()) {
+				RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
+			}
+			InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+			if (geom->material_is_animated) {
+				animated_material_found = true;
+			}
+			shadow_data.instances.push_back(geom->geometry_instance);
+		}
+		cull_result.clear();
 
-		} break;
+		RSG::light_storage->light_instance_set_shadow_transform(light->instance, shadow_pass.projection, shadow_pass.transform, shadow_pass.radius, 0, shadow_pass.pass, 0);
+		shadow_data.light = light->instance;
+		shadow_data.pass = shadow_pass.pass;
+
+		if (animated_material_found) {
+			// Animated materials need the shadow to be drawn again next frame.
+			light->make_shadow_dirty();
+		}
 	}
 
-	return animated_material_found;
+	RSG::mesh_storage->update_mesh_instances();
+
+	shadow_cull_passes.clear();
 }
 
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
@@ -2772,13 +2911,14 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
 #define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_CAMERA_FRUSTUM (_instance_in_camera_frustum(cull_data.scenario->instance_aabbs[i], cull_data.cull->frustum, idata))
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_CAMERA_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -2847,8 +2987,11 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 							//but if nothing is going on, don't do it.
 							keep = false;
 						} else {
+							const InstanceBounds &bounds = cull_data.scenario->instance_aabbs[i];
+							Vector3 center = Vector3(bounds.bounds[0] + bounds.bounds[3], bounds.bounds[1] + bounds.bounds[4], bounds.bounds[2] + bounds.bounds[5]) * 0.5;
 							cull_data.cull->lock.lock();
 							RSG::particles_storage->particles_request_process(idata.base_rid);
+							RSG::particles_storage->particles_set_view_distance(idata.base_rid, cull_data.cam_transform.origin.distance_to(center));
 							cull_data.cull->lock.unlock();
 							RSG::particles_storage->particles_set_view_axis(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized());
 							//particles visible? request redraw
@@ -2979,6 +3122,15 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && LAYER_CHECK) {
 							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
 							mesh_visible = true;
+
+							if (directional_shadow_cache_cascades) {
+								uint64_t caster_hash = hash_murmur3_one_64(idata.instance->version, hash_murmur3_one_64((uint64_t)idata.instance));
+								if (base_type == RS::INSTANCE_PARTICLES || (idata.flags & InstanceData::FLAG_USES_MESH_INSTANCE)) {
+									// Skinned, blend shape and particle casters change shape without a new version.
+									caster_hash = hash_murmur3_one_64(frame_number, caster_hash);
+								}
+								cull_result.directional_shadows[j].cascade_caster_hash[k] += caster_hash;
+							}
 						}
 					}
 				}
@@ -2988,6 +3140,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
 #undef IN_FRUSTUM
+#undef IN_CAMERA_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
@@ -3209,11 +3362,34 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				const Cull::Shadow::Cascade &c = cull.shadows[i].cascades[j];
 				//			print_line("shadow " + itos(i) + " cascade " + itos(j) + " elements: " + itos(c.cull_result.size()));
 				RSG::light_storage->light_instance_set_shadow_transform(cull.shadows[i].light_instance, c.projection, c.transform, c.zfar, c.split, j, c.shadow_texel_size, c.bias_scale, c.range_begin, c.uv_scale);
+				InstanceLightData *light = static_cast<InstanceLightData *>(cull.shadows[i].instance->base_data);
+				InstanceLightData::DirectionalCascadeCache &cache = light->directional_cascade_cache[j];
 				if (max_shadows_used == MAX_UPDATE_SHADOWS) {
+					cache.valid = false;
 					continue;
 				}
+
+				bool cached = false;
+				if (directional_shadow_cache_cascades) {
+					// A cascade only needs rendering again when its view, its casters, the light or its atlas slot changed.
+					// The renderer itself drops cached cascades when the atlas texture is recreated.
+					uint64_t caster_hash = scene_cull_result.directional_shadows[i].cascade_caster_hash[j];
+					uint64_t light_version = cull.shadows[i].instance->version;
+					cached = cache.valid && cache.caster_hash == caster_hash && cache.light_version == light_version && cache.shadow_index == i && cache.shadow_count == cull.shadow_count && cache.projection == c.projection && cache.transform == c.transform;
+
+					cache.projection = c.projection;
+					cache.transform = c.transform;
+					cache.caster_hash = caster_hash;
+					cache.light_version = light_version;
+					cache.shadow_index = i;
+					cache.shadow_count = cull.shadow_count;
+					cache.valid = true;
+				}
+
 				render_shadow_data[max_shadows_used].light = cull.shadows[i].light_instance;
 				render_shadow_data[max_shadows_used].pass = j;
+				render_shadow_data[max_shadows_used].cached = cached;
+				// Instances are still passed, renderers that don't keep the atlas between frames render them anyway.
 				render_shadow_data[max_shadows_used].instances.merge_unordered(scene_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
 				max_shadows_used++;
 			}
@@ -3330,17 +3506,17 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 			if (redraw && max_shadows_used < MAX_UPDATE_SHADOWS) {
 				//must redraw!
-				RENDER_TIMESTAMP("> Render Light3D " + itos(i));
-				if (_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold, p_visible_layers)) {
+				if (_light_instance_setup_shadow(ins)) {
 					light->make_shadow_dirty();
 				}
-				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
 			} else {
 				if (redraw) {
 					light->make_shadow_dirty();
 				}
 			}
 		}
+
+		_light_instances_cull_shadows(scenario, p_visible_layers);
 	}
 
 	//render SDFGI
@@ -4106,7 +4282,19 @@ void RendererSceneCull::update_dirty_instances() {
 	RSG::utilities->update_dirty_resources();
 }
 
+void RendererSceneCull::tick() {
+	// The transforms reached at the end of the last tick are where the next one starts from.
+	for (SelfList<Instance> *E = _instance_interpolate_list.first(); E; E = E->next()) {
+		E->self()->transform_prev = E->self()->transform_curr;
+	}
+	for (SelfList<Camera> *E = _camera_interpolate_list.first(); E; E = E->next()) {
+		E->self()->transform_prev = E->self()->transform_curr;
+	}
+}
+
 void RendererSceneCull::update() {
+	_update_interpolated_transforms();
+
 	//optimize bvhs
 
 	uint32_t rid_count = scenario_owner.get_rid_count();
@@ -4223,10 +4411,10 @@ RendererSceneCull::RendererSceneCull() {
 	singleton = this;
 
 	instance_cull_result.set_page_pool(&instance_cull_page_pool);
-	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		shadow_pass_cull_results[i].set_page_pool(&instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4246,6 +4434,8 @@ RendererSceneCull::RendererSceneCull() {
 
 	light_culler = memnew(RenderingLightCuller);
 
+	directional_shadow_cache_cascades = GLOBAL_GET("rendering/lights_and_shadows/directional_shadow/cache_unchanged_cascades");
+
 	bool tighter_caster_culling = GLOBAL_DEF("rendering/lights_and_shadows/tighter_shadow_caster_culling", true);
 	light_culler->set_caster_culling_active(tighter_caster_culling);
 	light_culler->set_light_culling_active(tighter_caster_culling);
@@ -4253,10 +4443,10 @@ RendererSceneCull::RendererSceneCull() {
 
 RendererSceneCull::~RendererSceneCull() {
 	instance_cull_result.reset();
-	instance_shadow_cull_result.reset();
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		shadow_pass_cull_results[i].reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -84,7 +84,14 @@ public:
 
 		Transform3D transform;
 
-		Camera() {
+		// Physics interpolation, transform is drawn between these two.
+		bool interpolated = false;
+		Transform3D transform_prev;
+		Transform3D transform_curr;
+		SelfList<Camera> interpolate_item;
+
+		Camera() :
+				interpolate_item(this) {
 			visible_layers = 0xFFFFFFFF;
 			fov = 75;
 			type = PERSPECTIVE;
@@ -97,6 +104,7 @@ public:
 	};
 
 	mutable RID_Owner<Camera, true> camera_owner;
+	SelfList<Camera>::List _camera_interpolate_list;
 
 	virtual RID camera_allocate();
 	virtual void camera_initialize(RID p_rid);
@@ -105,6 +113,8 @@ public:
 	virtual void camera_set_orthogonal(RID p_camera, float p_size, float p_z_near, float p_z_far);
 	virtual void camera_set_frustum(RID p_camera, float p_size, Vector2 p_offset, float p_z_near, float p_z_far);
 	virtual void camera_set_transform(RID p_camera, const Transform3D &p_transform);
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated);
+	virtual void camera_reset_physics_interpolation(RID p_camera);
 	virtual void camera_set_cull_mask(RID p_camera, uint32_t p_layers);
 	virtual void camera_set_environment(RID p_camera, RID p_env);
 	virtual void camera_set_camera_attributes(RID p_camera, RID p_attributes);
@@ -219,6 +229,31 @@ public:
 
 			return true;
 		}
+		_ALWAYS_INLINE_ bool in_frustum_coherent(const Frustum &p_frustum, uint32_t &r_plane_hint) const {
+			// Same check as in_frustum(), but the plane that culled these bounds last time is tested first.
+			// While the camera moves, it is usually still the one culling them, so most culled instances need a single plane test.
+
+			if (r_plane_hint < p_frustum.plane_count && _outside_plane(p_frustum, r_plane_hint)) {
+				return false;
+			}
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				if (i != r_plane_hint && _outside_plane(p_frustum, i)) {
+					r_plane_hint = i;
+					return false;
+				}
+			}
+
+			return true;
+		}
+		_ALWAYS_INLINE_ bool _outside_plane(const Frustum &p_frustum, uint32_t p_plane) const {
+			Vector3 min(
+					bounds[p_frustum.plane_signs_ptr[p_plane].signs[0]],
+					bounds[p_frustum.plane_signs_ptr[p_plane].signs[1]],
+					bounds[p_frustum.plane_signs_ptr[p_plane].signs[2]]);
+
+			return p_frustum.planes_ptr[p_plane].distance_to(min) >= 0.0;
+		}
 		_ALWAYS_INLINE_ bool in_aabb(const AABB &p_aabb) const {
 			Vector3 end = p_aabb.position + p_aabb.size;
 
@@ -270,6 +305,8 @@ public:
 			FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN = (1 << 22),
 			FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY = (1 << 23),
 			FLAG_IGNORE_ALL_CULLING = (1 << 24),
+			FLAG_CULL_PLANE_HINT_SHIFT = 25, // Camera frustum plane that culled the instance last, see InstanceBounds::in_frustum_coherent().
+			FLAG_CULL_PLANE_HINT_MASK = (7 << 25),
 		};
 
 		uint32_t flags = 0;
@@ -462,6 +499,12 @@ public:
 
 		SelfList<Instance> update_item;
 
+		// Physics interpolation, transform is drawn between these two.
+		bool interpolated = false;
+		Transform3D transform_prev;
+		Transform3D transform_curr;
+		SelfList<Instance> interpolate_item;
+
 		AABB *custom_aabb = nullptr; // <Zylann> would using aabb directly with a bool be better?
 		float extra_margin;
 		ObjectID object_id;
@@ -555,7 +598,8 @@ public:
 
 		Instance() :
 				scenario_item(this),
-				update_item(this) {
+				update_item(this),
+				interpolate_item(this) {
 			base_type = RS::INSTANCE_NONE;
 			cast_shadows = RS::SHADOW_CASTING_SETTING_ON;
 			receive_shadows = true;
@@ -612,6 +656,11 @@ public:
 	SelfList<Instance>::List _instance_update_list;
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_dependencies = false);
 
+	// Interpolated instances whose previous and current transforms may still differ.
+	SelfList<Instance>::List _instance_interpolate_list;
+	void _instance_set_interpolated_transform(Instance *p_instance, const Transform3D &p_transform);
+	void _update_interpolated_transforms();
+
 	struct InstanceGeometryData : public InstanceBaseData {
 		RenderGeometryInstance *geometry_instance = nullptr;
 		HashSet<Instance *> lights;
@@ -692,6 +741,17 @@ public:
 
 		Instance *baked_light = nullptr;
 
+		// What each directional cascade was last rendered with, so unchanged cascades can keep their atlas contents.
+		struct DirectionalCascadeCache {
+			Projection projection;
+			Transform3D transform;
+			uint64_t caster_hash = 0;
+			uint64_t light_version = 0;
+			uint32_t shadow_index = 0;
+			uint32_t shadow_count = 0;
+			bool valid = false;
+		} directional_cascade_cache[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+
 		RS::LightBakeMode bake_mode;
 		uint32_t max_sdfgi_cascade = 2;
 
@@ -869,7 +929,6 @@ public:
 	PagedArrayPool<RID> rid_cull_page_pool;
 
 	PagedArray<Instance *> instance_cull_result;
-	PagedArray<Instance *> instance_shadow_cull_result;
 
 	struct InstanceCullResult {
 		PagedArray<RenderGeometryInstance *> geometry_instances;
@@ -884,6 +943,8 @@ public:
 
 		struct DirectionalShadow {
 			PagedArray<RenderGeometryInstance *> cascade_geometry_instances[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+			// Order independent sum of caster hashes, only filled when cascade caching is enabled.
+			uint64_t cascade_caster_hash[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {};
 		} directional_shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
 		PagedArray<RenderGeometryInstance *> sdfgi_region_geometry_instances[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
@@ -902,6 +963,7 @@ public:
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].clear();
+					directional_shadows[i].cascade_caster_hash[j] = 0;
 				}
 			}
 
@@ -953,6 +1015,7 @@ public:
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].merge_unordered(p_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
+					directional_shadows[i].cascade_caster_hash[j] += p_cull_result.directional_shadows[i].cascade_caster_hash[j];
 				}
 			}
 
@@ -1001,6 +1064,7 @@ public:
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
+	bool directional_shadow_cache_cascades = false;
 
 	RID_Owner<Instance, true> instance_owner;
 
@@ -1017,6 +1081,9 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1066,7 +1133,28 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
-	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
+	// Shadow passes of the positional lights to update, culled together once all of them are known.
+	struct ShadowCullPass {
+		Instance *light = nullptr;
+		uint32_t shadow_index = 0; // In render_shadow_data.
+		uint32_t pass = 0;
+		Vector<Plane> planes;
+		Projection projection;
+		Transform3D transform;
+		real_t radius = 0;
+	};
+
+	struct ShadowCullData {
+		Scenario *scenario = nullptr;
+		uint32_t visible_layers = 0;
+	};
+
+	LocalVector<ShadowCullPass> shadow_cull_passes;
+	PagedArray<Instance *> shadow_pass_cull_results[MAX_UPDATE_SHADOWS];
+
+	bool _light_instance_setup_shadow(Instance *p_instance);
+	void _light_shadow_pass_cull(uint32_t p_index, ShadowCullData *p_cull_data);
+	void _light_instances_cull_shadows(Scenario *p_scenario, uint32_t p_visible_layers);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
 	RID _render_get_compositor(RID p_camera, RID p_scenario);
@@ -1074,6 +1162,7 @@ public:
 	struct Cull {
 		struct Shadow {
 			RID light_instance;
+			Instance *instance = nullptr;
 			struct Cascade {
 				Frustum frustum;
 
@@ -1136,6 +1225,15 @@ public:
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
+	_FORCE_INLINE_ static bool _instance_in_camera_frustum(const InstanceBounds &p_bounds, const Frustum &p_frustum, InstanceData &r_data) {
+		uint32_t hint = (r_data.flags & InstanceData::FLAG_CULL_PLANE_HINT_MASK) >> InstanceData::FLAG_CULL_PLANE_HINT_SHIFT;
+		uint32_t plane = hint;
+		bool inside = p_bounds.in_frustum_coherent(p_frustum, plane);
+		if (plane != hint && plane < 8) {
+			r_data.flags = (r_data.flags & ~uint32_t(InstanceData::FLAG_CULL_PLANE_HINT_MASK)) | (plane << InstanceData::FLAG_CULL_PLANE_HINT_SHIFT);
+		}
+		return inside;
+	}
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
 	bool _render_reflection_probe_step(Instance *p_instance, int p_step);
@@ -1375,6 +1473,7 @@ public:
 	PASS1(decals_set_filter, RS::DecalFilter)
 	PASS1(light_projectors_set_filter, RS::LightProjectorFilter)
 
+	virtual void tick();
 	virtual void update();
 
 	bool free(RID p_rid);
@@ -275,6 +275,7 @@ public:
 		RID light;
 		int pass = 0;
 		PagedArray<RenderGeometryInstance *> instances;
+		bool cached = false; // Directional cascade unchanged since it was last rendered, the atlas still holds it.
 	};
 
 	struct RenderSDFGIData {
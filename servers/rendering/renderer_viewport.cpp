@@ -110,6 +110,9 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 		} else {
 			const float EPSILON = 0.0001;
 			float scaling_3d_scale = p_viewport->scaling_3d_scale;
+			if (p_viewport->scaling_3d_dynamic_target_time > 0.0) {
+				scaling_3d_scale *= p_viewport->scaling_3d_dynamic_scale;
+			}
 			RS::ViewportScaling3DMode scaling_3d_mode = p_viewport->scaling_3d_mode;
 			bool upscaler_available = p_viewport->fsr_enabled;
 
@@ -249,7 +252,7 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 }
 
 void RendererViewport::_draw_viewport(Viewport *p_viewport) {
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->scaling_3d_dynamic_target_time > 0.0) {
 		String rt_id = "vp_begin_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -619,7 +622,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		RSG::texture_storage->render_target_do_msaa_resolve(p_viewport->render_target);
 	}
 
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->scaling_3d_dynamic_target_time > 0.0) {
 		String rt_id = "vp_end_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -906,6 +909,56 @@ void RendererViewport::viewport_set_scaling_3d_scale(RID p_viewport, float p_sca
 	_configure_3d_render_buffers(viewport);
 }
 
+void RendererViewport::viewport_set_scaling_3d_dynamic_target_time(RID p_viewport, float p_target_time_msec) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	float target_time = MAX(p_target_time_msec, 0.0);
+	if (viewport->scaling_3d_dynamic_target_time == target_time) {
+		return;
+	}
+
+	viewport->scaling_3d_dynamic_target_time = target_time;
+	// Start again from the full scale.
+	viewport->scaling_3d_dynamic_scale = 1.0;
+	viewport->scaling_3d_dynamic_scale_unsnapped = 1.0;
+	_configure_3d_render_buffers(viewport);
+}
+
+void RendererViewport::viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_min_scale) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	viewport->scaling_3d_dynamic_min_scale = CLAMP(p_min_scale, 0.1, 1.0);
+}
+
+void RendererViewport::_update_dynamic_scaling_3d(Viewport *p_viewport) {
+	if (p_viewport->scaling_3d_dynamic_target_time <= 0.0 || p_viewport->time_gpu_end <= p_viewport->time_gpu_begin) {
+		return;
+	}
+
+	const double gpu_time = double(p_viewport->time_gpu_end - p_viewport->time_gpu_begin) / 1000000.0;
+	const double target_time = p_viewport->scaling_3d_dynamic_target_time;
+
+	// Only scale up again once there is some headroom, so the scale doesn't oscillate around the target.
+	if (gpu_time < target_time && gpu_time > target_time * 0.85) {
+		return;
+	}
+
+	// GPU time is roughly proportional to the pixel count, so to the square of the scale.
+	float ideal_scale = p_viewport->scaling_3d_dynamic_scale * Math::sqrt(target_time / gpu_time);
+	float scale = Math::lerp(p_viewport->scaling_3d_dynamic_scale_unsnapped, ideal_scale, 0.25f);
+	scale = CLAMP(scale, p_viewport->scaling_3d_dynamic_min_scale, 1.0f);
+	p_viewport->scaling_3d_dynamic_scale_unsnapped = scale;
+
+	// Use coarse steps, as changing the scale reallocates the render buffers.
+	scale = CLAMP((float)Math::snapped(scale, 0.05), p_viewport->scaling_3d_dynamic_min_scale, 1.0f);
+	if (scale != p_viewport->scaling_3d_dynamic_scale) {
+		p_viewport->scaling_3d_dynamic_scale = scale;
+		_configure_3d_render_buffers(p_viewport);
+	}
+}
+
 void RendererViewport::viewport_set_size(RID p_viewport, int p_width, int p_height) {
 	ERR_FAIL_COND(p_width < 0 || p_height < 0);
 
@@ -1460,6 +1513,8 @@ void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time,
 	if (p_timestamp.begins_with("vp_end")) {
 		viewport->time_cpu_end = p_cpu_time;
 		viewport->time_gpu_end = p_gpu_time;
+
+		_update_dynamic_scaling_3d(viewport);
 	}
 }
 
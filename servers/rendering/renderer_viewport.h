@@ -60,6 +60,10 @@ public:
 
 		RS::ViewportScaling3DMode scaling_3d_mode = RenderingServer::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 		float scaling_3d_scale = 1.0;
+		float scaling_3d_dynamic_target_time = 0.0; // In milliseconds, 0 disables dynamic scaling.
+		float scaling_3d_dynamic_min_scale = 0.5;
+		float scaling_3d_dynamic_scale = 1.0; // Applied on top of scaling_3d_scale.
+		float scaling_3d_dynamic_scale_unsnapped = 1.0;
 		float fsr_sharpness = 0.2f;
 		float texture_mipmap_bias = 0.0f;
 		bool fsr_enabled = false;
@@ -206,6 +210,7 @@ private:
 	void _viewport_set_size(Viewport *p_viewport, int p_width, int p_height, uint32_t p_view_count);
 	bool _viewport_requires_motion_vectors(Viewport *p_viewport);
 	void _configure_3d_render_buffers(Viewport *p_viewport);
+	void _update_dynamic_scaling_3d(Viewport *p_viewport);
 	void _draw_3d(Viewport *p_viewport);
 	void _draw_viewport(Viewport *p_viewport);
 
@@ -229,6 +234,8 @@ public:
 
 	void viewport_set_scaling_3d_mode(RID p_viewport, RS::ViewportScaling3DMode p_mode);
 	void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale);
+	void viewport_set_scaling_3d_dynamic_target_time(RID p_viewport, float p_target_time_msec);
+	void viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_min_scale);
 	void viewport_set_fsr_sharpness(RID p_viewport, float p_sharpness);
 	void viewport_set_texture_mipmap_bias(RID p_viewport, float p_mipmap_bias);
 
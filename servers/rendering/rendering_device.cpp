@@ -241,6 +241,13 @@ Error RenderingDevice::_insert_staging_block() {
 	block.driver_id = driver->buffer_create(staging_buffer_block_size, RDD::BUFFER_USAGE_TRANSFER_FROM_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
 	ERR_FAIL_COND_V(!block.driver_id, ERR_CANT_CREATE);
 
+	// Keep the block mapped for its whole lifetime, so updates are a plain memcpy.
+	block.data_ptr = driver->buffer_map(block.driver_id);
+	if (block.data_ptr == nullptr) {
+		driver->buffer_free(block.driver_id);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "Failed to map staging buffer block.");
+	}
+
 	block.frame_used = 0;
 	block.fill_amount = 0;
 
@@ -416,16 +423,10 @@ Error RenderingDevice::_buffer_update(Buffer *p_buffer, RID p_buffer_id, size_t
 
 		_staging_buffer_execute_required_action(required_action);
 
-		// Map staging buffer (It's CPU and coherent).
-		uint8_t *data_ptr = driver->buffer_map(staging_buffer_blocks[staging_buffer_current].driver_id);
-		ERR_FAIL_NULL_V(data_ptr, ERR_CANT_CREATE);
-
-		// Copy to staging buffer.
+		// Copy to staging buffer (it's persistently mapped).
+		uint8_t *data_ptr = staging_buffer_blocks[staging_buffer_current].data_ptr;
 		memcpy(data_ptr + block_write_offset, p_data + submit_from, block_write_amount);
 
-		// Unmap.
-		driver->buffer_unmap(staging_buffer_blocks[staging_buffer_current].driver_id);
-
 		// Insert a command to copy this.
 		RDD::BufferCopyRegion region;
 		region.src_offset = block_write_offset;
@@ -544,24 +545,24 @@ Error RenderingDevice::buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_
 	return OK;
 }
 
-Vector<uint8_t> RenderingDevice::buffer_get_data(RID p_buffer, uint32_t p_offset, uint32_t p_size) {
-	_THREAD_SAFE_METHOD_
-
+Error RenderingDevice::_buffer_record_download(RID p_buffer, uint32_t p_offset, uint32_t p_size, DownloadRequest &r_request) {
 	Buffer *buffer = _get_buffer_from_owner(p_buffer);
 	if (!buffer) {
-		ERR_FAIL_V_MSG(Vector<uint8_t>(), "Buffer is either invalid or this type of buffer can't be retrieved. Only Index and Vertex buffers allow retrieving.");
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Buffer is either invalid or this type of buffer can't be retrieved. Only Index and Vertex buffers allow retrieving.");
 	}
 
+	ERR_FAIL_COND_V(p_offset >= buffer->size, ERR_INVALID_PARAMETER);
+
 	// Size of buffer to retrieve.
 	if (!p_size) {
-		p_size = buffer->size;
+		p_size = buffer->size - p_offset;
 	} else {
-		ERR_FAIL_COND_V_MSG(p_size + p_offset > buffer->size, Vector<uint8_t>(),
+		ERR_FAIL_COND_V_MSG(p_size + p_offset > buffer->size, ERR_INVALID_PARAMETER,
 				"Size is larger than the buffer.");
 	}
 
-	RDD::BufferID tmp_buffer = driver->buffer_create(buffer->size, RDD::BUFFER_USAGE_TRANSFER_TO_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
-	ERR_FAIL_COND_V(!tmp_buffer, Vector<uint8_t>());
+	RDD::BufferID tmp_buffer = driver->buffer_create(p_size, RDD::BUFFER_USAGE_TRANSFER_TO_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
+	ERR_FAIL_COND_V(!tmp_buffer, ERR_CANT_CREATE);
 
 	RDD::BufferCopyRegion region;
 	region.src_offset = p_offset;
@@ -569,26 +570,101 @@ Vector<uint8_t> RenderingDevice::buffer_get_data(RID p_buffer, uint32_t p_offset
 
 	draw_graph.add_buffer_get_data(buffer->driver_id, buffer->draw_tracker, tmp_buffer, region);
 
-	// Flush everything so memory can be safely mapped.
-	_flush_and_stall_for_all_frames();
+	r_request.buffer = tmp_buffer;
+	r_request.size = p_size;
+	return OK;
+}
 
-	uint8_t *buffer_mem = driver->buffer_map(tmp_buffer);
-	ERR_FAIL_NULL_V(buffer_mem, Vector<uint8_t>());
+Vector<uint8_t> RenderingDevice::_download_request_read(const DownloadRequest &p_request) {
+	const uint8_t *read_ptr = driver->buffer_map(p_request.buffer);
+	if (!read_ptr) {
+		driver->buffer_free(p_request.buffer);
+		ERR_FAIL_V(Vector<uint8_t>());
+	}
 
 	Vector<uint8_t> buffer_data;
-	{
-		buffer_data.resize(p_size);
-		uint8_t *w = buffer_data.ptrw();
-		memcpy(w, buffer_mem, p_size);
-	}
+	if (!p_request.texture) {
+		buffer_data.resize(p_request.size);
+		memcpy(buffer_data.ptrw(), read_ptr, p_request.size);
+	} else {
+		uint32_t tight_buffer_size = get_image_format_required_size(p_request.format, p_request.width, p_request.height, p_request.depth, p_request.mipmaps);
+		buffer_data.resize(tight_buffer_size);
+
+		uint8_t *write_ptr = buffer_data.ptrw();
 
-	driver->buffer_unmap(tmp_buffer);
+		uint32_t w = p_request.width;
+		uint32_t h = p_request.height;
+		uint32_t d = p_request.depth;
+		for (uint32_t i = 0; i < p_request.mipmaps; i++) {
+			uint32_t width = 0, height = 0, depth = 0;
+			uint32_t tight_mip_size = get_image_format_required_size(p_request.format, w, h, d, 1, &width, &height, &depth);
+			uint32_t block_w = 0, block_h = 0;
+			get_compressed_image_format_block_dimensions(p_request.format, block_w, block_h);
+			uint32_t tight_row_pitch = tight_mip_size / ((height / block_h) * depth);
+
+			// Copy row-by-row to erase padding due to alignments.
+			const uint8_t *rp = read_ptr;
+			uint8_t *wp = write_ptr;
+			for (uint32_t row = h * d / block_h; row != 0; row--) {
+				memcpy(wp, rp, tight_row_pitch);
+				rp += p_request.mip_layouts[i].row_pitch;
+				wp += tight_row_pitch;
+			}
+
+			w = MAX(1u, w >> 1);
+			h = MAX(1u, h >> 1);
+			d = MAX(1u, d >> 1);
+			read_ptr += p_request.mip_layouts[i].size;
+			write_ptr += tight_mip_size;
+		}
+	}
 
-	driver->buffer_free(tmp_buffer);
+	driver->buffer_unmap(p_request.buffer);
+	driver->buffer_free(p_request.buffer);
 
 	return buffer_data;
 }
 
+void RenderingDevice::_resolve_downloads(int p_frame) {
+	while (frames[p_frame].download_requests.front()) {
+		DownloadRequest &request = frames[p_frame].download_requests.front()->get();
+
+		Vector<uint8_t> data = _download_request_read(request);
+		if (request.callback.is_valid()) {
+			// Deferred, so the callback never runs in the middle of frame setup.
+			request.callback.call_deferred(data);
+		}
+
+		frames[p_frame].download_requests.pop_front();
+	}
+}
+
+Vector<uint8_t> RenderingDevice::buffer_get_data(RID p_buffer, uint32_t p_offset, uint32_t p_size) {
+	_THREAD_SAFE_METHOD_
+
+	DownloadRequest request;
+	ERR_FAIL_COND_V(_buffer_record_download(p_buffer, p_offset, p_size, request) != OK, Vector<uint8_t>());
+
+	// Flush everything so memory can be safely mapped.
+	_flush_and_stall_for_all_frames();
+
+	return _download_request_read(request);
+}
+
+Error RenderingDevice::buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset, uint32_t p_size) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+
+	DownloadRequest request;
+	Error err = _buffer_record_download(p_buffer, p_offset, p_size, request);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	request.callback = p_callback;
+	frames[frame].download_requests.push_back(request);
+	return OK;
+}
+
 RID RenderingDevice::storage_buffer_create(uint32_t p_size_bytes, const Vector<uint8_t> &p_data, BitField<StorageBufferUsage> p_usage) {
 	_THREAD_SAFE_METHOD_
 
@@ -1154,14 +1230,7 @@ Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Ve
 
 					_staging_buffer_execute_required_action(required_action);
 
-					uint8_t *write_ptr;
-
-					{ // Map.
-						uint8_t *data_ptr = driver->buffer_map(staging_buffer_blocks[staging_buffer_current].driver_id);
-						ERR_FAIL_NULL_V(data_ptr, ERR_CANT_CREATE);
-						write_ptr = data_ptr;
-						write_ptr += alloc_offset;
-					}
+					uint8_t *write_ptr = staging_buffer_blocks[staging_buffer_current].data_ptr + alloc_offset;
 
 					ERR_FAIL_COND_V(region_w % block_w, ERR_BUG);
 					ERR_FAIL_COND_V(region_h % block_h, ERR_BUG);
@@ -1185,10 +1254,6 @@ Error RenderingDevice::_texture_update(RID p_texture, uint32_t p_layer, const Ve
 						_copy_region(read_ptr, write_ptr, x, y, region_w, region_h, width, region_pitch, pixel_size);
 					}
 
-					{ // Unmap.
-						driver->buffer_unmap(staging_buffer_blocks[staging_buffer_current].driver_id);
-					}
-
 					RDD::BufferTextureCopyRegion copy_region;
 					copy_region.buffer_offset = alloc_offset;
 					copy_region.texture_subresources.aspect = texture->read_aspect_flags;
@@ -1306,120 +1371,133 @@ Vector<uint8_t> RenderingDevice::_texture_get_data(Texture *tex, uint32_t p_laye
 	return image_data;
 }
 
-Vector<uint8_t> RenderingDevice::texture_get_data(RID p_texture, uint32_t p_layer) {
-	_THREAD_SAFE_METHOD_
-
+RenderingDevice::Texture *RenderingDevice::_texture_get_for_download(RID p_texture, uint32_t p_layer) {
 	Texture *tex = texture_owner.get_or_null(p_texture);
-	ERR_FAIL_NULL_V(tex, Vector<uint8_t>());
+	ERR_FAIL_NULL_V(tex, nullptr);
 
-	ERR_FAIL_COND_V_MSG(tex->bound, Vector<uint8_t>(),
+	ERR_FAIL_COND_V_MSG(tex->bound, nullptr,
 			"Texture can't be retrieved while a draw list that uses it as part of a framebuffer is being created. Ensure the draw list is finalized (and that the color/depth texture using it is not set to `RenderingDevice.FINAL_ACTION_CONTINUE`) to retrieve this texture.");
-	ERR_FAIL_COND_V_MSG(!(tex->usage_flags & TEXTURE_USAGE_CAN_COPY_FROM_BIT), Vector<uint8_t>(),
+	ERR_FAIL_COND_V_MSG(!(tex->usage_flags & TEXTURE_USAGE_CAN_COPY_FROM_BIT), nullptr,
 			"Texture requires the `RenderingDevice.TEXTURE_USAGE_CAN_COPY_FROM_BIT` to be set to be retrieved.");
 
 	uint32_t layer_count = tex->layers;
 	if (tex->type == TEXTURE_TYPE_CUBE || tex->type == TEXTURE_TYPE_CUBE_ARRAY) {
 		layer_count *= 6;
 	}
-	ERR_FAIL_COND_V(p_layer >= layer_count, Vector<uint8_t>());
+	ERR_FAIL_COND_V(p_layer >= layer_count, nullptr);
 
-	if ((tex->usage_flags & TEXTURE_USAGE_CPU_READ_BIT)) {
-		// Does not need anything fancy, map and read.
-		return _texture_get_data(tex, p_layer);
-	} else {
-		LocalVector<RDD::TextureCopyableLayout> mip_layouts;
-		uint32_t work_mip_alignment = driver->api_trait_get(RDD::API_TRAIT_TEXTURE_TRANSFER_ALIGNMENT);
-		uint32_t work_buffer_size = 0;
-		mip_layouts.resize(tex->mipmaps);
-		for (uint32_t i = 0; i < tex->mipmaps; i++) {
-			RDD::TextureSubresource subres;
-			subres.aspect = RDD::TEXTURE_ASPECT_COLOR;
-			subres.layer = p_layer;
-			subres.mipmap = i;
-			driver->texture_get_copyable_layout(tex->driver_id, subres, &mip_layouts[i]);
+	return tex;
+}
 
-			// Assuming layers are tightly packed. If this is not true on some driver, we must modify the copy algorithm.
-			DEV_ASSERT(mip_layouts[i].layer_pitch == mip_layouts[i].size / layer_count);
+Error RenderingDevice::_texture_record_download(Texture *p_tex, RID p_texture, uint32_t p_layer, DownloadRequest &r_request) {
+	uint32_t layer_count = p_tex->layers;
+	if (p_tex->type == TEXTURE_TYPE_CUBE || p_tex->type == TEXTURE_TYPE_CUBE_ARRAY) {
+		layer_count *= 6;
+	}
 
-			work_buffer_size = STEPIFY(work_buffer_size, work_mip_alignment) + mip_layouts[i].size;
-		}
+	LocalVector<RDD::TextureCopyableLayout> &mip_layouts = r_request.mip_layouts;
+	uint32_t work_mip_alignment = driver->api_trait_get(RDD::API_TRAIT_TEXTURE_TRANSFER_ALIGNMENT);
+	uint32_t work_buffer_size = 0;
+	mip_layouts.resize(p_tex->mipmaps);
+	for (uint32_t i = 0; i < p_tex->mipmaps; i++) {
+		RDD::TextureSubresource subres;
+		subres.aspect = RDD::TEXTURE_ASPECT_COLOR;
+		subres.layer = p_layer;
+		subres.mipmap = i;
+		driver->texture_get_copyable_layout(p_tex->driver_id, subres, &mip_layouts[i]);
 
-		RDD::BufferID tmp_buffer = driver->buffer_create(work_buffer_size, RDD::BUFFER_USAGE_TRANSFER_TO_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
-		ERR_FAIL_COND_V(!tmp_buffer, Vector<uint8_t>());
-
-		thread_local LocalVector<RDD::BufferTextureCopyRegion> command_buffer_texture_copy_regions_vector;
-		command_buffer_texture_copy_regions_vector.clear();
-
-		uint32_t w = tex->width;
-		uint32_t h = tex->height;
-		uint32_t d = tex->depth;
-		for (uint32_t i = 0; i < tex->mipmaps; i++) {
-			RDD::BufferTextureCopyRegion copy_region;
-			copy_region.buffer_offset = mip_layouts[i].offset;
-			copy_region.texture_subresources.aspect = tex->read_aspect_flags;
-			copy_region.texture_subresources.mipmap = i;
-			copy_region.texture_subresources.base_layer = p_layer;
-			copy_region.texture_subresources.layer_count = 1;
-			copy_region.texture_region_size.x = w;
-			copy_region.texture_region_size.y = h;
-			copy_region.texture_region_size.z = d;
-			command_buffer_texture_copy_regions_vector.push_back(copy_region);
+		// Assuming layers are tightly packed. If this is not true on some driver, we must modify the copy algorithm.
+		DEV_ASSERT(mip_layouts[i].layer_pitch == mip_layouts[i].size / layer_count);
 
-			w = MAX(1u, w >> 1);
-			h = MAX(1u, h >> 1);
-			d = MAX(1u, d >> 1);
-		}
+		work_buffer_size = STEPIFY(work_buffer_size, work_mip_alignment) + mip_layouts[i].size;
+	}
 
-		if (_texture_make_mutable(tex, p_texture)) {
-			// The texture must be mutable to be used as a copy source due to layout transitions.
-			draw_graph.add_synchronization();
-		}
+	RDD::BufferID tmp_buffer = driver->buffer_create(work_buffer_size, RDD::BUFFER_USAGE_TRANSFER_TO_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
+	ERR_FAIL_COND_V(!tmp_buffer, ERR_CANT_CREATE);
 
-		draw_graph.add_texture_get_data(tex->driver_id, tex->draw_tracker, tmp_buffer, command_buffer_texture_copy_regions_vector);
+	thread_local LocalVector<RDD::BufferTextureCopyRegion> command_buffer_texture_copy_regions_vector;
+	command_buffer_texture_copy_regions_vector.clear();
 
-		// Flush everything so memory can be safely mapped.
-		_flush_and_stall_for_all_frames();
+	uint32_t w = p_tex->width;
+	uint32_t h = p_tex->height;
+	uint32_t d = p_tex->depth;
+	for (uint32_t i = 0; i < p_tex->mipmaps; i++) {
+		RDD::BufferTextureCopyRegion copy_region;
+		copy_region.buffer_offset = mip_layouts[i].offset;
+		copy_region.texture_subresources.aspect = p_tex->read_aspect_flags;
+		copy_region.texture_subresources.mipmap = i;
+		copy_region.texture_subresources.base_layer = p_layer;
+		copy_region.texture_subresources.layer_count = 1;
+		copy_region.texture_region_size.x = w;
+		copy_region.texture_region_size.y = h;
+		copy_region.texture_region_size.z = d;
+		command_buffer_texture_copy_regions_vector.push_back(copy_region);
 
-		const uint8_t *read_ptr = driver->buffer_map(tmp_buffer);
-		ERR_FAIL_NULL_V(read_ptr, Vector<uint8_t>());
+		w = MAX(1u, w >> 1);
+		h = MAX(1u, h >> 1);
+		d = MAX(1u, d >> 1);
+	}
 
-		Vector<uint8_t> buffer_data;
-		uint32_t tight_buffer_size = get_image_format_required_size(tex->format, tex->width, tex->height, tex->depth, tex->mipmaps);
-		buffer_data.resize(tight_buffer_size);
+	if (_texture_make_mutable(p_tex, p_texture)) {
+		// The texture must be mutable to be used as a copy source due to layout transitions.
+		draw_graph.add_synchronization();
+	}
 
-		uint8_t *write_ptr = buffer_data.ptrw();
+	draw_graph.add_texture_get_data(p_tex->driver_id, p_tex->draw_tracker, tmp_buffer, command_buffer_texture_copy_regions_vector);
 
-		w = tex->width;
-		h = tex->height;
-		d = tex->depth;
-		for (uint32_t i = 0; i < tex->mipmaps; i++) {
-			uint32_t width = 0, height = 0, depth = 0;
-			uint32_t tight_mip_size = get_image_format_required_size(tex->format, w, h, d, 1, &width, &height, &depth);
-			uint32_t block_w = 0, block_h = 0;
-			get_compressed_image_format_block_dimensions(tex->format, block_w, block_h);
-			uint32_t tight_row_pitch = tight_mip_size / ((height / block_h) * depth);
+	// Keep what's needed to read it back, the texture may be gone by then.
+	r_request.buffer = tmp_buffer;
+	r_request.size = work_buffer_size;
+	r_request.texture = true;
+	r_request.format = p_tex->format;
+	r_request.width = p_tex->width;
+	r_request.height = p_tex->height;
+	r_request.depth = p_tex->depth;
+	r_request.mipmaps = p_tex->mipmaps;
+	return OK;
+}
 
-			// Copy row-by-row to erase padding due to alignments.
-			const uint8_t *rp = read_ptr;
-			uint8_t *wp = write_ptr;
-			for (uint32_t row = h * d / block_h; row != 0; row--) {
-				memcpy(wp, rp, tight_row_pitch);
-				rp += mip_layouts[i].row_pitch;
-				wp += tight_row_pitch;
-			}
+Vector<uint8_t> RenderingDevice::texture_get_data(RID p_texture, uint32_t p_layer) {
+	_THREAD_SAFE_METHOD_
 
-			w = MAX(1u, w >> 1);
-			h = MAX(1u, h >> 1);
-			d = MAX(1u, d >> 1);
-			read_ptr += mip_layouts[i].size;
-			write_ptr += tight_mip_size;
-		}
+	Texture *tex = _texture_get_for_download(p_texture, p_layer);
+	ERR_FAIL_NULL_V(tex, Vector<uint8_t>());
+
+	if ((tex->usage_flags & TEXTURE_USAGE_CPU_READ_BIT)) {
+		// Does not need anything fancy, map and read.
+		return _texture_get_data(tex, p_layer);
+	} else {
+		DownloadRequest request;
+		ERR_FAIL_COND_V(_texture_record_download(tex, p_texture, p_layer, request) != OK, Vector<uint8_t>());
+
+		// Flush everything so memory can be safely mapped.
+		_flush_and_stall_for_all_frames();
 
-		driver->buffer_unmap(tmp_buffer);
-		driver->buffer_free(tmp_buffer);
+		return _download_request_read(request);
+	}
+}
 
-		return buffer_data;
+Error RenderingDevice::texture_get_data_async(RID p_texture, uint32_t p_layer, const Callable &p_callback) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+
+	Texture *tex = _texture_get_for_download(p_texture, p_layer);
+	ERR_FAIL_NULL_V(tex, ERR_INVALID_PARAMETER);
+
+	if ((tex->usage_flags & TEXTURE_USAGE_CPU_READ_BIT)) {
+		// Already readable, but still deliver it the same way callers expect.
+		p_callback.call_deferred(_texture_get_data(tex, p_layer));
+		return OK;
 	}
+
+	DownloadRequest request;
+	Error err = _texture_record_download(tex, p_texture, p_layer, request);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	request.callback = p_callback;
+	frames[frame].download_requests.push_back(request);
+	return OK;
 }
 
 bool RenderingDevice::texture_is_shared(RID p_texture) {
@@ -1977,6 +2055,30 @@ RenderingDevice::TextureSamples RenderingDevice::framebuffer_format_get_texture_
 	return E->value.pass_samples[p_pass];
 }
 
+Vector<RenderingDevice::AttachmentFormat> RenderingDevice::framebuffer_format_get_attachments(FramebufferFormatID p_format) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<FramebufferFormatID, FramebufferFormat>::Iterator E = framebuffer_formats.find(p_format);
+	ERR_FAIL_COND_V(!E, Vector<AttachmentFormat>());
+	return E->value.E->key().attachments;
+}
+
+Vector<RenderingDevice::FramebufferPass> RenderingDevice::framebuffer_format_get_passes(FramebufferFormatID p_format) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<FramebufferFormatID, FramebufferFormat>::Iterator E = framebuffer_formats.find(p_format);
+	ERR_FAIL_COND_V(!E, Vector<FramebufferPass>());
+	return E->value.E->key().passes;
+}
+
+uint32_t RenderingDevice::framebuffer_format_get_view_count(FramebufferFormatID p_format) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<FramebufferFormatID, FramebufferFormat>::Iterator E = framebuffer_formats.find(p_format);
+	ERR_FAIL_COND_V(!E, 1);
+	return E->value.E->key().view_count;
+}
+
 RID RenderingDevice::framebuffer_create_empty(const Size2i &p_size, TextureSamples p_samples, FramebufferFormatID p_format_check) {
 	_THREAD_SAFE_METHOD_
 	Framebuffer framebuffer;
@@ -2212,6 +2314,14 @@ RenderingDevice::VertexFormatID RenderingDevice::vertex_format_create(const Vect
 	return id;
 }
 
+Vector<RenderingDevice::VertexAttribute> RenderingDevice::vertex_format_get_attributes(VertexFormatID p_vertex_format) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<VertexFormatID, VertexDescriptionCache>::Iterator E = vertex_formats.find(p_vertex_format);
+	ERR_FAIL_COND_V(!E, Vector<VertexAttribute>());
+	return E->value.vertex_formats;
+}
+
 RID RenderingDevice::vertex_array_create(uint32_t p_vertex_count, VertexFormatID p_vertex_format, const Vector<RID> &p_src_buffers, const Vector<uint64_t> &p_offsets) {
 	_THREAD_SAFE_METHOD_
 
@@ -3014,20 +3124,51 @@ RID RenderingDevice::render_pipeline_create(RID p_shader, FramebufferFormatID p_
 	}
 
 	RenderPipeline pipeline;
-	pipeline.driver_id = driver->render_pipeline_create(
-			shader->driver_id,
-			driver_vertex_format,
-			p_render_primitive,
-			p_rasterization_state,
-			p_multisample_state,
-			p_depth_stencil_state,
-			p_blend_state,
-			pass.color_attachments,
-			p_dynamic_state_flags,
-			fb_format.render_pass,
-			p_for_render_pass,
-			p_specialization_constants);
-	ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+	if (driver->api_trait_get(RDD::API_TRAIT_PIPELINE_CREATION_THREAD_SAFE)) {
+		// Compiling the pipeline is by far the slowest part, don't block other threads using the device meanwhile.
+		// Everything the driver needs is copied, as the shader and formats may change while unlocked.
+		RDD::ShaderID shader_driver_id = shader->driver_id;
+		Vector<int32_t> color_attachments = pass.color_attachments;
+		RDD::RenderPassID render_pass = fb_format.render_pass;
+
+		_THREAD_SAFE_UNLOCK_
+		pipeline.driver_id = driver->render_pipeline_create(
+				shader_driver_id,
+				driver_vertex_format,
+				p_render_primitive,
+				p_rasterization_state,
+				p_multisample_state,
+				p_depth_stencil_state,
+				p_blend_state,
+				color_attachments,
+				p_dynamic_state_flags,
+				render_pass,
+				p_for_render_pass,
+				p_specialization_constants);
+		_THREAD_SAFE_LOCK_
+		ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+
+		shader = shader_owner.get_or_null(p_shader);
+		if (shader == nullptr || shader->driver_id != shader_driver_id) {
+			driver->pipeline_free(pipeline.driver_id);
+			ERR_FAIL_V_MSG(RID(), "Shader was freed while its render pipeline was being created.");
+		}
+	} else {
+		pipeline.driver_id = driver->render_pipeline_create(
+				shader->driver_id,
+				driver_vertex_format,
+				p_render_primitive,
+				p_rasterization_state,
+				p_multisample_state,
+				p_depth_stencil_state,
+				p_blend_state,
+				pass.color_attachments,
+				p_dynamic_state_flags,
+				fb_format.render_pass,
+				p_for_render_pass,
+				p_specialization_constants);
+		ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+	}
 
 	if (pipeline_cache_enabled) {
 		_update_pipeline_cache();
@@ -3081,6 +3222,10 @@ bool RenderingDevice::render_pipeline_is_valid(RID p_pipeline) {
 	return render_pipeline_owner.owns(p_pipeline);
 }
 
+bool RenderingDevice::render_pipeline_supports_async_creation() const {
+	return driver->api_trait_get(RDD::API_TRAIT_PIPELINE_CREATION_THREAD_SAFE);
+}
+
 RID RenderingDevice::compute_pipeline_create(RID p_shader, const Vector<PipelineSpecializationConstant> &p_specialization_constants) {
 	_THREAD_SAFE_METHOD_
 
@@ -3743,6 +3888,45 @@ void RenderingDevice::draw_list_set_push_constant(DrawListID p_list, const void
 #endif
 }
 
+Error RenderingDevice::_draw_list_bind_uniform_sets(DrawList *p_draw_list) {
+	DrawList *dl = p_draw_list;
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline.");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Uniforms supplied for set (" + itos(i) + ", which was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		draw_graph.add_draw_list_uniform_set_prepare_for_use(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+	}
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			draw_graph.add_draw_list_bind_uniform_set(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+
+			UniformSet *uniform_set = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+			draw_graph.add_draw_list_usages(uniform_set->draw_trackers, uniform_set->draw_trackers_usage);
+
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	return OK;
+}
+
 void RenderingDevice::draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances, uint32_t p_procedural_vertices) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 	ERR_FAIL_NULL(dl);
@@ -3774,38 +3958,8 @@ void RenderingDevice::draw_list_draw(DrawListID p_list, bool p_use_indices, uint
 #endif
 
 	// Bind descriptor sets.
-
-	for (uint32_t i = 0; i < dl->state.set_count; i++) {
-		if (dl->state.sets[i].pipeline_expected_format == 0) {
-			continue; // Nothing expected by this pipeline.
-		}
-#ifdef DEBUG_ENABLED
-		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
-			if (dl->state.sets[i].uniform_set_format == 0) {
-				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline.");
-			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
-				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
-				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
-			} else {
-				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
-			}
-		}
-#endif
-		draw_graph.add_draw_list_uniform_set_prepare_for_use(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
-	}
-	for (uint32_t i = 0; i < dl->state.set_count; i++) {
-		if (dl->state.sets[i].pipeline_expected_format == 0) {
-			continue; // Nothing expected by this pipeline.
-		}
-		if (!dl->state.sets[i].bound) {
-			// All good, see if this requires re-binding.
-			draw_graph.add_draw_list_bind_uniform_set(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
-
-			UniformSet *uniform_set = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
-			draw_graph.add_draw_list_usages(uniform_set->draw_trackers, uniform_set->draw_trackers_usage);
-
-			dl->state.sets[i].bound = true;
-		}
+	if (_draw_list_bind_uniform_sets(dl) != OK) {
+		return;
 	}
 
 	if (p_use_indices) {
@@ -3859,6 +4013,79 @@ void RenderingDevice::draw_list_draw(DrawListID p_list, bool p_use_indices, uint
 	}
 }
 
+void RenderingDevice::_draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride, RID p_count_buffer, uint32_t p_count_buffer_offset) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_NULL(dl);
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_NULL(buffer);
+	ERR_FAIL_COND_MSG(!buffer->usage.has_flag(RDD::BUFFER_USAGE_INDIRECT_BIT), "Buffer provided was not created to do indirect draws.");
+
+	// Indirect draw arguments are tightly packed unless a stride is given.
+	const uint32_t command_size = p_use_indices ? 20 : 16;
+	const uint32_t stride = p_stride != 0 ? p_stride : command_size;
+	ERR_FAIL_COND_MSG(stride < command_size || (stride % 4) != 0, "Stride (" + itos(stride) + ") must be a multiple of 4 and no smaller than the size of a draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "Draw count must be greater than zero.");
+	ERR_FAIL_COND_MSG(uint64_t(p_offset) + uint64_t(p_draw_count - 1) * stride + command_size > buffer->size, "Offset and draw count provided go past the end of the buffer.");
+
+	Buffer *count_buffer = nullptr;
+	if (p_count_buffer.is_valid()) {
+		ERR_FAIL_COND_MSG(!has_feature(SUPPORTS_DRAW_INDIRECT_COUNT), "Indirect draws with a count buffer are not supported by this device.");
+		count_buffer = storage_buffer_owner.get_or_null(p_count_buffer);
+		ERR_FAIL_NULL(count_buffer);
+		ERR_FAIL_COND_MSG(!count_buffer->usage.has_flag(RDD::BUFFER_USAGE_INDIRECT_BIT), "Count buffer provided was not created to do indirect draws.");
+		ERR_FAIL_COND_MSG(p_count_buffer_offset + 4 > count_buffer->size, "Count buffer offset provided (+4) is past the end of the buffer.");
+	}
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_count,
+				"Draw command requested indices, but no index buffer was set.");
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+#endif
+
+	// Bind descriptor sets.
+	if (_draw_list_bind_uniform_sets(dl) != OK) {
+		return;
+	}
+
+	draw_graph.add_draw_list_draw_indirect(p_use_indices, buffer->driver_id, p_offset, p_draw_count, stride, count_buffer ? count_buffer->driver_id : RDD::BufferID(), p_count_buffer_offset);
+
+	if (buffer->draw_tracker != nullptr) {
+		draw_graph.add_draw_list_usage(buffer->draw_tracker, RDG::RESOURCE_USAGE_INDIRECT_BUFFER_READ);
+	}
+	if (count_buffer != nullptr && count_buffer->draw_tracker != nullptr && count_buffer != buffer) {
+		draw_graph.add_draw_list_usage(count_buffer->draw_tracker, RDG::RESOURCE_USAGE_INDIRECT_BUFFER_READ);
+	}
+}
+
+void RenderingDevice::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	_draw_list_draw_indirect(p_list, p_use_indices, p_buffer, p_offset, p_draw_count, p_stride, RID(), 0);
+}
+
+void RenderingDevice::draw_list_draw_indirect_count(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, RID p_count_buffer, uint32_t p_count_buffer_offset, uint32_t p_max_draw_count, uint32_t p_stride) {
+	ERR_FAIL_COND(p_count_buffer.is_null());
+	_draw_list_draw_indirect(p_list, p_use_indices, p_buffer, p_offset, p_max_draw_count, p_stride, p_count_buffer, p_count_buffer_offset);
+}
+
 void RenderingDevice::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -4805,6 +5032,10 @@ void RenderingDevice::_free_pending_resources(int p_frame) {
 	}
 }
 
+uint64_t RenderingDevice::get_memory_budget() const {
+	return driver->get_memory_budget();
+}
+
 uint32_t RenderingDevice::get_frame_delay() const {
 	return frames.size();
 }
@@ -4827,6 +5058,10 @@ uint64_t RenderingDevice::get_memory_usage(MemoryType p_type) const {
 	}
 }
 
+const RenderingDeviceGraph::Statistics &RenderingDevice::get_graph_statistics() const {
+	return draw_graph.get_statistics();
+}
+
 void RenderingDevice::_begin_frame() {
 	// Before beginning this frame, wait on the fence if it was signaled to make sure its work is finished.
 	if (frames[frame].draw_fence_signaled) {
@@ -4838,6 +5073,10 @@ void RenderingDevice::_begin_frame() {
 	driver->begin_segment(frame, frames_drawn++);
 	driver->command_buffer_begin(frames[frame].setup_command_buffer);
 	driver->command_buffer_begin(frames[frame].draw_command_buffer);
+	if (async_compute_queue) {
+		driver->command_buffer_begin(frames[frame].async_compute_command_buffer);
+		driver->command_buffer_begin(frames[frame].join_command_buffer);
+	}
 
 	// Reset the graph.
 	draw_graph.begin();
@@ -4845,6 +5084,9 @@ void RenderingDevice::_begin_frame() {
 	// Erase pending resources.
 	_free_pending_resources(frame);
 
+	// The frame's fence was waited on, so its readbacks are complete.
+	_resolve_downloads(frame);
+
 	// Advance staging buffer if used.
 	if (staging_buffer_used) {
 		staging_buffer_current = (staging_buffer_current + 1) % staging_buffer_blocks.size();
@@ -4872,9 +5114,13 @@ void RenderingDevice::_end_frame() {
 		ERR_PRINT("Found open compute list at the end of the frame, this should never happen (further compute will likely not work).");
 	}
 
-	draw_graph.end(frames[frame].draw_command_buffer, RENDER_GRAPH_REORDER, RENDER_GRAPH_FULL_BARRIERS);
+	draw_graph.end(frames[frame].draw_command_buffer, RENDER_GRAPH_REORDER, RENDER_GRAPH_FULL_BARRIERS, frames[frame].async_compute_command_buffer, frames[frame].join_command_buffer);
 	driver->command_buffer_end(frames[frame].setup_command_buffer);
 	driver->command_buffer_end(frames[frame].draw_command_buffer);
+	if (async_compute_queue) {
+		driver->command_buffer_end(frames[frame].async_compute_command_buffer);
+		driver->command_buffer_end(frames[frame].join_command_buffer);
+	}
 	driver->end_segment();
 }
 
@@ -4883,8 +5129,28 @@ void RenderingDevice::_execute_frame(bool p_present) {
 	const bool separate_present_queue = main_queue != present_queue;
 	const VectorView<RDD::SemaphoreID> execute_draw_semaphore = frame_can_present && separate_present_queue ? frames[frame].draw_semaphore : VectorView<RDD::SemaphoreID>();
 	const VectorView<RDD::SwapChainID> execute_draw_swap_chains = frame_can_present && !separate_present_queue ? frames[frame].swap_chains_to_present : VectorView<RDD::SwapChainID>();
-	driver->command_queue_execute_and_present(main_queue, {}, frames[frame].setup_command_buffer, frames[frame].setup_semaphore, {}, {});
-	driver->command_queue_execute_and_present(main_queue, frames[frame].setup_semaphore, frames[frame].draw_command_buffer, execute_draw_semaphore, frames[frame].draw_fence, execute_draw_swap_chains);
+	if (async_compute_queue) {
+		// The async compute command buffer runs alongside the draw command buffer. The join command buffer carries the rest of the frame after both are done.
+		const RDD::SemaphoreID setup_signal_semaphores[2] = { frames[frame].setup_semaphore, frames[frame].setup_async_compute_semaphore };
+		driver->command_queue_execute_and_present(main_queue, {}, frames[frame].setup_command_buffer, VectorView(setup_signal_semaphores, 2), {}, {});
+
+		const RDD::SemaphoreID async_compute_wait_semaphores[2] = { frames[frame].setup_async_compute_semaphore, async_compute_wait_semaphore };
+		driver->command_queue_execute_and_present(async_compute_queue, VectorView(async_compute_wait_semaphores, async_compute_wait_semaphore ? 2 : 1), frames[frame].async_compute_command_buffer, frames[frame].async_compute_semaphore, {}, {});
+		driver->command_queue_execute_and_present(main_queue, frames[frame].setup_semaphore, frames[frame].draw_command_buffer, {}, {}, {});
+
+		RDD::SemaphoreID join_signal_semaphores[2] = { frames[frame].join_semaphore };
+		uint32_t join_signal_semaphore_count = 1;
+		if (execute_draw_semaphore.size() > 0) {
+			join_signal_semaphores[join_signal_semaphore_count++] = frames[frame].draw_semaphore;
+		}
+
+		driver->command_queue_execute_and_present(main_queue, frames[frame].async_compute_semaphore, frames[frame].join_command_buffer, VectorView(join_signal_semaphores, join_signal_semaphore_count), frames[frame].draw_fence, execute_draw_swap_chains);
+		async_compute_wait_semaphore = frames[frame].join_semaphore;
+	} else {
+		driver->command_queue_execute_and_present(main_queue, {}, frames[frame].setup_command_buffer, frames[frame].setup_semaphore, {}, {});
+		driver->command_queue_execute_and_present(main_queue, frames[frame].setup_semaphore, frames[frame].draw_command_buffer, execute_draw_semaphore, frames[frame].draw_fence, execute_draw_swap_chains);
+	}
+
 	frames[frame].draw_fence_signaled = true;
 
 	if (frame_can_present) {
@@ -5011,6 +5277,12 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 		present_queue = main_queue;
 	}
 
+	if (main_instance && bool(GLOBAL_GET("rendering/rendering_device/async_compute")) && driver->command_queue_family_get_queue_count(main_queue_family) > 1) {
+		// Create the async compute queue on the main family, so resources can be used by both queues without transferring their ownership.
+		async_compute_queue = driver->command_queue_create(main_queue_family);
+		ERR_FAIL_COND_V(!async_compute_queue, FAILED);
+	}
+
 	// Create data for all the frames.
 	for (uint32_t i = 0; i < frames.size(); i++) {
 		frames[i].index = 0;
@@ -5030,6 +5302,19 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 		ERR_FAIL_COND_V(!frames[i].draw_fence, FAILED);
 		frames[i].draw_fence_signaled = false;
 
+		if (async_compute_queue) {
+			frames[i].async_compute_command_buffer = driver->command_buffer_create(frames[i].command_pool);
+			ERR_FAIL_COND_V(!frames[i].async_compute_command_buffer, FAILED);
+			frames[i].join_command_buffer = driver->command_buffer_create(frames[i].command_pool);
+			ERR_FAIL_COND_V(!frames[i].join_command_buffer, FAILED);
+			frames[i].setup_async_compute_semaphore = driver->semaphore_create();
+			ERR_FAIL_COND_V(!frames[i].setup_async_compute_semaphore, FAILED);
+			frames[i].async_compute_semaphore = driver->semaphore_create();
+			ERR_FAIL_COND_V(!frames[i].async_compute_semaphore, FAILED);
+			frames[i].join_semaphore = driver->semaphore_create();
+			ERR_FAIL_COND_V(!frames[i].join_semaphore, FAILED);
+		}
+
 		// Create query pool.
 		frames[i].timestamp_pool = driver->timestamp_query_pool_create(max_timestamp_query_elements);
 		frames[i].timestamp_names.resize(max_timestamp_query_elements);
@@ -5048,6 +5333,10 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->begin_segment(frame, frames_drawn++);
 	driver->command_buffer_begin(frames[0].setup_command_buffer);
 	driver->command_buffer_begin(frames[0].draw_command_buffer);
+	if (async_compute_queue) {
+		driver->command_buffer_begin(frames[0].async_compute_command_buffer);
+		driver->command_buffer_begin(frames[0].join_command_buffer);
+	}
 
 	// Create draw graph and start it initialized as well.
 	draw_graph.initialize(driver, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
@@ -5373,11 +5662,18 @@ void RenderingDevice::finalize() {
 	for (uint32_t i = 0; i < frames.size(); i++) {
 		int f = (frame + i) % frames.size();
 		_free_pending_resources(f);
+		_resolve_downloads(f);
 		driver->command_pool_free(frames[i].command_pool);
 		driver->timestamp_query_pool_free(frames[i].timestamp_pool);
 		driver->semaphore_free(frames[i].setup_semaphore);
 		driver->semaphore_free(frames[i].draw_semaphore);
 		driver->fence_free(frames[i].draw_fence);
+
+		if (async_compute_queue) {
+			driver->semaphore_free(frames[i].setup_async_compute_semaphore);
+			driver->semaphore_free(frames[i].async_compute_semaphore);
+			driver->semaphore_free(frames[i].join_semaphore);
+		}
 	}
 
 	if (pipeline_cache_enabled) {
@@ -5388,6 +5684,7 @@ void RenderingDevice::finalize() {
 	frames.clear();
 
 	for (int i = 0; i < staging_buffer_blocks.size(); i++) {
+		driver->buffer_unmap(staging_buffer_blocks[i].driver_id);
 		driver->buffer_free(staging_buffer_blocks[i].driver_id);
 	}
 
@@ -5419,6 +5716,12 @@ void RenderingDevice::finalize() {
 		present_queue = RDD::CommandQueueID();
 	}
 
+	if (async_compute_queue) {
+		driver->command_queue_free(async_compute_queue);
+		async_compute_queue = RDD::CommandQueueID();
+		async_compute_wait_semaphore = RDD::SemaphoreID();
+	}
+
 	if (main_queue) {
 		driver->command_queue_free(main_queue);
 		main_queue = RDD::CommandQueueID();
@@ -5453,6 +5756,7 @@ void RenderingDevice::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("texture_update", "texture", "layer", "data"), &RenderingDevice::texture_update);
 	ClassDB::bind_method(D_METHOD("texture_get_data", "texture", "layer"), &RenderingDevice::texture_get_data);
+	ClassDB::bind_method(D_METHOD("texture_get_data_async", "texture", "layer", "callback"), &RenderingDevice::texture_get_data_async);
 
 	ClassDB::bind_method(D_METHOD("texture_is_format_supported_for_usage", "format", "usage_flags"), &RenderingDevice::texture_is_format_supported_for_usage);
 
@@ -5507,6 +5811,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("buffer_update", "buffer", "offset", "size_bytes", "data"), &RenderingDevice::_buffer_update_bind);
 	ClassDB::bind_method(D_METHOD("buffer_clear", "buffer", "offset", "size_bytes"), &RenderingDevice::buffer_clear);
 	ClassDB::bind_method(D_METHOD("buffer_get_data", "buffer", "offset_bytes", "size_bytes"), &RenderingDevice::buffer_get_data, DEFVAL(0), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("buffer_get_data_async", "buffer", "callback", "offset_bytes", "size_bytes"), &RenderingDevice::buffer_get_data_async, DEFVAL(0), DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("render_pipeline_create", "shader", "framebuffer_format", "vertex_format", "primitive", "rasterization_state", "multisample_state", "stencil_state", "color_blend_state", "dynamic_state_flags", "for_render_pass", "specialization_constants"), &RenderingDevice::_render_pipeline_create, DEFVAL(0), DEFVAL(0), DEFVAL(TypedArray<RDPipelineSpecializationConstant>()));
 	ClassDB::bind_method(D_METHOD("render_pipeline_is_valid", "render_pipeline"), &RenderingDevice::render_pipeline_is_valid);
@@ -5533,6 +5838,8 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("draw_list_set_push_constant", "draw_list", "buffer", "size_bytes"), &RenderingDevice::_draw_list_set_push_constant);
 
 	ClassDB::bind_method(D_METHOD("draw_list_draw", "draw_list", "use_indices", "instances", "procedural_vertex_count"), &RenderingDevice::draw_list_draw, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("draw_list_draw_indirect", "draw_list", "use_indices", "buffer", "offset", "draw_count", "stride"), &RenderingDevice::draw_list_draw_indirect, DEFVAL(0), DEFVAL(1), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("draw_list_draw_indirect_count", "draw_list", "use_indices", "buffer", "offset", "count_buffer", "count_buffer_offset", "max_draw_count", "stride"), &RenderingDevice::draw_list_draw_indirect_count, DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("draw_list_enable_scissor", "draw_list", "rect"), &RenderingDevice::draw_list_enable_scissor, DEFVAL(Rect2()));
 	ClassDB::bind_method(D_METHOD("draw_list_disable_scissor", "draw_list"), &RenderingDevice::draw_list_disable_scissor);
@@ -5586,6 +5893,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_device_pipeline_cache_uuid"), &RenderingDevice::get_device_pipeline_cache_uuid);
 
 	ClassDB::bind_method(D_METHOD("get_memory_usage", "type"), &RenderingDevice::get_memory_usage);
+	ClassDB::bind_method(D_METHOD("get_memory_budget"), &RenderingDevice::get_memory_budget);
 
 	ClassDB::bind_method(D_METHOD("get_driver_resource", "resource", "rid", "index"), &RenderingDevice::get_driver_resource);
 
@@ -150,6 +150,7 @@ private:
 
 	struct StagingBufferBlock {
 		RDD::BufferID driver_id;
+		uint8_t *data_ptr = nullptr; // Persistently mapped, staging blocks are CPU and coherent.
 		uint64_t frame_used = 0;
 		uint32_t fill_amount = 0;
 	};
@@ -184,11 +185,32 @@ private:
 	RID_Owner<Buffer> storage_buffer_owner;
 	RID_Owner<Buffer> texture_buffer_owner;
 
+	// A copy of a buffer or texture into CPU memory, read back once the frame that recorded it has finished.
+	struct DownloadRequest {
+		RDD::BufferID buffer;
+		uint32_t size = 0;
+		Callable callback;
+
+		// Textures only, used to strip the row padding of each mipmap.
+		bool texture = false;
+		DataFormat format = DATA_FORMAT_MAX;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t depth = 0;
+		uint32_t mipmaps = 0;
+		LocalVector<RDD::TextureCopyableLayout> mip_layouts;
+	};
+
+	Error _buffer_record_download(RID p_buffer, uint32_t p_offset, uint32_t p_size, DownloadRequest &r_request);
+	Vector<uint8_t> _download_request_read(const DownloadRequest &p_request);
+	void _resolve_downloads(int p_frame);
+
 public:
 	Error buffer_copy(RID p_src_buffer, RID p_dst_buffer, uint32_t p_src_offset, uint32_t p_dst_offset, uint32_t p_size);
 	Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data);
 	Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size);
 	Vector<uint8_t> buffer_get_data(RID p_buffer, uint32_t p_offset = 0, uint32_t p_size = 0); // This causes stall, only use to retrieve large buffers for saving.
+	Error buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset = 0, uint32_t p_size = 0); // Callback is called deferred with the data, once the GPU is done with the frame.
 
 	/*****************/
 	/**** TEXTURE ****/
@@ -251,6 +273,8 @@ public:
 	uint32_t texture_upload_region_size_px = 0;
 
 	Vector<uint8_t> _texture_get_data(Texture *tex, uint32_t p_layer, bool p_2d = false);
+	Texture *_texture_get_for_download(RID p_texture, uint32_t p_layer);
+	Error _texture_record_download(Texture *p_tex, RID p_texture, uint32_t p_layer, DownloadRequest &r_request);
 	Error _texture_update(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data, bool p_use_setup_queue, bool p_validate_can_update);
 
 public:
@@ -284,6 +308,7 @@ public:
 	RID texture_create_shared_from_slice(const TextureView &p_view, RID p_with_texture, uint32_t p_layer, uint32_t p_mipmap, uint32_t p_mipmaps = 1, TextureSliceType p_slice_type = TEXTURE_SLICE_2D, uint32_t p_layers = 0);
 	Error texture_update(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data);
 	Vector<uint8_t> texture_get_data(RID p_texture, uint32_t p_layer); // CPU textures will return immediately, while GPU textures will most likely force a flush
+	Error texture_get_data_async(RID p_texture, uint32_t p_layer, const Callable &p_callback); // Doesn't stall, callback is called deferred with the data a few frames later.
 
 	bool texture_is_format_supported_for_usage(DataFormat p_format, BitField<TextureUsageBits> p_usage) const;
 	bool texture_is_shared(RID p_texture);
@@ -538,6 +563,9 @@ public:
 	FramebufferFormatID framebuffer_format_create_multipass(const Vector<AttachmentFormat> &p_attachments, const Vector<FramebufferPass> &p_passes, uint32_t p_view_count = 1);
 	FramebufferFormatID framebuffer_format_create_empty(TextureSamples p_samples = TEXTURE_SAMPLES_1);
 	TextureSamples framebuffer_format_get_texture_samples(FramebufferFormatID p_format, uint32_t p_pass = 0);
+	Vector<AttachmentFormat> framebuffer_format_get_attachments(FramebufferFormatID p_format);
+	Vector<FramebufferPass> framebuffer_format_get_passes(FramebufferFormatID p_format);
+	uint32_t framebuffer_format_get_view_count(FramebufferFormatID p_format);
 
 	RID framebuffer_create(const Vector<RID> &p_texture_attachments, FramebufferFormatID p_format_check = INVALID_ID, uint32_t p_view_count = 1);
 	RID framebuffer_create_multipass(const Vector<RID> &p_texture_attachments, const Vector<FramebufferPass> &p_passes, FramebufferFormatID p_format_check = INVALID_ID, uint32_t p_view_count = 1);
@@ -684,6 +712,7 @@ public:
 
 	// This ID is warranted to be unique for the same formats, does not need to be freed
 	VertexFormatID vertex_format_create(const Vector<VertexAttribute> &p_vertex_descriptions);
+	Vector<VertexAttribute> vertex_format_get_attributes(VertexFormatID p_vertex_format);
 	RID vertex_array_create(uint32_t p_vertex_count, VertexFormatID p_vertex_format, const Vector<RID> &p_src_buffers, const Vector<uint64_t> &p_offsets = Vector<uint64_t>());
 
 	RID index_buffer_create(uint32_t p_size_indices, IndexBufferFormat p_format, const Vector<uint8_t> &p_data = Vector<uint8_t>(), bool p_use_restart_indices = false);
@@ -993,6 +1022,7 @@ private:
 public:
 	RID render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, BitField<PipelineDynamicStateFlags> p_dynamic_state_flags = 0, uint32_t p_for_render_pass = 0, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>());
 	bool render_pipeline_is_valid(RID p_pipeline);
+	bool render_pipeline_supports_async_creation() const;
 
 	RID compute_pipeline_create(RID p_shader, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>());
 	bool compute_pipeline_is_valid(RID p_pipeline);
@@ -1097,6 +1127,8 @@ private:
 	Error _draw_list_render_pass_begin(Framebuffer *p_framebuffer, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, const Vector<Color> &p_clear_colors, float p_clear_depth, uint32_t p_clear_stencil, Point2i p_viewport_offset, Point2i p_viewport_size, RDD::FramebufferID p_framebuffer_driver_id, RDD::RenderPassID p_render_pass);
 	void _draw_list_set_viewport(Rect2i p_rect);
 	void _draw_list_set_scissor(Rect2i p_rect);
+	Error _draw_list_bind_uniform_sets(DrawList *p_draw_list);
+	void _draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride, RID p_count_buffer, uint32_t p_count_buffer_offset);
 	_FORCE_INLINE_ DrawList *_get_draw_list_ptr(DrawListID p_id);
 	Error _draw_list_allocate(const Rect2i &p_viewport, uint32_t p_subpass);
 	void _draw_list_free(Rect2i *r_last_viewport = nullptr);
@@ -1114,6 +1146,8 @@ public:
 	void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
+	void draw_list_draw_indirect_count(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, RID p_count_buffer, uint32_t p_count_buffer_offset, uint32_t p_max_draw_count, uint32_t p_stride = 0);
 
 	void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	void draw_list_disable_scissor(DrawListID p_list);
@@ -1204,6 +1238,11 @@ private:
 	RDD::CommandQueueID main_queue;
 	RDD::CommandQueueID present_queue;
 
+	// Only created when enabled in the project settings and the main queue family has a second hardware queue available.
+	// Must wait on the join semaphore of the previous frame before reusing any resource the main queue might still be using.
+	RDD::CommandQueueID async_compute_queue;
+	RDD::SemaphoreID async_compute_wait_semaphore;
+
 	/**************************/
 	/**** FRAME MANAGEMENT ****/
 	/**************************/
@@ -1233,6 +1272,9 @@ private:
 		List<RenderPipeline> render_pipelines_to_dispose_of;
 		List<ComputePipeline> compute_pipelines_to_dispose_of;
 
+		// Readbacks recorded during the frame, resolved when it is cycled.
+		List<DownloadRequest> download_requests;
+
 		RDD::CommandPoolID command_pool;
 
 		// Used at the beginning of every frame for set-up.
@@ -1251,6 +1293,23 @@ private:
 		// Signaled by the draw submission. Present must wait on this semaphore.
 		RDD::SemaphoreID draw_semaphore;
 
+		// Only used with async compute. Records the work of the frame that doesn't depend on anything else
+		// recorded during the frame and can be submitted to the async compute queue.
+		RDD::CommandBufferID async_compute_command_buffer;
+
+		// Only used with async compute. Records the work that depends on the async compute command buffer.
+		// Submitted after the draw command buffer.
+		RDD::CommandBufferID join_command_buffer;
+
+		// Signaled by the setup submission. Async compute must wait on this semaphore.
+		RDD::SemaphoreID setup_async_compute_semaphore;
+
+		// Signaled by the async compute submission. Join must wait on this semaphore.
+		RDD::SemaphoreID async_compute_semaphore;
+
+		// Signaled by the join submission. Async compute must wait on this semaphore on the next frame.
+		RDD::SemaphoreID join_semaphore;
+
 		// Signaled by the draw submission. Must wait on this fence before beginning
 		// command recording for the frame.
 		RDD::FenceID draw_fence;
@@ -1338,6 +1397,8 @@ public:
 	};
 
 	uint64_t get_memory_usage(MemoryType p_type) const;
+	uint64_t get_memory_budget() const;
+	const RenderingDeviceGraph::Statistics &get_graph_statistics() const;
 
 	RenderingDevice *create_local_device();
 
@@ -818,6 +818,7 @@ public:
 		SUPPORTS_ATTACHMENT_VRS,
 		// If not supported, a fragment shader with only side effets (i.e., writes  to buffers, but doesn't output to attachments), may be optimized down to no-op by the GPU driver.
 		SUPPORTS_FRAGMENT_SHADER_WITH_ONLY_SIDE_EFFECTS,
+		SUPPORTS_DRAW_INDIRECT_COUNT,
 	};
 
 	enum SubgroupOperations {
@@ -357,6 +357,10 @@ Error RenderingDeviceDriver::_reflect_spirv(VectorView<ShaderStageSPIRVData> p_s
 /**** MISC ****/
 /**************/
 
+uint64_t RenderingDeviceDriver::get_memory_budget() {
+	return 0;
+}
+
 uint64_t RenderingDeviceDriver::api_trait_get(ApiTrait p_trait) {
 	// Sensible canonical defaults.
 	switch (p_trait) {
@@ -370,6 +374,8 @@ uint64_t RenderingDeviceDriver::api_trait_get(ApiTrait p_trait) {
 			return 1;
 		case API_TRAIT_SECONDARY_VIEWPORT_SCISSOR:
 			return 1;
+		case API_TRAIT_PIPELINE_CREATION_THREAD_SAFE:
+			return 0;
 		default:
 			ERR_FAIL_V(0);
 	}
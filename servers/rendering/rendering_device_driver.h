@@ -405,6 +405,10 @@ public:
 	// It is valid to specify no bits and a valid surface: in this case, the dedicated presentation queue family will be the preferred option.
 	virtual CommandQueueFamilyID command_queue_family_get(BitField<CommandQueueFamilyBits> p_cmd_queue_family_bits, RenderingContextDriver::SurfaceID p_surface = 0) = 0;
 
+	// How many queues created on the family are backed by a different hardware queue, and can therefore execute the command buffers submitted to them
+	// concurrently. Resources can be shared between the queues of the same family without transferring their ownership.
+	virtual uint32_t command_queue_family_get_queue_count(CommandQueueFamilyID p_cmd_queue_family) { return 1; }
+
 	// ----- QUEUE -----
 
 	virtual CommandQueueID command_queue_create(CommandQueueFamilyID p_cmd_queue_family, bool p_identify_as_main_queue = false) = 0;
@@ -735,6 +739,7 @@ public:
 		API_TRAIT_TEXTURE_TRANSFER_ALIGNMENT,
 		API_TRAIT_TEXTURE_DATA_ROW_PITCH_STEP,
 		API_TRAIT_SECONDARY_VIEWPORT_SCISSOR,
+		API_TRAIT_PIPELINE_CREATION_THREAD_SAFE,
 	};
 	enum ShaderChangeInvalidation {
 		SHADER_CHANGE_INVALIDATION_ALL_BOUND_UNIFORM_SETS,
@@ -760,6 +765,9 @@ public:
 	virtual void set_object_name(ObjectType p_type, ID p_driver_id, const String &p_name) = 0;
 	virtual uint64_t get_resource_native_handle(DriverResource p_type, ID p_driver_id) = 0;
 	virtual uint64_t get_total_memory_used() = 0;
+	// Returns the amount of device-local memory the application can use without
+	// risking eviction or allocation failures, or 0 if the driver can't tell.
+	virtual uint64_t get_memory_budget();
 	virtual uint64_t limit_get(Limit p_limit) = 0;
 	virtual uint64_t api_trait_get(ApiTrait p_trait);
 	virtual bool has_feature(Features p_feature) = 0;
@@ -687,6 +687,24 @@ void RenderingDeviceGraph::_run_draw_list_command(RDD::CommandBufferID p_command
 				driver->command_render_draw_indexed(p_command_buffer, draw_indexed_instruction->index_count, draw_indexed_instruction->instance_count, draw_indexed_instruction->first_index, 0, 0);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				if (draw_indirect_instruction->count_buffer) {
+					driver->command_render_draw_indirect_count(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->count_buffer, draw_indirect_instruction->count_buffer_offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				} else {
+					driver->command_render_draw_indirect(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				}
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				if (draw_indirect_instruction->count_buffer) {
+					driver->command_render_draw_indexed_indirect_count(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->count_buffer, draw_indirect_instruction->count_buffer_offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				} else {
+					driver->command_render_draw_indexed_indirect(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				}
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_EXECUTE_COMMANDS: {
 				const DrawListExecuteCommandsInstruction *execute_commands_instruction = reinterpret_cast<const DrawListExecuteCommandsInstruction *>(instruction);
 				driver->command_buffer_execute_secondary(p_command_buffer, execute_commands_instruction->command_buffer);
@@ -787,6 +805,7 @@ void RenderingDeviceGraph::_run_render_commands(RDD::CommandBufferID p_command_b
 				const RecordedDrawListCommand *draw_list_command = reinterpret_cast<const RecordedDrawListCommand *>(command);
 				const VectorView clear_values(draw_list_command->clear_values(), draw_list_command->clear_values_count);
 				driver->command_begin_render_pass(p_command_buffer, draw_list_command->render_pass, draw_list_command->framebuffer, draw_list_command->command_buffer_type, draw_list_command->region, clear_values);
+				statistics.render_pass_count++;
 				_run_draw_list_command(p_command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
 				driver->command_end_render_pass(p_command_buffer);
 			} break;
@@ -1023,10 +1042,14 @@ void RenderingDeviceGraph::_group_barriers_for_render_commands(RDD::CommandBuffe
 #endif
 
 	driver->command_pipeline_barrier(p_command_buffer, barrier_group.src_stages, barrier_group.dst_stages, memory_barriers, buffer_barriers, texture_barriers);
+	statistics.pipeline_barrier_count++;
+	statistics.buffer_barrier_count += buffer_barriers.size();
+	statistics.layout_transition_count += barrier_group.normalization_barriers.size() + barrier_group.transition_barriers.size();
 
 	bool separate_texture_barriers = !barrier_group.normalization_barriers.is_empty() && !barrier_group.transition_barriers.is_empty();
 	if (separate_texture_barriers) {
 		driver->command_pipeline_barrier(p_command_buffer, barrier_group.src_stages, barrier_group.dst_stages, VectorView<RDD::MemoryBarrier>(), VectorView<RDD::BufferBarrier>(), barrier_group.transition_barriers);
+		statistics.pipeline_barrier_count++;
 	}
 }
 
@@ -1137,6 +1160,12 @@ void RenderingDeviceGraph::_print_draw_list(const uint8_t *p_instruction_data, u
 				print_line("\tDRAW INDICES", draw_indexed_instruction->index_count, "INSTANCES", draw_indexed_instruction->instance_count, "FIRST INDEX", draw_indexed_instruction->first_index);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT:
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				print_line(instruction->type == DrawListInstruction::TYPE_DRAW_INDIRECT ? "\tDRAW INDIRECT BUFFER ID" : "\tDRAW INDEXED INDIRECT BUFFER ID", itos(draw_indirect_instruction->buffer.id), "OFFSET", draw_indirect_instruction->offset, "DRAW COUNT", draw_indirect_instruction->draw_count, "STRIDE", draw_indirect_instruction->stride, "COUNT BUFFER ID", itos(draw_indirect_instruction->count_buffer.id));
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_EXECUTE_COMMANDS: {
 				print_line("\tEXECUTE COMMANDS");
 				instruction_data_cursor += sizeof(DrawListExecuteCommandsInstruction);
@@ -1551,6 +1580,18 @@ void RenderingDeviceGraph::add_draw_list_draw_indexed(uint32_t p_index_count, ui
 	instruction->first_index = p_first_index;
 }
 
+void RenderingDeviceGraph::add_draw_list_draw_indirect(bool p_indexed, RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride, RDD::BufferID p_count_buffer, uint32_t p_count_buffer_offset) {
+	DrawListDrawIndirectInstruction *instruction = reinterpret_cast<DrawListDrawIndirectInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDrawIndirectInstruction)));
+	instruction->type = p_indexed ? DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT : DrawListInstruction::TYPE_DRAW_INDIRECT;
+	instruction->buffer = p_buffer;
+	instruction->offset = p_offset;
+	instruction->draw_count = p_draw_count;
+	instruction->stride = p_stride;
+	instruction->count_buffer = p_count_buffer;
+	instruction->count_buffer_offset = p_count_buffer_offset;
+	draw_instruction_list.stages.set_flag(RDD::PIPELINE_STAGE_DRAW_INDIRECT_BIT);
+}
+
 void RenderingDeviceGraph::add_draw_list_execute_commands(RDD::CommandBufferID p_command_buffer) {
 	DrawListExecuteCommandsInstruction *instruction = reinterpret_cast<DrawListExecuteCommandsInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListExecuteCommandsInstruction)));
 	instruction->type = DrawListInstruction::TYPE_EXECUTE_COMMANDS;
@@ -1804,13 +1845,63 @@ void RenderingDeviceGraph::end_label() {
 	command_label_index = -1;
 }
 
-void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reorder_commands, bool p_full_barriers) {
+void RenderingDeviceGraph::_run_sorted_commands_by_level(RDD::CommandBufferID p_command_buffer, RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, bool p_full_barriers) {
+	if (p_sorted_commands_count == 0) {
+		return;
+	}
+
+	int32_t current_label_index = -1;
+	int32_t current_label_level = -1;
+	_run_label_command_change(p_command_buffer, -1, -1, true, true, nullptr, 0, current_label_index, current_label_level);
+
+	uint32_t boosted_priority = 0;
+	uint32_t current_level = p_sorted_commands[0].level;
+	uint32_t current_level_start = 0;
+	for (uint32_t i = 0; i < p_sorted_commands_count; i++) {
+		if (current_level != p_sorted_commands[i].level) {
+			RecordedCommandSort *level_command_ptr = &p_sorted_commands[current_level_start];
+			uint32_t level_command_count = i - current_level_start;
+			_boost_priority_for_render_commands(level_command_ptr, level_command_count, boosted_priority);
+			_group_barriers_for_render_commands(p_command_buffer, level_command_ptr, level_command_count, p_full_barriers);
+			_run_render_commands(p_command_buffer, current_level, level_command_ptr, level_command_count, current_label_index, current_label_level);
+			current_level = p_sorted_commands[i].level;
+			current_level_start = i;
+		}
+	}
+
+	RecordedCommandSort *level_command_ptr = &p_sorted_commands[current_level_start];
+	uint32_t level_command_count = p_sorted_commands_count - current_level_start;
+	_boost_priority_for_render_commands(level_command_ptr, level_command_count, boosted_priority);
+	_group_barriers_for_render_commands(p_command_buffer, level_command_ptr, level_command_count, p_full_barriers);
+	_run_render_commands(p_command_buffer, current_level, level_command_ptr, level_command_count, current_label_index, current_label_level);
+
+	_run_label_command_change(p_command_buffer, -1, -1, true, false, nullptr, 0, current_label_index, current_label_level);
+}
+
+void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reorder_commands, bool p_full_barriers, RDD::CommandBufferID p_async_command_buffer, RDD::CommandBufferID p_join_command_buffer) {
+	statistics = Statistics();
+	statistics.command_count = command_count;
+
 	if (command_count == 0) {
 		// No commands have been logged, do nothing.
 		return;
 	}
 
+	enum CommandQueue {
+		COMMAND_QUEUE_MAIN,
+		COMMAND_QUEUE_ASYNC,
+		COMMAND_QUEUE_JOIN,
+	};
+
+	enum CommandQueueDependency {
+		COMMAND_QUEUE_DEPENDENCY_MAIN = 1,
+		COMMAND_QUEUE_DEPENDENCY_ASYNC = 2,
+	};
+
 	thread_local LocalVector<RecordedCommandSort> commands_sorted;
+	thread_local LocalVector<uint8_t> command_queues;
+	thread_local LocalVector<uint8_t> command_queue_dependencies;
+	const bool use_async_queue = p_reorder_commands && p_async_command_buffer && p_join_command_buffer;
 	if (p_reorder_commands) {
 		thread_local LocalVector<int64_t> command_stack;
 		thread_local LocalVector<int32_t> sorted_command_indices;
@@ -1885,11 +1976,36 @@ void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reo
 		commands_sorted.clear();
 		commands_sorted.resize(command_count);
 
+		if (use_async_queue) {
+			command_queues.resize(command_count);
+			command_queue_dependencies.resize(command_count);
+			memset(command_queue_dependencies.ptr(), 0, sizeof(uint8_t) * command_queue_dependencies.size());
+		}
+
 		for (uint32_t i = 0; i < command_count; i++) {
 			const int32_t sorted_command_index = sorted_command_indices[i];
 			const uint32_t command_data_offset = command_data_offsets[sorted_command_index];
 			const RecordedCommand recorded_command = *reinterpret_cast<const RecordedCommand *>(&command_data[command_data_offset]);
 			const uint32_t next_command_level = commands_sorted[sorted_command_index].level + 1;
+
+			// Commands are visited in topological order, so the queue of every command this one depends on is already known. A command can only go on the
+			// async queue if everything it depends on is on it as well. Anything that depends on the async queue has to wait for it on the join command buffer.
+			uint8_t dependencies_to_add = 0;
+			if (use_async_queue) {
+				const uint8_t dependencies = command_queue_dependencies[sorted_command_index];
+				const bool async_capable = recorded_command.type == RecordedCommand::TYPE_COMPUTE_LIST || recorded_command.type == RecordedCommand::TYPE_BUFFER_CLEAR || recorded_command.type == RecordedCommand::TYPE_BUFFER_COPY || recorded_command.type == RecordedCommand::TYPE_BUFFER_UPDATE;
+				if (async_capable && !(dependencies & COMMAND_QUEUE_DEPENDENCY_MAIN)) {
+					command_queues[sorted_command_index] = COMMAND_QUEUE_ASYNC;
+					dependencies_to_add = COMMAND_QUEUE_DEPENDENCY_ASYNC;
+				} else if (dependencies & COMMAND_QUEUE_DEPENDENCY_ASYNC) {
+					command_queues[sorted_command_index] = COMMAND_QUEUE_JOIN;
+					dependencies_to_add = COMMAND_QUEUE_DEPENDENCY_MAIN | COMMAND_QUEUE_DEPENDENCY_ASYNC;
+				} else {
+					command_queues[sorted_command_index] = COMMAND_QUEUE_MAIN;
+					dependencies_to_add = COMMAND_QUEUE_DEPENDENCY_MAIN;
+				}
+			}
+
 			adjacency_list_index = recorded_command.adjacent_command_list_index;
 			while (adjacency_list_index >= 0) {
 				const RecordedCommandListNode &command_list_node = command_list_nodes[adjacency_list_index];
@@ -1898,6 +2014,10 @@ void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reo
 					adjacent_command_level = next_command_level;
 				}
 
+				if (use_async_queue) {
+					command_queue_dependencies[command_list_node.command_index] |= dependencies_to_add;
+				}
+
 				adjacency_list_index = command_list_node.next_list_index;
 			}
 
@@ -1916,10 +2036,6 @@ void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reo
 	_wait_for_secondary_command_buffer_tasks();
 
 	if (command_count > 0) {
-		int32_t current_label_index = -1;
-		int32_t current_label_level = -1;
-		_run_label_command_change(p_command_buffer, -1, -1, true, true, nullptr, 0, current_label_index, current_label_level);
-
 		if (p_reorder_commands) {
 #if PRINT_RENDER_GRAPH
 			print_line("BEFORE SORT");
@@ -1937,38 +2053,44 @@ void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reo
 			print_line(vformat("Recording %d commands", command_count));
 #endif
 
-			uint32_t boosted_priority = 0;
-			uint32_t current_level = commands_sorted[0].level;
-			uint32_t current_level_start = 0;
-			for (uint32_t i = 0; i < command_count; i++) {
-				if (current_level != commands_sorted[i].level) {
-					RecordedCommandSort *level_command_ptr = &commands_sorted[current_level_start];
-					uint32_t level_command_count = i - current_level_start;
-					_boost_priority_for_render_commands(level_command_ptr, level_command_count, boosted_priority);
-					_group_barriers_for_render_commands(p_command_buffer, level_command_ptr, level_command_count, p_full_barriers);
-					_run_render_commands(p_command_buffer, current_level, level_command_ptr, level_command_count, current_label_index, current_label_level);
-					current_level = commands_sorted[i].level;
-					current_level_start = i;
+			statistics.level_count = commands_sorted[command_count - 1].level + 1;
+
+			if (use_async_queue) {
+				// Split the sorted commands per queue while preserving their order, so each of them can be recorded by level on its own command buffer.
+				thread_local LocalVector<RecordedCommandSort> queue_commands_sorted[3];
+				for (uint32_t i = 0; i < 3; i++) {
+					queue_commands_sorted[i].clear();
 				}
-			}
 
-			RecordedCommandSort *level_command_ptr = &commands_sorted[current_level_start];
-			uint32_t level_command_count = command_count - current_level_start;
-			_boost_priority_for_render_commands(level_command_ptr, level_command_count, boosted_priority);
-			_group_barriers_for_render_commands(p_command_buffer, level_command_ptr, level_command_count, p_full_barriers);
-			_run_render_commands(p_command_buffer, current_level, level_command_ptr, level_command_count, current_label_index, current_label_level);
+				for (uint32_t i = 0; i < command_count; i++) {
+					queue_commands_sorted[command_queues[commands_sorted[i].index]].push_back(commands_sorted[i]);
+				}
+
+				statistics.async_command_count = queue_commands_sorted[COMMAND_QUEUE_ASYNC].size();
+				_run_sorted_commands_by_level(p_async_command_buffer, queue_commands_sorted[COMMAND_QUEUE_ASYNC].ptr(), queue_commands_sorted[COMMAND_QUEUE_ASYNC].size(), p_full_barriers);
+				_run_sorted_commands_by_level(p_command_buffer, queue_commands_sorted[COMMAND_QUEUE_MAIN].ptr(), queue_commands_sorted[COMMAND_QUEUE_MAIN].size(), p_full_barriers);
+				_run_sorted_commands_by_level(p_join_command_buffer, queue_commands_sorted[COMMAND_QUEUE_JOIN].ptr(), queue_commands_sorted[COMMAND_QUEUE_JOIN].size(), p_full_barriers);
+			} else {
+				_run_sorted_commands_by_level(p_command_buffer, commands_sorted.ptr(), command_count, p_full_barriers);
+			}
 
 #if PRINT_RENDER_GRAPH
-			print_line("COMMANDS", command_count, "LEVELS", current_level + 1);
+			print_line("COMMANDS", command_count, "LEVELS", statistics.level_count, "ASYNC", statistics.async_command_count);
 #endif
 		} else {
+			int32_t current_label_index = -1;
+			int32_t current_label_level = -1;
+			_run_label_command_change(p_command_buffer, -1, -1, true, true, nullptr, 0, current_label_index, current_label_level);
+
 			for (uint32_t i = 0; i < command_count; i++) {
 				_group_barriers_for_render_commands(p_command_buffer, &commands_sorted[i], 1, p_full_barriers);
 				_run_render_commands(p_command_buffer, i, &commands_sorted[i], 1, current_label_index, current_label_level);
 			}
-		}
 
-		_run_label_command_change(p_command_buffer, -1, -1, true, false, nullptr, 0, current_label_index, current_label_level);
+			_run_label_command_change(p_command_buffer, -1, -1, true, false, nullptr, 0, current_label_index, current_label_level);
+
+			statistics.level_count = command_count;
+		}
 
 #if PRINT_COMMAND_RECORDING
 		print_line(vformat("Recorded %d commands", command_count));
@@ -1979,6 +2101,10 @@ void RenderingDeviceGraph::end(RDD::CommandBufferID p_command_buffer, bool p_reo
 	frame = (frame + 1) % frames.size();
 }
 
+const RenderingDeviceGraph::Statistics &RenderingDeviceGraph::get_statistics() const {
+	return statistics;
+}
+
 #if PRINT_RESOURCE_TRACKER_TOTAL
 static uint32_t resource_tracker_total = 0;
 #endif
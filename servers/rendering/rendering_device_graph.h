@@ -69,6 +69,8 @@ public:
 			TYPE_CLEAR_ATTACHMENTS,
 			TYPE_DRAW,
 			TYPE_DRAW_INDEXED,
+			TYPE_DRAW_INDIRECT,
+			TYPE_DRAW_INDEXED_INDIRECT,
 			TYPE_EXECUTE_COMMANDS,
 			TYPE_NEXT_SUBPASS,
 			TYPE_SET_BLEND_CONSTANTS,
@@ -184,6 +186,17 @@ public:
 		}
 	};
 
+	// Totals gathered while the graph was last flushed with end().
+	struct Statistics {
+		uint32_t command_count = 0;
+		uint32_t level_count = 0;
+		uint32_t pipeline_barrier_count = 0;
+		uint32_t layout_transition_count = 0;
+		uint32_t buffer_barrier_count = 0;
+		uint32_t render_pass_count = 0;
+		uint32_t async_command_count = 0;
+	};
+
 private:
 	struct InstructionList {
 		LocalVector<uint8_t> data;
@@ -435,6 +448,15 @@ private:
 		uint32_t first_index = 0;
 	};
 
+	struct DrawListDrawIndirectInstruction : DrawListInstruction {
+		RDD::BufferID buffer;
+		uint32_t offset = 0;
+		uint32_t draw_count = 0;
+		uint32_t stride = 0;
+		RDD::BufferID count_buffer;
+		uint32_t count_buffer_offset = 0;
+	};
+
 	struct DrawListEndRenderPassInstruction : DrawListInstruction {
 		// No contents.
 	};
@@ -582,6 +604,7 @@ private:
 	bool command_synchronization_pending = false;
 	BarrierGroup barrier_group;
 	bool driver_honors_barriers = false;
+	Statistics statistics;
 	TightLocalVector<Frame> frames;
 	uint32_t frame = 0;
 
@@ -612,6 +635,7 @@ private:
 	void _run_label_command_change(RDD::CommandBufferID p_command_buffer, int32_t p_new_label_index, int32_t p_new_level, bool p_ignore_previous_value, bool p_use_label_for_empty, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, int32_t &r_current_label_index, int32_t &r_current_label_level);
 	void _boost_priority_for_render_commands(RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_boosted_priority);
 	void _group_barriers_for_render_commands(RDD::CommandBufferID p_command_buffer, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, bool p_full_memory_barrier);
+	void _run_sorted_commands_by_level(RDD::CommandBufferID p_command_buffer, RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, bool p_full_barriers);
 	void _print_render_commands(const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count);
 	void _print_draw_list(const uint8_t *p_instruction_data, uint32_t p_instruction_data_size);
 	void _print_compute_list(const uint8_t *p_instruction_data, uint32_t p_instruction_data_size);
@@ -644,6 +668,7 @@ public:
 	void add_draw_list_clear_attachments(VectorView<RDD::AttachmentClear> p_attachments_clear, VectorView<Rect2i> p_attachments_clear_rect);
 	void add_draw_list_draw(uint32_t p_vertex_count, uint32_t p_instance_count);
 	void add_draw_list_draw_indexed(uint32_t p_index_count, uint32_t p_instance_count, uint32_t p_first_index);
+	void add_draw_list_draw_indirect(bool p_indexed, RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride, RDD::BufferID p_count_buffer = RDD::BufferID(), uint32_t p_count_buffer_offset = 0);
 	void add_draw_list_execute_commands(RDD::CommandBufferID p_command_buffer);
 	void add_draw_list_next_subpass(RDD::CommandBufferType p_command_buffer_type);
 	void add_draw_list_set_blend_constants(const Color &p_color);
@@ -664,7 +689,10 @@ public:
 	void add_synchronization();
 	void begin_label(const String &p_label_name, const Color &p_color);
 	void end_label();
-	void end(RDD::CommandBufferID p_command_buffer, bool p_reorder_commands, bool p_full_barriers);
+	// If an async command buffer is provided, compute lists (and the buffer transfers feeding them) that don't depend on any other work of the frame are
+	// recorded into it instead. Commands that depend on them are recorded into the join command buffer, which must be submitted after the async one is done.
+	void end(RDD::CommandBufferID p_command_buffer, bool p_reorder_commands, bool p_full_barriers, RDD::CommandBufferID p_async_command_buffer = RDD::CommandBufferID(), RDD::CommandBufferID p_join_command_buffer = RDD::CommandBufferID());
+	const Statistics &get_statistics() const;
 	static ResourceTracker *resource_tracker_create();
 	static void resource_tracker_free(ResourceTracker *tracker);
 };
@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/scope_profiler.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
@@ -69,6 +70,9 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	MemoryTagScope memory_tag(Memory::TAG_RENDERING);
+	PROFILE_SCOPE("RenderingServer::draw");
+
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 
@@ -139,6 +143,13 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 				new_profile.write[i].cpu_msec = double(time_cpu - base_cpu) / 1000.0;
 				new_profile.write[i].name = RSG::utilities->get_captured_timestamp_name(i);
 			}
+
+			if (ScopeProfiler::is_capturing() && i + 1 < RSG::utilities->get_captured_timestamps_count()) {
+				// GPU times are in nanoseconds, on their own clock. Place them on the CPU timeline
+				// relative to the first timestamp of the frame, when its commands were recorded.
+				const uint64_t next_gpu = RSG::utilities->get_captured_timestamp_gpu_time(i + 1);
+				ScopeProfiler::add_gpu_event(name, base_cpu + (time_gpu - base_gpu) / 1000, base_cpu + (next_gpu - base_gpu) / 1000);
+			}
 		}
 
 		frame_profile = new_profile;
@@ -352,6 +363,8 @@ void RenderingServerDefault::_thread_callback(void *_instance) {
 
 void RenderingServerDefault::_thread_loop() {
 	server_thread = Thread::get_caller_id();
+	// Everything done in the render thread is attributed to rendering.
+	Memory::set_thread_tag(Memory::TAG_RENDERING);
 
 	DisplayServer::get_singleton()->make_rendering_thread();
 
@@ -352,6 +352,9 @@ public:
 	FUNC2(multimesh_set_visible_instances, RID, int)
 	FUNC1RC(int, multimesh_get_visible_instances, RID)
 
+	FUNC2(multimesh_set_cull_distance, RID, float)
+	FUNC1RC(float, multimesh_get_cull_distance, RID)
+
 	/* SKELETON API */
 
 	FUNCRIDSPLIT(skeleton)
@@ -588,6 +591,8 @@ public:
 	FUNC4(camera_set_orthogonal, RID, float, float, float)
 	FUNC5(camera_set_frustum, RID, float, Vector2, float, float)
 	FUNC2(camera_set_transform, RID, const Transform3D &)
+	FUNC2(camera_set_interpolated, RID, bool)
+	FUNC1(camera_reset_physics_interpolation, RID)
 	FUNC2(camera_set_cull_mask, RID, uint32_t)
 	FUNC2(camera_set_environment, RID, RID)
 	FUNC2(camera_set_camera_attributes, RID, RID)
@@ -598,6 +603,8 @@ public:
 	FUNCRIDSPLIT(occluder)
 	FUNC3(occluder_set_mesh, RID, const PackedVector3Array &, const PackedInt32Array &)
 
+	FUNC0(tick)
+
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
@@ -621,6 +628,8 @@ public:
 
 	FUNC2(viewport_set_scaling_3d_mode, RID, ViewportScaling3DMode)
 	FUNC2(viewport_set_scaling_3d_scale, RID, float)
+	FUNC2(viewport_set_scaling_3d_dynamic_target_time, RID, float)
+	FUNC2(viewport_set_scaling_3d_dynamic_min_scale, RID, float)
 	FUNC2(viewport_set_fsr_sharpness, RID, float)
 	FUNC2(viewport_set_texture_mipmap_bias, RID, float)
 
@@ -805,6 +814,9 @@ public:
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC3(instance_set_pivot_data, RID, float, bool)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instance_set_transforms, const Vector<RID> &, const Vector<Transform3D> &)
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
@@ -877,6 +889,7 @@ public:
 	FUNC2(canvas_item_set_update_when_visible, RID, bool)
 
 	FUNC2(canvas_item_set_transform, RID, const Transform2D &)
+	FUNC2(canvas_item_set_transforms, const Vector<RID> &, const Vector<Transform2D> &)
 	FUNC2(canvas_item_set_clip, RID, bool)
 	FUNC2(canvas_item_set_distance_field_mode, RID, bool)
 	FUNC3(canvas_item_set_custom_rect, RID, bool, const Rect2 &)
@@ -995,6 +1008,13 @@ public:
 	FUNC0RC(String, get_video_adapter_name)
 	FUNC0RC(String, get_video_adapter_vendor)
 	FUNC0RC(String, get_video_adapter_api_version)
+
+	FUNC1(pipeline_manifest_set_recording, bool)
+	FUNC0RC(bool, pipeline_manifest_is_recording)
+	FUNC0RC(TypedArray<Dictionary>, pipeline_manifest_get)
+	FUNC0(pipeline_manifest_clear)
+	FUNC1(pipeline_manifest_precompile, const TypedArray<Dictionary> &)
+	FUNC0RC(float, pipeline_manifest_get_precompile_progress)
 #undef server_name
 #undef ServerName
 #undef WRITE_ACTION
@@ -1026,6 +1046,8 @@ public:
 
 	virtual void draw(bool p_swap_buffers, double frame_step) override;
 	virtual void sync() override;
+	virtual void begin_command_batch() override { command_queue.begin_batch(); }
+	virtual void end_command_batch() override { command_queue.end_batch(); }
 	virtual bool has_changed() const override;
 	virtual void init() override;
 	virtual void finish() override;
@@ -1036,6 +1058,8 @@ public:
 			_call_on_render_thread(p_callable);
 		} else {
 			command_queue.push(this, &RenderingServerDefault::_call_on_render_thread, p_callable);
+			// The caller may wait for the callable to run, so don't hold it in a batch.
+			command_queue.publish_batch();
 		}
 	}
 
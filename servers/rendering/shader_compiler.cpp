@@ -1455,7 +1455,83 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+SafeNumeric<uint32_t> ShaderCompiler::cache_version;
+
+void ShaderCompiler::invalidate_caches() {
+	cache_version.increment();
+}
+
+uint32_t ShaderCompiler::_hash_actions(RS::ShaderMode p_mode, const IdentifierActions &p_actions, const String &p_code) {
+	uint32_t h = hash_murmur3_one_32(p_mode);
+	h = hash_murmur3_one_32(p_code.hash(), h);
+	for (const KeyValue<StringName, Stage> &E : p_actions.entry_point_stages) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value, h);
+	}
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions.render_mode_values) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+		h = hash_murmur3_one_32(E.value.second, h);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions.render_mode_flags) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	h = hash_murmur3_one_32(0xffffffff, h); // Separate the maps, names can appear in several of them.
+	for (const KeyValue<StringName, bool *> &E : p_actions.usage_flag_pointers) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	h = hash_murmur3_one_32(0xffffffff, h);
+	for (const KeyValue<StringName, bool *> &E : p_actions.write_flag_pointers) {
+		h = hash_murmur3_one_32(E.key.hash(), h);
+	}
+	h = hash_murmur3_one_32(p_actions.uniforms != nullptr, h);
+	return hash_fmix32(h);
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	const uint32_t cache_key = _hash_actions(p_mode, *p_actions, p_code);
+	const uint32_t version = cache_version.get();
+	{
+		CacheEntry *entry = cache.getptr(cache_key);
+		if (entry && entry->version == version && entry->code == p_code) {
+			r_gen_code = entry->gen_code;
+			for (const StringName &name : entry->render_mode_values) {
+				Pair<int *, int> &p = p_actions->render_mode_values[name];
+				*p.first = p.second;
+			}
+			for (const StringName &name : entry->render_mode_flags) {
+				*p_actions->render_mode_flags[name] = true;
+			}
+			for (const StringName &name : entry->usage_flag_pointers) {
+				*p_actions->usage_flag_pointers[name] = true;
+			}
+			for (const StringName &name : entry->write_flag_pointers) {
+				*p_actions->write_flag_pointers[name] = true;
+			}
+			if (p_actions->uniforms) {
+				for (const KeyValue<StringName, ShaderLanguage::ShaderNode::Uniform> &E : entry->uniforms) {
+					p_actions->uniforms->insert(E.key, E.value);
+				}
+			}
+			return OK;
+		}
+	}
+
+	// Remember the state of the action pointers, to find out which ones the compile writes.
+	LocalVector<int> render_mode_values_before;
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		render_mode_values_before.push_back(*E.value.first);
+	}
+	LocalVector<bool> flags_before;
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		flags_before.push_back(*E.value);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		flags_before.push_back(*E.value);
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		flags_before.push_back(*E.value);
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1560,6 +1636,43 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	function = nullptr;
 	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
 
+	if (cache.size() >= CACHE_MAX_ENTRIES && !cache.has(cache_key)) {
+		cache.clear();
+	}
+	CacheEntry &entry = cache[cache_key];
+	entry = CacheEntry();
+	entry.code = p_code;
+	entry.version = version;
+	entry.gen_code = r_gen_code;
+	uint32_t index = 0;
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		if (*E.value.first != render_mode_values_before[index++] && *E.value.first == E.value.second) {
+			entry.render_mode_values.push_back(E.key);
+		}
+	}
+	index = 0;
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		if (*E.value && !flags_before[index]) {
+			entry.render_mode_flags.push_back(E.key);
+		}
+		index++;
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		if (*E.value && !flags_before[index]) {
+			entry.usage_flag_pointers.push_back(E.key);
+		}
+		index++;
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		if (*E.value && !flags_before[index]) {
+			entry.write_flag_pointers.push_back(E.key);
+		}
+		index++;
+	}
+	if (p_actions->uniforms) {
+		entry.uniforms = *p_actions->uniforms;
+	}
+
 	return OK;
 }
 
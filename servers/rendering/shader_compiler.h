@@ -31,7 +31,9 @@
 #ifndef SHADER_COMPILER_H
 #define SHADER_COMPILER_H
 
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering_server.h"
 
@@ -125,11 +127,33 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// Generated code of previous successful compiles, keyed by the code, the shader mode and the
+	// actions requested. Compiling also writes to the pointers in the actions, so the entries
+	// record which ones were written and a hit replays those writes.
+	struct CacheEntry {
+		String code;
+		uint32_t version = 0;
+		GeneratedCode gen_code;
+		LocalVector<StringName> render_mode_values;
+		LocalVector<StringName> render_mode_flags;
+		LocalVector<StringName> usage_flag_pointers;
+		LocalVector<StringName> write_flag_pointers;
+		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	};
+	static const uint32_t CACHE_MAX_ENTRIES = 256;
+	static SafeNumeric<uint32_t> cache_version;
+	HashMap<uint32_t, CacheEntry> cache;
+
+	static uint32_t _hash_actions(RS::ShaderMode p_mode, const IdentifierActions &p_actions, const String &p_code);
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
+	// Must be called when global shader uniforms are added or removed, as it can change the result of compiling the same code.
+	static void invalidate_caches();
+
 	void initialize(DefaultIdentifierActions p_actions);
 	ShaderCompiler();
 };
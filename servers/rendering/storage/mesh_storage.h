@@ -120,6 +120,9 @@ public:
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
 
+	virtual void multimesh_set_cull_distance(RID p_multimesh, float p_distance) = 0;
+	virtual float multimesh_get_cull_distance(RID p_multimesh) const = 0;
+
 	virtual AABB multimesh_get_aabb(RID p_multimesh) const = 0;
 
 	/* SKELETON API */
@@ -184,6 +184,15 @@ public:
 	virtual String get_video_adapter_api_version() const = 0;
 
 	virtual Size2i get_maximum_viewport_size() const = 0;
+
+	/* PIPELINE MANIFEST */
+
+	virtual void pipeline_manifest_set_recording(bool p_enable) = 0;
+	virtual bool pipeline_manifest_is_recording() const = 0;
+	virtual TypedArray<Dictionary> pipeline_manifest_get() const = 0;
+	virtual void pipeline_manifest_clear() = 0;
+	virtual void pipeline_manifest_precompile(const TypedArray<Dictionary> &p_manifest) = 0;
+	virtual float pipeline_manifest_get_precompile_progress() const = 0;
 };
 
 #endif // RENDERER_UTILITIES_H
@@ -432,6 +432,9 @@ public:
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
 
+	virtual void multimesh_set_cull_distance(RID p_multimesh, float p_distance) = 0;
+	virtual float multimesh_get_cull_distance(RID p_multimesh) const = 0;
+
 	/* SKELETON API */
 
 	virtual RID skeleton_create() = 0;
@@ -813,6 +816,8 @@ public:
 	virtual void camera_set_orthogonal(RID p_camera, float p_size, float p_z_near, float p_z_far) = 0;
 	virtual void camera_set_frustum(RID p_camera, float p_size, Vector2 p_offset, float p_z_near, float p_z_far) = 0;
 	virtual void camera_set_transform(RID p_camera, const Transform3D &p_transform) = 0;
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated) = 0;
+	virtual void camera_reset_physics_interpolation(RID p_camera) = 0;
 	virtual void camera_set_cull_mask(RID p_camera, uint32_t p_layers) = 0;
 	virtual void camera_set_environment(RID p_camera, RID p_env) = 0;
 	virtual void camera_set_camera_attributes(RID p_camera, RID p_camera_attributes) = 0;
@@ -861,6 +866,8 @@ public:
 
 	virtual void viewport_set_scaling_3d_mode(RID p_viewport, ViewportScaling3DMode p_scaling_3d_mode) = 0;
 	virtual void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale) = 0;
+	virtual void viewport_set_scaling_3d_dynamic_target_time(RID p_viewport, float p_target_time_msec) = 0;
+	virtual void viewport_set_scaling_3d_dynamic_min_scale(RID p_viewport, float p_min_scale) = 0;
 	virtual void viewport_set_fsr_sharpness(RID p_viewport, float p_fsr_sharpness) = 0;
 	virtual void viewport_set_texture_mipmap_bias(RID p_viewport, float p_texture_mipmap_bias) = 0;
 
@@ -972,6 +979,7 @@ public:
 		VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME,
 		VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME,
 		VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME,
+		VIEWPORT_RENDER_INFO_BATCH_BREAKS_IN_FRAME,
 		VIEWPORT_RENDER_INFO_MAX,
 	};
 
@@ -1305,6 +1313,9 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) = 0;
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1412,6 +1423,7 @@ public:
 	virtual void canvas_item_set_update_when_visible(RID p_item, bool p_update) = 0;
 
 	virtual void canvas_item_set_transform(RID p_item, const Transform2D &p_transform) = 0;
+	virtual void canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) = 0;
 	virtual void canvas_item_set_clip(RID p_item, bool p_clip) = 0;
 	virtual void canvas_item_set_distance_field_mode(RID p_item, bool p_enable) = 0;
 	virtual void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2()) = 0;
@@ -1609,6 +1621,12 @@ public:
 
 	virtual void draw(bool p_swap_buffers = true, double frame_step = 0.0) = 0;
 	virtual void sync() = 0;
+	// When rendering on a separate thread, commands issued by the calling thread between these are
+	// sent to the render thread together. Not exposed, the engine opens batches around the main loop.
+	virtual void begin_command_batch() = 0;
+	virtual void end_command_batch() = 0;
+	// Called at the start of each physics tick, interpolated transforms set after it are the new targets.
+	virtual void tick() = 0;
 	virtual bool has_changed() const = 0;
 	virtual void init();
 	virtual void finish() = 0;
@@ -1622,6 +1640,12 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_PIPELINE_BARRIERS_IN_FRAME,
+		RENDERING_INFO_LAYOUT_TRANSITIONS_IN_FRAME,
+		RENDERING_INFO_RENDER_PASSES_IN_FRAME,
+		RENDERING_INFO_GRAPH_LEVELS_IN_FRAME,
+		RENDERING_INFO_GEOMETRY_ARENA_MEM_RESERVED,
+		RENDERING_INFO_GEOMETRY_ARENA_MEM_USED,
 		RENDERING_INFO_MAX
 	};
 
@@ -1631,6 +1655,13 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const = 0;
 	virtual String get_video_adapter_api_version() const = 0;
 
+	virtual void pipeline_manifest_set_recording(bool p_enable) = 0;
+	virtual bool pipeline_manifest_is_recording() const = 0;
+	virtual TypedArray<Dictionary> pipeline_manifest_get() const = 0;
+	virtual void pipeline_manifest_clear() = 0;
+	virtual void pipeline_manifest_precompile(const TypedArray<Dictionary> &p_manifest) = 0;
+	virtual float pipeline_manifest_get_precompile_progress() const = 0;
+
 	struct FrameProfileArea {
 		String name;
 		double gpu_msec;
@@ -1721,6 +1752,8 @@ private:
 	TypedArray<Dictionary> _instance_geometry_get_shader_parameter_list(RID p_instance) const;
 	TypedArray<Image> _bake_render_uv2(RID p_base, const TypedArray<RID> &p_material_overrides, const Size2i &p_image_size);
 	void _particles_set_trail_bind_poses(RID p_particles, const TypedArray<Transform3D> &p_bind_poses);
+	void _instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms);
+	void _canvas_item_set_transforms(const TypedArray<RID> &p_items, const TypedArray<Transform2D> &p_transforms);
 #ifdef TOOLS_ENABLED
 	SurfaceUpgradeCallback surface_upgrade_callback = nullptr;
 	bool warn_on_surface_upgrade = true;
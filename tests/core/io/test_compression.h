@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_compression.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_COMPRESSION_H
+#define TEST_COMPRESSION_H
+
+#include "core/io/compression.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompression {
+
+static Vector<uint8_t> make_test_data(int p_size) {
+	Vector<uint8_t> data;
+	data.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		data.write[i] = (i * 7 + i / 100) % 251;
+	}
+	return data;
+}
+
+TEST_CASE("[Compression] Stream round trip matches input") {
+	const Vector<uint8_t> data = make_test_data(200000);
+	const Compression::Mode modes[] = { Compression::MODE_DEFLATE, Compression::MODE_GZIP, Compression::MODE_ZSTD };
+
+	for (Compression::Mode mode : modes) {
+		CompressionStream enc;
+		REQUIRE(enc.start_compression(mode) == OK);
+		LocalVector<uint8_t> compressed;
+		// Feed uneven pieces to exercise partial input.
+		int ofs = 0;
+		while (ofs < data.size()) {
+			int step = MIN(3333, data.size() - ofs);
+			CHECK(enc.process(data.ptr() + ofs, step, compressed) == OK);
+			ofs += step;
+		}
+		CHECK(enc.finish(compressed) == OK);
+		CHECK(compressed.size() < (uint32_t)data.size());
+
+		CompressionStream dec;
+		REQUIRE(dec.start_decompression(mode) == OK);
+		LocalVector<uint8_t> decompressed;
+		CHECK(dec.process(compressed.ptr(), compressed.size(), decompressed) == OK);
+		CHECK(dec.is_stream_end());
+		CHECK(dec.finish(decompressed) == OK);
+		REQUIRE(decompressed.size() == (uint32_t)data.size());
+		CHECK(memcmp(decompressed.ptr(), data.ptr(), data.size()) == 0);
+	}
+}
+
+TEST_CASE("[Compression] Truncated stream is reported") {
+	const Vector<uint8_t> data = make_test_data(10000);
+	CompressionStream enc;
+	REQUIRE(enc.start_compression(Compression::MODE_ZSTD) == OK);
+	LocalVector<uint8_t> compressed;
+	enc.process(data.ptr(), data.size(), compressed);
+	enc.finish(compressed);
+
+	CompressionStream dec;
+	REQUIRE(dec.start_decompression(Compression::MODE_ZSTD) == OK);
+	LocalVector<uint8_t> decompressed;
+	CHECK(dec.process(compressed.ptr(), compressed.size() / 2, decompressed) == OK);
+	ERR_PRINT_OFF;
+	CHECK(dec.finish(decompressed) == ERR_FILE_CORRUPT);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Compression] Dynamic zstd decompression") {
+	const Vector<uint8_t> data = make_test_data(50000);
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(data.size(), Compression::MODE_ZSTD));
+	int size = Compression::compress(compressed.ptrw(), data.ptr(), data.size(), Compression::MODE_ZSTD);
+	REQUIRE(size > 0);
+
+	Vector<uint8_t> decompressed;
+	CHECK(Compression::decompress_dynamic(&decompressed, -1, compressed.ptr(), size, Compression::MODE_ZSTD) == OK);
+	CHECK(decompressed == data);
+
+	CHECK(Compression::decompress_dynamic(&decompressed, 1000, compressed.ptr(), size, Compression::MODE_ZSTD) != OK);
+}
+
+} // namespace TestCompression
+
+#endif // TEST_COMPRESSION_H
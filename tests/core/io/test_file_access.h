@@ -31,7 +31,10 @@
 #ifndef TEST_FILE_ACCESS_H
 #define TEST_FILE_ACCESS_H
 
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +110,65 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped buffer matches the file contents") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+
+	const uint8_t *mapped = f->get_mapped_buffer();
+	if (mapped == nullptr) {
+		// Not every backend can map files.
+		return;
+	}
+	Vector<uint8_t> contents = f->get_buffer(f->get_length());
+	REQUIRE(contents.size() == (int64_t)f->get_length());
+	CHECK(memcmp(mapped, contents.ptr(), contents.size()) == 0);
+}
+
+TEST_CASE("[FileAccess] Compressed block container reads and seeks") {
+	const uint32_t block_size = 4096;
+	Vector<uint8_t> data;
+	data.resize(block_size * 40 + 123);
+	for (int64_t i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7 + i / 1000) % 251;
+	}
+
+	Vector<uint8_t> container = FileAccessCompressed::compress_blocks(data.ptr(), data.size(), "TEST", Compression::MODE_ZSTD, block_size);
+	REQUIRE(!container.is_empty());
+	CHECK(container.size() < data.size());
+
+	const String path = OS::get_singleton()->get_cache_path().path_join("compressed_blocks.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(container.ptr(), container.size());
+	}
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	fac->configure("TEST", Compression::MODE_ZSTD, block_size);
+	REQUIRE(fac->open_internal(path, FileAccess::READ) == OK);
+	Ref<FileAccess> f = fac;
+	CHECK(f->get_length() == (uint64_t)data.size());
+
+	// Reading everything at once goes through the blocks decompressed straight into the destination.
+	Vector<uint8_t> read = f->get_buffer(data.size());
+	REQUIRE(read.size() == data.size());
+	CHECK(memcmp(read.ptr(), data.ptr(), data.size()) == 0);
+	CHECK(f->get_8() == 0);
+	CHECK(f->eof_reached());
+
+	// Seeking back into the middle of the file.
+	f->seek(block_size * 3 + 17);
+	CHECK(f->get_8() == data[block_size * 3 + 17]);
+	read = f->get_buffer(block_size * 20);
+	REQUIRE(read.size() == block_size * 20);
+	CHECK(memcmp(read.ptr(), data.ptr() + block_size * 3 + 18, read.size()) == 0);
+	CHECK(f->get_position() == block_size * 23 + 18);
+
+	f->close();
+	DirAccess::remove_absolute(path);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
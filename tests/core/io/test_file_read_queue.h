@@ -0,0 +1,74 @@
+/**************************************************************************/
+/*  test_file_read_queue.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FILE_READ_QUEUE_H
+#define TEST_FILE_READ_QUEUE_H
+
+#include "core/io/file_access.h"
+#include "core/io/file_read_queue.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestFileReadQueue {
+
+TEST_CASE("[FileReadQueue] Whole file and range reads") {
+	const String path = TestUtils::get_data_path("line_endings_lf.test.txt");
+	Vector<uint8_t> expected = FileAccess::get_file_as_bytes(path);
+	REQUIRE(expected.size() > 10);
+
+	FileReadQueue *queue = FileReadQueue::get_singleton();
+	FileReadQueue::RequestID whole = queue->request_read(path);
+	FileReadQueue::RequestID range = queue->request_read(path, 6, 4);
+	FileReadQueue::RequestID tail = queue->request_read(path, expected.size() - 3, 100);
+
+	Vector<uint8_t> data;
+	CHECK(queue->wait_for_completion(whole, &data) == OK);
+	CHECK(data == expected);
+
+	CHECK(queue->wait_for_completion(range, &data) == OK);
+	CHECK(data == expected.slice(6, 10));
+
+	// Reading past the end returns what's available.
+	CHECK(queue->wait_for_completion(tail, &data) == OK);
+	CHECK(data == expected.slice(expected.size() - 3));
+}
+
+TEST_CASE("[FileReadQueue] Missing file") {
+	FileReadQueue *queue = FileReadQueue::get_singleton();
+	FileReadQueue::RequestID id = queue->request_read(TestUtils::get_data_path("does_not_exist.txt"));
+
+	Vector<uint8_t> data;
+	CHECK(queue->wait_for_completion(id, &data) != OK);
+	CHECK(data.is_empty());
+}
+
+} // namespace TestFileReadQueue
+
+#endif // TEST_FILE_READ_QUEUE_H
@@ -211,6 +211,71 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+TEST_CASE("[Image] Processing large images") {
+	// Large enough to be split into row tiles on the worker threads.
+	const int size = 1024;
+	Vector<uint8_t> data;
+	data.resize(size * size * 4);
+	uint8_t *w = data.ptrw();
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			uint8_t *px = &w[(y * size + x) * 4];
+			px[0] = x & 0xFF;
+			px[1] = y & 0xFF;
+			px[2] = (x + y) & 0xFF;
+			px[3] = (x * 7 + y * 3) & 0xFF;
+		}
+	}
+	Ref<Image> source = memnew(Image(size, size, false, Image::FORMAT_RGBA8, data));
+
+	Ref<Image> nearest = source->duplicate();
+	nearest->resize(700, 900, Image::INTERPOLATE_NEAREST);
+	bool nearest_ok = true;
+	for (int y = 0; y < 900 && nearest_ok; y++) {
+		for (int x = 0; x < 700; x++) {
+			if (nearest->get_pixel(x, y) != source->get_pixel(x * size / 700, y * size / 900)) {
+				nearest_ok = false;
+				break;
+			}
+		}
+	}
+	CHECK_MESSAGE(nearest_ok, "Every row of a nearest resize should sample the matching source row.");
+
+	Ref<Image> premultiplied = source->duplicate();
+	premultiplied->premultiply_alpha();
+	const uint8_t *r = source->get_data().ptr();
+	Vector<uint8_t> premultiplied_data = premultiplied->get_data();
+	const uint8_t *pr = premultiplied_data.ptr();
+	bool premultiply_ok = true;
+	for (int i = 0; i < size * size && premultiply_ok; i++) {
+		for (int c = 0; c < 3; c++) {
+			if (pr[i * 4 + c] != ((uint16_t(r[i * 4 + c]) * uint16_t(r[i * 4 + 3]) + 255U) >> 8)) {
+				premultiply_ok = false;
+			}
+		}
+		premultiply_ok = premultiply_ok && pr[i * 4 + 3] == r[i * 4 + 3];
+	}
+	CHECK_MESSAGE(premultiply_ok, "premultiply_alpha() should process every row.");
+
+	// A solid color stays the same through every filter and mipmap level.
+	Ref<Image> solid = memnew(Image(size, size, false, Image::FORMAT_RGBA8));
+	solid->fill(Color(0.2, 0.4, 0.6, 0.8));
+	for (int i = 0; i < 5; i++) {
+		Ref<Image> resized = solid->duplicate();
+		resized->resize(900, 700, static_cast<Image::Interpolation>(i));
+		CHECK(resized->get_pixel(0, 0) == solid->get_pixel(0, 0));
+		CHECK(resized->get_pixel(450, 350) == solid->get_pixel(0, 0));
+		CHECK(resized->get_pixel(899, 699) == solid->get_pixel(0, 0));
+	}
+	Ref<Image> mipmapped = solid->duplicate();
+	CHECK(mipmapped->generate_mipmaps() == OK);
+	// With mipmaps, shrink_x2() keeps the generated levels.
+	mipmapped->shrink_x2();
+	CHECK(mipmapped->get_pixel(300, 200) == solid->get_pixel(0, 0));
+	mipmapped->shrink_x2();
+	CHECK(mipmapped->get_pixel(100, 50) == solid->get_pixel(0, 0));
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
@@ -31,7 +31,9 @@
 #ifndef TEST_JSON_H
 #define TEST_JSON_H
 
+#include "core/io/file_access.h"
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -232,6 +234,59 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	const String json_string = String::utf8("{\"name\": \"Gödöllő\", \"line\": \"a long string without escapes\\nand one with\", \"emoji\": \"\\ud83d\\ude00\", \"list\": [1, -2.5, true, null]}");
+
+	JSON from_string;
+	CHECK(from_string.parse(json_string) == OK);
+
+	JSON from_utf8;
+	CHECK(from_utf8.parse_utf8(json_string.to_utf8_buffer()) == OK);
+	CHECK(from_utf8.get_data() == from_string.get_data());
+
+	Dictionary dict = from_utf8.get_data();
+	CHECK(dict["name"] == String::utf8("Gödöllő"));
+	CHECK(dict["line"] == "a long string without escapes\nand one with");
+	CHECK(dict["emoji"] == String::utf8("😀"));
+
+	// Byte order marks are skipped.
+	PackedByteArray with_bom = { 0xEF, 0xBB, 0xBF };
+	with_bom.append_array(String("[1]").to_utf8_buffer());
+	CHECK(from_utf8.parse_utf8(with_bom) == OK);
+	Array parsed = from_utf8.get_data();
+	CHECK(parsed.size() == 1);
+	CHECK(int(parsed[0]) == 1);
+
+	ERR_PRINT_OFF
+	PackedByteArray invalid = String("\"ab\"").to_utf8_buffer();
+	invalid.set(1, 0xFF);
+	CHECK(from_utf8.parse_utf8(invalid) == ERR_PARSE_ERROR);
+	CHECK(from_utf8.parse_utf8(String("\"unterminated").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSON] Stringifying to a file") {
+#ifdef WINDOWS_ENABLED
+	const String path = OS::get_singleton()->get_environment("TEMP").path_join("stringify.json");
+#else
+	const String path = "/tmp/stringify.json";
+#endif
+
+	Array data;
+	for (int i = 0; i < 20000; i++) {
+		Dictionary entry;
+		entry["index"] = i;
+		entry["text"] = "entry";
+		data.push_back(entry);
+	}
+
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(file.is_valid());
+	CHECK(JSON::stringify_to_file(file, data, "\t") == OK);
+	file.unref();
+
+	CHECK(FileAccess::get_file_as_string(path) == JSON::stringify(data, "\t"));
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -32,6 +32,7 @@
 #define TEST_MARSHALLS_H
 
 #include "core/io/marshalls.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -326,6 +327,175 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+
+TEST_CASE("[Marshalls] Packed array Variant encoding is little-endian") {
+	PackedInt32Array array;
+	array.push_back(1);
+	array.push_back(0x01020304);
+
+	int r_len;
+	uint8_t buffer[16] = {};
+	CHECK(encode_variant(array, buffer, r_len) == OK);
+	CHECK(r_len == 16);
+	CHECK(decode_uint32(&buffer[4]) == 2); // Count.
+	CHECK(buffer[8] == 0x01);
+	CHECK(buffer[9] == 0x00);
+	CHECK(buffer[12] == 0x04);
+	CHECK(buffer[15] == 0x01);
+}
+
+TEST_CASE("[Marshalls] Packed array Variant round trip") {
+	PackedFloat64Array doubles;
+	PackedVector3Array vectors;
+	PackedColorArray colors;
+	for (int i = 0; i < 100; i++) {
+		doubles.push_back(i * 0.1);
+		vectors.push_back(Vector3(i, -i, i * 0.5));
+		colors.push_back(Color(i / 100.0, 0.25, 0.5, 1.0));
+	}
+
+	const Variant values[] = { doubles, vectors, colors };
+	for (const Variant &value : values) {
+		int len;
+		CHECK(encode_variant(value, nullptr, len) == OK);
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		CHECK(encode_variant(value, buffer.ptrw(), len) == OK);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), len, &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK(decoded == value);
+	}
+}
+static Vector<uint8_t> encode_legacy(const Variant &p_value) {
+	int len;
+	encode_variant(p_value, nullptr, len);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	encode_variant(p_value, buffer.ptrw(), len);
+	return buffer;
+}
+
+static Array make_snapshot(int p_entities) {
+	Array entities;
+	for (int i = 0; i < p_entities; i++) {
+		Dictionary entity;
+		entity["id"] = i;
+		entity["name"] = StringName("enemy");
+		entity["health"] = 100 - i;
+		entity["speed"] = 2.5;
+		entity["position"] = Vector3(i, 0, -i);
+		entities.push_back(entity);
+	}
+	return entities;
+}
+
+TEST_CASE("[Marshalls] Compact Variant round trip") {
+	Array typed_ints;
+	typed_ints.set_typed(Variant::INT, StringName(), Variant());
+	typed_ints.push_back(-1);
+	typed_ints.push_back(1 << 20);
+
+	Dictionary dict;
+	dict["key"] = "value";
+	dict[1] = StringName("name");
+	dict[StringName("name")] = Array();
+
+	const Variant values[] = {
+		Variant(),
+		true,
+		-64,
+		INT64_MIN,
+		INT64_MAX,
+		0.5,
+		0.1,
+		"Hello, World!",
+		StringName("some_name"),
+		Vector2(1, 2),
+		Transform2D(0.5, Vector2(8, 16)),
+		typed_ints,
+		dict,
+		make_snapshot(4),
+		PackedByteArray({ 1, 2, 3 }),
+		PackedInt64Array({ -5, 1 << 30 }),
+		PackedVector3Array({ Vector3(1, 2, 3) }),
+		PackedStringArray({ "a", "", String::utf8("ü") }),
+	};
+
+	for (const Variant &value : values) {
+		Vector<uint8_t> buffer;
+		CHECK(encode_variant_compact(value, buffer) == OK);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+		CHECK(r_len == buffer.size());
+		CHECK(decoded.get_type() == value.get_type());
+		CHECK(decoded == value);
+	}
+
+	Vector<uint8_t> buffer;
+	CHECK(encode_variant_compact(typed_ints, buffer) == OK);
+	Variant decoded;
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size()) == OK);
+	CHECK(Array(decoded).is_typed());
+	CHECK(Array(decoded).get_typed_builtin() == Variant::INT);
+}
+
+TEST_CASE("[Marshalls] Compact Variant encoding size") {
+	const Array snapshot = make_snapshot(64);
+
+	Vector<uint8_t> compact;
+	CHECK(encode_variant_compact(snapshot, compact) == OK);
+	CHECK(compact[0] == 0xFF); // Magic.
+	CHECK(compact.size() * 2 < encode_legacy(snapshot).size());
+
+	// Small integers fit in a tag and a single varint byte.
+	CHECK(encode_variant_compact(42, compact) == OK);
+	CHECK(compact.size() == 4);
+}
+
+TEST_CASE("[Marshalls] Compact Variant decoding rejects truncated data") {
+	Vector<uint8_t> buffer;
+	CHECK(encode_variant_compact(make_snapshot(2), buffer) == OK);
+
+	ERR_PRINT_OFF;
+	for (int len = 1; len < buffer.size(); len++) {
+		Variant decoded;
+		CHECK(decode_variant(decoded, buffer.ptr(), len) != OK);
+	}
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls][Benchmark] Compact Variant encoding compared to the regular one" * doctest::skip()) {
+	const Array snapshot = make_snapshot(1000);
+	const int rounds = 100;
+
+	int legacy_size = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		Vector<uint8_t> buffer = encode_legacy(snapshot);
+		Variant decoded;
+		decode_variant(decoded, buffer.ptr(), buffer.size());
+		legacy_size = buffer.size();
+	}
+	const uint64_t legacy_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	int compact_size = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		Vector<uint8_t> buffer;
+		encode_variant_compact(snapshot, buffer);
+		Variant decoded;
+		decode_variant(decoded, buffer.ptr(), buffer.size());
+		compact_size = buffer.size();
+	}
+	const uint64_t compact_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE("Regular: ", legacy_size, " bytes, ", legacy_usec, " usec. Compact: ", compact_size, " bytes, ", compact_usec, " usec for ", rounds, " round trips.");
+}
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
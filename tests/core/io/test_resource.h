@@ -110,6 +110,67 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading packed arrays in binary format") {
+	Ref<Resource> resource = memnew(Resource);
+	PackedByteArray bytes;
+	PackedInt64Array ints;
+	PackedVector3Array vectors;
+	PackedColorArray colors;
+	for (int i = 0; i < 37; i++) {
+		bytes.push_back(i * 7);
+		ints.push_back(int64_t(i) << 40);
+		vectors.push_back(Vector3(i, -i, i * 0.5));
+		colors.push_back(Color(i / 37.0, 0.25, 0.5, 1.0));
+	}
+	// Odd sizes make each payload start at a different alignment.
+	resource->set_meta("bytes", bytes);
+	resource->set_meta("ints", ints);
+	resource->set_meta("vectors", vectors);
+	resource->set_meta("colors", colors);
+	resource->set_meta("empty", PackedFloat32Array());
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_packed_arrays.res");
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_meta("bytes") == Variant(bytes));
+	CHECK(loaded->get_meta("ints") == Variant(ints));
+	CHECK(loaded->get_meta("vectors") == Variant(vectors));
+	CHECK(loaded->get_meta("colors") == Variant(colors));
+	CHECK(PackedFloat32Array(loaded->get_meta("empty")).is_empty());
+}
+
+TEST_CASE("[Resource] Keepalive cache") {
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_keepalive.res");
+	{
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name("Kept alive");
+		CHECK(ResourceSaver::save(resource, save_path) == OK);
+	}
+	const uint64_t previous_budget = ResourceLoader::get_keepalive_budget();
+	ResourceLoader::clear_keepalive_cache();
+	ResourceLoader::set_keepalive_budget(1024 * 1024);
+
+	String local_path;
+	{
+		Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_KEEPALIVE);
+		REQUIRE(loaded.is_valid());
+		local_path = loaded->get_path();
+	}
+	CHECK_MESSAGE(
+			ResourceCache::has(local_path),
+			"The resource should stay cached after its last user reference is gone.");
+	CHECK(ResourceLoader::get_keepalive_memory_usage() > 0);
+
+	// Going over the budget releases entries nothing else references.
+	ResourceLoader::set_keepalive_budget(0);
+	CHECK_FALSE(ResourceCache::has(local_path));
+	CHECK(ResourceLoader::get_keepalive_memory_usage() == 0);
+
+	ResourceLoader::set_keepalive_budget(previous_budget);
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
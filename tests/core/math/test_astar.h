@@ -32,6 +32,8 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
+#include "core/variant/typed_array.h"
 
 #include "tests/test_macros.h"
 
@@ -357,6 +359,67 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+TEST_CASE("[AStarGrid2D] Paths around solid points") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 100, 5));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->update();
+	// A wall across the grid, with a single opening at the bottom. Crosses a word boundary of the solid mask.
+	grid->fill_solid_region(Rect2i(64, 0, 1, 4));
+	CHECK(grid->is_point_solid(Vector2i(64, 3)));
+	CHECK_FALSE(grid->is_point_solid(Vector2i(64, 4)));
+	CHECK_FALSE(grid->is_point_solid(Vector2i(63, 0)));
+
+	TypedArray<Vector2i> path = grid->get_id_path(Vector2i(60, 0), Vector2i(68, 0));
+	REQUIRE(path.size() > 0);
+	bool goes_through_opening = false;
+	for (int i = 0; i < path.size(); i++) {
+		Vector2i id = path[i];
+		CHECK_FALSE(grid->is_point_solid(id));
+		goes_through_opening = goes_through_opening || id == Vector2i(64, 4);
+	}
+	CHECK(goes_through_opening);
+
+	// Jumping only returns jump points, but must still find its way around the wall.
+	grid->set_jumping_enabled(true);
+	path = grid->get_id_path(Vector2i(60, 0), Vector2i(68, 0));
+	REQUIRE(path.size() > 2);
+	CHECK(Vector2i(path[0]) == Vector2i(60, 0));
+	CHECK(Vector2i(path[path.size() - 1]) == Vector2i(68, 0));
+
+	grid->set_point_solid(Vector2i(64, 4));
+	CHECK(grid->get_id_path(Vector2i(60, 0), Vector2i(68, 0)).is_empty());
+}
+
+TEST_CASE("[AStarGrid2D] Batch paths") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 8, 8));
+	grid->update();
+	grid->set_point_solid(Vector2i(7, 7));
+
+	TypedArray<Vector2i> from_ids;
+	TypedArray<Vector2i> to_ids;
+	from_ids.push_back(Vector2i(0, 0));
+	to_ids.push_back(Vector2i(3, 3));
+	from_ids.push_back(Vector2i(1, 1));
+	to_ids.push_back(Vector2i(7, 7));
+	from_ids.push_back(Vector2i(2, 5));
+	to_ids.push_back(Vector2i(2, 5));
+
+	Array paths = grid->get_id_paths(from_ids, to_ids);
+	REQUIRE(paths.size() == 3);
+	CHECK(TypedArray<Vector2i>(paths[0]) == grid->get_id_path(Vector2i(0, 0), Vector2i(3, 3)));
+	CHECK(TypedArray<Vector2i>(paths[1]).is_empty());
+	CHECK(TypedArray<Vector2i>(paths[2]).size() == 1);
+
+	ERR_PRINT_OFF;
+	to_ids.pop_back();
+	CHECK(grid->get_id_paths(from_ids, to_ids).is_empty());
+	ERR_PRINT_ON;
+}
 } // namespace TestAStar
 
 #endif // TEST_ASTAR_H
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_math_batch.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MATH_BATCH_H
+#define TEST_MATH_BATCH_H
+
+#include "core/math/math_batch.h"
+#include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMathBatch {
+
+static Vector<Vector3> make_points() {
+	Vector<Vector3> points;
+	for (int i = 0; i < 37; i++) {
+		points.push_back(Vector3(i * 0.5 - 3, Math::sin(i * 0.3) * 10, -i));
+	}
+	return points;
+}
+
+TEST_CASE("[MathBatch] Transforming points and vectors matches the scalar methods") {
+	const Vector<Vector3> points = make_points();
+	const Transform3D transform = Transform3D(Basis(Vector3(1, 2, 3).normalized(), 0.7).scaled(Vector3(2, 1, 0.5)), Vector3(4, -5, 6));
+
+	Vector<Vector3> result;
+	result.resize(points.size());
+
+	MathBatch::transform_points(transform, points.ptr(), result.ptrw(), points.size());
+	for (int i = 0; i < points.size(); i++) {
+		CHECK(result[i].is_equal_approx(transform.xform(points[i])));
+	}
+
+	MathBatch::transform_points_inv(transform.orthonormalized(), points.ptr(), result.ptrw(), points.size());
+	for (int i = 0; i < points.size(); i++) {
+		CHECK(result[i].is_equal_approx(transform.orthonormalized().xform_inv(points[i])));
+	}
+
+	MathBatch::transform_vectors(transform.basis, points.ptr(), result.ptrw(), points.size());
+	for (int i = 0; i < points.size(); i++) {
+		CHECK(result[i].is_equal_approx(transform.basis.xform(points[i])));
+	}
+
+	// In place.
+	result = points;
+	MathBatch::transform_points(transform, result.ptr(), result.ptrw(), result.size());
+	CHECK(result == transform.xform(points));
+
+	const Transform2D transform_2d = Transform2D(0.4, Size2(2, 3), 0.1, Vector2(7, -2));
+	Vector<Vector2> points_2d;
+	for (const Vector3 &p : points) {
+		points_2d.push_back(Vector2(p.x, p.y));
+	}
+	const Vector<Vector2> result_2d = transform_2d.xform(points_2d);
+	const Vector<Vector2> result_2d_inv = transform_2d.xform_inv(points_2d);
+	for (int i = 0; i < points_2d.size(); i++) {
+		CHECK(result_2d[i].is_equal_approx(transform_2d.xform(points_2d[i])));
+		CHECK(result_2d_inv[i].is_equal_approx(transform_2d.xform_inv(points_2d[i])));
+	}
+}
+
+TEST_CASE("[MathBatch] Products") {
+	const Vector<Vector3> a = make_points();
+	Vector<Vector3> b = a;
+	b.reverse();
+
+	Vector<real_t> dots;
+	dots.resize(a.size());
+	MathBatch::dot(a.ptr(), b.ptr(), dots.ptrw(), a.size());
+
+	Vector<Vector3> crosses;
+	crosses.resize(a.size());
+	MathBatch::cross(a.ptr(), b.ptr(), crosses.ptrw(), a.size());
+
+	for (int i = 0; i < a.size(); i++) {
+		CHECK(dots[i] == doctest::Approx(a[i].dot(b[i])));
+		CHECK(crosses[i].is_equal_approx(a[i].cross(b[i])));
+	}
+
+	const Basis basis = Basis(Vector3(0, 1, 0), 1.2);
+	Basis bases[3] = { Basis(), Basis(Vector3(1, 0, 0), 0.3), Basis().scaled(Vector3(1, 2, 3)) };
+	const Basis expected[3] = { basis * bases[0], basis * bases[1], basis * bases[2] };
+	MathBatch::basis_multiply(basis, bases, bases, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(bases[i].is_equal_approx(expected[i]));
+	}
+}
+
+TEST_CASE("[MathBatch] Bounding boxes") {
+	const Vector<Vector3> points = make_points();
+
+	AABB expected(points[0], Vector3());
+	for (const Vector3 &p : points) {
+		expected.expand_to(p);
+	}
+	CHECK(MathBatch::compute_aabb(points.ptr(), points.size()).is_equal_approx(expected));
+	CHECK(MathBatch::compute_aabb(points.ptr(), 0) == AABB());
+
+	const Vector2 points_2d[3] = { Vector2(1, 5), Vector2(-2, 3), Vector2(4, -1) };
+	CHECK(MathBatch::compute_rect(points_2d, 3).is_equal_approx(Rect2(-2, -1, 6, 6)));
+}
+
+} // namespace TestMathBatch
+
+#endif // TEST_MATH_BATCH_H
@@ -848,6 +848,29 @@ TEST_SUITE("[ClassDB]") {
 			}
 		}
 	}
+
+	TEST_CASE("[ClassDB] Frozen registry lookups match locked lookups") {
+		bool was_frozen = ClassDB::is_registry_frozen();
+
+		ClassDB::unfreeze_registry();
+		CHECK_FALSE(ClassDB::is_registry_frozen());
+		MethodBind *method = ClassDB::get_method("RefCounted", "get_reference_count");
+		CHECK(method != nullptr);
+
+		ClassDB::freeze_registry();
+		CHECK(ClassDB::is_registry_frozen());
+		CHECK(ClassDB::get_method("RefCounted", "get_reference_count") == method);
+		CHECK(ClassDB::get_method("RefCounted", "method_that_does_not_exist") == nullptr);
+		CHECK(ClassDB::class_exists("RefCounted"));
+		CHECK_FALSE(ClassDB::class_exists("ClassThatDoesNotExist"));
+		CHECK(ClassDB::is_parent_class("RefCounted", "Object"));
+		CHECK_FALSE(ClassDB::is_parent_class("Object", "RefCounted"));
+		CHECK(ClassDB::get_parent_class("RefCounted") == StringName("Object"));
+
+		if (!was_frozen) {
+			ClassDB::unfreeze_registry();
+		}
+	}
 }
 } // namespace TestClassDB
 
@@ -284,6 +284,24 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalReconnectingObject : public Object {
+public:
+	Object *emitter = nullptr;
+	int first_calls = 0;
+	int second_calls = 0;
+
+	void first() {
+		first_calls++;
+		// Swap connections while the signal is being emitted.
+		emitter->disconnect("my_custom_signal", callable_mp(this, &SignalReconnectingObject::first));
+		emitter->connect("my_custom_signal", callable_mp(this, &SignalReconnectingObject::second));
+	}
+
+	void second() {
+		second_calls++;
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -402,6 +420,22 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Connections changed during emission should only apply to the next emission") {
+		SignalReconnectingObject target;
+		target.emitter = &object;
+		object.connect("my_custom_signal", callable_mp(&target, &SignalReconnectingObject::first));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(target.first_calls == 1);
+		CHECK(target.second_calls == 0);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(target.first_calls == 1);
+		CHECK(target.second_calls == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&target, &SignalReconnectingObject::second));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  test_object_member_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_OBJECT_MEMBER_CACHE_H
+#define TEST_OBJECT_MEMBER_CACHE_H
+
+#include "core/object/object_member_cache.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/node.h"
+
+#include "tests/test_macros.h"
+
+namespace TestObjectMemberCache {
+
+TEST_CASE("[ObjectMemberCache] Property access matches Object::get and Object::set") {
+	Node *node = memnew(Node);
+	Node2D *node_2d = memnew(Node2D);
+	ObjectMemberCache cache("name");
+
+	bool valid = false;
+	cache.set(node, "Cached", &valid);
+	CHECK(valid);
+	CHECK(node->get_name() == "Cached");
+	CHECK(cache.get(node, &valid) == Variant(StringName("Cached")));
+	CHECK(valid);
+
+	// Same member on another class resolves again.
+	cache.set(node_2d, "Cached2D", &valid);
+	CHECK(valid);
+	CHECK(cache.get(node_2d) == node_2d->get("name"));
+	CHECK(cache.get(node) == node->get("name"));
+
+	ObjectMemberCache missing("property_that_does_not_exist");
+	missing.get(node, &valid);
+	CHECK_FALSE(valid);
+
+	memdelete(node_2d);
+	memdelete(node);
+}
+
+TEST_CASE("[ObjectMemberCache] Method calls match Object::callp") {
+	Node *node = memnew(Node);
+	node->add_child(memnew(Node));
+	ObjectMemberCache cache("get_child_count");
+
+	for (int i = 0; i < 2; i++) {
+		Callable::CallError ce;
+		Variant ret = cache.call(node, nullptr, 0, ce);
+		CHECK(ce.error == Callable::CallError::CALL_OK);
+		CHECK(int(ret) == 1);
+	}
+
+	ObjectMemberCache missing("method_that_does_not_exist");
+	Callable::CallError ce;
+	missing.call(node, nullptr, 0, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+
+	memdelete(node);
+}
+
+} // namespace TestObjectMemberCache
+
+#endif // TEST_OBJECT_MEMBER_CACHE_H
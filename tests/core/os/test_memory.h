@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Tagged allocations") {
+	CHECK(Memory::get_thread_tag() == Memory::TAG_DEFAULT);
+
+#ifdef DEBUG_ENABLED
+	const uint64_t usage_before = Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+	void *mem = nullptr;
+	{
+		MemoryTagScope memory_tag(Memory::TAG_AUDIO);
+		CHECK(Memory::get_thread_tag() == Memory::TAG_AUDIO);
+		mem = memalloc(1000);
+	}
+	CHECK(Memory::get_thread_tag() == Memory::TAG_DEFAULT);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage_before + 1000);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO) >= usage_before + 1000);
+
+	// Reallocations stay with the original tag, whatever the current one is.
+	mem = memrealloc(mem, 3000);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage_before + 3000);
+
+	memfree(mem);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == usage_before);
+#endif
+}
+
+TEST_CASE("[Memory] Tag names") {
+	CHECK(String(Memory::get_tag_name(Memory::TAG_DEFAULT)) == "default");
+	CHECK(String(Memory::get_tag_name(Memory::TAG_RENDERING)) == "rendering");
+	CHECK(String(Memory::get_tag_name(Memory::TAG_AUDIO)) == "audio");
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  test_string_builder.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_BUILDER_H
+#define TEST_STRING_BUILDER_H
+
+#include "core/string/string_builder.h"
+#include "core/string/text_builder.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringBuilder {
+
+TEST_CASE("[StringBuilder] Appending strings, C strings and characters") {
+	StringBuilder builder;
+	CHECK(builder.is_empty());
+	CHECK(builder.as_string() == "");
+
+	builder.append("Hello");
+	builder += String::utf8(", wörld");
+	builder += U'!';
+	builder.append(String());
+
+	CHECK(builder.num_strings_appended() == 3);
+	CHECK(builder.get_string_length() == 13);
+	CHECK(builder.as_string() == String::utf8("Hello, wörld!"));
+
+	builder.clear();
+	CHECK(builder.is_empty());
+	CHECK(builder.as_string() == "");
+}
+
+TEST_CASE("[StringBuilder] Building a large string") {
+	StringBuilder builder;
+	String expected;
+	for (int i = 0; i < 10000; i++) {
+		builder.append(itos(i));
+		expected += itos(i);
+	}
+	CHECK(builder.get_string_length() == (uint32_t)expected.length());
+	CHECK(builder.as_string() == expected);
+}
+
+TEST_CASE("[TextBuilder] Appending text") {
+	Ref<TextBuilder> builder;
+	builder.instantiate();
+	builder->reserve(64);
+	builder->append("a");
+	builder->append_line("b");
+	builder->append_line();
+
+	CHECK(builder->get_length() == 4);
+	CHECK(builder->get_text() == "ab\n\n");
+	CHECK(builder->to_string() == "ab\n\n");
+
+	builder->clear();
+	CHECK(builder->is_empty());
+}
+
+} // namespace TestStringBuilder
+
+#endif // TEST_STRING_BUILDER_H
@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	StringName a = "test_string_name_interning";
+	StringName b = String("test_string_name_interning");
+	StringName c = StringName::search("test_string_name_interning");
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(StringName::search("test_string_name_not_interned") == StringName());
+}
+
+TEST_CASE("[StringName] Many names survive bucket growth") {
+	// Enough names to grow the buckets of every shard at least once.
+	LocalVector<StringName> names;
+	for (int i = 0; i < 100000; i++) {
+		names.push_back(StringName("test_string_name_growth_" + itos(i)));
+	}
+
+	for (int i = 0; i < 100000; i += 997) {
+		StringName found = StringName::search("test_string_name_growth_" + itos(i));
+		CHECK(found == names[i]);
+		CHECK(found.data_unique_pointer() == names[i].data_unique_pointer());
+	}
+
+	names.clear();
+	CHECK(StringName::search("test_string_name_growth_0") == StringName());
+}
+
+struct StringNameThreadState {
+	static constexpr int NAME_COUNT = 2000;
+	LocalVector<StringName> results[4];
+
+	static void intern(void *p_userdata) {
+		LocalVector<StringName> *result = static_cast<LocalVector<StringName> *>(p_userdata);
+		for (int i = 0; i < NAME_COUNT; i++) {
+			result->push_back(StringName("test_string_name_thread_" + itos(i)));
+		}
+	}
+};
+
+TEST_CASE("[StringName] Interning from several threads") {
+	StringNameThreadState state;
+
+	Thread threads[4];
+	for (int i = 0; i < 4; i++) {
+		threads[i].start(&StringNameThreadState::intern, &state.results[i]);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	int mismatches = 0;
+	for (int i = 0; i < StringNameThreadState::NAME_COUNT; i++) {
+		const void *ptr = state.results[0][i].data_unique_pointer();
+		for (int j = 1; j < 4; j++) {
+			if (state.results[j][i].data_unique_pointer() != ptr) {
+				mismatches++;
+			}
+		}
+	}
+	CHECK(mismatches == 0);
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
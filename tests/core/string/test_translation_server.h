@@ -62,6 +62,40 @@ TEST_CASE("[TranslationServer] Translation operations") {
 	CHECK(ts->translate("Good Morning") == "Good Morning");
 }
 
+TEST_CASE("[TranslationServer] Cached translations follow changes") {
+	Ref<Translation> t_uk = memnew(Translation);
+	t_uk->set_locale("uk");
+	t_uk->add_message("Good Evening", String::utf8("Добрий вечір"));
+	Ref<Translation> t_de = memnew(Translation);
+	t_de->set_locale("de");
+	t_de->add_message("Good Evening", "Guten Abend");
+
+	TranslationServer *ts = TranslationServer::get_singleton();
+	ts->add_translation(t_uk);
+	ts->add_translation(t_de);
+
+	ts->set_locale("uk");
+	CHECK(ts->translate("Good Evening") == String::utf8("Добрий вечір"));
+	// Resolved from the cache the second time.
+	CHECK(ts->translate("Good Evening") == String::utf8("Добрий вечір"));
+
+	ts->set_locale("de");
+	CHECK(ts->translate("Good Evening") == "Guten Abend");
+
+	// Editing a loaded translation must not return stale results.
+	t_de->add_message("Good Evening", String::utf8("Schönen Abend"));
+	CHECK(ts->translate("Good Evening") == String::utf8("Schönen Abend"));
+	t_de->erase_message("Good Evening");
+	CHECK(ts->translate("Good Evening") == "Good Evening");
+
+	ts->set_locale("uk");
+	CHECK(ts->translate("Good Evening") == String::utf8("Добрий вечір"));
+
+	ts->remove_translation(t_uk);
+	ts->remove_translation(t_de);
+	CHECK(ts->translate("Good Evening") == "Good Evening");
+}
+
 TEST_CASE("[TranslationServer] Locale operations") {
 	TranslationServer *ts = TranslationServer::get_singleton();
 
@@ -381,6 +381,51 @@ TEST_CASE("[CommandQueue] Test Queue Lapping") {
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
 
+struct BatchRecorder {
+	LocalVector<int> calls;
+
+	void record(int p_value) {
+		calls.push_back(p_value);
+	}
+};
+
+TEST_CASE("[CommandQueue] Batched pushes are published together") {
+	CommandQueueMT command_queue(true);
+	BatchRecorder recorder;
+
+	command_queue.push(&recorder, &BatchRecorder::record, 0);
+	command_queue.begin_batch();
+	for (int i = 1; i < 100; i++) {
+		command_queue.push(&recorder, &BatchRecorder::record, i);
+	}
+	command_queue.flush_all();
+	CHECK_MESSAGE(recorder.calls.size() == 1,
+			"Commands of an open batch should not be visible to the consumer.");
+
+	command_queue.begin_batch();
+	command_queue.push(&recorder, &BatchRecorder::record, 100);
+	command_queue.end_batch();
+	command_queue.flush_all();
+	CHECK_MESSAGE(recorder.calls.size() == 1,
+			"Closing a nested batch should not publish it.");
+
+	command_queue.end_batch();
+	command_queue.flush_all();
+	REQUIRE(recorder.calls.size() == 101);
+	bool in_order = true;
+	for (int i = 0; i < 101; i++) {
+		in_order &= recorder.calls[i] == i;
+	}
+	CHECK_MESSAGE(in_order, "Batched commands should run in the order they were pushed.");
+
+	command_queue.begin_batch();
+	command_queue.push(&recorder, &BatchRecorder::record, 101);
+	command_queue.publish_batch();
+	command_queue.flush_all();
+	CHECK(recorder.calls.size() == 102);
+	command_queue.end_batch();
+}
+
 TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  test_flat_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+	CHECK_FALSE(map.find(43));
+}
+
+TEST_CASE("[FlatHashMap] Overwrite element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[FlatHashMap] Erase") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(43, 86);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(map.erase(43));
+	CHECK_FALSE(map.erase(43));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[FlatHashMap] Many elements with erasures") {
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < 10000; i++) {
+		map.insert(i, i * 2);
+	}
+	for (int i = 0; i < 10000; i += 2) {
+		map.erase(i);
+	}
+	// Reinsert over the deleted slots, which must not make other keys unreachable.
+	for (int i = 10000; i < 15000; i++) {
+		map.insert(i, i * 2);
+	}
+
+	CHECK(map.size() == 10000);
+	bool all_found = true;
+	for (int i = 0; i < 15000; i++) {
+		const int *value = map.getptr(i);
+		if (i < 10000 && i % 2 == 0) {
+			all_found &= value == nullptr;
+		} else {
+			all_found &= value != nullptr && *value == i * 2;
+		}
+	}
+	CHECK(all_found);
+
+	int64_t sum = 0;
+	uint32_t count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		sum += E.key;
+		count++;
+	}
+	CHECK(count == 10000);
+	CHECK(sum == int64_t(2500) * 10000 + int64_t(5000) * (10000 + 14999) / 2);
+}
+
+TEST_CASE("[FlatHashMap] Copy and clear") {
+	FlatHashMap<StringName, String> map;
+	map.insert("a", "A");
+	map.insert("b", "B");
+
+	FlatHashMap<StringName, String> copy = map;
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(copy.size() == 2);
+	CHECK(copy["b"] == "B");
+
+	map = copy;
+	CHECK(map.get("a") == "A");
+}
+
+TEST_CASE("[FlatHashMap][Benchmark] Lookups compared to HashMap" * doctest::skip()) {
+	const int element_count = 5000;
+	const int lookup_rounds = 200;
+
+	Vector<StringName> keys;
+	for (int i = 0; i < element_count; i++) {
+		keys.push_back(StringName("key_" + itos(i)));
+	}
+
+	HashMap<StringName, int> hash_map;
+	FlatHashMap<StringName, int> flat_map;
+	for (int i = 0; i < element_count; i++) {
+		hash_map.insert(keys[i], i);
+		flat_map.insert(keys[i], i);
+	}
+
+	int64_t hash_map_sum = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int r = 0; r < lookup_rounds; r++) {
+		for (int i = 0; i < element_count; i++) {
+			hash_map_sum += *hash_map.getptr(keys[i]);
+		}
+	}
+	const uint64_t hash_map_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	int64_t flat_map_sum = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int r = 0; r < lookup_rounds; r++) {
+		for (int i = 0; i < element_count; i++) {
+			flat_map_sum += *flat_map.getptr(keys[i]);
+		}
+	}
+	const uint64_t flat_map_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	CHECK(hash_map_sum == flat_map_sum);
+	MESSAGE("HashMap: ", hash_map_usec, " usec, FlatHashMap: ", flat_map_usec, " usec for ", element_count * lookup_rounds, " lookups.");
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -128,6 +128,23 @@ TEST_CASE("[HashMap] Const iteration") {
 		++idx;
 	}
 }
+
+TEST_CASE("[HashMap] Frame arena allocation") {
+	FrameAllocator::end_frame();
+
+	FrameHashMap<int, String> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, itos(i));
+	}
+	map.erase(500);
+
+	CHECK(map.size() == 999);
+	CHECK(!map.has(500));
+	CHECK(map[999] == "999");
+
+	map.clear();
+	FrameAllocator::end_frame();
+}
 } // namespace TestHashMap
 
 #endif // TEST_HASH_MAP_H
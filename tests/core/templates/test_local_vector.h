@@ -235,6 +235,76 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Frame arena allocation") {
+	FrameAllocator::end_frame();
+
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+	}
+	FrameLocalVector<int> other;
+	other.resize(100);
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+	}
+
+	CHECK(vector.size() == 20000);
+	bool all_kept = true;
+	for (int i = 0; i < 20000; i++) {
+		all_kept &= vector[i] == i % 10000;
+	}
+	CHECK(all_kept);
+	CHECK(FrameAllocator::get_thread_arena_size() >= 20000 * sizeof(int));
+
+	vector.reset();
+	other.reset();
+	FrameAllocator::end_frame();
+
+	// After a frame needing several blocks, a single one big enough is kept.
+	const uint64_t arena_size = FrameAllocator::get_thread_arena_size();
+	FrameLocalVector<int> next;
+	next.push_back(1);
+	CHECK(FrameAllocator::get_thread_arena_size() == arena_size);
+}
+
+TEST_CASE("[LocalVector] Inline storage") {
+	InlineLocalVector<String, 4> vector;
+	CHECK(vector.get_capacity() == 4);
+	for (int i = 0; i < 4; i++) {
+		vector.push_back(itos(i));
+	}
+	CHECK(vector.is_inline());
+
+	InlineLocalVector<String, 4> copy = vector;
+	CHECK(copy.is_inline());
+	CHECK(copy[3] == "3");
+
+	// Growing past the inline capacity moves the elements to the heap.
+	for (int i = 4; i < 20; i++) {
+		vector.push_back(itos(i));
+	}
+	CHECK_FALSE(vector.is_inline());
+	CHECK(vector.size() == 20);
+	bool all_kept = true;
+	for (int i = 0; i < 20; i++) {
+		all_kept &= vector[i] == itos(i);
+	}
+	CHECK(all_kept);
+
+	vector.remove_at(0);
+	CHECK(vector[0] == "1");
+	CHECK(vector.find("19") == 18);
+
+	copy = vector;
+	CHECK_FALSE(copy.is_inline());
+	CHECK(copy.size() == 19);
+
+	vector.reset();
+	CHECK(vector.is_inline());
+	CHECK(vector.is_empty());
+	CHECK(vector.get_capacity() == 4);
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
@@ -31,7 +31,10 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +99,83 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Allocation, lookup and free") {
+	RID_Owner<int> owner;
+	RID a = owner.make_rid(1);
+	RID b = owner.make_rid(2);
+
+	CHECK(owner.owns(a));
+	CHECK(*owner.get_or_null(b) == 2);
+	CHECK(owner.get_rid_count() == 2);
+
+	owner.free(a);
+	CHECK_FALSE(owner.owns(a));
+	CHECK(owner.get_or_null(a) == nullptr);
+
+	// The freed slot is reused, but the old RID must not resolve to the new element.
+	RID c = owner.make_rid(3);
+	CHECK(c.get_local_index() == a.get_local_index());
+	CHECK(owner.get_or_null(a) == nullptr);
+	CHECK(*owner.get_or_null(c) == 3);
+
+	owner.free(b);
+	owner.free(c);
+	CHECK(owner.get_rid_count() == 0);
+}
+
+struct RIDOwnerThreadState {
+	RID_Owner<uint64_t, true> owner = RID_Owner<uint64_t, true>(64); // Small chunks, so they get allocated while reading.
+	LocalVector<RID> stable_rids;
+	SafeFlag done;
+	SafeNumeric<uint32_t> failures;
+
+	static void reader(void *p_userdata) {
+		RIDOwnerThreadState *state = static_cast<RIDOwnerThreadState *>(p_userdata);
+		while (!state->done.is_set()) {
+			for (uint32_t i = 0; i < state->stable_rids.size(); i++) {
+				uint64_t *value = state->owner.get_or_null(state->stable_rids[i]);
+				if (!value || *value != i) {
+					state->failures.increment();
+				}
+			}
+		}
+	}
+};
+
+TEST_CASE("[RID_Owner] Lookups while other threads allocate") {
+	RIDOwnerThreadState state;
+	for (uint64_t i = 0; i < 100; i++) {
+		state.stable_rids.push_back(state.owner.make_rid(i));
+	}
+
+	Thread readers[2];
+	for (Thread &reader : readers) {
+		reader.start(&RIDOwnerThreadState::reader, &state);
+	}
+
+	LocalVector<RID> transient_rids;
+	for (int round = 0; round < 20; round++) {
+		for (uint64_t i = 0; i < 1000; i++) {
+			transient_rids.push_back(state.owner.make_rid(i));
+		}
+		for (const RID &rid : transient_rids) {
+			state.owner.free(rid);
+		}
+		transient_rids.clear();
+	}
+
+	state.done.set();
+	for (Thread &reader : readers) {
+		reader.wait_to_finish();
+	}
+
+	CHECK(state.failures.get() == 0);
+	CHECK(state.owner.get_rid_count() == 100);
+	for (const RID &rid : state.stable_rids) {
+		state.owner.free(rid);
+	}
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
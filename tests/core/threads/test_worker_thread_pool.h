@@ -106,6 +106,121 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_leaf_test(void *p_arg) {
+	counter[(uint64_t)p_arg].increment();
+}
+static void static_nested_test(void *p_arg) {
+	// Tasks posted from pool threads go to their local queues, where other threads can steal them.
+	const uint64_t base = (uint64_t)p_arg * 8;
+	WorkerThreadPool::TaskID subtasks[8];
+	for (uint64_t i = 0; i < 8; i++) {
+		subtasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_leaf_test, (void *)(uintptr_t)(base + i), true);
+	}
+	for (uint64_t i = 0; i < 8; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(subtasks[i]);
+	}
+}
+TEST_CASE("[WorkerThreadPool] Process tasks spawned from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+
+		counter.clear();
+		counter.resize(count * 8);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(count);
+		for (int i = 0; i < count; i++) {
+			tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_test, (void *)(uintptr_t)i, true);
+		}
+		for (int i = 0; i < count; i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		bool all_run_once = true;
+		for (int i = 0; i < count * 8; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static void static_range_group_test(void *p_arg, uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		counter[i].increment();
+	}
+}
+TEST_CASE("[WorkerThreadPool] Process element ranges using range group tasks") {
+	for (int iterations = 0; iterations < 200; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 12.0f));
+		const int begin = Math::rand() % 8;
+		const uint32_t grain = Math::rand() % 2 ? 0 : Math::rand() % 16 + 1;
+
+		counter.clear();
+		counter.resize(begin + count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_range_group_task(static_range_group_test, nullptr, begin, begin + count, grain, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		WorkerThreadPool::get_singleton()->parallel_for_range(begin, begin + count, grain, [](uint32_t p_from, uint32_t p_to) {
+			for (uint32_t i = p_from; i < p_to; i++) {
+				counter[i].increment();
+			}
+		});
+
+		bool all_run_twice = true;
+		for (int i = 0; i < begin; i++) {
+			all_run_twice &= counter[i].get() == 0;
+		}
+		for (int i = begin; i < begin + count; i++) {
+			all_run_twice &= counter[i].get() == 2;
+		}
+		CHECK(all_run_twice);
+	}
+}
+
+static SafeNumeric<int> dependency_step;
+static SafeFlag dependency_order_ok;
+static void static_dependency_first_test(void *p_arg) {
+	OS::get_singleton()->delay_usec(100);
+	dependency_step.increment();
+}
+static void static_dependency_group_test(void *p_arg, uint32_t p_index) {
+	if (dependency_step.get() != 2) {
+		dependency_order_ok.clear();
+	}
+	counter[p_index].increment();
+}
+static void static_dependency_last_test(void *p_arg) {
+	for (uint32_t i = 0; i < counter.size(); i++) {
+		if (counter[i].get() != 1) {
+			dependency_order_ok.clear();
+		}
+	}
+}
+TEST_CASE("[WorkerThreadPool] Run tasks and groups after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		dependency_step.set(0);
+		dependency_order_ok.set();
+
+		WorkerThreadPool::TaskID first[2];
+		first[0] = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_first_test, nullptr, !low_priority);
+		first[1] = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_first_test, nullptr, !low_priority);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task_with_dependencies(static_dependency_group_test, nullptr, count, first, 2, -1, !low_priority);
+		WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_task_with_dependencies(static_dependency_last_test, nullptr, &group, 1, low_priority);
+
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(first[0]);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(first[1]);
+
+		CHECK(dependency_order_ok.is_set());
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
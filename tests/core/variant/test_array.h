@@ -545,6 +545,72 @@ TEST_CASE("[Array] Recursive self comparison") {
 	a2.clear();
 }
 
+TEST_CASE("[Array] Typed scalar arrays searching and sorting") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Variant());
+	ints.push_back(5);
+	ints.push_back(-3);
+	ints.push_back(12);
+	ints.push_back(-3);
+
+	CHECK(ints.find(-3) == 1);
+	CHECK(ints.find(-3, 2) == 3);
+	CHECK(ints.find(-3, 10) == -1);
+	CHECK(ints.find(7) == -1);
+	CHECK(ints.rfind(-3) == 3);
+	CHECK(ints.rfind(-3, 2) == 1);
+	CHECK(ints.count(-3) == 2);
+	CHECK(ints.has(12));
+	CHECK(int(ints.min()) == -3);
+	CHECK(int(ints.max()) == 12);
+
+	ints.sort();
+	CHECK(int(ints[0]) == -3);
+	CHECK(int(ints[1]) == -3);
+	CHECK(int(ints[2]) == 5);
+	CHECK(int(ints[3]) == 12);
+
+	Array floats;
+	floats.set_typed(Variant::FLOAT, StringName(), Variant());
+	floats.push_back(2.5);
+	floats.push_back(NAN);
+	floats.push_back(-1.0);
+	CHECK(floats.find(NAN) == 1);
+	CHECK(floats.count(-1.0) == 1);
+
+	Array strings;
+	strings.set_typed(Variant::STRING, StringName(), Variant());
+	strings.push_back("b");
+	strings.push_back("c");
+	strings.push_back("a");
+	CHECK(strings.find("c") == 1);
+	CHECK(strings.find(StringName("c")) == 1);
+	CHECK(String(strings.min()) == "a");
+	strings.sort();
+	CHECK(String(strings[0]) == "a");
+	CHECK(String(strings[2]) == "c");
+
+	Array duplicate = strings.duplicate(true);
+	CHECK(duplicate.is_typed());
+	CHECK(duplicate == strings);
+	duplicate[0] = "z";
+	CHECK(String(strings[0]) == "a");
+}
+
+TEST_CASE("[Array] Typed scalar arrays with elements of another type") {
+	// operator[] does not validate the type, so the native paths must not assume it.
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Variant());
+	ints.push_back(3);
+	ints.push_back(1);
+	ints[1] = "text";
+
+	CHECK(ints.find(3) == 0);
+	CHECK(ints.count(1) == 0);
+	ints.sort();
+	CHECK(ints.size() == 2);
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
@@ -1755,6 +1755,45 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays") {
+	PackedInt32Array ints;
+	ints.push_back(-3);
+	ints.push_back(0);
+	ints.push_back(2147483647);
+	PackedFloat32Array floats;
+	floats.push_back(1.5);
+	floats.push_back(-0.25e-3);
+	floats.push_back(INFINITY);
+	Array a = build_array(ints, floats, PackedByteArray(), PackedFloat64Array());
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant a_parsed;
+
+	ss.s = a_str;
+	Error err = VariantParser::parse(&ss, a_parsed, errs, line);
+	CHECK(err == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
+
+	Variant bytes;
+	VariantParser::StreamString bss;
+	bss.s = "PackedByteArray( 1, 2 ; comment\n , 255 )";
+	err = VariantParser::parse(&bss, bytes, errs, line);
+	CHECK(err == OK);
+	CHECK(bytes.get_type() == Variant::PACKED_BYTE_ARRAY);
+	CHECK(PackedByteArray(bytes).size() == 3);
+	CHECK(PackedByteArray(bytes)[2] == 255);
+
+	Variant invalid;
+	VariantParser::StreamString iss;
+	iss.s = "PackedInt32Array(1, 2,)";
+	err = VariantParser::parse(&iss, invalid, errs, line);
+	CHECK(err == ERR_PARSE_ERROR);
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -0,0 +1,310 @@
+/**************************************************************************/
+/*  test_benchmarks.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/math/a_star.h"
+#include "core/math/dynamic_bvh.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+#include "core/version.h"
+
+// Microbenchmarks for hot engine paths, run with `godot --test benchmarks`.
+// Results are printed as JSON (or saved with `--bench-output <path>`) so that
+// they can be compared between commits. `--bench-filter <text>` only runs the
+// benchmarks whose name contains the given text.
+//
+// Each benchmark performs a fixed amount of work and returns the number of
+// operations done. It is run several times and the fastest run is reported,
+// which is the most stable measure across noisy machines.
+
+namespace TestBenchmarks {
+
+typedef uint64_t (*BenchmarkFunc)();
+
+// Results are accumulated here so the compiler can't discard the benchmarked work.
+static volatile uint64_t sink = 0;
+
+// Data shared between runs, built on first use and freed once all benchmarks are done.
+static HashMap<int, int> lookup_map;
+static DynamicBVH culling_bvh;
+static Ref<AStar3D> astar_grid;
+
+static uint64_t bench_hash_map_insert() {
+	const int count = 100000;
+	HashMap<int, int> map;
+	for (int i = 0; i < count; i++) {
+		map.insert(i * 7919, i);
+	}
+	sink = sink + map.size();
+	return count;
+}
+
+static uint64_t bench_hash_map_lookup() {
+	const int count = 100000;
+	if (lookup_map.is_empty()) {
+		for (int i = 0; i < count; i++) {
+			lookup_map.insert(i * 7919, i);
+		}
+	}
+	uint64_t found = 0;
+	for (int i = 0; i < count; i++) {
+		const int *value = lookup_map.getptr(i * 7919);
+		found += value ? *value : 0;
+	}
+	sink = sink + found;
+	return count;
+}
+
+static uint64_t bench_local_vector_push_back() {
+	const int count = 1000000;
+	LocalVector<int> vector;
+	for (int i = 0; i < count; i++) {
+		vector.push_back(i);
+	}
+	sink = sink + vector.size();
+	return count;
+}
+
+static uint64_t bench_vector_push_back() {
+	const int count = 1000000;
+	Vector<int> vector;
+	for (int i = 0; i < count; i++) {
+		vector.push_back(i);
+	}
+	sink = sink + vector.size();
+	return count;
+}
+
+static uint64_t bench_string_name_from_string() {
+	const int count = 100000;
+	const String name = "benchmark_string_name";
+	for (int i = 0; i < count; i++) {
+		StringName sn = name;
+		sink = sink + sn.hash();
+	}
+	return count;
+}
+
+static uint64_t bench_string_name_compare() {
+	const int count = 1000000;
+	const StringName a = "benchmark_a";
+	const StringName b = "benchmark_b";
+	uint64_t equal = 0;
+	for (int i = 0; i < count; i++) {
+		equal += (i & 1 ? a : b) == a;
+	}
+	sink = sink + equal;
+	return count;
+}
+
+static uint64_t bench_variant_operator_add() {
+	const int count = 1000000;
+	Variant accum = 0;
+	const Variant one = 1;
+	bool valid = true;
+	for (int i = 0; i < count; i++) {
+		Variant::evaluate(Variant::OP_ADD, accum, one, accum, valid);
+	}
+	sink = sink + (int64_t)accum;
+	return count;
+}
+
+static uint64_t bench_variant_call_builtin() {
+	const int count = 100000;
+	const StringName method = "length";
+	Variant vector = Vector3(1, 2, 3);
+	Callable::CallError ce;
+	Variant ret;
+	double total = 0;
+	for (int i = 0; i < count; i++) {
+		vector.callp(method, nullptr, 0, ret, ce);
+		total += (double)ret;
+	}
+	sink = sink + (uint64_t)total;
+	return count;
+}
+
+static uint64_t bench_variant_array_iterate() {
+	const int count = 100000;
+	Array array;
+	array.resize(count);
+	for (int i = 0; i < count; i++) {
+		array[i] = i;
+	}
+	int64_t total = 0;
+	for (int i = 0; i < array.size(); i++) {
+		total += (int64_t)array[i];
+	}
+	sink = sink + total;
+	return count;
+}
+
+static uint64_t bench_dynamic_bvh_query() {
+	// Culling-like workload: many small boxes, and queries covering a few of them each.
+	const int box_count = 10000;
+	const int query_count = 10000;
+	RandomPCG rng(1234);
+	if (culling_bvh.is_empty()) {
+		for (int i = 0; i < box_count; i++) {
+			const Vector3 pos(rng.random(-500.0f, 500.0f), rng.random(-500.0f, 500.0f), rng.random(-500.0f, 500.0f));
+			culling_bvh.insert(AABB(pos, Vector3(2, 2, 2)), nullptr);
+		}
+	}
+
+	struct CountResult {
+		uint64_t count = 0;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			count++;
+			return false;
+		}
+	} result;
+
+	for (int i = 0; i < query_count; i++) {
+		const Vector3 pos(rng.random(-500.0f, 500.0f), rng.random(-500.0f, 500.0f), rng.random(-500.0f, 500.0f));
+		culling_bvh.aabb_query(AABB(pos, Vector3(50, 50, 50)), result);
+	}
+	sink = sink + result.count;
+	return query_count;
+}
+
+static uint64_t bench_astar_grid_path() {
+	// Navigation-like workload: paths across a 64x64 grid graph.
+	const int side = 64;
+	const int path_count = 20;
+	if (astar_grid.is_null()) {
+		astar_grid.instantiate();
+		for (int y = 0; y < side; y++) {
+			for (int x = 0; x < side; x++) {
+				astar_grid->add_point(y * side + x, Vector3(x, 0, y));
+				if (x > 0) {
+					astar_grid->connect_points(y * side + x, y * side + x - 1);
+				}
+				if (y > 0) {
+					astar_grid->connect_points(y * side + x, (y - 1) * side + x);
+				}
+			}
+		}
+	}
+	uint64_t length = 0;
+	for (int i = 0; i < path_count; i++) {
+		length += astar_grid->get_id_path(i, side * side - 1 - i).size();
+	}
+	sink = sink + length;
+	return path_count;
+}
+
+struct Benchmark {
+	const char *name;
+	BenchmarkFunc func;
+};
+
+static const Benchmark benchmarks[] = {
+	{ "core/templates/hash_map_insert", &bench_hash_map_insert },
+	{ "core/templates/hash_map_lookup", &bench_hash_map_lookup },
+	{ "core/templates/local_vector_push_back", &bench_local_vector_push_back },
+	{ "core/templates/vector_push_back", &bench_vector_push_back },
+	{ "core/string/string_name_from_string", &bench_string_name_from_string },
+	{ "core/string/string_name_compare", &bench_string_name_compare },
+	{ "core/variant/operator_add", &bench_variant_operator_add },
+	{ "core/variant/call_builtin", &bench_variant_call_builtin },
+	{ "core/variant/array_iterate", &bench_variant_array_iterate },
+	{ "core/math/dynamic_bvh_query", &bench_dynamic_bvh_query },
+	{ "core/math/astar_grid_path", &bench_astar_grid_path },
+};
+
+static const int BENCHMARK_RUNS = 5;
+
+static void run_benchmarks() {
+	const List<String> args = OS::get_singleton()->get_cmdline_args();
+	String output_path;
+	String filter;
+	for (const List<String>::Element *E = args.front(); E; E = E->next()) {
+		if (E->get() == "--bench-output" && E->next()) {
+			output_path = E->next()->get();
+		} else if (E->get() == "--bench-filter" && E->next()) {
+			filter = E->next()->get();
+		}
+	}
+
+	Array results;
+	for (const Benchmark &benchmark : benchmarks) {
+		const String name = benchmark.name;
+		if (!filter.is_empty() && !name.contains(filter)) {
+			continue;
+		}
+
+		uint64_t best_usec = UINT64_MAX;
+		uint64_t operations = 0;
+		benchmark.func(); // Warm up caches and lazily built data.
+		for (int i = 0; i < BENCHMARK_RUNS; i++) {
+			const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			operations = benchmark.func();
+			best_usec = MIN(best_usec, OS::get_singleton()->get_ticks_usec() - begin);
+		}
+
+		Dictionary result;
+		result["name"] = name;
+		result["operations"] = operations;
+		result["usec"] = best_usec;
+		result["nsec_per_operation"] = operations ? double(best_usec) * 1000.0 / double(operations) : 0.0;
+		results.push_back(result);
+	}
+
+	lookup_map.clear();
+	culling_bvh.clear();
+	astar_grid.unref();
+
+	Dictionary report;
+	report["version"] = VERSION_FULL_BUILD;
+	report["runs"] = BENCHMARK_RUNS;
+	report["benchmarks"] = results;
+	const String json = JSON::stringify(report, "\t", false);
+
+	if (output_path.is_empty()) {
+		print_line(json);
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open benchmark output file: \"%s\".", output_path));
+	f->store_string(json);
+	print_line(vformat("Saved %d benchmark results to \"%s\".", results.size(), output_path));
+}
+
+} // namespace TestBenchmarks
+
+REGISTER_TEST_COMMAND("benchmarks", &TestBenchmarks::run_benchmarks);